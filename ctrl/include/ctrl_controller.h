@@ -37,6 +37,7 @@ struct ctrl_controller_struct {
     data_database_t *database;  /*!< pointer to external database */
     data_database_writer_t db_writer;  /*!< own instance of a database writer */
     data_database_reader_t db_reader;  /*!< own instance of a database reader */
+    bool bulk_mode_entered;  /*!< true if ctrl_controller_bulk_transaction_begin succeeded to start the bulk mode of db_writer */
     ctrl_undo_redo_list_t undo_redo_list;  /*!< own instance of a ctrl_undo_redo_list_t */
     consistency_checker_t consistency_checker;  /* own instance of a consistency checker */
     consistency_classifier_t consistency_classifier;  /*!< own instance of consistency_classifier_t */
@@ -100,6 +101,27 @@ static inline u8_error_t ctrl_controller_transaction_begin ( ctrl_controller_t *
  */
 static inline u8_error_t ctrl_controller_transaction_commit ( ctrl_controller_t *this_ );
 
+/*!
+ *  \brief Begins a transaction in which many elements are created, e.g. when importing a file
+ *
+ *  In addition to ctrl_controller_transaction_begin,
+ *  new records are created by reusable prepared statements.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, an error id otherwise, e.g. U8_ERROR_NO_DB in case the database is not open
+ */
+static inline u8_error_t ctrl_controller_bulk_transaction_begin ( ctrl_controller_t *this_ );
+
+/*!
+ *  \brief Commits a transaction that was started by ctrl_controller_bulk_transaction_begin
+ *
+ *  The bulk mode of the database writer is only ended if ctrl_controller_bulk_transaction_begin had started it.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, an error id otherwise
+ */
+static inline u8_error_t ctrl_controller_bulk_transaction_commit ( ctrl_controller_t *this_ );
+
 /* ================================ interface for undo redo ================================ */
 
 /*!
@@ -164,6 +186,22 @@ static inline u8_error_t ctrl_controller_get_redo_iterator ( const ctrl_controll
                                                              ctrl_undo_redo_iterator_t *out_redo_iterator
                                                            );
 
+/*!
+ *  \brief gets an iterator on all actions that changed the data since the given revision
+ *
+ *  The iterator is valid only till the next change action on the data.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param revision the revision of an earlier state of the data, e.g. when the data was last written to a file
+ *  \param[out] out_changes_iterator a valid iterator if U8_ERROR_NONE (providing NULL is not allowed)
+ *  \return U8_ERROR_NOT_FOUND if the changes since revision are not known (anymore),
+ *          U8_ERROR_NONE otherwise.
+ */
+static inline u8_error_t ctrl_controller_get_changes_since ( const ctrl_controller_t *this_,
+                                                             data_revision_t revision,
+                                                             ctrl_undo_redo_iterator_t *out_changes_iterator
+                                                           );
+
 /*!
  *  \brief resets the undo redo list to empty
  *
@@ -28,6 +28,31 @@ static inline u8_error_t ctrl_controller_transaction_commit ( ctrl_controller_t
     return result;
 }
 
+static inline u8_error_t ctrl_controller_bulk_transaction_begin ( ctrl_controller_t *this_ )
+{
+    u8_error_t result = ctrl_controller_transaction_begin( this_ );
+    if ( result == U8_ERROR_NONE )
+    {
+        const u8_error_t bulk_err = data_database_writer_begin_bulk_mode( &((*this_).db_writer) );
+        (*this_).bulk_mode_entered = ( bulk_err == U8_ERROR_NONE );
+        result |= bulk_err;
+    }
+    return result;
+}
+
+static inline u8_error_t ctrl_controller_bulk_transaction_commit ( ctrl_controller_t *this_ )
+{
+    /* finalize the prepared statements before the commit so that no statement holds a read lock */
+    u8_error_t result = U8_ERROR_NONE;
+    if ( (*this_).bulk_mode_entered )
+    {
+        result |= data_database_writer_end_bulk_mode( &((*this_).db_writer) );
+        (*this_).bulk_mode_entered = false;
+    }
+    result |= ctrl_controller_transaction_commit( this_ );
+    return result;
+}
+
 /* ================================ interface for undo redo ================================ */
 
 static inline u8_error_t ctrl_controller_undo ( ctrl_controller_t *this_, data_stat_t *io_stat )
@@ -56,6 +81,14 @@ static inline u8_error_t ctrl_controller_get_redo_iterator ( const ctrl_controll
     return ctrl_undo_redo_list_get_redo_iterator( &((*this_).undo_redo_list), out_redo_iterator );
 }
 
+static inline u8_error_t ctrl_controller_get_changes_since ( const ctrl_controller_t *this_,
+                                                             data_revision_t revision,
+                                                             ctrl_undo_redo_iterator_t *out_changes_iterator )
+{
+    assert ( NULL != out_changes_iterator );
+    return ctrl_undo_redo_list_get_changes_since( &((*this_).undo_redo_list), revision, out_changes_iterator );
+}
+
 static inline void ctrl_controller_reset_undo_redo_list ( ctrl_controller_t *this_ )
 {
     ctrl_undo_redo_list_clear ( &((*this_).undo_redo_list) );
@@ -76,6 +109,11 @@ static inline u8_error_t ctrl_controller_repair_database ( ctrl_controller_t *th
                                                     out_fix,
                                                     out_english_report
                                                   );
+    if ( modify_db )
+    {
+        /* repairs are not recorded as actions, the undo redo list does not describe the changes anymore */
+        ctrl_undo_redo_list_clear( &((*this_).undo_redo_list) );
+    }
     return result;
 }
 
@@ -6,10 +6,12 @@
 /* public file for the doxygen documentation: */
 /*!
  *  \file
- *  \brief Iterates over a set of ctrl_undo_redo_entry_t of that are stored in a ring buffer
+ *  \brief Iterates over a set of ctrl_undo_redo_record_t that are stored in a ring buffer,
+ *  provides each as expanded ctrl_undo_redo_entry_t
  */
 
 #include "ctrl_undo_redo_entry.h"
+#include "ctrl_undo_redo_record.h"
 #include <stdbool.h>
 
 /*!
@@ -19,11 +21,12 @@
  *  while ( has_next() ) { element = next() };
  */
 struct ctrl_undo_redo_iterator_struct {
-    const ctrl_undo_redo_entry_t (*ring_buf)[];  /*!< the ring buffer address */
+    const ctrl_undo_redo_record_t (*ring_buf)[];  /*!< the ring buffer address */
     uint32_t ring_buf_size;  /*!< the ring buffer size, unit is array-element */
     bool iterate_upwards;  /*!< true if next is (current+1)%ring_buf_size, false if downwards direction */
     uint32_t current;  /*!< index of current element, range 0..(ring_buf_size-1) */
     uint32_t length;  /*!< remaining number of elements to iterate over, range 0..ring_buf_size */
+    ctrl_undo_redo_entry_t next_entry;  /*!< the expanded record that was returned by the last call to next() */
 };
 
 typedef struct ctrl_undo_redo_iterator_struct ctrl_undo_redo_iterator_t;
@@ -39,7 +42,7 @@ typedef struct ctrl_undo_redo_iterator_struct ctrl_undo_redo_iterator_t;
  *  \param length remaining number of elements to iterate over, range 0..ring_buf_size
  */
 static inline void ctrl_undo_redo_iterator_init ( ctrl_undo_redo_iterator_t *this_,
-                                                  const ctrl_undo_redo_entry_t (*ring_buf)[],
+                                                  const ctrl_undo_redo_record_t (*ring_buf)[],
                                                   uint32_t ring_buf_size,
                                                   bool iterate_upwards,
                                                   uint32_t current,
@@ -57,7 +60,7 @@ static inline void ctrl_undo_redo_iterator_init ( ctrl_undo_redo_iterator_t *thi
  *  \param length remaining number of elements to iterate over, range 0..ring_buf_size
  */
 static inline void ctrl_undo_redo_iterator_reinit ( ctrl_undo_redo_iterator_t *this_,
-                                                    const ctrl_undo_redo_entry_t (*ring_buf)[],
+                                                    const ctrl_undo_redo_record_t (*ring_buf)[],
                                                     uint32_t ring_buf_size,
                                                     bool iterate_upwards,
                                                     uint32_t current,
@@ -90,7 +93,7 @@ static inline bool ctrl_undo_redo_iterator_has_next ( const ctrl_undo_redo_itera
  *  \brief reads the next ctrl_undo_redo_entry_t from the iterator.
  *
  *  \param this_ pointer to own object attributes
- *  \return the next ctrl_undo_redo_entry_t from the iterator
+ *  \return the next ctrl_undo_redo_entry_t from the iterator, valid till the next call to next() or destroy()
  */
 static inline const ctrl_undo_redo_entry_t * ctrl_undo_redo_iterator_next ( ctrl_undo_redo_iterator_t *this_ );
 
@@ -1,7 +1,7 @@
 /* File: ctrl_undo_redo_iterator.inl; Copyright and License: see below */
 
 static inline void ctrl_undo_redo_iterator_init ( ctrl_undo_redo_iterator_t *this_,
-                                                  const ctrl_undo_redo_entry_t (*ring_buf)[],
+                                                  const ctrl_undo_redo_record_t (*ring_buf)[],
                                                   uint32_t ring_buf_size,
                                                   bool iterate_upwards,
                                                   uint32_t current,
@@ -16,10 +16,11 @@ static inline void ctrl_undo_redo_iterator_init ( ctrl_undo_redo_iterator_t *thi
     (*this_).iterate_upwards = iterate_upwards;
     (*this_).current = current;
     (*this_).length = length;
+    ctrl_undo_redo_entry_init_empty( &((*this_).next_entry) );
 }
 
 static inline void ctrl_undo_redo_iterator_reinit ( ctrl_undo_redo_iterator_t *this_,
-                                                    const ctrl_undo_redo_entry_t (*ring_buf)[],
+                                                    const ctrl_undo_redo_record_t (*ring_buf)[],
                                                     uint32_t ring_buf_size,
                                                     bool iterate_upwards,
                                                     uint32_t current,
@@ -35,11 +36,13 @@ static inline void ctrl_undo_redo_iterator_init_empty ( ctrl_undo_redo_iterator_
     (*this_).iterate_upwards = true;
     (*this_).current = 0;
     (*this_).length = 0;
+    ctrl_undo_redo_entry_init_empty( &((*this_).next_entry) );
 }
 
 static inline void ctrl_undo_redo_iterator_destroy ( ctrl_undo_redo_iterator_t *this_ )
 {
     (*this_).ring_buf = NULL;
+    ctrl_undo_redo_entry_destroy( &((*this_).next_entry) );
 }
 
 static inline bool ctrl_undo_redo_iterator_has_next ( const ctrl_undo_redo_iterator_t *this_ )
@@ -54,7 +57,8 @@ static inline const ctrl_undo_redo_entry_t * ctrl_undo_redo_iterator_next ( ctrl
     const ctrl_undo_redo_entry_t * result = NULL;
     if ( (*this_).length > 0 )
     {
-        result = &((*(*this_).ring_buf)[(*this_).current]);
+        ctrl_undo_redo_record_expand( &((*(*this_).ring_buf)[(*this_).current]), &((*this_).next_entry) );
+        result = &((*this_).next_entry);
         if ( (*this_).iterate_upwards )
         {
             (*this_).current = ( (*this_).current + 1 ) % (*this_).ring_buf_size;
@@ -7,9 +7,13 @@
 /*!
  *  \file
  *  \brief reverts and re-performs changes to the database
+ *
+ *  The list stores the actions as compact ctrl_undo_redo_record_t;
+ *  the depth of the history is limited by the number of records and by the bytes of their payloads.
  */
 
 #include "ctrl_undo_redo_entry.h"
+#include "ctrl_undo_redo_record.h"
 #include "ctrl_undo_redo_iterator.h"
 #include "u8/u8_error.h"
 #include "storage/data_database_writer.h"
@@ -23,7 +27,8 @@
  *  \brief constants for max undo redo list size
  */
 enum ctrl_undo_redo_list_max_enum {
-    CTRL_UNDO_REDO_LIST_MAX_SIZE = 256,  /*!< maximum number of action-steps that can be un-done/re-done */
+    CTRL_UNDO_REDO_LIST_MAX_SIZE = 4096,  /*!< maximum number of action-steps that can be un-done/re-done */
+    CTRL_UNDO_REDO_LIST_MAX_PAYLOAD = (1024*1024),  /*!< maximum number of bytes that the encoded action-steps may occupy */
 };
 
 /*!
@@ -37,7 +42,14 @@ struct ctrl_undo_redo_list_struct {
     uint32_t length;  /*!< length of valid entries in the ring buffer (0 &lt;= length &lt;= CTRL_UNDO_REDO_LIST_MAX_SIZE) */
     uint32_t current;  /*!< current position in the ring buffer (relative to start position: 0 &lt;= current &lt;= length). If length == current, there is no redo action left */
     bool buffer_incomplete;  /*!< true if the first entry in the list is already overwritten. buffer_incomplete influences the error code of the undo function */
-    ctrl_undo_redo_entry_t buffer[CTRL_UNDO_REDO_LIST_MAX_SIZE];  /*!< the ring buffer of undo/redo action entries and boundary entries */
+    ctrl_undo_redo_record_t buffer[CTRL_UNDO_REDO_LIST_MAX_SIZE];  /*!< the ring buffer of undo/redo action records and boundary records */
+    char payload_arena[CTRL_UNDO_REDO_LIST_MAX_PAYLOAD];  /*!< ring buffer of the record payloads, in the same order as the records in buffer */
+    uint32_t payload_count;  /*!< number of records in buffer that own a payload; if 0, the payload_arena is empty */
+    uint32_t payload_head;  /*!< offset of the payload of the oldest record in payload_arena */
+    uint32_t payload_tail;  /*!< offset after the payload of the newest record in payload_arena */
+    bool payload_wrapped;  /*!< true if the newest payloads were allocated from the start of payload_arena again */
+    uint32_t payload_wrap_end;  /*!< if payload_wrapped, offset after the last payload before the wrap-around */
+    ctrl_undo_redo_entry_t temp_entry;  /*!< an expanded entry, used when adding, un-doing and re-doing actions */
 };
 
 typedef struct ctrl_undo_redo_list_struct ctrl_undo_redo_list_t;
@@ -151,6 +163,26 @@ u8_error_t ctrl_undo_redo_list_get_redo_iterator ( const ctrl_undo_redo_list_t *
                                                    ctrl_undo_redo_iterator_t *out_redo_iterator
                                                  );
 
+/*!
+ *  \brief gets an iterator on all entries that changed the data since the given revision
+ *
+ *  The given revision is searched in the boundary entries of the list.
+ *  If the current state was reached by un-doing actions, the iterator returns the un-done entries.
+ *  The iterator may return boundary entries in-between.
+ *
+ *  The iterator is valid only till the next change action on the data.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param revision the revision of an earlier state of the data
+ *  \param[out] out_changes_iterator a valid iterator if U8_ERROR_NONE (providing NULL is not allowed)
+ *  \return U8_ERROR_NOT_FOUND if revision is not known to the list, e.g. because older entries were already overwritten,
+ *          U8_ERROR_NONE otherwise.
+ */
+u8_error_t ctrl_undo_redo_list_get_changes_since ( const ctrl_undo_redo_list_t *this_,
+                                                   data_revision_t revision,
+                                                   ctrl_undo_redo_iterator_t *out_changes_iterator
+                                                 );
+
 /* ================================ DIAGRAM ================================ */
 
 /*!
@@ -398,16 +430,50 @@ u8_error_t ctrl_undo_redo_list_private_do_action ( ctrl_undo_redo_list_t *this_,
 /*!
  *  \brief adds an entry to the list.
  *
+ *  The entry is encoded to a ctrl_undo_redo_record_t, its payload is stored in the payload_arena.
  *  This method may overwrite the oldest entries in the list
- *  (which is implemented as a ring-buffer).
+ *  (which is implemented as a ring-buffer)
+ *  if either the number of entries or the size of the payloads exceeds its limit.
  *  This method overwrites all list-entries newer than the current position
  *  (which happens if the user un-does an action and the current position is
  *  not at the end of the list anymore).
  *
  *  \param this_ pointer to own object attributes
- *  \return pointer to an initialized entry
+ *  \param entry the entry to be added, the list does not keep a reference
+ */
+void ctrl_undo_redo_list_private_add_entry ( ctrl_undo_redo_list_t *this_, const ctrl_undo_redo_entry_t *entry );
+
+/*!
+ *  \brief allocates a contiguous area in the payload_arena, after the payload of the newest record.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param size number of bytes needed, greater than 0
+ *  \return address of the allocated area, NULL if there is not enough space without dropping old records
+ */
+char *ctrl_undo_redo_list_private_alloc_payload ( ctrl_undo_redo_list_t *this_, uint32_t size );
+
+/*!
+ *  \brief drops the oldest record of the list and frees its payload at the head of the payload_arena.
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void ctrl_undo_redo_list_private_drop_oldest ( ctrl_undo_redo_list_t *this_ );
+
+/*!
+ *  \brief drops the newest record of the list and frees its payload at the tail of the payload_arena.
+ *
+ *  The current position is moved back if it is behind the new end of the list.
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void ctrl_undo_redo_list_private_drop_newest ( ctrl_undo_redo_list_t *this_ );
+
+/*!
+ *  \brief marks the payload_arena as empty
+ *
+ *  \param this_ pointer to own object attributes
  */
-ctrl_undo_redo_entry_t *ctrl_undo_redo_list_private_add_entry_ptr ( ctrl_undo_redo_list_t *this_ );
+static inline void ctrl_undo_redo_list_private_reset_payload ( ctrl_undo_redo_list_t *this_ );
 
 /*!
  *  \brief counts the boundary entries in a given range
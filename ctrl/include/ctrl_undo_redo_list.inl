@@ -13,11 +13,13 @@ static inline void ctrl_undo_redo_list_init ( ctrl_undo_redo_list_t *this_, data
     (*this_).db_writer = db_writer;
 
     const data_revision_t revision = data_database_reader_get_revision( (*this_).db_reader );
-    ctrl_undo_redo_entry_init_boundary( &((*this_).buffer[0]), revision );
+    ctrl_undo_redo_entry_init_boundary( &((*this_).temp_entry), revision );
+    ctrl_undo_redo_record_init( &((*this_).buffer[0]), &((*this_).temp_entry) );
     (*this_).start = 0;
     (*this_).length = 1;
     (*this_).current = 1;
     (*this_).buffer_incomplete = false;
+    ctrl_undo_redo_list_private_reset_payload( this_ );
 }
 
 static inline void ctrl_undo_redo_list_destroy ( ctrl_undo_redo_list_t *this_ )
@@ -37,16 +39,18 @@ static inline void ctrl_undo_redo_list_clear ( ctrl_undo_redo_list_t *this_ )
     for ( uint32_t pos = 0; pos < (*this_).length; pos ++ )
     {
         uint32_t index = ((*this_).start + pos) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-        ctrl_undo_redo_entry_destroy( &((*this_).buffer[index]) );
+        ctrl_undo_redo_record_destroy( &((*this_).buffer[index]) );
     }
 
     /* reset: */
     const data_revision_t revision = data_database_reader_get_revision( (*this_).db_reader );
-    ctrl_undo_redo_entry_init_boundary( &((*this_).buffer[0]), revision );
+    ctrl_undo_redo_entry_init_boundary( &((*this_).temp_entry), revision );
+    ctrl_undo_redo_record_init( &((*this_).buffer[0]), &((*this_).temp_entry) );
     (*this_).start = 0;
     (*this_).length = 1;
     (*this_).current = 1;
     (*this_).buffer_incomplete = false;
+    ctrl_undo_redo_list_private_reset_payload( this_ );
 }
 
 static inline u8_error_t ctrl_undo_redo_list_add_boundary ( ctrl_undo_redo_list_t *this_ )
@@ -55,8 +59,9 @@ static inline u8_error_t ctrl_undo_redo_list_add_boundary ( ctrl_undo_redo_list_
 
     /* add and re-initialize the list entry */
     const data_revision_t revision = data_database_reader_get_revision( (*this_).db_reader );
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_boundary( list_entry, revision );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 
     /* check if >=1 complete set of transactions is still in the undo-redo-list */
     if ( 1 == ctrl_undo_redo_list_private_count_boundaries( this_, (*this_).start, (*this_).length ) )
@@ -71,119 +76,143 @@ static inline u8_error_t ctrl_undo_redo_list_add_boundary ( ctrl_undo_redo_list_
 
 static inline void ctrl_undo_redo_list_add_delete_diagram ( ctrl_undo_redo_list_t *this_, const data_diagram_t *old_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_delete_diagram( list_entry, old_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_update_diagram ( ctrl_undo_redo_list_t *this_, const data_diagram_t *old_value, const data_diagram_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_update_diagram( list_entry, old_value, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_create_diagram ( ctrl_undo_redo_list_t *this_, const data_diagram_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_create_diagram( list_entry, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 /* ================================ DIAGRAMELEMENT ================================ */
 
 static inline void ctrl_undo_redo_list_add_delete_diagramelement ( ctrl_undo_redo_list_t *this_, data_diagramelement_t *old_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_delete_diagramelement( list_entry, old_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_update_diagramelement ( ctrl_undo_redo_list_t *this_, data_diagramelement_t *old_value, data_diagramelement_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_update_diagramelement( list_entry, old_value, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_create_diagramelement ( ctrl_undo_redo_list_t *this_, data_diagramelement_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_create_diagramelement( list_entry, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 /* ================================ CLASSIFIER ================================ */
 
 static inline void ctrl_undo_redo_list_add_delete_classifier ( ctrl_undo_redo_list_t *this_, data_classifier_t *old_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_delete_classifier( list_entry, old_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_update_classifier ( ctrl_undo_redo_list_t *this_, data_classifier_t *old_value, data_classifier_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_update_classifier( list_entry, old_value, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_create_classifier ( ctrl_undo_redo_list_t *this_, data_classifier_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_create_classifier( list_entry, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 /* ================================ FEATURE ================================ */
 
 static inline void ctrl_undo_redo_list_add_delete_feature ( ctrl_undo_redo_list_t *this_, data_feature_t *old_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_delete_feature( list_entry, old_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_update_feature ( ctrl_undo_redo_list_t *this_, data_feature_t *old_value, data_feature_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_update_feature( list_entry, old_value, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_create_feature ( ctrl_undo_redo_list_t *this_, data_feature_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_create_feature( list_entry, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 /* ================================ RELATIONSHIP ================================ */
 
 static inline void ctrl_undo_redo_list_add_delete_relationship ( ctrl_undo_redo_list_t *this_, data_relationship_t *old_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_delete_relationship( list_entry, old_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_update_relationship ( ctrl_undo_redo_list_t *this_, data_relationship_t *old_value, data_relationship_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_update_relationship( list_entry, old_value, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 static inline void ctrl_undo_redo_list_add_create_relationship ( ctrl_undo_redo_list_t *this_, data_relationship_t *new_value )
 {
-    /* add and re-initialize the list entry */
-    ctrl_undo_redo_entry_t *const list_entry = ctrl_undo_redo_list_private_add_entry_ptr( this_ );
+    /* initialize and add the list entry */
+    ctrl_undo_redo_entry_t *const list_entry = &((*this_).temp_entry);
     ctrl_undo_redo_entry_init_create_relationship( list_entry, new_value );
+    ctrl_undo_redo_list_private_add_entry( this_, list_entry );
 }
 
 /* ================================ private ================================ */
 
+static inline void ctrl_undo_redo_list_private_reset_payload ( ctrl_undo_redo_list_t *this_ )
+{
+    (*this_).payload_count = 0;
+    (*this_).payload_head = 0;
+    (*this_).payload_tail = 0;
+    (*this_).payload_wrapped = false;
+    (*this_).payload_wrap_end = 0;
+}
+
 static inline uint32_t ctrl_undo_redo_list_private_count_boundaries ( ctrl_undo_redo_list_t *this_, uint32_t start_idx, uint32_t search_len )
 {
     assert( search_len <= CTRL_UNDO_REDO_LIST_MAX_SIZE );
@@ -192,7 +221,7 @@ static inline uint32_t ctrl_undo_redo_list_private_count_boundaries ( ctrl_undo_
     for ( uint32_t pos = 0; pos < search_len; pos ++ )
     {
         uint32_t index = (start_idx + pos) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-        if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_entry_get_action_type( &((*this_).buffer[index]) ) )
+        if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_record_get_action_type( &((*this_).buffer[index]) ) )
         {
             result ++;
         }
@@ -0,0 +1,144 @@
+/* File: ctrl_undo_redo_record.h; Copyright and License: see below */
+
+#ifndef CTRL_UNDO_REDO_RECORD_H
+#define CTRL_UNDO_REDO_RECORD_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Stores a ctrl_undo_redo_entry_t in a compact, encoded form.
+ *
+ *  A ctrl_undo_redo_entry_t provides two complete entities (before and after the action),
+ *  each big enough for the largest entity type.
+ *  A ctrl_undo_redo_record_t encodes only the relevant data to a variable-length payload:
+ *  Number fields are stored with their size, text fields with their actual length.
+ *  For update actions, the entity after the action is stored as bitmask of changed fields
+ *  and the values of these changed fields only.
+ *
+ *  The payload memory is provided by the caller, see ctrl_undo_redo_list_t.
+ */
+
+#include "ctrl_undo_redo_entry.h"
+#include "ctrl_undo_redo_entry_type.h"
+#include "storage/data_revision.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *  \brief all data attributes needed for the record functions
+ */
+struct ctrl_undo_redo_record_struct {
+    ctrl_undo_redo_entry_type_t action_type;
+    uint32_t changed_fields;  /*!< bitmask of fields that differ between before and after, only for update actions */
+    data_revision_t boundary_revision;  /*!< database revision at a boundary, only for boundary actions */
+    const char *payload;  /*!< encoded entities, memory is owned by the caller; NULL if payload_size is 0 */
+    uint32_t payload_size;  /*!< number of bytes in payload */
+};
+
+typedef struct ctrl_undo_redo_record_struct ctrl_undo_redo_record_t;
+
+/*!
+ *  \brief initializes the ctrl_undo_redo_record_t struct to an empty boundary without payload
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void ctrl_undo_redo_record_init_empty ( ctrl_undo_redo_record_t *this_ );
+
+/*!
+ *  \brief initializes the ctrl_undo_redo_record_t struct from an entry, determines the needed payload size
+ *
+ *  The payload is not written yet, call ctrl_undo_redo_record_write_payload() afterwards.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param entry the entry to encode
+ *  \return number of bytes needed for the payload
+ */
+uint32_t ctrl_undo_redo_record_init ( ctrl_undo_redo_record_t *this_, const ctrl_undo_redo_entry_t *entry );
+
+/*!
+ *  \brief encodes the entry to the payload buffer and sets the payload of this record
+ *
+ *  \param this_ pointer to own object attributes, initialized by ctrl_undo_redo_record_init() for the same entry
+ *  \param entry the entry to encode
+ *  \param payload_buf buffer of at least ctrl_undo_redo_record_get_payload_size() bytes, owned by the caller
+ */
+void ctrl_undo_redo_record_write_payload ( ctrl_undo_redo_record_t *this_,
+                                           const ctrl_undo_redo_entry_t *entry,
+                                           char *payload_buf
+                                         );
+
+/*!
+ *  \brief destroys the ctrl_undo_redo_record_t struct
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void ctrl_undo_redo_record_destroy ( ctrl_undo_redo_record_t *this_ );
+
+/*!
+ *  \brief decodes the record to a complete ctrl_undo_redo_entry_t
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param out_entry the entry to initialize, must not be NULL
+ */
+void ctrl_undo_redo_record_expand ( const ctrl_undo_redo_record_t *this_, ctrl_undo_redo_entry_t *out_entry );
+
+/*!
+ *  \brief gets the action type
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return the action type of the record
+ */
+static inline ctrl_undo_redo_entry_type_t ctrl_undo_redo_record_get_action_type ( const ctrl_undo_redo_record_t *this_ );
+
+/*!
+ *  \brief gets the revision identifier of database at this boundary action
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return revision id
+ */
+static inline data_revision_t ctrl_undo_redo_record_get_boundary_revision ( const ctrl_undo_redo_record_t *this_ );
+
+/*!
+ *  \brief gets the bitmask of fields that were changed by an update action
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return bitmask, bit n is set if field n of the entity was changed; 0 if this is not an update action
+ */
+static inline uint32_t ctrl_undo_redo_record_get_changed_fields ( const ctrl_undo_redo_record_t *this_ );
+
+/*!
+ *  \brief gets the address of the payload
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return pointer to the payload, NULL if no payload is written
+ */
+static inline const char *ctrl_undo_redo_record_get_payload ( const ctrl_undo_redo_record_t *this_ );
+
+/*!
+ *  \brief gets the size of the payload
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of payload bytes
+ */
+static inline uint32_t ctrl_undo_redo_record_get_payload_size ( const ctrl_undo_redo_record_t *this_ );
+
+#include "ctrl_undo_redo_record.inl"
+
+#endif  /* CTRL_UNDO_REDO_RECORD_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
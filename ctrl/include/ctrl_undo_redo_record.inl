@@ -0,0 +1,60 @@
+/* File: ctrl_undo_redo_record.inl; Copyright and License: see below */
+
+#include <assert.h>
+
+static inline void ctrl_undo_redo_record_init_empty ( ctrl_undo_redo_record_t *this_ )
+{
+    (*this_).action_type = CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY;
+    (*this_).changed_fields = 0;
+    (*this_).boundary_revision = DATA_REVISION_VOID;
+    (*this_).payload = NULL;
+    (*this_).payload_size = 0;
+}
+
+static inline void ctrl_undo_redo_record_destroy ( ctrl_undo_redo_record_t *this_ )
+{
+    (*this_).payload = NULL;
+    (*this_).payload_size = 0;
+}
+
+static inline ctrl_undo_redo_entry_type_t ctrl_undo_redo_record_get_action_type ( const ctrl_undo_redo_record_t *this_ )
+{
+    return (*this_).action_type;
+}
+
+static inline data_revision_t ctrl_undo_redo_record_get_boundary_revision ( const ctrl_undo_redo_record_t *this_ )
+{
+    return (*this_).boundary_revision;
+}
+
+static inline uint32_t ctrl_undo_redo_record_get_changed_fields ( const ctrl_undo_redo_record_t *this_ )
+{
+    return (*this_).changed_fields;
+}
+
+static inline const char *ctrl_undo_redo_record_get_payload ( const ctrl_undo_redo_record_t *this_ )
+{
+    return (*this_).payload;
+}
+
+static inline uint32_t ctrl_undo_redo_record_get_payload_size ( const ctrl_undo_redo_record_t *this_ )
+{
+    return (*this_).payload_size;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
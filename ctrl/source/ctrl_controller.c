@@ -12,6 +12,7 @@ void ctrl_controller_init ( ctrl_controller_t *this_, data_database_t *database
     (*this_).database = database;
     data_database_reader_init( &((*this_).db_reader), database );
     data_database_writer_init( &((*this_).db_writer), &((*this_).db_reader), database );
+    (*this_).bulk_mode_entered = false;
     ctrl_undo_redo_list_init( &((*this_).undo_redo_list), &((*this_).db_reader), &((*this_).db_writer) );
     consistency_classifier_init( &((*this_).consistency_classifier), &((*this_).db_reader), &((*this_).classifiers) );
     consistency_feature_init( &((*this_).consistency_feature), &((*this_).db_reader), &((*this_).classifiers) );
@@ -12,7 +12,7 @@ u8_error_t ctrl_undo_redo_list_remove_boundary_from_end ( ctrl_undo_redo_list_t
     assert( (*this_).current <= (*this_).length );
 
     u8_error_t result = U8_ERROR_NONE;
-    ctrl_undo_redo_entry_t *boundary_entry;
+    ctrl_undo_redo_record_t *boundary_entry;
 
     if ( (*this_).current == 0 )
     {
@@ -27,7 +27,7 @@ u8_error_t ctrl_undo_redo_list_remove_boundary_from_end ( ctrl_undo_redo_list_t
 
         index = ((*this_).start + (*this_).current + (CTRL_UNDO_REDO_LIST_MAX_SIZE-1)) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
         boundary_entry = &((*this_).buffer[index]);
-        action = ctrl_undo_redo_entry_get_action_type ( boundary_entry );
+        action = ctrl_undo_redo_record_get_action_type ( boundary_entry );
         if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY != action )
         {
             /* current is not a boundary */
@@ -36,25 +36,13 @@ u8_error_t ctrl_undo_redo_list_remove_boundary_from_end ( ctrl_undo_redo_list_t
         else
         {
             /* drop all list-entries newer than the current position */
-            if ( (*this_).current < (*this_).length )
+            while ( (*this_).current < (*this_).length )
             {
-                /* call destructor of all later entries */
-                for ( uint32_t pos = (*this_).current; pos < (*this_).length; pos ++ )
-                {
-                    uint32_t del_index = ((*this_).start + pos) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-                    ctrl_undo_redo_entry_destroy( &((*this_).buffer[del_index]) );
-                }
-
-                /* shrink the list */
-                (*this_).length = (*this_).current;
+                ctrl_undo_redo_list_private_drop_newest( this_ );
             }
 
-            /* call destructor of boundary and remove it */
-            ctrl_undo_redo_entry_destroy( boundary_entry );
-
-            /* remove the boundary */
-            (*this_).length --;
-            (*this_).current --;
+            /* remove the boundary, this also moves the current position */
+            ctrl_undo_redo_list_private_drop_newest( this_ );
         }
     }
 
@@ -90,7 +78,9 @@ u8_error_t ctrl_undo_redo_list_undo ( ctrl_undo_redo_list_t *this_, data_stat_t
             /* check if we are done */
             const uint32_t index
                 = ((*this_).start + (*this_).current + (CTRL_UNDO_REDO_LIST_MAX_SIZE-1)) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-            ctrl_undo_redo_entry_t *const cur_entry = &((*this_).buffer[index]);
+            const ctrl_undo_redo_record_t *const cur_record = &((*this_).buffer[index]);
+            ctrl_undo_redo_entry_t *const cur_entry = &((*this_).temp_entry);
+            ctrl_undo_redo_record_expand( cur_record, cur_entry );
 
             if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_entry_get_action_type( cur_entry ) )
             {
@@ -144,7 +134,9 @@ u8_error_t ctrl_undo_redo_list_redo ( ctrl_undo_redo_list_t *this_, data_stat_t
             /* check if we are done */
             const uint32_t index
                 = ((*this_).start + (*this_).current + (CTRL_UNDO_REDO_LIST_MAX_SIZE-1)) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-            ctrl_undo_redo_entry_t *const cur_entry = &((*this_).buffer[index]);
+            const ctrl_undo_redo_record_t *const cur_record = &((*this_).buffer[index]);
+            ctrl_undo_redo_entry_t *const cur_entry = &((*this_).temp_entry);
+            ctrl_undo_redo_record_expand( cur_record, cur_entry );
 
             if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_entry_get_action_type( cur_entry ) )
             {
@@ -201,28 +193,17 @@ u8_error_t ctrl_undo_redo_list_get_undo_iterator ( const ctrl_undo_redo_list_t *
             = ( (*this_).start + (*this_).current + CTRL_UNDO_REDO_LIST_MAX_SIZE - 2 ) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
         const uint32_t undo_length = (*this_).current - 1;  /* total number of undo entries */
         uint32_t count = 0;
+        for ( bool finished = false; ( count < undo_length ) && ( ! finished ); )
         {
-            ctrl_undo_redo_iterator_t pre_scan;
-            ctrl_undo_redo_iterator_init( &pre_scan,
-                                          &((*this_).buffer),
-                                          CTRL_UNDO_REDO_LIST_MAX_SIZE,
-                                          false, /* NOT iterate_upwards */
-                                          last,
-                                          undo_length
-                                        );
-            for( bool finished = false; ctrl_undo_redo_iterator_has_next( &pre_scan ) && ( ! finished ); )
-            {
-                const ctrl_undo_redo_entry_t *next = ctrl_undo_redo_iterator_next( &pre_scan );
-                if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_entry_get_action_type( next ) )
-                {
-                    finished = true;
-                }
-                else
-                {
-                    count ++;
-                }
+            const uint32_t index = ( last + CTRL_UNDO_REDO_LIST_MAX_SIZE - count ) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
+            if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_record_get_action_type( &((*this_).buffer[index]) ) )
+            {
+                finished = true;
+            }
+            else
+            {
+                count ++;
             }
-            ctrl_undo_redo_iterator_destroy( &pre_scan );
         }
         if ( count == undo_length )
         {
@@ -279,28 +260,17 @@ u8_error_t ctrl_undo_redo_list_get_redo_iterator ( const ctrl_undo_redo_list_t *
     if ( redo_length > 0 )
     {
         uint32_t count = 0;
+        for ( bool finished = false; ( count < redo_length ) && ( ! finished ); )
         {
-            ctrl_undo_redo_iterator_t pre_scan;
-            ctrl_undo_redo_iterator_init( &pre_scan,
-                                          &((*this_).buffer),
-                                          CTRL_UNDO_REDO_LIST_MAX_SIZE,
-                                          true, /* iterate_upwards */
-                                          next,
-                                          redo_length
-                                        );
-            for( bool finished = false; ctrl_undo_redo_iterator_has_next( &pre_scan ) && ( ! finished ); )
-            {
-                const ctrl_undo_redo_entry_t *next = ctrl_undo_redo_iterator_next( &pre_scan );
-                if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_entry_get_action_type( next ) )
-                {
-                    finished = true;
-                }
-                else
-                {
-                    count ++;
-                }
+            const uint32_t index = ( next + count ) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
+            if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_record_get_action_type( &((*this_).buffer[index]) ) )
+            {
+                finished = true;
+            }
+            else
+            {
+                count ++;
             }
-            ctrl_undo_redo_iterator_destroy( &pre_scan );
         }
         assert( count < redo_length );
         ctrl_undo_redo_iterator_reinit( out_redo_iterator,
@@ -320,65 +290,236 @@ u8_error_t ctrl_undo_redo_list_get_redo_iterator ( const ctrl_undo_redo_list_t *
     return result;
 }
 
+u8_error_t ctrl_undo_redo_list_get_changes_since ( const ctrl_undo_redo_list_t *this_,
+                                                   data_revision_t revision,
+                                                   ctrl_undo_redo_iterator_t *out_changes_iterator )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != out_changes_iterator );
+    assert( (*this_).start < CTRL_UNDO_REDO_LIST_MAX_SIZE );
+    assert( (*this_).length <= CTRL_UNDO_REDO_LIST_MAX_SIZE );
+    assert( (*this_).current <= (*this_).length );  /* current is in 0..length, relative to start */
+    /*    B0   A1   A2   A3   B1   A4   B2   X   X    */
+    /*  0    1    2    3    4    5    6    7   8   9  */
+    /*  ^ start                            ^ current  */
+    /*  Boundaries B0..2, Actions A1..4 */
+    /*  The state at boundary B1 is reached when current is 5, the changes since B1 are A4 and B2 */
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( revision == data_database_reader_get_revision( (*this_).db_reader ) )
+    {
+        /* revisions are never re-used for different states, so nothing has changed */
+        ctrl_undo_redo_iterator_reinit( out_changes_iterator,
+                                        &((*this_).buffer),
+                                        CTRL_UNDO_REDO_LIST_MAX_SIZE,
+                                        true, /* iterate_upwards */
+                                        (*this_).start,
+                                        0
+                                      );
+    }
+    else
+    {
+        /* search the boundary, relative to start */
+        bool found = false;
+        uint32_t boundary_pos = 0;
+        for ( uint32_t pos = 0; ( pos < (*this_).length ) && ( ! found ); pos ++ )
+        {
+            const uint32_t index = ( (*this_).start + pos ) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
+            const ctrl_undo_redo_record_t *const probe = &((*this_).buffer[index]);
+            if (( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == ctrl_undo_redo_record_get_action_type( probe ) )
+                && ( revision == ctrl_undo_redo_record_get_boundary_revision( probe ) ))
+            {
+                found = true;
+                boundary_pos = pos;
+            }
+        }
+
+        if ( found )
+        {
+            const uint32_t boundary_state = boundary_pos + 1;  /* value of current when at the boundary */
+            const uint32_t first = ( boundary_state < (*this_).current ) ? boundary_state : (*this_).current;
+            const uint32_t changes_length
+                = ( boundary_state < (*this_).current )
+                ? ( (*this_).current - boundary_state )
+                : ( boundary_state - (*this_).current );
+            ctrl_undo_redo_iterator_reinit( out_changes_iterator,
+                                            &((*this_).buffer),
+                                            CTRL_UNDO_REDO_LIST_MAX_SIZE,
+                                            true, /* iterate_upwards */
+                                            ( (*this_).start + first ) % CTRL_UNDO_REDO_LIST_MAX_SIZE,
+                                            changes_length
+                                          );
+        }
+        else
+        {
+            result = U8_ERROR_NOT_FOUND;
+        }
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
 /* ================================ private ================================ */
 
-ctrl_undo_redo_entry_t *ctrl_undo_redo_list_private_add_entry_ptr ( ctrl_undo_redo_list_t *this_ )
+void ctrl_undo_redo_list_private_add_entry ( ctrl_undo_redo_list_t *this_, const ctrl_undo_redo_entry_t *entry )
 {
     U8_TRACE_BEGIN();
+    assert( NULL != entry );
     assert( (*this_).start < CTRL_UNDO_REDO_LIST_MAX_SIZE );
     assert( (*this_).length <= CTRL_UNDO_REDO_LIST_MAX_SIZE );
     assert( (*this_).current <= (*this_).length );
 
-    uint32_t index;
-    ctrl_undo_redo_entry_t *result;
+    /* drop all entries newer than the current position */
+    while ( (*this_).current < (*this_).length )
+    {
+        ctrl_undo_redo_list_private_drop_newest( this_ );
+    }
 
-    if ( (*this_).current < (*this_).length )
+    /* overwrite the oldest entry if the list is full */
+    if ( (*this_).length == CTRL_UNDO_REDO_LIST_MAX_SIZE )
     {
-        /* overwrite an existing and new entry */
-        /* (*this_).start stays untouched */
-        (*this_).current ++;
+        ctrl_undo_redo_list_private_drop_oldest( this_ );
+    }
 
-        /* call destructor of all later entries */
-        for ( uint32_t pos = (*this_).current; pos < (*this_).length; pos ++ )
+    /* the new record is located after the newest one, dropping the oldest ones does not move this position */
+    const uint32_t index = ((*this_).start + (*this_).length) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
+    ctrl_undo_redo_record_t *const new_record = &((*this_).buffer[index]);
+    const uint32_t payload_size = ctrl_undo_redo_record_init( new_record, entry );
+    assert( payload_size <= CTRL_UNDO_REDO_LIST_MAX_PAYLOAD );
+
+    /* overwrite the oldest entries till the payload fits */
+    char *payload_buf = NULL;
+    if ( payload_size > 0 )
+    {
+        payload_buf = ctrl_undo_redo_list_private_alloc_payload( this_, payload_size );
+        while ( ( NULL == payload_buf ) && ( (*this_).length > 0 ) )
         {
-            uint32_t del_index = ((*this_).start + pos) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-            ctrl_undo_redo_entry_destroy( &((*this_).buffer[del_index]) );
+            ctrl_undo_redo_list_private_drop_oldest( this_ );
+            payload_buf = ctrl_undo_redo_list_private_alloc_payload( this_, payload_size );
         }
+    }
+    assert( ( NULL != payload_buf ) || ( payload_size == 0 ) );
+    ctrl_undo_redo_record_write_payload( new_record, entry, payload_buf );
 
-        /* shrink the list */
-        (*this_).length = (*this_).current;
+    /* add the new entry */
+    (*this_).length ++;
+    (*this_).current = (*this_).length;
 
-        index = ((*this_).start + (*this_).current + (CTRL_UNDO_REDO_LIST_MAX_SIZE-1)) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-        result = &((*this_).buffer[index]);
+    U8_TRACE_INFO_INT_INT( "current, length:", (*this_).current, (*this_).length );
+
+    U8_TRACE_END();
+}
+
+char *ctrl_undo_redo_list_private_alloc_payload ( ctrl_undo_redo_list_t *this_, uint32_t size )
+{
+    assert( size > 0 );
+    assert( (*this_).payload_tail <= CTRL_UNDO_REDO_LIST_MAX_PAYLOAD );
+    char *result = NULL;
+
+    if ( (*this_).payload_count == 0 )
+    {
+        /* the arena is empty */
+        if ( size <= CTRL_UNDO_REDO_LIST_MAX_PAYLOAD )
+        {
+            (*this_).payload_head = 0;
+            (*this_).payload_tail = 0;
+            result = &((*this_).payload_arena[0]);
+        }
     }
-    else if ( (*this_).current < CTRL_UNDO_REDO_LIST_MAX_SIZE )
+    else if ( (*this_).payload_wrapped )
     {
-        /* add a new entry */
-        /* (*this_).start stays untouched */
-        (*this_).current ++;
-        (*this_).length ++;
-
-        /* call the constructor */
-        index = ((*this_).start + (*this_).current + (CTRL_UNDO_REDO_LIST_MAX_SIZE-1)) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-        result = &((*this_).buffer[index]);
-        ctrl_undo_redo_entry_init_empty( result );
+        /* used: 0..tail and head..wrap_end; free: tail..head */
+        if ( size <= ( (*this_).payload_head - (*this_).payload_tail ) )
+        {
+            result = &((*this_).payload_arena[(*this_).payload_tail]);
+        }
     }
-    else
+    else if ( size <= ( CTRL_UNDO_REDO_LIST_MAX_PAYLOAD - (*this_).payload_tail ) )
+    {
+        /* used: head..tail; free: tail..end */
+        result = &((*this_).payload_arena[(*this_).payload_tail]);
+    }
+    else if ( size <= (*this_).payload_head )
     {
-        /* overwrite an existing old entry */
-        (*this_).start = ((*this_).start+1) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-        /* (*this_).current is already CTRL_UNDO_REDO_LIST_MAX_SIZE */
-        /* (*this_).length is already CTRL_UNDO_REDO_LIST_MAX_SIZE */
-        (*this_).buffer_incomplete = true;
+        /* used: head..tail; free: 0..head, the bytes after tail stay unused */
+        (*this_).payload_wrapped = true;
+        (*this_).payload_wrap_end = (*this_).payload_tail;
+        (*this_).payload_tail = 0;
+        result = &((*this_).payload_arena[0]);
+    }
 
-        index = ((*this_).start + (*this_).current + (CTRL_UNDO_REDO_LIST_MAX_SIZE-1)) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
-        result = &((*this_).buffer[index]);
+    if ( NULL != result )
+    {
+        (*this_).payload_tail += size;
+        (*this_).payload_count ++;
     }
+    return result;
+}
 
-    U8_TRACE_INFO_INT_INT( "current, length:", (*this_).current, (*this_).length );
+void ctrl_undo_redo_list_private_drop_oldest ( ctrl_undo_redo_list_t *this_ )
+{
+    assert( (*this_).length > 0 );
+    assert( (*this_).current > 0 );
 
-    U8_TRACE_END();
-    return result;
+    ctrl_undo_redo_record_t *const oldest = &((*this_).buffer[(*this_).start]);
+    const char *const payload = ctrl_undo_redo_record_get_payload( oldest );
+    if ( NULL != payload )
+    {
+        assert( (*this_).payload_count > 0 );
+        assert( payload == &((*this_).payload_arena[(*this_).payload_head]) );
+        (*this_).payload_count --;
+        (*this_).payload_head += ctrl_undo_redo_record_get_payload_size( oldest );
+        if ( (*this_).payload_count == 0 )
+        {
+            ctrl_undo_redo_list_private_reset_payload( this_ );
+        }
+        else if ( (*this_).payload_wrapped && ( (*this_).payload_head == (*this_).payload_wrap_end ) )
+        {
+            /* the remaining payloads start at the beginning of the arena */
+            (*this_).payload_head = 0;
+            (*this_).payload_wrapped = false;
+        }
+    }
+
+    ctrl_undo_redo_record_destroy( oldest );
+    (*this_).start = ((*this_).start+1) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
+    (*this_).length --;
+    (*this_).current --;
+    (*this_).buffer_incomplete = true;
+}
+
+void ctrl_undo_redo_list_private_drop_newest ( ctrl_undo_redo_list_t *this_ )
+{
+    assert( (*this_).length > 0 );
+
+    const uint32_t index = ((*this_).start + (*this_).length - 1) % CTRL_UNDO_REDO_LIST_MAX_SIZE;
+    ctrl_undo_redo_record_t *const newest = &((*this_).buffer[index]);
+    const char *const payload = ctrl_undo_redo_record_get_payload( newest );
+    if ( NULL != payload )
+    {
+        assert( (*this_).payload_count > 0 );
+        assert( payload + ctrl_undo_redo_record_get_payload_size( newest ) == &((*this_).payload_arena[(*this_).payload_tail]) );
+        (*this_).payload_count --;
+        (*this_).payload_tail = payload - &((*this_).payload_arena[0]);
+        if ( (*this_).payload_count == 0 )
+        {
+            ctrl_undo_redo_list_private_reset_payload( this_ );
+        }
+        else if ( (*this_).payload_wrapped && ( (*this_).payload_tail == 0 ) )
+        {
+            /* the remaining payloads end before the wrap-around */
+            (*this_).payload_tail = (*this_).payload_wrap_end;
+            (*this_).payload_wrapped = false;
+        }
+    }
+
+    ctrl_undo_redo_record_destroy( newest );
+    (*this_).length --;
+    if ( (*this_).current > (*this_).length )
+    {
+        (*this_).current = (*this_).length;
+    }
 }
 
 u8_error_t ctrl_undo_redo_list_private_do_action ( ctrl_undo_redo_list_t *this_, ctrl_undo_redo_entry_t *action, bool undo )
@@ -0,0 +1,565 @@
+/* File: ctrl_undo_redo_record.c; Copyright and License: see below */
+
+#include "ctrl_undo_redo_record.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+/*!
+ *  \brief kinds of fields in an entity
+ */
+enum ctrl_undo_redo_record_private_field_kind_enum {
+    CTRL_UNDO_REDO_RECORD_PRIVATE_FIELD_NUMBER,  /*!< a plain value, encoded by its size in bytes */
+    CTRL_UNDO_REDO_RECORD_PRIVATE_FIELD_TEXT,  /*!< a private character buffer of a utf8stringbuf_t, encoded up to and including the terminating zero */
+};
+
+/*!
+ *  \brief describes the location of a field within an entity struct
+ */
+struct ctrl_undo_redo_record_private_field_struct {
+    enum ctrl_undo_redo_record_private_field_kind_enum kind;
+    size_t offset;  /*!< offset of the field in the entity struct */
+    size_t size;  /*!< size of the value or size of the character buffer */
+};
+
+typedef struct ctrl_undo_redo_record_private_field_struct ctrl_undo_redo_record_private_field_t;
+
+#define CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER(ENTITY,MEMBER) \
+    { CTRL_UNDO_REDO_RECORD_PRIVATE_FIELD_NUMBER, offsetof(ENTITY,MEMBER), sizeof(((ENTITY*)NULL)->MEMBER) }
+#define CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT(ENTITY,MEMBER) \
+    { CTRL_UNDO_REDO_RECORD_PRIVATE_FIELD_TEXT, offsetof(ENTITY,MEMBER), sizeof(((ENTITY*)NULL)->MEMBER) }
+
+static const ctrl_undo_redo_record_private_field_t ctrl_undo_redo_record_private_diagram_fields[]
+= {
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagram_t, id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagram_t, parent_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagram_t, diagram_type ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_diagram_t, private_stereotype_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_diagram_t, private_name_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_diagram_t, private_description_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagram_t, list_order ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagram_t, display_flags ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_diagram_t, uuid.private_uuid_string_buffer ),
+};
+
+static const ctrl_undo_redo_record_private_field_t ctrl_undo_redo_record_private_diagramelement_fields[]
+= {
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagramelement_t, id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagramelement_t, diagram_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagramelement_t, classifier_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagramelement_t, focused_feature_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_diagramelement_t, display_flags ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_diagramelement_t, uuid.private_uuid_string_buffer ),
+};
+
+static const ctrl_undo_redo_record_private_field_t ctrl_undo_redo_record_private_classifier_fields[]
+= {
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_classifier_t, id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_classifier_t, main_type ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_classifier_t, private_stereotype_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_classifier_t, private_name_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_classifier_t, private_description_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_classifier_t, x_order ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_classifier_t, y_order ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_classifier_t, list_order ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_classifier_t, uuid.private_uuid_string_buffer ),
+};
+
+static const ctrl_undo_redo_record_private_field_t ctrl_undo_redo_record_private_feature_fields[]
+= {
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_feature_t, id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_feature_t, classifier_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_feature_t, main_type ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_feature_t, private_key_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_feature_t, private_value_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_feature_t, private_description_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_feature_t, list_order ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_feature_t, uuid.private_uuid_string_buffer ),
+};
+
+static const ctrl_undo_redo_record_private_field_t ctrl_undo_redo_record_private_relationship_fields[]
+= {
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_relationship_t, id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_relationship_t, from_classifier_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_relationship_t, from_feature_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_relationship_t, to_classifier_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_relationship_t, to_feature_id ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_relationship_t, main_type ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_relationship_t, private_stereotype_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_relationship_t, private_name_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_relationship_t, private_description_buffer ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER( data_relationship_t, list_order ),
+    CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT( data_relationship_t, uuid.private_uuid_string_buffer ),
+};
+
+#undef CTRL_UNDO_REDO_RECORD_PRIVATE_NUMBER
+#undef CTRL_UNDO_REDO_RECORD_PRIVATE_TEXT
+
+#define CTRL_UNDO_REDO_RECORD_PRIVATE_COUNT(FIELDS) ( sizeof(FIELDS) / sizeof(ctrl_undo_redo_record_private_field_t) )
+
+/*!
+ *  \brief the kinds of actions, each entity type has all three
+ */
+enum ctrl_undo_redo_record_private_action_enum {
+    CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_NONE,  /*!< boundary, no entity stored */
+    CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_DELETE,  /*!< the entity before the action is stored */
+    CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_UPDATE,  /*!< the entity before and the changed fields after the action are stored */
+    CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_CREATE,  /*!< the entity after the action is stored */
+};
+
+/*!
+ *  \brief determines the action kind and the field table of an action type
+ *
+ *  \param action_type the action type of an entry or record
+ *  \param[out] out_fields the field table of the affected entity type, NULL for boundaries
+ *  \param[out] out_count number of fields in out_fields
+ *  \return the kind of action
+ */
+static enum ctrl_undo_redo_record_private_action_enum ctrl_undo_redo_record_private_get_fields ( ctrl_undo_redo_entry_type_t action_type,
+                                                                                                 const ctrl_undo_redo_record_private_field_t **out_fields,
+                                                                                                 uint32_t *out_count )
+{
+    assert( NULL != out_fields );
+    assert( NULL != out_count );
+    enum ctrl_undo_redo_record_private_action_enum result = CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_NONE;
+    *out_fields = NULL;
+    *out_count = 0;
+
+    switch ( action_type )
+    {
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_DIAGRAM:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_DIAGRAM:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAM:
+        {
+            *out_fields = ctrl_undo_redo_record_private_diagram_fields;
+            *out_count = CTRL_UNDO_REDO_RECORD_PRIVATE_COUNT( ctrl_undo_redo_record_private_diagram_fields );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_DIAGRAMELEMENT:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_DIAGRAMELEMENT:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAMELEMENT:
+        {
+            *out_fields = ctrl_undo_redo_record_private_diagramelement_fields;
+            *out_count = CTRL_UNDO_REDO_RECORD_PRIVATE_COUNT( ctrl_undo_redo_record_private_diagramelement_fields );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_CLASSIFIER:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_CLASSIFIER:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_CLASSIFIER:
+        {
+            *out_fields = ctrl_undo_redo_record_private_classifier_fields;
+            *out_count = CTRL_UNDO_REDO_RECORD_PRIVATE_COUNT( ctrl_undo_redo_record_private_classifier_fields );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_FEATURE:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_FEATURE:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_FEATURE:
+        {
+            *out_fields = ctrl_undo_redo_record_private_feature_fields;
+            *out_count = CTRL_UNDO_REDO_RECORD_PRIVATE_COUNT( ctrl_undo_redo_record_private_feature_fields );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_RELATIONSHIP:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_RELATIONSHIP:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_RELATIONSHIP:
+        {
+            *out_fields = ctrl_undo_redo_record_private_relationship_fields;
+            *out_count = CTRL_UNDO_REDO_RECORD_PRIVATE_COUNT( ctrl_undo_redo_record_private_relationship_fields );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY:
+        default:
+        {
+            /* no fields */
+        }
+        break;
+    }
+
+    switch ( action_type )
+    {
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_DIAGRAM:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_DIAGRAMELEMENT:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_CLASSIFIER:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_FEATURE:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_RELATIONSHIP:
+        {
+            result = CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_DELETE;
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_DIAGRAM:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_DIAGRAMELEMENT:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_CLASSIFIER:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_FEATURE:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_RELATIONSHIP:
+        {
+            result = CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_UPDATE;
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAM:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAMELEMENT:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_CLASSIFIER:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_FEATURE:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_RELATIONSHIP:
+        {
+            result = CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_CREATE;
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY:
+        default:
+        {
+            result = CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_NONE;
+        }
+        break;
+    }
+
+    return result;
+}
+
+/*!
+ *  \brief determines the number of bytes needed to encode a field
+ *
+ *  \param field the field description
+ *  \param entity address of the entity struct
+ *  \return number of bytes
+ */
+static inline uint32_t ctrl_undo_redo_record_private_field_size ( const ctrl_undo_redo_record_private_field_t *field,
+                                                                  const char *entity )
+{
+    uint32_t result;
+    if ( CTRL_UNDO_REDO_RECORD_PRIVATE_FIELD_TEXT == (*field).kind )
+    {
+        const char *const text = entity + (*field).offset;
+        const char *const text_end = memchr( text, '\0', (*field).size );
+        assert( NULL != text_end );  /* utf8stringbuf_t always terminates its buffer */
+        result = ( NULL == text_end ) ? (*field).size : (uint32_t)( text_end - text ) + 1;
+    }
+    else
+    {
+        result = (*field).size;
+    }
+    return result;
+}
+
+/*!
+ *  \brief checks if a field differs between two entities of the same type
+ *
+ *  \param field the field description
+ *  \param entity_1 address of the first entity struct
+ *  \param entity_2 address of the second entity struct
+ *  \return true if the encoded field values differ
+ */
+static inline bool ctrl_undo_redo_record_private_field_differs ( const ctrl_undo_redo_record_private_field_t *field,
+                                                                 const char *entity_1,
+                                                                 const char *entity_2 )
+{
+    const uint32_t size_1 = ctrl_undo_redo_record_private_field_size( field, entity_1 );
+    const uint32_t size_2 = ctrl_undo_redo_record_private_field_size( field, entity_2 );
+    return ( size_1 != size_2 )
+        || ( 0 != memcmp( entity_1 + (*field).offset, entity_2 + (*field).offset, size_1 ) );
+}
+
+/*!
+ *  \brief decodes one field, the field is left unchanged if the payload is too short
+ *
+ *  \param field the field description
+ *  \param[in,out] io_entity address of the entity struct
+ *  \param payload address of the encoded field
+ *  \param available number of payload bytes that are left
+ *  \return number of bytes consumed
+ */
+static inline uint32_t ctrl_undo_redo_record_private_read_field ( const ctrl_undo_redo_record_private_field_t *field,
+                                                                  char *io_entity,
+                                                                  const char *payload,
+                                                                  uint32_t available )
+{
+    uint32_t result = 0;
+    char *const dest = io_entity + (*field).offset;
+    if ( CTRL_UNDO_REDO_RECORD_PRIVATE_FIELD_TEXT == (*field).kind )
+    {
+        const uint32_t max_len = ( available < (*field).size ) ? available : (*field).size;
+        const char *const text_end = ( NULL == payload ) ? NULL : memchr( payload, '\0', max_len );
+        if ( NULL != text_end )
+        {
+            result = (uint32_t)( text_end - payload ) + 1;
+            memcpy( dest, payload, result );
+        }
+    }
+    else if ( (*field).size <= available )
+    {
+        result = (*field).size;
+        memcpy( dest, payload, result );
+    }
+    return result;
+}
+
+/*!
+ *  \brief gets the address of a payload position, NULL if there is no payload
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param pos position in the payload
+ *  \return address of the payload at pos
+ */
+static inline const char *ctrl_undo_redo_record_private_payload_at ( const ctrl_undo_redo_record_t *this_, uint32_t pos )
+{
+    return ( NULL == (*this_).payload ) ? NULL : &((*this_).payload[pos]);
+}
+
+/*!
+ *  \brief initializes the entities before and after the action to empty objects of the right type
+ *
+ *  \param action_type the type of action
+ *  \param[out] out_entry the entry of which the entities are initialized
+ */
+static void ctrl_undo_redo_record_private_init_entities ( ctrl_undo_redo_entry_type_t action_type, ctrl_undo_redo_entry_t *out_entry )
+{
+    switch ( action_type )
+    {
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_DIAGRAM:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_DIAGRAM:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAM:
+        {
+            data_diagram_init_empty( &((*out_entry).data_before_action.diagram) );
+            data_diagram_init_empty( &((*out_entry).data_after_action.diagram) );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_DIAGRAMELEMENT:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_DIAGRAMELEMENT:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAMELEMENT:
+        {
+            data_diagramelement_init_empty( &((*out_entry).data_before_action.diagramelement) );
+            data_diagramelement_init_empty( &((*out_entry).data_after_action.diagramelement) );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_CLASSIFIER:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_CLASSIFIER:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_CLASSIFIER:
+        {
+            data_classifier_init_empty( &((*out_entry).data_before_action.classifier) );
+            data_classifier_init_empty( &((*out_entry).data_after_action.classifier) );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_FEATURE:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_FEATURE:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_FEATURE:
+        {
+            data_feature_init_empty( &((*out_entry).data_before_action.feature) );
+            data_feature_init_empty( &((*out_entry).data_after_action.feature) );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_RELATIONSHIP:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_RELATIONSHIP:
+        case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_RELATIONSHIP:
+        {
+            data_relationship_init_empty( &((*out_entry).data_before_action.relationship) );
+            data_relationship_init_empty( &((*out_entry).data_after_action.relationship) );
+        }
+        break;
+
+        case CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY:
+        default:
+        {
+            ctrl_undo_redo_entry_init_empty( out_entry );
+        }
+        break;
+    }
+}
+
+uint32_t ctrl_undo_redo_record_init ( ctrl_undo_redo_record_t *this_, const ctrl_undo_redo_entry_t *entry )
+{
+    assert( NULL != entry );
+    const ctrl_undo_redo_entry_type_t action_type = ctrl_undo_redo_entry_get_action_type( entry );
+    (*this_).action_type = action_type;
+    (*this_).changed_fields = 0;
+    (*this_).boundary_revision
+        = ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == action_type )
+        ? ctrl_undo_redo_entry_get_boundary_revision( entry )
+        : DATA_REVISION_VOID;
+    (*this_).payload = NULL;
+    (*this_).payload_size = 0;
+
+    const ctrl_undo_redo_record_private_field_t *fields;
+    uint32_t count;
+    const enum ctrl_undo_redo_record_private_action_enum action
+        = ctrl_undo_redo_record_private_get_fields( action_type, &fields, &count );
+    const char *const before = (const char*) &((*entry).data_before_action);
+    const char *const after = (const char*) &((*entry).data_after_action);
+
+    uint32_t size = 0;
+    for ( uint32_t index = 0; index < count; index ++ )
+    {
+        const ctrl_undo_redo_record_private_field_t *const field = &(fields[index]);
+        switch ( action )
+        {
+            case CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_DELETE:
+            {
+                size += ctrl_undo_redo_record_private_field_size( field, before );
+            }
+            break;
+
+            case CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_UPDATE:
+            {
+                size += ctrl_undo_redo_record_private_field_size( field, before );
+                if ( ctrl_undo_redo_record_private_field_differs( field, before, after ) )
+                {
+                    (*this_).changed_fields |= ( 1u << index );
+                    size += ctrl_undo_redo_record_private_field_size( field, after );
+                }
+            }
+            break;
+
+            case CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_CREATE:
+            {
+                size += ctrl_undo_redo_record_private_field_size( field, after );
+            }
+            break;
+
+            case CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_NONE:
+            default:
+            {
+                assert( false );
+            }
+            break;
+        }
+    }
+    (*this_).payload_size = size;
+
+    return size;
+}
+
+void ctrl_undo_redo_record_write_payload ( ctrl_undo_redo_record_t *this_,
+                                           const ctrl_undo_redo_entry_t *entry,
+                                           char *payload_buf )
+{
+    assert( NULL != entry );
+    assert( (*this_).action_type == ctrl_undo_redo_entry_get_action_type( entry ) );
+    assert( ( NULL != payload_buf ) || ( 0 == (*this_).payload_size ) );
+
+    const ctrl_undo_redo_record_private_field_t *fields;
+    uint32_t count;
+    const enum ctrl_undo_redo_record_private_action_enum action
+        = ctrl_undo_redo_record_private_get_fields( (*this_).action_type, &fields, &count );
+    const char *const before = (const char*) &((*entry).data_before_action);
+    const char *const after = (const char*) &((*entry).data_after_action);
+
+    /* the entity that is stored completely */
+    const char *const complete = ( CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_CREATE == action ) ? after : before;
+    uint32_t pos = 0;
+    for ( uint32_t index = 0; index < count; index ++ )
+    {
+        const ctrl_undo_redo_record_private_field_t *const field = &(fields[index]);
+        const uint32_t field_size = ctrl_undo_redo_record_private_field_size( field, complete );
+        memcpy( &(payload_buf[pos]), complete + (*field).offset, field_size );
+        pos += field_size;
+    }
+
+    /* the changed fields after an update */
+    if ( CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_UPDATE == action )
+    {
+        for ( uint32_t index = 0; index < count; index ++ )
+        {
+            if ( 0 != ( (*this_).changed_fields & ( 1u << index ) ) )
+            {
+                const ctrl_undo_redo_record_private_field_t *const field = &(fields[index]);
+                const uint32_t field_size = ctrl_undo_redo_record_private_field_size( field, after );
+                memcpy( &(payload_buf[pos]), after + (*field).offset, field_size );
+                pos += field_size;
+            }
+        }
+    }
+    assert( pos == (*this_).payload_size );
+
+    (*this_).payload = ( 0 == pos ) ? NULL : payload_buf;
+}
+
+void ctrl_undo_redo_record_expand ( const ctrl_undo_redo_record_t *this_, ctrl_undo_redo_entry_t *out_entry )
+{
+    assert( NULL != out_entry );
+
+    const ctrl_undo_redo_entry_type_t action_type = (*this_).action_type;
+    if ( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY == action_type )
+    {
+        ctrl_undo_redo_entry_init_boundary( out_entry, (*this_).boundary_revision );
+    }
+    else
+    {
+        ctrl_undo_redo_record_private_init_entities( action_type, out_entry );
+        (*out_entry).action_type = action_type;
+
+        const ctrl_undo_redo_record_private_field_t *fields;
+        uint32_t count;
+        const enum ctrl_undo_redo_record_private_action_enum action
+            = ctrl_undo_redo_record_private_get_fields( action_type, &fields, &count );
+        char *const before = (char*) &((*out_entry).data_before_action);
+        char *const after = (char*) &((*out_entry).data_after_action);
+
+        /* the entity that is stored completely */
+        char *const complete = ( CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_CREATE == action ) ? after : before;
+        uint32_t pos = 0;
+        for ( uint32_t index = 0; index < count; index ++ )
+        {
+            pos += ctrl_undo_redo_record_private_read_field( &(fields[index]),
+                                                             complete,
+                                                             ctrl_undo_redo_record_private_payload_at( this_, pos ),
+                                                             (*this_).payload_size - pos
+                                                           );
+        }
+
+        /* the entity after an update is the entity before plus the changed fields */
+        if ( CTRL_UNDO_REDO_RECORD_PRIVATE_ACTION_UPDATE == action )
+        {
+            for ( uint32_t index = 0; index < count; index ++ )
+            {
+                const ctrl_undo_redo_record_private_field_t *const field = &(fields[index]);
+                if ( 0 != ( (*this_).changed_fields & ( 1u << index ) ) )
+                {
+                    pos += ctrl_undo_redo_record_private_read_field( field,
+                                                                     after,
+                                                                     ctrl_undo_redo_record_private_payload_at( this_, pos ),
+                                                                     (*this_).payload_size - pos
+                                                                   );
+                }
+                else
+                {
+                    const uint32_t field_size = ctrl_undo_redo_record_private_field_size( field, before );
+                    memcpy( after + (*field).offset, before + (*field).offset, field_size );
+                }
+            }
+        }
+
+        if ( pos != (*this_).payload_size )
+        {
+            U8_LOG_ERROR_INT( "ctrl_undo_redo_record_t payload could not be decoded completely:", (*this_).payload_size - pos );
+        }
+    }
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -12,11 +12,13 @@
 #include "test_expect.h"
 #include "test_environment_assert.h"
 #include "test_case_result.h"
+#include <string.h>
 
 static test_fixture_t * set_up();
 static void tear_down( test_fixture_t *fix );
 static test_case_result_t undo_redo_classifier( test_fixture_t *fix );
 static test_case_result_t undo_redo_list_limits( test_fixture_t *fix );
+static test_case_result_t undo_redo_payload_limits( test_fixture_t *fix );
 static test_case_result_t undo_redo_feature_and_relationship( test_fixture_t *fix );
 static test_case_result_t undo_redo_update_diagram( test_fixture_t *fix );
 
@@ -31,6 +33,7 @@ test_suite_t ctrl_undo_redo_list_test_get_suite(void)
                    );
     test_suite_add_test_case( &result, "undo_redo_classifier", &undo_redo_classifier );
     test_suite_add_test_case( &result, "undo_redo_list_limits", &undo_redo_list_limits );
+    test_suite_add_test_case( &result, "undo_redo_payload_limits", &undo_redo_payload_limits );
     test_suite_add_test_case( &result, "undo_redo_feature_and_relationship", &undo_redo_feature_and_relationship );
     test_suite_add_test_case( &result, "undo_redo_update_diagram", &undo_redo_update_diagram );
     return result;
@@ -454,6 +457,146 @@ static test_case_result_t undo_redo_list_limits( test_fixture_t *fix )
     return TEST_CASE_RESULT_OK;
 }
 
+static test_case_result_t undo_redo_payload_limits( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t ctrl_err;
+    data_row_t root_diagram_id;
+    ctrl_diagram_controller_t *diag_ctrl;
+    diag_ctrl = ctrl_controller_get_diagram_control_ptr( &((*fix).controller) );
+
+    /* create the root diagram */
+    root_diagram_id = DATA_ROW_VOID;
+    ctrl_err = ctrl_diagram_controller_create_root_diagram_if_not_exists( diag_ctrl,
+                                                                          DATA_DIAGRAM_TYPE_UML_ACTIVITY_DIAGRAM,
+                                                                          "my_root_diag",
+                                                                          &root_diagram_id
+                                                                        );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, ctrl_err, u8_error_get_name );
+
+    /* update the description many times, each update stores the old and the new description */
+    static const int32_t UPDATES = 100;
+    static char description[DATA_DIAGRAM_MAX_DESCRIPTION_SIZE-1];
+    for ( int32_t pos = 0; pos < UPDATES; pos ++ )
+    {
+        memset( &description, 'a' + ( pos % 26 ), sizeof(description) );
+        description[sizeof(description)-1] = '\0';
+        ctrl_err = ctrl_diagram_controller_update_diagram_description( diag_ctrl, root_diagram_id, &(description[0]) );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, ctrl_err, u8_error_get_name );
+    }
+    /* the payload limit is reached before the limit of the number of list entries */
+    TEST_EXPECT( UPDATES * 2 < CTRL_UNDO_REDO_LIST_MAX_SIZE );
+    TEST_EXPECT( UPDATES * 2 * sizeof(description) > CTRL_UNDO_REDO_LIST_MAX_PAYLOAD );
+
+    /* undo everything that is possible */
+    int32_t undo_count = 0;
+    for ( bool finished = false; ! finished; )
+    {
+        data_stat_t stat;
+        data_stat_init(&stat);
+        ctrl_err = ctrl_controller_undo ( &((*fix).controller), &stat );
+        if ( U8_ERROR_NONE == ctrl_err )
+        {
+            TEST_EXPECT_EQUAL_INT( 1, data_stat_get_count ( &stat, DATA_STAT_TABLE_DIAGRAM, DATA_STAT_SERIES_MODIFIED ));
+            undo_count ++;
+        }
+        else
+        {
+            TEST_EXPECT_EQUAL_ENUM( U8_ERROR_ARRAY_BUFFER_EXCEEDED, ctrl_err, u8_error_get_name );
+            TEST_EXPECT_EQUAL_INT( 0, data_stat_get_total_count ( &stat ));
+            finished = true;
+        }
+        data_stat_destroy(&stat);
+    }
+    TEST_EXPECT( undo_count > UPDATES / 2 );
+    TEST_EXPECT( undo_count < UPDATES );
+
+    /* check that the restored description is the one before the oldest undone update */
+    {
+        data_diagram_t read_diagram;
+        const u8_error_t data_err = data_database_reader_get_diagram_by_id ( &((*fix).db_reader), root_diagram_id, &read_diagram );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        const int32_t restored = UPDATES - undo_count - 1;
+        memset( &description, 'a' + ( restored % 26 ), sizeof(description) );
+        description[sizeof(description)-1] = '\0';
+        TEST_EXPECT_EQUAL_STRING( &(description[0]), data_diagram_get_description_const( &read_diagram ) );
+        data_diagram_destroy( &read_diagram );
+    }
+
+    /* redo all */
+    for ( int32_t pos = 0; pos < undo_count; pos ++ )
+    {
+        data_stat_t stat;
+        data_stat_init(&stat);
+        ctrl_err = ctrl_controller_redo ( &((*fix).controller), &stat );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, ctrl_err, u8_error_get_name );
+        data_stat_destroy(&stat);
+    }
+    {
+        data_diagram_t read_diagram;
+        const u8_error_t data_err = data_database_reader_get_diagram_by_id ( &((*fix).db_reader), root_diagram_id, &read_diagram );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        memset( &description, 'a' + ( ( UPDATES - 1 ) % 26 ), sizeof(description) );
+        description[sizeof(description)-1] = '\0';
+        TEST_EXPECT_EQUAL_STRING( &(description[0]), data_diagram_get_description_const( &read_diagram ) );
+        data_diagram_destroy( &read_diagram );
+    }
+
+    /* undo some updates and replace them by new ones, this frees payloads at the tail of the wrapped ring */
+    static const int32_t REPLACED = 3;
+    static const int32_t NEW_UPDATES = 30;
+    for ( int32_t pos = 0; pos < REPLACED; pos ++ )
+    {
+        data_stat_t stat;
+        data_stat_init(&stat);
+        ctrl_err = ctrl_controller_undo ( &((*fix).controller), &stat );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, ctrl_err, u8_error_get_name );
+        data_stat_destroy(&stat);
+    }
+    for ( int32_t pos = UPDATES; pos < UPDATES + NEW_UPDATES; pos ++ )
+    {
+        memset( &description, 'a' + ( pos % 26 ), sizeof(description) );
+        description[sizeof(description)-1] = '\0';
+        ctrl_err = ctrl_diagram_controller_update_diagram_description( diag_ctrl, root_diagram_id, &(description[0]) );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, ctrl_err, u8_error_get_name );
+    }
+
+    /* undo everything that is possible again, each step restores the preceding description */
+    int32_t second_undo_count = 0;
+    for ( bool finished = false; ! finished; )
+    {
+        data_stat_t stat;
+        data_stat_init(&stat);
+        ctrl_err = ctrl_controller_undo ( &((*fix).controller), &stat );
+        if ( U8_ERROR_NONE == ctrl_err )
+        {
+            second_undo_count ++;
+            /* the history is: 0 .. UPDATES-REPLACED-1, then UPDATES .. UPDATES+NEW_UPDATES-1 */
+            const int32_t restored
+                = ( second_undo_count < NEW_UPDATES )
+                ? ( UPDATES + NEW_UPDATES - 1 - second_undo_count )
+                : ( UPDATES - REPLACED - 1 - ( second_undo_count - NEW_UPDATES ) );
+            data_diagram_t read_diagram;
+            const u8_error_t data_err = data_database_reader_get_diagram_by_id ( &((*fix).db_reader), root_diagram_id, &read_diagram );
+            TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+            memset( &description, 'a' + ( restored % 26 ), sizeof(description) );
+            description[sizeof(description)-1] = '\0';
+            TEST_EXPECT_EQUAL_STRING( &(description[0]), data_diagram_get_description_const( &read_diagram ) );
+            data_diagram_destroy( &read_diagram );
+        }
+        else
+        {
+            TEST_EXPECT_EQUAL_ENUM( U8_ERROR_ARRAY_BUFFER_EXCEEDED, ctrl_err, u8_error_get_name );
+            finished = true;
+        }
+        data_stat_destroy(&stat);
+    }
+    TEST_EXPECT( second_undo_count > NEW_UPDATES );
+    TEST_EXPECT( second_undo_count < UPDATES );
+
+    return TEST_CASE_RESULT_OK;
+}
+
 static test_case_result_t undo_redo_feature_and_relationship( test_fixture_t *fix )
 {
     assert( fix != NULL );
@@ -5,7 +5,7 @@
 
 /*!
  *  \file
- *  \brief MODULE TEST for data_database_writer, data_database_sql_builder,
+ *  \brief MODULE TEST for data_database_writer, data_database_prepared_writer,
  *                         data_database, data_database_reader, ctrl_undo_redo_list
  */
 
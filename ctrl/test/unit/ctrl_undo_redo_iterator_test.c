@@ -33,7 +33,7 @@ test_suite_t ctrl_undo_redo_iterator_test_get_suite(void)
 
 #define CTRL_UNDO_REDO_ITERATOR_TEST_BUF_SIZE (3)
 struct test_fixture_struct {
-    const ctrl_undo_redo_entry_t ring_buf[CTRL_UNDO_REDO_ITERATOR_TEST_BUF_SIZE];
+    const ctrl_undo_redo_record_t ring_buf[CTRL_UNDO_REDO_ITERATOR_TEST_BUF_SIZE];
 };
 typedef struct test_fixture_struct test_fixture_t;
 static test_fixture_t test_fixture = { .ring_buf = {
@@ -68,13 +68,13 @@ static test_case_result_t test_iterate_forward( test_fixture_t *fix )
     TEST_EXPECT_EQUAL_INT( true, has_next );
 
     const ctrl_undo_redo_entry_t *next = ctrl_undo_redo_iterator_next( &iter );
-    TEST_EXPECT_EQUAL_PTR( &((*fix).ring_buf[1]), next );
+    TEST_EXPECT_EQUAL_INT( (*fix).ring_buf[1].action_type, ctrl_undo_redo_entry_get_action_type( next ) );
 
     has_next = ctrl_undo_redo_iterator_has_next( &iter );
     TEST_EXPECT_EQUAL_INT( true, has_next );
 
     next = ctrl_undo_redo_iterator_next( &iter );
-    TEST_EXPECT_EQUAL_PTR( &((*fix).ring_buf[2]), next );
+    TEST_EXPECT_EQUAL_INT( (*fix).ring_buf[2].action_type, ctrl_undo_redo_entry_get_action_type( next ) );
 
     has_next = ctrl_undo_redo_iterator_has_next( &iter );
     TEST_EXPECT_EQUAL_INT( true, has_next );
@@ -83,7 +83,7 @@ static test_case_result_t test_iterate_forward( test_fixture_t *fix )
     TEST_EXPECT_EQUAL_INT( true, has_next );
 
     next = ctrl_undo_redo_iterator_next( &iter );
-    TEST_EXPECT_EQUAL_PTR( &((*fix).ring_buf[0]), next );
+    TEST_EXPECT_EQUAL_INT( (*fix).ring_buf[0].action_type, ctrl_undo_redo_entry_get_action_type( next ) );
 
     has_next = ctrl_undo_redo_iterator_has_next( &iter );
     TEST_EXPECT_EQUAL_INT( false, has_next );
@@ -105,16 +105,16 @@ static test_case_result_t test_iterate_reverse( test_fixture_t *fix )
                                 );
 
     const ctrl_undo_redo_entry_t *next = ctrl_undo_redo_iterator_next( &iter );
-    TEST_EXPECT_EQUAL_PTR( &((*fix).ring_buf[1]), next );
+    TEST_EXPECT_EQUAL_INT( (*fix).ring_buf[1].action_type, ctrl_undo_redo_entry_get_action_type( next ) );
 
     bool has_next = ctrl_undo_redo_iterator_has_next( &iter );
     TEST_EXPECT_EQUAL_INT( true, has_next );
 
     next = ctrl_undo_redo_iterator_next( &iter );
-    TEST_EXPECT_EQUAL_PTR( &((*fix).ring_buf[0]), next );
+    TEST_EXPECT_EQUAL_INT( (*fix).ring_buf[0].action_type, ctrl_undo_redo_entry_get_action_type( next ) );
 
     next = ctrl_undo_redo_iterator_next( &iter );
-    TEST_EXPECT_EQUAL_PTR( &((*fix).ring_buf[2]), next );
+    TEST_EXPECT_EQUAL_INT( (*fix).ring_buf[2].action_type, ctrl_undo_redo_entry_get_action_type( next ) );
 
     has_next = ctrl_undo_redo_iterator_has_next( &iter );
     TEST_EXPECT_EQUAL_INT( false, has_next );
@@ -0,0 +1,205 @@
+/* File: ctrl_undo_redo_record_test.c; Copyright and License: see below */
+
+#include "ctrl_undo_redo_record_test.h"
+#include "ctrl_undo_redo_record.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <string.h>
+#include <assert.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t test_boundary( test_fixture_t *fix );
+static test_case_result_t test_create_diagram( test_fixture_t *fix );
+static test_case_result_t test_update_classifier( test_fixture_t *fix );
+static test_case_result_t test_truncated_payload( test_fixture_t *fix );
+
+test_suite_t ctrl_undo_redo_record_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "ctrl_undo_redo_record",
+                     TEST_CATEGORY_UNIT | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_boundary", &test_boundary );
+    test_suite_add_test_case( &result, "test_create_diagram", &test_create_diagram );
+    test_suite_add_test_case( &result, "test_update_classifier", &test_update_classifier );
+    test_suite_add_test_case( &result, "test_truncated_payload", &test_truncated_payload );
+    return result;
+}
+
+struct test_fixture_struct {
+    ctrl_undo_redo_entry_t entry;  /*!< entry to be encoded */
+    ctrl_undo_redo_entry_t expanded;  /*!< entry after decoding */
+    char payload[16384];  /*!< memory for the encoded payload */
+};
+typedef struct test_fixture_struct test_fixture_t;
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    ctrl_undo_redo_entry_init_empty( &((*fix).entry) );
+    ctrl_undo_redo_entry_init_empty( &((*fix).expanded) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    ctrl_undo_redo_entry_destroy( &((*fix).entry) );
+    ctrl_undo_redo_entry_destroy( &((*fix).expanded) );
+}
+
+static test_case_result_t test_boundary( test_fixture_t *fix )
+{
+    ctrl_undo_redo_entry_init_boundary( &((*fix).entry), 4711 );
+
+    ctrl_undo_redo_record_t record;
+    const uint32_t size = ctrl_undo_redo_record_init( &record, &((*fix).entry) );
+    TEST_EXPECT_EQUAL_INT( 0, size );
+    ctrl_undo_redo_record_write_payload( &record, &((*fix).entry), NULL );
+    TEST_EXPECT_EQUAL_PTR( NULL, ctrl_undo_redo_record_get_payload( &record ) );
+    TEST_EXPECT_EQUAL_INT( 4711, ctrl_undo_redo_record_get_boundary_revision( &record ) );
+
+    ctrl_undo_redo_record_expand( &record, &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_INT( CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY, ctrl_undo_redo_entry_get_action_type( &((*fix).expanded) ) );
+    TEST_EXPECT_EQUAL_INT( 4711, ctrl_undo_redo_entry_get_boundary_revision( &((*fix).expanded) ) );
+
+    ctrl_undo_redo_record_destroy( &record );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_create_diagram( test_fixture_t *fix )
+{
+    data_diagram_t diagram;
+    const u8_error_t d_err = data_diagram_init( &diagram,
+                                                17 /*=diagram_id*/,
+                                                3 /*=parent_diagram_id*/,
+                                                DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM,
+                                                "stereo",
+                                                "name",
+                                                "description",
+                                                -5 /*=list_order*/,
+                                                DATA_DIAGRAM_FLAG_NONE,
+                                                "a9f5ad5b-2fd6-4cfc-8e3a-3e1c3a7e2b04"
+                                              );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == d_err );
+    ctrl_undo_redo_entry_init_create_diagram( &((*fix).entry), &diagram );
+
+    ctrl_undo_redo_record_t record;
+    const uint32_t size = ctrl_undo_redo_record_init( &record, &((*fix).entry) );
+    /* the payload consists of the actual lengths of the texts, not of the buffer sizes */
+    TEST_EXPECT( size < 128 );
+    TEST_ENVIRONMENT_ASSERT( size <= sizeof((*fix).payload) );
+    ctrl_undo_redo_record_write_payload( &record, &((*fix).entry), &((*fix).payload[0]) );
+    TEST_EXPECT_EQUAL_INT( size, ctrl_undo_redo_record_get_payload_size( &record ) );
+
+    ctrl_undo_redo_record_expand( &record, &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_INT( CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAM, ctrl_undo_redo_entry_get_action_type( &((*fix).expanded) ) );
+    const data_diagram_t *const after = ctrl_undo_redo_entry_get_diagram_after_action_const( &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_INT( 17, data_diagram_get_row( after ) );
+    TEST_EXPECT_EQUAL_INT( 3, data_diagram_get_parent_row( after ) );
+    TEST_EXPECT_EQUAL_INT( DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM, data_diagram_get_diagram_type( after ) );
+    TEST_EXPECT_EQUAL_STRING( "stereo", data_diagram_get_stereotype_const( after ) );
+    TEST_EXPECT_EQUAL_STRING( "name", data_diagram_get_name_const( after ) );
+    TEST_EXPECT_EQUAL_STRING( "description", data_diagram_get_description_const( after ) );
+    TEST_EXPECT_EQUAL_INT( -5, data_diagram_get_list_order( after ) );
+    TEST_EXPECT_EQUAL_STRING( "a9f5ad5b-2fd6-4cfc-8e3a-3e1c3a7e2b04", data_diagram_get_uuid_const( after ) );
+    const data_diagram_t *const before = ctrl_undo_redo_entry_get_diagram_before_action_const( &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_INT( DATA_ROW_VOID, data_diagram_get_row( before ) );
+
+    ctrl_undo_redo_record_destroy( &record );
+    data_diagram_destroy( &diagram );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_update_classifier( test_fixture_t *fix )
+{
+    static char long_description[4000];
+    memset( &long_description, 'x', sizeof(long_description) );
+    long_description[sizeof(long_description)-1] = '\0';
+
+    data_classifier_t old_classifier;
+    const u8_error_t c_err = data_classifier_init( &old_classifier,
+                                                   23 /*=id*/,
+                                                   DATA_CLASSIFIER_TYPE_CLASS,
+                                                   "",
+                                                   "old_name",
+                                                   &(long_description[0]),
+                                                   100 /*=x_order*/,
+                                                   200 /*=y_order*/,
+                                                   300 /*=list_order*/,
+                                                   "1c7e0f3a-5b8d-4e6f-9a2b-c3d4e5f60718"
+                                                 );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == c_err );
+    data_classifier_t new_classifier;
+    data_classifier_copy( &new_classifier, &old_classifier );
+    data_classifier_set_x_order( &new_classifier, 101 );
+    const u8_error_t n_err = data_classifier_set_name( &new_classifier, "new_name" );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == n_err );
+    ctrl_undo_redo_entry_init_update_classifier( &((*fix).entry), &old_classifier, &new_classifier );
+
+    ctrl_undo_redo_record_t record;
+    const uint32_t size = ctrl_undo_redo_record_init( &record, &((*fix).entry) );
+    /* the long description is stored only once, the entity after the update stores name and x_order only */
+    TEST_EXPECT( size > sizeof(long_description) );
+    TEST_EXPECT( size < sizeof(long_description) + 128 );
+    TEST_EXPECT_EQUAL_INT( (1u<<3)|(1u<<5), ctrl_undo_redo_record_get_changed_fields( &record ) );
+    TEST_ENVIRONMENT_ASSERT( size <= sizeof((*fix).payload) );
+    ctrl_undo_redo_record_write_payload( &record, &((*fix).entry), &((*fix).payload[0]) );
+
+    ctrl_undo_redo_record_expand( &record, &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_INT( CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_CLASSIFIER, ctrl_undo_redo_entry_get_action_type( &((*fix).expanded) ) );
+    const data_classifier_t *const before = ctrl_undo_redo_entry_get_classifier_before_action_const( &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_STRING( "old_name", data_classifier_get_name_const( before ) );
+    TEST_EXPECT_EQUAL_INT( 100, data_classifier_get_x_order( before ) );
+    TEST_EXPECT_EQUAL_STRING( &(long_description[0]), data_classifier_get_description_const( before ) );
+    const data_classifier_t *const after = ctrl_undo_redo_entry_get_classifier_after_action_const( &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_INT( 23, data_classifier_get_row( after ) );
+    TEST_EXPECT_EQUAL_STRING( "new_name", data_classifier_get_name_const( after ) );
+    TEST_EXPECT_EQUAL_INT( 101, data_classifier_get_x_order( after ) );
+    TEST_EXPECT_EQUAL_INT( 200, data_classifier_get_y_order( after ) );
+    TEST_EXPECT_EQUAL_STRING( &(long_description[0]), data_classifier_get_description_const( after ) );
+    TEST_EXPECT_EQUAL_STRING( "1c7e0f3a-5b8d-4e6f-9a2b-c3d4e5f60718", data_classifier_get_uuid_const( after ) );
+
+    ctrl_undo_redo_record_destroy( &record );
+    data_classifier_destroy( &new_classifier );
+    data_classifier_destroy( &old_classifier );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_truncated_payload( test_fixture_t *fix )
+{
+    /* a record without payload expands to empty entities */
+    const ctrl_undo_redo_record_t record
+        = { .action_type = CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_FEATURE, .payload = NULL, .payload_size = 0 };
+    ctrl_undo_redo_record_expand( &record, &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_INT( CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_FEATURE, ctrl_undo_redo_entry_get_action_type( &((*fix).expanded) ) );
+    const data_feature_t *const before = ctrl_undo_redo_entry_get_feature_before_action_const( &((*fix).expanded) );
+    TEST_EXPECT_EQUAL_INT( DATA_ROW_VOID, data_feature_get_row( before ) );
+    TEST_EXPECT_EQUAL_STRING( "", data_feature_get_key_const( before ) );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
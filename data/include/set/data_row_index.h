@@ -0,0 +1,144 @@
+/* File: data_row_index.h; Copyright and License: see below */
+
+#ifndef DATA_ROW_INDEX_H
+#define DATA_ROW_INDEX_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Maps the rows of database records to their positions in an array.
+ *
+ *  This is a hash table with open addressing.
+ *  Its slots are fetched from a universal_memory_arena_t.
+ *  If a row is added multiple times, the first added position is kept.
+ */
+
+#include "entity/data_row.h"
+#include "u8arena/universal_memory_arena.h"
+#include "u8/u8_error.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *  \brief attributes of the data_row_index_t
+ */
+struct data_row_index_struct {
+    uint32_t slot_count;  /*!< number of slots, a power of two or 0 if no slots are assigned */
+    uint32_t entry_count;  /*!< number of used slots */
+    data_row_t *slot_row;  /*!< row of each slot, DATA_ROW_VOID if the slot is free */
+    uint32_t *slot_position;  /*!< position of each slot */
+};
+
+typedef struct data_row_index_struct data_row_index_t;
+
+/*!
+ *  \brief initializes the data_row_index_t struct to an empty index without slots
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void data_row_index_init ( data_row_index_t *this_ );
+
+/*!
+ *  \brief re-initializes the data_row_index_t struct to an empty index with slots for max_entries
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param max_entries number of entries that shall fit into the index
+ *  \param memory memory region from which the slots are fetched
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if the memory region is exhausted; the index has no slots then.
+ */
+static inline u8_error_t data_row_index_reinit ( data_row_index_t *this_,
+                                                 uint32_t max_entries,
+                                                 universal_memory_arena_t *memory
+                                               );
+
+/*!
+ *  \brief gets the number of bytes that data_row_index_reinit fetches from the memory region
+ *
+ *  \param max_entries number of entries that shall fit into the index
+ *  \return size of the slots in bytes, a multiple of 8
+ */
+static inline size_t data_row_index_get_memory_size ( uint32_t max_entries );
+
+/*!
+ *  \brief destroys the data_row_index_t struct
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void data_row_index_destroy ( data_row_index_t *this_ );
+
+/*!
+ *  \brief adds a row and its position
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param row the row, must not be DATA_ROW_VOID
+ *  \param position the position of the record in its array
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_DUPLICATE_ID if the row is already contained (the existing position is kept),
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if there is no free slot.
+ */
+static inline u8_error_t data_row_index_add ( data_row_index_t *this_, data_row_t row, uint32_t position );
+
+/*!
+ *  \brief gets the position of a row
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param row the row to search
+ *  \param out_position the position of the record, unchanged if not found
+ *  \return true if the row was found
+ */
+static inline bool data_row_index_get ( const data_row_index_t *this_, data_row_t row, uint32_t *out_position );
+
+/*!
+ *  \brief gets the number of entries
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of added rows
+ */
+static inline uint32_t data_row_index_get_count ( const data_row_index_t *this_ );
+
+/*!
+ *  \brief gets the maximum number of entries
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of rows that can be added in total
+ */
+static inline uint32_t data_row_index_get_max_count ( const data_row_index_t *this_ );
+
+/*!
+ *  \brief gets the number of slots for an index of max_entries
+ *
+ *  \param max_entries number of entries that shall fit into the index
+ *  \return a power of two, at least 8 and at least 2 * max_entries
+ */
+static inline uint32_t data_row_index_private_get_slot_count ( uint32_t max_entries );
+
+/*!
+ *  \brief gets the slot at which the search for a row starts
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param row the row to search
+ *  \return first slot to probe
+ */
+static inline uint32_t data_row_index_private_hash ( const data_row_index_t *this_, data_row_t row );
+
+#include "set/data_row_index.inl"
+
+#endif  /* DATA_ROW_INDEX_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,162 @@
+/* File: data_row_index.inl; Copyright and License: see below */
+
+#include <assert.h>
+
+static inline void data_row_index_init ( data_row_index_t *this_ )
+{
+    (*this_).slot_count = 0;
+    (*this_).entry_count = 0;
+    (*this_).slot_row = NULL;
+    (*this_).slot_position = NULL;
+}
+
+static inline u8_error_t data_row_index_reinit ( data_row_index_t *this_,
+                                                 uint32_t max_entries,
+                                                 universal_memory_arena_t *memory )
+{
+    assert( memory != NULL );
+    assert( max_entries <= ( UINT32_MAX / 4 ) );
+    u8_error_t result = U8_ERROR_NONE;
+
+    const uint32_t slots = data_row_index_private_get_slot_count( max_entries );
+
+    void *rows_block;
+    void *positions_block;
+    result |= universal_memory_arena_get_block( memory, slots * sizeof(data_row_t), &rows_block );
+    result |= universal_memory_arena_get_block( memory, slots * sizeof(uint32_t), &positions_block );
+    if ( result == U8_ERROR_NONE )
+    {
+        (*this_).slot_count = slots;
+        (*this_).slot_row = rows_block;
+        (*this_).slot_position = positions_block;
+        for ( uint32_t slot = 0; slot < slots; slot ++ )
+        {
+            (*this_).slot_row[slot] = DATA_ROW_VOID;
+        }
+    }
+    else
+    {
+        (*this_).slot_count = 0;
+        (*this_).slot_row = NULL;
+        (*this_).slot_position = NULL;
+    }
+    (*this_).entry_count = 0;
+
+    return result;
+}
+
+static inline size_t data_row_index_get_memory_size ( uint32_t max_entries )
+{
+    assert( max_entries <= ( UINT32_MAX / 4 ) );
+    const uint32_t slots = data_row_index_private_get_slot_count( max_entries );
+    return ( (size_t) slots ) * ( sizeof(data_row_t) + sizeof(uint32_t) );
+}
+
+static inline void data_row_index_destroy ( data_row_index_t *this_ )
+{
+    (*this_).slot_count = 0;
+    (*this_).entry_count = 0;
+    (*this_).slot_row = NULL;
+    (*this_).slot_position = NULL;
+}
+
+static inline u8_error_t data_row_index_add ( data_row_index_t *this_, data_row_t row, uint32_t position )
+{
+    assert( row != DATA_ROW_VOID );
+    u8_error_t result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+
+    if ( ( (*this_).entry_count + 1 ) <= ( (*this_).slot_count / 2 ) )
+    {
+        const uint32_t mask = (*this_).slot_count - 1;
+        for ( uint32_t slot = data_row_index_private_hash( this_, row ); true; slot = ( slot + 1 ) & mask )
+        {
+            if ( (*this_).slot_row[slot] == DATA_ROW_VOID )
+            {
+                (*this_).slot_row[slot] = row;
+                (*this_).slot_position[slot] = position;
+                (*this_).entry_count ++;
+                result = U8_ERROR_NONE;
+                break;
+            }
+            else if ( (*this_).slot_row[slot] == row )
+            {
+                result = U8_ERROR_DUPLICATE_ID;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+static inline bool data_row_index_get ( const data_row_index_t *this_, data_row_t row, uint32_t *out_position )
+{
+    assert( out_position != NULL );
+    bool result = false;
+
+    if ( ( (*this_).slot_count != 0 ) && ( row != DATA_ROW_VOID ) )
+    {
+        const uint32_t mask = (*this_).slot_count - 1;
+        for ( uint32_t slot = data_row_index_private_hash( this_, row ); true; slot = ( slot + 1 ) & mask )
+        {
+            if ( (*this_).slot_row[slot] == row )
+            {
+                *out_position = (*this_).slot_position[slot];
+                result = true;
+                break;
+            }
+            else if ( (*this_).slot_row[slot] == DATA_ROW_VOID )
+            {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+static inline uint32_t data_row_index_get_count ( const data_row_index_t *this_ )
+{
+    return (*this_).entry_count;
+}
+
+static inline uint32_t data_row_index_get_max_count ( const data_row_index_t *this_ )
+{
+    return (*this_).slot_count / 2;
+}
+
+static inline uint32_t data_row_index_private_get_slot_count ( uint32_t max_entries )
+{
+    /* at most half of the slots are used, this keeps the probe sequences short */
+    uint32_t slots = 8;
+    while ( slots < ( 2 * max_entries ) )
+    {
+        slots *= 2;
+    }
+    return slots;
+}
+
+static inline uint32_t data_row_index_private_hash ( const data_row_index_t *this_, data_row_t row )
+{
+    assert( (*this_).slot_count != 0 );
+    /* fibonacci hashing: the multiplication spreads consecutive rows over all slots */
+    const uint64_t spread = ((uint64_t) row) * UINT64_C(0x9e3779b97f4a7c15);
+    return ((uint32_t)( spread >> 32 )) & ( (*this_).slot_count - 1 );
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
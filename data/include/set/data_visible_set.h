@@ -16,19 +16,27 @@
 #include "entity/data_feature.h"
 #include "entity/data_id.h"
 #include "entity/data_row.h"
+#include "set/data_row_index.h"
+#include "u8arena/universal_memory_arena.h"
 #include <cairo.h>
 #include <stdint.h>
 #include <stdbool.h>
 
 /*!
  *  \brief constants for maximum values of data_visible_set_t
+ *
+ *  The arrays of data_visible_set_t are allocated on the heap and grow on demand,
+ *  the id lookup indices and the containment_cache are sized to the actual numbers of elements.
+ *  Memory is therefore needed only for the loaded elements, not for these maxima.
+ *  The maxima bound the effort to layout one diagram
+ *  and the element numbers stored in the 16-bit cells of the pencil spatial indices.
  */
 enum data_visible_set_max_enum {
-    DATA_VISIBLE_SET_MAX_CLASSIFIERS = 128,  /*!< maximum number of visible classifiers to be shown in one single diagram */
-    DATA_VISIBLE_SET_MAX_FEATURES = 256,  /*!< maximum number of features linked to all visible classifiers, */
-                                          /*!< lifelines of foreign diagrams are excluded/filtered. */
-    DATA_VISIBLE_SET_MAX_RELATIONSHIPS = 384,  /*!< maximum number of relationships linked to all visible classifiers, */
-                                               /*!< excluded/filtered are relationships between lifelines of foreign diagrams. */
+    DATA_VISIBLE_SET_MAX_CLASSIFIERS = 2048,  /*!< maximum number of visible classifiers to be shown in one single diagram */
+    DATA_VISIBLE_SET_MAX_FEATURES = 4096,  /*!< maximum number of features linked to all visible classifiers, */
+                                           /*!< lifelines of foreign diagrams are excluded/filtered. */
+    DATA_VISIBLE_SET_MAX_RELATIONSHIPS = 4096,  /*!< maximum number of relationships linked to all visible classifiers, */
+                                                /*!< excluded/filtered are relationships between lifelines of foreign diagrams. */
 };
 
 /*!
@@ -37,13 +45,30 @@ enum data_visible_set_max_enum {
 struct data_visible_set_struct {
     data_diagram_t diagram;  /*!< the diagram record */
     uint32_t visible_classifier_count;  /*!< number of all contained visible classifier records */
-    data_visible_classifier_t visible_classifiers[DATA_VISIBLE_SET_MAX_CLASSIFIERS];  /*!< all contained visible_classifier records */
+    uint32_t visible_classifier_capacity;  /*!< number of visible classifier records that fit into the current array */
+    data_visible_classifier_t *visible_classifiers;  /*!< all contained visible_classifier records, heap allocated */
     uint32_t feature_count;  /*!< number of all contained feature records */
-    data_feature_t features[DATA_VISIBLE_SET_MAX_FEATURES];  /*!< all contained feature records */
+    uint32_t feature_capacity;  /*!< number of feature records that fit into the current array */
+    data_feature_t *features;  /*!< all contained feature records, heap allocated */
     uint32_t relationship_count;  /*!< number of all contained relationship records */
-    data_relationship_t relationships[DATA_VISIBLE_SET_MAX_RELATIONSHIPS];  /*!< all contained relationship records */
-
-    bool containment_cache[DATA_VISIBLE_SET_MAX_CLASSIFIERS][DATA_VISIBLE_SET_MAX_CLASSIFIERS];  /*!< states if ancestor index classifier directly or indirectly contains child index classifier */
+    uint32_t relationship_capacity;  /*!< number of relationship records that fit into the current array */
+    data_relationship_t *relationships;  /*!< all contained relationship records, heap allocated */
+
+    uint32_t indexed_classifier_count;  /*!< number of visible classifiers that are contained in the classifier indices */
+    data_row_index_t diagramelement_index;  /*!< maps diagramelement rows to visible classifier indices */
+    data_row_index_t classifier_index;  /*!< maps classifier rows to the first visible classifier index showing the classifier */
+    uint32_t indexed_feature_count;  /*!< number of features that are contained in the feature index */
+    data_row_index_t feature_index;  /*!< maps feature rows to feature indices */
+    uint32_t indexed_relationship_count;  /*!< number of relationships that are contained in the relationship index */
+    data_row_index_t relationship_index;  /*!< maps relationship rows to relationship indices */
+
+    uint32_t containment_size;  /*!< number of classifiers covered by the containment_cache */
+    uint8_t *containment_cache;  /*!< bit matrix, states if ancestor index classifier directly or indirectly contains child index classifier */
+
+    universal_memory_arena_t index_memory;  /*!< memory region from which the indices and the containment_cache are fetched, */
+                                            /*!< reset at every update; valid only if index_buffer is not NULL */
+    void *index_buffer;  /*!< heap block of the index_memory region, NULL if not yet allocated */
+    size_t index_buffer_size;  /*!< size of the index_buffer in bytes */
 };
 
 typedef struct data_visible_set_struct data_visible_set_t;
@@ -188,7 +213,7 @@ static inline int32_t data_visible_set_get_classifier_index ( const data_visible
  *
  *  \param this_ pointer to own object attributes
  *  \param vis_classifier_ptr pointer to the classifier of which to retrieve the index.
- *                            must be a valid pointer to (*this_).visible_classifiers.
+ *                            must be a valid pointer into (*this_).visible_classifiers.
  *  \return index of data_classifier_t.
  */
 static inline uint32_t data_visible_set_get_classifier_index_from_pointer ( const data_visible_set_t *this_,
@@ -198,9 +223,13 @@ static inline uint32_t data_visible_set_get_classifier_index_from_pointer ( cons
 /*!
  *  \brief appends a visible_classifier
  *
+ *  Note that pointers to visible classifiers may become invalid when appending classifiers.
+ *
  *  \param this_ pointer to own object attributes
  *  \param new_classifier pointer to visible_classifier record that shall be copied
- *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if array is full
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if DATA_VISIBLE_SET_MAX_CLASSIFIERS classifiers are already contained
+ *          or the array cannot grow because no memory is available
  */
 static inline u8_error_t data_visible_set_append_classifier( data_visible_set_t *this_, const data_visible_classifier_t *new_classifier );
 
@@ -260,9 +289,13 @@ static inline data_feature_t *data_visible_set_get_feature_list_ptr ( data_visib
 /*!
  *  \brief appends a feature
  *
+ *  Note that pointers to features may become invalid when appending features.
+ *
  *  \param this_ pointer to own object attributes
  *  \param new_feature pointer to feature record that shall be copied
- *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if array is full
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if DATA_VISIBLE_SET_MAX_FEATURES features are already contained
+ *          or the array cannot grow because no memory is available
  */
 static inline u8_error_t data_visible_set_append_feature( data_visible_set_t *this_, const data_feature_t *new_feature );
 
@@ -344,10 +377,13 @@ static inline uint32_t data_visible_set_count_descendants_of_index ( const data_
  *
  *  Note that after adding relationships of type DATA_RELATIONSHIP_TYPE_UML_CONTAINMENT, one has to manually call
  *  data_visible_set_update_containment_cache() to update the containment cache.
+ *  Note that pointers to relationships may become invalid when appending relationships.
  *
  *  \param this_ pointer to own object attributes
  *  \param new_relationship pointer to relationship record that shall be copied
- *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if array is full
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if DATA_VISIBLE_SET_MAX_RELATIONSHIPS relationships are already contained
+ *          or the array cannot grow because no memory is available
  */
 static inline u8_error_t data_visible_set_append_relationship( data_visible_set_t *this_, const data_relationship_t *new_relationship );
 
@@ -369,12 +405,131 @@ static inline bool data_visible_set_is_valid ( const data_visible_set_t *this_ )
 static inline void data_visible_set_invalidate ( data_visible_set_t *this_ );
 
 /*!
- *  \brief initializes or re-initializes the containment_cache
+ *  \brief initializes or re-initializes the id lookup indices and the containment_cache
+ *
+ *  This function shall be called after appending elements.
+ *  Until then, lookups by id of appended elements fall back to a linear search.
+ *  The indices and the containment_cache are rebuilt from scratch, sized to the current numbers of elements.
  *
  *  \param this_ pointer to own object attributes
  */
 void data_visible_set_update_containment_cache ( data_visible_set_t *this_ );
 
+/*!
+ *  \brief gets the index of a visible classifier by the id of its diagramelement
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param diagramelement_id id of the diagramelement
+ *  \return index of the visible classifier, -1 if not found
+ */
+static inline int32_t data_visible_set_private_get_visible_classifier_index ( const data_visible_set_t *this_, data_row_t diagramelement_id );
+
+/*!
+ *  \brief reads a bit of the containment_cache
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param ancestor_index index of the ancestor classifier
+ *  \param descendant_index index of the descendant classifier
+ *  \return true if ancestor contains descendant, false if not or if an index is not covered by the containment_cache
+ */
+static inline bool data_visible_set_private_get_containment ( const data_visible_set_t *this_, uint32_t ancestor_index, uint32_t descendant_index );
+
+/*!
+ *  \brief sets a bit of the containment_cache
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param ancestor_index index of the ancestor classifier, must be covered by the containment_cache
+ *  \param descendant_index index of the descendant classifier, must be covered by the containment_cache
+ */
+static inline void data_visible_set_private_set_containment ( data_visible_set_t *this_, uint32_t ancestor_index, uint32_t descendant_index );
+
+/*!
+ *  \brief builds the indices of all visible classifiers
+ *
+ *  The index_memory must have been reset before.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if the index_memory is exhausted
+ */
+u8_error_t data_visible_set_private_update_classifier_indices ( data_visible_set_t *this_ );
+
+/*!
+ *  \brief builds the index of all features
+ *
+ *  The index_memory must have been reset before.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if the index_memory is exhausted
+ */
+u8_error_t data_visible_set_private_update_feature_index ( data_visible_set_t *this_ );
+
+/*!
+ *  \brief builds the index of all relationships
+ *
+ *  The index_memory must have been reset before.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if the index_memory is exhausted
+ */
+u8_error_t data_visible_set_private_update_relationship_index ( data_visible_set_t *this_ );
+
+/*!
+ *  \brief ensures that the visible_classifiers array can hold one more element
+ *
+ *  The array doubles its capacity when it is full. Then the elements are copied to a new heap block
+ *  because they contain pointers to their own string buffers; pointers to visible classifiers become invalid.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE if there is space for one more element,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if DATA_VISIBLE_SET_MAX_CLASSIFIERS classifiers are already contained
+ *          or the array cannot grow because no memory is available
+ */
+u8_error_t data_visible_set_private_reserve_classifier ( data_visible_set_t *this_ );
+
+/*!
+ *  \brief ensures that the features array can hold one more element
+ *
+ *  The array doubles its capacity when it is full, see data_visible_set_private_reserve_classifier.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE if there is space for one more element,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if DATA_VISIBLE_SET_MAX_FEATURES features are already contained
+ *          or the array cannot grow because no memory is available
+ */
+u8_error_t data_visible_set_private_reserve_feature ( data_visible_set_t *this_ );
+
+/*!
+ *  \brief ensures that the relationships array can hold one more element
+ *
+ *  The array doubles its capacity when it is full, see data_visible_set_private_reserve_classifier.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE if there is space for one more element,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if DATA_VISIBLE_SET_MAX_RELATIONSHIPS relationships are already contained
+ *          or the array cannot grow because no memory is available
+ */
+u8_error_t data_visible_set_private_reserve_relationship ( data_visible_set_t *this_ );
+
+/*!
+ *  \brief empties the indices and the containment_cache and resets the index_memory
+ *
+ *  If the index_buffer is smaller than min_size, it is replaced by a heap block of min_size bytes.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param min_size number of bytes that the index_memory shall provide
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if no memory is available
+ */
+u8_error_t data_visible_set_private_reset_indices ( data_visible_set_t *this_, size_t min_size );
+
+/*!
+ *  \brief frees all heap blocks of the arrays, the indices and the containment_cache
+ *
+ *  All contained elements must have been destroyed before.
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void data_visible_set_private_free_memory ( data_visible_set_t *this_ );
+
 /*!
  *  \brief destroys all contained visible classifiers
  *
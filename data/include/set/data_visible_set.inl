@@ -70,20 +70,10 @@ static inline const data_visible_classifier_t *data_visible_set_get_visible_clas
     assert( (*this_).visible_classifier_count <= DATA_VISIBLE_SET_MAX_CLASSIFIERS );
     const data_visible_classifier_t *result = NULL;
 
-    /* iterate over all visible classifiers */
-    for ( uint32_t index = 0; index < (*this_).visible_classifier_count; index ++ )
+    const int32_t index = data_visible_set_private_get_visible_classifier_index( this_, diagramelement_id );
+    if ( index != -1 )
     {
-        const data_visible_classifier_t *visible_classifier;
-        visible_classifier = &((*this_).visible_classifiers[index]);
-        assert ( data_visible_classifier_is_valid( visible_classifier ) );
-
-        const data_diagramelement_t *diagramelement;
-        diagramelement = data_visible_classifier_get_diagramelement_const( visible_classifier );
-        if ( data_diagramelement_get_row( diagramelement ) == diagramelement_id )
-        {
-            result = visible_classifier;
-            break;
-        }
+        result = &((*this_).visible_classifiers[index]);
     }
 
     return result;
@@ -94,20 +84,10 @@ static inline data_visible_classifier_t *data_visible_set_get_visible_classifier
     assert( (*this_).visible_classifier_count <= DATA_VISIBLE_SET_MAX_CLASSIFIERS );
     data_visible_classifier_t *result = NULL;
 
-    /* iterate over all visible classifiers */
-    for ( uint32_t index = 0; index < (*this_).visible_classifier_count; index ++ )
+    const int32_t index = data_visible_set_private_get_visible_classifier_index( this_, diagramelement_id );
+    if ( index != -1 )
     {
-        data_visible_classifier_t *visible_classifier;
-        visible_classifier = &((*this_).visible_classifiers[index]);
-        assert ( data_visible_classifier_is_valid( visible_classifier ) );
-
-        data_diagramelement_t *diagramelement;
-        diagramelement = data_visible_classifier_get_diagramelement_ptr( visible_classifier );
-        if ( data_diagramelement_get_row( diagramelement ) == diagramelement_id )
-        {
-            result = visible_classifier;
-            break;
-        }
+        result = &((*this_).visible_classifiers[index]);
     }
 
     return result;
@@ -118,19 +98,10 @@ static inline const data_classifier_t *data_visible_set_get_classifier_by_id_con
     assert( (*this_).visible_classifier_count <= DATA_VISIBLE_SET_MAX_CLASSIFIERS );
     const data_classifier_t *result = NULL;
 
-    for ( int index = 0; index < (*this_).visible_classifier_count; index ++ )
+    const int32_t index = data_visible_set_get_classifier_index( this_, row );
+    if ( index != -1 )
     {
-        const data_visible_classifier_t *visible_classifier;
-        visible_classifier = &((*this_).visible_classifiers[index]);
-        assert ( data_visible_classifier_is_valid( visible_classifier ) );
-
-        const data_classifier_t *probe;
-        probe = data_visible_classifier_get_classifier_const( visible_classifier );
-        if ( row == data_classifier_get_row( probe ) )
-        {
-            result = probe;
-            break;
-        }
+        result = data_visible_classifier_get_classifier_const( &((*this_).visible_classifiers[index]) );
     }
 
     return result;
@@ -141,37 +112,75 @@ static inline data_classifier_t *data_visible_set_get_classifier_by_id_ptr ( dat
     assert( (*this_).visible_classifier_count <= DATA_VISIBLE_SET_MAX_CLASSIFIERS );
     data_classifier_t *result = NULL;
 
-    for ( int index = 0; index < (*this_).visible_classifier_count; index ++ )
+    const int32_t index = data_visible_set_get_classifier_index( this_, row );
+    if ( index != -1 )
     {
-        data_visible_classifier_t *visible_classifier;
-        visible_classifier = &((*this_).visible_classifiers[index]);
-        assert ( data_visible_classifier_is_valid( visible_classifier ) );
+        result = data_visible_classifier_get_classifier_ptr( &((*this_).visible_classifiers[index]) );
+    }
+
+    return result;
+}
+
+static inline int32_t data_visible_set_get_classifier_index ( const data_visible_set_t *this_, data_row_t row )
+{
+    assert( (*this_).visible_classifier_count <= DATA_VISIBLE_SET_MAX_CLASSIFIERS );
+    int32_t result = -1;
 
-        data_classifier_t *probe;
-        probe = data_visible_classifier_get_classifier_ptr( visible_classifier );
-        if ( row == data_classifier_get_row( probe ) )
+    if ( (*this_).indexed_classifier_count == (*this_).visible_classifier_count )
+    {
+        uint32_t index;
+        if ( data_row_index_get( &((*this_).classifier_index), row, &index ) )
+        {
+            result = index;
+        }
+    }
+    else
+    {
+        /* the index is outdated, iterate over all visible classifiers */
+        for ( int index = 0; index < (*this_).visible_classifier_count; index ++ )
         {
-            result = probe;
-            break;
+            const data_classifier_t *probe;
+            probe = data_visible_classifier_get_classifier_const( &((*this_).visible_classifiers[index]) );
+            if ( row == data_classifier_get_row( probe ) )
+            {
+                result = index;
+                break;
+            }
         }
     }
 
     return result;
 }
 
-static inline int32_t data_visible_set_get_classifier_index ( const data_visible_set_t *this_, data_row_t row )
+static inline int32_t data_visible_set_private_get_visible_classifier_index ( const data_visible_set_t *this_, data_row_t diagramelement_id )
 {
     assert( (*this_).visible_classifier_count <= DATA_VISIBLE_SET_MAX_CLASSIFIERS );
     int32_t result = -1;
 
-    for ( int index = 0; index < (*this_).visible_classifier_count; index ++ )
+    if ( (*this_).indexed_classifier_count == (*this_).visible_classifier_count )
     {
-        const data_classifier_t *probe;
-        probe = data_visible_classifier_get_classifier_const( &((*this_).visible_classifiers[index]) );
-        if ( row == data_classifier_get_row( probe ) )
+        uint32_t index;
+        if ( data_row_index_get( &((*this_).diagramelement_index), diagramelement_id, &index ) )
         {
             result = index;
-            break;
+        }
+    }
+    else
+    {
+        /* the index is outdated, iterate over all visible classifiers */
+        for ( uint32_t index = 0; index < (*this_).visible_classifier_count; index ++ )
+        {
+            const data_visible_classifier_t *visible_classifier;
+            visible_classifier = &((*this_).visible_classifiers[index]);
+            assert ( data_visible_classifier_is_valid( visible_classifier ) );
+
+            const data_diagramelement_t *diagramelement;
+            diagramelement = data_visible_classifier_get_diagramelement_const( visible_classifier );
+            if ( data_diagramelement_get_row( diagramelement ) == diagramelement_id )
+            {
+                result = index;
+                break;
+            }
         }
     }
 
@@ -183,8 +192,7 @@ static inline uint32_t data_visible_set_get_classifier_index_from_pointer ( cons
 {
     assert ( NULL != vis_classifier_ptr );  /* input parameters test */
     assert ( vis_classifier_ptr >= &((*this_).visible_classifiers[0]) );  /* input parameters test */
-    assert ( vis_classifier_ptr < &((*this_).visible_classifiers[DATA_VISIBLE_SET_MAX_CLASSIFIERS]) );  /* input parameters test */
-    assert ( 3 == &((*this_).visible_classifiers[3]) - (*this_).visible_classifiers );  /* compiler test */
+    assert ( vis_classifier_ptr < &((*this_).visible_classifiers[(*this_).visible_classifier_count]) );  /* input parameters test */
     return ( vis_classifier_ptr - (*this_).visible_classifiers );
 }
 
@@ -195,15 +203,12 @@ static inline u8_error_t data_visible_set_append_classifier( data_visible_set_t
     u8_error_t result = U8_ERROR_NONE;
     
     const uint32_t new_index = (*this_).visible_classifier_count;
-    if ( new_index < DATA_VISIBLE_SET_MAX_CLASSIFIERS )
+    result = data_visible_set_private_reserve_classifier( this_ );
+    if ( result == U8_ERROR_NONE )
     {
         data_visible_classifier_copy( &((*this_).visible_classifiers[new_index]), new_classifier );
         (*this_).visible_classifier_count ++;
     }
-    else
-    {
-        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
-    }
     
     return result;
 }
@@ -256,14 +261,26 @@ static inline const data_feature_t *data_visible_set_get_feature_by_id_const ( c
     assert( (*this_).feature_count <= DATA_VISIBLE_SET_MAX_FEATURES );
     const data_feature_t *result = NULL;
 
-    for ( int index = 0; index < (*this_).feature_count; index ++ )
+    if ( (*this_).indexed_feature_count == (*this_).feature_count )
+    {
+        uint32_t index;
+        if ( data_row_index_get( &((*this_).feature_index), row, &index ) )
+        {
+            result = &((*this_).features[index]);
+        }
+    }
+    else
     {
-        const data_feature_t *probe;
-        probe = &((*this_).features[index]);
-        if ( row == data_feature_get_row( probe ) )
+        /* the index is outdated, iterate over all features */
+        for ( int index = 0; index < (*this_).feature_count; index ++ )
         {
-            result = probe;
-            break;
+            const data_feature_t *probe;
+            probe = &((*this_).features[index]);
+            if ( row == data_feature_get_row( probe ) )
+            {
+                result = probe;
+                break;
+            }
         }
     }
 
@@ -275,14 +292,26 @@ static inline data_feature_t *data_visible_set_get_feature_by_id_ptr ( data_visi
     assert( (*this_).feature_count <= DATA_VISIBLE_SET_MAX_FEATURES );
     data_feature_t *result = NULL;
 
-    for ( int index = 0; index < (*this_).feature_count; index ++ )
+    if ( (*this_).indexed_feature_count == (*this_).feature_count )
     {
-        data_feature_t *probe;
-        probe = &((*this_).features[index]);
-        if ( row == data_feature_get_row( probe ) )
+        uint32_t index;
+        if ( data_row_index_get( &((*this_).feature_index), row, &index ) )
         {
-            result = probe;
-            break;
+            result = &((*this_).features[index]);
+        }
+    }
+    else
+    {
+        /* the index is outdated, iterate over all features */
+        for ( int index = 0; index < (*this_).feature_count; index ++ )
+        {
+            data_feature_t *probe;
+            probe = &((*this_).features[index]);
+            if ( row == data_feature_get_row( probe ) )
+            {
+                result = probe;
+                break;
+            }
         }
     }
 
@@ -302,15 +331,12 @@ static inline u8_error_t data_visible_set_append_feature( data_visible_set_t *th
     u8_error_t result = U8_ERROR_NONE;
     
     const uint32_t new_index = (*this_).feature_count;
-    if ( new_index < DATA_VISIBLE_SET_MAX_FEATURES )
+    result = data_visible_set_private_reserve_feature( this_ );
+    if ( result == U8_ERROR_NONE )
     {
         data_feature_copy( &((*this_).features[new_index]), new_feature );
         (*this_).feature_count ++;
     }
-    else
-    {
-        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
-    }
     
     return result;
 }
@@ -363,14 +389,26 @@ static inline const data_relationship_t *data_visible_set_get_relationship_by_id
     assert( (*this_).relationship_count <= DATA_VISIBLE_SET_MAX_RELATIONSHIPS );
     const data_relationship_t *result = NULL;
 
-    for ( int index = 0; index < (*this_).relationship_count; index ++ )
+    if ( (*this_).indexed_relationship_count == (*this_).relationship_count )
+    {
+        uint32_t index;
+        if ( data_row_index_get( &((*this_).relationship_index), row, &index ) )
+        {
+            result = &((*this_).relationships[index]);
+        }
+    }
+    else
     {
-        const data_relationship_t *probe;
-        probe = &((*this_).relationships[index]);
-        if ( row == data_relationship_get_row( probe ) )
+        /* the index is outdated, iterate over all relationships */
+        for ( int index = 0; index < (*this_).relationship_count; index ++ )
         {
-            result = probe;
-            break;
+            const data_relationship_t *probe;
+            probe = &((*this_).relationships[index]);
+            if ( row == data_relationship_get_row( probe ) )
+            {
+                result = probe;
+                break;
+            }
         }
     }
 
@@ -382,14 +420,26 @@ static inline data_relationship_t *data_visible_set_get_relationship_by_id_ptr (
     assert( (*this_).relationship_count <= DATA_VISIBLE_SET_MAX_RELATIONSHIPS );
     data_relationship_t *result = NULL;
 
-    for ( int index = 0; index < (*this_).relationship_count; index ++ )
+    if ( (*this_).indexed_relationship_count == (*this_).relationship_count )
+    {
+        uint32_t index;
+        if ( data_row_index_get( &((*this_).relationship_index), row, &index ) )
+        {
+            result = &((*this_).relationships[index]);
+        }
+    }
+    else
     {
-        data_relationship_t *probe;
-        probe = &((*this_).relationships[index]);
-        if ( row == data_relationship_get_row( probe ) )
+        /* the index is outdated, iterate over all relationships */
+        for ( int index = 0; index < (*this_).relationship_count; index ++ )
         {
-            result = probe;
-            break;
+            data_relationship_t *probe;
+            probe = &((*this_).relationships[index]);
+            if ( row == data_relationship_get_row( probe ) )
+            {
+                result = probe;
+                break;
+            }
         }
     }
 
@@ -402,7 +452,7 @@ static inline bool data_visible_set_is_ancestor_by_index ( const data_visible_se
     assert( ancestor_index < (*this_).visible_classifier_count );
     assert( descendant_index < (*this_).visible_classifier_count );
 
-    return (*this_).containment_cache[ancestor_index][descendant_index];
+    return data_visible_set_private_get_containment( this_, ancestor_index, descendant_index );
 }
 
 static inline uint32_t data_visible_set_count_ancestors_of_index ( const data_visible_set_t *this_, uint32_t classifier_index )
@@ -414,7 +464,7 @@ static inline uint32_t data_visible_set_count_ancestors_of_index ( const data_vi
 
     for ( uint32_t ancestor_index = 0; ancestor_index < (*this_).visible_classifier_count; ancestor_index ++ )
     {
-        if ( (*this_).containment_cache[ancestor_index][classifier_index] )
+        if ( data_visible_set_private_get_containment( this_, ancestor_index, classifier_index ) )
         {
             result ++;
         }
@@ -432,7 +482,7 @@ static inline uint32_t data_visible_set_count_descendants_of_index ( const data_
 
     for ( uint32_t descendant_index = 0; descendant_index < (*this_).visible_classifier_count; descendant_index ++ )
     {
-        if ( (*this_).containment_cache[classifier_index][descendant_index] )
+        if ( data_visible_set_private_get_containment( this_, classifier_index, descendant_index ) )
         {
             result ++;
         }
@@ -448,19 +498,35 @@ static inline u8_error_t data_visible_set_append_relationship( data_visible_set_
     u8_error_t result = U8_ERROR_NONE;
     
     const uint32_t new_index = (*this_).relationship_count;
-    if ( new_index < DATA_VISIBLE_SET_MAX_RELATIONSHIPS )
+    result = data_visible_set_private_reserve_relationship( this_ );
+    if ( result == U8_ERROR_NONE )
     {
         data_relationship_copy( &((*this_).relationships[new_index]), new_relationship );
         (*this_).relationship_count ++;
     }
-    else
+    
+    return result;
+}
+
+static inline bool data_visible_set_private_get_containment ( const data_visible_set_t *this_, uint32_t ancestor_index, uint32_t descendant_index )
+{
+    bool result = false;
+    if ( ( ancestor_index < (*this_).containment_size ) && ( descendant_index < (*this_).containment_size ) )
     {
-        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+        const uint32_t bit = ( ancestor_index * (*this_).containment_size ) + descendant_index;
+        result = ( 0 != ( (*this_).containment_cache[bit/8] & ( 1u << ( bit % 8 ) ) ) );
     }
-    
     return result;
 }
 
+static inline void data_visible_set_private_set_containment ( data_visible_set_t *this_, uint32_t ancestor_index, uint32_t descendant_index )
+{
+    assert( ancestor_index < (*this_).containment_size );
+    assert( descendant_index < (*this_).containment_size );
+    const uint32_t bit = ( ancestor_index * (*this_).containment_size ) + descendant_index;
+    (*this_).containment_cache[bit/8] |= ( 1u << ( bit % 8 ) );
+}
+
 /* ================================ misc ================================ */
 
 static inline bool data_visible_set_is_valid ( const data_visible_set_t *this_ )
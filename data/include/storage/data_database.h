@@ -12,6 +12,7 @@
 #include "storage/data_database_listener.h"
 #include "storage/data_change_notifier.h"
 #include "storage/data_database_state.h"
+#include "storage/data_database_profile.h"
 #include "storage/data_revision.h"
 #include "utf8stringbuf/utf8stringbuf.h"
 #include <sqlite3.h>
@@ -53,6 +54,8 @@ struct data_database_struct {
     data_database_state_t db_state;
     uint_fast8_t transaction_recursion;  /*!< current transaction depth, 0 if no transaction active */
     data_revision_t revision;  /*!< the revision identifier of the stored data-model, valid while the database is open */
+    bool search_index_available;  /*!< true if the full-text search index was created on request of a searcher, valid while the database is open */
+    data_database_profile_t profile;  /*!< storage profile that is applied to the connection at open */
 
     data_database_listener_t *(listener_list[DATA_DATABASE_MAX_LISTENERS]);  /*!< array of db-file change listeners. */
                                                                              /*!< Only in case of a changed db-file, listeners are informed. */
@@ -124,6 +127,36 @@ static inline u8_error_t data_database_open_in_memory ( data_database_t *this_ )
  */
 u8_error_t data_database_private_open ( data_database_t *this_, const char* db_file_path, int sqlite3_flags );
 
+/*!
+ *  \brief selects the storage profile which is applied when the database is opened the next time
+ *
+ *  The profile of an already open database is not changed.
+ *  After data_database_init, the profile is DATA_DATABASE_PROFILE_DURABLE.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param profile journal mode and synchronization level to use at the next open
+ */
+static inline void data_database_set_profile ( data_database_t *this_, data_database_profile_t profile );
+
+/*!
+ *  \brief gets the selected storage profile
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return the storage profile that is applied at open
+ */
+static inline data_database_profile_t data_database_get_profile ( data_database_t *this_ );
+
+/*!
+ *  \brief applies the pragmas of the selected storage profile to the just opened connection
+ *
+ *  The settings only tune the performance, a failure is logged but does not prevent using the database.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param sqlite3_flags sqlite3 flags as passed to sqlite3_open_v2(); read-only and in-memory databases keep their journal mode
+ *  \return U8_ERROR_AT_DB if a pragma could not be set, U8_ERROR_NONE in case of success
+ */
+u8_error_t data_database_private_apply_profile ( data_database_t *this_, int sqlite3_flags );
+
 /*!
  *  \brief checks if the database file is open
  *
@@ -132,6 +165,16 @@ u8_error_t data_database_private_open ( data_database_t *this_, const char* db_f
  */
 static inline bool data_database_is_open( data_database_t *this_ );
 
+/*!
+ *  \brief checks if the database is open and is a native sqlite3 file (not in memory)
+ *
+ *  Only a database file can be opened by other connections, e.g. by the threads of an io_export_image_pool_t.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if the database is open and stored in a file
+ */
+static inline bool data_database_is_file( data_database_t *this_ );
+
 /*!
  *  \brief closes the current database file
  *
@@ -162,6 +205,33 @@ u8_error_t data_database_private_initialize_tables( data_database_t *this_ );
  */
 u8_error_t data_database_private_upgrade_tables( data_database_t *this_ );
 
+/*!
+ *  \brief creates and fills the full-text search index in the temp schema
+ *
+ *  The index is optional: If the sqlite3 library does not provide fts5,
+ *  no index is created and search_index_available is false.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_AT_DB if the index could not be created
+ */
+u8_error_t data_database_private_initialize_search_index( data_database_t *this_ );
+
+/*!
+ *  \brief creates the triggers that keep the full-text search index up to date, if they do not exist yet
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_AT_DB if the triggers could not be created
+ */
+u8_error_t data_database_private_create_search_triggers( data_database_t *this_ );
+
+/*!
+ *  \brief checks if the full-text search index is available
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if the database is open and the fts5 search index tables exist
+ */
+static inline bool data_database_has_search_index( data_database_t *this_ );
+
 /* ================================ Actions on DB ================================ */
 
 /*!
@@ -180,6 +250,49 @@ static inline sqlite3 *data_database_get_database_ptr ( data_database_t *this_ )
  */
 u8_error_t data_database_flush_caches ( data_database_t *this_ );
 
+/*!
+ *  \brief creates and fills the full-text search index of this connection if it does not exist yet
+ *
+ *  The index is not created when opening the database:
+ *  Connections that do not search (e.g. read-only connections of exporters) do not need it,
+ *  and its triggers would slow down every change of this connection.
+ *  A searcher requests the index before the first search.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success or if the index already exists,
+ *          U8_ERROR_AT_DB if the sqlite3 library does not provide the index (fts5), U8_ERROR_NO_DB if no database open
+ */
+u8_error_t data_database_request_search_index ( data_database_t *this_ );
+
+/*!
+ *  \brief stops updating the full-text search index on every change, e.g. while a file is imported
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success or if there is no search index, U8_ERROR_AT_DB in case of an error
+ */
+u8_error_t data_database_pause_search_index ( data_database_t *this_ );
+
+/*!
+ *  \brief refills the full-text search index once and updates it on every change again
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success or if there is no search index, U8_ERROR_AT_DB in case of an error
+ */
+u8_error_t data_database_resume_search_index ( data_database_t *this_ );
+
+/*!
+ *  \brief replaces the contents of the full-text search index by the current contents of the tables
+ *
+ *  The search index lives in the temp schema of this connection and is kept up to date by triggers
+ *  that fire only on changes of this connection.
+ *  A second connection to the same file (e.g. a data_database_snapshot_t) shall refill its index
+ *  after the editor changed the database.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success or if there is no search index, U8_ERROR_AT_DB in case of an error, U8_ERROR_NO_DB if no database open
+ */
+u8_error_t data_database_refill_search_index ( data_database_t *this_ );
+
 /*!
  *  \brief executes a "BEGIN TRANSACTION" command.
  *
@@ -286,7 +399,9 @@ static inline data_revision_t data_database_get_revision ( data_database_t *this
 static inline void data_database_set_revision ( data_database_t *this_, data_revision_t revision );
 
 /*!
- *  \brief prints statistics of the current database file to the trace output
+ *  \brief prints statistics and the effective storage settings of the current database file to the trace output
+ *
+ *  The storage settings are journal_mode, synchronous, cache_size, mmap_size and temp_store.
  *
  *  \param this_ pointer to own object attributes
  *  \return U8_ERROR_NONE in case of success
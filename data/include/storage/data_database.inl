@@ -53,6 +53,40 @@ static inline bool data_database_is_open( data_database_t *this_ )
     return result;
 }
 
+static inline bool data_database_is_file( data_database_t *this_ )
+{
+    bool result;
+    u8_error_t locking_error;
+    locking_error = data_database_lock_on_write( this_ );
+    result = (*this_).db_state == DATA_DATABASE_STATE_OPEN;
+    locking_error |= data_database_unlock_on_write( this_ );
+    assert( locking_error == U8_ERROR_NONE );
+    (void) locking_error;  /* this should not happen in RELEASE mode */
+    return result;
+}
+
+static inline void data_database_set_profile ( data_database_t *this_, data_database_profile_t profile )
+{
+    u8_error_t locking_error;
+    locking_error = data_database_lock_on_write( this_ );
+    (*this_).profile = profile;
+    locking_error |= data_database_unlock_on_write( this_ );
+    assert( locking_error == U8_ERROR_NONE );
+    (void) locking_error;  /* this should not happen in RELEASE mode */
+}
+
+static inline data_database_profile_t data_database_get_profile ( data_database_t *this_ )
+{
+    data_database_profile_t result;
+    u8_error_t locking_error;
+    locking_error = data_database_lock_on_write( this_ );
+    result = (*this_).profile;
+    locking_error |= data_database_unlock_on_write( this_ );
+    assert( locking_error == U8_ERROR_NONE );
+    (void) locking_error;  /* this should not happen in RELEASE mode */
+    return result;
+}
+
 /* ================================ Actions on DB ================================ */
 
 static inline sqlite3 *data_database_get_database_ptr ( data_database_t *this_ )
@@ -160,6 +194,18 @@ static inline u8_error_t data_database_finalize_statement ( data_database_t *thi
 
 /* ================================ Information ================================ */
 
+static inline bool data_database_has_search_index( data_database_t *this_ )
+{
+    bool result;
+    u8_error_t locking_error;
+    locking_error = data_database_lock_on_write( this_ );
+    result = ( (*this_).db_state != DATA_DATABASE_STATE_CLOSED ) && (*this_).search_index_available;
+    locking_error |= data_database_unlock_on_write( this_ );
+    assert( locking_error == U8_ERROR_NONE );
+    (void) locking_error;  /* this should not happen in RELEASE mode */
+    return result;
+}
+
 static inline data_revision_t data_database_get_revision ( data_database_t *this_ )
 {
     data_revision_t result;
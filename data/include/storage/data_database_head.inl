@@ -60,7 +60,7 @@ static inline u8_error_t data_database_head_update_value_by_key ( data_database_
         if ( create_if_not_found )
         {
             result = U8_ERROR_NONE;
-            data_head_init_new( &head, key, "" );
+            data_head_init_new( &head, key, new_head_value );
             result |= data_database_head_create_value( this_, &head, NULL );
             data_head_destroy( &head );
         }
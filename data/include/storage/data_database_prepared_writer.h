@@ -0,0 +1,328 @@
+/* File: data_database_prepared_writer.h; Copyright and License: see below */
+
+#ifndef DATA_DATABASE_PREPARED_WRITER_H
+#define DATA_DATABASE_PREPARED_WRITER_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Creates, updates and deletes records using prepared statements and bound parameters
+ *
+ *  This is the back end of the data_database_writer_t:
+ *  Each write operation has an own sql statement which is parsed once when the database is opened
+ *  and reused for every record; the values are bound as parameters and need not be sql-escaped.
+ *
+ *  Note: These methods are not thread-safe. Locking and transactions are needed by caller.
+ */
+
+#include "storage/data_database.h"
+#include "entity/data_diagram.h"
+#include "entity/data_classifier.h"
+#include "entity/data_diagramelement.h"
+#include "entity/data_feature.h"
+#include "entity/data_relationship.h"
+#include "entity/data_table.h"
+#include "entity/data_row.h"
+#include "u8/u8_error.h"
+#include <sqlite3.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ *  \brief enumeration of the columns that can be updated, one prepared statement each
+ */
+enum data_database_prepared_writer_column_enum {
+    DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_PARENT_ID = 0,
+    DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_TYPE,
+    DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_STEREOTYPE,
+    DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_NAME,
+    DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_DESCRIPTION,
+    DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_LIST_ORDER,
+    DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_MAIN_TYPE,
+    DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_STEREOTYPE,
+    DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_NAME,
+    DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_DESCRIPTION,
+    DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_X_ORDER,
+    DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_Y_ORDER,
+    DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_LIST_ORDER,
+    DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAMELEMENT_DISPLAY_FLAGS,
+    DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAMELEMENT_FOCUSED_FEATURE_ID,
+    DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_MAIN_TYPE,
+    DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_KEY,
+    DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_VALUE,
+    DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_DESCRIPTION,
+    DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_LIST_ORDER,
+    DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_MAIN_TYPE,
+    DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_STEREOTYPE,
+    DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_NAME,
+    DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_DESCRIPTION,
+    DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_LIST_ORDER,
+    DATA_DATABASE_PREPARED_WRITER_COL_MAX,  /*!< number of updatable columns */
+};
+
+typedef enum data_database_prepared_writer_column_enum data_database_prepared_writer_column_t;
+
+/*!
+ *  \brief all data attributes needed for the prepared-statement write functions
+ */
+struct data_database_prepared_writer_struct {
+    data_database_t *database;  /*!< pointer to external database */
+
+    sqlite3_stmt *statement_create_diagram;
+    sqlite3_stmt *statement_create_classifier;
+    sqlite3_stmt *statement_create_diagramelement;
+    sqlite3_stmt *statement_create_feature;
+    sqlite3_stmt *statement_create_relationship;
+
+    sqlite3_stmt *statement_delete_diagram;
+    sqlite3_stmt *statement_delete_classifier;
+    sqlite3_stmt *statement_delete_diagramelement;
+    sqlite3_stmt *statement_delete_feature;
+    sqlite3_stmt *statement_delete_relationship;
+
+    sqlite3_stmt *statement_update[DATA_DATABASE_PREPARED_WRITER_COL_MAX];  /*!< one update statement per column */
+
+    bool statement_borrowed;  /*!< flag that indicates if one of the statements is currently executed */
+};
+
+typedef struct data_database_prepared_writer_struct data_database_prepared_writer_t;
+
+/*!
+ *  \brief initializes the data_database_prepared_writer_t struct and prepares all statements
+ *
+ *  This object shall be initialized only after opening the database.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param database database which this writer uses
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_AT_DB if a statement could not be prepared
+ */
+u8_error_t data_database_prepared_writer_init ( data_database_prepared_writer_t *this_, data_database_t *database );
+
+/*!
+ *  \brief destroys the data_database_prepared_writer_t struct and finalizes all statements
+ *
+ *  This object shall be destroyed before closing the database.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t data_database_prepared_writer_destroy ( data_database_prepared_writer_t *this_ );
+
+/* ================================ CREATE ================================ */
+
+/*!
+ *  \brief inserts a new diagram record
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param diagram data of the new diagram record. The id should be DATA_ROW_VOID unless a diagram with known, unique id shall be created.
+ *  \param[out] out_new_id storage, where the id of the newly created record is stored. NULL if the id shall not be returned.
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_DUPLICATE if a key is not unique, U8_ERROR_READ_ONLY_DB if read only
+ */
+u8_error_t data_database_prepared_writer_create_diagram ( data_database_prepared_writer_t *this_,
+                                                          const data_diagram_t *diagram,
+                                                          data_row_t* out_new_id
+                                                        );
+
+/*!
+ *  \brief inserts a new classifier record
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param classifier data of the new classifier record. The id should be DATA_ROW_VOID unless a classifier with known, unique id shall be created.
+ *  \param[out] out_new_id storage, where the id of the newly created record is stored. NULL if the id shall not be returned.
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_DUPLICATE if a key or the name is not unique, U8_ERROR_READ_ONLY_DB if read only
+ */
+u8_error_t data_database_prepared_writer_create_classifier ( data_database_prepared_writer_t *this_,
+                                                             const data_classifier_t *classifier,
+                                                             data_row_t* out_new_id
+                                                           );
+
+/*!
+ *  \brief inserts a new diagramelement record
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param diagramelement data of the new diagramelement record. The id should be DATA_ROW_VOID unless a diagramelement with known, unique id shall be created.
+ *  \param[out] out_new_id storage, where the id of the newly created record is stored. NULL if the id shall not be returned.
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_DUPLICATE if a key is not unique, U8_ERROR_READ_ONLY_DB if read only
+ */
+u8_error_t data_database_prepared_writer_create_diagramelement ( data_database_prepared_writer_t *this_,
+                                                                 const data_diagramelement_t *diagramelement,
+                                                                 data_row_t* out_new_id
+                                                               );
+
+/*!
+ *  \brief inserts a new feature record
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param feature data of the new feature record. The id should be DATA_ROW_VOID unless a feature with known, unique id shall be created.
+ *  \param[out] out_new_id storage, where the id of the newly created record is stored. NULL if the id shall not be returned.
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_DUPLICATE if a key is not unique, U8_ERROR_READ_ONLY_DB if read only
+ */
+u8_error_t data_database_prepared_writer_create_feature ( data_database_prepared_writer_t *this_,
+                                                          const data_feature_t *feature,
+                                                          data_row_t* out_new_id
+                                                        );
+
+/*!
+ *  \brief inserts a new relationship record
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param relationship data of the new relationship record. The id should be DATA_ROW_VOID unless a relationship with known, unique id shall be created.
+ *  \param[out] out_new_id storage, where the id of the newly created record is stored. NULL if the id shall not be returned.
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_DUPLICATE if a key is not unique, U8_ERROR_READ_ONLY_DB if read only
+ */
+u8_error_t data_database_prepared_writer_create_relationship ( data_database_prepared_writer_t *this_,
+                                                               const data_relationship_t *relationship,
+                                                               data_row_t* out_new_id
+                                                             );
+
+/* ================================ DELETE ================================ */
+
+/*!
+ *  \brief deletes a record
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param table table of the record, one of DATA_TABLE_DIAGRAM, DATA_TABLE_CLASSIFIER, DATA_TABLE_DIAGRAMELEMENT,
+ *               DATA_TABLE_FEATURE, DATA_TABLE_RELATIONSHIP
+ *  \param obj_id id of the record to delete
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_READ_ONLY_DB if read only, U8_ERROR_AT_DB otherwise
+ */
+u8_error_t data_database_prepared_writer_delete ( data_database_prepared_writer_t *this_, data_table_t table, data_row_t obj_id );
+
+/* ================================ UPDATE ================================ */
+
+/*!
+ *  \brief updates an integer column of a record
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param column the column to update, e.g. DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_X_ORDER
+ *  \param obj_id id of the record to update
+ *  \param new_value new value of the column
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_READ_ONLY_DB if read only, U8_ERROR_AT_DB otherwise
+ */
+u8_error_t data_database_prepared_writer_update_int ( data_database_prepared_writer_t *this_,
+                                                      data_database_prepared_writer_column_t column,
+                                                      data_row_t obj_id,
+                                                      int64_t new_value
+                                                    );
+
+/*!
+ *  \brief updates a reference column of a record; DATA_ROW_VOID is stored as NULL
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param column the column to update, e.g. DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_PARENT_ID
+ *  \param obj_id id of the record to update
+ *  \param new_ref_id new id to which the column refers, DATA_ROW_VOID if none
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_READ_ONLY_DB if read only, U8_ERROR_AT_DB otherwise
+ */
+u8_error_t data_database_prepared_writer_update_ref ( data_database_prepared_writer_t *this_,
+                                                      data_database_prepared_writer_column_t column,
+                                                      data_row_t obj_id,
+                                                      data_row_t new_ref_id
+                                                    );
+
+/*!
+ *  \brief updates a text column of a record
+ *
+ *  A text that is longer than max_length is shortened and stored nonetheless.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param column the column to update, e.g. DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_NAME
+ *  \param obj_id id of the record to update
+ *  \param new_text new 0-terminated value of the column
+ *  \param max_length maximum length of the column value in bytes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_STRING_BUFFER_EXCEEDED if the text was shortened,
+ *          U8_ERROR_DUPLICATE_NAME if the name is not unique, U8_ERROR_READ_ONLY_DB if read only, U8_ERROR_AT_DB otherwise
+ */
+u8_error_t data_database_prepared_writer_update_text ( data_database_prepared_writer_t *this_,
+                                                       data_database_prepared_writer_column_t column,
+                                                       data_row_t obj_id,
+                                                       const char *new_text,
+                                                       size_t max_length
+                                                     );
+
+/* ================================ private ================================ */
+
+/*!
+ *  \brief binds an id to a statement parameter; DATA_ROW_VOID is bound as NULL
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param statement_ptr pointer to a statement object
+ *  \param index index of the sql parameter, the leftmost parameter has index 1
+ *  \param id id to be bound
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_AT_DB otherwise
+ */
+static inline u8_error_t data_database_prepared_writer_private_bind_id ( data_database_prepared_writer_t *this_,
+                                                                         sqlite3_stmt *statement_ptr,
+                                                                         int index,
+                                                                         data_row_t id
+                                                                       );
+
+/*!
+ *  \brief binds an integer to a statement parameter
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param statement_ptr pointer to a statement object
+ *  \param index index of the sql parameter, the leftmost parameter has index 1
+ *  \param value integer to be bound
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_AT_DB otherwise
+ */
+static inline u8_error_t data_database_prepared_writer_private_bind_int ( data_database_prepared_writer_t *this_,
+                                                                          sqlite3_stmt *statement_ptr,
+                                                                          int index,
+                                                                          int64_t value
+                                                                        );
+
+/*!
+ *  \brief binds a text to a statement parameter
+ *
+ *  The text is not copied, it must stay valid till the statement is executed.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param statement_ptr pointer to a statement object
+ *  \param index index of the sql parameter, the leftmost parameter has index 1
+ *  \param text text to be bound, need not be 0-terminated
+ *  \param length length of the text in bytes, -1 if the text is 0-terminated
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_AT_DB otherwise
+ */
+static inline u8_error_t data_database_prepared_writer_private_bind_text ( data_database_prepared_writer_t *this_,
+                                                                           sqlite3_stmt *statement_ptr,
+                                                                           int index,
+                                                                           const char *text,
+                                                                           int length
+                                                                         );
+
+/*!
+ *  \brief executes a bound statement, then resets it and clears the bindings
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param statement_ptr pointer to a statement object
+ *  \param constraint_error error code to return if a UNIQUE constraint fails
+ *  \param[out] out_new_id storage, where the id of the newly created record is stored. NULL if the id shall not be returned.
+ *  \return U8_ERROR_NONE in case of success, constraint_error if a key is not unique, U8_ERROR_READ_ONLY_DB if read only
+ */
+u8_error_t data_database_prepared_writer_private_step ( data_database_prepared_writer_t *this_,
+                                                        sqlite3_stmt *statement_ptr,
+                                                        u8_error_t constraint_error,
+                                                        data_row_t* out_new_id
+                                                      );
+
+#include "storage/data_database_prepared_writer.inl"
+
+#endif  /* DATA_DATABASE_PREPARED_WRITER_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,89 @@
+/* File: data_database_prepared_writer.inl; Copyright and License: see below */
+
+#include "u8/u8_log.h"
+#include "u8/u8_trace.h"
+#include <assert.h>
+
+/* ================================ private ================================ */
+
+static inline u8_error_t data_database_prepared_writer_private_bind_id ( data_database_prepared_writer_t *this_,
+                                                                         sqlite3_stmt *statement_ptr,
+                                                                         int index,
+                                                                         data_row_t id )
+{
+    assert( NULL != statement_ptr );
+    u8_error_t result = U8_ERROR_NONE;
+    int sqlite_err;
+
+    /* NULL lets sqlite choose a new id for the primary key, NULL is also the value of an unset foreign key */
+    sqlite_err
+        = ( DATA_ROW_VOID == id )
+        ? sqlite3_bind_null( statement_ptr, index )
+        : sqlite3_bind_int64( statement_ptr, index, id );
+    if ( SQLITE_OK != sqlite_err )
+    {
+        U8_LOG_ERROR_INT( "sqlite3_bind_int64() failed:", sqlite_err );
+        result |= U8_ERROR_AT_DB;
+    }
+
+    return result;
+}
+
+static inline u8_error_t data_database_prepared_writer_private_bind_int ( data_database_prepared_writer_t *this_,
+                                                                          sqlite3_stmt *statement_ptr,
+                                                                          int index,
+                                                                          int64_t value )
+{
+    assert( NULL != statement_ptr );
+    u8_error_t result = U8_ERROR_NONE;
+    int sqlite_err;
+
+    sqlite_err = sqlite3_bind_int64( statement_ptr, index, value );
+    if ( SQLITE_OK != sqlite_err )
+    {
+        U8_LOG_ERROR_INT( "sqlite3_bind_int64() failed:", sqlite_err );
+        result |= U8_ERROR_AT_DB;
+    }
+
+    return result;
+}
+
+static inline u8_error_t data_database_prepared_writer_private_bind_text ( data_database_prepared_writer_t *this_,
+                                                                           sqlite3_stmt *statement_ptr,
+                                                                           int index,
+                                                                           const char *text,
+                                                                           int length )
+{
+    assert( NULL != statement_ptr );
+    assert( NULL != text );
+    u8_error_t result = U8_ERROR_NONE;
+    int sqlite_err;
+
+    /* SQLITE_STATIC vs SQLITE_TRANSIENT: The statement is executed before the data object is modified again. */
+    /* This is guaranteed by data_database_prepared_writer_private_step being called in the same function. */
+    sqlite_err = sqlite3_bind_text( statement_ptr, index, text, length, SQLITE_STATIC );
+    if ( SQLITE_OK != sqlite_err )
+    {
+        U8_LOG_ERROR_INT( "sqlite3_bind_text() failed:", sqlite_err );
+        result |= U8_ERROR_AT_DB;
+    }
+
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,50 @@
+/* File: data_database_profile.h; Copyright and License: see below */
+
+#ifndef DATA_DATABASE_PROFILE_H
+#define DATA_DATABASE_PROFILE_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Provides an enumeration for sqlite3 storage profiles: durable, working copy, scratch
+ */
+
+/*!
+ *  \brief enumeration of storage profiles which are applied to a database connection when opened
+ *
+ *  All profiles use the same page cache size, memory map size and in-memory temporary tables;
+ *  they differ in the journal mode and in how often the file is synchronized to disk.
+ *
+ *  Read-only and in-memory databases keep their journal mode, only the cache settings are applied.
+ */
+enum data_database_profile_enum {
+    DATA_DATABASE_PROFILE_DURABLE,  /*!< rollback journal, synchronous=FULL: every commit is synchronized to disk. */
+                                    /*!< Use this if the sqlite3 file is the only copy of the data. */
+    DATA_DATABASE_PROFILE_WORKING_COPY,  /*!< write-ahead log, synchronous=NORMAL: commits do not wait for fsync, */
+                                         /*!< the file survives a crash of the program; after a power loss, */
+                                         /*!< the last commits may be lost. Use this if the data is also stored elsewhere, */
+                                         /*!< e.g. the .tmp-cfu file of a .cfuJ json file. */
+    DATA_DATABASE_PROFILE_SCRATCH,  /*!< journal in memory, synchronous=OFF: fastest, */
+                                    /*!< a crash during a transaction may corrupt the file. */
+};
+
+typedef enum data_database_profile_enum data_database_profile_t;
+
+#endif  /* DATA_DATABASE_PROFILE_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -91,6 +91,14 @@ static inline bool data_database_reader_is_open( data_database_reader_t *this_ )
  */
 static inline data_revision_t data_database_reader_get_revision ( data_database_reader_t *this_ );
 
+/*!
+ *  \brief gets the filename of the database file
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return NULL if the database is not open or is in memory only, the filename otherwise
+ */
+static inline const char *data_database_reader_get_filename_ptr ( data_database_reader_t *this_ );
+
 /* ================================ DIAGRAM ================================ */
 
 /*!
@@ -14,6 +14,11 @@ static inline data_revision_t data_database_reader_get_revision ( data_database_
     return data_database_get_revision( (*this_).database );
 }
 
+static inline const char *data_database_reader_get_filename_ptr ( data_database_reader_t *this_ )
+{
+    return data_database_is_file( (*this_).database ) ? data_database_get_filename_ptr( (*this_).database ) : NULL;
+}
+
 /* ================================ DIAGRAM ================================ */
 
 static inline u8_error_t data_database_reader_get_diagram_by_id( data_database_reader_t *this_,
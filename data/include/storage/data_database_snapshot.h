@@ -0,0 +1,121 @@
+/* File: data_database_snapshot.h; Copyright and License: see below */
+
+#ifndef DATA_DATABASE_SNAPSHOT_H
+#define DATA_DATABASE_SNAPSHOT_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Provides a read-only connection to a database file and a reader on it for a background thread.
+ *
+ *  A snapshot can be pinned: While pinned, all queries of the reader see the database
+ *  as it was when the snapshot was pinned, changes committed by the editor afterwards are not visible.
+ *  If the database file uses the write-ahead log (see DATA_DATABASE_PROFILE_WORKING_COPY),
+ *  a pinned snapshot does not block the editor from committing changes.
+ */
+
+#include "storage/data_database.h"
+#include "storage/data_database_reader.h"
+#include "u8/u8_error.h"
+#include <stdbool.h>
+
+/*!
+ *  \brief all data attributes needed for the snapshot functions
+ *
+ *  Lifecycle: data_database_snapshot_init and data_database_snapshot_destroy shall be called
+ *  by the thread that owns the editor's database because opening and closing a database notifies listeners.
+ *  In between, the reader may be used by one other thread at a time.
+ */
+struct data_database_snapshot_struct {
+    data_database_t connection;  /*!< own read-only connection to the database file */
+    data_database_reader_t reader;  /*!< reader on the own connection */
+    bool is_pinned;  /*!< true while a read transaction keeps the snapshot */
+};
+
+typedef struct data_database_snapshot_struct data_database_snapshot_t;
+
+/*!
+ *  \brief initializes the data_database_snapshot_t struct and opens a read-only connection
+ *
+ *  If the connection cannot be opened, the snapshot is initialized nonetheless:
+ *  its reader then returns U8_ERROR_NO_DB on every query.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param db_file_path path of the database file, e.g. from data_database_get_filename_ptr()
+ *  \return U8_ERROR_NO_DB if the file cannot be opened, U8_ERROR_NONE in case of success
+ */
+u8_error_t data_database_snapshot_init ( data_database_snapshot_t *this_, const char *db_file_path );
+
+/*!
+ *  \brief releases a pinned snapshot, closes the connection and destroys the data_database_snapshot_t struct
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t data_database_snapshot_destroy ( data_database_snapshot_t *this_ );
+
+/*!
+ *  \brief starts a read transaction so that all following queries see the same state of the database
+ *
+ *  A snapshot is only pinned if the database file uses the write-ahead log:
+ *  In rollback-journal mode, a long read transaction would block the editor from committing.
+ *  Then, the reader sees the current state at each query and data_database_snapshot_is_pinned() returns false.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NO_DB if the connection is not open, U8_ERROR_INVALID_REQUEST if already pinned,
+ *          U8_ERROR_AT_DB if the read transaction could not be started, U8_ERROR_NONE otherwise
+ */
+u8_error_t data_database_snapshot_pin ( data_database_snapshot_t *this_ );
+
+/*!
+ *  \brief ends the read transaction of a pinned snapshot, the next queries see the current state
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success or if not pinned
+ */
+u8_error_t data_database_snapshot_release ( data_database_snapshot_t *this_ );
+
+/*!
+ *  \brief checks if a read transaction keeps the snapshot
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if the snapshot is pinned
+ */
+static inline bool data_database_snapshot_is_pinned ( const data_database_snapshot_t *this_ );
+
+/*!
+ *  \brief gets the reader on the own connection
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return pointer to the reader, which may be passed to all functions that expect a data_database_reader_t
+ */
+static inline data_database_reader_t *data_database_snapshot_get_reader_ptr ( data_database_snapshot_t *this_ );
+
+/*!
+ *  \brief gets the own read-only connection
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return pointer to the connection, e.g. to create a data_database_text_search_t on it
+ */
+static inline data_database_t *data_database_snapshot_get_database_ptr ( data_database_snapshot_t *this_ );
+
+#include "storage/data_database_snapshot.inl"
+
+#endif  /* DATA_DATABASE_SNAPSHOT_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
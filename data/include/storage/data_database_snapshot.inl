@@ -1,13 +1,23 @@
-/* File: data_database_sql_builder.inl; Copyright and License: see below */
+/* File: data_database_snapshot.inl; Copyright and License: see below */
 
-static inline char* data_database_sql_builder_get_string_ptr ( data_database_sql_builder_t *this_ )
+static inline bool data_database_snapshot_is_pinned ( const data_database_snapshot_t *this_ )
 {
-    return &((*this_).private_sql_buffer[0]);
+    return (*this_).is_pinned;
+}
+
+static inline data_database_reader_t *data_database_snapshot_get_reader_ptr ( data_database_snapshot_t *this_ )
+{
+    return &((*this_).reader);
+}
+
+static inline data_database_t *data_database_snapshot_get_database_ptr ( data_database_snapshot_t *this_ )
+{
+    return &((*this_).connection);
 }
 
 
 /*
-Copyright 2016-2026 Andreas Warnke
+Copyright 2026-2026 Andreas Warnke
 
 Licensed under the Apache License, Version 2.0 (the "License");
 you may not use this file except in compliance with the License.
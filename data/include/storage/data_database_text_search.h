@@ -45,6 +45,18 @@ struct data_database_text_search_struct {
     bool statement_relationship_borrowed;  /*!< flag that indicates if the statement is borrowed by an iterator */
     char temp_like_search_buf [288];  /*!< escaped like search string which is passed to the sqlite database */
 
+    bool search_index_requested;  /*!< true if the full-text search index was requested since opening, valid while is_open */
+    bool search_index_is_open;  /*!< the match statements are only initialized if the database provides a full-text search index */
+    sqlite3_stmt *statement_diagram_ids_by_match;  /*!< retrieves rows matching the words in the full-text search index */
+    sqlite3_stmt *statement_classifier_ids_by_match;  /*!< retrieves rows matching the words in the full-text search index */
+    sqlite3_stmt *statement_feature_ids_by_match;  /*!< retrieves rows matching the words in the full-text search index */
+    sqlite3_stmt *statement_relationship_ids_by_match;  /*!< retrieves rows matching the words in the full-text search index */
+    bool statement_diagram_match_borrowed;  /*!< flag that indicates if the statement is borrowed by an iterator */
+    bool statement_classifier_match_borrowed;  /*!< flag that indicates if the statement is borrowed by an iterator */
+    bool statement_feature_match_borrowed;  /*!< flag that indicates if the statement is borrowed by an iterator */
+    bool statement_relationship_match_borrowed;  /*!< flag that indicates if the statement is borrowed by an iterator */
+    char temp_match_search_buf [384];  /*!< fts5 match expression which is passed to the sqlite database */
+
     data_database_listener_t me_as_listener;  /*!< own instance of data_database_listener_t which wraps data_database_text_search_db_change_callback */
 };
 
@@ -88,6 +100,12 @@ static inline bool data_database_text_search_is_open( data_database_text_search_
 /*!
  *  \brief reads all search_results from the database.
  *
+ *  If the textfragment consists of words only (letters, digits, non-ascii characters separated by whitespace)
+ *  and the database provides a full-text search index,
+ *  objects containing all words (or words starting with these) are returned, ranked by relevance.
+ *  If the index finds nothing or the textfragment contains other characters,
+ *  objects containing the textfragment as substring are returned.
+ *
  *  \param this_ pointer to own object attributes
  *  \param textfragment text pattern for the objects which to search in the database, plain utf8 encoded
  *  \param[in,out] io_search_result_iterator iterator over search_resultss. The caller is responsible
@@ -118,7 +136,67 @@ u8_error_t data_database_text_search_private_open ( data_database_text_search_t
  */
 u8_error_t data_database_text_search_private_close ( data_database_text_search_t *this_ );
 
-#if 0
+/*!
+ *  \brief requests the full-text search index of the database and prepares the statements to search it
+ *
+ *  This is called once at the first search after opening the database:
+ *  Connections that are never searched do not create and maintain an index.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE if the index can be searched, U8_ERROR_NOT_FOUND if the search falls back to LIKE
+ */
+u8_error_t data_database_text_search_private_open_search_index ( data_database_text_search_t *this_ );
+
+/*!
+ *  \brief searches objects containing the textfragment as substring
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param textfragment text pattern for the objects which to search in the database, plain utf8 encoded
+ *  \param[in,out] io_search_result_iterator iterator over search_results, re-initialized by this function
+ *  \return U8_ERROR_NONE in case of success, an error code in case of error.
+ */
+u8_error_t data_database_text_search_private_get_objects_by_like ( data_database_text_search_t *this_,
+                                                                   const char *textfragment,
+                                                                   data_search_result_iterator_t *io_search_result_iterator
+                                                                 );
+
+/*!
+ *  \brief searches objects in the full-text search index by the match expression in temp_match_search_buf
+ *
+ *  The same query also searches the textfragment as substring.
+ *  Hits of the index are ranked first, other substring matches follow; no object is reported twice.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param textfragment text pattern for the objects which to search in the database, plain utf8 encoded
+ *  \param[in,out] io_search_result_iterator iterator over search_results, re-initialized by this function
+ *  \return U8_ERROR_NONE in case of success, an error code in case of error.
+ */
+u8_error_t data_database_text_search_private_get_objects_by_match ( data_database_text_search_t *this_,
+                                                                    const char *textfragment,
+                                                                    data_search_result_iterator_t *io_search_result_iterator
+                                                                  );
+
+/*!
+ *  \brief converts a textfragment to an escaped LIKE pattern in temp_like_search_buf
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param textfragment text pattern, plain utf8 encoded
+ *  \return U8_ERROR_NONE in case of success, an error code if the pattern does not fit into the buffer
+ */
+u8_error_t data_database_text_search_private_build_like_pattern ( data_database_text_search_t *this_, const char *textfragment );
+
+/*!
+ *  \brief converts a textfragment to a fts5 match expression in temp_match_search_buf
+ *
+ *  Each word is quoted and becomes a prefix query, e.g. <code>blue sto</code> becomes <code>"blue"* "sto"*</code>.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param textfragment text pattern, plain utf8 encoded
+ *  \return true if the textfragment consists of at least one word and no other characters than words and whitespace,
+ *          false if the textfragment shall be searched by LIKE
+ */
+bool data_database_text_search_private_build_match_query ( data_database_text_search_t *this_, const char *textfragment );
+
 /*!
  *  \brief binds two strings to a prepared statement (after reset).
  *
@@ -135,7 +213,6 @@ static inline u8_error_t data_database_text_search_private_bind_two_texts_to_sta
                                                                                          const char *text_1,
                                                                                          const char *text_2
                                                                                        );
-#endif
 
 /*!
  *  \brief binds three strings to a prepared statement (after reset).
@@ -13,7 +13,6 @@ static inline bool data_database_text_search_is_open( data_database_text_search_
 
 /* ================================ private ================================ */
 
-#if 0
 static inline u8_error_t data_database_text_search_private_bind_two_texts_to_statement ( data_database_text_search_t *this_,
                                                                                          sqlite3_stmt *statement_ptr,
                                                                                          const char *text_1,
@@ -54,7 +53,6 @@ static inline u8_error_t data_database_text_search_private_bind_two_texts_to_sta
 
     return result;
 }
-#endif
 
 static inline u8_error_t data_database_text_search_private_bind_three_texts_to_statement ( data_database_text_search_t *this_,
                                                                                            sqlite3_stmt *statement_ptr,
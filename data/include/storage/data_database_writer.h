@@ -15,7 +15,7 @@
 #include "storage/data_database_listener_signal.h"
 #include "storage/data_database.h"
 #include "storage/data_database_reader.h"
-#include "storage/data_database_sql_builder.h"
+#include "storage/data_database_prepared_writer.h"
 #include "entity/data_diagram.h"
 #include "u8/u8_error.h"
 #include "entity/data_classifier.h"
@@ -36,7 +36,9 @@ struct data_database_writer_struct {
     data_database_t *database;  /*!< pointer to external database */
     data_database_reader_t *db_reader;  /*!< pointer to external database reader which may be queried within write-transactions */
 
-    data_database_sql_builder_t sql_builder; /*!< own instance of an object that builds sql strings */
+    bool is_open;  /*!< the prepared statements are only initialized if the database is open */
+    data_database_prepared_writer_t temp_prepared_writer;  /*!< own instance of prepared write statements, initialized while the database is open */
+    bool bulk_mode;  /*!< true if the caller holds an outer transaction and records are created without own transactions */
 
     data_database_listener_t me_as_listener;  /*!< own instance of data_database_listener_t which wraps data_database_writer_db_change_callback */
 };
@@ -78,6 +80,34 @@ void data_database_writer_db_change_callback ( data_database_writer_t *this_, da
  */
 void data_database_writer_set_revision ( data_database_writer_t *this_, data_revision_t revision );
 
+/*!
+ *  \brief starts the bulk mode in which new records are created without an own transaction each
+ *
+ *  The bulk mode speeds up the creation of many records, e.g. when importing a file.
+ *  It shall be started within an outer transaction (see data_database_transaction_begin)
+ *  and ended by data_database_writer_end_bulk_mode before committing this transaction.
+ *  While in bulk mode, the full-text search index (if requested by a searcher) is not updated per record.
+ *  The secondary indices on uuid and foreign-key columns are kept up to date per record:
+ *  the importer looks up each element by uuid and the consistency checks query by foreign keys
+ *  while still in bulk mode; without the indices, each of these queries would scan its whole table.
+ *  Recreating them afterwards would also cost a pass over all records, even when pasting a few elements.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_INVALID_REQUEST if already in bulk mode,
+ *          U8_ERROR_NO_DB if the database is not open
+ */
+u8_error_t data_database_writer_begin_bulk_mode ( data_database_writer_t *this_ );
+
+/*!
+ *  \brief ends the bulk mode, records are created in own transactions again
+ *
+ *  The full-text search index is refilled once.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_INVALID_REQUEST if not in bulk mode
+ */
+u8_error_t data_database_writer_end_bulk_mode ( data_database_writer_t *this_ );
+
 /* ================================ DIAGRAM ================================ */
 
 /*!
@@ -471,6 +501,82 @@ u8_error_t data_database_writer_update_relationship_description ( data_database_
  */
 u8_error_t data_database_writer_update_relationship_list_order ( data_database_writer_t *this_, data_row_t relationship_id, int32_t new_relationship_list_order, data_relationship_t *out_old_relationship );
 
+/* ================================ private ================================ */
+
+/*!
+ *  \brief initializes the prepared write statements of the opened database
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_AT_DB if a statement cannot be prepared
+ */
+u8_error_t data_database_writer_private_open ( data_database_writer_t *this_ );
+
+/*!
+ *  \brief finalizes the prepared write statements before the database is closed
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t data_database_writer_private_close ( data_database_writer_t *this_ );
+
+/*!
+ *  \brief deletes a record, must be called within a transaction
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param table table of the record
+ *  \param obj_id id of the record
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_NO_DB if the database is not open
+ */
+u8_error_t data_database_writer_private_delete ( data_database_writer_t *this_, data_table_t table, data_row_t obj_id );
+
+/*!
+ *  \brief updates an integer column of a record, must be called within a transaction
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param column the column to update
+ *  \param obj_id id of the record
+ *  \param new_value new value of the column
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_NO_DB if the database is not open
+ */
+u8_error_t data_database_writer_private_update_int ( data_database_writer_t *this_,
+                                                     data_database_prepared_writer_column_t column,
+                                                     data_row_t obj_id,
+                                                     int64_t new_value
+                                                   );
+
+/*!
+ *  \brief updates a reference column of a record, must be called within a transaction
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param column the column to update
+ *  \param obj_id id of the record
+ *  \param new_ref_id id of the referenced record, DATA_ROW_VOID is stored as NULL
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_NO_DB if the database is not open
+ */
+u8_error_t data_database_writer_private_update_ref ( data_database_writer_t *this_,
+                                                     data_database_prepared_writer_column_t column,
+                                                     data_row_t obj_id,
+                                                     data_row_t new_ref_id
+                                                   );
+
+/*!
+ *  \brief updates a text column of a record, must be called within a transaction
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param column the column to update
+ *  \param obj_id id of the record
+ *  \param new_text new text of the column
+ *  \param max_length maximum number of bytes to store, longer texts are shortened
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_STRING_BUFFER_EXCEEDED if the text was shortened,
+ *          U8_ERROR_NO_DB if the database is not open
+ */
+u8_error_t data_database_writer_private_update_text ( data_database_writer_t *this_,
+                                                      data_database_prepared_writer_column_t column,
+                                                      data_row_t obj_id,
+                                                      const char *new_text,
+                                                      size_t max_length
+                                                    );
+
 #endif  /* DATA_DATABASE_WRITER_H */
 
 
@@ -70,6 +70,30 @@ extern const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_FEATURE_BY_TEXTFRAGM
  */
 extern const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_RELATIONSHIP_BY_TEXTFRAGMENT;
 
+/*!
+ *  \brief predefined search statement to find search_results by a fts5 match expression, ranked by relevance,
+ *         followed by further substring matches of a LIKE pattern
+ */
+extern const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_DIAGRAM_BY_SEARCH_INDEX;
+
+/*!
+ *  \brief predefined search statement to find search_results by a fts5 match expression, ranked by relevance,
+ *         followed by further substring matches of a LIKE pattern
+ */
+extern const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_CLASSIFIER_BY_SEARCH_INDEX;
+
+/*!
+ *  \brief predefined search statement to find search_results by a fts5 match expression, ranked by relevance,
+ *         followed by further substring matches of a LIKE pattern
+ */
+extern const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_FEATURE_BY_SEARCH_INDEX;
+
+/*!
+ *  \brief predefined search statement to find search_results by a fts5 match expression, ranked by relevance,
+ *         followed by further substring matches of a LIKE pattern
+ */
+extern const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_RELATIONSHIP_BY_SEARCH_INDEX;
+
 /*!
  *  \brief initializes the data_search_result_iterator_t struct to an empty set
  *
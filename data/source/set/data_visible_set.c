@@ -3,6 +3,7 @@
 #include "set/data_visible_set.h"
 #include "data_rules.h"
 #include "u8/u8_trace.h"
+#include "u8/u8_log.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
@@ -14,8 +15,21 @@ void data_visible_set_init( data_visible_set_t *this_ )
 
     data_diagram_init_empty( &((*this_).diagram) );
     (*this_).visible_classifier_count = 0;
+    (*this_).visible_classifier_capacity = 0;
+    (*this_).visible_classifiers = NULL;
     (*this_).feature_count = 0;
+    (*this_).feature_capacity = 0;
+    (*this_).features = NULL;
     (*this_).relationship_count = 0;
+    (*this_).relationship_capacity = 0;
+    (*this_).relationships = NULL;
+    data_row_index_init( &((*this_).diagramelement_index) );
+    data_row_index_init( &((*this_).classifier_index) );
+    data_row_index_init( &((*this_).feature_index) );
+    data_row_index_init( &((*this_).relationship_index) );
+    (*this_).index_buffer = NULL;
+    (*this_).index_buffer_size = 0;
+    data_visible_set_private_reset_indices( this_, 0 );
 
     U8_TRACE_END();
 }
@@ -28,6 +42,7 @@ void data_visible_set_reinit( data_visible_set_t *this_ )
     data_visible_set_private_destroy_visible_classifiers( this_ );
     data_visible_set_private_destroy_features( this_ );
     data_visible_set_private_destroy_relationships( this_ );
+    data_visible_set_private_reset_indices( this_, 0 );
 
     U8_TRACE_END();
 
@@ -41,6 +56,7 @@ void data_visible_set_destroy( data_visible_set_t *this_ )
     data_visible_set_private_destroy_visible_classifiers( this_ );
     data_visible_set_private_destroy_features( this_ );
     data_visible_set_private_destroy_relationships( this_ );
+    data_visible_set_private_free_memory( this_ );
 
     U8_TRACE_END();
 }
@@ -59,6 +75,7 @@ u8_error_t data_visible_set_load( data_visible_set_t *this_, data_row_t diagram_
         data_visible_set_private_destroy_visible_classifiers( this_ );
         data_visible_set_private_destroy_features( this_ );
         data_visible_set_private_destroy_relationships( this_ );
+        data_visible_set_private_reset_indices( this_, 0 );
     }
     else
     {
@@ -66,6 +83,7 @@ u8_error_t data_visible_set_load( data_visible_set_t *this_, data_row_t diagram_
         data_visible_set_private_destroy_visible_classifiers( this_ );
         data_visible_set_private_destroy_features( this_ );
         data_visible_set_private_destroy_relationships( this_ );
+        data_visible_set_private_reset_indices( this_, 0 );
 
         data_rules_t rules;
         data_rules_init( &rules );
@@ -99,7 +117,8 @@ u8_error_t data_visible_set_load( data_visible_set_t *this_, data_row_t diagram_
             while ( data_visible_classifier_iterator_has_next( &visible_classifier_iterator )
                 && ( ! u8_error_more_than( c_err, U8_ERROR_STRING_BUFFER_EXCEEDED ) ) )
             {
-                if ( (*this_).visible_classifier_count < DATA_VISIBLE_SET_MAX_CLASSIFIERS )
+                const u8_error_t reserve_err = data_visible_set_private_reserve_classifier( this_ );
+                if ( reserve_err == U8_ERROR_NONE )
                 {
                     data_visible_classifier_t *const current_visible_classifier
                         = &((*this_).visible_classifiers[(*this_).visible_classifier_count]);
@@ -134,7 +153,8 @@ u8_error_t data_visible_set_load( data_visible_set_t *this_, data_row_t diagram_
             while ( data_feature_iterator_has_next( &feature_iterator )
                 && ( ! u8_error_more_than( f_err, U8_ERROR_STRING_BUFFER_EXCEEDED ) ) )
             {
-                if ( (*this_).feature_count < DATA_VISIBLE_SET_MAX_FEATURES )
+                const u8_error_t reserve_err = data_visible_set_private_reserve_feature( this_ );
+                if ( reserve_err == U8_ERROR_NONE )
                 {
                     data_feature_t *const current_feature = &((*this_).features[(*this_).feature_count]);
                     f_err |= data_feature_iterator_next( &feature_iterator, current_feature );
@@ -179,6 +199,9 @@ u8_error_t data_visible_set_load( data_visible_set_t *this_, data_row_t diagram_
             }
             f_err |= data_feature_iterator_destroy( &feature_iterator );
             result |= f_err;  /* collect error flags */
+
+            /* the relationship filter below looks up features by id */
+            data_visible_set_update_containment_cache( this_ );
         }
 
         /* load relationships */
@@ -194,7 +217,8 @@ u8_error_t data_visible_set_load( data_visible_set_t *this_, data_row_t diagram_
             while ( data_relationship_iterator_has_next( &rel_iterator )
                 && ( ! u8_error_more_than( r_err, U8_ERROR_STRING_BUFFER_EXCEEDED ) ) )
             {
-                if ( (*this_).relationship_count < DATA_VISIBLE_SET_MAX_RELATIONSHIPS )
+                const u8_error_t reserve_err = data_visible_set_private_reserve_relationship( this_ );
+                if ( reserve_err == U8_ERROR_NONE )
                 {
                     data_relationship_t *const current_relationship = &((*this_).relationships[(*this_).relationship_count]);
                     r_err |= data_relationship_iterator_next( &rel_iterator, current_relationship );
@@ -203,21 +227,10 @@ u8_error_t data_visible_set_load( data_visible_set_t *this_, data_row_t diagram_
                         /* Ignore relationships that have not both ends in current diagram - e.g. messages between foreign lifelines */
                         const data_row_t from_feat_row = data_relationship_get_from_feature_row( current_relationship );
                         const data_row_t to_feat_row = data_relationship_get_to_feature_row( current_relationship );
-                        bool from_known = ( from_feat_row == DATA_ROW_VOID );
-                        bool to_known = ( to_feat_row == DATA_ROW_VOID );
-                        for( uint_fast32_t f_idx = 0; f_idx < (*this_).feature_count; f_idx ++ )
-                        {
-                            const data_feature_t *const probe_feature = &((*this_).features[f_idx]);
-                            const data_row_t probe_feat_id = data_feature_get_row( probe_feature );
-                            if ( probe_feat_id == from_feat_row )
-                            {
-                                from_known = true;
-                            }
-                            if ( probe_feat_id == to_feat_row )
-                            {
-                                to_known = true;
-                            }
-                        }
+                        const bool from_known = ( from_feat_row == DATA_ROW_VOID )
+                            || ( NULL != data_visible_set_get_feature_by_id_const( this_, from_feat_row ) );
+                        const bool to_known = ( to_feat_row == DATA_ROW_VOID )
+                            || ( NULL != data_visible_set_get_feature_by_id_const( this_, to_feat_row ) );
                         if ( from_known && to_known )  /* check that both relationship ends are in this data_visible_set_t */
                         {
                             (*this_).relationship_count++;
@@ -256,8 +269,40 @@ void data_visible_set_update_containment_cache ( data_visible_set_t *this_ )
     assert( (*this_).relationship_count <= DATA_VISIBLE_SET_MAX_RELATIONSHIPS );
     assert( (*this_).visible_classifier_count <= DATA_VISIBLE_SET_MAX_CLASSIFIERS );
 
-    /* reset the containment array */
-    memset( &((*this_).containment_cache), '\0', sizeof( (*this_).containment_cache ) );
+    /* fetch the indices and the containment bit matrix anew, sized to the current numbers of elements */
+    const uint32_t count = (*this_).visible_classifier_count;
+    const size_t matrix_size = ( ( ( (size_t) count * count ) + 63 ) / 64 ) * 8;  /* keep the index_memory 8-byte aligned */
+    const size_t index_size
+        = ( 2 * data_row_index_get_memory_size( count ) )
+        + data_row_index_get_memory_size( (*this_).feature_count )
+        + data_row_index_get_memory_size( (*this_).relationship_count )
+        + matrix_size;
+    u8_error_t index_err = data_visible_set_private_reset_indices( this_, index_size );
+
+    /* update the id lookup indices, the containment search below looks up classifiers by id */
+    if ( index_err == U8_ERROR_NONE )
+    {
+        index_err |= data_visible_set_private_update_classifier_indices( this_ );
+        index_err |= data_visible_set_private_update_feature_index( this_ );
+        index_err |= data_visible_set_private_update_relationship_index( this_ );
+
+        void *matrix_block = NULL;
+        index_err |= universal_memory_arena_get_block( &((*this_).index_memory), matrix_size, &matrix_block );
+        if ( NULL != matrix_block )
+        {
+            memset( matrix_block, '\0', matrix_size );
+            (*this_).containment_cache = matrix_block;
+            (*this_).containment_size = count;
+        }
+    }
+    if ( index_err != U8_ERROR_NONE )
+    {
+        U8_LOG_WARNING( "id lookup indices not available, falling back to linear search" );
+    }
+    if ( (*this_).containment_size != count )
+    {
+        U8_LOG_ERROR( "U8_ERROR_ARRAY_BUFFER_EXCEEDED at updating the containment cache" );
+    }
 
     static const int MAX_SEARCH_PASSES = 4;  /* with 4 passes, we can find ancesters and decendants which are related via 2*4=8 links and more */
     bool new_containments_found = true;
@@ -284,7 +329,7 @@ void data_visible_set_update_containment_cache ( data_visible_set_t *this_ )
                 int32_t child_index;
                 parent_index = data_visible_set_get_classifier_index ( this_, parent_id );
                 child_index = data_visible_set_get_classifier_index ( this_, child_id );
-                if ( ( parent_index != -1 )&&( child_index != -1 ) )
+                if ( ( parent_index != -1 )&&( child_index != -1 )&&( (*this_).containment_size == count ) )
                 {
                     assert ( 0 <= parent_index );
                     assert ( parent_index < (*this_).visible_classifier_count );
@@ -292,17 +337,17 @@ void data_visible_set_update_containment_cache ( data_visible_set_t *this_ )
                     assert ( child_index < (*this_).visible_classifier_count );
 
                     /* add the current relation to the containment_cache */
-                    (*this_).containment_cache[parent_index][child_index] = true;
+                    data_visible_set_private_set_containment( this_, parent_index, child_index );
 
                     /* all ancestors of parent are ancestors of child */
                     for ( uint32_t ancestor_index = 0; ancestor_index < (*this_).visible_classifier_count; ancestor_index ++ )
                     {
-                        if ( (*this_).containment_cache[ancestor_index][parent_index] )
+                        if ( data_visible_set_private_get_containment( this_, ancestor_index, parent_index ) )
                         {
-                            if ( ! (*this_).containment_cache[ancestor_index][child_index] )
+                            if ( ! data_visible_set_private_get_containment( this_, ancestor_index, child_index ) )
                             {
                                 new_containments_found = true;
-                                (*this_).containment_cache[ancestor_index][child_index] = true;
+                                data_visible_set_private_set_containment( this_, ancestor_index, child_index );
                             }
                         }
                     }
@@ -310,12 +355,12 @@ void data_visible_set_update_containment_cache ( data_visible_set_t *this_ )
                     /* all descendants of child are descendants of parent */
                     for ( uint32_t descendant_index = 0; descendant_index < (*this_).visible_classifier_count; descendant_index ++ )
                     {
-                        if ( (*this_).containment_cache[child_index][descendant_index] )
+                        if ( data_visible_set_private_get_containment( this_, child_index, descendant_index ) )
                         {
-                            if ( ! (*this_).containment_cache[parent_index][descendant_index] )
+                            if ( ! data_visible_set_private_get_containment( this_, parent_index, descendant_index ) )
                             {
                                 new_containments_found = true;
-                                (*this_).containment_cache[parent_index][descendant_index] = true;
+                                data_visible_set_private_set_containment( this_, parent_index, descendant_index );
                             }
                         }
                     }
@@ -330,6 +375,277 @@ void data_visible_set_update_containment_cache ( data_visible_set_t *this_ )
 }
 
 
+u8_error_t data_visible_set_private_update_classifier_indices ( data_visible_set_t *this_ )
+{
+    assert( (*this_).indexed_classifier_count == 0 );
+    u8_error_t result = U8_ERROR_NONE;
+    const uint32_t count = (*this_).visible_classifier_count;
+
+    result |= data_row_index_reinit( &((*this_).diagramelement_index), count, &((*this_).index_memory) );
+    result |= data_row_index_reinit( &((*this_).classifier_index), count, &((*this_).index_memory) );
+
+    for ( uint32_t index = 0; ( index < count ) && ( result == U8_ERROR_NONE ); index ++ )
+    {
+        const data_visible_classifier_t *const visible_classifier = &((*this_).visible_classifiers[index]);
+        const data_row_t diagramelement_id
+            = data_diagramelement_get_row( data_visible_classifier_get_diagramelement_const( visible_classifier ) );
+        const data_row_t classifier_id
+            = data_classifier_get_row( data_visible_classifier_get_classifier_const( visible_classifier ) );
+
+        /* on duplicates, the index keeps the first position - same as a linear search would find */
+        if ( diagramelement_id != DATA_ROW_VOID )
+        {
+            const u8_error_t add_err = data_row_index_add( &((*this_).diagramelement_index), diagramelement_id, index );
+            result |= ( add_err == U8_ERROR_DUPLICATE_ID ) ? U8_ERROR_NONE : add_err;
+        }
+        if ( classifier_id != DATA_ROW_VOID )
+        {
+            const u8_error_t add_err = data_row_index_add( &((*this_).classifier_index), classifier_id, index );
+            result |= ( add_err == U8_ERROR_DUPLICATE_ID ) ? U8_ERROR_NONE : add_err;
+        }
+    }
+
+    /* in case of an error, the lookup functions fall back to a linear search */
+    (*this_).indexed_classifier_count = ( result == U8_ERROR_NONE ) ? count : UINT32_MAX;
+
+    return result;
+}
+
+u8_error_t data_visible_set_private_update_feature_index ( data_visible_set_t *this_ )
+{
+    assert( (*this_).indexed_feature_count == 0 );
+    u8_error_t result = U8_ERROR_NONE;
+    const uint32_t count = (*this_).feature_count;
+
+    result |= data_row_index_reinit( &((*this_).feature_index), count, &((*this_).index_memory) );
+
+    for ( uint32_t index = 0; ( index < count ) && ( result == U8_ERROR_NONE ); index ++ )
+    {
+        const data_row_t feature_id = data_feature_get_row( &((*this_).features[index]) );
+        if ( feature_id != DATA_ROW_VOID )
+        {
+            const u8_error_t add_err = data_row_index_add( &((*this_).feature_index), feature_id, index );
+            result |= ( add_err == U8_ERROR_DUPLICATE_ID ) ? U8_ERROR_NONE : add_err;
+        }
+    }
+
+    /* in case of an error, the lookup functions fall back to a linear search */
+    (*this_).indexed_feature_count = ( result == U8_ERROR_NONE ) ? count : UINT32_MAX;
+
+    return result;
+}
+
+u8_error_t data_visible_set_private_update_relationship_index ( data_visible_set_t *this_ )
+{
+    assert( (*this_).indexed_relationship_count == 0 );
+    u8_error_t result = U8_ERROR_NONE;
+    const uint32_t count = (*this_).relationship_count;
+
+    result |= data_row_index_reinit( &((*this_).relationship_index), count, &((*this_).index_memory) );
+
+    for ( uint32_t index = 0; ( index < count ) && ( result == U8_ERROR_NONE ); index ++ )
+    {
+        const data_row_t relationship_id = data_relationship_get_row( &((*this_).relationships[index]) );
+        if ( relationship_id != DATA_ROW_VOID )
+        {
+            const u8_error_t add_err = data_row_index_add( &((*this_).relationship_index), relationship_id, index );
+            result |= ( add_err == U8_ERROR_DUPLICATE_ID ) ? U8_ERROR_NONE : add_err;
+        }
+    }
+
+    /* in case of an error, the lookup functions fall back to a linear search */
+    (*this_).indexed_relationship_count = ( result == U8_ERROR_NONE ) ? count : UINT32_MAX;
+
+    return result;
+}
+
+u8_error_t data_visible_set_private_reserve_classifier ( data_visible_set_t *this_ )
+{
+    u8_error_t result = U8_ERROR_NONE;
+    const uint32_t count = (*this_).visible_classifier_count;
+    const uint32_t old_capacity = (*this_).visible_classifier_capacity;
+    assert( count <= old_capacity );
+
+    if ( count >= DATA_VISIBLE_SET_MAX_CLASSIFIERS )
+    {
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+    else if ( count == old_capacity )
+    {
+        /* double the capacity; the elements are copied because they contain pointers to their own string buffers */
+        const uint32_t doubled = ( old_capacity == 0 ) ? 8 : ( 2 * old_capacity );
+        const uint32_t new_capacity = ( doubled > DATA_VISIBLE_SET_MAX_CLASSIFIERS ) ? DATA_VISIBLE_SET_MAX_CLASSIFIERS : doubled;
+        data_visible_classifier_t *const new_array = malloc( new_capacity * sizeof(data_visible_classifier_t) );
+        if ( NULL == new_array )
+        {
+            U8_LOG_WARNING_INT( "out of memory at growing the visible_classifiers of data_visible_set_t to", new_capacity );
+            result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+        }
+        else
+        {
+            for ( uint32_t index = 0; index < count; index ++ )
+            {
+                data_visible_classifier_copy( &(new_array[index]), &((*this_).visible_classifiers[index]) );
+                data_visible_classifier_destroy( &((*this_).visible_classifiers[index]) );
+            }
+            free( (*this_).visible_classifiers );
+            (*this_).visible_classifiers = new_array;
+            (*this_).visible_classifier_capacity = new_capacity;
+        }
+    }
+
+    return result;
+}
+
+u8_error_t data_visible_set_private_reserve_feature ( data_visible_set_t *this_ )
+{
+    u8_error_t result = U8_ERROR_NONE;
+    const uint32_t count = (*this_).feature_count;
+    const uint32_t old_capacity = (*this_).feature_capacity;
+    assert( count <= old_capacity );
+
+    if ( count >= DATA_VISIBLE_SET_MAX_FEATURES )
+    {
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+    else if ( count == old_capacity )
+    {
+        /* double the capacity, copy the elements to repair the pointers to their own string buffers */
+        const uint32_t doubled = ( old_capacity == 0 ) ? 8 : ( 2 * old_capacity );
+        const uint32_t new_capacity = ( doubled > DATA_VISIBLE_SET_MAX_FEATURES ) ? DATA_VISIBLE_SET_MAX_FEATURES : doubled;
+        data_feature_t *const new_array = malloc( new_capacity * sizeof(data_feature_t) );
+        if ( NULL == new_array )
+        {
+            U8_LOG_WARNING_INT( "out of memory at growing the features of data_visible_set_t to", new_capacity );
+            result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+        }
+        else
+        {
+            for ( uint32_t index = 0; index < count; index ++ )
+            {
+                data_feature_copy( &(new_array[index]), &((*this_).features[index]) );
+                data_feature_destroy( &((*this_).features[index]) );
+            }
+            free( (*this_).features );
+            (*this_).features = new_array;
+            (*this_).feature_capacity = new_capacity;
+        }
+    }
+
+    return result;
+}
+
+u8_error_t data_visible_set_private_reserve_relationship ( data_visible_set_t *this_ )
+{
+    u8_error_t result = U8_ERROR_NONE;
+    const uint32_t count = (*this_).relationship_count;
+    const uint32_t old_capacity = (*this_).relationship_capacity;
+    assert( count <= old_capacity );
+
+    if ( count >= DATA_VISIBLE_SET_MAX_RELATIONSHIPS )
+    {
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+    else if ( count == old_capacity )
+    {
+        /* double the capacity, copy the elements to repair the pointers to their own string buffers */
+        const uint32_t doubled = ( old_capacity == 0 ) ? 8 : ( 2 * old_capacity );
+        const uint32_t new_capacity = ( doubled > DATA_VISIBLE_SET_MAX_RELATIONSHIPS ) ? DATA_VISIBLE_SET_MAX_RELATIONSHIPS : doubled;
+        data_relationship_t *const new_array = malloc( new_capacity * sizeof(data_relationship_t) );
+        if ( NULL == new_array )
+        {
+            U8_LOG_WARNING_INT( "out of memory at growing the relationships of data_visible_set_t to", new_capacity );
+            result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+        }
+        else
+        {
+            for ( uint32_t index = 0; index < count; index ++ )
+            {
+                data_relationship_copy( &(new_array[index]), &((*this_).relationships[index]) );
+                data_relationship_destroy( &((*this_).relationships[index]) );
+            }
+            free( (*this_).relationships );
+            (*this_).relationships = new_array;
+            (*this_).relationship_capacity = new_capacity;
+        }
+    }
+
+    return result;
+}
+
+u8_error_t data_visible_set_private_reset_indices ( data_visible_set_t *this_, size_t min_size )
+{
+    u8_error_t result = U8_ERROR_NONE;
+
+    (*this_).indexed_classifier_count = 0;
+    data_row_index_destroy( &((*this_).diagramelement_index) );
+    data_row_index_destroy( &((*this_).classifier_index) );
+    data_row_index_init( &((*this_).diagramelement_index) );
+    data_row_index_init( &((*this_).classifier_index) );
+    (*this_).indexed_feature_count = 0;
+    data_row_index_destroy( &((*this_).feature_index) );
+    data_row_index_init( &((*this_).feature_index) );
+    (*this_).indexed_relationship_count = 0;
+    data_row_index_destroy( &((*this_).relationship_index) );
+    data_row_index_init( &((*this_).relationship_index) );
+
+    (*this_).containment_size = 0;
+    (*this_).containment_cache = NULL;
+
+    if ( min_size > (*this_).index_buffer_size )
+    {
+        /* the old contents are not needed, free before allocating the bigger block */
+        if ( NULL != (*this_).index_buffer )
+        {
+            universal_memory_arena_destroy( &((*this_).index_memory) );
+            free( (*this_).index_buffer );
+        }
+        (*this_).index_buffer = malloc( min_size );
+        (*this_).index_buffer_size = ( NULL == (*this_).index_buffer ) ? 0 : min_size;
+        if ( NULL == (*this_).index_buffer )
+        {
+            U8_LOG_WARNING_INT( "out of memory at allocating the indices of data_visible_set_t, size:", min_size );
+            result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+        }
+        else
+        {
+            universal_memory_arena_init( &((*this_).index_memory), (*this_).index_buffer, (*this_).index_buffer_size );
+        }
+    }
+    else if ( NULL != (*this_).index_buffer )
+    {
+        universal_memory_arena_reset( &((*this_).index_memory) );
+    }
+
+    return result;
+}
+
+void data_visible_set_private_free_memory ( data_visible_set_t *this_ )
+{
+    assert( (*this_).visible_classifier_count == 0 );
+    assert( (*this_).feature_count == 0 );
+    assert( (*this_).relationship_count == 0 );
+
+    data_visible_set_private_reset_indices( this_, 0 );
+    if ( NULL != (*this_).index_buffer )
+    {
+        universal_memory_arena_destroy( &((*this_).index_memory) );
+        free( (*this_).index_buffer );
+        (*this_).index_buffer = NULL;
+        (*this_).index_buffer_size = 0;
+    }
+
+    free( (*this_).visible_classifiers );
+    (*this_).visible_classifiers = NULL;
+    (*this_).visible_classifier_capacity = 0;
+    free( (*this_).features );
+    (*this_).features = NULL;
+    (*this_).feature_capacity = 0;
+    free( (*this_).relationships );
+    (*this_).relationships = NULL;
+    (*this_).relationship_capacity = 0;
+}
+
 /*
 Copyright 2016-2026 Andreas Warnke
 
@@ -11,14 +11,21 @@
 /*
  *  The "order by cnt" is important to ensure parent objects are iterated first, e.g. for xmi export
  *  The "order by id" is important to get reproducable results
+ *  The containment parents of all classifiers are counted in one grouped aggregate, then each classifier
+ *  is looked up by its primary key: O((classifiers + relationships) * log), independent of secondary indices.
+ *  The classifiers contribute a 0 to the sum so that classifiers without parents are part of the result.
  */
 const char *const DATA_CLASSIFIER_ITERATOR_SELECT_ALL_HIERARCHICAL =
-    "SELECT id,main_type,stereotype,name,description,x_order,y_order,list_order,uuid,"
-        "(SELECT count(*) FROM relationships "
-        "WHERE (relationships.to_classifier_id=classifiers.id) AND (relationships.to_feature_id IS NULL) "
-        "AND (relationships.main_type=300)) AS cnt "
-    "FROM classifiers "
-    "ORDER BY cnt ASC,id ASC;";
+    "SELECT classifiers.id,classifiers.main_type,classifiers.stereotype,classifiers.name,classifiers.description,"
+        "classifiers.x_order,classifiers.y_order,classifiers.list_order,classifiers.uuid,parents.cnt "
+    "FROM (SELECT classifier_id,sum(is_parent) AS cnt FROM ("
+            "SELECT id AS classifier_id,0 AS is_parent FROM classifiers "
+            "UNION ALL "
+            "SELECT to_classifier_id,1 FROM relationships "
+            "WHERE (to_feature_id IS NULL) AND (main_type=300)"
+        ") GROUP BY classifier_id) AS parents "
+    "INNER JOIN classifiers ON classifiers.id=parents.classifier_id "
+    "ORDER BY parents.cnt ASC,classifiers.id ASC;";
 
 /*
  *  The "order by id" is important to get reproducable results, e.g. for json export
@@ -267,6 +267,242 @@ static const char *DATA_DATABASE_ALTER_DIAGRAMELEMENT_TABLE_UUID =
 static const char *DATA_DATABASE_UPDATE_DIAGRAMELEMENT_UUID =
     "UPDATE diagramelements SET uuid=(SELECT " DATA_DATABASE_CREATE_UUID " WHERE diagramelements.id!=-1) WHERE uuid=\'\';";
 
+/*!
+ *  \brief string constant to create the secondary indices of table classifiers
+ *
+ *  The name column is already indexed by its UNIQUE constraint.
+ *  Indices on uuid are not UNIQUE because databases of old program versions may contain duplicates.
+ *  \see https://sqlite.org/lang_createindex.html
+ */
+static const char *DATA_DATABASE_CREATE_CLASSIFIER_INDICES =
+    "CREATE INDEX IF NOT EXISTS classifiers_uuid ON classifiers(uuid);";
+
+/*!
+ *  \brief string constant to create the secondary indices of table relationships
+ *
+ *  These indices are used to find relationships by uuid and by the connected classifiers and features.
+ */
+static const char *DATA_DATABASE_CREATE_RELATIONSHIP_INDICES =
+    "CREATE INDEX IF NOT EXISTS relationships_uuid ON relationships(uuid);"
+    "CREATE INDEX IF NOT EXISTS relationships_from_classifier_id ON relationships(from_classifier_id);"
+    "CREATE INDEX IF NOT EXISTS relationships_to_classifier_id ON relationships(to_classifier_id);"
+    "CREATE INDEX IF NOT EXISTS relationships_from_feature_id ON relationships(from_feature_id);"
+    "CREATE INDEX IF NOT EXISTS relationships_to_feature_id ON relationships(to_feature_id);";
+
+/*!
+ *  \brief string constant to create the secondary indices of table features
+ *
+ *  These indices are used to find features by uuid and by their classifier.
+ */
+static const char *DATA_DATABASE_CREATE_FEATURE_INDICES =
+    "CREATE INDEX IF NOT EXISTS features_uuid ON features(uuid);"
+    "CREATE INDEX IF NOT EXISTS features_classifier_id ON features(classifier_id);";
+
+/*!
+ *  \brief string constant to create the secondary indices of table diagrams
+ *
+ *  These indices are used to find diagrams by uuid and by their parent diagram.
+ */
+static const char *DATA_DATABASE_CREATE_DIAGRAM_INDICES =
+    "CREATE INDEX IF NOT EXISTS diagrams_uuid ON diagrams(uuid);"
+    "CREATE INDEX IF NOT EXISTS diagrams_parent_id ON diagrams(parent_id);";
+
+/*!
+ *  \brief string constant to create the secondary indices of table diagramelements
+ *
+ *  These indices are used to find diagramelements by uuid, by their diagram and by their classifier.
+ */
+static const char *DATA_DATABASE_CREATE_DIAGRAMELEMENT_INDICES =
+    "CREATE INDEX IF NOT EXISTS diagramelements_uuid ON diagramelements(uuid);"
+    "CREATE INDEX IF NOT EXISTS diagramelements_diagram_id ON diagramelements(diagram_id);"
+    "CREATE INDEX IF NOT EXISTS diagramelements_classifier_id ON diagramelements(classifier_id);";
+
+/*!
+ *  \brief string constant to create and fill the full-text search index of table diagrams
+ *
+ *  The index is a fts5 virtual table in the temp schema; it is not stored in the database file.
+ *  Triggers keep the index in sync with the diagrams table, see DATA_DATABASE_CREATE_DIAGRAM_SEARCH_TRIGGERS.
+ *  If the sqlite3 library is compiled without fts5, the first statement fails.
+ *
+ *  \see https://sqlite.org/fts5.html
+ */
+static const char *DATA_DATABASE_CREATE_DIAGRAM_SEARCH_INDEX =
+    "CREATE VIRTUAL TABLE temp.diagrams_fts USING fts5(name,stereotype,description);"
+    "INSERT INTO temp.diagrams_fts(rowid,name,stereotype,description) SELECT id,name,stereotype,description FROM main.diagrams;";
+
+/*!
+ *  \brief string constant to create the triggers that keep the full-text search index of table diagrams up to date
+ */
+static const char *DATA_DATABASE_CREATE_DIAGRAM_SEARCH_TRIGGERS =
+    "CREATE TEMP TRIGGER IF NOT EXISTS diagrams_fts_insert AFTER INSERT ON main.diagrams BEGIN "
+        "INSERT INTO diagrams_fts(rowid,name,stereotype,description) VALUES (new.id,new.name,new.stereotype,new.description); "
+    "END;"
+    "CREATE TEMP TRIGGER IF NOT EXISTS diagrams_fts_update AFTER UPDATE OF id,name,stereotype,description ON main.diagrams BEGIN "
+        "DELETE FROM diagrams_fts WHERE rowid=old.id; "
+        "INSERT INTO diagrams_fts(rowid,name,stereotype,description) VALUES (new.id,new.name,new.stereotype,new.description); "
+    "END;"
+    "CREATE TEMP TRIGGER IF NOT EXISTS diagrams_fts_delete AFTER DELETE ON main.diagrams BEGIN "
+        "DELETE FROM diagrams_fts WHERE rowid=old.id; "
+    "END;";
+
+/*!
+ *  \brief string constant to create and fill the full-text search index of table classifiers
+ *
+ *  The index is a fts5 virtual table in the temp schema; it is not stored in the database file.
+ *  Triggers keep the index in sync with the classifiers table.
+ *  If the sqlite3 library is compiled without fts5, the first statement fails.
+ */
+static const char *DATA_DATABASE_CREATE_CLASSIFIER_SEARCH_INDEX =
+    "CREATE VIRTUAL TABLE temp.classifiers_fts USING fts5(name,stereotype,description);"
+    "INSERT INTO temp.classifiers_fts(rowid,name,stereotype,description) SELECT id,name,stereotype,description FROM main.classifiers;";
+
+/*!
+ *  \brief string constant to create the triggers that keep the full-text search index of table classifiers up to date
+ */
+static const char *DATA_DATABASE_CREATE_CLASSIFIER_SEARCH_TRIGGERS =
+    "CREATE TEMP TRIGGER IF NOT EXISTS classifiers_fts_insert AFTER INSERT ON main.classifiers BEGIN "
+        "INSERT INTO classifiers_fts(rowid,name,stereotype,description) VALUES (new.id,new.name,new.stereotype,new.description); "
+    "END;"
+    "CREATE TEMP TRIGGER IF NOT EXISTS classifiers_fts_update AFTER UPDATE OF id,name,stereotype,description ON main.classifiers BEGIN "
+        "DELETE FROM classifiers_fts WHERE rowid=old.id; "
+        "INSERT INTO classifiers_fts(rowid,name,stereotype,description) VALUES (new.id,new.name,new.stereotype,new.description); "
+    "END;"
+    "CREATE TEMP TRIGGER IF NOT EXISTS classifiers_fts_delete AFTER DELETE ON main.classifiers BEGIN "
+        "DELETE FROM classifiers_fts WHERE rowid=old.id; "
+    "END;";
+
+/*!
+ *  \brief string constant to create and fill the full-text search index of table features
+ *
+ *  The index is a fts5 virtual table in the temp schema; it is not stored in the database file.
+ *  Triggers keep the index in sync with the features table.
+ *  If the sqlite3 library is compiled without fts5, the first statement fails.
+ */
+static const char *DATA_DATABASE_CREATE_FEATURE_SEARCH_INDEX =
+    "CREATE VIRTUAL TABLE temp.features_fts USING fts5(key,value,description);"
+    "INSERT INTO temp.features_fts(rowid,key,value,description) SELECT id,key,value,description FROM main.features;";
+
+/*!
+ *  \brief string constant to create the triggers that keep the full-text search index of table features up to date
+ */
+static const char *DATA_DATABASE_CREATE_FEATURE_SEARCH_TRIGGERS =
+    "CREATE TEMP TRIGGER IF NOT EXISTS features_fts_insert AFTER INSERT ON main.features BEGIN "
+        "INSERT INTO features_fts(rowid,key,value,description) VALUES (new.id,new.key,new.value,new.description); "
+    "END;"
+    "CREATE TEMP TRIGGER IF NOT EXISTS features_fts_update AFTER UPDATE OF id,key,value,description ON main.features BEGIN "
+        "DELETE FROM features_fts WHERE rowid=old.id; "
+        "INSERT INTO features_fts(rowid,key,value,description) VALUES (new.id,new.key,new.value,new.description); "
+    "END;"
+    "CREATE TEMP TRIGGER IF NOT EXISTS features_fts_delete AFTER DELETE ON main.features BEGIN "
+        "DELETE FROM features_fts WHERE rowid=old.id; "
+    "END;";
+
+/*!
+ *  \brief string constant to create and fill the full-text search index of table relationships
+ *
+ *  The index is a fts5 virtual table in the temp schema; it is not stored in the database file.
+ *  Triggers keep the index in sync with the relationships table.
+ *  If the sqlite3 library is compiled without fts5, the first statement fails.
+ */
+static const char *DATA_DATABASE_CREATE_RELATIONSHIP_SEARCH_INDEX =
+    "CREATE VIRTUAL TABLE temp.relationships_fts USING fts5(name,stereotype,description);"
+    "INSERT INTO temp.relationships_fts(rowid,name,stereotype,description) SELECT id,name,stereotype,description FROM main.relationships;";
+
+/*!
+ *  \brief string constant to create the triggers that keep the full-text search index of table relationships up to date
+ */
+static const char *DATA_DATABASE_CREATE_RELATIONSHIP_SEARCH_TRIGGERS =
+    "CREATE TEMP TRIGGER IF NOT EXISTS relationships_fts_insert AFTER INSERT ON main.relationships BEGIN "
+        "INSERT INTO relationships_fts(rowid,name,stereotype,description) VALUES (new.id,new.name,new.stereotype,new.description); "
+    "END;"
+    "CREATE TEMP TRIGGER IF NOT EXISTS relationships_fts_update AFTER UPDATE OF id,name,stereotype,description ON main.relationships BEGIN "
+        "DELETE FROM relationships_fts WHERE rowid=old.id; "
+        "INSERT INTO relationships_fts(rowid,name,stereotype,description) VALUES (new.id,new.name,new.stereotype,new.description); "
+    "END;"
+    "CREATE TEMP TRIGGER IF NOT EXISTS relationships_fts_delete AFTER DELETE ON main.relationships BEGIN "
+        "DELETE FROM relationships_fts WHERE rowid=old.id; "
+    "END;";
+
+/*!
+ *  \brief string constant to remove the triggers of the full-text search index, e.g. during a bulk import
+ */
+static const char *DATA_DATABASE_DROP_SEARCH_TRIGGERS =
+    "DROP TRIGGER IF EXISTS temp.diagrams_fts_insert;"
+    "DROP TRIGGER IF EXISTS temp.diagrams_fts_update;"
+    "DROP TRIGGER IF EXISTS temp.diagrams_fts_delete;"
+    "DROP TRIGGER IF EXISTS temp.classifiers_fts_insert;"
+    "DROP TRIGGER IF EXISTS temp.classifiers_fts_update;"
+    "DROP TRIGGER IF EXISTS temp.classifiers_fts_delete;"
+    "DROP TRIGGER IF EXISTS temp.features_fts_insert;"
+    "DROP TRIGGER IF EXISTS temp.features_fts_update;"
+    "DROP TRIGGER IF EXISTS temp.features_fts_delete;"
+    "DROP TRIGGER IF EXISTS temp.relationships_fts_insert;"
+    "DROP TRIGGER IF EXISTS temp.relationships_fts_update;"
+    "DROP TRIGGER IF EXISTS temp.relationships_fts_delete;";
+
+/*!
+ *  \brief string constant to remove a partially created full-text search index
+ *
+ *  The triggers shall be dropped before: a trigger that refers to a missing index would make all changes of its table fail.
+ */
+static const char *DATA_DATABASE_DROP_SEARCH_INDEX =
+    "DROP TABLE IF EXISTS temp.diagrams_fts;"
+    "DROP TABLE IF EXISTS temp.classifiers_fts;"
+    "DROP TABLE IF EXISTS temp.features_fts;"
+    "DROP TABLE IF EXISTS temp.relationships_fts;";
+
+/*!
+ *  \brief string constant to replace the contents of the full-text search index by the current table contents
+ *
+ *  This is needed by connections that do not see their triggers fire because other connections modify the tables.
+ */
+static const char *DATA_DATABASE_REFILL_SEARCH_INDEX =
+    "DELETE FROM temp.diagrams_fts;"
+    "INSERT INTO temp.diagrams_fts(rowid,name,stereotype,description) SELECT id,name,stereotype,description FROM main.diagrams;"
+    "DELETE FROM temp.classifiers_fts;"
+    "INSERT INTO temp.classifiers_fts(rowid,name,stereotype,description) SELECT id,name,stereotype,description FROM main.classifiers;"
+    "DELETE FROM temp.features_fts;"
+    "INSERT INTO temp.features_fts(rowid,key,value,description) SELECT id,key,value,description FROM main.features;"
+    "DELETE FROM temp.relationships_fts;"
+    "INSERT INTO temp.relationships_fts(rowid,name,stereotype,description) SELECT id,name,stereotype,description FROM main.relationships;";
+
+/*!
+ *  \brief string constant to set the cache settings which are common to all storage profiles
+ *
+ *  cache_size is negative to be interpreted as KiB: 16 MiB page cache instead of 2 MiB;
+ *  mmap_size is an upper limit: files smaller than 256 MiB are mapped completely;
+ *  temp_store keeps the temporary full-text search index in memory.
+ *
+ *  \see https://sqlite.org/pragma.html
+ */
+static const char *DATA_DATABASE_PRAGMA_CACHE =
+    "PRAGMA cache_size=-16384;"
+    "PRAGMA mmap_size=268435456;"
+    "PRAGMA temp_store=MEMORY;";
+
+/*!
+ *  \brief string constants to set the journal mode and synchronization level, indexed by data_database_profile_t
+ *
+ *  \see https://sqlite.org/pragma.html#pragma_journal_mode
+ *  \see https://sqlite.org/wal.html
+ */
+static const char *const DATA_DATABASE_PRAGMA_JOURNAL[] = {
+    [DATA_DATABASE_PROFILE_DURABLE] = "PRAGMA journal_mode=DELETE;PRAGMA synchronous=FULL;",
+    [DATA_DATABASE_PROFILE_WORKING_COPY] = "PRAGMA journal_mode=WAL;PRAGMA synchronous=NORMAL;",
+    [DATA_DATABASE_PROFILE_SCRATCH] = "PRAGMA journal_mode=MEMORY;PRAGMA synchronous=OFF;",
+};
+
+/*!
+ *  \brief names of the pragmas that are reported by data_database_trace_stats
+ */
+static const char *const DATA_DATABASE_PRAGMA_REPORT[] = {
+    "PRAGMA journal_mode;",
+    "PRAGMA synchronous;",
+    "PRAGMA cache_size;",
+    "PRAGMA mmap_size;",
+    "PRAGMA temp_store;",
+};
+
 /*!
  *  \brief string constant to start a transaction
  *
@@ -311,6 +547,8 @@ void data_database_init ( data_database_t *this_ )
         (*this_).db_state = DATA_DATABASE_STATE_CLOSED;
         (*this_).transaction_recursion = 0;
         (*this_).revision = ( data_database_unused_revision++ );
+        (*this_).search_index_available = false;
+        (*this_).profile = DATA_DATABASE_PROFILE_DURABLE;
     }
     result |= data_database_unlock_on_write( this_ );
     if( result != U8_ERROR_NONE )
@@ -355,11 +593,21 @@ u8_error_t data_database_private_open ( data_database_t *this_, const char* db_f
         {
             U8_LOG_ERROR_INT( "sqlite3_open_v2() failed:", sqlite_err );
             U8_LOG_ERROR_STR( "sqlite3_open_v2() failed:", utf8stringbuf_get_string( &((*this_).db_file_name) ) );
+            /* sqlite3_open_v2 allocates a handle even on failure, it must be released */
+            sqlite_err = sqlite3_close( (*this_).db );
+            if ( SQLITE_OK != sqlite_err )
+            {
+                U8_LOG_ERROR_INT( "sqlite3_close() failed:", sqlite_err );
+            }
+            (*this_).db = NULL;
             (*this_).db_state = DATA_DATABASE_STATE_CLOSED;
             result |= U8_ERROR_NO_DB;  /* no db to use */
         }
         else
         {
+            /* the storage profile only tunes the performance, errors are not propagated */
+            data_database_private_apply_profile( this_, sqlite3_flags );
+
             u8_error_t init_err;
             init_err = data_database_private_initialize_tables( this_ );
             if ( init_err == U8_ERROR_NONE )
@@ -369,6 +617,7 @@ u8_error_t data_database_private_open ( data_database_t *this_, const char* db_f
 
             if ( init_err == U8_ERROR_NONE )
             {
+                /* the search index is created when a searcher requests it, see data_database_request_search_index */
                 (*this_).db_state
                     = ( (sqlite3_flags & SQLITE_OPEN_MEMORY) == 0 )
                     ? DATA_DATABASE_STATE_OPEN
@@ -414,6 +663,30 @@ u8_error_t data_database_private_open ( data_database_t *this_, const char* db_f
     return result;
 }
 
+u8_error_t data_database_private_apply_profile ( data_database_t *this_, int sqlite3_flags )
+{
+    U8_TRACE_BEGIN();
+    assert( (*this_).profile < ( sizeof(DATA_DATABASE_PRAGMA_JOURNAL) / sizeof(DATA_DATABASE_PRAGMA_JOURNAL[0]) ) );
+    u8_error_t result = U8_ERROR_NONE;
+
+    /* a read-only connection cannot change the journal mode, an in-memory database has no file to synchronize */
+    const bool keeps_journal
+        = (( sqlite3_flags & SQLITE_OPEN_READONLY ) != 0 )||(( sqlite3_flags & SQLITE_OPEN_MEMORY ) != 0 );
+    if ( ! keeps_journal )
+    {
+        result |= data_database_private_exec_sql( this_, DATA_DATABASE_PRAGMA_JOURNAL[(*this_).profile], false );
+    }
+    result |= data_database_private_exec_sql( this_, DATA_DATABASE_PRAGMA_CACHE, false );
+
+    if ( result != U8_ERROR_NONE )
+    {
+        U8_LOG_WARNING_HEX( "sqlite3 storage profile not applied, using the defaults of sqlite3:", result );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
 u8_error_t data_database_close ( data_database_t *this_ )
 {
     U8_TRACE_BEGIN();
@@ -458,6 +731,7 @@ u8_error_t data_database_close ( data_database_t *this_ )
         utf8stringbuf_clear( &((*this_).db_file_name) );
         (*this_).db_state = DATA_DATABASE_STATE_CLOSED;
         (*this_).transaction_recursion = 0;
+        (*this_).search_index_available = false;
 
         notify_change_listeners = true;
     }
@@ -557,6 +831,19 @@ u8_error_t data_database_private_upgrade_tables( data_database_t *this_ )
     data_database_private_exec_sql( this_, DATA_DATABASE_ALTER_RELATIONSHIP_TABLE_STEREOTYPE, true );
     data_database_private_exec_sql( this_, DATA_DATABASE_ALTER_DIAGRAM_TABLE_STEREOTYPE, true );
 
+    /* add the secondary indices to databases of version 1.70.5 or earlier, after all indexed columns exist */
+    /* the indices only speed up queries, errors are not propagated: */
+    u8_error_t index_err = U8_ERROR_NONE;
+    index_err |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_CLASSIFIER_INDICES, true );
+    index_err |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_RELATIONSHIP_INDICES, true );
+    index_err |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_FEATURE_INDICES, true );
+    index_err |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_DIAGRAM_INDICES, true );
+    index_err |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_DIAGRAMELEMENT_INDICES, true );
+    if ( u8_error_more_than( index_err, U8_ERROR_READ_ONLY_DB ) )
+    {
+        U8_LOG_WARNING_HEX( "sqlite3 secondary indices not available, queries fall back to table scans:", index_err );
+    }
+
     if ( u8_error_contains( result, U8_ERROR_READ_ONLY_DB ) )
     {
         U8_LOG_EVENT( "sqlite3 database is read only." );
@@ -567,6 +854,113 @@ u8_error_t data_database_private_upgrade_tables( data_database_t *this_ )
     return result;
 }
 
+u8_error_t data_database_private_initialize_search_index( data_database_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    /* the temp schema is writeable also if the database file is read only */
+    result |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_DIAGRAM_SEARCH_INDEX, true );
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_CLASSIFIER_SEARCH_INDEX, true );
+    }
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_FEATURE_SEARCH_INDEX, true );
+    }
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_RELATIONSHIP_SEARCH_INDEX, true );
+    }
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_private_create_search_triggers( this_ );
+    }
+
+    if ( result == U8_ERROR_NONE )
+    {
+        (*this_).search_index_available = true;
+    }
+    else
+    {
+        U8_LOG_WARNING( "sqlite3 full-text search index not available (fts5), text search falls back to LIKE." );
+        data_database_private_exec_sql( this_, DATA_DATABASE_DROP_SEARCH_TRIGGERS, true );
+        data_database_private_exec_sql( this_, DATA_DATABASE_DROP_SEARCH_INDEX, true );
+        (*this_).search_index_available = false;
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_private_create_search_triggers( data_database_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    result |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_DIAGRAM_SEARCH_TRIGGERS, false );
+    result |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_CLASSIFIER_SEARCH_TRIGGERS, false );
+    result |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_FEATURE_SEARCH_TRIGGERS, false );
+    result |= data_database_private_exec_sql( this_, DATA_DATABASE_CREATE_RELATIONSHIP_SEARCH_TRIGGERS, false );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_request_search_index ( data_database_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( ! data_database_is_open( this_ ) )
+    {
+        result = U8_ERROR_NO_DB;
+    }
+    else if ( data_database_has_search_index( this_ ) )
+    {
+        U8_TRACE_INFO( "full-text search index already exists." );
+    }
+    else
+    {
+        /* the temp schema is writeable also if the database file is read only */
+        result |= data_database_private_initialize_search_index( this_ );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_pause_search_index ( data_database_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( data_database_has_search_index( this_ ) )
+    {
+        result |= data_database_private_exec_sql( this_, DATA_DATABASE_DROP_SEARCH_TRIGGERS, false );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_resume_search_index ( data_database_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( data_database_has_search_index( this_ ) )
+    {
+        /* one bulk copy of each table is faster than firing the triggers for every changed row */
+        result |= data_database_private_exec_sql( this_, DATA_DATABASE_REFILL_SEARCH_INDEX, false );
+        result |= data_database_private_create_search_triggers( this_ );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
 /* ================================ Actions on DB ================================ */
 
 u8_error_t data_database_flush_caches ( data_database_t *this_ )
@@ -611,6 +1005,29 @@ u8_error_t data_database_flush_caches ( data_database_t *this_ )
     return result;
 }
 
+u8_error_t data_database_refill_search_index ( data_database_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( ! data_database_is_open( this_ ) )
+    {
+        result = U8_ERROR_NO_DB;
+    }
+    else if ( ! data_database_has_search_index( this_ ) )
+    {
+        U8_TRACE_INFO( "no full-text search index to refill." );
+    }
+    else
+    {
+        /* the temp schema is writeable also if the database file is read only */
+        result |= data_database_private_exec_sql( this_, DATA_DATABASE_REFILL_SEARCH_INDEX, false );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
 u8_error_t data_database_trace_stats ( data_database_t *this_ )
 {
     U8_TRACE_BEGIN();
@@ -624,6 +1041,27 @@ u8_error_t data_database_trace_stats ( data_database_t *this_ )
         use = sqlite3_memory_used();
         max = sqlite3_memory_highwater(false);
         U8_TRACE_INFO_INT_INT( "sqlite3_memory_used/highwater():", use, max );
+
+        U8_TRACE_INFO_INT( "storage profile:", (*this_).profile );
+        const unsigned int report_count = sizeof(DATA_DATABASE_PRAGMA_REPORT) / sizeof(DATA_DATABASE_PRAGMA_REPORT[0]);
+        for ( unsigned int pragma_idx = 0; pragma_idx < report_count; pragma_idx ++ )
+        {
+            sqlite3_stmt *pragma_statement = NULL;
+            const int prepare_err
+                = sqlite3_prepare_v2( (*this_).db, DATA_DATABASE_PRAGMA_REPORT[pragma_idx], -1, &pragma_statement, NULL );
+            if ( SQLITE_OK != prepare_err )
+            {
+                U8_LOG_ERROR_INT( "sqlite3_prepare_v2() failed:", prepare_err );
+                result |= U8_ERROR_AT_DB;
+            }
+            else if ( SQLITE_ROW == sqlite3_step( pragma_statement ) )
+            {
+                U8_TRACE_INFO_STR( DATA_DATABASE_PRAGMA_REPORT[pragma_idx],
+                                   (const char*) sqlite3_column_text( pragma_statement, 0 )
+                                 );
+            }
+            sqlite3_finalize( pragma_statement );  /* finalizing NULL is a harmless no-op */
+        }
     }
     else
     {
@@ -679,7 +679,7 @@ u8_error_t data_database_diagram_reader_private_open( data_database_diagram_read
                                                    DATA_DATABASE_SQL_LENGTH_AUTO_DETECT,
                                                    &((*this_).statement_diagrams_by_parent_id_null)
                                                  );
-        (*this_).statement_diagrams_by_parent_id_borrowed = false;
+        (*this_).statement_diagrams_by_parent_id_null_borrowed = false;
 
         result |= data_database_prepare_statement( (*this_).database,
                                                    DATA_DIAGRAM_ITERATOR_SELECT_DIAGRAMS_BY_CLASSIFIER_ID,
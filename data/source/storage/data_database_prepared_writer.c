@@ -0,0 +1,645 @@
+/* File: data_database_prepared_writer.c; Copyright and License: see below */
+
+#include "storage/data_database_prepared_writer.h"
+#include "storage/data_database_borrowed_stmt.h"
+#include "utf8stringbuf/utf8stringview.h"
+#include "utf8stringbuf/utf8string.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <sqlite3.h>
+#include <assert.h>
+
+/*!
+ *  \brief predefined insert statement to create a diagram
+ *
+ *  The id is bound to NULL if sqlite shall choose a new id.
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_INSERT_DIAGRAM[] =
+    "INSERT INTO diagrams (id,parent_id,diagram_type,stereotype,name,description,list_order,display_flags,uuid) "
+    "VALUES (?,?,?,?,?,?,?,?,?);";
+
+/*!
+ *  \brief predefined insert statement to create a classifier
+ *
+ *  The id is bound to NULL if sqlite shall choose a new id.
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_INSERT_CLASSIFIER[] =
+    "INSERT INTO classifiers (id,main_type,stereotype,name,description,x_order,y_order,list_order,uuid) "
+    "VALUES (?,?,?,?,?,?,?,?,?);";
+
+/*!
+ *  \brief predefined insert statement to create a diagramelement
+ *
+ *  The id is bound to NULL if sqlite shall choose a new id.
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_INSERT_DIAGRAMELEMENT[] =
+    "INSERT INTO diagramelements (id,diagram_id,classifier_id,display_flags,focused_feature_id,uuid) "
+    "VALUES (?,?,?,?,?,?);";
+
+/*!
+ *  \brief predefined insert statement to create a feature
+ *
+ *  The id is bound to NULL if sqlite shall choose a new id.
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_INSERT_FEATURE[] =
+    "INSERT INTO features (id,main_type,classifier_id,key,value,description,list_order,uuid) "
+    "VALUES (?,?,?,?,?,?,?,?);";
+
+/*!
+ *  \brief predefined insert statement to create a relationship
+ *
+ *  The id is bound to NULL if sqlite shall choose a new id.
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_INSERT_RELATIONSHIP[] =
+    "INSERT INTO relationships "
+    "(id,main_type,from_classifier_id,to_classifier_id,stereotype,name,description,list_order,from_feature_id,to_feature_id,uuid) "
+    "VALUES (?,?,?,?,?,?,?,?,?,?,?);";
+
+/*!
+ *  \brief predefined delete statement for a diagram
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_DELETE_DIAGRAM[] =
+    "DELETE FROM diagrams WHERE (id=?);";
+
+/*!
+ *  \brief predefined delete statement for a classifier
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_DELETE_CLASSIFIER[] =
+    "DELETE FROM classifiers WHERE (id=?);";
+
+/*!
+ *  \brief predefined delete statement for a diagramelement
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_DELETE_DIAGRAMELEMENT[] =
+    "DELETE FROM diagramelements WHERE (id=?);";
+
+/*!
+ *  \brief predefined delete statement for a feature
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_DELETE_FEATURE[] =
+    "DELETE FROM features WHERE (id=?);";
+
+/*!
+ *  \brief predefined delete statement for a relationship
+ */
+static const char DATA_DATABASE_PREPARED_WRITER_DELETE_RELATIONSHIP[] =
+    "DELETE FROM relationships WHERE (id=?);";
+
+/*!
+ *  \brief predefined update statements, one per column
+ *
+ *  The first parameter is the new value, the second the id of the record.
+ */
+static const char *const DATA_DATABASE_PREPARED_WRITER_UPDATE[DATA_DATABASE_PREPARED_WRITER_COL_MAX] = {
+    [DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_PARENT_ID] = "UPDATE diagrams SET parent_id=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_TYPE] = "UPDATE diagrams SET diagram_type=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_STEREOTYPE] = "UPDATE diagrams SET stereotype=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_NAME] = "UPDATE diagrams SET name=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_DESCRIPTION] = "UPDATE diagrams SET description=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_LIST_ORDER] = "UPDATE diagrams SET list_order=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_MAIN_TYPE] = "UPDATE classifiers SET main_type=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_STEREOTYPE] = "UPDATE classifiers SET stereotype=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_NAME] = "UPDATE classifiers SET name=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_DESCRIPTION] = "UPDATE classifiers SET description=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_X_ORDER] = "UPDATE classifiers SET x_order=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_Y_ORDER] = "UPDATE classifiers SET y_order=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_LIST_ORDER] = "UPDATE classifiers SET list_order=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAMELEMENT_DISPLAY_FLAGS] = "UPDATE diagramelements SET display_flags=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAMELEMENT_FOCUSED_FEATURE_ID] = "UPDATE diagramelements SET focused_feature_id=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_MAIN_TYPE] = "UPDATE features SET main_type=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_KEY] = "UPDATE features SET key=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_VALUE] = "UPDATE features SET value=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_DESCRIPTION] = "UPDATE features SET description=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_LIST_ORDER] = "UPDATE features SET list_order=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_MAIN_TYPE] = "UPDATE relationships SET main_type=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_STEREOTYPE] = "UPDATE relationships SET stereotype=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_NAME] = "UPDATE relationships SET name=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_DESCRIPTION] = "UPDATE relationships SET description=? WHERE id=?;",
+    [DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_LIST_ORDER] = "UPDATE relationships SET list_order=? WHERE id=?;",
+};
+
+u8_error_t data_database_prepared_writer_init ( data_database_prepared_writer_t *this_, data_database_t *database )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != database );
+    u8_error_t result = U8_ERROR_NONE;
+
+    (*this_).database = database;
+    (*this_).statement_borrowed = false;
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_INSERT_DIAGRAM,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_INSERT_DIAGRAM ),
+                                               &((*this_).statement_create_diagram)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_INSERT_CLASSIFIER,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_INSERT_CLASSIFIER ),
+                                               &((*this_).statement_create_classifier)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_INSERT_DIAGRAMELEMENT,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_INSERT_DIAGRAMELEMENT ),
+                                               &((*this_).statement_create_diagramelement)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_INSERT_FEATURE,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_INSERT_FEATURE ),
+                                               &((*this_).statement_create_feature)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_INSERT_RELATIONSHIP,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_INSERT_RELATIONSHIP ),
+                                               &((*this_).statement_create_relationship)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_DELETE_DIAGRAM,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_DELETE_DIAGRAM ),
+                                               &((*this_).statement_delete_diagram)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_DELETE_CLASSIFIER,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_DELETE_CLASSIFIER ),
+                                               &((*this_).statement_delete_classifier)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_DELETE_DIAGRAMELEMENT,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_DELETE_DIAGRAMELEMENT ),
+                                               &((*this_).statement_delete_diagramelement)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_DELETE_FEATURE,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_DELETE_FEATURE ),
+                                               &((*this_).statement_delete_feature)
+                                             );
+
+    result |= data_database_prepare_statement( (*this_).database,
+                                               DATA_DATABASE_PREPARED_WRITER_DELETE_RELATIONSHIP,
+                                               sizeof( DATA_DATABASE_PREPARED_WRITER_DELETE_RELATIONSHIP ),
+                                               &((*this_).statement_delete_relationship)
+                                             );
+
+    for ( int column = 0; column < DATA_DATABASE_PREPARED_WRITER_COL_MAX; column ++ )
+    {
+        result |= data_database_prepare_statement( (*this_).database,
+                                                   DATA_DATABASE_PREPARED_WRITER_UPDATE[column],
+                                                   DATA_DATABASE_SQL_LENGTH_AUTO_DETECT,
+                                                   &((*this_).statement_update[column])
+                                                 );
+    }
+
+    if ( result != U8_ERROR_NONE )
+    {
+        U8_LOG_ERROR( "A prepared statement could not be prepared." );
+    }
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
+u8_error_t data_database_prepared_writer_destroy ( data_database_prepared_writer_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    assert( ! (*this_).statement_borrowed );
+    u8_error_t result = U8_ERROR_NONE;
+
+    sqlite3_stmt **const all_statements[] = {
+        &((*this_).statement_create_diagram),
+        &((*this_).statement_create_classifier),
+        &((*this_).statement_create_diagramelement),
+        &((*this_).statement_create_feature),
+        &((*this_).statement_create_relationship),
+        &((*this_).statement_delete_diagram),
+        &((*this_).statement_delete_classifier),
+        &((*this_).statement_delete_diagramelement),
+        &((*this_).statement_delete_feature),
+        &((*this_).statement_delete_relationship),
+    };
+    const unsigned int all_count = sizeof(all_statements) / sizeof(all_statements[0]);
+    for ( unsigned int index = 0; index < all_count; index ++ )
+    {
+        /* statements are NULL if data_database_prepared_writer_init failed to prepare these */
+        if ( NULL != *(all_statements[index]) )
+        {
+            result |= data_database_finalize_statement( (*this_).database, *(all_statements[index]) );
+            *(all_statements[index]) = NULL;
+        }
+    }
+    for ( int column = 0; column < DATA_DATABASE_PREPARED_WRITER_COL_MAX; column ++ )
+    {
+        if ( NULL != (*this_).statement_update[column] )
+        {
+            result |= data_database_finalize_statement( (*this_).database, (*this_).statement_update[column] );
+            (*this_).statement_update[column] = NULL;
+        }
+    }
+
+    (*this_).database = NULL;
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
+/* ================================ CREATE ================================ */
+
+u8_error_t data_database_prepared_writer_create_diagram ( data_database_prepared_writer_t *this_,
+                                                          const data_diagram_t *diagram,
+                                                          data_row_t* out_new_id )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != diagram );
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *const stmt = (*this_).statement_create_diagram;
+
+    data_database_borrowed_stmt_t sql_statement;
+    data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 1, data_diagram_get_row( diagram ) );
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 2, data_diagram_get_parent_row( diagram ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 3, data_diagram_get_diagram_type( diagram ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 4, data_diagram_get_stereotype_const( diagram ), -1 );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 5, data_diagram_get_name_const( diagram ), -1 );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 6, data_diagram_get_description_const( diagram ), -1 );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 7, data_diagram_get_list_order( diagram ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 8, data_diagram_get_display_flags( diagram ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 9, data_diagram_get_uuid_const( diagram ), -1 );
+
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE, out_new_id );
+    }
+
+    result |= data_database_borrowed_stmt_destroy( &sql_statement );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_prepared_writer_create_classifier ( data_database_prepared_writer_t *this_,
+                                                             const data_classifier_t *classifier,
+                                                             data_row_t* out_new_id )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != classifier );
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *const stmt = (*this_).statement_create_classifier;
+
+    data_database_borrowed_stmt_t sql_statement;
+    data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 1, data_classifier_get_row( classifier ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 2, data_classifier_get_main_type( classifier ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 3, data_classifier_get_stereotype_const( classifier ), -1 );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 4, data_classifier_get_name_const( classifier ), -1 );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 5, data_classifier_get_description_const( classifier ), -1 );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 6, data_classifier_get_x_order( classifier ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 7, data_classifier_get_y_order( classifier ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 8, data_classifier_get_list_order( classifier ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 9, data_classifier_get_uuid_const( classifier ), -1 );
+
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE, out_new_id );
+    }
+
+    result |= data_database_borrowed_stmt_destroy( &sql_statement );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_prepared_writer_create_diagramelement ( data_database_prepared_writer_t *this_,
+                                                                 const data_diagramelement_t *diagramelement,
+                                                                 data_row_t* out_new_id )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != diagramelement );
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *const stmt = (*this_).statement_create_diagramelement;
+
+    data_database_borrowed_stmt_t sql_statement;
+    data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 1, data_diagramelement_get_row( diagramelement ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 2, data_diagramelement_get_diagram_row( diagramelement ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 3, data_diagramelement_get_classifier_row( diagramelement ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 4, data_diagramelement_get_display_flags( diagramelement ) );
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 5, data_diagramelement_get_focused_feature_row( diagramelement ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 6, data_diagramelement_get_uuid_const( diagramelement ), -1 );
+
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE, out_new_id );
+    }
+
+    result |= data_database_borrowed_stmt_destroy( &sql_statement );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_prepared_writer_create_feature ( data_database_prepared_writer_t *this_,
+                                                          const data_feature_t *feature,
+                                                          data_row_t* out_new_id )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != feature );
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *const stmt = (*this_).statement_create_feature;
+
+    data_database_borrowed_stmt_t sql_statement;
+    data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 1, data_feature_get_row( feature ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 2, data_feature_get_main_type( feature ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 3, data_feature_get_classifier_row( feature ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 4, data_feature_get_key_const( feature ), -1 );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 5, data_feature_get_value_const( feature ), -1 );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 6, data_feature_get_description_const( feature ), -1 );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 7, data_feature_get_list_order( feature ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 8, data_feature_get_uuid_const( feature ), -1 );
+
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE, out_new_id );
+    }
+
+    result |= data_database_borrowed_stmt_destroy( &sql_statement );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_prepared_writer_create_relationship ( data_database_prepared_writer_t *this_,
+                                                               const data_relationship_t *relationship,
+                                                               data_row_t* out_new_id )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != relationship );
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *const stmt = (*this_).statement_create_relationship;
+
+    data_database_borrowed_stmt_t sql_statement;
+    data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 1, data_relationship_get_row( relationship ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 2, data_relationship_get_main_type( relationship ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 3, data_relationship_get_from_classifier_row( relationship ) );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 4, data_relationship_get_to_classifier_row( relationship ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 5, data_relationship_get_stereotype_const( relationship ), -1 );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 6, data_relationship_get_name_const( relationship ), -1 );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 7, data_relationship_get_description_const( relationship ), -1 );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 8, data_relationship_get_list_order( relationship ) );
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 9, data_relationship_get_from_feature_row( relationship ) );
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 10, data_relationship_get_to_feature_row( relationship ) );
+    result |= data_database_prepared_writer_private_bind_text( this_, stmt, 11, data_relationship_get_uuid_const( relationship ), -1 );
+
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE, out_new_id );
+    }
+
+    result |= data_database_borrowed_stmt_destroy( &sql_statement );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+/* ================================ DELETE ================================ */
+
+u8_error_t data_database_prepared_writer_delete ( data_database_prepared_writer_t *this_, data_table_t table, data_row_t obj_id )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *stmt = NULL;
+
+    switch ( table )
+    {
+        case DATA_TABLE_DIAGRAM:
+        {
+            stmt = (*this_).statement_delete_diagram;
+        }
+        break;
+
+        case DATA_TABLE_CLASSIFIER:
+        {
+            stmt = (*this_).statement_delete_classifier;
+        }
+        break;
+
+        case DATA_TABLE_DIAGRAMELEMENT:
+        {
+            stmt = (*this_).statement_delete_diagramelement;
+        }
+        break;
+
+        case DATA_TABLE_FEATURE:
+        {
+            stmt = (*this_).statement_delete_feature;
+        }
+        break;
+
+        case DATA_TABLE_RELATIONSHIP:
+        {
+            stmt = (*this_).statement_delete_relationship;
+        }
+        break;
+
+        default:
+        {
+            U8_LOG_ERROR( "unexpected data_table_t" );
+            result |= U8_ERROR_VALUE_OUT_OF_RANGE;
+        }
+    }
+
+    if ( NULL != stmt )
+    {
+        data_database_borrowed_stmt_t sql_statement;
+        data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+        result |= data_database_prepared_writer_private_bind_int( this_, stmt, 1, obj_id );
+        if ( result == U8_ERROR_NONE )
+        {
+            result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE_NAME, NULL );
+        }
+
+        result |= data_database_borrowed_stmt_destroy( &sql_statement );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+/* ================================ UPDATE ================================ */
+
+u8_error_t data_database_prepared_writer_update_int ( data_database_prepared_writer_t *this_,
+                                                      data_database_prepared_writer_column_t column,
+                                                      data_row_t obj_id,
+                                                      int64_t new_value )
+{
+    U8_TRACE_BEGIN();
+    assert( column < DATA_DATABASE_PREPARED_WRITER_COL_MAX );
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *const stmt = (*this_).statement_update[column];
+
+    data_database_borrowed_stmt_t sql_statement;
+    data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 1, new_value );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 2, obj_id );
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE_NAME, NULL );
+    }
+
+    result |= data_database_borrowed_stmt_destroy( &sql_statement );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_prepared_writer_update_ref ( data_database_prepared_writer_t *this_,
+                                                      data_database_prepared_writer_column_t column,
+                                                      data_row_t obj_id,
+                                                      data_row_t new_ref_id )
+{
+    U8_TRACE_BEGIN();
+    assert( column < DATA_DATABASE_PREPARED_WRITER_COL_MAX );
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *const stmt = (*this_).statement_update[column];
+
+    data_database_borrowed_stmt_t sql_statement;
+    data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+    result |= data_database_prepared_writer_private_bind_id( this_, stmt, 1, new_ref_id );
+    result |= data_database_prepared_writer_private_bind_int( this_, stmt, 2, obj_id );
+    if ( result == U8_ERROR_NONE )
+    {
+        result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE_NAME, NULL );
+    }
+
+    result |= data_database_borrowed_stmt_destroy( &sql_statement );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_prepared_writer_update_text ( data_database_prepared_writer_t *this_,
+                                                       data_database_prepared_writer_column_t column,
+                                                       data_row_t obj_id,
+                                                       const char *new_text,
+                                                       size_t max_length )
+{
+    U8_TRACE_BEGIN();
+    assert( column < DATA_DATABASE_PREPARED_WRITER_COL_MAX );
+    assert( NULL != new_text );
+    u8_error_t result = U8_ERROR_NONE;
+    sqlite3_stmt *const stmt = (*this_).statement_update[column];
+
+    /* view the string but limited to the maximum allowed bytes: */
+    utf8stringview_t shortened_text;
+    const size_t new_length = utf8string_get_length( new_text );
+    if ( new_length <= max_length )
+    {
+        utf8stringview_init_str( &shortened_text, new_text );
+    }
+    else
+    {
+        U8_LOG_WARNING_INT( "text is shortened to maximum length:", max_length );
+        result |= U8_ERROR_STRING_BUFFER_EXCEEDED;
+        utf8stringview_init( &shortened_text, new_text, max_length );
+        /* ignore a possible UTF8ERROR_OUT_OF_RANGE result */
+    }
+
+    data_database_borrowed_stmt_t sql_statement;
+    data_database_borrowed_stmt_init( &sql_statement, (*this_).database, stmt, &((*this_).statement_borrowed) );
+
+    u8_error_t bind_err = U8_ERROR_NONE;
+    bind_err |= data_database_prepared_writer_private_bind_text( this_,
+                                                                 stmt,
+                                                                 1,
+                                                                 utf8stringview_get_start( &shortened_text ),
+                                                                 utf8stringview_get_length( &shortened_text )
+                                                               );
+    bind_err |= data_database_prepared_writer_private_bind_int( this_, stmt, 2, obj_id );
+    if ( bind_err == U8_ERROR_NONE )
+    {
+        result |= data_database_prepared_writer_private_step( this_, stmt, U8_ERROR_DUPLICATE_NAME, NULL );
+    }
+    result |= bind_err;
+
+    result |= data_database_borrowed_stmt_destroy( &sql_statement );
+    utf8stringview_destroy( &shortened_text );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+/* ================================ private ================================ */
+
+u8_error_t data_database_prepared_writer_private_step ( data_database_prepared_writer_t *this_,
+                                                        sqlite3_stmt *statement_ptr,
+                                                        u8_error_t constraint_error,
+                                                        data_row_t* out_new_id )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != statement_ptr );
+    u8_error_t result = U8_ERROR_NONE;
+    int sqlite_err;
+    sqlite3 *const db = data_database_get_database_ptr( (*this_).database );
+
+    U8_TRACE_INFO_STR( "sqlite3_step():", sqlite3_sql( statement_ptr ) );
+    sqlite_err = sqlite3_step( statement_ptr );
+    if ( SQLITE_CONSTRAINT == (0xff & sqlite_err) )
+    {
+        /* This case happens if id is not unique and/or if a classifier name is not unique*/
+        U8_LOG_ERROR( "sqlite3_step() failed due to UNIQUE constraint" );
+        result |= constraint_error;
+    }
+    else if ( SQLITE_DONE != sqlite_err )
+    {
+        U8_LOG_ERROR_INT( "sqlite3_step() failed:", sqlite_err );
+        U8_LOG_ERROR_STR( "sqlite3_step() failed:", sqlite3_errmsg( db ) );
+        result |= (sqlite_err == SQLITE_READONLY) ? U8_ERROR_READ_ONLY_DB : U8_ERROR_AT_DB;
+    }
+
+    if (( NULL != out_new_id )&&( SQLITE_DONE == sqlite_err ))
+    {
+        const data_row_t new_id = sqlite3_last_insert_rowid( db );
+        U8_TRACE_INFO_INT( "sqlite3_last_insert_rowid():", new_id );
+        *out_new_id = new_id;
+    }
+
+    /* release the bound texts, they are not owned by this object. */
+    /* sqlite3_reset() repeats the error of sqlite3_step() which is already reported above. */
+    sqlite3_reset( statement_ptr );
+    sqlite3_clear_bindings( statement_ptr );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
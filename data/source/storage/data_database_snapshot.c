@@ -0,0 +1,144 @@
+/* File: data_database_snapshot.c; Copyright and License: see below */
+
+#include "storage/data_database_snapshot.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <sqlite3.h>
+#include <string.h>
+#include <assert.h>
+
+/*!
+ *  \brief string constant to query the journal mode of the database file
+ */
+static const char *const DATA_DATABASE_SNAPSHOT_JOURNAL_MODE = "PRAGMA journal_mode;";
+
+/*!
+ *  \brief string constant to read from the database, which starts the read transaction of a deferred BEGIN
+ */
+static const char *const DATA_DATABASE_SNAPSHOT_START_READ = "SELECT count(*) FROM sqlite_master;";
+
+u8_error_t data_database_snapshot_init ( data_database_snapshot_t *this_, const char *db_file_path )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != db_file_path );
+
+    data_database_init( &((*this_).connection) );
+    const u8_error_t result = data_database_open_read_only( &((*this_).connection), db_file_path );
+    if ( result != U8_ERROR_NONE )
+    {
+        U8_LOG_WARNING_HEX( "snapshot could not open the database read-only:", result );
+    }
+    data_database_reader_init( &((*this_).reader), &((*this_).connection) );
+    (*this_).is_pinned = false;
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_snapshot_destroy ( data_database_snapshot_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    result |= data_database_snapshot_release( this_ );
+    data_database_reader_destroy( &((*this_).reader) );
+    if ( data_database_is_open( &((*this_).connection) ) )
+    {
+        result |= data_database_close( &((*this_).connection) );
+    }
+    data_database_destroy( &((*this_).connection) );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_snapshot_pin ( data_database_snapshot_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( ! data_database_is_open( &((*this_).connection) ) )
+    {
+        result = U8_ERROR_NO_DB;
+    }
+    else if ( (*this_).is_pinned )
+    {
+        result = U8_ERROR_INVALID_REQUEST;
+    }
+    else
+    {
+        sqlite3 *const db = data_database_get_database_ptr( &((*this_).connection) );
+
+        /* only the write-ahead log allows the editor to commit while a read transaction is open */
+        bool is_wal = false;
+        sqlite3_stmt *journal_statement = NULL;
+        const int prepare_err = sqlite3_prepare_v2( db, DATA_DATABASE_SNAPSHOT_JOURNAL_MODE, -1, &journal_statement, NULL );
+        if (( SQLITE_OK == prepare_err )&&( SQLITE_ROW == sqlite3_step( journal_statement ) ))
+        {
+            const char *const journal_mode = (const char*) sqlite3_column_text( journal_statement, 0 );
+            is_wal = ( NULL != journal_mode )&&( 0 == strcmp( journal_mode, "wal" ) );
+            U8_TRACE_INFO_STR( "journal_mode:", ( NULL == journal_mode ) ? "" : journal_mode );
+        }
+        sqlite3_finalize( journal_statement );  /* finalizing NULL is a harmless no-op */
+
+        if ( is_wal )
+        {
+            result |= data_database_transaction_begin( &((*this_).connection) );
+            if ( result == U8_ERROR_NONE )
+            {
+                /* a deferred transaction takes its snapshot at the first read */
+                U8_LOG_EVENT_STR( "sqlite3_exec:", DATA_DATABASE_SNAPSHOT_START_READ );
+                const int sqlite_err = sqlite3_exec( db, DATA_DATABASE_SNAPSHOT_START_READ, NULL, NULL, NULL );
+                if ( SQLITE_OK != sqlite_err )
+                {
+                    U8_LOG_ERROR_INT( "sqlite3_exec() failed:", sqlite_err );
+                    result |= U8_ERROR_AT_DB;
+                    data_database_transaction_commit( &((*this_).connection) );  /* ends the transaction, ignore errors */
+                }
+                else
+                {
+                    (*this_).is_pinned = true;
+                }
+            }
+        }
+        else
+        {
+            U8_LOG_EVENT( "snapshot not pinned, the database file does not use the write-ahead log." );
+        }
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_snapshot_release ( data_database_snapshot_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).is_pinned )
+    {
+        result |= data_database_transaction_commit( &((*this_).connection) );
+        (*this_).is_pinned = false;
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -29,6 +29,8 @@ u8_error_t data_database_text_search_init( data_database_text_search_t *this_, d
 
     (*this_).database = database;
     (*this_).is_open = false;
+    (*this_).search_index_is_open = false;
+    (*this_).search_index_requested = false;
 
     data_database_listener_init( &((*this_).me_as_listener), this_, (void (*)(void*,data_database_listener_signal_t)) &data_database_text_search_db_change_callback );
     data_database_add_db_listener( database, &((*this_).me_as_listener) );
@@ -112,6 +114,47 @@ u8_error_t data_database_text_search_get_objects_by_text_fragment ( data_databas
     U8_TRACE_BEGIN();
     assert( NULL != io_search_result_iterator );
     assert( NULL != textfragment );
+    u8_error_t result = U8_ERROR_NONE;
+
+    bool searched_by_index = false;
+    if ( (*this_).is_open && ( ! (*this_).search_index_requested ) )
+    {
+        /* the search index is optional, errors are not propagated */
+        data_database_text_search_private_open_search_index( this_ );
+    }
+    if ( (*this_).is_open && (*this_).search_index_is_open )
+    {
+        if ( data_database_text_search_private_build_match_query( this_, textfragment ) )
+        {
+            /* the index finds words at word starts, the LIKE pattern in the same query finds all other substrings */
+            const u8_error_t match_err
+                = data_database_text_search_private_get_objects_by_match( this_, textfragment, io_search_result_iterator );
+            if ( match_err != U8_ERROR_NONE )
+            {
+                U8_LOG_WARNING_STR( "error at searching the full-text index, searching by LIKE:", textfragment );
+            }
+            else
+            {
+                searched_by_index = true;
+            }
+        }
+    }
+
+    if ( ! searched_by_index )
+    {
+        result |= data_database_text_search_private_get_objects_by_like( this_, textfragment, io_search_result_iterator );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+/* ================================ private ================================ */
+
+u8_error_t data_database_text_search_private_build_like_pattern ( data_database_text_search_t *this_, const char *textfragment )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != textfragment );
     const unsigned int text_len = utf8string_get_length( textfragment );
     u8_error_t result = U8_ERROR_NONE;
 
@@ -153,7 +196,24 @@ u8_error_t data_database_text_search_get_objects_by_text_fragment ( data_databas
     {
         U8_LOG_WARNING_STR( "error at escaping the search string", textfragment );
     }
-    else
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_text_search_private_get_objects_by_like ( data_database_text_search_t *this_,
+                                                                   const char *textfragment,
+                                                                   data_search_result_iterator_t *io_search_result_iterator )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != io_search_result_iterator );
+    assert( NULL != textfragment );
+    const unsigned int text_len = utf8string_get_length( textfragment );
+    u8_error_t result = U8_ERROR_NONE;
+
+    result |= data_database_text_search_private_build_like_pattern( this_, textfragment );
+    const bool search_empty = ( 0 == text_len );
+    if ( result == U8_ERROR_NONE )
     {
         /* search for the prepared pattern. In case of empty, search for a non-existing pattern in the type fields */
         const char *const search_name = search_empty ? "" : (*this_).temp_like_search_buf;
@@ -237,7 +297,130 @@ u8_error_t data_database_text_search_get_objects_by_text_fragment ( data_databas
     return result;
 }
 
-/* ================================ private ================================ */
+u8_error_t data_database_text_search_private_get_objects_by_match ( data_database_text_search_t *this_,
+                                                                    const char *textfragment,
+                                                                    data_search_result_iterator_t *io_search_result_iterator )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != io_search_result_iterator );
+    assert( NULL != textfragment );
+    assert( (*this_).is_open );
+    assert( (*this_).search_index_is_open );
+    u8_error_t result = U8_ERROR_NONE;
+
+    U8_TRACE_INFO_STR( "MATCH SEARCH:", (*this_).temp_match_search_buf );
+    const char *const search_match = (*this_).temp_match_search_buf;
+    result |= data_database_text_search_private_build_like_pattern( this_, textfragment );
+    const char *const search_like = (*this_).temp_like_search_buf;
+
+    sqlite3_stmt *const prepared_statement_diag = (*this_).statement_diagram_ids_by_match;
+    result |= data_database_text_search_private_bind_two_texts_to_statement( this_, prepared_statement_diag, search_match, search_like );
+
+    sqlite3_stmt *const prepared_statement_class = (*this_).statement_classifier_ids_by_match;
+    result |= data_database_text_search_private_bind_two_texts_to_statement( this_, prepared_statement_class, search_match, search_like );
+
+    sqlite3_stmt *const prepared_statement_feat = (*this_).statement_feature_ids_by_match;
+    result |= data_database_text_search_private_bind_two_texts_to_statement( this_, prepared_statement_feat, search_match, search_like );
+
+    sqlite3_stmt *const prepared_statement_rel = (*this_).statement_relationship_ids_by_match;
+    result |= data_database_text_search_private_bind_two_texts_to_statement( this_, prepared_statement_rel, search_match, search_like );
+
+    if ( result == U8_ERROR_NONE )
+    {
+        data_database_borrowed_stmt_t sql_statement_diag;
+        data_database_borrowed_stmt_init( &sql_statement_diag,
+                                          (*this_).database,
+                                          prepared_statement_diag,
+                                          &((*this_).statement_diagram_match_borrowed)
+                                        );
+        data_database_borrowed_stmt_t sql_statement_class;
+        data_database_borrowed_stmt_init( &sql_statement_class,
+                                          (*this_).database,
+                                          prepared_statement_class,
+                                          &((*this_).statement_classifier_match_borrowed)
+                                        );
+        data_database_borrowed_stmt_t sql_statement_feat;
+        data_database_borrowed_stmt_init( &sql_statement_feat,
+                                          (*this_).database,
+                                          prepared_statement_feat,
+                                          &((*this_).statement_feature_match_borrowed)
+                                        );
+        data_database_borrowed_stmt_t sql_statement_rel;
+        data_database_borrowed_stmt_init( &sql_statement_rel,
+                                          (*this_).database,
+                                          prepared_statement_rel,
+                                          &((*this_).statement_relationship_match_borrowed)
+                                        );
+        result |= data_search_result_iterator_reinit( io_search_result_iterator,
+                                                      sql_statement_diag,
+                                                      sql_statement_class,
+                                                      sql_statement_feat,
+                                                      sql_statement_rel
+                                                    );
+        /* do not destroy sql_statement_xxx; the object is transferred to the iterator and consumed there. */
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+bool data_database_text_search_private_build_match_query ( data_database_text_search_t *this_, const char *textfragment )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != textfragment );
+    u8_error_t write_err = U8_ERROR_NONE;
+    bool words_only = true;
+    uint_fast32_t word_count = 0;
+    bool in_word = false;
+
+    universal_memory_output_stream_t mem_out;
+    universal_memory_output_stream_init( &mem_out,
+                                         (*this_).temp_match_search_buf,
+                                         sizeof( (*this_).temp_match_search_buf ),
+                                         UNIVERSAL_MEMORY_OUTPUT_STREAM_0TERM_UTF8
+                                       );
+    for ( const char *pos = textfragment; words_only && ( *pos != '\0' ); pos ++ )
+    {
+        const unsigned char current = (unsigned char) *pos;
+        /* non-ascii bytes belong to words; the fts5 unicode61 tokenizer splits these further if needed */
+        const bool is_word_char = ( current >= 0x80 )
+            || (( current >= '0' )&&( current <= '9' ))
+            || (( current >= 'A' )&&( current <= 'Z' ))
+            || (( current >= 'a' )&&( current <= 'z' ));
+        const bool is_space = ( current == ' ' ) || ( current == '\t' ) || ( current == '\n' ) || ( current == '\r' );
+        if ( is_word_char )
+        {
+            if ( ! in_word )
+            {
+                write_err |= universal_memory_output_stream_write( &mem_out, ( word_count == 0 ) ? "\"" : " \"", ( word_count == 0 ) ? 1 : 2 );
+                word_count ++;
+                in_word = true;
+            }
+            write_err |= universal_memory_output_stream_write( &mem_out, pos, 1 );
+        }
+        else if ( is_space )
+        {
+            if ( in_word )
+            {
+                write_err |= universal_memory_output_stream_write( &mem_out, "\"*", 2 );
+                in_word = false;
+            }
+        }
+        else
+        {
+            words_only = false;
+        }
+    }
+    if ( in_word )
+    {
+        write_err |= universal_memory_output_stream_write( &mem_out, "\"*", 2 );
+    }
+    write_err |= universal_memory_output_stream_destroy( &mem_out );
+
+    const bool result = words_only && ( word_count != 0 ) && ( write_err == U8_ERROR_NONE );
+    U8_TRACE_END();
+    return result;
+}
 
 u8_error_t data_database_text_search_private_open( data_database_text_search_t *this_ )
 {
@@ -271,6 +454,10 @@ u8_error_t data_database_text_search_private_open( data_database_text_search_t *
                                                  );
         (*this_).statement_relationship_borrowed = false;
 
+        /* the match statements are prepared at the first search, see data_database_text_search_private_open_search_index */
+        (*this_).search_index_is_open = false;
+        (*this_).search_index_requested = false;
+
         (*this_).is_open = true;
     }
     else
@@ -283,6 +470,77 @@ u8_error_t data_database_text_search_private_open( data_database_text_search_t *
     return result;
 }
 
+u8_error_t data_database_text_search_private_open_search_index( data_database_text_search_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    assert( (*this_).is_open );
+    assert( ! (*this_).search_index_requested );
+    u8_error_t result = U8_ERROR_NONE;
+
+    (*this_).search_index_requested = true;
+
+    /* the index is created only on the connection that searches, not on connections of e.g. exporters */
+    const u8_error_t request_err = data_database_request_search_index( (*this_).database );
+    if ( request_err == U8_ERROR_NONE )
+    {
+        u8_error_t index_err = U8_ERROR_NONE;
+        index_err |= data_database_prepare_statement( (*this_).database,
+                                                      DATA_SEARCH_RESULT_ITERATOR_SELECT_DIAGRAM_BY_SEARCH_INDEX,
+                                                      DATA_DATABASE_SQL_LENGTH_AUTO_DETECT,
+                                                      &((*this_).statement_diagram_ids_by_match)
+                                                    );
+        (*this_).statement_diagram_match_borrowed = false;
+        index_err |= data_database_prepare_statement( (*this_).database,
+                                                      DATA_SEARCH_RESULT_ITERATOR_SELECT_CLASSIFIER_BY_SEARCH_INDEX,
+                                                      DATA_DATABASE_SQL_LENGTH_AUTO_DETECT,
+                                                      &((*this_).statement_classifier_ids_by_match)
+                                                    );
+        (*this_).statement_classifier_match_borrowed = false;
+        index_err |= data_database_prepare_statement( (*this_).database,
+                                                      DATA_SEARCH_RESULT_ITERATOR_SELECT_FEATURE_BY_SEARCH_INDEX,
+                                                      DATA_DATABASE_SQL_LENGTH_AUTO_DETECT,
+                                                      &((*this_).statement_feature_ids_by_match)
+                                                    );
+        (*this_).statement_feature_match_borrowed = false;
+        index_err |= data_database_prepare_statement( (*this_).database,
+                                                      DATA_SEARCH_RESULT_ITERATOR_SELECT_RELATIONSHIP_BY_SEARCH_INDEX,
+                                                      DATA_DATABASE_SQL_LENGTH_AUTO_DETECT,
+                                                      &((*this_).statement_relationship_ids_by_match)
+                                                    );
+        (*this_).statement_relationship_match_borrowed = false;
+        (*this_).search_index_is_open = ( index_err == U8_ERROR_NONE );
+        if ( index_err != U8_ERROR_NONE )
+        {
+            U8_LOG_WARNING( "full-text search index statements could not be prepared." );
+            if ( NULL != (*this_).statement_relationship_ids_by_match )
+            {
+                data_database_finalize_statement( (*this_).database, (*this_).statement_relationship_ids_by_match );
+            }
+            if ( NULL != (*this_).statement_feature_ids_by_match )
+            {
+                data_database_finalize_statement( (*this_).database, (*this_).statement_feature_ids_by_match );
+            }
+            if ( NULL != (*this_).statement_classifier_ids_by_match )
+            {
+                data_database_finalize_statement( (*this_).database, (*this_).statement_classifier_ids_by_match );
+            }
+            if ( NULL != (*this_).statement_diagram_ids_by_match )
+            {
+                data_database_finalize_statement( (*this_).database, (*this_).statement_diagram_ids_by_match );
+            }
+        }
+    }
+    else
+    {
+        (*this_).search_index_is_open = false;
+    }
+
+    result = (*this_).search_index_is_open ? U8_ERROR_NONE : U8_ERROR_NOT_FOUND;
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
 u8_error_t data_database_text_search_private_close( data_database_text_search_t *this_ )
 {
     U8_TRACE_BEGIN();
@@ -290,6 +548,20 @@ u8_error_t data_database_text_search_private_close( data_database_text_search_t
 
     if ( (*this_).is_open )
     {
+        if ( (*this_).search_index_is_open )
+        {
+            assert( (*this_).statement_relationship_match_borrowed == false );
+            result |= data_database_finalize_statement( (*this_).database, (*this_).statement_relationship_ids_by_match );
+            assert( (*this_).statement_feature_match_borrowed == false );
+            result |= data_database_finalize_statement( (*this_).database, (*this_).statement_feature_ids_by_match );
+            assert( (*this_).statement_classifier_match_borrowed == false );
+            result |= data_database_finalize_statement( (*this_).database, (*this_).statement_classifier_ids_by_match );
+            assert( (*this_).statement_diagram_match_borrowed == false );
+            result |= data_database_finalize_statement( (*this_).database, (*this_).statement_diagram_ids_by_match );
+            (*this_).search_index_is_open = false;
+        }
+        (*this_).search_index_requested = false;
+
         assert( (*this_).statement_relationship_borrowed == false );
         result |= data_database_finalize_statement( (*this_).database, (*this_).statement_relationship_ids_by_textfragment );
         assert( (*this_).statement_feature_borrowed == false );
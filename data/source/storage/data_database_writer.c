@@ -16,11 +16,22 @@ void data_database_writer_init ( data_database_writer_t *this_, data_database_re
     (*this_).database = database;
     (*this_).db_reader = db_reader;
 
-    data_database_sql_builder_init( &((*this_).sql_builder) );
+    (*this_).is_open = false;
+    (*this_).bulk_mode = false;
 
     data_database_listener_init ( &((*this_).me_as_listener), this_, (void (*)(void*,data_database_listener_signal_t)) &data_database_writer_db_change_callback );
     data_database_add_db_listener( database, &((*this_).me_as_listener) );
 
+    if ( data_database_is_open( database ) )
+    {
+        /* if the database is open, prepare also the write statements */
+        const u8_error_t open_err = data_database_writer_private_open( this_ );
+        if ( open_err != U8_ERROR_NONE )
+        {
+            U8_LOG_ERROR_HEX( "data_database_writer_init could not prepare statements:", open_err );
+        }
+    }
+
     U8_TRACE_END();
 }
 
@@ -30,7 +41,15 @@ void data_database_writer_destroy ( data_database_writer_t *this_ )
 
     data_database_remove_db_listener( (*this_).database, &((*this_).me_as_listener) );
 
-    data_database_sql_builder_destroy( &((*this_).sql_builder) );
+    if ( (*this_).bulk_mode )
+    {
+        U8_LOG_WARNING( "data_database_writer_destroy called in bulk mode." );
+        data_database_writer_end_bulk_mode( this_ );
+    }
+    if ( (*this_).is_open )
+    {
+        data_database_writer_private_close( this_ );
+    }
 
     (*this_).db_reader = NULL;
     (*this_).database = NULL;
@@ -41,18 +60,34 @@ void data_database_writer_destroy ( data_database_writer_t *this_ )
 void data_database_writer_db_change_callback ( data_database_writer_t *this_, data_database_listener_signal_t signal_id )
 {
     U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
 
     switch ( signal_id )
     {
         case DATA_DATABASE_LISTENER_SIGNAL_PREPARE_CLOSE:
         {
             U8_TRACE_INFO( "DATA_DATABASE_LISTENER_SIGNAL_PREPARE_CLOSE" );
+            if ( (*this_).bulk_mode )
+            {
+                U8_LOG_WARNING( "database closed while in bulk mode." );
+                result |= data_database_writer_end_bulk_mode( this_ );
+            }
+            if ( (*this_).is_open )
+            {
+                /* prepared statements must be finalized before the database is closed */
+                result |= data_database_writer_private_close( this_ );
+            }
         }
         break;
 
         case DATA_DATABASE_LISTENER_SIGNAL_DB_OPENED:
         {
             U8_TRACE_INFO( "DATA_DATABASE_LISTENER_SIGNAL_DB_OPENED" );
+            if ( (*this_).is_open )
+            {
+                result |= data_database_writer_private_close( this_ );
+            }
+            result |= data_database_writer_private_open( this_ );
         }
         break;
 
@@ -62,6 +97,11 @@ void data_database_writer_db_change_callback ( data_database_writer_t *this_, da
         }
     }
 
+    if ( result != U8_ERROR_NONE )
+    {
+        U8_LOG_ERROR( "error at closing old and opening new database" );
+    }
+
     U8_TRACE_END();
 }
 
@@ -74,6 +114,63 @@ void data_database_writer_set_revision ( data_database_writer_t *this_, data_rev
     U8_TRACE_END();
 }
 
+u8_error_t data_database_writer_begin_bulk_mode ( data_database_writer_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).bulk_mode )
+    {
+        U8_LOG_ERROR( "data_database_writer_begin_bulk_mode called twice." );
+        result |= U8_ERROR_INVALID_REQUEST;
+    }
+    else if ( ! (*this_).is_open )
+    {
+        U8_LOG_WARNING( "database not open. cannot start bulk mode." );
+        result |= U8_ERROR_NO_DB;
+    }
+    else
+    {
+        (*this_).bulk_mode = true;
+
+        /* the search index is refilled once at the end instead of updating it on every created record, */
+        /* the secondary indices are not paused */
+        const u8_error_t pause_err = data_database_pause_search_index( (*this_).database );
+        if ( pause_err != U8_ERROR_NONE )
+        {
+            U8_LOG_WARNING( "search index is updated on every record during bulk mode." );
+        }
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t data_database_writer_end_bulk_mode ( data_database_writer_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).bulk_mode )
+    {
+        (*this_).bulk_mode = false;
+
+        const u8_error_t resume_err = data_database_resume_search_index( (*this_).database );
+        if ( resume_err != U8_ERROR_NONE )
+        {
+            U8_LOG_ERROR( "search index could not be refilled after bulk mode." );
+        }
+    }
+    else
+    {
+        U8_LOG_ERROR( "data_database_writer_end_bulk_mode called while not in bulk mode." );
+        result |= U8_ERROR_INVALID_REQUEST;
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
 /* ================================ DIAGRAM ================================ */
 
 u8_error_t data_database_writer_create_diagram ( data_database_writer_t *this_,
@@ -85,14 +182,24 @@ u8_error_t data_database_writer_create_diagram ( data_database_writer_t *this_,
     u8_error_t result = U8_ERROR_NONE;
     data_row_t new_id = DATA_ROW_VOID;
 
-    result |= data_database_sql_builder_build_create_diagram_command( &((*this_).sql_builder), diagram );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_transaction_begin ( (*this_).database );
-    result |= data_database_in_transaction_create( (*this_).database, sql_cmd, &new_id );
-    result |= data_database_transaction_commit ( (*this_).database );
+    if ( ! (*this_).is_open )
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot create record." );
+    }
+    else if ( (*this_).bulk_mode )
+    {
+        /* the caller is responsible for an outer transaction */
+        result |= data_database_prepared_writer_create_diagram( &((*this_).temp_prepared_writer), diagram, &new_id );
+    }
+    else
+    {
+        result |= data_database_transaction_begin ( (*this_).database );
+        result |= data_database_prepared_writer_create_diagram( &((*this_).temp_prepared_writer), diagram, &new_id );
+        result |= data_database_transaction_commit ( (*this_).database );
+    }
 
-    U8_LOG_EVENT_INT( "sqlite3_exec: INSERT INTO diagrams ... ->", new_id );  /* do not log confidential information, only id */
+    U8_LOG_EVENT_INT( "sqlite3_step: INSERT INTO diagrams ... ->", new_id );  /* do not log confidential information, only id */
 
     /* notify listeners */
     data_row_t parent_id;
@@ -150,10 +257,8 @@ u8_error_t data_database_writer_delete_diagram( data_database_writer_t *this_,
     }
     else
     {
-        result |= data_database_sql_builder_build_delete_diagram_command ( &((*this_).sql_builder), obj_id );
-        char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-        result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-        U8_LOG_EVENT_INT( "sqlite3_exec: DELETE FROM diagrams ... ->", obj_id );  /* do not log confidential information, only id */
+        result |= data_database_writer_private_delete( this_, DATA_TABLE_DIAGRAM, obj_id );
+        U8_LOG_EVENT_INT( "sqlite3_step: DELETE FROM diagrams ... ->", obj_id );  /* do not log confidential information, only id */
     }
 
     result |= data_database_transaction_commit ( (*this_).database );
@@ -185,11 +290,8 @@ u8_error_t data_database_writer_update_diagram_type ( data_database_writer_t *th
         result |= data_database_reader_get_diagram_by_id ( (*this_).db_reader, diagram_id, out_old_diagram );
     }
 
-    result |= data_database_sql_builder_build_update_diagram_type_cmd( &((*this_).sql_builder), diagram_id, new_diagram_type );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE diagrams SET diagram_type ... ->", diagram_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_TYPE, diagram_id, new_diagram_type );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE diagrams SET diagram_type ... ->", diagram_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -221,11 +323,8 @@ u8_error_t data_database_writer_update_diagram_stereotype ( data_database_writer
         result |= data_database_reader_get_diagram_by_id ( (*this_).db_reader, diagram_id, out_old_diagram );
     }
 
-    result |= data_database_sql_builder_build_update_diagram_stereotype_cmd( &((*this_).sql_builder), diagram_id, new_diagram_stereotype );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE diagrams SET stereotype ... ->", diagram_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_STEREOTYPE, diagram_id, new_diagram_stereotype, DATA_DIAGRAM_MAX_STEREOTYPE_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE diagrams SET stereotype ... ->", diagram_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -257,11 +356,8 @@ u8_error_t data_database_writer_update_diagram_name ( data_database_writer_t *th
         result |= data_database_reader_get_diagram_by_id ( (*this_).db_reader, diagram_id, out_old_diagram );
     }
 
-    result |= data_database_sql_builder_build_update_diagram_name_cmd( &((*this_).sql_builder), diagram_id, new_diagram_name );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE diagrams SET name ... ->", diagram_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_NAME, diagram_id, new_diagram_name, DATA_DIAGRAM_MAX_NAME_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE diagrams SET name ... ->", diagram_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -293,11 +389,8 @@ u8_error_t data_database_writer_update_diagram_description ( data_database_write
         result |= data_database_reader_get_diagram_by_id ( (*this_).db_reader, diagram_id, out_old_diagram );
     }
 
-    result |= data_database_sql_builder_build_update_diagram_description_cmd( &((*this_).sql_builder), diagram_id, new_diagram_description );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE diagrams SET description ... ->", diagram_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_DESCRIPTION, diagram_id, new_diagram_description, DATA_DIAGRAM_MAX_DESCRIPTION_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE diagrams SET description ... ->", diagram_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -328,11 +421,8 @@ u8_error_t data_database_writer_update_diagram_list_order ( data_database_writer
         result |= data_database_reader_get_diagram_by_id ( (*this_).db_reader, diagram_id, out_old_diagram );
     }
 
-    result |= data_database_sql_builder_build_update_diagram_list_order_cmd( &((*this_).sql_builder), diagram_id, new_diagram_list_order );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE diagrams SET list_order ... ->", diagram_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_LIST_ORDER, diagram_id, new_diagram_list_order );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE diagrams SET list_order ... ->", diagram_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -363,11 +453,8 @@ u8_error_t data_database_writer_update_diagram_parent_id ( data_database_writer_
         result |= data_database_reader_get_diagram_by_id ( (*this_).db_reader, diagram_id, out_old_diagram );
     }
 
-    result |= data_database_sql_builder_build_update_diagram_parent_id_cmd( &((*this_).sql_builder), diagram_id, new_diagram_parent_id );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE diagrams SET parent_id ... ->", diagram_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_ref( this_, DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAM_PARENT_ID, diagram_id, new_diagram_parent_id );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE diagrams SET parent_id ... ->", diagram_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -395,13 +482,23 @@ u8_error_t data_database_writer_create_classifier( data_database_writer_t *this_
     u8_error_t result = U8_ERROR_NONE;
     data_row_t new_id = DATA_ROW_VOID;
 
-    result |= data_database_sql_builder_build_create_classifier_command( &((*this_).sql_builder), classifier );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_transaction_begin ( (*this_).database );
-    result |= data_database_in_transaction_create( (*this_).database, sql_cmd, &new_id );
-    result |= data_database_transaction_commit ( (*this_).database );
-    U8_LOG_EVENT_INT( "sqlite3_exec: INSERT INTO classifiers ... ->", new_id );  /* do not log confidential information, only id */
+    if ( ! (*this_).is_open )
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot create record." );
+    }
+    else if ( (*this_).bulk_mode )
+    {
+        /* the caller is responsible for an outer transaction */
+        result |= data_database_prepared_writer_create_classifier( &((*this_).temp_prepared_writer), classifier, &new_id );
+    }
+    else
+    {
+        result |= data_database_transaction_begin ( (*this_).database );
+        result |= data_database_prepared_writer_create_classifier( &((*this_).temp_prepared_writer), classifier, &new_id );
+        result |= data_database_transaction_commit ( (*this_).database );
+    }
+    U8_LOG_EVENT_INT( "sqlite3_step: INSERT INTO classifiers ... ->", new_id );  /* do not log confidential information, only id */
 
     /* notify listeners */
     data_change_notifier_emit_signal( data_database_get_notifier_ptr( (*this_).database ),
@@ -483,10 +580,8 @@ u8_error_t data_database_writer_delete_classifier( data_database_writer_t *this_
     }
     else
     {
-        result |= data_database_sql_builder_build_delete_classifier_command ( &((*this_).sql_builder), obj_id );
-        char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-        result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-        U8_LOG_EVENT_INT( "sqlite3_exec: DELETE FROM classifiers ... ->", obj_id );  /* do not log confidential information, only id */
+        result |= data_database_writer_private_delete( this_, DATA_TABLE_CLASSIFIER, obj_id );
+        U8_LOG_EVENT_INT( "sqlite3_step: DELETE FROM classifiers ... ->", obj_id );  /* do not log confidential information, only id */
     }
 
     result |= data_database_transaction_commit ( (*this_).database );
@@ -518,11 +613,8 @@ u8_error_t data_database_writer_update_classifier_main_type ( data_database_writ
         result |= data_database_reader_get_classifier_by_id ( (*this_).db_reader, classifier_id, out_old_classifier );
     }
 
-    result |= data_database_sql_builder_build_update_classifier_main_type_cmd( &((*this_).sql_builder), classifier_id, new_classifier_main_type );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE classifiers SET main_type ... ->", classifier_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_MAIN_TYPE, classifier_id, new_classifier_main_type );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE classifiers SET main_type ... ->", classifier_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -553,11 +645,8 @@ u8_error_t data_database_writer_update_classifier_stereotype ( data_database_wri
         result |= data_database_reader_get_classifier_by_id ( (*this_).db_reader, classifier_id, out_old_classifier );
     }
 
-    result |= data_database_sql_builder_build_update_classifier_stereotype_cmd( &((*this_).sql_builder), classifier_id, new_classifier_stereotype );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE classifiers SET stereotype ... ->", classifier_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_STEREOTYPE, classifier_id, new_classifier_stereotype, DATA_CLASSIFIER_MAX_STEREOTYPE_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE classifiers SET stereotype ... ->", classifier_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -588,11 +677,8 @@ u8_error_t data_database_writer_update_classifier_name ( data_database_writer_t
         result |= data_database_reader_get_classifier_by_id ( (*this_).db_reader, classifier_id, out_old_classifier );
     }
 
-    result |= data_database_sql_builder_build_update_classifier_name_cmd( &((*this_).sql_builder), classifier_id, new_classifier_name );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE classifiers SET name ... ->", classifier_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_NAME, classifier_id, new_classifier_name, DATA_CLASSIFIER_MAX_NAME_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE classifiers SET name ... ->", classifier_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -623,11 +709,8 @@ u8_error_t data_database_writer_update_classifier_description ( data_database_wr
         result |= data_database_reader_get_classifier_by_id ( (*this_).db_reader, classifier_id, out_old_classifier );
     }
 
-    result |= data_database_sql_builder_build_update_classifier_description_cmd( &((*this_).sql_builder), classifier_id, new_classifier_description );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE classifiers SET description ... ->", classifier_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_DESCRIPTION, classifier_id, new_classifier_description, DATA_CLASSIFIER_MAX_DESCRIPTION_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE classifiers SET description ... ->", classifier_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -658,11 +741,8 @@ u8_error_t data_database_writer_update_classifier_x_order ( data_database_writer
         result |= data_database_reader_get_classifier_by_id ( (*this_).db_reader, classifier_id, out_old_classifier );
     }
 
-    result |= data_database_sql_builder_build_update_classifier_x_order_cmd( &((*this_).sql_builder), classifier_id, new_classifier_x_order );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE classifiers SET x_order ... ->", classifier_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_X_ORDER, classifier_id, new_classifier_x_order );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE classifiers SET x_order ... ->", classifier_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -693,11 +773,8 @@ u8_error_t data_database_writer_update_classifier_y_order ( data_database_writer
         result |= data_database_reader_get_classifier_by_id ( (*this_).db_reader, classifier_id, out_old_classifier );
     }
 
-    result |= data_database_sql_builder_build_update_classifier_y_order_cmd( &((*this_).sql_builder), classifier_id, new_classifier_y_order );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE classifiers SET y_order ... ->", classifier_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_Y_ORDER, classifier_id, new_classifier_y_order );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE classifiers SET y_order ... ->", classifier_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -728,11 +805,8 @@ u8_error_t data_database_writer_update_classifier_list_order ( data_database_wri
         result |= data_database_reader_get_classifier_by_id ( (*this_).db_reader, classifier_id, out_old_classifier );
     }
 
-    result |= data_database_sql_builder_build_update_classifier_list_order_cmd( &((*this_).sql_builder), classifier_id, new_classifier_list_order );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE classifiers SET list_order ... ->", classifier_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_LIST_ORDER, classifier_id, new_classifier_list_order );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE classifiers SET list_order ... ->", classifier_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -758,13 +832,23 @@ u8_error_t data_database_writer_create_diagramelement( data_database_writer_t *t
     u8_error_t result = U8_ERROR_NONE;
     data_row_t new_id = DATA_ROW_VOID;
 
-    result |= data_database_sql_builder_build_create_diagramelement_command( &((*this_).sql_builder), diagramelement );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_transaction_begin ( (*this_).database );
-    result |= data_database_in_transaction_create( (*this_).database, sql_cmd, &new_id );
-    result |= data_database_transaction_commit ( (*this_).database );
-    U8_LOG_EVENT_INT( "sqlite3_exec: INSERT INTO diagramelements ... ->", new_id );  /* do not log confidential information, only id */
+    if ( ! (*this_).is_open )
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot create record." );
+    }
+    else if ( (*this_).bulk_mode )
+    {
+        /* the caller is responsible for an outer transaction */
+        result |= data_database_prepared_writer_create_diagramelement( &((*this_).temp_prepared_writer), diagramelement, &new_id );
+    }
+    else
+    {
+        result |= data_database_transaction_begin ( (*this_).database );
+        result |= data_database_prepared_writer_create_diagramelement( &((*this_).temp_prepared_writer), diagramelement, &new_id );
+        result |= data_database_transaction_commit ( (*this_).database );
+    }
+    U8_LOG_EVENT_INT( "sqlite3_step: INSERT INTO diagramelements ... ->", new_id );  /* do not log confidential information, only id */
 
     /* notify listeners */
     data_row_t diagram_id;
@@ -801,11 +885,8 @@ u8_error_t data_database_writer_delete_diagramelement( data_database_writer_t *t
         result |= data_database_reader_get_diagramelement_by_id ( (*this_).db_reader, obj_id, out_old_diagramelement );
     }
 
-    result |= data_database_sql_builder_build_delete_diagramelement_command ( &((*this_).sql_builder), obj_id );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: DELETE FROM diagramelements ... ->", obj_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_delete( this_, DATA_TABLE_DIAGRAMELEMENT, obj_id );
+    U8_LOG_EVENT_INT( "sqlite3_step: DELETE FROM diagramelements ... ->", obj_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -836,11 +917,8 @@ u8_error_t data_database_writer_update_diagramelement_display_flags ( data_datab
         result |= data_database_reader_get_diagramelement_by_id ( (*this_).db_reader, diagramelement_id, out_old_diagramelement );
     }
 
-    result |= data_database_sql_builder_build_update_diagramelement_display_flags_cmd( &((*this_).sql_builder), diagramelement_id, new_display_flags );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE diagramelements SET display_flags ... ->", diagramelement_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAMELEMENT_DISPLAY_FLAGS, diagramelement_id, new_display_flags );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE diagramelements SET display_flags ... ->", diagramelement_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -871,11 +949,8 @@ u8_error_t data_database_writer_update_diagramelement_focused_feature_id ( data_
         result |= data_database_reader_get_diagramelement_by_id ( (*this_).db_reader, diagramelement_id, out_old_diagramelement );
     }
 
-    result |= data_database_sql_builder_build_update_diagramelement_focused_feature_id_cmd( &((*this_).sql_builder), diagramelement_id, new_focused_feature_id );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE diagramelements SET focused_feature_id ... ->", diagramelement_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_ref( this_, DATA_DATABASE_PREPARED_WRITER_COL_DIAGRAMELEMENT_FOCUSED_FEATURE_ID, diagramelement_id, new_focused_feature_id );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE diagramelements SET focused_feature_id ... ->", diagramelement_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -899,13 +974,23 @@ u8_error_t data_database_writer_create_feature ( data_database_writer_t *this_,
     u8_error_t result = U8_ERROR_NONE;
     data_row_t new_id = DATA_ROW_VOID;
 
-    result |= data_database_sql_builder_build_create_feature_command( &((*this_).sql_builder), feature );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_transaction_begin ( (*this_).database );
-    result |= data_database_in_transaction_create( (*this_).database, sql_cmd, &new_id );
-    result |= data_database_transaction_commit ( (*this_).database );
-    U8_LOG_EVENT_INT( "sqlite3_exec: INSERT INTO features ... ->", new_id );  /* do not log confidential information, only id */
+    if ( ! (*this_).is_open )
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot create record." );
+    }
+    else if ( (*this_).bulk_mode )
+    {
+        /* the caller is responsible for an outer transaction */
+        result |= data_database_prepared_writer_create_feature( &((*this_).temp_prepared_writer), feature, &new_id );
+    }
+    else
+    {
+        result |= data_database_transaction_begin ( (*this_).database );
+        result |= data_database_prepared_writer_create_feature( &((*this_).temp_prepared_writer), feature, &new_id );
+        result |= data_database_transaction_commit ( (*this_).database );
+    }
+    U8_LOG_EVENT_INT( "sqlite3_step: INSERT INTO features ... ->", new_id );  /* do not log confidential information, only id */
 
     /* notify listeners */
     data_row_t classifier_id;
@@ -940,11 +1025,8 @@ u8_error_t data_database_writer_delete_feature ( data_database_writer_t *this_,
         result |= data_database_reader_get_feature_by_id ( (*this_).db_reader, obj_id, out_old_feature );
     }
 
-    result |= data_database_sql_builder_build_delete_feature_command ( &((*this_).sql_builder), obj_id );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: DELETE FROM features ... ->", obj_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_delete( this_, DATA_TABLE_FEATURE, obj_id );
+    U8_LOG_EVENT_INT( "sqlite3_step: DELETE FROM features ... ->", obj_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -972,11 +1054,8 @@ u8_error_t data_database_writer_update_feature_main_type ( data_database_writer_
         result |= data_database_reader_get_feature_by_id ( (*this_).db_reader, feature_id, out_old_feature );
     }
 
-    result |= data_database_sql_builder_build_update_feature_main_type_cmd( &((*this_).sql_builder), feature_id, new_feature_type );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE features SET main_type ... ->", feature_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_MAIN_TYPE, feature_id, new_feature_type );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE features SET main_type ... ->", feature_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1004,11 +1083,8 @@ u8_error_t data_database_writer_update_feature_key ( data_database_writer_t *thi
         result |= data_database_reader_get_feature_by_id ( (*this_).db_reader, feature_id, out_old_feature );
     }
 
-    result |= data_database_sql_builder_build_update_feature_key_cmd( &((*this_).sql_builder), feature_id, new_feature_key );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE features SET key ... ->", feature_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_KEY, feature_id, new_feature_key, DATA_FEATURE_MAX_KEY_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE features SET key ... ->", feature_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1036,11 +1112,8 @@ u8_error_t data_database_writer_update_feature_value ( data_database_writer_t *t
         result |= data_database_reader_get_feature_by_id ( (*this_).db_reader, feature_id, out_old_feature );
     }
 
-    result |= data_database_sql_builder_build_update_feature_value_cmd( &((*this_).sql_builder), feature_id, new_feature_value );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE features SET value ... ->", feature_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_VALUE, feature_id, new_feature_value, DATA_FEATURE_MAX_VALUE_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE features SET value ... ->", feature_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1068,11 +1141,8 @@ u8_error_t data_database_writer_update_feature_description ( data_database_write
         result |= data_database_reader_get_feature_by_id ( (*this_).db_reader, feature_id, out_old_feature );
     }
 
-    result |= data_database_sql_builder_build_update_feature_description_cmd( &((*this_).sql_builder), feature_id, new_feature_description );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE features SET description ... ->", feature_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_DESCRIPTION, feature_id, new_feature_description, DATA_FEATURE_MAX_DESCRIPTION_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE features SET description ... ->", feature_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1100,11 +1170,8 @@ u8_error_t data_database_writer_update_feature_list_order ( data_database_writer
         result |= data_database_reader_get_feature_by_id ( (*this_).db_reader, feature_id, out_old_feature );
     }
 
-    result |= data_database_sql_builder_build_update_feature_list_order_cmd( &((*this_).sql_builder), feature_id, new_feature_list_order );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE features SET list_order ... ->", feature_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_FEATURE_LIST_ORDER, feature_id, new_feature_list_order );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE features SET list_order ... ->", feature_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1128,13 +1195,23 @@ u8_error_t data_database_writer_create_relationship ( data_database_writer_t *th
     u8_error_t result = U8_ERROR_NONE;
     data_row_t new_id = DATA_ROW_VOID;
 
-    result |= data_database_sql_builder_build_create_relationship_command( &((*this_).sql_builder), relationship );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_transaction_begin ( (*this_).database );
-    result |= data_database_in_transaction_create( (*this_).database, sql_cmd, &new_id );
-    result |= data_database_transaction_commit ( (*this_).database );
-    U8_LOG_EVENT_INT( "sqlite3_exec: INSERT INTO relationships ... ->", new_id );  /* do not log confidential information, only id */
+    if ( ! (*this_).is_open )
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot create record." );
+    }
+    else if ( (*this_).bulk_mode )
+    {
+        /* the caller is responsible for an outer transaction */
+        result |= data_database_prepared_writer_create_relationship( &((*this_).temp_prepared_writer), relationship, &new_id );
+    }
+    else
+    {
+        result |= data_database_transaction_begin ( (*this_).database );
+        result |= data_database_prepared_writer_create_relationship( &((*this_).temp_prepared_writer), relationship, &new_id );
+        result |= data_database_transaction_commit ( (*this_).database );
+    }
+    U8_LOG_EVENT_INT( "sqlite3_step: INSERT INTO relationships ... ->", new_id );  /* do not log confidential information, only id */
 
     /* notify listeners */
     data_row_t from_classifier_id;
@@ -1169,11 +1246,8 @@ u8_error_t data_database_writer_delete_relationship ( data_database_writer_t *th
         result |= data_database_reader_get_relationship_by_id ( (*this_).db_reader, obj_id, out_old_relationship );
     }
 
-    result |= data_database_sql_builder_build_delete_relationship_command ( &((*this_).sql_builder), obj_id );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: DELETE FROM relationships ... ->", obj_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_delete( this_, DATA_TABLE_RELATIONSHIP, obj_id );
+    U8_LOG_EVENT_INT( "sqlite3_step: DELETE FROM relationships ... ->", obj_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1204,11 +1278,8 @@ u8_error_t data_database_writer_update_relationship_main_type ( data_database_wr
         result |= data_database_reader_get_relationship_by_id ( (*this_).db_reader, relationship_id, out_old_relationship );
     }
 
-    result |= data_database_sql_builder_build_update_relationship_main_type_cmd( &((*this_).sql_builder), relationship_id, new_relationship_type );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE relationships SET main_type ... ->", relationship_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_MAIN_TYPE, relationship_id, new_relationship_type );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE relationships SET main_type ... ->", relationship_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1239,11 +1310,8 @@ u8_error_t data_database_writer_update_relationship_stereotype ( data_database_w
         result |= data_database_reader_get_relationship_by_id ( (*this_).db_reader, relationship_id, out_old_relationship );
     }
 
-    result |= data_database_sql_builder_build_update_relationship_stereotype_cmd( &((*this_).sql_builder), relationship_id, new_relationship_stereotype );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE relationships SET stereotype ... ->", relationship_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_STEREOTYPE, relationship_id, new_relationship_stereotype, DATA_RELATIONSHIP_MAX_STEREOTYPE_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE relationships SET stereotype ... ->", relationship_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1274,11 +1342,8 @@ u8_error_t data_database_writer_update_relationship_name ( data_database_writer_
         result |= data_database_reader_get_relationship_by_id ( (*this_).db_reader, relationship_id, out_old_relationship );
     }
 
-    result |= data_database_sql_builder_build_update_relationship_name_cmd( &((*this_).sql_builder), relationship_id, new_relationship_name );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE relationships SET name ... ->", relationship_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_NAME, relationship_id, new_relationship_name, DATA_RELATIONSHIP_MAX_NAME_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE relationships SET name ... ->", relationship_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1306,11 +1371,8 @@ u8_error_t data_database_writer_update_relationship_description ( data_database_
         result |= data_database_reader_get_relationship_by_id ( (*this_).db_reader, relationship_id, out_old_relationship );
     }
 
-    result |= data_database_sql_builder_build_update_relationship_description_cmd( &((*this_).sql_builder), relationship_id, new_relationship_description );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE relationships SET description ... ->", relationship_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_text( this_, DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_DESCRIPTION, relationship_id, new_relationship_description, DATA_RELATIONSHIP_MAX_DESCRIPTION_LENGTH );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE relationships SET description ... ->", relationship_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1338,11 +1400,8 @@ u8_error_t data_database_writer_update_relationship_list_order ( data_database_w
         result |= data_database_reader_get_relationship_by_id ( (*this_).db_reader, relationship_id, out_old_relationship );
     }
 
-    result |= data_database_sql_builder_build_update_relationship_list_order_cmd( &((*this_).sql_builder), relationship_id, new_relationship_list_order );
-    char *sql_cmd = data_database_sql_builder_get_string_ptr( &((*this_).sql_builder) );
-
-    result |= data_database_in_transaction_execute( (*this_).database, sql_cmd );
-    U8_LOG_EVENT_INT( "sqlite3_exec: UPDATE relationships SET list_order ... ->", relationship_id );  /* do not log confidential information, only id */
+    result |= data_database_writer_private_update_int( this_, DATA_DATABASE_PREPARED_WRITER_COL_RELATIONSHIP_LIST_ORDER, relationship_id, new_relationship_list_order );
+    U8_LOG_EVENT_INT( "sqlite3_step: UPDATE relationships SET list_order ... ->", relationship_id );  /* do not log confidential information, only id */
 
     result |= data_database_transaction_commit ( (*this_).database );
 
@@ -1357,6 +1416,141 @@ u8_error_t data_database_writer_update_relationship_list_order ( data_database_w
     return result;
 }
 
+/* ================================ private ================================ */
+
+u8_error_t data_database_writer_private_open ( data_database_writer_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( ! (*this_).is_open )
+    {
+        result |= data_database_prepared_writer_init( &((*this_).temp_prepared_writer), (*this_).database );
+        if ( result == U8_ERROR_NONE )
+        {
+            (*this_).is_open = true;
+        }
+        else
+        {
+            data_database_prepared_writer_destroy( &((*this_).temp_prepared_writer) );
+        }
+    }
+    else
+    {
+        result |= U8_ERROR_INVALID_REQUEST;
+        U8_LOG_WARNING( "Database is already open." );
+    }
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
+u8_error_t data_database_writer_private_close ( data_database_writer_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).is_open )
+    {
+        result |= data_database_prepared_writer_destroy( &((*this_).temp_prepared_writer) );
+        (*this_).is_open = false;
+    }
+    else
+    {
+        result |= U8_ERROR_INVALID_REQUEST;
+        U8_LOG_WARNING( "Database was not open." );
+    }
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
+u8_error_t data_database_writer_private_delete ( data_database_writer_t *this_, data_table_t table, data_row_t obj_id )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).is_open )
+    {
+        result |= data_database_prepared_writer_delete( &((*this_).temp_prepared_writer), table, obj_id );
+    }
+    else
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot delete record." );
+    }
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
+u8_error_t data_database_writer_private_update_int ( data_database_writer_t *this_,
+                                                     data_database_prepared_writer_column_t column,
+                                                     data_row_t obj_id,
+                                                     int64_t new_value )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).is_open )
+    {
+        result |= data_database_prepared_writer_update_int( &((*this_).temp_prepared_writer), column, obj_id, new_value );
+    }
+    else
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot update record." );
+    }
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
+u8_error_t data_database_writer_private_update_ref ( data_database_writer_t *this_,
+                                                     data_database_prepared_writer_column_t column,
+                                                     data_row_t obj_id,
+                                                     data_row_t new_ref_id )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).is_open )
+    {
+        result |= data_database_prepared_writer_update_ref( &((*this_).temp_prepared_writer), column, obj_id, new_ref_id );
+    }
+    else
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot update record." );
+    }
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
+u8_error_t data_database_writer_private_update_text ( data_database_writer_t *this_,
+                                                      data_database_prepared_writer_column_t column,
+                                                      data_row_t obj_id,
+                                                      const char *new_text,
+                                                      size_t max_length )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).is_open )
+    {
+        result |= data_database_prepared_writer_update_text( &((*this_).temp_prepared_writer), column, obj_id, new_text, max_length );
+    }
+    else
+    {
+        result |= U8_ERROR_NO_DB;
+        U8_TRACE_INFO( "Database not open, cannot update record." );
+    }
+
+    U8_TRACE_END_ERR(result);
+    return result;
+}
+
 
 /*
 Copyright 2016-2026 Andreas Warnke
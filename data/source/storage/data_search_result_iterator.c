@@ -253,6 +253,28 @@ const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_DIAGRAM_BY_TEXTFRAGMENT =
 "OR stereotype LIKE ? ESCAPE \"\\\" "
 "OR description LIKE ? ESCAPE \"\\\";";
 
+/*!
+ *  \brief predefined search statement to find diagrams by a match expression on the full-text search index
+ *         and by a LIKE pattern
+ *
+ *  The result columns are the same as in DATA_SEARCH_RESULT_ITERATOR_SELECT_DIAGRAM_BY_TEXTFRAGMENT.
+ *  Parameter ?1 is the fts5 match expression, ?2 the LIKE pattern.
+ *  Hits of the index come first, ranked by bm25 which weights matches in the name higher than
+ *  matches in stereotype and description; substrings that are not at word starts follow.
+ *  LIMIT -1 prevents that the subquery is flattened: bm25 can only be evaluated within the fts5 query.
+ */
+const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_DIAGRAM_BY_SEARCH_INDEX =
+"SELECT diagrams.id,diagrams.diagram_type,diagrams.name "
+"FROM diagrams "
+"LEFT JOIN (SELECT rowid AS hit_id,bm25(diagrams_fts,10.0,2.0,1.0) AS hit_rank "
+"FROM diagrams_fts WHERE diagrams_fts MATCH ?1 LIMIT -1) AS hits "
+"ON diagrams.id=hits.hit_id "
+"WHERE hits.hit_id NOT NULL "
+"OR diagrams.name LIKE ?2 ESCAPE \"\\\" "
+"OR diagrams.stereotype LIKE ?2 ESCAPE \"\\\" "
+"OR diagrams.description LIKE ?2 ESCAPE \"\\\" "
+"ORDER BY (hits.hit_rank ISNULL),hits.hit_rank,diagrams.id;";
+
 /*!
  *  \brief the column id of the result where this parameter is stored: id
  */
@@ -307,6 +329,28 @@ const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_CLASSIFIER_BY_TEXTFRAGMENT
 "OR classifiers.description LIKE ? ESCAPE \"\\\" "
 "GROUP BY classifiers.id,diagrams.id;";  /* no duplicates if a classifier is twice in a diagram */
 
+/*!
+ *  \brief predefined search statement to find classifiers by a match expression on the full-text search index
+ *         and by a LIKE pattern
+ *
+ *  The result columns are the same as in DATA_SEARCH_RESULT_ITERATOR_SELECT_CLASSIFIER_BY_TEXTFRAGMENT,
+ *  the parameters and the order are the same as in DATA_SEARCH_RESULT_ITERATOR_SELECT_DIAGRAM_BY_SEARCH_INDEX.
+ */
+const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_CLASSIFIER_BY_SEARCH_INDEX =
+"SELECT classifiers.id,classifiers.main_type,classifiers.name,diagrams.id "
+"FROM classifiers "
+"LEFT JOIN (SELECT rowid AS hit_id,bm25(classifiers_fts,10.0,2.0,1.0) AS hit_rank "
+"FROM classifiers_fts WHERE classifiers_fts MATCH ?1 LIMIT -1) AS hits "
+"ON classifiers.id=hits.hit_id "
+"INNER JOIN diagramelements ON diagramelements.classifier_id=classifiers.id "
+"INNER JOIN diagrams ON diagramelements.diagram_id=diagrams.id "
+"WHERE hits.hit_id NOT NULL "
+"OR classifiers.name LIKE ?2 ESCAPE \"\\\" "
+"OR classifiers.stereotype LIKE ?2 ESCAPE \"\\\" "
+"OR classifiers.description LIKE ?2 ESCAPE \"\\\" "
+"GROUP BY classifiers.id,diagrams.id "  /* no duplicates if a classifier is twice in a diagram */
+"ORDER BY (hits.hit_rank ISNULL),hits.hit_rank,classifiers.id,diagrams.id;";
+
 /*!
  *  \brief the column id of the result where this parameter is stored: id
  */
@@ -369,6 +413,30 @@ const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_FEATURE_BY_TEXTFRAGMENT =
 "OR features.description LIKE ? ESCAPE \"\\\" "
 "GROUP BY features.id,diagrams.id;";  /* no duplicates if a classifier is twice in a diagram */
 
+/*!
+ *  \brief predefined search statement to find features by a match expression on the full-text search index
+ *         and by a LIKE pattern
+ *
+ *  The result columns are the same as in DATA_SEARCH_RESULT_ITERATOR_SELECT_FEATURE_BY_TEXTFRAGMENT,
+ *  the parameters and the order are the same as in DATA_SEARCH_RESULT_ITERATOR_SELECT_DIAGRAM_BY_SEARCH_INDEX.
+ */
+const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_FEATURE_BY_SEARCH_INDEX =
+"SELECT features.id,features.main_type,features.key,features.classifier_id,"
+"classifiers.main_type,diagrams.id,diagrams.diagram_type "
+"FROM features "
+"LEFT JOIN (SELECT rowid AS hit_id,bm25(features_fts,10.0,2.0,1.0) AS hit_rank "
+"FROM features_fts WHERE features_fts MATCH ?1 LIMIT -1) AS hits "
+"ON features.id=hits.hit_id "
+"INNER JOIN classifiers ON features.classifier_id=classifiers.id "
+"INNER JOIN diagramelements ON diagramelements.classifier_id=classifiers.id "
+"INNER JOIN diagrams ON diagramelements.diagram_id=diagrams.id "
+"WHERE hits.hit_id NOT NULL "
+"OR features.key LIKE ?2 ESCAPE \"\\\" "
+"OR features.value LIKE ?2 ESCAPE \"\\\" "
+"OR features.description LIKE ?2 ESCAPE \"\\\" "
+"GROUP BY features.id,diagrams.id "  /* no duplicates if a classifier is twice in a diagram */
+"ORDER BY (hits.hit_rank ISNULL),hits.hit_rank,features.id,diagrams.id;";
+
 /*!
  *  \brief the column id of the result where this parameter is stored: id
  */
@@ -478,6 +546,35 @@ const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_RELATIONSHIP_BY_TEXTFRAGMEN
 //"GROUP BY relationships.id,diagrams.id "  /* good: no duplicates if a classifier is twice in a diagram / bad: randomly chosen source and dest --> use DISTINCT */
 "ORDER BY relationships.id,( (source.focused_feature_id ISNULL) AND (dest.focused_feature_id ISNULL) ) ASC;";  /* start with interactions/scenarios */
 
+/*!
+ *  \brief predefined search statement to find relationships by a match expression on the full-text search index
+ *         and by a LIKE pattern
+ *
+ *  The result columns are the same as in DATA_SEARCH_RESULT_ITERATOR_SELECT_RELATIONSHIP_BY_TEXTFRAGMENT,
+ *  the parameters and the order are the same as in DATA_SEARCH_RESULT_ITERATOR_SELECT_DIAGRAM_BY_SEARCH_INDEX.
+ *  Rows of the same relationship stay adjacent because the rank only depends on the relationship.
+ */
+const char *const DATA_SEARCH_RESULT_ITERATOR_SELECT_RELATIONSHIP_BY_SEARCH_INDEX =
+"SELECT DISTINCT relationships.id,relationships.main_type,relationships.name,"
+"relationships.from_classifier_id,relationships.to_classifier_id,"
+"relationships.from_feature_id,relationships.to_feature_id,"
+"source.focused_feature_id,dest.focused_feature_id,"
+"diagrams.id,diagrams.diagram_type "
+"FROM relationships "
+"LEFT JOIN (SELECT rowid AS hit_id,bm25(relationships_fts,10.0,2.0,1.0) AS hit_rank "
+"FROM relationships_fts WHERE relationships_fts MATCH ?1 LIMIT -1) AS hits "
+"ON relationships.id=hits.hit_id "
+"INNER JOIN diagramelements AS source "
+"ON source.classifier_id=relationships.from_classifier_id "
+"INNER JOIN diagramelements AS dest "
+"ON (dest.classifier_id=relationships.to_classifier_id)AND(dest.diagram_id==source.diagram_id) "
+"INNER JOIN diagrams ON source.diagram_id=diagrams.id "
+"WHERE hits.hit_id NOT NULL "
+"OR relationships.name LIKE ?2 ESCAPE \"\\\" "
+"OR relationships.stereotype LIKE ?2 ESCAPE \"\\\" "
+"OR relationships.description LIKE ?2 ESCAPE \"\\\" "
+"ORDER BY (hits.hit_rank ISNULL),hits.hit_rank,relationships.id,( (source.focused_feature_id ISNULL) AND (dest.focused_feature_id ISNULL) ) ASC;";
+
 /*!
  *  \brief the column id of the result where this parameter is stored: id
  */
@@ -0,0 +1,278 @@
+/* File: data_database_profile_test.c; Copyright and License: see below */
+
+#include "data_database_profile_test.h"
+#include "storage/data_database.h"
+#include "storage/data_database_reader.h"
+#include "storage/data_database_writer.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <glib.h>
+#include <sqlite3.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <assert.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t default_profile_is_durable( test_fixture_t *fix );
+static test_case_result_t working_copy_uses_wal( test_fixture_t *fix );
+static test_case_result_t scratch_keeps_journal_in_memory( test_fixture_t *fix );
+static test_case_result_t read_only_keeps_journal_mode( test_fixture_t *fix );
+static test_case_result_t in_memory_keeps_journal_mode( test_fixture_t *fix );
+static test_case_result_t measure_commits_per_profile( test_fixture_t *fix );
+static void query_pragma( data_database_t *database, const char *pragma, char *out_buf, size_t buf_size );
+
+test_suite_t data_database_profile_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "data_database_profile_test",
+                     TEST_CATEGORY_INTEGRATION | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "default_profile_is_durable", &default_profile_is_durable );
+    test_suite_add_test_case( &result, "working_copy_uses_wal", &working_copy_uses_wal );
+    test_suite_add_test_case( &result, "scratch_keeps_journal_in_memory", &scratch_keeps_journal_in_memory );
+    test_suite_add_test_case( &result, "read_only_keeps_journal_mode", &read_only_keeps_journal_mode );
+    test_suite_add_test_case( &result, "in_memory_keeps_journal_mode", &in_memory_keeps_journal_mode );
+    const test_category_t ON_QUEST = TEST_CATEGORY_INTEGRATION | TEST_CATEGORY_QUEST;
+    test_suite_add_special_test_case( &result, "measure_commits_per_profile", ON_QUEST, &measure_commits_per_profile );
+    return result;
+}
+
+/*!
+ *  \brief database filename on which the tests are performed and which is automatically deleted when finished
+ */
+static const char *const DATABASE_FILENAME = "unittest_crystal_facet_uml_profile.cfu1";
+
+/*!
+ *  \brief write-ahead log of DATABASE_FILENAME, exists only while the database is open in wal mode
+ */
+static const char *const DATABASE_WAL_FILENAME = "unittest_crystal_facet_uml_profile.cfu1-wal";
+
+struct test_fixture_struct {
+    data_database_t database;  /*!< database instance on which the tests are performed */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    /* remove old database files first */
+    int err;
+    err = remove( DATABASE_FILENAME );
+    TEST_ENVIRONMENT_ASSERT ( ( 0 == err )|| (( -1 == err )&&( errno == ENOENT )) );
+
+    test_fixture_t *fix = &test_fixture;
+    data_database_init( &((*fix).database) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    if ( data_database_is_open( &((*fix).database) ) )
+    {
+        data_database_close( &((*fix).database) );
+    }
+    data_database_destroy( &((*fix).database) );
+    const int stdio_err = remove( DATABASE_FILENAME );
+    (void) stdio_err;  /* in-memory tests do not create a file */
+}
+
+static void query_pragma( data_database_t *database, const char *pragma, char *out_buf, size_t buf_size )
+{
+    assert( buf_size > 0 );
+    out_buf[0] = '\0';
+    sqlite3_stmt *pragma_statement = NULL;
+    const int prepare_err
+        = sqlite3_prepare_v2( data_database_get_database_ptr( database ), pragma, -1, &pragma_statement, NULL );
+    if (( SQLITE_OK == prepare_err )&&( SQLITE_ROW == sqlite3_step( pragma_statement ) ))
+    {
+        const char *const value = (const char*) sqlite3_column_text( pragma_statement, 0 );
+        snprintf( out_buf, buf_size, "%s", ( NULL == value ) ? "" : value );
+    }
+    sqlite3_finalize( pragma_statement );
+}
+
+static test_case_result_t default_profile_is_durable( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    char value[32];
+
+    TEST_EXPECT_EQUAL_INT( DATA_DATABASE_PROFILE_DURABLE, data_database_get_profile( &((*fix).database) ) );
+    const u8_error_t data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    query_pragma( &((*fix).database), "PRAGMA journal_mode;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "delete", value );
+    query_pragma( &((*fix).database), "PRAGMA synchronous;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "2", value );  /* FULL */
+
+    /* the cache settings are common to all profiles */
+    query_pragma( &((*fix).database), "PRAGMA cache_size;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "-16384", value );
+    query_pragma( &((*fix).database), "PRAGMA temp_store;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "2", value );  /* MEMORY */
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t working_copy_uses_wal( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    char value[32];
+
+    data_database_set_profile( &((*fix).database), DATA_DATABASE_PROFILE_WORKING_COPY );
+    u8_error_t data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    query_pragma( &((*fix).database), "PRAGMA journal_mode;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "wal", value );
+    query_pragma( &((*fix).database), "PRAGMA synchronous;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "1", value );  /* NORMAL */
+
+    data_err = data_database_trace_stats( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* closing the last connection checkpoints and removes the write-ahead log */
+    data_err = data_database_close( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    FILE *const wal_file = fopen( DATABASE_WAL_FILENAME, "rb" );
+    TEST_EXPECT( NULL == wal_file );
+    if ( NULL != wal_file )
+    {
+        fclose( wal_file );
+    }
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t scratch_keeps_journal_in_memory( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    char value[32];
+
+    data_database_set_profile( &((*fix).database), DATA_DATABASE_PROFILE_SCRATCH );
+    const u8_error_t data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    query_pragma( &((*fix).database), "PRAGMA journal_mode;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "memory", value );
+    query_pragma( &((*fix).database), "PRAGMA synchronous;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "0", value );  /* OFF */
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t read_only_keeps_journal_mode( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    char value[32];
+
+    /* create a file with the rollback journal */
+    u8_error_t data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_close( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* a read-only connection cannot switch to wal, the cache settings are applied nonetheless */
+    data_database_set_profile( &((*fix).database), DATA_DATABASE_PROFILE_WORKING_COPY );
+    data_err = data_database_open_read_only( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    query_pragma( &((*fix).database), "PRAGMA journal_mode;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "delete", value );
+    query_pragma( &((*fix).database), "PRAGMA cache_size;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "-16384", value );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t in_memory_keeps_journal_mode( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    char value[32];
+
+    data_database_set_profile( &((*fix).database), DATA_DATABASE_PROFILE_WORKING_COPY );
+    const u8_error_t data_err = data_database_open_in_memory( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    query_pragma( &((*fix).database), "PRAGMA journal_mode;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "memory", value );
+    query_pragma( &((*fix).database), "PRAGMA temp_store;", value, sizeof(value) );
+    TEST_EXPECT_EQUAL_STRING( "2", value );  /* MEMORY */
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t measure_commits_per_profile( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    /* each create is one transaction, similar to one edit in the gui */
+    static const int MEASURE_COUNT = 200;
+    const data_database_profile_t profiles[] = {
+        DATA_DATABASE_PROFILE_DURABLE,
+        DATA_DATABASE_PROFILE_WORKING_COPY,
+        DATA_DATABASE_PROFILE_SCRATCH,
+    };
+    const char *const profile_names[] = { "durable", "working copy", "scratch" };
+
+    for ( unsigned int p_idx = 0; p_idx < 3; p_idx ++ )
+    {
+        const int stdio_err = remove( DATABASE_FILENAME );
+        (void) stdio_err;  /* the first run finds no file */
+        data_database_set_profile( &((*fix).database), profiles[p_idx] );
+        u8_error_t data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+        data_database_reader_t db_reader;
+        data_database_reader_init( &db_reader, &((*fix).database) );
+        data_database_writer_t db_writer;
+        data_database_writer_init( &db_writer, &db_reader, &((*fix).database) );
+
+        const int64_t start = g_get_monotonic_time();
+        for ( int index = 0; index < MEASURE_COUNT; index ++ )
+        {
+            char name[24];
+            snprintf( name, sizeof(name), "class-%d", index );
+            data_classifier_t classifier;
+            data_err = data_classifier_init_new( &classifier, DATA_CLASSIFIER_TYPE_CLASS, "", name, "", index, 0, 0 );
+            data_err |= data_database_writer_create_classifier( &db_writer, &classifier, NULL /*=out_new_id*/ );
+            data_classifier_destroy( &classifier );
+            TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        }
+        const int64_t duration = g_get_monotonic_time() - start;
+
+        data_database_writer_destroy( &db_writer );
+        data_database_reader_destroy( &db_reader );
+        data_err = data_database_close( &((*fix).database) );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+        fprintf( stdout, "    %d x commit (%s): %" PRIi64 "us\n", MEASURE_COUNT, profile_names[p_idx], duration );
+    }
+
+    return TEST_CASE_RESULT_OK;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
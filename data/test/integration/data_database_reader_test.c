@@ -8,6 +8,7 @@
 #include "test_environment_assert.h"
 #include "test_case_result.h"
 #include <errno.h>
+#include <string.h>
 
 static test_fixture_t * set_up();
 static void tear_down( test_fixture_t *fix );
@@ -17,6 +18,9 @@ static test_case_result_t test_search_classifiers( test_fixture_t *fix );
 static test_case_result_t test_search_features( test_fixture_t *fix );
 static test_case_result_t test_search_relationships( test_fixture_t *fix );
 static test_case_result_t test_iterate_over_classifiers( test_fixture_t *fix );
+static test_case_result_t test_create_in_bulk_mode( test_fixture_t *fix );
+static test_case_result_t test_query_plans_use_indices( test_fixture_t *fix );
+static test_case_result_t test_iterate_hierarchical_order( test_fixture_t *fix );
 
 test_suite_t data_database_reader_test_get_suite(void)
 {
@@ -33,6 +37,9 @@ test_suite_t data_database_reader_test_get_suite(void)
     test_suite_add_test_case( &result, "test_search_features", &test_search_features );
     test_suite_add_test_case( &result, "test_search_relationships", &test_search_relationships );
     test_suite_add_test_case( &result, "test_iterate_over_classifiers", &test_iterate_over_classifiers );
+    test_suite_add_test_case( &result, "test_create_in_bulk_mode", &test_create_in_bulk_mode );
+    test_suite_add_test_case( &result, "test_query_plans_use_indices", &test_query_plans_use_indices );
+    test_suite_add_test_case( &result, "test_iterate_hierarchical_order", &test_iterate_hierarchical_order );
     return result;
 }
 
@@ -606,6 +613,308 @@ static test_case_result_t test_iterate_over_classifiers( test_fixture_t *fix )
     return TEST_CASE_RESULT_OK;
 }
 
+static test_case_result_t test_create_in_bulk_mode( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+
+    data_err = data_database_transaction_begin( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_writer_begin_bulk_mode( &((*fix).db_writer) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_writer_begin_bulk_mode( &((*fix).db_writer) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_INVALID_REQUEST, data_err, u8_error_get_name );
+
+    /* create a diagram with a new id */
+    data_diagram_t new_diagram;
+    data_err = data_diagram_init( &new_diagram,
+                                  DATA_ROW_VOID, /*=diagram_id*/
+                                  6, /*=parent_diagram_id*/
+                                  DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM,
+                                  "",  /* stereotype */
+                                  "it's \"bulk\"",
+                                  "",
+                                  10666, /*=list_order*/
+                                  DATA_DIAGRAM_FLAG_NONE,
+                                  "8fbf0c1a-0a3d-4c55-a6e2-0b0d29b2cbc1"
+                                );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t diagram_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_diagram( &((*fix).db_writer), &new_diagram, &diagram_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT( DATA_ROW_VOID != diagram_id );
+
+    /* create a classifier with a known id, reuse the prepared statement for a duplicate */
+    data_classifier_t new_classifier;
+    data_err = data_classifier_init( &new_classifier,
+                                     20, /*=classifier id*/
+                                     DATA_CLASSIFIER_TYPE_CLASS,
+                                     "",
+                                     "name-20",
+                                     "description with 'quotes'",
+                                     100, /*=x_order*/
+                                     200, /*=y_order*/
+                                     300, /*=list_order*/
+                                     "6b0a4a3b-7e5c-4ad5-a5a1-b0b7f2f33e4f"
+                                   );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t classifier_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_classifier( &((*fix).db_writer), &new_classifier, &classifier_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 20, classifier_id );
+    data_err = data_database_writer_create_classifier( &((*fix).db_writer), &new_classifier, NULL /*=out_new_id*/ );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_DUPLICATE, data_err, u8_error_get_name );
+
+    /* create a feature, a diagramelement and a relationship with new ids */
+    data_feature_t new_feature;
+    data_err = data_feature_init( &new_feature,
+                                  DATA_ROW_VOID, /* feature_id */
+                                  DATA_FEATURE_TYPE_OPERATION, /* feature_main_type */
+                                  20, /* classifier_id */
+                                  "run", /* feature_key */
+                                  "void", /* feature_value */
+                                  "", /* feature_description */
+                                  1000, /* list order */
+                                  "b2f1e5e6-0b53-4e0c-a3c2-9b6b66c7a5a2"
+                                );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t feature_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_feature( &((*fix).db_writer), &new_feature, &feature_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    data_diagramelement_t new_diagramelement;
+    data_err = data_diagramelement_init( &new_diagramelement,
+                                         DATA_ROW_VOID, /*=id*/
+                                         diagram_id, /*=diagram_id*/
+                                         20, /*=classifier_id*/
+                                         DATA_DIAGRAMELEMENT_FLAG_NONE,
+                                         feature_id,
+                                         "3a4b7d2e-91f4-4b0c-8d8e-2c7d1f3e9a10"
+                                       );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_err = data_database_writer_create_diagramelement( &((*fix).db_writer), &new_diagramelement, NULL /*=out_new_id*/ );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    data_relationship_t new_relation;
+    data_err = data_relationship_init( &new_relation,
+                                       DATA_ROW_VOID, /* relationship_id */
+                                       20, /* from_classifier_id */
+                                       DATA_ROW_VOID, /* from_feature_id */
+                                       12, /* to_classifier_id */
+                                       17, /* to_feature_id */
+                                       DATA_RELATIONSHIP_TYPE_UML_DEPENDENCY, /* relationship_main_type */
+                                       "",  /* stereotype */
+                                       "uses", /* relationship_name */
+                                       "", /* relationship_description */
+                                       -88000, /* list_order */
+                                       "e0b8a0a1-4a55-4e87-9a4f-3b8f7f0a6d11"
+                                     );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t relationship_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_relationship( &((*fix).db_writer), &new_relation, &relationship_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    data_err = data_database_writer_end_bulk_mode( &((*fix).db_writer) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_transaction_commit( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_writer_end_bulk_mode( &((*fix).db_writer) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_INVALID_REQUEST, data_err, u8_error_get_name );
+
+    /* check that the records are stored as if created in normal mode */
+    data_diagram_t out_diagram;
+    data_err = data_database_reader_get_diagram_by_id( &((*fix).db_reader), diagram_id, &out_diagram );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 6, data_diagram_get_parent_row( &out_diagram ) );
+    TEST_EXPECT_EQUAL_STRING( "it's \"bulk\"", data_diagram_get_name_const( &out_diagram ) );
+
+    data_classifier_t out_classifier;
+    data_err = data_database_reader_get_classifier_by_uuid( &((*fix).db_reader),
+                                                            "6b0a4a3b-7e5c-4ad5-a5a1-b0b7f2f33e4f",
+                                                            &out_classifier
+                                                          );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 20, data_classifier_get_row( &out_classifier ) );
+    TEST_EXPECT_EQUAL_STRING( "description with 'quotes'", data_classifier_get_description_const( &out_classifier ) );
+    TEST_EXPECT_EQUAL_INT( 200, data_classifier_get_y_order( &out_classifier ) );
+
+    data_diagramelement_t out_diagramelement;
+    data_err = data_database_reader_get_diagramelement_by_uuid( &((*fix).db_reader),
+                                                                "3a4b7d2e-91f4-4b0c-8d8e-2c7d1f3e9a10",
+                                                                &out_diagramelement
+                                                              );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( feature_id, data_diagramelement_get_focused_feature_row( &out_diagramelement ) );
+
+    data_relationship_t out_relationship;
+    data_err = data_database_reader_get_relationship_by_id( &((*fix).db_reader), relationship_id, &out_relationship );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( DATA_ROW_VOID, data_relationship_get_from_feature_row( &out_relationship ) );
+    TEST_EXPECT_EQUAL_INT( 17, data_relationship_get_to_feature_row( &out_relationship ) );
+    return TEST_CASE_RESULT_OK;
+}
+
+
+static test_case_result_t test_query_plans_use_indices( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    sqlite3 *const db = data_database_get_database_ptr( &((*fix).database) );
+    const data_database_diagram_reader_t *const diag_reader = &((*fix).db_reader.temp_diagram_reader);
+    const data_database_classifier_reader_t *const class_reader = &((*fix).db_reader.temp_classifier_reader);
+
+    /* queries by uuid (imports) and by foreign key (loading diagrams, deleting elements) shall not scan whole tables */
+    sqlite3_stmt *const hot_queries[] = {
+        (*diag_reader).statement_diagram_by_uuid,
+        (*diag_reader).statement_diagrams_by_parent_id,
+        (*diag_reader).statement_diagrams_by_parent_id_null,
+        (*diag_reader).statement_diagrams_by_classifier_id,
+        (*diag_reader).statement_diagrams_by_relationship_id,
+        (*diag_reader).statement_diagram_ids_by_parent_id,
+        (*diag_reader).statement_diagram_ids_by_parent_id_null,
+        (*diag_reader).statement_diagram_ids_by_classifier_id,
+        (*diag_reader).statement_diagramelement_by_uuid,
+        (*diag_reader).statement_diagramelements_by_diagram_id,
+        (*diag_reader).statement_diagramelements_by_classifier_id,
+        (*diag_reader).statement_visible_classifiers_by_diagram_id,
+        (*class_reader).statement_classifier_by_uuid,
+        (*class_reader).statement_classifier_by_name,
+        (*class_reader).statement_feature_by_uuid,
+        (*class_reader).statement_features_by_classifier_id,
+        (*class_reader).statement_features_by_diagram_id,
+        (*class_reader).statement_relationship_by_uuid,
+        (*class_reader).statement_relationships_by_classifier_id,
+        (*class_reader).statement_relationships_by_feature_id,
+        (*class_reader).statement_relationships_by_diagram_id,
+    };
+    const unsigned int query_count = sizeof(hot_queries) / sizeof(hot_queries[0]);
+
+    for ( unsigned int q_idx = 0; q_idx < query_count; q_idx ++ )
+    {
+        TEST_EXPECT( NULL != hot_queries[q_idx] );
+        char *const explain_sql = sqlite3_mprintf( "EXPLAIN QUERY PLAN %s", sqlite3_sql( hot_queries[q_idx] ) );
+        sqlite3_stmt *explain_stmt = NULL;
+        const int prepare_err = sqlite3_prepare_v2( db, explain_sql, -1, &explain_stmt, NULL );
+        sqlite3_free( explain_sql );
+        TEST_EXPECT_EQUAL_INT( SQLITE_OK, prepare_err );
+
+        /* the 4th column describes the step, a full scan starts with "SCAN " followed by a table name */
+        unsigned int scan_count = 0;
+        while ( SQLITE_ROW == sqlite3_step( explain_stmt ) )
+        {
+            const char *const detail = (const char*) sqlite3_column_text( explain_stmt, 3 );
+            if ( 0 == strncmp( detail, "SCAN ", strlen("SCAN ") ) )
+            {
+                fprintf( stderr, "%s\n  -> %s\n", sqlite3_sql( hot_queries[q_idx] ), detail );
+                scan_count ++;
+            }
+        }
+        sqlite3_finalize( explain_stmt );
+        TEST_EXPECT_EQUAL_INT( 0, scan_count );
+    }
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_iterate_hierarchical_order( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+
+    /* package 22 contains 21 and 20, package 21 contains 20; a dependency does not count as containment */
+    const struct { data_row_t id; const char *name; const char *uuid; } new_classifiers[] = {
+        { .id = 20, .name = "package-20", .uuid = "3f9b3c52-8d6e-4f6a-9a51-0c2f6f0e5d20" },
+        { .id = 21, .name = "package-21", .uuid = "7a0e21d4-5b8c-4c1e-8f3d-2e6b9a4c7d21" },
+        { .id = 22, .name = "package-22", .uuid = "c4d8e6f2-1a3b-4d5e-9f7a-6b8c0d2e4f22" },
+    };
+    for ( unsigned int c_idx = 0; c_idx < 3; c_idx ++ )
+    {
+        data_classifier_t package;
+        data_err = data_classifier_init( &package,
+                                         new_classifiers[c_idx].id,
+                                         DATA_CLASSIFIER_TYPE_PACKAGE,
+                                         "",  /* stereotype */
+                                         new_classifiers[c_idx].name,
+                                         "",  /* description */
+                                         0, /*=x_order*/
+                                         0, /*=y_order*/
+                                         0, /*=list_order*/
+                                         new_classifiers[c_idx].uuid
+                                       );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_err = data_database_writer_create_classifier( &((*fix).db_writer), &package, NULL /*=out_new_id*/ );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_classifier_destroy( &package );
+    }
+    const struct { data_row_t from; data_row_t to; data_relationship_type_t type; const char *uuid; } new_relations[] = {
+        { .from = 22, .to = 21, .type = DATA_RELATIONSHIP_TYPE_UML_CONTAINMENT, .uuid = "0b1c2d3e-4f50-4617-8283-94a5b6c7d840" },
+        { .from = 22, .to = 20, .type = DATA_RELATIONSHIP_TYPE_UML_CONTAINMENT, .uuid = "1c2d3e4f-5061-4728-9394-a5b6c7d8e941" },
+        { .from = 21, .to = 20, .type = DATA_RELATIONSHIP_TYPE_UML_CONTAINMENT, .uuid = "2d3e4f50-6172-4839-a4a5-b6c7d8e9fa42" },
+        { .from = 20, .to = 22, .type = DATA_RELATIONSHIP_TYPE_UML_DEPENDENCY, .uuid = "3e4f5061-7283-494a-b5b6-c7d8e9fa0b43" },
+    };
+    for ( unsigned int r_idx = 0; r_idx < 4; r_idx ++ )
+    {
+        data_relationship_t relation;
+        data_err = data_relationship_init( &relation,
+                                           40 + r_idx, /* relationship_id */
+                                           new_relations[r_idx].from, /* from_classifier_id */
+                                           DATA_ROW_VOID, /* from_feature_id */
+                                           new_relations[r_idx].to, /* to_classifier_id */
+                                           DATA_ROW_VOID, /* to_feature_id */
+                                           new_relations[r_idx].type, /* relationship_main_type */
+                                           "",  /* stereotype */
+                                           "", /* relationship_name */
+                                           "", /* relationship_description */
+                                           0, /* list_order */
+                                           new_relations[r_idx].uuid
+                                         );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_err = data_database_writer_create_relationship( &((*fix).db_writer), &relation, NULL /*=out_new_id*/ );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_relationship_destroy( &relation );
+    }
+
+    /* sorted by count of containment parents, then by id; 13 contains itself */
+    const data_row_t expected_order[] = { 12, 22, 13, 21, 20 };
+    data_classifier_iterator_t classifier_iterator;
+    data_classifier_t out_classifier;
+    data_classifier_iterator_init_empty( &classifier_iterator );
+    data_err = data_database_reader_get_all_classifiers ( &((*fix).db_reader), true, &classifier_iterator );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    for ( unsigned int o_idx = 0; o_idx < 5; o_idx ++ )
+    {
+        TEST_EXPECT( data_classifier_iterator_has_next( &classifier_iterator ) );
+        data_err = data_classifier_iterator_next( &classifier_iterator, &out_classifier );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        TEST_EXPECT_EQUAL_INT( expected_order[o_idx], data_classifier_get_row( &out_classifier ) );
+        data_classifier_destroy( &out_classifier );
+    }
+    TEST_EXPECT( ! data_classifier_iterator_has_next( &classifier_iterator ) );
+    data_err = data_classifier_iterator_destroy( &classifier_iterator );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* the containment parents are counted in one pass, not per classifier */
+    sqlite3 *const db = data_database_get_database_ptr( &((*fix).database) );
+    char *const explain_sql
+        = sqlite3_mprintf( "EXPLAIN QUERY PLAN %s", DATA_CLASSIFIER_ITERATOR_SELECT_ALL_HIERARCHICAL );
+    sqlite3_stmt *explain_stmt = NULL;
+    const int prepare_err = sqlite3_prepare_v2( db, explain_sql, -1, &explain_stmt, NULL );
+    sqlite3_free( explain_sql );
+    TEST_EXPECT_EQUAL_INT( SQLITE_OK, prepare_err );
+    unsigned int correlated_count = 0;
+    while ( SQLITE_ROW == sqlite3_step( explain_stmt ) )
+    {
+        const char *const detail = (const char*) sqlite3_column_text( explain_stmt, 3 );
+        if ( NULL != strstr( detail, "CORRELATED" ) )
+        {
+            correlated_count ++;
+        }
+    }
+    sqlite3_finalize( explain_stmt );
+    TEST_EXPECT_EQUAL_INT( 0, correlated_count );
+
+    return TEST_CASE_RESULT_OK;
+}
+
 
 /*
  * Copyright 2017-2026 Andreas Warnke
@@ -5,7 +5,7 @@
 
 /*!
  *  \file
- *  \brief MODULE TEST for data_database_writer, data_database_sql_builder, data_database and data_database_reader
+ *  \brief MODULE TEST for data_database_writer, data_database_prepared_writer, data_database and data_database_reader
  */
 
 #include "test_suite.h"
@@ -0,0 +1,366 @@
+/* File: data_database_snapshot_test.c; Copyright and License: see below */
+
+#include "data_database_snapshot_test.h"
+#include "storage/data_database_snapshot.h"
+#include "storage/data_database_reader.h"
+#include "storage/data_database_writer.h"
+#include "storage/data_database_text_search.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <glib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <assert.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t open_missing_file( test_fixture_t *fix );
+static test_case_result_t pinned_snapshot_hides_later_edits( test_fixture_t *fix );
+static test_case_result_t rollback_journal_is_not_pinned( test_fixture_t *fix );
+static test_case_result_t read_in_worker_thread( test_fixture_t *fix );
+static test_case_result_t refill_search_index_after_edits( test_fixture_t *fix );
+static void create_classifier( test_fixture_t *fix, data_row_t id );
+static void create_diagram( test_fixture_t *fix, data_row_t id, const char *name );
+static uint32_t count_search_results( data_database_text_search_t *text_search, const char *search_string );
+static gpointer read_classifier( gpointer data );
+
+test_suite_t data_database_snapshot_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "data_database_snapshot_test",
+                     TEST_CATEGORY_INTEGRATION | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "open_missing_file", &open_missing_file );
+    test_suite_add_test_case( &result, "pinned_snapshot_hides_later_edits", &pinned_snapshot_hides_later_edits );
+    test_suite_add_test_case( &result, "rollback_journal_is_not_pinned", &rollback_journal_is_not_pinned );
+    test_suite_add_test_case( &result, "read_in_worker_thread", &read_in_worker_thread );
+    test_suite_add_test_case( &result, "refill_search_index_after_edits", &refill_search_index_after_edits );
+    return result;
+}
+
+/*!
+ *  \brief database filename on which the tests are performed and which is automatically deleted when finished
+ */
+static const char *const DATABASE_FILENAME = "unittest_crystal_facet_uml_snapshot.cfu1";
+
+/*!
+ *  \brief filename of a database that does not exist
+ */
+static const char *const MISSING_FILENAME = "unittest_crystal_facet_uml_snapshot_missing.cfu1";
+
+struct test_fixture_struct {
+    data_database_t database;  /*!< database instance of the editor */
+    data_database_reader_t db_reader;  /*!< database reader of the editor */
+    data_database_writer_t db_writer;  /*!< database writer of the editor */
+    data_database_snapshot_t snapshot;  /*!< snapshot on which the tests are performed */
+    data_row_t thread_read_id;  /*!< id of the classifier that the worker thread reads */
+    u8_error_t thread_result;  /*!< result of the worker thread */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    /* remove old database files first */
+    int err;
+    err = remove( DATABASE_FILENAME );
+    TEST_ENVIRONMENT_ASSERT ( ( 0 == err )|| (( -1 == err )&&( errno == ENOENT )) );
+
+    test_fixture_t *fix = &test_fixture;
+    data_database_init( &((*fix).database) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    if ( data_database_is_open( &((*fix).database) ) )
+    {
+        data_database_writer_destroy( &((*fix).db_writer) );
+        data_database_reader_destroy( &((*fix).db_reader) );
+        data_database_close( &((*fix).database) );
+    }
+    data_database_destroy( &((*fix).database) );
+    const int stdio_err = remove( DATABASE_FILENAME );
+    (void) stdio_err;  /* open_missing_file does not create a file */
+}
+
+static void create_classifier( test_fixture_t *fix, data_row_t id )
+{
+    char name[24];
+    snprintf( name, sizeof(name), "class-%d", (int) id );
+    char uuid[40];
+    snprintf( uuid, sizeof(uuid), "00000000-0000-4000-8000-%012d", (int) id );
+    data_classifier_t classifier;
+    u8_error_t data_err = data_classifier_init( &classifier, id, DATA_CLASSIFIER_TYPE_CLASS, "", name, "", 0, 0, 0, uuid );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_err = data_database_writer_create_classifier( &((*fix).db_writer), &classifier, NULL /*=out_new_id*/ );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_classifier_destroy( &classifier );
+}
+
+static void create_diagram( test_fixture_t *fix, data_row_t id, const char *name )
+{
+    char uuid[40];
+    snprintf( uuid, sizeof(uuid), "00000000-0000-4000-9000-%012d", (int) id );
+    data_diagram_t diagram;
+    u8_error_t data_err = data_diagram_init( &diagram,
+                                             id,
+                                             DATA_ROW_VOID,
+                                             DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM,
+                                             "",
+                                             name,
+                                             "",
+                                             0,
+                                             DATA_DIAGRAM_FLAG_NONE,
+                                             uuid
+                                           );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_err = data_database_writer_create_diagram( &((*fix).db_writer), &diagram, NULL /*=out_new_id*/ );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_diagram_destroy( &diagram );
+}
+
+static uint32_t count_search_results( data_database_text_search_t *text_search, const char *search_string )
+{
+    uint32_t count = 0;
+    data_search_result_iterator_t search_result_iterator;
+    data_search_result_iterator_init_empty( &search_result_iterator );
+    u8_error_t data_err
+        = data_database_text_search_get_objects_by_text_fragment( text_search, search_string, &search_result_iterator );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    while ( data_search_result_iterator_has_next( &search_result_iterator ) )
+    {
+        data_search_result_t search_result;
+        data_err = data_search_result_iterator_next( &search_result_iterator, &search_result );
+        TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+        count ++;
+    }
+    data_err = data_search_result_iterator_destroy( &search_result_iterator );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    return count;
+}
+
+static test_case_result_t open_missing_file( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+
+    data_err = data_database_snapshot_init( &((*fix).snapshot), MISSING_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NO_DB, data_err, u8_error_get_name );
+
+    /* the reader is usable but has no data */
+    data_classifier_t classifier;
+    data_err = data_database_reader_get_classifier_by_id( data_database_snapshot_get_reader_ptr( &((*fix).snapshot) ),
+                                                          1,
+                                                          &classifier
+                                                        );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NO_DB, data_err, u8_error_get_name );
+    data_err = data_database_snapshot_pin( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NO_DB, data_err, u8_error_get_name );
+    TEST_EXPECT( ! data_database_snapshot_is_pinned( &((*fix).snapshot) ) );
+
+    data_err = data_database_snapshot_destroy( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t pinned_snapshot_hides_later_edits( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+    data_classifier_t classifier;
+
+    /* open the editor's database as working copy */
+    data_database_set_profile( &((*fix).database), DATA_DATABASE_PROFILE_WORKING_COPY );
+    data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_database_reader_init( &((*fix).db_reader), &((*fix).database) );
+    data_database_writer_init( &((*fix).db_writer), &((*fix).db_reader), &((*fix).database) );
+    create_classifier( fix, 1 );
+
+    /* pin a snapshot */
+    data_err = data_database_snapshot_init( &((*fix).snapshot), data_database_get_filename_ptr( &((*fix).database) ) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_snapshot_pin( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT( data_database_snapshot_is_pinned( &((*fix).snapshot) ) );
+    data_err = data_database_snapshot_pin( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_INVALID_REQUEST, data_err, u8_error_get_name );
+
+    /* the editor is not blocked by the snapshot */
+    create_classifier( fix, 2 );
+
+    /* the snapshot sees the state at pinning */
+    data_database_reader_t *const snapshot_reader = data_database_snapshot_get_reader_ptr( &((*fix).snapshot) );
+    data_err = data_database_reader_get_classifier_by_id( snapshot_reader, 1, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_classifier_destroy( &classifier );
+    data_err = data_database_reader_get_classifier_by_id( snapshot_reader, 2, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_DB_STRUCTURE, data_err, u8_error_get_name );
+
+    /* after release, the current state is visible */
+    data_err = data_database_snapshot_release( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT( ! data_database_snapshot_is_pinned( &((*fix).snapshot) ) );
+    data_err = data_database_reader_get_classifier_by_id( snapshot_reader, 2, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_classifier_destroy( &classifier );
+
+    data_err = data_database_snapshot_destroy( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t rollback_journal_is_not_pinned( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+    data_classifier_t classifier;
+
+    /* open the editor's database with the rollback journal */
+    data_database_set_profile( &((*fix).database), DATA_DATABASE_PROFILE_DURABLE );
+    data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_database_reader_init( &((*fix).db_reader), &((*fix).database) );
+    data_database_writer_init( &((*fix).db_writer), &((*fix).db_reader), &((*fix).database) );
+
+    data_err = data_database_snapshot_init( &((*fix).snapshot), data_database_get_filename_ptr( &((*fix).database) ) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_snapshot_pin( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT( ! data_database_snapshot_is_pinned( &((*fix).snapshot) ) );
+
+    /* the editor is not blocked, the snapshot reader sees the current state */
+    create_classifier( fix, 3 );
+    data_err = data_database_reader_get_classifier_by_id( data_database_snapshot_get_reader_ptr( &((*fix).snapshot) ),
+                                                          3,
+                                                          &classifier
+                                                        );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_classifier_destroy( &classifier );
+
+    data_err = data_database_snapshot_destroy( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    return TEST_CASE_RESULT_OK;
+}
+
+static gpointer read_classifier( gpointer data )
+{
+    test_fixture_t *const fix = data;
+    data_classifier_t classifier;
+    (*fix).thread_result = data_database_reader_get_classifier_by_id( data_database_snapshot_get_reader_ptr( &((*fix).snapshot) ),
+                                                                       (*fix).thread_read_id,
+                                                                       &classifier
+                                                                     );
+    if ( (*fix).thread_result == U8_ERROR_NONE )
+    {
+        data_classifier_destroy( &classifier );
+    }
+    return NULL;
+}
+
+static test_case_result_t read_in_worker_thread( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+
+    data_database_set_profile( &((*fix).database), DATA_DATABASE_PROFILE_WORKING_COPY );
+    data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_database_reader_init( &((*fix).db_reader), &((*fix).database) );
+    data_database_writer_init( &((*fix).db_writer), &((*fix).db_reader), &((*fix).database) );
+    create_classifier( fix, 4 );
+
+    /* open and pin in this thread, read in the worker thread while this thread edits */
+    data_err = data_database_snapshot_init( &((*fix).snapshot), data_database_get_filename_ptr( &((*fix).database) ) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_snapshot_pin( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    (*fix).thread_read_id = 4;
+    (*fix).thread_result = U8_ERROR_NOT_YET_IMPLEMENTED;
+    GThread *const worker = g_thread_try_new( "test_snapshot", &read_classifier, fix, NULL );
+    TEST_EXPECT( NULL != worker );
+    create_classifier( fix, 5 );
+    g_thread_join( worker );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, (*fix).thread_result, u8_error_get_name );
+
+    /* the classifier created after pinning is not visible to the worker */
+    (*fix).thread_read_id = 5;
+    GThread *const second_worker = g_thread_try_new( "test_snapshot", &read_classifier, fix, NULL );
+    TEST_EXPECT( NULL != second_worker );
+    g_thread_join( second_worker );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_DB_STRUCTURE, (*fix).thread_result, u8_error_get_name );
+
+    data_err = data_database_snapshot_destroy( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t refill_search_index_after_edits( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+
+    data_database_set_profile( &((*fix).database), DATA_DATABASE_PROFILE_WORKING_COPY );
+    data_err = data_database_open( &((*fix).database), DATABASE_FILENAME );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_database_reader_init( &((*fix).db_reader), &((*fix).database) );
+    data_database_writer_init( &((*fix).db_writer), &((*fix).db_reader), &((*fix).database) );
+    create_diagram( fix, 6, "Amber" );
+
+    data_err = data_database_snapshot_init( &((*fix).snapshot), data_database_get_filename_ptr( &((*fix).database) ) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_database_t *const snapshot_db = data_database_snapshot_get_database_ptr( &((*fix).snapshot) );
+    data_database_text_search_t snapshot_search;
+    data_err = data_database_text_search_init( &snapshot_search, snapshot_db );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 1, count_search_results( &snapshot_search, "Amber" ) );
+
+    /* the triggers of the editor's connection do not update the index of the snapshot's connection, */
+    /* substrings are still found, but words in a different order are found via the index only */
+    create_diagram( fix, 7, "Amber Beryl" );
+    TEST_EXPECT_EQUAL_INT( 2, count_search_results( &snapshot_search, "Amber" ) );
+    if ( data_database_has_search_index( snapshot_db ) )
+    {
+        TEST_EXPECT_EQUAL_INT( 0, count_search_results( &snapshot_search, "Beryl Amber" ) );
+    }
+
+    data_err = data_database_refill_search_index( snapshot_db );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 2, count_search_results( &snapshot_search, "Amber" ) );
+    TEST_EXPECT_EQUAL_INT( 1, count_search_results( &snapshot_search, "Beryl" ) );
+    if ( data_database_has_search_index( snapshot_db ) )
+    {
+        TEST_EXPECT_EQUAL_INT( 1, count_search_results( &snapshot_search, "Beryl Amber" ) );
+    }
+
+    data_err = data_database_text_search_destroy( &snapshot_search );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_snapshot_destroy( &((*fix).snapshot) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    return TEST_CASE_RESULT_OK;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
@@ -3,6 +3,7 @@
 #include "data_database_text_search_test.h"
 #include "storage/data_database_text_search.h"
 #include "storage/data_database.h"
+#include "storage/data_database_writer.h"
 #include "storage/data_search_result_iterator.h"
 #include "test_fixture.h"
 #include "test_expect.h"
@@ -14,6 +15,9 @@ static test_fixture_t * set_up();
 static void tear_down( test_fixture_t *fix );
 static test_case_result_t no_results( test_fixture_t *fix );
 static test_case_result_t search_no_filter( test_fixture_t *fix );
+static test_case_result_t search_words( test_fixture_t *fix );
+static test_case_result_t search_index_on_request( test_fixture_t *fix );
+static uint32_t count_search_results( data_database_text_search_t *txt_src, const char *textfragment );
 
 test_suite_t data_database_text_search_test_get_suite(void)
 {
@@ -26,6 +30,8 @@ test_suite_t data_database_text_search_test_get_suite(void)
                    );
     test_suite_add_test_case( &result, "no_results", &no_results );
     test_suite_add_test_case( &result, "search_no_filter", &search_no_filter );
+    test_suite_add_test_case( &result, "search_words", &search_words );
+    test_suite_add_test_case( &result, "search_index_on_request", &search_index_on_request );
     return result;
 }
 
@@ -208,6 +214,246 @@ static test_case_result_t search_no_filter( test_fixture_t *fix )
 }
 
 
+static test_case_result_t search_words( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+
+    data_database_text_search_t txt_src;
+    const u8_error_t text_init_err = data_database_text_search_init( &txt_src, &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, text_init_err, u8_error_get_name );
+
+    data_search_result_iterator_t data_search_result_iterator;
+    data_search_result_iterator_init_empty( &data_search_result_iterator );
+    data_search_result_t current_search_result;
+
+    /* words at word starts, in any order, case insensitive */
+    /* without fts5, this is a LIKE search for the substring "stone blu" which is not found */
+    const u8_error_t src_err
+        = data_database_text_search_get_objects_by_text_fragment( &txt_src,
+                                                                  "stone blu",
+                                                                  &data_search_result_iterator
+                                                                );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, src_err, u8_error_get_name );
+    const bool has_index = data_database_has_search_index( &((*fix).database) );
+    if ( has_index )
+    {
+        const bool next_0 = data_search_result_iterator_has_next( &data_search_result_iterator );
+        TEST_EXPECT_EQUAL_INT( true, next_0 );
+        const u8_error_t load_err_0
+            = data_search_result_iterator_next( &data_search_result_iterator, &current_search_result );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, load_err_0, u8_error_get_name );
+        const int eq_0 = utf8string_equals_str( "The-Blue-Stone",
+                                                data_search_result_get_match_name_const( &current_search_result )
+                                              );
+        TEST_EXPECT_EQUAL_INT( 1, eq_0 );
+
+        const bool next_1 = data_search_result_iterator_has_next( &data_search_result_iterator );
+        TEST_EXPECT_EQUAL_INT( true, next_1 );
+        const u8_error_t load_err_1
+            = data_search_result_iterator_next( &data_search_result_iterator, &current_search_result );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, load_err_1, u8_error_get_name );
+        const int eq_1 = utf8string_equals_str( "The-Blue-Stone Feature",
+                                                data_search_result_get_match_name_const( &current_search_result )
+                                              );
+        TEST_EXPECT_EQUAL_INT( 1, eq_1 );
+    }
+    const bool next_2 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( false, next_2 );
+
+    /* a word that is only found within other words is searched as substring */
+    const u8_error_t destr2_err = data_search_result_iterator_destroy( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, destr2_err, u8_error_get_name );
+    data_search_result_iterator_init_empty( &data_search_result_iterator );
+    const u8_error_t src2_err
+        = data_database_text_search_get_objects_by_text_fragment( &txt_src,
+                                                                  "TONE",
+                                                                  &data_search_result_iterator
+                                                                );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, src2_err, u8_error_get_name );
+    const bool next_3 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( true, next_3 );
+    const u8_error_t load_err_3
+        = data_search_result_iterator_next( &data_search_result_iterator, &current_search_result );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, load_err_3, u8_error_get_name );
+    const int eq_3 = utf8string_equals_str( "The-Blue-Stone",
+                                            data_search_result_get_match_name_const( &current_search_result )
+                                          );
+    TEST_EXPECT_EQUAL_INT( 1, eq_3 );
+    const data_row_t classifier_row = data_id_get_row( data_search_result_get_match_id_const( &current_search_result ) );
+
+    /* after renaming, the index finds the new name but not the old one */
+    const u8_error_t write_err
+        = data_database_writer_update_classifier_name( &((*fix).db_writer), classifier_row, "Red Rock", NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, write_err, u8_error_get_name );
+
+    const u8_error_t destr3_err = data_search_result_iterator_destroy( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, destr3_err, u8_error_get_name );
+    data_search_result_iterator_init_empty( &data_search_result_iterator );
+    const u8_error_t src3_err
+        = data_database_text_search_get_objects_by_text_fragment( &txt_src,
+                                                                  "red",
+                                                                  &data_search_result_iterator
+                                                                );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, src3_err, u8_error_get_name );
+    const bool next_4 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( true, next_4 );
+    const u8_error_t load_err_4
+        = data_search_result_iterator_next( &data_search_result_iterator, &current_search_result );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, load_err_4, u8_error_get_name );
+    const int eq_4 = utf8string_equals_str( "Red Rock",
+                                            data_search_result_get_match_name_const( &current_search_result )
+                                          );
+    TEST_EXPECT_EQUAL_INT( 1, eq_4 );
+    const bool next_5 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( false, next_5 );
+
+    const u8_error_t destr4_err = data_search_result_iterator_destroy( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, destr4_err, u8_error_get_name );
+    data_search_result_iterator_init_empty( &data_search_result_iterator );
+    const u8_error_t src4_err
+        = data_database_text_search_get_objects_by_text_fragment( &txt_src,
+                                                                  "Stone",
+                                                                  &data_search_result_iterator
+                                                                );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, src4_err, u8_error_get_name );
+    const bool next_6 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( true, next_6 );
+    const u8_error_t load_err_6
+        = data_search_result_iterator_next( &data_search_result_iterator, &current_search_result );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, load_err_6, u8_error_get_name );
+    const int eq_6 = utf8string_equals_str( "The-Blue-Stone Feature",
+                                            data_search_result_get_match_name_const( &current_search_result )
+                                          );
+    TEST_EXPECT_EQUAL_INT( 1, eq_6 );
+    const data_row_t feature_row = data_id_get_row( data_search_result_get_match_id_const( &current_search_result ) );
+    const bool next_7 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( false, next_7 );
+
+    /* a word found at a word start does not hide other objects that contain the word as substring */
+    const u8_error_t write2_err
+        = data_database_writer_update_classifier_name( &((*fix).db_writer), classifier_row, "Control Unit", NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, write2_err, u8_error_get_name );
+    const u8_error_t write3_err
+        = data_database_writer_update_feature_key( &((*fix).db_writer), feature_row, "MotorController", NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, write3_err, u8_error_get_name );
+
+    const u8_error_t destr5_err = data_search_result_iterator_destroy( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, destr5_err, u8_error_get_name );
+    data_search_result_iterator_init_empty( &data_search_result_iterator );
+    const u8_error_t src5_err
+        = data_database_text_search_get_objects_by_text_fragment( &txt_src,
+                                                                  "Control",
+                                                                  &data_search_result_iterator
+                                                                );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, src5_err, u8_error_get_name );
+    const bool next_8 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( true, next_8 );
+    const u8_error_t load_err_8
+        = data_search_result_iterator_next( &data_search_result_iterator, &current_search_result );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, load_err_8, u8_error_get_name );
+    const int eq_8 = utf8string_equals_str( "Control Unit",
+                                            data_search_result_get_match_name_const( &current_search_result )
+                                          );
+    TEST_EXPECT_EQUAL_INT( 1, eq_8 );
+    const bool next_9 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( true, next_9 );
+    const u8_error_t load_err_9
+        = data_search_result_iterator_next( &data_search_result_iterator, &current_search_result );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, load_err_9, u8_error_get_name );
+    const int eq_9 = utf8string_equals_str( "MotorController",
+                                            data_search_result_get_match_name_const( &current_search_result )
+                                          );
+    TEST_EXPECT_EQUAL_INT( 1, eq_9 );
+    const bool next_10 = data_search_result_iterator_has_next( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_INT( false, next_10 );
+
+    const u8_error_t destr_err = data_search_result_iterator_destroy( &data_search_result_iterator );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, destr_err, u8_error_get_name );
+
+    const u8_error_t text_destr_err = data_database_text_search_destroy( &txt_src );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, text_destr_err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+static test_case_result_t search_index_on_request( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+
+    /* opening the database does not create the index, only a searcher does */
+    TEST_EXPECT_EQUAL_INT( false, data_database_has_search_index( &((*fix).database) ) );
+    data_database_text_search_t txt_src;
+    const u8_error_t text_init_err = data_database_text_search_init( &txt_src, &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, text_init_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( false, data_database_has_search_index( &((*fix).database) ) );
+
+    /* the first search creates the index, unless the sqlite3 library does not provide fts5 */
+    TEST_EXPECT_EQUAL_INT( 2, count_search_results( &txt_src, "Stone" ) );
+    const bool has_index = data_database_has_search_index( &((*fix).database) );
+
+    /* records created in bulk mode are indexed when the bulk mode ends */
+    u8_error_t bulk_err = data_database_transaction_begin( &((*fix).database) );
+    bulk_err |= data_database_writer_begin_bulk_mode( &((*fix).db_writer) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, bulk_err, u8_error_get_name );
+    static data_diagram_t bulk_diagram;  /* static ok for a single-threaded test case and preserves stack space */
+    const u8_error_t d_init_err = data_diagram_init( &bulk_diagram,
+                                                     DATA_ROW_VOID,
+                                                     DATA_ROW_VOID,  /* parent_diagram_id */
+                                                     DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM,
+                                                     "",  /* stereotype */
+                                                     "Quartz Glow",  /* name */
+                                                     "",  /* description */
+                                                     0,  /* list_order */
+                                                     DATA_DIAGRAM_FLAG_NONE,
+                                                     "d3f2b6c4-5a1e-4f0b-9c7d-2e8a6b1f3c90"
+                                                   );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, d_init_err, u8_error_get_name );
+    data_row_t bulk_diagram_row;
+    bulk_err = data_database_writer_create_diagram( &((*fix).db_writer), &bulk_diagram, &bulk_diagram_row );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, bulk_err, u8_error_get_name );
+    bulk_err = data_database_writer_end_bulk_mode( &((*fix).db_writer) );
+    bulk_err |= data_database_transaction_commit( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, bulk_err, u8_error_get_name );
+    data_diagram_destroy( &bulk_diagram );
+
+    TEST_EXPECT_EQUAL_INT( 1, count_search_results( &txt_src, "Quartz" ) );
+    TEST_EXPECT_EQUAL_INT( has_index ? 1 : 0, count_search_results( &txt_src, "glow quartz" ) );
+
+    /* after bulk mode, the triggers update the index again */
+    const u8_error_t write_err
+        = data_database_writer_update_diagram_name( &((*fix).db_writer), bulk_diagram_row, "Quartz Shine", NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, write_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 0, count_search_results( &txt_src, "glow quartz" ) );
+    TEST_EXPECT_EQUAL_INT( has_index ? 1 : 0, count_search_results( &txt_src, "shine quartz" ) );
+
+    const u8_error_t text_destr_err = data_database_text_search_destroy( &txt_src );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, text_destr_err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static uint32_t count_search_results( data_database_text_search_t *txt_src, const char *textfragment )
+{
+    data_search_result_iterator_t data_search_result_iterator;
+    data_search_result_iterator_init_empty( &data_search_result_iterator );
+    data_search_result_t current_search_result;
+    uint32_t count = 0;
+
+    const u8_error_t src_err
+        = data_database_text_search_get_objects_by_text_fragment( txt_src, textfragment, &data_search_result_iterator );
+    TEST_ENVIRONMENT_ASSERT_EQUAL_INT( U8_ERROR_NONE, src_err );
+    while ( data_search_result_iterator_has_next( &data_search_result_iterator ) )
+    {
+        const u8_error_t load_err = data_search_result_iterator_next( &data_search_result_iterator, &current_search_result );
+        TEST_ENVIRONMENT_ASSERT_EQUAL_INT( U8_ERROR_NONE, load_err );
+        count ++;
+    }
+
+    const u8_error_t destr_err = data_search_result_iterator_destroy( &data_search_result_iterator );
+    TEST_ENVIRONMENT_ASSERT_EQUAL_INT( U8_ERROR_NONE, destr_err );
+    return count;
+}
+
+
 /*
  * Copyright 2025-2026 Andreas Warnke
  *
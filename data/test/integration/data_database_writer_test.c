@@ -0,0 +1,332 @@
+/* File: data_database_writer_test.c; Copyright and License: see below */
+
+#include "data_database_writer_test.h"
+#include "storage/data_database_reader.h"
+#include "storage/data_database_writer.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <glib.h>
+#include <sqlite3.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <assert.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t update_with_bound_texts( test_fixture_t *fix );
+static test_case_result_t update_references_to_null( test_fixture_t *fix );
+static test_case_result_t write_to_closed_database( test_fixture_t *fix );
+static test_case_result_t measure_rename_move_create( test_fixture_t *fix );
+
+test_suite_t data_database_writer_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "data_database_writer_test",
+                     TEST_CATEGORY_INTEGRATION | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "update_with_bound_texts", &update_with_bound_texts );
+    test_suite_add_test_case( &result, "update_references_to_null", &update_references_to_null );
+    test_suite_add_test_case( &result, "write_to_closed_database", &write_to_closed_database );
+    const test_category_t ON_QUEST = TEST_CATEGORY_INTEGRATION | TEST_CATEGORY_QUEST;
+    test_suite_add_special_test_case( &result, "measure_rename_move_create", ON_QUEST, &measure_rename_move_create );
+    return result;
+}
+
+struct test_fixture_struct {
+    data_database_t database;  /*!< database instance on which the tests are performed */
+    data_database_reader_t db_reader;  /*!< database reader to access the database */
+    data_database_writer_t db_writer;  /*!< database writer to access the database */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    data_database_init( &((*fix).database) );
+    data_database_open_in_memory( &((*fix).database) );
+    data_database_reader_init( &((*fix).db_reader), &((*fix).database) );
+    data_database_writer_init( &((*fix).db_writer), &((*fix).db_reader), &((*fix).database) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    data_database_writer_destroy( &((*fix).db_writer) );
+    data_database_reader_destroy( &((*fix).db_reader) );
+    data_database_close( &((*fix).database) );
+    data_database_destroy( &((*fix).database) );
+}
+
+static test_case_result_t update_with_bound_texts( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+
+    data_classifier_t classifier;
+    data_err = data_classifier_init_new( &classifier, DATA_CLASSIFIER_TYPE_CLASS, "", "first", "", 10, 20, 30 );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t first_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_classifier( &((*fix).db_writer), &classifier, &first_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_classifier_init_new( &classifier, DATA_CLASSIFIER_TYPE_CLASS, "", "second", "", 10, 20, 30 );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t second_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_classifier( &((*fix).db_writer), &classifier, &second_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* quotes and sql syntax are stored as they are */
+    static const char *const QUOTED = "it's \"x\"); DROP TABLE classifiers; --";
+    data_err = data_database_writer_update_classifier_description( &((*fix).db_writer), first_id, QUOTED, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_reader_get_classifier_by_id( &((*fix).db_reader), first_id, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_STRING( QUOTED, data_classifier_get_description_const( &classifier ) );
+
+    /* a too long name is shortened and stored */
+    static const char *const LONG_NAME = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789";
+    data_err = data_database_writer_update_classifier_name( &((*fix).db_writer), first_id, LONG_NAME, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_STRING_BUFFER_EXCEEDED, data_err, u8_error_get_name );
+    data_err = data_database_reader_get_classifier_by_id( &((*fix).db_reader), first_id, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( DATA_CLASSIFIER_MAX_NAME_LENGTH, strlen( data_classifier_get_name_const( &classifier ) ) );
+    TEST_EXPECT_EQUAL_INT( 0, strncmp( LONG_NAME, data_classifier_get_name_const( &classifier ), DATA_CLASSIFIER_MAX_NAME_LENGTH ) );
+
+    /* a duplicate name is rejected, the statement can be reused afterwards */
+    data_err = data_database_writer_update_classifier_name( &((*fix).db_writer), second_id, "first", NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_writer_update_classifier_name( &((*fix).db_writer), first_id, "first", NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_DUPLICATE_NAME, data_err, u8_error_get_name );
+    data_err = data_database_writer_update_classifier_name( &((*fix).db_writer), first_id, "third", NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_reader_get_classifier_by_id( &((*fix).db_reader), first_id, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_STRING( "third", data_classifier_get_name_const( &classifier ) );
+
+    /* delete */
+    data_err = data_database_writer_delete_classifier( &((*fix).db_writer), second_id, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_reader_get_classifier_by_id( &((*fix).db_reader), second_id, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_DB_STRUCTURE, data_err, u8_error_get_name );  /* non-existing id */
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t update_references_to_null( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+
+    data_diagram_t diagram;
+    data_err = data_diagram_init_new( &diagram, DATA_ROW_VOID, DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM, "", "root", "", 0, DATA_DIAGRAM_FLAG_NONE );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t root_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_diagram( &((*fix).db_writer), &diagram, &root_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_diagram_init_new( &diagram, root_id, DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM, "", "child", "", 0, DATA_DIAGRAM_FLAG_NONE );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t child_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_diagram( &((*fix).db_writer), &diagram, &child_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* move the child to the top level and back */
+    data_err = data_database_writer_update_diagram_parent_id( &((*fix).db_writer), child_id, DATA_ROW_VOID, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_reader_get_diagram_by_id( &((*fix).db_reader), child_id, &diagram );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( DATA_ROW_VOID, data_diagram_get_parent_row( &diagram ) );
+
+    data_err = data_database_writer_update_diagram_parent_id( &((*fix).db_writer), child_id, root_id, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_writer_update_diagram_list_order( &((*fix).db_writer), child_id, -5000, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_reader_get_diagram_by_id( &((*fix).db_reader), child_id, &diagram );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( root_id, data_diagram_get_parent_row( &diagram ) );
+    TEST_EXPECT_EQUAL_INT( -5000, data_diagram_get_list_order( &diagram ) );
+
+    /* the root diagram is still referenced */
+    data_err = data_database_writer_delete_diagram( &((*fix).db_writer), root_id, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_OBJECT_STILL_REFERENCED, data_err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t write_to_closed_database( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err;
+
+    data_classifier_t classifier;
+    data_err = data_classifier_init_new( &classifier, DATA_CLASSIFIER_TYPE_CLASS, "", "before", "", 0, 0, 0 );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t classifier_id = DATA_ROW_VOID;
+    data_err = data_database_writer_create_classifier( &((*fix).db_writer), &classifier, &classifier_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* closing finalizes the prepared statements */
+    data_err = data_database_close( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_writer_begin_bulk_mode( &((*fix).db_writer) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NO_DB, data_err, u8_error_get_name );
+    data_err = data_database_writer_create_classifier( &((*fix).db_writer), &classifier, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NO_DB, data_err, u8_error_get_name );
+
+    /* re-opening prepares them again */
+    data_err = data_database_open_in_memory( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_writer_create_classifier( &((*fix).db_writer), &classifier, &classifier_id );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = data_database_writer_update_classifier_name( &((*fix).db_writer), classifier_id, "after", NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+/*!
+ *  \brief number of records created, renamed and moved per measurement
+ */
+static const int MEASURE_COUNT = 2000;
+
+/*!
+ *  \brief executes one formatted sql statement like data_database_writer did before it used prepared statements
+ */
+static u8_error_t exec_formatted( sqlite3 *db, char *sql )
+{
+    char *error_msg = NULL;
+    const int sqlite_err = sqlite3_exec( db, sql, NULL, NULL, &error_msg );
+    sqlite3_free( error_msg );
+    sqlite3_free( sql );
+    return ( SQLITE_OK == sqlite_err ) ? U8_ERROR_NONE : U8_ERROR_AT_DB;
+}
+
+static test_case_result_t measure_rename_move_create( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t data_err = U8_ERROR_NONE;
+    sqlite3 *const db = data_database_get_database_ptr( &((*fix).database) );
+    char name[DATA_CLASSIFIER_MAX_NAME_LENGTH+1];
+    data_classifier_t classifier;
+
+    /* measure the statements only, without the notifications and logs of data_database_writer */
+    data_database_prepared_writer_t prepared_writer;
+    data_err |= data_database_prepared_writer_init( &prepared_writer, &((*fix).database) );
+
+    /* create: prepared statements of the writer vs. formatted sql strings */
+    data_err |= data_database_transaction_begin( &((*fix).database) );
+    const int64_t create_start = g_get_monotonic_time();
+    for ( int index = 0; index < MEASURE_COUNT; index ++ )
+    {
+        snprintf( name, sizeof(name), "prepared-%d", index );
+        data_err |= data_classifier_init_new( &classifier, DATA_CLASSIFIER_TYPE_CLASS, "", name, "description", index, index, index );
+        data_err |= data_database_prepared_writer_create_classifier( &prepared_writer, &classifier, NULL );
+    }
+    const int64_t create_prepared = g_get_monotonic_time() - create_start;
+    for ( int index = 0; index < MEASURE_COUNT; index ++ )
+    {
+        snprintf( name, sizeof(name), "formatted-%d", index );
+        data_err |= data_classifier_init_new( &classifier, DATA_CLASSIFIER_TYPE_CLASS, "", name, "description", index, index, index );
+        data_err |= exec_formatted( db,
+                                    sqlite3_mprintf( "INSERT INTO classifiers "
+                                                     "(main_type,stereotype,name,description,x_order,y_order,list_order,uuid) "
+                                                     "VALUES (%d,%Q,%Q,%Q,%d,%d,%d,%Q);",
+                                                     DATA_CLASSIFIER_TYPE_CLASS, "", name, "description", index, index, index,
+                                                     data_classifier_get_uuid_const( &classifier )
+                                                   )
+                                  );
+    }
+    const int64_t create_formatted = g_get_monotonic_time() - create_start - create_prepared;
+    data_err |= data_database_transaction_commit( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* rename: classifier ids 1..MEASURE_COUNT belong to the prepared series */
+    data_err |= data_database_transaction_begin( &((*fix).database) );
+    const int64_t rename_start = g_get_monotonic_time();
+    for ( int index = 0; index < MEASURE_COUNT; index ++ )
+    {
+        snprintf( name, sizeof(name), "renamed-p-%d", index );
+        data_err |= data_database_prepared_writer_update_text( &prepared_writer,
+                                                               DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_NAME,
+                                                               index + 1,
+                                                               name,
+                                                               DATA_CLASSIFIER_MAX_NAME_LENGTH
+                                                             );
+    }
+    const int64_t rename_prepared = g_get_monotonic_time() - rename_start;
+    for ( int index = 0; index < MEASURE_COUNT; index ++ )
+    {
+        snprintf( name, sizeof(name), "renamed-f-%d", index );
+        data_err |= exec_formatted( db,
+                                    sqlite3_mprintf( "UPDATE classifiers SET name=%Q WHERE id=%d;", name, MEASURE_COUNT + index + 1 )
+                                  );
+    }
+    const int64_t rename_formatted = g_get_monotonic_time() - rename_start - rename_prepared;
+    data_err |= data_database_transaction_commit( &((*fix).database) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* move: change the position of each classifier */
+    data_err |= data_database_transaction_begin( &((*fix).database) );
+    const int64_t move_start = g_get_monotonic_time();
+    for ( int index = 0; index < MEASURE_COUNT; index ++ )
+    {
+        data_err |= data_database_prepared_writer_update_int( &prepared_writer, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_X_ORDER, index + 1, -index );
+        data_err |= data_database_prepared_writer_update_int( &prepared_writer, DATA_DATABASE_PREPARED_WRITER_COL_CLASSIFIER_Y_ORDER, index + 1, -index );
+    }
+    const int64_t move_prepared = g_get_monotonic_time() - move_start;
+    for ( int index = 0; index < MEASURE_COUNT; index ++ )
+    {
+        data_err |= exec_formatted( db,
+                                    sqlite3_mprintf( "UPDATE classifiers SET x_order=%d WHERE id=%d;", -index, MEASURE_COUNT + index + 1 )
+                                  );
+        data_err |= exec_formatted( db,
+                                    sqlite3_mprintf( "UPDATE classifiers SET y_order=%d WHERE id=%d;", -index, MEASURE_COUNT + index + 1 )
+                                  );
+    }
+    const int64_t move_formatted = g_get_monotonic_time() - move_start - move_prepared;
+    data_err |= data_database_transaction_commit( &((*fix).database) );
+    data_err |= data_database_prepared_writer_destroy( &prepared_writer );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* check that both series did the same */
+    data_err = data_database_reader_get_classifier_by_id( &((*fix).db_reader), MEASURE_COUNT, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 1 - MEASURE_COUNT, data_classifier_get_y_order( &classifier ) );
+    data_err = data_database_reader_get_classifier_by_id( &((*fix).db_reader), 2 * MEASURE_COUNT, &classifier );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 1 - MEASURE_COUNT, data_classifier_get_y_order( &classifier ) );
+
+    fprintf( stdout,
+             "    %d x create: prepared=%" PRIi64 "us, formatted=%" PRIi64 "us\n"
+             "    %d x rename: prepared=%" PRIi64 "us, formatted=%" PRIi64 "us\n"
+             "    %d x move:   prepared=%" PRIi64 "us, formatted=%" PRIi64 "us\n",
+             MEASURE_COUNT, create_prepared, create_formatted,
+             MEASURE_COUNT, rename_prepared, rename_formatted,
+             MEASURE_COUNT, move_prepared, move_formatted
+           );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
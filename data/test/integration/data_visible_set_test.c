@@ -269,6 +269,23 @@ static test_case_result_t modify_visible_set( test_fixture_t *fix )
         TEST_EXPECT_EQUAL_INT( true, data_visible_set_is_ancestor_by_index( &((*fix).test_me), 0 /* ancestor_index */, 1 /* descendant_index */ ) );
         TEST_EXPECT_EQUAL_INT( false, data_visible_set_is_ancestor_by_index( &((*fix).test_me), 1 /* ancestor_index */, 0 /* descendant_index */ ) );
 
+        /* lookups by id use the indices that were built when updating the containment cache */
+        const data_visible_classifier_t *const vc_by_id
+            = data_visible_set_get_visible_classifier_by_id_const( &((*fix).test_me), DATA_VISIBLE_SET_MAX_CLASSIFIERS /* diagramelement_id */ );
+        TEST_EXPECT( NULL != vc_by_id );
+        TEST_EXPECT_EQUAL_INT( DATA_VISIBLE_SET_MAX_CLASSIFIERS-1, data_visible_set_get_classifier_index_from_pointer( &((*fix).test_me), vc_by_id ) );
+        TEST_EXPECT_EQUAL_INT( 17, data_visible_set_get_classifier_index( &((*fix).test_me), 1017 /* classifier_id */ ) );
+        TEST_EXPECT_EQUAL_INT( -1, data_visible_set_get_classifier_index( &((*fix).test_me), 999 /* classifier_id */ ) );
+        const data_feature_t *const feat_by_id
+            = data_visible_set_get_feature_by_id_const( &((*fix).test_me), 10000+DATA_VISIBLE_SET_MAX_FEATURES-1 );
+        TEST_EXPECT( NULL != feat_by_id );
+        TEST_EXPECT_EQUAL_INT( 10000+DATA_VISIBLE_SET_MAX_FEATURES-1, data_feature_get_row( feat_by_id ) );
+        TEST_EXPECT( NULL == data_visible_set_get_feature_by_id_const( &((*fix).test_me), 9999 ) );
+        const data_relationship_t *const rel_by_id = data_visible_set_get_relationship_by_id_const( &((*fix).test_me), 40005 );
+        TEST_EXPECT( NULL != rel_by_id );
+        TEST_EXPECT_EQUAL_INT( 40005, data_relationship_get_row( rel_by_id ) );
+        TEST_EXPECT( NULL == data_visible_set_get_relationship_by_id_const( &((*fix).test_me), 39999 ) );
+
         data_visible_set_invalidate( &((*fix).test_me) );
 
         data_diagram_t *const no_diag = data_visible_set_get_diagram_ptr( &((*fix).test_me) );    
@@ -83,10 +83,10 @@ static data_visible_set_t* init_test_input_data( data_diagram_type_t diag_type )
     }
 
     /* initialize the test_input_data.visible_classifiers */
-    test_input_data.visible_classifier_count = DATA_VISIBLE_SET_MAX_CLASSIFIERS;
     for ( uint_fast32_t vc_idx = 0; vc_idx < DATA_VISIBLE_SET_MAX_CLASSIFIERS; vc_idx ++ )
     {
-        data_visible_classifier_t *current = &(test_input_data.visible_classifiers[vc_idx]);
+        data_visible_classifier_t current_buf;
+        data_visible_classifier_t *current = &current_buf;
 
         data_visible_classifier_init_empty ( current );
 
@@ -123,16 +123,19 @@ static data_visible_set_t* init_test_input_data( data_diagram_type_t diag_type )
         TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
 
         TEST_ENVIRONMENT_ASSERT( data_visible_classifier_is_valid( current ) );
+        data_err = data_visible_set_append_classifier( &test_input_data, current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_visible_classifier_destroy( current );
     }
 
     TEST_ENVIRONMENT_ASSERT( TEST_CLASSIFIER_REF_MOD > TEST_LIFELINE_COUNT );
     TEST_ENVIRONMENT_ASSERT( TEST_CLASSIFIER_REF_MOD+7 < (DATA_VISIBLE_SET_MAX_CLASSIFIERS/2) );
 
     /* initialize the test_input_data.features */
-    test_input_data.feature_count = DATA_VISIBLE_SET_MAX_FEATURES;
     for ( uint_fast32_t f_idx = 0; f_idx < DATA_VISIBLE_SET_MAX_FEATURES; f_idx ++ )
     {
-        data_feature_t *current = &(test_input_data.features[f_idx]);
+        data_feature_t current_buf;
+        data_feature_t *current = &current_buf;
 
         data_row_t feature_id = TEST_FEATURE_ID_OFFSET + f_idx;
         if ( f_idx == TEST_FEATURE_ID_GAP ) { feature_id = feature_id+1; }
@@ -150,13 +153,16 @@ static data_visible_set_t* init_test_input_data( data_diagram_type_t diag_type )
         TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
 
         TEST_ENVIRONMENT_ASSERT( data_feature_is_valid( current ) );
+        data_err = data_visible_set_append_feature( &test_input_data, current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_feature_destroy( current );
     }
 
     /* initialize the test_input_data.relationships */
-    test_input_data.relationship_count = DATA_VISIBLE_SET_MAX_RELATIONSHIPS;
     for ( uint_fast32_t r_idx = 0; r_idx < DATA_VISIBLE_SET_MAX_RELATIONSHIPS; r_idx ++ )
     {
-        data_relationship_t *current = &(test_input_data.relationships[r_idx]);
+        data_relationship_t current_buf;
+        data_relationship_t *current = &current_buf;
 
         const bool from_feat = ( 0 == (r_idx & 0x00000001) )||( r_idx == TEST_FEATURE_ID_GAP );
         const bool to_feat = ( 0 == (r_idx & 0x00000002) )||( (r_idx+1) == TEST_FEATURE_ID_GAP );
@@ -176,6 +182,9 @@ static data_visible_set_t* init_test_input_data( data_diagram_type_t diag_type )
         TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
 
         TEST_ENVIRONMENT_ASSERT( data_relationship_is_valid( current ) );
+        data_err = data_visible_set_append_relationship( &test_input_data, current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_relationship_destroy( current );
     }
 
     data_visible_set_update_containment_cache ( &test_input_data );
@@ -187,7 +196,7 @@ static data_visible_set_t* init_test_input_data( data_diagram_type_t diag_type )
 
 static test_case_result_t test_data_rules_filter_scenarios( test_fixture_t *test_env )
 {
-    const data_visible_set_t *test_input_data;
+    data_visible_set_t *test_input_data;
     test_input_data = init_test_input_data( DATA_DIAGRAM_TYPE_UML_COMMUNICATION_DIAGRAM );
 
     data_rules_t testrules;
@@ -244,12 +253,13 @@ static test_case_result_t test_data_rules_filter_scenarios( test_fixture_t *test
     TEST_EXPECT( show == false );
 
     data_rules_destroy ( &testrules );
+    data_visible_set_destroy( test_input_data );
     return TEST_CASE_RESULT_OK;
 }
 
 static test_case_result_t test_data_rules_filter_box_and_list( test_fixture_t *test_env )
 {
-    const data_visible_set_t *test_input_data;
+    data_visible_set_t *test_input_data;
     test_input_data = init_test_input_data( DATA_DIAGRAM_TYPE_BOX_DIAGRAM );
 
     data_rules_t testrules;
@@ -302,12 +312,13 @@ static test_case_result_t test_data_rules_filter_box_and_list( test_fixture_t *t
     TEST_EXPECT( show == false );
 
     data_rules_destroy ( &testrules );
+    data_visible_set_destroy( test_input_data );
     return TEST_CASE_RESULT_OK;
 }
 
 static test_case_result_t test_data_rules_filter_standard( test_fixture_t *test_env )
 {
-    const data_visible_set_t *test_input_data;
+    data_visible_set_t *test_input_data;
     test_input_data = init_test_input_data( DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM );
 
     data_rules_t testrules;
@@ -360,6 +371,7 @@ static test_case_result_t test_data_rules_filter_standard( test_fixture_t *test_
     TEST_EXPECT( show == true );
 
     data_rules_destroy ( &testrules );
+    data_visible_set_destroy( test_input_data );
     return TEST_CASE_RESULT_OK;
 }
 
@@ -394,6 +406,7 @@ static test_case_result_t test_data_rules_filter_incomplete( test_fixture_t *tes
     TEST_EXPECT( show == false );
 
     data_rules_destroy ( &testrules );
+    data_visible_set_destroy( test_input_data );
     return TEST_CASE_RESULT_OK;
 }
 
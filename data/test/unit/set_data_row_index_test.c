@@ -0,0 +1,139 @@
+/* File: set_data_row_index_test.c; Copyright and License: see below */
+
+#include "set_data_row_index_test.h"
+#include "set/data_row_index.h"
+#include "u8arena/universal_memory_arena.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *test_env );
+static test_case_result_t test_row_index_add_and_get( test_fixture_t *test_env );
+static test_case_result_t test_row_index_full( test_fixture_t *test_env );
+
+test_suite_t set_data_row_index_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "set_data_row_index_test",
+                     TEST_CATEGORY_UNIT | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_row_index_add_and_get", &test_row_index_add_and_get );
+    test_suite_add_test_case( &result, "test_row_index_full", &test_row_index_full );
+    return result;
+}
+
+static test_fixture_t * set_up()
+{
+    return NULL;
+}
+
+static void tear_down( test_fixture_t *test_env )
+{
+}
+
+static test_case_result_t test_row_index_add_and_get( test_fixture_t *test_env )
+{
+    uint64_t mem_buf[1024];
+    universal_memory_arena_t memory;
+    universal_memory_arena_init( &memory, &mem_buf, sizeof(mem_buf) );
+
+    data_row_index_t testee;
+    data_row_index_init( &testee );
+
+    /* an uninitialized index finds nothing */
+    uint32_t position = 7;
+    TEST_EXPECT_EQUAL_INT( false, data_row_index_get( &testee, 1234, &position ) );
+    TEST_EXPECT_EQUAL_INT( 7, position );
+
+    const u8_error_t init_err = data_row_index_reinit( &testee, 100, &memory );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, init_err, u8_error_get_name );
+    TEST_EXPECT( 100 <= data_row_index_get_max_count( &testee ) );
+
+    /* rows with equal low bits shall not collide */
+    for ( uint32_t idx = 0; idx < 100; idx ++ )
+    {
+        const u8_error_t add_err = data_row_index_add( &testee, ( idx * 1024 ) + 17, idx );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, add_err, u8_error_get_name );
+    }
+    TEST_EXPECT_EQUAL_INT( 100, data_row_index_get_count( &testee ) );
+
+    /* duplicates keep the first position */
+    const u8_error_t dup_err = data_row_index_add( &testee, ( 5 * 1024 ) + 17, 200 );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_DUPLICATE_ID, dup_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 100, data_row_index_get_count( &testee ) );
+
+    for ( uint32_t idx = 0; idx < 100; idx ++ )
+    {
+        TEST_EXPECT_EQUAL_INT( true, data_row_index_get( &testee, ( idx * 1024 ) + 17, &position ) );
+        TEST_EXPECT_EQUAL_INT( idx, position );
+        TEST_EXPECT_EQUAL_INT( false, data_row_index_get( &testee, ( idx * 1024 ) + 18, &position ) );
+    }
+
+    /* negative ids are valid rows */
+    const u8_error_t neg_err = data_row_index_add( &testee, -37, 300 );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, neg_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( true, data_row_index_get( &testee, -37, &position ) );
+    TEST_EXPECT_EQUAL_INT( 300, position );
+
+    data_row_index_destroy( &testee );
+    universal_memory_arena_destroy( &memory );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_row_index_full( test_fixture_t *test_env )
+{
+    uint64_t mem_buf[16];
+    universal_memory_arena_t memory;
+    universal_memory_arena_init( &memory, &mem_buf, sizeof(mem_buf) );
+
+    data_row_index_t testee;
+    data_row_index_init( &testee );
+
+    /* 8 slots: 8*8 bytes rows + 8*4 bytes positions fit into 128 bytes */
+    TEST_EXPECT_EQUAL_INT( 96, data_row_index_get_memory_size( 4 ) );
+    TEST_EXPECT_EQUAL_INT( 192, data_row_index_get_memory_size( 5 ) );
+    const u8_error_t init_err = data_row_index_reinit( &testee, 4, &memory );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, init_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 4, data_row_index_get_max_count( &testee ) );
+
+    for ( uint32_t idx = 0; idx < 4; idx ++ )
+    {
+        const u8_error_t add_err = data_row_index_add( &testee, 1000 + idx, idx );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, add_err, u8_error_get_name );
+    }
+    const u8_error_t full_err = data_row_index_add( &testee, 2000, 4 );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_ARRAY_BUFFER_EXCEEDED, full_err, u8_error_get_name );
+
+    /* a bigger index does not fit into the remaining memory */
+    data_row_index_t too_big;
+    data_row_index_init( &too_big );
+    const u8_error_t mem_err = data_row_index_reinit( &too_big, 5, &memory );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_ARRAY_BUFFER_EXCEEDED, mem_err, u8_error_get_name );
+    uint32_t position;
+    TEST_EXPECT_EQUAL_INT( false, data_row_index_get( &too_big, 1000, &position ) );
+
+    data_row_index_destroy( &too_big );
+    data_row_index_destroy( &testee );
+    universal_memory_arena_destroy( &memory );
+    return TEST_CASE_RESULT_OK;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
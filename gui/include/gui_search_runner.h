@@ -6,13 +6,23 @@
 /* public file for the doxygen documentation: */
 /*! \file
  *  \brief Gets a search query string, performs the search and provides the search result.
+ *
+ *  If the database is a working copy in write-ahead-log mode, the search runs in a worker thread
+ *  on an own read-only connection (data_database_snapshot_t):
+ *  A new request supersedes and cancels the running one,
+ *  the result page is handed back to the main loop by an idle callback.
+ *  Otherwise, the search runs synchronously on the editor's connection.
  */
 
 #include "pos/pos_scroll_page.h"
 #include "pos/pos_search_result_page.h"
 #include "observer/observer.h"
+#include "storage/data_database.h"
+#include "storage/data_database_listener.h"
 #include "storage/data_database_reader.h"
+#include "storage/data_database_snapshot.h"
 #include "storage/data_database_text_search.h"
+#include "storage/data_revision.h"
 #include "set/data_small_set.h"
 #include "set/data_search_result.h"
 #include "set/data_search_result_list.h"
@@ -22,39 +32,80 @@
 #include "gui_simple_message_to_user.h"
 #include "utf8stream/utf8stream_writemem.h"
 #include "u8/u8_error.h"
+#include <glib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <assert.h>
 
 /*!
  *  \brief constants for maximum values of gui_search_runner_t
  */
 enum gui_search_runner_max_enum {
     GUI_SEARCH_RUNNER_MAX_RESULTS = POS_SEARCH_RESULT_PAGE_MAX_PAGE_SIZE,  /*!< maximum number of search results */
+    GUI_SEARCH_RUNNER_MAX_SEARCH_STRING_SIZE = 256,  /*!< maximum size of a search string including the terminating zero */
+};
+
+/*!
+ *  \brief one page of search results and the request that produced it
+ */
+struct gui_search_runner_page_struct {
+    gint generation;  /*!< the request counter value of the request that produced this page */
+    gint64 request_time;  /*!< monotonic time in microseconds when the request was made */
+    pos_scroll_page_t page_request;  /*!< description of the requested search page */
+    uint32_t result_buffer_start;  /*!< offset of start element in result_list_buffer (relative to absolute start of result list) */
+    data_search_result_t result_buffer[GUI_SEARCH_RUNNER_MAX_RESULTS];  /*!< memory for the result list page */
+    data_search_result_list_t result_list;  /*!< a list-page of search results; storage for search results is: result_buffer */
+    bool result_buffer_more_after;  /*!< This flag indicates if more results follow after the result_buffer. */
+                                    /*!< Note that an underfull result_buffer does not imply end of list, maybe page_request did not ask for more... */
 };
 
+typedef struct gui_search_runner_page_struct gui_search_runner_page_t;
+
 /*!
  *  \brief attributes of the gui_search_runner
+ *
+ *  Lifecycle: All functions except gui_search_runner_private_work and the functions called by it
+ *  shall be called by the main loop thread.
  */
 struct gui_search_runner_struct {
     /* external entities */
     data_database_reader_t *db_reader;  /*!< pointer to external database reader */
+    data_database_t *database;  /*!< pointer to external database */
     data_database_text_search_t db_searcher;  /*!< own instance of a database freetext searcher */
     observer_t result_consumer;  /*!< observer_t which is informed on search results */
     gui_simple_message_to_user_t *message_to_user;  /*!< pointer to external message-displayer */
+    data_database_listener_t me_as_listener;  /*!< own instance of data_database_listener_t which is registered at the database */
 
     /* request data */
-    char search_string_buf[256];  /*!< the current search string, truncated to 255 bytes, 0-terminated */
+    char search_string_buf[GUI_SEARCH_RUNNER_MAX_SEARCH_STRING_SIZE];  /*!< the current search string, truncated to 255 bytes, 0-terminated */
     utf8stream_writemem_t search_string_writer;  /*!< a writer to the current search string */
-    pos_scroll_page_t page_request;  /*!< description of the requested search page */
+    gint generation;  /*!< counter of requests, incremented atomically; a running search with a different value is superseded */
 
     /* result data */
-    uint32_t result_buffer_start;  /*!< offset of start element in result_list_buffer (relative to absolute start of result list) */
-    data_search_result_t result_buffer[GUI_SEARCH_RUNNER_MAX_RESULTS];  /*!< memory for the result list page */
-    data_search_result_list_t result_list;  /*!< a list-page of search results; storage for search results is: result_buffer */
-    bool result_buffer_more_after;  /*!< This flag indicates if more results follow after the result_buffer. */
-                                    /*!< Note that an underfull result_buffer does not imply end of list, maybe page_request did not ask for more... */
+    gui_search_runner_page_t result;  /*!< the result page that is presented to the result_consumer */
+
+    /* worker thread and its own connection, only valid while worker_thread is not NULL */
+    GThread *worker_thread;  /*!< the thread that searches in the background, NULL if searching synchronously */
+    data_database_snapshot_t snapshot;  /*!< own read-only connection to the database file, used by the worker thread */
+    data_database_text_search_t snapshot_searcher;  /*!< freetext searcher on the own connection, used by the worker thread */
+    data_revision_t snapshot_index_revision;  /*!< revision of the editor's database when the search index of the snapshot was filled */
+    char worker_search_string_buf[GUI_SEARCH_RUNNER_MAX_SEARCH_STRING_SIZE];  /*!< the search string of the job in work */
+    gui_search_runner_page_t worker_page;  /*!< the result page of the job in work */
 
-    /* temporary buffers */
+    /* attributes shared between threads */
+    GMutex lock;  /*!< lock to protect the job and the handover attributes */
+    GCond job_available;  /*!< condition that signals a new job or the stop request to the worker thread */
+    bool worker_shall_stop;  /*!< true if the worker thread shall terminate */
+    bool job_pending;  /*!< true if a job waits for the worker thread */
+    char job_search_string_buf[GUI_SEARCH_RUNNER_MAX_SEARCH_STRING_SIZE];  /*!< the search string of the pending job */
+    pos_scroll_page_t job_page_request;  /*!< the requested page of the pending job */
+    gint job_generation;  /*!< the request counter value of the pending job */
+    gint64 job_request_time;  /*!< monotonic time in microseconds when the pending job was requested */
+    data_revision_t job_revision;  /*!< revision of the editor's database when the pending job was requested */
+    gui_search_runner_page_t handover_page;  /*!< the result page that waits for the idle callback */
+    guint idle_source_id;  /*!< id of the scheduled idle callback, 0 if none */
+
+    /* temporary buffers, used by the worker thread or - if searching synchronously - by the main loop */
     data_diagram_t temp_diagram;  /*!< memory to read a diagram */
     data_diagramelement_t temp_diagramelement;  /*!< memory to read a diagram element */
     data_feature_t temp_feature;  /*!< memory to read a feature */
@@ -71,6 +122,7 @@ typedef struct gui_search_runner_struct gui_search_runner_t;
  *  \param message_to_user pointer to external message-displayer
  *  \param db_reader pointer to external database reader
  *  \param database pointer to external database - used to create a data_database_text_search_t
+ *                  and to open an own read-only connection to the same file
  *  \param result_consumer pointer to external observer_t which is informed on search results
  */
 void gui_search_runner_init ( gui_search_runner_t *this_,
@@ -88,7 +140,10 @@ void gui_search_runner_init ( gui_search_runner_t *this_,
 void gui_search_runner_destroy ( gui_search_runner_t *this_ );
 
 /*!
- *  \brief performs a search and informs the result_consumer of result set
+ *  \brief starts a search and informs the result_consumer of result set
+ *
+ *  A running search of a previous request is cancelled, its results are not presented.
+ *  If the search runs in the worker thread, the result_consumer is informed later from the main loop.
  *
  *  \param this_ pointer to own object attributes
  *  \param search_string search query, 0-terminated
@@ -97,27 +152,161 @@ void gui_search_runner_destroy ( gui_search_runner_t *this_ );
 void gui_search_runner_run ( gui_search_runner_t *this_, const char* search_string, pos_scroll_page_t page );
 
 /*!
- *  \brief performs a search on the same text again and informs the result_consumer of result set
+ *  \brief starts a search on the same text again and informs the result_consumer of result set
  *
  *  \param this_ pointer to own object attributes
  *  \param page the page to be loaded
  */
 void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t page );
 
+/*!
+ *  \brief prepares a database change and re-initializes afterwards
+ *
+ *  The worker thread and its own connection are stopped before the database closes
+ *  and started after a database is opened.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param signal_id state of database change
+ */
+void gui_search_runner_db_change_callback ( gui_search_runner_t *this_, data_database_listener_signal_t signal_id );
+
+/*!
+ *  \brief starts the worker thread if the database file allows a second connection that does not block the editor
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void gui_search_runner_private_start_worker ( gui_search_runner_t *this_ );
+
+/*!
+ *  \brief cancels the running search, stops the worker thread and closes its connection
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void gui_search_runner_private_stop_worker ( gui_search_runner_t *this_ );
+
+/*!
+ *  \brief main function of the worker thread: waits for jobs and performs the searches
+ *
+ *  \param data pointer to the gui_search_runner_t
+ *  \return NULL
+ */
+gpointer gui_search_runner_private_work ( gpointer data );
+
+/*!
+ *  \brief idle callback of the main loop: presents the result page of the worker thread
+ *
+ *  \param data pointer to the gui_search_runner_t
+ *  \return G_SOURCE_REMOVE
+ */
+gboolean gui_search_runner_private_present_idle ( gpointer data );
+
+/*!
+ *  \brief informs the result_consumer of the result page and reports the search latency
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void gui_search_runner_private_present ( gui_search_runner_t *this_ );
+
+/*!
+ *  \brief performs a search and stores the results in a page
+ *
+ *  Errors are logged, the page then contains the results found till the error.
+ *  If a newer request supersedes this search, the search is cancelled.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param db_reader database reader to use, either the editor's or the one of the snapshot
+ *  \param db_searcher freetext searcher to use, on the same connection as db_reader
+ *  \param search_string search query, 0-terminated
+ *  \param[in,out] io_page page with generation, request_time and page_request set; the results are added
+ */
+void gui_search_runner_private_search ( gui_search_runner_t *this_,
+                                        data_database_reader_t *db_reader,
+                                        data_database_text_search_t *db_searcher,
+                                        const char *search_string,
+                                        gui_search_runner_page_t *io_page
+                                      );
+
 /*!
  *  \brief searches diagrams in which a given object (classifier, feature or relationship) is visible and adds their ids to a result set
  *
  *  \param this_ pointer to own object attributes
+ *  \param db_reader database reader to use
  *  \param result_template a search result template that is already half-filled, only the diagram information is missing
  *  \param[in,out] io_skip_results if non-zero, these results are skipped and added to result_buffer_start instead.
+ *  \param[in,out] io_page page to which the search results are added
  *  \return error if either reading from database or writing to result_list is not possible (e.g. U8_ERROR_ARRAY_BUFFER_EXCEEDED).
  *          U8_ERROR_NONE otherwise.
  */
 u8_error_t gui_search_runner_private_add_diagrams_of_object ( gui_search_runner_t *this_,
+                                                              data_database_reader_t *db_reader,
                                                               data_search_result_t *result_template,
-                                                              uint_fast32_t *io_skip_results
+                                                              uint_fast32_t *io_skip_results,
+                                                              gui_search_runner_page_t *io_page
                                                             );
 
+/*!
+ *  \brief adds a search result to a page or skips it if the requested page starts later
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param search_result the search result to add
+ *  \param[in,out] io_skip_results if non-zero, the result is skipped and added to result_buffer_start instead.
+ *  \param[in,out] io_page page to which the search result is added
+ *  \return U8_ERROR_ARRAY_BUFFER_EXCEEDED if the page is full, U8_ERROR_NONE otherwise.
+ */
+u8_error_t gui_search_runner_private_add_result ( gui_search_runner_t *this_,
+                                                  const data_search_result_t *search_result,
+                                                  uint_fast32_t *io_skip_results,
+                                                  gui_search_runner_page_t *io_page
+                                                );
+
+/*!
+ *  \brief checks if a newer request supersedes the search that produces a page
+ *
+ *  This function may be called from any thread.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param page the page of the search
+ *  \return true if the search shall be cancelled
+ */
+static inline bool gui_search_runner_private_is_superseded ( gui_search_runner_t *this_, const gui_search_runner_page_t *page );
+
+/*!
+ *  \brief initializes a result page to empty
+ *
+ *  \param this_ pointer to the page
+ *  \param generation the request counter value of the request
+ *  \param request_time monotonic time in microseconds when the request was made
+ *  \param page_request the requested page
+ */
+static inline void gui_search_runner_page_init ( gui_search_runner_page_t *this_,
+                                                 gint generation,
+                                                 gint64 request_time,
+                                                 pos_scroll_page_t page_request
+                                               );
+
+/*!
+ *  \brief replaces the contents of a result page by a copy of another one
+ *
+ *  \param this_ pointer to the page
+ *  \param that the page to copy
+ */
+static inline void gui_search_runner_page_replace ( gui_search_runner_page_t *this_, const gui_search_runner_page_t *that );
+
+/*!
+ *  \brief destroys a result page
+ *
+ *  \param this_ pointer to the page
+ */
+static inline void gui_search_runner_page_destroy ( gui_search_runner_page_t *this_ );
+
+/*!
+ *  \brief checks if searches run in the worker thread
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if gui_search_runner_run returns before the result_consumer is informed
+ */
+static inline bool gui_search_runner_is_running_in_background ( const gui_search_runner_t *this_ );
+
 /*!
  *  \brief gets the page request that was guiding the search
  *
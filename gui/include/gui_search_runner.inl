@@ -1,23 +1,64 @@
 /* File: gui_search_runner.inl; Copyright and License: see below */
 
+static inline bool gui_search_runner_private_is_superseded ( gui_search_runner_t *this_, const gui_search_runner_page_t *page )
+{
+    return ( g_atomic_int_get( &((*this_).generation) ) != (*page).generation );
+}
+
+static inline void gui_search_runner_page_init ( gui_search_runner_page_t *this_,
+                                                 gint generation,
+                                                 gint64 request_time,
+                                                 pos_scroll_page_t page_request )
+{
+    (*this_).generation = generation;
+    (*this_).request_time = request_time;
+    (*this_).page_request = page_request;
+    (*this_).result_buffer_start = 0;
+    DATA_SEARCH_RESULT_LIST_INIT( &((*this_).result_list), (*this_).result_buffer );
+    (*this_).result_buffer_more_after = false;
+}
+
+static inline void gui_search_runner_page_replace ( gui_search_runner_page_t *this_, const gui_search_runner_page_t *that )
+{
+    (*this_).generation = (*that).generation;
+    (*this_).request_time = (*that).request_time;
+    (*this_).page_request = (*that).page_request;
+    (*this_).result_buffer_start = (*that).result_buffer_start;
+    data_search_result_list_clear( &((*this_).result_list) );
+    const u8_error_t copy_err = data_search_result_list_add_all( &((*this_).result_list), &((*that).result_list) );
+    assert( copy_err == U8_ERROR_NONE );  /* both lists have the same capacity */
+    (void) copy_err;
+    (*this_).result_buffer_more_after = (*that).result_buffer_more_after;
+}
+
+static inline void gui_search_runner_page_destroy ( gui_search_runner_page_t *this_ )
+{
+    data_search_result_list_destroy( &((*this_).result_list) );
+}
+
+static inline bool gui_search_runner_is_running_in_background ( const gui_search_runner_t *this_ )
+{
+    return ( NULL != (*this_).worker_thread );
+}
+
 static inline const pos_scroll_page_t* gui_search_runner_get_page_request( const gui_search_runner_t *this_ )
 {
-    return &((*this_).page_request);
+    return &((*this_).result.page_request);
 }
 
 static inline const data_search_result_list_t* gui_search_runner_get_result_list( const gui_search_runner_t *this_ )
 {
-    return &((*this_).result_list);
+    return &((*this_).result.result_list);
 }
 
 static inline uint32_t gui_search_runner_get_result_buffer_start( const gui_search_runner_t *this_ )
 {
-    return (*this_).result_buffer_start;
+    return (*this_).result.result_buffer_start;
 }
 
 static inline bool gui_search_runner_get_result_buffer_more_after( const gui_search_runner_t *this_ )
 {
-    return (*this_).result_buffer_more_after;
+    return (*this_).result.result_buffer_more_after;
 }
 
 
@@ -18,6 +18,7 @@
 #include "sketch/gui_sketch_request.h"
 #include "sketch/gui_sketch_texture.h"
 #include "layout/layout_subelement_id.h"
+#include "layout/layout_cache.h"
 #include "gui_toolbox.h"
 #include "gui_marked_set.h"
 #include "gui_search_runner.h"
@@ -77,6 +78,7 @@ struct gui_sketch_area_struct {
     gui_sketch_card_t cards[GUI_SKETCH_AREA_CONST_MAX_CARDS];  /*!< own instance of card objects that draw diagrams */
     uint32_t card_num;  /*!< number of cards that have its data loaded */
     data_small_set_t card_draw_list;  /*!< diagram IDs for which cards shall be drawn */
+    layout_cache_t layout_cache;  /*!< own cache of layout results, shared by all cards */
     gui_sketch_nav_tree_t nav_tree;  /*!< own instance of a navigation tree sub-widget */
     gui_sketch_result_list_t result_list;  /*!< own instance of a search result list sub-widget */
 
@@ -150,6 +152,18 @@ void gui_sketch_area_private_load_cards_data ( gui_sketch_area_t *this_ );
  */
 void gui_sketch_area_private_refocus_and_reload_data ( gui_sketch_area_t *this_ );
 
+/*!
+ *  \brief re-loads only those cards that are affected by a single change of the database
+ *
+ *  Changes to diagrams, multi-record-changes and database open/close events cannot be handled incrementally:
+ *  These may change the set of shown cards, the nav_tree or the focused diagram.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param msg message describing the changed database record
+ *  \return true if the change was handled, false if gui_sketch_area_private_refocus_and_reload_data() is needed
+ */
+bool gui_sketch_area_private_reload_changed_cards ( gui_sketch_area_t *this_, const data_change_message_t *msg );
+
 /*!
  *  \brief layouts the cards, nav_tree and result_list in the sketch area widget
  *
@@ -17,6 +17,7 @@
 #include "layout/layout_subelement_id.h"
 #include "layout/layout_order.h"
 #include "layout/layout_visible_set.h"
+#include "layout/layout_cache.h"
 #include "geometry/geometry_grid.h"
 #include "pencil_diagram_maker.h"
 #include "ctrl_controller.h"
@@ -38,6 +39,7 @@ struct gui_sketch_card_struct {
     data_profile_part_t profile;  /*!< caches the stereotypes referenced from the current diagram */
     pencil_diagram_maker_t painter;  /*!< own instance of a diagram painter */
     bool dirty_elements_layout;  /*!< marker that elements need to be layouted */
+    bool dirty_card_layout;  /*!< marker that grid and elements need to be layouted because data or bounds changed */
 
     /* helper classes to perform drawing */
     gui_sketch_marker_t sketch_marker;
@@ -50,8 +52,9 @@ typedef struct gui_sketch_card_struct gui_sketch_card_t;
  *  \brief initializes the gui_sketch_card_t struct
  *
  *  \param this_ pointer to own object attributes
+ *  \param layout_cache pointer to an external cache of layout results, NULL if layouts shall not be cached
  */
-void gui_sketch_card_init ( gui_sketch_card_t *this_ );
+void gui_sketch_card_init ( gui_sketch_card_t *this_, layout_cache_t *layout_cache );
 
 /*!
  *  \brief destroys the gui_sketch_card_t struct
@@ -71,6 +74,26 @@ static inline void gui_sketch_card_load_data( gui_sketch_card_t *this_,
                                               data_id_t diagram_id,
                                               data_database_reader_t *db_reader );
 
+/*!
+ *  \brief re-fetches the data of the already loaded diagram from the database
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param db_reader pointer to a database reader object
+ */
+static inline void gui_sketch_card_reload_data( gui_sketch_card_t *this_, data_database_reader_t *db_reader );
+
+/*!
+ *  \brief checks if the card shows the given object or depends on it
+ *
+ *  This is true for the diagram itself, for contained diagramelements, classifiers, features and relationships
+ *  and for the stereotypes referenced from the diagram.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param obj_id id of the object to search
+ *  \return true if the card shall be reloaded when the object is modified
+ */
+bool gui_sketch_card_shows_object( const gui_sketch_card_t *this_, data_id_t obj_id );
+
 /*!
  *  \brief marks the diagram data as invalid
  *
@@ -96,6 +119,8 @@ static inline shape_int_rectangle_t gui_sketch_card_get_bounds( const gui_sketch
 /*!
  *  \brief sets the bounds rectangle
  *
+ *  If the bounds differ from the previous ones, the card needs to be layouted again.
+ *
  *  \param this_ pointer to own object attributes
  *  \param bounds bounding box of this sketch card
  */
@@ -283,6 +308,7 @@ static inline void gui_sketch_card_layout_elements( gui_sketch_card_t *this_, ca
  *  \brief lays out the diagram (grid and elements)
  *
  *  This method may be called even if gui_sketch_card_is_valid() is false.
+ *  If neither the data nor the bounds have changed since the last call, the previous layout is kept.
  *
  *  \param this_ pointer to own object attributes
  *  \param cr cairo drawing context, needed to determine the font metrics
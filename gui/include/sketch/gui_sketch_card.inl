@@ -22,13 +22,20 @@ static inline void gui_sketch_card_load_data( gui_sketch_card_t *this_,
     {
         U8_TRACE_INFO( "data_profile_part_load() returned error." );
     }
+    (*this_).dirty_card_layout = true;
+}
+
+static inline void gui_sketch_card_reload_data( gui_sketch_card_t *this_, data_database_reader_t *db_reader )
+{
+    const data_id_t diagram_id = gui_sketch_card_get_diagram_id( this_ );
+    gui_sketch_card_load_data( this_, diagram_id, db_reader );
 }
 
 static inline void gui_sketch_card_invalidate_data( gui_sketch_card_t *this_ )
 {
     data_visible_set_invalidate( &((*this_).painter_input_data) );
     data_profile_part_reinit( &((*this_).profile) );
-
+    (*this_).dirty_card_layout = true;
 }
 
 static inline bool gui_sketch_card_is_valid( const gui_sketch_card_t *this_ )
@@ -43,6 +50,15 @@ static inline shape_int_rectangle_t gui_sketch_card_get_bounds( const gui_sketch
 
 static inline void gui_sketch_card_set_bounds( gui_sketch_card_t *this_, shape_int_rectangle_t bounds )
 {
+    const bool same_bounds
+        = ( shape_int_rectangle_get_left( &((*this_).bounds) ) == shape_int_rectangle_get_left( &bounds ) )
+        && ( shape_int_rectangle_get_top( &((*this_).bounds) ) == shape_int_rectangle_get_top( &bounds ) )
+        && ( shape_int_rectangle_get_width( &((*this_).bounds) ) == shape_int_rectangle_get_width( &bounds ) )
+        && ( shape_int_rectangle_get_height( &((*this_).bounds) ) == shape_int_rectangle_get_height( &bounds ) );
+    if ( ! same_bounds )
+    {
+        (*this_).dirty_card_layout = true;
+    }
     (*this_).bounds = bounds;
 }
 
@@ -168,7 +184,11 @@ static inline void gui_sketch_card_layout_elements( gui_sketch_card_t *this_, ca
 
 static inline void gui_sketch_card_do_layout( gui_sketch_card_t *this_, cairo_t *cr )
 {
-    if ( gui_sketch_card_is_valid( this_ ) )
+    if ( ! (*this_).dirty_card_layout )
+    {
+        U8_TRACE_INFO( "gui_sketch_card_do_layout skipped: neither data nor bounds changed." );
+    }
+    else if ( gui_sketch_card_is_valid( this_ ) )
     {
         /* layout loaded classifiers */
         const int32_t left = shape_int_rectangle_get_left( &((*this_).bounds) );
@@ -182,6 +202,7 @@ static inline void gui_sketch_card_do_layout( gui_sketch_card_t *this_, cairo_t
         pencil_diagram_maker_define_grid ( &((*this_).painter), destination, cr );
         pencil_diagram_maker_layout_elements ( &((*this_).painter), NULL, cr );
         (*this_).dirty_elements_layout = false;
+        (*this_).dirty_card_layout = false;
 
         geometry_rectangle_destroy( &destination );
     }
@@ -137,6 +137,20 @@ void gui_search_request_search_start_callback( GtkWidget* trigger_widget, gpoint
     U8_TRACE_END();
 }
 
+void gui_search_request_search_text_changed_callback( GtkWidget* trigger_widget, gpointer data )
+{
+    U8_TRACE_BEGIN();
+    gui_search_request_t *this_ = data;
+    assert( NULL != this_ );
+
+    if ( gui_search_runner_is_running_in_background( (*this_).search_runner ) )
+    {
+        gui_search_request_search_start_callback( trigger_widget, data );
+    }
+
+    U8_TRACE_END();
+}
+
 void gui_search_request_id_search_callback ( GtkWidget *widget, gpointer user_data )
 {
     U8_TRACE_BEGIN();
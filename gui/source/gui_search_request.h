@@ -87,6 +87,17 @@ void gui_search_request_tool_changed_callback( GtkWidget *widget, gui_tool_t too
  */
 void gui_search_request_search_start_callback( GtkWidget* trigger_widget, gpointer data );
 
+/*!
+ *  \brief callback that informs that the text in the text entry widget changed
+ *
+ *  If the search runner searches in the background, the search starts while typing;
+ *  each new character supersedes the search of the previous text.
+ *
+ *  \param trigger_widget the search text entry field
+ *  \param data pointer to own object attributes
+ */
+void gui_search_request_search_text_changed_callback( GtkWidget* trigger_widget, gpointer data );
+
 /*!
  *  \brief callback that informs that the id search button (in the attributes editor pane) was triggered
  *  \param widget the search id button that triggered the callback
@@ -6,6 +6,7 @@
 #include "u8/u8_trace.h"
 #include "u8/u8_log.h"
 #include "u8/u8_i32.h"
+#include <string.h>
 #include <assert.h>
 
 void gui_search_runner_init ( gui_search_runner_t *this_,
@@ -22,6 +23,7 @@ void gui_search_runner_init ( gui_search_runner_t *this_,
     /* external entities */
     (*this_).message_to_user = message_to_user;
     (*this_).db_reader = db_reader;
+    (*this_).database = database;
     const u8_error_t d_err = data_database_text_search_init ( &((*this_).db_searcher), database );
     if ( U8_ERROR_NONE != d_err )
     {
@@ -34,12 +36,40 @@ void gui_search_runner_init ( gui_search_runner_t *this_,
                               &((*this_).search_string_buf),
                               sizeof( (*this_).search_string_buf )
                             );
-    (*this_).page_request = pos_scroll_page_new( 0, false /* backwards */ );
+    (*this_).generation = 0;
 
     /* result data */
-    (*this_).result_buffer_start = 0;
-    DATA_SEARCH_RESULT_LIST_INIT( &((*this_).result_list), (*this_).result_buffer );
-    (*this_).result_buffer_more_after = false;
+    gui_search_runner_page_init( &((*this_).result), 0, 0, pos_scroll_page_new( 0, false /* backwards */ ) );
+
+    /* worker thread */
+    (*this_).worker_thread = NULL;
+    (*this_).snapshot_index_revision = DATA_REVISION_VOID;
+    (*this_).worker_search_string_buf[0] = '\0';
+    gui_search_runner_page_init( &((*this_).worker_page), 0, 0, pos_scroll_page_new( 0, false /* backwards */ ) );
+
+    /* attributes shared between threads */
+    g_mutex_init( &((*this_).lock) );
+    g_cond_init( &((*this_).job_available) );
+    (*this_).worker_shall_stop = false;
+    (*this_).job_pending = false;
+    (*this_).job_search_string_buf[0] = '\0';
+    (*this_).job_page_request = pos_scroll_page_new( 0, false /* backwards */ );
+    (*this_).job_generation = 0;
+    (*this_).job_request_time = 0;
+    (*this_).job_revision = DATA_REVISION_VOID;
+    gui_search_runner_page_init( &((*this_).handover_page), 0, 0, pos_scroll_page_new( 0, false /* backwards */ ) );
+    (*this_).idle_source_id = 0;
+
+    /* follow the database: open an own connection whenever a database file is opened */
+    data_database_listener_init( &((*this_).me_as_listener),
+                                 this_,
+                                 (void (*)(void*,data_database_listener_signal_t)) &gui_search_runner_db_change_callback
+                               );
+    data_database_add_db_listener( database, &((*this_).me_as_listener) );
+    if ( data_database_is_open( database ) )
+    {
+        gui_search_runner_private_start_worker( this_ );
+    }
 
     U8_TRACE_END();
 }
@@ -48,9 +78,23 @@ void gui_search_runner_destroy ( gui_search_runner_t *this_ )
 {
     U8_TRACE_BEGIN();
 
+    /* worker thread */
+    data_database_remove_db_listener( (*this_).database, &((*this_).me_as_listener) );
+    gui_search_runner_private_stop_worker( this_ );
+    if ( 0 != (*this_).idle_source_id )
+    {
+        g_source_remove( (*this_).idle_source_id );
+        (*this_).idle_source_id = 0;
+    }
+    gui_search_runner_page_destroy( &((*this_).handover_page) );
+    g_cond_clear( &((*this_).job_available) );
+    g_mutex_clear( &((*this_).lock) );
+    gui_search_runner_page_destroy( &((*this_).worker_page) );
+
     /* external entities */
     (*this_).message_to_user = NULL;
     (*this_).db_reader = NULL;
+    (*this_).database = NULL;
     const u8_error_t d_err = data_database_text_search_destroy ( &((*this_).db_searcher) );
     if ( U8_ERROR_NONE != d_err )
     {
@@ -62,13 +106,11 @@ void gui_search_runner_destroy ( gui_search_runner_t *this_ )
     const u8_error_t str_err = utf8stream_writemem_destroy( &((*this_).search_string_writer) );
     if ( U8_ERROR_NONE != str_err )
     {
-        U8_LOG_WARNING_HEX( "utf8stream_writemem_t could not be destroyed cleanly.", d_err );
+        U8_LOG_WARNING_HEX( "utf8stream_writemem_t could not be destroyed cleanly.", str_err );
     }
 
     /* result data */
-    (*this_).result_buffer_start = 0;
-    data_search_result_list_destroy( &((*this_).result_list) );
-    (*this_).result_buffer_more_after = false;
+    gui_search_runner_page_destroy( &((*this_).result) );
 
     U8_TRACE_END();
 }
@@ -102,24 +144,308 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
 {
     U8_TRACE_BEGIN();
 
-    /* store parameters internally */
-    (*this_).page_request = page;
     pos_scroll_page_trace( &page );
     const char *const search_string = utf8stream_writemem_get_string( &((*this_).search_string_writer) );
-    uint_fast32_t skip_results
-        = ( pos_scroll_page_get_backwards( &page ) )
-        ? u8_i32_max2( 0, ((signed)( pos_scroll_page_get_anchor_index( &page ) - GUI_SEARCH_RUNNER_MAX_RESULTS + 1 )) )
-        : pos_scroll_page_get_anchor_index( &page );
-    U8_TRACE_INFO_INT( "skipping", skip_results );
 
     /* reset previous errors/warnings/infos */
     gui_simple_message_to_user_hide( (*this_).message_to_user );
-    u8_error_t d_err = U8_ERROR_NONE;  /* a data read or data store error */
 
-    /* prepare search result */
-    (*this_).result_buffer_start = 0;
-    data_search_result_list_clear( &((*this_).result_list) );
-    (*this_).result_buffer_more_after = false;
+    /* a new request supersedes the running search */
+    g_atomic_int_inc( &((*this_).generation) );
+    const gint generation = g_atomic_int_get( &((*this_).generation) );
+    const gint64 request_time = g_get_monotonic_time();
+
+    if ( NULL != (*this_).worker_thread )
+    {
+        /* pass the job to the worker thread, a pending job that was not yet started is replaced */
+        const data_revision_t revision = data_database_get_revision( (*this_).database );
+        g_mutex_lock( &((*this_).lock) );
+        memcpy( &((*this_).job_search_string_buf), &((*this_).search_string_buf), sizeof( (*this_).job_search_string_buf ) );
+        (*this_).job_page_request = page;
+        (*this_).job_generation = generation;
+        (*this_).job_request_time = request_time;
+        (*this_).job_revision = revision;
+        (*this_).job_pending = true;
+        g_cond_signal( &((*this_).job_available) );
+        g_mutex_unlock( &((*this_).lock) );
+    }
+    else
+    {
+        /* search synchronously on the editor's connection */
+        gui_search_runner_page_destroy( &((*this_).result) );
+        gui_search_runner_page_init( &((*this_).result), generation, request_time, page );
+        gui_search_runner_private_search( this_,
+                                          (*this_).db_reader,
+                                          &((*this_).db_searcher),
+                                          search_string,
+                                          &((*this_).result)
+                                        );
+        gui_search_runner_private_present( this_ );
+    }
+
+    U8_TRACE_END();
+}
+
+void gui_search_runner_db_change_callback ( gui_search_runner_t *this_, data_database_listener_signal_t signal_id )
+{
+    U8_TRACE_BEGIN();
+
+    switch ( signal_id )
+    {
+        case DATA_DATABASE_LISTENER_SIGNAL_PREPARE_CLOSE:
+        {
+            U8_TRACE_INFO( "DATA_DATABASE_LISTENER_SIGNAL_PREPARE_CLOSE" );
+            gui_search_runner_private_stop_worker( this_ );
+        }
+        break;
+
+        case DATA_DATABASE_LISTENER_SIGNAL_DB_OPENED:
+        {
+            U8_TRACE_INFO( "DATA_DATABASE_LISTENER_SIGNAL_DB_OPENED" );
+            gui_search_runner_private_stop_worker( this_ );
+            gui_search_runner_private_start_worker( this_ );
+        }
+        break;
+
+        default:
+        {
+            U8_LOG_ERROR( "unexpected data_database_listener_signal_t" );
+        }
+    }
+
+    U8_TRACE_END();
+}
+
+void gui_search_runner_private_start_worker ( gui_search_runner_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL == (*this_).worker_thread );
+
+    /* only the write-ahead log of a working copy allows the editor to commit while the worker reads */
+    const char *const db_file_path = data_database_get_filename_ptr( (*this_).database );
+    const bool is_working_copy = ( DATA_DATABASE_PROFILE_WORKING_COPY == data_database_get_profile( (*this_).database ) );
+    if (( NULL != db_file_path )&&( is_working_copy ))
+    {
+        /* the search index of the own connection is created and filled at its first search */
+        (*this_).snapshot_index_revision = data_database_get_revision( (*this_).database );
+        u8_error_t open_err = data_database_snapshot_init( &((*this_).snapshot), db_file_path );
+
+        /* check the journal mode: a snapshot is only pinned in write-ahead-log mode */
+        open_err |= data_database_snapshot_pin( &((*this_).snapshot) );
+        const bool is_wal = data_database_snapshot_is_pinned( &((*this_).snapshot) );
+        open_err |= data_database_snapshot_release( &((*this_).snapshot) );
+
+        if (( open_err == U8_ERROR_NONE )&&( is_wal ))
+        {
+            open_err |= data_database_text_search_init( &((*this_).snapshot_searcher),
+                                                        data_database_snapshot_get_database_ptr( &((*this_).snapshot) )
+                                                      );
+            if ( open_err == U8_ERROR_NONE )
+            {
+                (*this_).worker_shall_stop = false;
+                (*this_).job_pending = false;
+                (*this_).worker_thread = g_thread_try_new( "cfu_search", &gui_search_runner_private_work, this_, NULL );
+            }
+            if ( NULL == (*this_).worker_thread )
+            {
+                data_database_text_search_destroy( &((*this_).snapshot_searcher) );
+            }
+        }
+        if ( NULL == (*this_).worker_thread )
+        {
+            U8_LOG_WARNING_HEX( "search runs synchronously, no worker thread on an own connection:", open_err );
+            data_database_snapshot_destroy( &((*this_).snapshot) );
+        }
+        else
+        {
+            U8_LOG_EVENT( "search runs in a worker thread." );
+        }
+    }
+    else
+    {
+        U8_LOG_EVENT( "search runs synchronously, the database is not a working copy." );
+    }
+
+    U8_TRACE_END();
+}
+
+void gui_search_runner_private_stop_worker ( gui_search_runner_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    if ( NULL != (*this_).worker_thread )
+    {
+        /* cancel the running search and a result that waits for the idle callback */
+        g_atomic_int_inc( &((*this_).generation) );
+
+        g_mutex_lock( &((*this_).lock) );
+        (*this_).worker_shall_stop = true;
+        g_cond_signal( &((*this_).job_available) );
+        g_mutex_unlock( &((*this_).lock) );
+
+        g_thread_join( (*this_).worker_thread );
+        (*this_).worker_thread = NULL;
+
+        /* close the own connection in this thread: database close notifies listeners and is not thread-safe */
+        const u8_error_t search_err = data_database_text_search_destroy( &((*this_).snapshot_searcher) );
+        const u8_error_t close_err = data_database_snapshot_destroy( &((*this_).snapshot) );
+        if ( ( search_err | close_err ) != U8_ERROR_NONE )
+        {
+            U8_LOG_WARNING_HEX( "own connection of the search worker could not be closed cleanly:", search_err | close_err );
+        }
+    }
+
+    U8_TRACE_END();
+}
+
+gpointer gui_search_runner_private_work ( gpointer data )
+{
+    U8_TRACE_BEGIN();
+    gui_search_runner_t *const this_ = data;
+    assert( NULL != this_ );
+    data_database_t *const snapshot_db = data_database_snapshot_get_database_ptr( &((*this_).snapshot) );
+
+    bool stop = false;
+    while ( ! stop )
+    {
+        /* wait for a job */
+        data_revision_t revision = DATA_REVISION_VOID;
+        g_mutex_lock( &((*this_).lock) );
+        while (( ! (*this_).job_pending )&&( ! (*this_).worker_shall_stop ))
+        {
+            g_cond_wait( &((*this_).job_available), &((*this_).lock) );
+        }
+        stop = (*this_).worker_shall_stop;
+        if ( ! stop )
+        {
+            memcpy( &((*this_).worker_search_string_buf),
+                    &((*this_).job_search_string_buf),
+                    sizeof( (*this_).worker_search_string_buf )
+                  );
+            gui_search_runner_page_destroy( &((*this_).worker_page) );
+            gui_search_runner_page_init( &((*this_).worker_page),
+                                         (*this_).job_generation,
+                                         (*this_).job_request_time,
+                                         (*this_).job_page_request
+                                       );
+            revision = (*this_).job_revision;
+            (*this_).job_pending = false;
+        }
+        g_mutex_unlock( &((*this_).lock) );
+
+        if (( ! stop )&&( ! gui_search_runner_private_is_superseded( this_, &((*this_).worker_page) ) ))
+        {
+            /* all queries of one job see the same state of the database */
+            u8_error_t d_err = data_database_snapshot_pin( &((*this_).snapshot) );
+            if (( d_err == U8_ERROR_NONE )&&( revision != (*this_).snapshot_index_revision ))
+            {
+                /* the triggers of the editor's connection do not update the search index of the own connection */
+                d_err |= data_database_refill_search_index( snapshot_db );
+                if ( d_err == U8_ERROR_NONE )
+                {
+                    (*this_).snapshot_index_revision = revision;
+                }
+            }
+            if ( d_err != U8_ERROR_NONE )
+            {
+                U8_LOG_WARNING_HEX( "search worker could not prepare its connection, searching anyhow:", d_err );
+            }
+
+            gui_search_runner_private_search( this_,
+                                              data_database_snapshot_get_reader_ptr( &((*this_).snapshot) ),
+                                              &((*this_).snapshot_searcher),
+                                              (*this_).worker_search_string_buf,
+                                              &((*this_).worker_page)
+                                            );
+            data_database_snapshot_release( &((*this_).snapshot) );
+
+            /* hand over the result page to the main loop */
+            g_mutex_lock( &((*this_).lock) );
+            if ( ! gui_search_runner_private_is_superseded( this_, &((*this_).worker_page) ) )
+            {
+                gui_search_runner_page_replace( &((*this_).handover_page), &((*this_).worker_page) );
+                if ( 0 == (*this_).idle_source_id )
+                {
+                    (*this_).idle_source_id = g_idle_add( &gui_search_runner_private_present_idle, this_ );
+                }
+            }
+            else
+            {
+                U8_TRACE_INFO( "search was superseded by a newer request." );
+            }
+            g_mutex_unlock( &((*this_).lock) );
+        }
+    }
+
+    U8_TRACE_END();
+    return NULL;
+}
+
+gboolean gui_search_runner_private_present_idle ( gpointer data )
+{
+    U8_TRACE_BEGIN();
+    gui_search_runner_t *const this_ = data;
+    assert( NULL != this_ );
+
+    g_mutex_lock( &((*this_).lock) );
+    (*this_).idle_source_id = 0;
+    const bool is_current = ! gui_search_runner_private_is_superseded( this_, &((*this_).handover_page) );
+    if ( is_current )
+    {
+        gui_search_runner_page_replace( &((*this_).result), &((*this_).handover_page) );
+    }
+    g_mutex_unlock( &((*this_).lock) );
+
+    if ( is_current )
+    {
+        gui_search_runner_private_present( this_ );
+    }
+    else
+    {
+        U8_TRACE_INFO( "search result was superseded by a newer request." );
+    }
+
+    U8_TRACE_END();
+    return G_SOURCE_REMOVE;
+}
+
+void gui_search_runner_private_present ( gui_search_runner_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    const gint64 latency = g_get_monotonic_time() - (*this_).result.request_time;
+    U8_LOG_EVENT_INT( "search latency [us]:", (int) latency );
+    U8_LOG_EVENT_INT( "search results:", data_search_result_list_get_length( &((*this_).result.result_list) ) );
+
+    /* present the result */
+    observer_notify( &((*this_).result_consumer), this_ );
+
+    /* clear the result (the notification above is synchronous, the search results are already processed.) */
+    data_search_result_list_clear( &((*this_).result.result_list) );
+
+    U8_TRACE_END();
+}
+
+void gui_search_runner_private_search ( gui_search_runner_t *this_,
+                                        data_database_reader_t *db_reader,
+                                        data_database_text_search_t *db_searcher,
+                                        const char *search_string,
+                                        gui_search_runner_page_t *io_page )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != db_reader );
+    assert( NULL != db_searcher );
+    assert( NULL != search_string );
+    assert( NULL != io_page );
+
+    const pos_scroll_page_t *const page = &((*io_page).page_request);
+    uint_fast32_t skip_results
+        = ( pos_scroll_page_get_backwards( page ) )
+        ? u8_i32_max2( 0, ((signed)( pos_scroll_page_get_anchor_index( page ) - GUI_SEARCH_RUNNER_MAX_RESULTS + 1 )) )
+        : pos_scroll_page_get_anchor_index( page );
+    U8_TRACE_INFO_INT( "skipping", skip_results );
+
+    u8_error_t d_err = U8_ERROR_NONE;  /* a data read or data store error */
 
     /* check if an id is being searched */
     data_id_t search_id;
@@ -133,7 +459,7 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
         {
             case DATA_TABLE_CLASSIFIER:
             {
-                d_err = data_database_reader_get_classifier_by_id( (*this_).db_reader,
+                d_err = data_database_reader_get_classifier_by_id( db_reader,
                                                                    search_row,
                                                                    &((*this_).temp_classifier)
                                                                  );
@@ -147,8 +473,10 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
                                                         DATA_ROW_VOID /* diagram_id */
                                                       );
                     d_err |= gui_search_runner_private_add_diagrams_of_object( this_,
+                                                                               db_reader,
                                                                                &half_initialized,
-                                                                               &skip_results
+                                                                               &skip_results,
+                                                                               io_page
                                                                              );
 
                     data_classifier_destroy( &((*this_).temp_classifier) );
@@ -163,7 +491,7 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
 
             case DATA_TABLE_FEATURE:
             {
-                d_err = data_database_reader_get_feature_by_id( (*this_).db_reader,
+                d_err = data_database_reader_get_feature_by_id( db_reader,
                                                                 search_row,
                                                                 &((*this_).temp_feature)
                                                               );
@@ -179,8 +507,10 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
                                                      DATA_ROW_VOID /* diagram_id */
                                                    );
                     d_err |= gui_search_runner_private_add_diagrams_of_object( this_,
+                                                                               db_reader,
                                                                                &half_initialized,
-                                                                               &skip_results
+                                                                               &skip_results,
+                                                                               io_page
                                                                              );
 
                     data_feature_destroy( &((*this_).temp_feature) );
@@ -195,7 +525,7 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
 
             case DATA_TABLE_RELATIONSHIP:
             {
-                d_err = data_database_reader_get_relationship_by_id( (*this_).db_reader,
+                d_err = data_database_reader_get_relationship_by_id( db_reader,
                                                                      search_row,
                                                                      &((*this_).temp_relationship)
                                                                    );
@@ -212,8 +542,10 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
                                                           DATA_ROW_VOID /* diagram_id */
                                                         );
                     d_err |= gui_search_runner_private_add_diagrams_of_object( this_,
+                                                                               db_reader,
                                                                                &half_initialized,
-                                                                               &skip_results
+                                                                               &skip_results,
+                                                                               io_page
                                                                              );
 
                     data_relationship_destroy( &((*this_).temp_relationship) );
@@ -228,36 +560,21 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
 
             case DATA_TABLE_DIAGRAMELEMENT:
             {
-                d_err = data_database_reader_get_diagramelement_by_id( (*this_).db_reader,
+                d_err = data_database_reader_get_diagramelement_by_id( db_reader,
                                                                        search_row,
                                                                        &((*this_).temp_diagramelement)
                                                                      );
                 if ( d_err == U8_ERROR_NONE )
                 {
-                    if ( skip_results == 0 )
-                    {
-                        data_search_result_t half_initialized;
-                        data_search_result_init_classifier( &half_initialized,
-                                                            data_diagramelement_get_classifier_row(&((*this_).temp_diagramelement)),
-                                                            0 /* match_type is unknown */,
-                                                            "" /* match_name */,
-                                                            data_diagramelement_get_diagram_row(&((*this_).temp_diagramelement))
-                                                          );
-                        const u8_error_t err = data_search_result_list_add( &((*this_).result_list), &half_initialized );
-                        if ( err != U8_ERROR_NONE )
-                        {
-                            d_err |= U8_ERROR_ARRAY_BUFFER_EXCEEDED;
-                            U8_LOG_ANOMALY( "U8_ERROR_ARRAY_BUFFER_EXCEEDED at inserting search result to list" );
-                            (*this_).result_buffer_more_after = true;  /* there are more results that cannot be stored in &((*this_).result_list) */
-                        }
-                        data_search_result_destroy( &half_initialized );
-                    }
-                    else
-                    {
-                        /* to advance to the requested search result page, skip this entry */
-                        skip_results --;
-                        (*this_).result_buffer_start ++;
-                    }
+                    data_search_result_t half_initialized;
+                    data_search_result_init_classifier( &half_initialized,
+                                                        data_diagramelement_get_classifier_row(&((*this_).temp_diagramelement)),
+                                                        0 /* match_type is unknown */,
+                                                        "" /* match_name */,
+                                                        data_diagramelement_get_diagram_row(&((*this_).temp_diagramelement))
+                                                      );
+                    d_err |= gui_search_runner_private_add_result( this_, &half_initialized, &skip_results, io_page );
+                    data_search_result_destroy( &half_initialized );
 
                     data_diagramelement_destroy( &((*this_).temp_diagramelement) );
                 }
@@ -270,32 +587,17 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
 
             case DATA_TABLE_DIAGRAM:
             {
-                d_err = data_database_reader_get_diagram_by_id ( (*this_).db_reader, search_row, &((*this_).temp_diagram) );
+                d_err = data_database_reader_get_diagram_by_id ( db_reader, search_row, &((*this_).temp_diagram) );
                 if ( d_err == U8_ERROR_NONE )
                 {
-                    if ( skip_results == 0 )
-                    {
-                        data_search_result_t half_initialized;
-                        data_search_result_init_diagram( &half_initialized,
-                                                         search_row,
-                                                         data_diagram_get_diagram_type( &((*this_).temp_diagram) ),
-                                                         data_diagram_get_name_const( &((*this_).temp_diagram) )
-                                                       );
-                        const u8_error_t err = data_search_result_list_add( &((*this_).result_list), &half_initialized );
-                        if ( err != U8_ERROR_NONE )
-                        {
-                            d_err |= U8_ERROR_ARRAY_BUFFER_EXCEEDED;
-                            U8_LOG_ANOMALY( "U8_ERROR_ARRAY_BUFFER_EXCEEDED at inserting search result to list" );
-                            (*this_).result_buffer_more_after = true;  /* there are more results that cannot be stored in &((*this_).result_list) */
-                        }
-                        data_search_result_destroy( &half_initialized );
-                    }
-                    else
-                    {
-                        /* to advance to the requested search result page, skip this entry */
-                        skip_results --;
-                        (*this_).result_buffer_start ++;
-                    }
+                    data_search_result_t half_initialized;
+                    data_search_result_init_diagram( &half_initialized,
+                                                     search_row,
+                                                     data_diagram_get_diagram_type( &((*this_).temp_diagram) ),
+                                                     data_diagram_get_name_const( &((*this_).temp_diagram) )
+                                                   );
+                    d_err |= gui_search_runner_private_add_result( this_, &half_initialized, &skip_results, io_page );
+                    data_search_result_destroy( &half_initialized );
 
                     data_diagram_destroy( &((*this_).temp_diagram) );
                 }
@@ -319,41 +621,32 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
     }
 
     /* free text search */
-    if ( d_err == U8_ERROR_NONE )
+    if (( d_err == U8_ERROR_NONE )&&( ! gui_search_runner_private_is_superseded( this_, io_page ) ))
     {
         data_search_result_iterator_t data_search_result_iterator;
         data_search_result_iterator_init_empty( &data_search_result_iterator );
-        d_err = data_database_text_search_get_objects_by_text_fragment( &((*this_).db_searcher),
+        d_err = data_database_text_search_get_objects_by_text_fragment( db_searcher,
                                                                         search_string,
                                                                         &data_search_result_iterator
                                                                       );
-        while (( data_search_result_iterator_has_next( &data_search_result_iterator ) )&&( d_err == U8_ERROR_NONE ))
+        while (( data_search_result_iterator_has_next( &data_search_result_iterator ) )
+            &&( d_err == U8_ERROR_NONE )
+            &&( ! gui_search_runner_private_is_superseded( this_, io_page ) ))
         {
             data_search_result_t current_search_result;
             d_err |= data_search_result_iterator_next( &data_search_result_iterator,
                                                        &current_search_result
                                                      );
-            if ( skip_results == 0 )
-            {
-                const u8_error_t err = data_search_result_list_add( &((*this_).result_list), &current_search_result );
-                if ( err != U8_ERROR_NONE )
-                {
-                    d_err |= U8_ERROR_ARRAY_BUFFER_EXCEEDED;
-                    U8_LOG_ANOMALY( "U8_ERROR_ARRAY_BUFFER_EXCEEDED at inserting search result to list" );
-                    (*this_).result_buffer_more_after = true;  /* there are more results that cannot be stored in &((*this_).result_list) */
-                }
-            }
-            else
-            {
-                /* to advance to the requested search result page, skip this entry */
-                skip_results --;
-                (*this_).result_buffer_start ++;
-            }
+            d_err |= gui_search_runner_private_add_result( this_, &current_search_result, &skip_results, io_page );
         }
         d_err |= data_search_result_iterator_destroy( &data_search_result_iterator );
     }
 
-    if ( d_err == U8_ERROR_ARRAY_BUFFER_EXCEEDED )
+    if ( gui_search_runner_private_is_superseded( this_, io_page ) )
+    {
+        U8_TRACE_INFO( "search cancelled, superseded by a newer request." );
+    }
+    else if ( d_err == U8_ERROR_ARRAY_BUFFER_EXCEEDED )
     {
         /* it is rather expected than a real error that the result list gets full */
         U8_TRACE_INFO( "U8_ERROR_ARRAY_BUFFER_EXCEEDED at inserting search result to list" );
@@ -363,22 +656,20 @@ void gui_search_runner_rerun ( gui_search_runner_t *this_, pos_scroll_page_t pag
         U8_LOG_ERROR_HEX( "data_database_text_search_t could not search.", d_err );
     }
 
-    /* present the result */
-    observer_notify( &((*this_).result_consumer), this_ );
-
-    /* clear the result (the notification above is synchronous, the search results are already processed.) */
-    data_search_result_list_clear( &((*this_).result_list) );
-
     U8_TRACE_END();
 }
 
 u8_error_t gui_search_runner_private_add_diagrams_of_object( gui_search_runner_t *this_,
+                                                             data_database_reader_t *db_reader,
                                                              data_search_result_t *result_template,
-                                                             uint_fast32_t *io_skip_results
+                                                             uint_fast32_t *io_skip_results,
+                                                             gui_search_runner_page_t *io_page
                                                            )
 {
     U8_TRACE_BEGIN();
+    assert( db_reader != NULL );
     assert( result_template != NULL );
+    assert( io_page != NULL );
     u8_error_t d_err = U8_ERROR_NONE;  /* a data read or data store error */
 
     /* initialize an iterator to fetch all diagrams where result_template occurs: */
@@ -391,7 +682,7 @@ u8_error_t gui_search_runner_private_add_diagrams_of_object( gui_search_runner_t
         {
             const data_row_t classifier_row
                 = data_id_get_row( data_search_result_get_match_id_const( result_template ));
-            d_err |= data_database_reader_get_diagrams_by_classifier_id( (*this_).db_reader,
+            d_err |= data_database_reader_get_diagrams_by_classifier_id( db_reader,
                                                                          classifier_row,
                                                                          &diagram_iterator
                                                                        );
@@ -402,7 +693,7 @@ u8_error_t gui_search_runner_private_add_diagrams_of_object( gui_search_runner_t
         {
             const data_row_t classifier_row
                 = data_id_get_row( data_search_result_get_src_classifier_id_const( result_template ));
-            d_err |= data_database_reader_get_diagrams_by_classifier_id( (*this_).db_reader,
+            d_err |= data_database_reader_get_diagrams_by_classifier_id( db_reader,
                                                                          classifier_row,
                                                                          &diagram_iterator
                                                                        );
@@ -413,7 +704,7 @@ u8_error_t gui_search_runner_private_add_diagrams_of_object( gui_search_runner_t
         {
             const data_row_t relationship_row
                 = data_id_get_row( data_search_result_get_match_id_const( result_template ));
-            d_err |= data_database_reader_get_diagrams_by_relationship_id( (*this_).db_reader,
+            d_err |= data_database_reader_get_diagrams_by_relationship_id( db_reader,
                                                                            relationship_row,
                                                                            &diagram_iterator
                                                                          );
@@ -430,31 +721,17 @@ u8_error_t gui_search_runner_private_add_diagrams_of_object( gui_search_runner_t
         break;
     }
 
-    while (( data_diagram_iterator_has_next( &diagram_iterator ) )&&( d_err == U8_ERROR_NONE ))
+    while (( data_diagram_iterator_has_next( &diagram_iterator ) )
+        &&( d_err == U8_ERROR_NONE )
+        &&( ! gui_search_runner_private_is_superseded( this_, io_page ) ))
     {
         /* fetch diagram from iterator */
         d_err |= data_diagram_iterator_next( &diagram_iterator, &((*this_).temp_diagram) );
         const data_row_t diagram_row = data_diagram_get_row( &((*this_).temp_diagram) );
 
-        if ( (*io_skip_results) == 0 )
-        {
-            /* complete the half initialized search result template */
-            data_id_reinit( data_search_result_get_diagram_id_ptr( result_template ), DATA_TABLE_DIAGRAM, diagram_row );
-
-            const u8_error_t err = data_search_result_list_add( &((*this_).result_list), result_template );
-            if ( err != U8_ERROR_NONE )
-            {
-                d_err |= U8_ERROR_ARRAY_BUFFER_EXCEEDED;
-                U8_LOG_ANOMALY( "U8_ERROR_ARRAY_BUFFER_EXCEEDED at inserting search result to list" );
-                (*this_).result_buffer_more_after = true;  /* there are more results that cannot be stored in &((*this_).result_list) */
-            }
-        }
-        else
-        {
-            /* to advance to the requested search result page, skip this entry */
-            *io_skip_results = (*io_skip_results) - 1;
-            (*this_).result_buffer_start ++;
-        }
+        /* complete the half initialized search result template */
+        data_id_reinit( data_search_result_get_diagram_id_ptr( result_template ), DATA_TABLE_DIAGRAM, diagram_row );
+        d_err |= gui_search_runner_private_add_result( this_, result_template, io_skip_results, io_page );
 
         data_diagram_destroy( &((*this_).temp_diagram) );
     }
@@ -465,6 +742,35 @@ u8_error_t gui_search_runner_private_add_diagrams_of_object( gui_search_runner_t
     return d_err;
 }
 
+u8_error_t gui_search_runner_private_add_result ( gui_search_runner_t *this_,
+                                                  const data_search_result_t *search_result,
+                                                  uint_fast32_t *io_skip_results,
+                                                  gui_search_runner_page_t *io_page )
+{
+    assert( search_result != NULL );
+    assert( io_skip_results != NULL );
+    assert( io_page != NULL );
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*io_skip_results) == 0 )
+    {
+        const u8_error_t err = data_search_result_list_add( &((*io_page).result_list), search_result );
+        if ( err != U8_ERROR_NONE )
+        {
+            result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+            U8_LOG_ANOMALY( "U8_ERROR_ARRAY_BUFFER_EXCEEDED at inserting search result to list" );
+            (*io_page).result_buffer_more_after = true;  /* there are more results that cannot be stored in the result_list */
+        }
+    }
+    else
+    {
+        /* to advance to the requested search result page, skip this entry */
+        *io_skip_results = (*io_skip_results) - 1;
+        (*io_page).result_buffer_start ++;
+    }
+
+    return result;
+}
 
 /*
 Copyright 2020-2026 Andreas Warnke
@@ -49,6 +49,7 @@ void gui_sketch_area_init( gui_sketch_area_t *this_,
     /* init instances of own objects */
     (*this_).card_num = 0;
     data_small_set_init( &((*this_).card_draw_list) );
+    layout_cache_init( &((*this_).layout_cache) );
     (*this_).marker = marker;
     gui_sketch_texture_init( &((*this_).texture_downloader) );
     gui_sketch_nav_tree_init( &((*this_).nav_tree), resources, &((*this_).texture_downloader) );
@@ -110,6 +111,7 @@ void gui_sketch_area_destroy( gui_sketch_area_t *this_ )
         gui_sketch_card_destroy( &((*this_).cards[idx]) );
     }
     (*this_).card_num = 0;
+    layout_cache_destroy( &((*this_).layout_cache) );
 
     /* destroy instances of own objects */
     gui_sketch_object_creator_destroy ( &((*this_).object_creator) );
@@ -355,6 +357,122 @@ void gui_sketch_area_private_refocus_and_reload_data ( gui_sketch_area_t *this_
     U8_TRACE_END();
 }
 
+bool gui_sketch_area_private_reload_changed_cards ( gui_sketch_area_t *this_, const data_change_message_t *msg )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != msg );
+    bool handled = false;
+
+    const data_change_event_type_t evt_type = data_change_message_get_event( msg );
+    const data_id_t modified = data_change_message_get_modified( msg );
+    const data_id_t parent = data_change_message_get_parent( msg );
+    const bool single_record_change
+        = ( evt_type == DATA_CHANGE_EVENT_TYPE_CREATE )
+        || ( evt_type == DATA_CHANGE_EVENT_TYPE_UPDATE )
+        || ( evt_type == DATA_CHANGE_EVENT_TYPE_DELETE );
+
+    /* determine the object that a card shows if it is affected by the change */
+    data_id_t probe = DATA_ID_VOID;
+    if ( single_record_change )
+    {
+        switch ( data_id_get_table( &modified ) )
+        {
+            case DATA_TABLE_CLASSIFIER:
+            {
+                if ( evt_type == DATA_CHANGE_EVENT_TYPE_DELETE )
+                {
+                    /* a deleted classifier is not visible anymore, but may still be cached as stereotype */
+                    probe = modified;
+                    handled = true;
+                }
+                else
+                {
+                    /* a created or renamed stereotype may be referenced by any diagram, check the type */
+                    data_classifier_t classifier;
+                    const u8_error_t read_err
+                        = data_database_reader_get_classifier_by_id( (*this_).db_reader, data_id_get_row( &modified ), &classifier );
+                    if ( read_err == U8_ERROR_NONE )
+                    {
+                        probe = modified;
+                        handled = ( DATA_CLASSIFIER_TYPE_STEREOTYPE != data_classifier_get_main_type( &classifier ) );
+                        data_classifier_destroy( &classifier );
+                    }
+                }
+            }
+            break;
+
+            case DATA_TABLE_FEATURE:
+            {
+                if ( evt_type == DATA_CHANGE_EVENT_TYPE_CREATE )
+                {
+                    /* the parent of a new feature is the classifier */
+                    probe = parent;
+                    handled = data_id_is_valid( &parent );
+                }
+                else if ( evt_type == DATA_CHANGE_EVENT_TYPE_UPDATE )
+                {
+                    /* a type change may make a feature visible, e.g. a former lifeline, check the classifier */
+                    data_feature_t feature;
+                    const u8_error_t read_err
+                        = data_database_reader_get_feature_by_id( (*this_).db_reader, data_id_get_row( &modified ), &feature );
+                    if ( read_err == U8_ERROR_NONE )
+                    {
+                        probe = data_feature_get_classifier_data_id( &feature );
+                        handled = true;
+                        data_feature_destroy( &feature );
+                    }
+                }
+                else
+                {
+                    probe = modified;
+                    handled = true;
+                }
+            }
+            break;
+
+            case DATA_TABLE_RELATIONSHIP:
+            {
+                /* the parent of a new relationship is the from-classifier */
+                probe = ( evt_type == DATA_CHANGE_EVENT_TYPE_CREATE ) ? parent : modified;
+                handled = data_id_is_valid( &probe );
+            }
+            break;
+
+            case DATA_TABLE_DIAGRAMELEMENT:
+            {
+                /* the parent of a new diagramelement is the diagram */
+                probe = ( evt_type == DATA_CHANGE_EVENT_TYPE_CREATE ) ? parent : modified;
+                handled = data_id_is_valid( &probe );
+            }
+            break;
+
+            default:
+            {
+                /* diagrams influence the nav_tree and the set of cards, these need a full reload */
+                handled = false;
+            }
+            break;
+        }
+    }
+
+    /* reload only the cards that show the probe object */
+    if ( handled && data_id_is_valid( &probe ) )
+    {
+        for ( uint_fast32_t idx = 0; idx < (*this_).card_num; idx ++ )
+        {
+            gui_sketch_card_t *const card = &((*this_).cards[idx]);
+            if ( gui_sketch_card_shows_object( card, probe ) )
+            {
+                U8_TRACE_INFO_INT( "reloading card:", idx );
+                gui_sketch_card_reload_data( card, (*this_).db_reader );
+            }
+        }
+    }
+
+    U8_TRACE_END();
+    return handled;
+}
+
 void gui_sketch_area_private_load_cards_data ( gui_sketch_area_t *this_ )
 {
     U8_TRACE_BEGIN();
@@ -382,7 +500,7 @@ void gui_sketch_area_private_load_cards_data ( gui_sketch_area_t *this_ )
                 const data_id_t diag_id = data_small_set_get_id( requested_diagrams, index );
                 if ( (*this_).card_num < GUI_SKETCH_AREA_CONST_MAX_CARDS )
                 {
-                    gui_sketch_card_init( &((*this_).cards[(*this_).card_num]) );
+                    gui_sketch_card_init( &((*this_).cards[(*this_).card_num]), &((*this_).layout_cache) );
                     gui_sketch_card_load_data( &((*this_).cards[(*this_).card_num]), diag_id, (*this_).db_reader );
                     if ( gui_sketch_card_is_valid( &((*this_).cards[(*this_).card_num]) ) )
                     {
@@ -405,7 +523,7 @@ void gui_sketch_area_private_load_cards_data ( gui_sketch_area_t *this_ )
         {
             const data_id_t main_diagram_id = gui_sketch_request_get_focused_diagram( &((*this_).request) );
 
-            gui_sketch_card_init( &((*this_).cards[GUI_SKETCH_AREA_CONST_FOCUSED_CARD]) );
+            gui_sketch_card_init( &((*this_).cards[GUI_SKETCH_AREA_CONST_FOCUSED_CARD]), &((*this_).layout_cache) );
             gui_sketch_card_load_data( &((*this_).cards[GUI_SKETCH_AREA_CONST_FOCUSED_CARD]), main_diagram_id, (*this_).db_reader );
             (*this_).card_num = 1;
             gui_sketch_nav_tree_load_data( &((*this_).nav_tree), data_id_get_row( &main_diagram_id ), (*this_).db_reader );
@@ -436,7 +554,7 @@ void gui_sketch_area_private_load_cards_data ( gui_sketch_area_t *this_ )
             {
 
                 /* load parent even if there is no parent (-->VOID) */
-                gui_sketch_card_init( &((*this_).cards[GUI_SKETCH_AREA_CONST_PARENT_CARD]) );
+                gui_sketch_card_init( &((*this_).cards[GUI_SKETCH_AREA_CONST_PARENT_CARD]), &((*this_).layout_cache) );
                 gui_sketch_card_load_data( &((*this_).cards[GUI_SKETCH_AREA_CONST_PARENT_CARD]), parent_diagram_id, (*this_).db_reader );
                 (*this_).card_num = 2;
 
@@ -463,7 +581,7 @@ void gui_sketch_area_private_load_cards_data ( gui_sketch_area_t *this_ )
                         const data_id_t child = data_small_set_get_id( &children, index );
                         if ( (*this_).card_num < GUI_SKETCH_AREA_CONST_MAX_CARDS )
                         {
-                            gui_sketch_card_init( &((*this_).cards[(*this_).card_num]) );
+                            gui_sketch_card_init( &((*this_).cards[(*this_).card_num]), &((*this_).layout_cache) );
                             gui_sketch_card_load_data( &((*this_).cards[(*this_).card_num]), child, (*this_).db_reader );
                             (*this_).card_num ++;
                         }
@@ -1930,8 +2048,12 @@ void gui_sketch_area_data_changed_callback( GtkWidget *widget, data_change_messa
         gui_sketch_area_show_diagram( this_, DATA_ID_VOID );
     }
 
-    /* load/reload data to be drawn */
-    gui_sketch_area_private_refocus_and_reload_data( this_ );
+    /* load/reload data to be drawn: only affected cards if possible */
+    const bool reloaded_changed_cards = gui_sketch_area_private_reload_changed_cards( this_, msg );
+    if ( ! reloaded_changed_cards )
+    {
+        gui_sketch_area_private_refocus_and_reload_data( this_ );
+    }
 
     /* mark dirty rect */
     gtk_widget_queue_draw( (*this_).drawing_area );
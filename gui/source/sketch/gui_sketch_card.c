@@ -7,16 +7,18 @@
 #include "u8/u8_log.h"
 #include "gui_gdk.h"
 
-void gui_sketch_card_init( gui_sketch_card_t *this_ )
+void gui_sketch_card_init( gui_sketch_card_t *this_, layout_cache_t *layout_cache )
 {
     U8_TRACE_BEGIN();
 
     (*this_).visible = false;
     (*this_).dirty_elements_layout = false;
+    (*this_).dirty_card_layout = true;
     shape_int_rectangle_init( &((*this_).bounds), 0, 0, 0, 0 );
     data_visible_set_init( &((*this_).painter_input_data) );
     data_profile_part_init( &((*this_).profile) );
     pencil_diagram_maker_init( &((*this_).painter), &((*this_).painter_input_data), &((*this_).profile) );
+    pencil_diagram_maker_set_layout_cache( &((*this_).painter), layout_cache );
     gui_sketch_marker_init( &((*this_).sketch_marker), false );
     gui_sketch_style_init( &((*this_).sketch_style) );
 
@@ -37,6 +39,67 @@ void gui_sketch_card_destroy( gui_sketch_card_t *this_ )
     U8_TRACE_END();
 }
 
+bool gui_sketch_card_shows_object( const gui_sketch_card_t *this_, data_id_t obj_id )
+{
+    U8_TRACE_BEGIN();
+    bool result = false;
+
+    if ( gui_sketch_card_is_valid( this_ ) )
+    {
+        const data_visible_set_t *const visible_set = &((*this_).painter_input_data);
+        const data_row_t row = data_id_get_row( &obj_id );
+        switch ( data_id_get_table( &obj_id ) )
+        {
+            case DATA_TABLE_DIAGRAM:
+            {
+                result = ( row == data_diagram_get_row( data_visible_set_get_diagram_const( visible_set ) ) );
+            }
+            break;
+
+            case DATA_TABLE_DIAGRAMELEMENT:
+            {
+                result = ( NULL != data_visible_set_get_visible_classifier_by_id_const( visible_set, row ) );
+            }
+            break;
+
+            case DATA_TABLE_CLASSIFIER:
+            {
+                result = ( NULL != data_visible_set_get_classifier_by_id_const( visible_set, row ) );
+                /* stereotypes are not part of the visible set but are referenced from it */
+                const uint32_t stereotype_count = data_profile_part_get_stereotype_count( &((*this_).profile) );
+                for ( uint32_t index = 0; ( index < stereotype_count ) && ( ! result ); index ++ )
+                {
+                    const data_classifier_t *const stereotype
+                        = data_profile_part_get_stereotype_const( &((*this_).profile), index );
+                    result = ( row == data_classifier_get_row( stereotype ) );
+                }
+            }
+            break;
+
+            case DATA_TABLE_FEATURE:
+            {
+                result = ( NULL != data_visible_set_get_feature_by_id_const( visible_set, row ) );
+            }
+            break;
+
+            case DATA_TABLE_RELATIONSHIP:
+            {
+                result = ( NULL != data_visible_set_get_relationship_by_id_const( visible_set, row ) );
+            }
+            break;
+
+            default:
+            {
+                U8_LOG_WARNING( "gui_sketch_card_shows_object called with invalid id" );
+            }
+            break;
+        }
+    }
+
+    U8_TRACE_END();
+    return result;
+}
+
 layout_subelement_id_t gui_sketch_card_get_element_at_pos( const gui_sketch_card_t *this_,
                                                            int32_t x,
                                                            int32_t y,
@@ -134,13 +197,16 @@ layout_subelement_id_t gui_sketch_card_private_get_classifier_at_pos( const gui_
 
     if ( geometry_rectangle_contains( diagram_draw_area, (double) x, (double) y ) )
     {
-        /* iterate over all classifiers */
-        const uint32_t count
-            = layout_visible_set_get_visible_classifier_count ( layout );
+        /* iterate over all classifiers at the position */
+        const layout_spatial_index_t *const spatial_index
+            = pencil_diagram_maker_get_spatial_index_const( &((*this_).painter) );
+        layout_spatial_iter_t candidates;
+        layout_spatial_index_query_pos( spatial_index, LAYOUT_SPATIAL_INDEX_KIND_CLASSIFIER, (double) x, (double) y, 0.0, &candidates );
         double surrounding_classifier_area = geometry_rectangle_get_area( diagram_draw_area );
 
-        for ( uint32_t index = 0; index < count; index ++ )
+        while ( layout_spatial_iter_has_next( &candidates ) )
         {
+            const uint32_t index = layout_spatial_iter_next( &candidates );
             const layout_visible_classifier_t *const visible_classifier
                 = layout_visible_set_get_visible_classifier_const ( layout, index );
             const geometry_rectangle_t *const classifier_symbol_box
@@ -190,6 +256,7 @@ layout_subelement_id_t gui_sketch_card_private_get_classifier_at_pos( const gui_
                 }
             }
         }
+        layout_spatial_iter_destroy( &candidates );
     }
 
     U8_TRACE_END();
@@ -205,11 +272,14 @@ layout_subelement_id_t gui_sketch_card_private_get_feature_at_pos( const gui_ske
     layout_subelement_id_t result;
     layout_subelement_id_init_void( &result );
 
-    /* check all contained features */
+    /* check all contained features at the position */
     const layout_visible_set_t *const layout = pencil_diagram_maker_get_layout_data_const( &((*this_).painter) );
-    const uint32_t f_count = layout_visible_set_get_feature_count( layout );
-    for ( uint32_t f_idx = 0; f_idx < f_count; f_idx ++ )
+    const layout_spatial_index_t *const spatial_index = pencil_diagram_maker_get_spatial_index_const( &((*this_).painter) );
+    layout_spatial_iter_t candidates;
+    layout_spatial_index_query_pos( spatial_index, LAYOUT_SPATIAL_INDEX_KIND_FEATURE, (double) x, (double) y, 0.0, &candidates );
+    while ( layout_spatial_iter_has_next( &candidates ) )
     {
+        const uint32_t f_idx = layout_spatial_iter_next( &candidates );
         const layout_feature_t *const the_feature
             = layout_visible_set_get_feature_const ( layout, f_idx );
         const geometry_rectangle_t *const feature_symbol_box
@@ -254,6 +324,7 @@ layout_subelement_id_t gui_sketch_card_private_get_feature_at_pos( const gui_ske
             layout_subelement_id_reinit( &result, kind, &found_id );
         }
     }
+    layout_spatial_iter_destroy( &candidates );
 
     U8_TRACE_END();
     return result;
@@ -269,11 +340,19 @@ layout_subelement_id_t gui_sketch_card_private_get_relationship_at_pos( const gu
     const int32_t snap_distance = gui_sketch_style_get_snap_to_relationship( &((*this_).sketch_style) );
 
     const layout_visible_set_t *const layout = pencil_diagram_maker_get_layout_data_const( &((*this_).painter) );
-    const uint32_t count_relations
-        = layout_visible_set_get_relationship_count ( layout );
+    const layout_spatial_index_t *const spatial_index = pencil_diagram_maker_get_spatial_index_const( &((*this_).painter) );
+    layout_spatial_iter_t candidates;
+    layout_spatial_index_query_pos( spatial_index,
+                                    LAYOUT_SPATIAL_INDEX_KIND_RELATIONSHIP,
+                                    (double) x,
+                                    (double) y,
+                                    0.000001 + (double) snap_distance,
+                                    &candidates
+                                  );
     uint32_t matching_relations_found = 0;
-    for ( uint32_t rel_index = 0; rel_index < count_relations; rel_index ++ )
+    while ( layout_spatial_iter_has_next( &candidates ) )
     {
+        const uint32_t rel_index = layout_spatial_iter_next( &candidates );
         const layout_relationship_t *const the_relationship
             = layout_visible_set_get_relationship_const( layout, rel_index );
         const geometry_connector_t *const relationship_shape
@@ -300,6 +379,7 @@ layout_subelement_id_t gui_sketch_card_private_get_relationship_at_pos( const gu
             matching_relations_found ++;
         }
     }
+    layout_spatial_iter_destroy( &candidates );
 
     U8_TRACE_END();
     return result;
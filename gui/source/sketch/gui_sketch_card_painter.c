@@ -508,6 +508,7 @@ void gui_sketch_card_painter_private_visualize_order( gui_sketch_card_painter_t
             }
         }
         universal_array_index_iterator_destroy( &sorted_index_iter );
+        universal_array_index_sorter_destroy( &sorted );
 
         /* draw end of last pass-by (if any) */
         if ( (( planned_pos_x < ( x - 0.001 ) )||( planned_pos_x > ( x + 0.001 ) ))
@@ -656,6 +657,7 @@ void gui_sketch_card_painter_private_visualize_order( gui_sketch_card_painter_t
             }
         }
         universal_array_index_iterator_destroy( &sorted_index_iter );
+        universal_array_index_sorter_destroy( &sorted );
 
         /* draw end of last pass-by (if any) */
         if ( (( planned_pos_y < ( y - 0.001 ) )||( planned_pos_y > ( y + 0.001 ) ))
@@ -11,6 +11,7 @@
 
 #include "io_file_format.h"
 #include "pencil_diagram_maker.h"
+#include "layout/layout_cache.h"
 #include "set/data_visible_set.h"
 #include "set/data_profile_part.h"
 #include "set/data_stat.h"
@@ -38,11 +39,13 @@ typedef struct image_format_writer_struct image_format_writer_t;
  *  \param db_reader pointer to a database reader object
  *  \param input_data pointer to an external buffer for private use as data cache
  *  \param profile the stereotypes referenced from the current diagram
+ *  \param layout_cache pointer to an external cache of layout results, NULL if layouts shall not be cached
  */
 void image_format_writer_init( image_format_writer_t *this_,
                                data_database_reader_t *db_reader,
                                data_visible_set_t *input_data,
-                               data_profile_part_t *profile
+                               data_profile_part_t *profile,
+                               layout_cache_t *layout_cache
                              );
 
 /*!
@@ -10,7 +10,10 @@
  */
 
 #include "ctrl_controller.h"
+#include "io_exporter.h"
+#include "io_export_span_list.h"
 #include "storage/data_database.h"
+#include "storage/data_database_reader.h"
 #include "storage/data_revision.h"
 #include "set/data_stat.h"
 #include "utf8stringbuf/utf8stringbuf.h"
@@ -39,6 +42,7 @@ struct io_data_file_struct {
     bool delete_db_when_finished;  /*!< true if the current database (db_file_name) shall automatically */
                                    /*!< be deleted when closing. */
     data_revision_t sync_revision;  /*!< the revision id of the database that is synchronized to disk */
+    io_export_span_list_t json_spans;  /*!< positions of the top-level objects in the json file as written at sync_revision */
 };
 
 typedef struct io_data_file_struct io_data_file_t;
@@ -200,7 +204,7 @@ static inline bool io_data_file_is_in_sync ( io_data_file_t *this_ );
 bool io_data_file_is_externally_modified ( io_data_file_t *this_ );
 
 /*!
- *  \brief prints statistics of the current data file to the trace output
+ *  \brief prints statistics of the current data file and the storage settings of its database to the trace output
  *
  *  \param this_ pointer to own object attributes
  *  \return U8_ERROR_NONE in case of success
@@ -294,6 +298,25 @@ u8_error_t io_data_file_private_import ( io_data_file_t *this_,
  */
 u8_error_t io_data_file_private_export ( io_data_file_t *this_, const char *dst_file );
 
+/*!
+ *  \brief exports only the objects that changed since sync_revision, copies all others from the previous dst_file.
+ *
+ *  The delta is written to a temporary file which then replaces dst_file.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param dst_file filename of the destination json file that was written at sync_revision, must not be NULL
+ *  \param db_reader database reader to use
+ *  \param exporter exporter to use
+ *  \param io_export_stat statistics on re-written objects; statistics are only added, *io_export_stat shall be initialized by caller
+ *  \return U8_ERROR_NONE in case of success; other values if the complete file needs to be exported
+ */
+u8_error_t io_data_file_private_export_delta ( io_data_file_t *this_,
+                                               const char *dst_file,
+                                               data_database_reader_t *db_reader,
+                                               io_exporter_t *exporter,
+                                               data_stat_t *io_export_stat
+                                             );
+
 #include "io_data_file.inl"
 
 #endif  /* IO_DATA_FILE_H */
@@ -0,0 +1,153 @@
+/* File: io_export_dirty_set.h; Copyright and License: see below */
+
+#ifndef IO_EXPORT_DIRTY_SET_H
+#define IO_EXPORT_DIRTY_SET_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Determines which top-level objects of an exported json file are outdated after a set of changes.
+ *
+ *  The json file consists of diagrams (pass views), classifiers with their features (pass nodes)
+ *  and the outgoing relationships of each classifier (pass edges).
+ *  Objects also contain names and uuids of other objects they reference,
+ *  e.g. a relationship contains the names of its source and destination classifiers.
+ *  This set lists all objects that need to be written again.
+ *
+ *  If a change alters the sequence of top-level objects in the file
+ *  (creating or deleting a diagram or classifier, moving a diagram),
+ *  a delta is not possible and the complete file needs to be written.
+ */
+
+#include "ctrl_undo_redo_iterator.h"
+#include "json/json_writer_pass.h"
+#include "storage/data_database_reader.h"
+#include "set/data_small_set.h"
+#include "entity/data_diagram.h"
+#include "entity/data_diagramelement.h"
+#include "entity/data_relationship.h"
+#include "entity/data_row.h"
+#include "u8/u8_error.h"
+#include <stdbool.h>
+
+/*!
+ *  \brief attributes of a io_export_dirty_set_t
+ */
+struct io_export_dirty_set_struct {
+    data_small_set_t views;  /*!< diagrams that need to be written again */
+    data_small_set_t nodes;  /*!< classifiers that need to be written again including their features */
+    data_small_set_t edges;  /*!< classifiers whose outgoing relationships need to be written again */
+
+    /* temporary member attributes, only valid during add_changes */
+    data_small_set_t temp_children;  /*!< buffer for the child diagrams of a changed diagram */
+    data_diagramelement_t temp_diagramelement;  /*!< buffer for a diagramelement that references a changed classifier */
+    data_relationship_t temp_relationship;  /*!< buffer for a relationship that references a changed classifier */
+};
+
+typedef struct io_export_dirty_set_struct io_export_dirty_set_t;
+
+/*!
+ *  \brief initializes the io_export_dirty_set_t struct to an empty set
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void io_export_dirty_set_init ( io_export_dirty_set_t *this_ );
+
+/*!
+ *  \brief destroys the io_export_dirty_set_t struct
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void io_export_dirty_set_destroy ( io_export_dirty_set_t *this_ );
+
+/*!
+ *  \brief adds the objects that are affected by the changes
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param changes iterator over undo redo entries, see ctrl_controller_get_changes_since()
+ *  \param db_reader database reader to determine objects that reference changed objects
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_INVALID_REQUEST if the changes alter the sequence of top-level objects in the file,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if too many objects are affected,
+ *          an other error code if the database could not be read.
+ *          In all error cases, the complete file needs to be written.
+ */
+u8_error_t io_export_dirty_set_add_changes ( io_export_dirty_set_t *this_,
+                                             ctrl_undo_redo_iterator_t *changes,
+                                             data_database_reader_t *db_reader
+                                           );
+
+/*!
+ *  \brief checks if an object needs to be written again
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param pass the export pass in which the object is written
+ *  \param row the diagram row in pass views, the classifier row otherwise
+ *  \return true if the object needs to be written again, false if it can be copied from the previous file
+ */
+bool io_export_dirty_set_contains ( const io_export_dirty_set_t *this_, json_writer_pass_t pass, data_row_t row );
+
+/*!
+ *  \brief marks a classifier as changed: its node, its outgoing relationships,
+ *         the diagrams showing it and the relationships referencing it
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param classifier_row row of the changed classifier
+ *  \param db_reader database reader to determine objects that reference the classifier
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED or an other error code otherwise
+ */
+u8_error_t io_export_dirty_set_private_add_classifier ( io_export_dirty_set_t *this_,
+                                                        data_row_t classifier_row,
+                                                        data_database_reader_t *db_reader
+                                                      );
+
+/*!
+ *  \brief marks a diagram as changed, and in case its name or uuid changed, also its child diagrams
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param before_action the diagram before the change
+ *  \param after_action the diagram after the change
+ *  \param db_reader database reader to determine the child diagrams
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_INVALID_REQUEST if the diagram was moved,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED or an other error code otherwise
+ */
+u8_error_t io_export_dirty_set_private_add_diagram ( io_export_dirty_set_t *this_,
+                                                     const data_diagram_t *before_action,
+                                                     const data_diagram_t *after_action,
+                                                     data_database_reader_t *db_reader
+                                                   );
+
+/*!
+ *  \brief adds a row to one of the sets, ignoring rows that are already contained
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param the_set the set to extend
+ *  \param table the table of the row
+ *  \param row the row to add
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if the set is full
+ */
+u8_error_t io_export_dirty_set_private_add_row ( io_export_dirty_set_t *this_,
+                                                 data_small_set_t *the_set,
+                                                 data_table_t table,
+                                                 data_row_t row
+                                               );
+
+#endif  /* IO_EXPORT_DIRTY_SET_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -16,6 +16,7 @@
 
 #include "io_export_interaction_traversal.h"
 #include "io_element_writer.h"
+#include "io_progress.h"
 #include "set/data_stat.h"
 #include "storage/data_database_reader.h"
 #include "storage/data_feature_iterator.h"
@@ -36,6 +37,7 @@ struct io_export_flat_traversal_struct {
     data_database_reader_t *db_reader;  /* !< pointer to external database reader */
     data_stat_t *export_stat;  /*!< pointer to external statistics object where export statistics are collected */
     io_element_writer_t *element_writer;  /*!< pointer to external io_element_writer_t which is the output sink */
+    io_progress_t *progress;  /*!< NULL or pointer to external progress, ticked after each classifier */
 
     data_classifier_t temp_classifier;  /*!< own buffer for private use as data cache */
     data_relationship_t temp_relationship;  /*!< own buffer for private use as data cache */
@@ -56,11 +58,13 @@ typedef struct io_export_flat_traversal_struct io_export_flat_traversal_t;
  *                        Errors and warnings during traversal are counted. Success shall be counted by io_element_writer_t.
  *                        Statistics are only added, *io_stat shall be initialized by caller.
  *  \param out_element_writer pointer to an external io_element_writer_t which is the output sink
+ *  \param progress NULL or pointer to an external progress which is ticked after each classifier of iterate_classifiers
  */
 void io_export_flat_traversal_init ( io_export_flat_traversal_t *this_,
                                      data_database_reader_t *db_reader,
                                      data_stat_t *io_export_stat,
-                                     io_element_writer_t *out_element_writer
+                                     io_element_writer_t *out_element_writer,
+                                     io_progress_t *progress
                                    );
 
 /*!
@@ -75,20 +79,22 @@ void io_export_flat_traversal_destroy( io_export_flat_traversal_t *this_ );
  *
  *  \param this_ pointer to own object attributes
  *  \param hierarchical true if the iterator shall start with classifiers without parent
- *  \return U8_ERROR_NONE in case of success
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_CANCELLED if the progress was cancelled
  */
 u8_error_t io_export_flat_traversal_iterate_classifiers ( io_export_flat_traversal_t *this_, bool hierarchical );
 
 /*!
  *  \brief writes the classifier and feature and writes its outgoing relationships
  *
+ *  This allows the caller to iterate over the classifiers itself and to skip some.
+ *
  *  \param this_ pointer to own object attributes
- *  \param classifier pointer to the classifier to process, most likely this is &((*this_).temp_classifier)
+ *  \param classifier pointer to the classifier to process, e.g. &((*this_).temp_classifier) when called from iterate_classifiers
  *  \return U8_ERROR_NONE in case of success
  */
-u8_error_t io_export_flat_traversal_private_traverse_classifier ( io_export_flat_traversal_t *this_,
-                                                                  const data_classifier_t *classifier
-                                                                );
+u8_error_t io_export_flat_traversal_traverse_classifier ( io_export_flat_traversal_t *this_,
+                                                          const data_classifier_t *classifier
+                                                        );
 
 /*!
  *  \brief iterates over features of a classifier.
@@ -0,0 +1,214 @@
+/* File: io_export_image_pool.h; Copyright and License: see below */
+
+#ifndef IO_EXPORT_IMAGE_POOL_H
+#define IO_EXPORT_IMAGE_POOL_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Renders a list of diagrams to image files on several worker threads.
+ *
+ *  Each worker has an own snapshot (a read-only connection to the database file),
+ *  an own data cache and an own pencil_diagram_maker_t (within image_format_writer_t).
+ *  The workers fetch the next diagram from a shared job list
+ *  and render it to all requested image formats.
+ *
+ *  Connections are opened, pinned and closed by the calling thread,
+ *  the worker threads only read and render.
+ *  If the database file uses the write-ahead log, all workers see the state of the database
+ *  at the start of the run, even if it is modified while the pool is running.
+ */
+
+#include "io_file_format.h"
+#include "image/image_format_writer.h"
+#include "layout/layout_cache.h"
+#include "storage/data_database_snapshot.h"
+#include "storage/data_database_reader.h"
+#include "set/data_visible_set.h"
+#include "set/data_profile_part.h"
+#include "set/data_stat.h"
+#include "entity/data_id.h"
+#include "utf8stringbuf/utf8stringbuf.h"
+#include "u8/u8_error.h"
+#include <glib.h>
+#include <stdint.h>
+
+/*!
+ *  \brief constants of io_export_image_pool_t
+ */
+enum io_export_image_pool_max_enum {
+    IO_EXPORT_IMAGE_POOL_MAX_WORKERS = 16,  /*!< maximum number of worker threads */
+    IO_EXPORT_IMAGE_POOL_MAX_JOBS = 4096,  /*!< maximum number of diagrams in the job list */
+    IO_EXPORT_IMAGE_POOL_MAX_BASENAME = 96,  /*!< maximum size of a base filename, see io_exporter_private_get_filename_for_diagram */
+    IO_EXPORT_IMAGE_POOL_MAX_PATH = 512,  /*!< maximum size of a target folder plus filename */
+};
+
+/*!
+ *  \brief one diagram to be rendered
+ */
+struct io_export_image_job_struct {
+    data_id_t diagram_id;  /*!< the diagram to render */
+    char basename[IO_EXPORT_IMAGE_POOL_MAX_BASENAME];  /*!< filename without folder and without extension */
+};
+
+typedef struct io_export_image_job_struct io_export_image_job_t;
+
+struct io_export_image_pool_struct;
+
+/*!
+ *  \brief attributes of one worker thread
+ */
+struct io_export_image_worker_struct {
+    struct io_export_image_pool_struct *pool;  /*!< the pool that provides the jobs */
+    GThread *thread;  /*!< the running thread, NULL if not started */
+
+    data_database_snapshot_t snapshot;  /*!< own read-only connection to the database file and a reader on it */
+    data_visible_set_t input_data;  /*!< own buffer to cache the diagram data */
+    data_profile_part_t profile;  /*!< own cache of the stereotypes referenced from the current diagram */
+    image_format_writer_t image_writer;  /*!< own image writer including a pencil_diagram_maker_t */
+    layout_cache_t layout_cache;  /*!< own cache of layout results, the image formats of one diagram share one layout */
+
+    char filename_buf[IO_EXPORT_IMAGE_POOL_MAX_PATH];  /*!< buffer space for filename construction */
+    utf8stringbuf_t filename;  /*!< buffer space for filename construction */
+    data_stat_t stat;  /*!< statistics of this worker, added to the result when the pool finishes */
+    u8_error_t result;  /*!< error code of this worker */
+};
+
+typedef struct io_export_image_worker_struct io_export_image_worker_t;
+
+/*!
+ *  \brief attributes of the pool of image export workers
+ *
+ *  Lifecycle: A pool may perform multiple export operations.
+ *  It may be initialized at program start and live till program exit.
+ *  Because of its size, it should be allocated statically.
+ */
+struct io_export_image_pool_struct {
+    io_export_image_worker_t worker[IO_EXPORT_IMAGE_POOL_MAX_WORKERS];  /*!< the workers */
+    uint32_t worker_count;  /*!< number of workers to be used */
+
+    io_export_image_job_t job[IO_EXPORT_IMAGE_POOL_MAX_JOBS];  /*!< list of diagrams to render */
+    uint32_t job_count;  /*!< number of jobs in the list */
+
+    /* attributes shared between threads while running */
+    GMutex lock;  /*!< lock to protect next_job */
+    uint32_t next_job;  /*!< index of the next job to be fetched by a worker */
+    io_file_format_t image_formats;  /*!< bitset of image formats to render each diagram to */
+    const char *target_folder;  /*!< folder where to store the images */
+};
+
+typedef struct io_export_image_pool_struct io_export_image_pool_t;
+
+/*!
+ *  \brief initializes the pool with an empty job list
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param worker_count number of worker threads to use, 0 selects the number of processors.
+ *                      The value is limited to IO_EXPORT_IMAGE_POOL_MAX_WORKERS.
+ */
+void io_export_image_pool_init ( io_export_image_pool_t *this_, uint32_t worker_count );
+
+/*!
+ *  \brief destroys the pool
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void io_export_image_pool_destroy ( io_export_image_pool_t *this_ );
+
+/*!
+ *  \brief removes all jobs from the job list
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void io_export_image_pool_clear_jobs ( io_export_image_pool_t *this_ );
+
+/*!
+ *  \brief appends a diagram to the job list
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param diagram_id the diagram to render
+ *  \param basename filename without folder and without extension
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if the job list is full,
+ *          U8_ERROR_STRING_BUFFER_EXCEEDED if the basename is too long
+ */
+static inline u8_error_t io_export_image_pool_add_job ( io_export_image_pool_t *this_,
+                                                        data_id_t diagram_id,
+                                                        const char *basename
+                                                      );
+
+/*!
+ *  \brief gets the number of jobs in the job list
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of jobs
+ */
+static inline uint32_t io_export_image_pool_get_job_count ( const io_export_image_pool_t *this_ );
+
+/*!
+ *  \brief renders all diagrams of the job list and waits till all are finished
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param db_file_path path to the sqlite database file, opened read-only by each worker
+ *  \param image_formats bitset of IO_FILE_FORMAT_SVG, IO_FILE_FORMAT_PDF, IO_FILE_FORMAT_PS and IO_FILE_FORMAT_PNG
+ *  \param target_folder path name to a folder where to store the images
+ *  \param io_export_stat pointer to statistics object where export statistics are collected
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_NO_DB if no worker could open the database; in this case, no job was processed.
+ */
+u8_error_t io_export_image_pool_run ( io_export_image_pool_t *this_,
+                                      const char *db_file_path,
+                                      io_file_format_t image_formats,
+                                      const char *target_folder,
+                                      data_stat_t *io_export_stat
+                                    );
+
+/*!
+ *  \brief main function of a worker thread: renders jobs till the job list is empty
+ *
+ *  \param data pointer to the io_export_image_worker_t
+ *  \return NULL
+ */
+gpointer io_export_image_pool_private_work ( gpointer data );
+
+/*!
+ *  \brief fetches the next job from the job list
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return pointer to the next job, NULL if no jobs are left
+ */
+const io_export_image_job_t *io_export_image_pool_private_fetch_job ( io_export_image_pool_t *this_ );
+
+/*!
+ *  \brief renders one diagram to one image format
+ *
+ *  \param this_ pointer to the worker
+ *  \param job the diagram to render
+ *  \param image_format one of IO_FILE_FORMAT_SVG, IO_FILE_FORMAT_PDF, IO_FILE_FORMAT_PS or IO_FILE_FORMAT_PNG
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t io_export_image_pool_private_render ( io_export_image_worker_t *this_,
+                                                 const io_export_image_job_t *job,
+                                                 io_file_format_t image_format
+                                               );
+
+#include "io_export_image_pool.inl"
+
+#endif  /* IO_EXPORT_IMAGE_POOL_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,60 @@
+/* File: io_export_image_pool.inl; Copyright and License: see below */
+
+#include <string.h>
+#include <assert.h>
+
+static inline void io_export_image_pool_clear_jobs ( io_export_image_pool_t *this_ )
+{
+    (*this_).job_count = 0;
+    (*this_).next_job = 0;
+}
+
+static inline u8_error_t io_export_image_pool_add_job ( io_export_image_pool_t *this_,
+                                                        data_id_t diagram_id,
+                                                        const char *basename )
+{
+    assert( (*this_).job_count <= IO_EXPORT_IMAGE_POOL_MAX_JOBS );
+    assert( NULL != basename );
+    u8_error_t result = U8_ERROR_NONE;
+
+    const size_t basename_len = strlen( basename );
+    if ( (*this_).job_count >= IO_EXPORT_IMAGE_POOL_MAX_JOBS )
+    {
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+    else if ( basename_len >= IO_EXPORT_IMAGE_POOL_MAX_BASENAME )
+    {
+        result = U8_ERROR_STRING_BUFFER_EXCEEDED;
+    }
+    else
+    {
+        io_export_image_job_t *const new_job = &((*this_).job[(*this_).job_count]);
+        (*new_job).diagram_id = diagram_id;
+        memcpy( &((*new_job).basename), basename, basename_len + 1 );
+        (*this_).job_count ++;
+    }
+
+    return result;
+}
+
+static inline uint32_t io_export_image_pool_get_job_count ( const io_export_image_pool_t *this_ )
+{
+    return (*this_).job_count;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -15,6 +15,7 @@
 
 #include "io_export_interaction_traversal.h"
 #include "io_element_writer.h"
+#include "io_progress.h"
 #include "set/data_stat.h"
 #include "storage/data_database_reader.h"
 #include "storage/data_feature_iterator.h"
@@ -42,6 +43,7 @@ struct io_export_model_traversal_struct {
     data_database_reader_t *db_reader;  /* !< pointer to external database reader */
     data_stat_t *export_stat;  /*!< pointer to external statistics object where export statistics are collected */
     io_element_writer_t *element_writer;  /*!< pointer to external io_element_writer_t which is the output sink */
+    io_progress_t *progress;  /*!< NULL or pointer to external progress, ticked after each top-level classifier */
 
     io_export_interaction_traversal_t interaction_helper;  /* !< instance of own io_export_interaction_traversal to help with interaction exports */
 
@@ -69,12 +71,14 @@ typedef struct io_export_model_traversal_struct io_export_model_traversal_t;
  *                        Errors and warnings during traversal are counted. Success shall be counted by io_element_writer_t.
  *                        Statistics are only added, *io_stat shall be initialized by caller.
  *  \param out_element_writer pointer to an external io_element_writer_t which is the output sink
+ *  \param progress NULL or pointer to an external progress which is ticked after each top-level classifier of walk_model_nodes
  */
 void io_export_model_traversal_init( io_export_model_traversal_t *this_,
                                      data_database_reader_t *db_reader,
                                      data_visible_set_t *input_data,
                                      data_stat_t *io_export_stat,
-                                     io_element_writer_t *out_element_writer
+                                     io_element_writer_t *out_element_writer,
+                                     io_progress_t *progress
                                    );
 
 /*!
@@ -88,7 +92,7 @@ void io_export_model_traversal_destroy( io_export_model_traversal_t *this_ );
  *  \brief prints all classifiers to the output stream
  *
  *  \param this_ pointer to own object attributes
- *  \return U8_ERROR_NONE in case of success
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_CANCELLED if the progress was cancelled
  */
 u8_error_t io_export_model_traversal_walk_model_nodes ( io_export_model_traversal_t *this_ );
 
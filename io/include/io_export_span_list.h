@@ -0,0 +1,178 @@
+/* File: io_export_span_list.h; Copyright and License: see below */
+
+#ifndef IO_EXPORT_SPAN_LIST_H
+#define IO_EXPORT_SPAN_LIST_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Remembers the byte ranges of the top-level objects in an exported json file.
+ *
+ *  A span is the range of bytes that one top-level object occupies in the exported file:
+ *  a diagram with its diagramelements (pass views), a classifier with its features (pass nodes)
+ *  or all outgoing relationships of a classifier (pass edges).
+ *  The spans are stored in the order in which they appear in the file.
+ *
+ *  When the file is written again, the spans of unchanged objects can be copied from the previous file
+ *  instead of being read from the database and serialized again.
+ */
+
+#include "json/json_writer_pass.h"
+#include "entity/data_row.h"
+#include "u8/u8_error.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+/*!
+ *  \brief constants for the list size
+ */
+enum io_export_span_list_max_enum {
+    IO_EXPORT_SPAN_LIST_MAX_SPANS = 32768,  /*!< maximum number of spans, one per diagram and two per classifier */
+};
+
+/*!
+ *  \brief attributes of a io_export_span_list_t
+ */
+struct io_export_span_list_struct {
+    uint32_t count;  /*!< number of valid spans */
+    bool complete;  /*!< false if the file contains more objects than could be stored in this list */
+    json_writer_pass_t pass[IO_EXPORT_SPAN_LIST_MAX_SPANS];  /*!< the export pass of each span */
+    data_row_t row[IO_EXPORT_SPAN_LIST_MAX_SPANS];  /*!< the diagram row in pass views, the classifier row otherwise */
+    size_t start[IO_EXPORT_SPAN_LIST_MAX_SPANS];  /*!< the position of the first byte of each span */
+    size_t end[IO_EXPORT_SPAN_LIST_MAX_SPANS];  /*!< the position after the last byte of each span */
+};
+
+typedef struct io_export_span_list_struct io_export_span_list_t;
+
+/*!
+ *  \brief initializes the io_export_span_list_t struct to an empty, incomplete list
+ *
+ *  An empty list is marked incomplete because it does not describe any exported file yet.
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void io_export_span_list_init ( io_export_span_list_t *this_ );
+
+/*!
+ *  \brief destroys the io_export_span_list_t struct
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void io_export_span_list_destroy ( io_export_span_list_t *this_ );
+
+/*!
+ *  \brief removes all spans and marks the list complete, ready to record a new export
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void io_export_span_list_clear ( io_export_span_list_t *this_ );
+
+/*!
+ *  \brief marks the list as incomplete, e.g. because the described file was not written successfully
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void io_export_span_list_invalidate ( io_export_span_list_t *this_ );
+
+/*!
+ *  \brief checks if the list describes all top-level objects of an exported file
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if complete
+ */
+static inline bool io_export_span_list_is_complete ( const io_export_span_list_t *this_ );
+
+/*!
+ *  \brief appends a span to the list
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param pass the export pass in which the object was written
+ *  \param row the diagram row in pass views, the classifier row otherwise
+ *  \param start the position of the first byte of the span
+ *  \param end the position after the last byte of the span
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if the list is full; the list is then marked incomplete
+ */
+static inline u8_error_t io_export_span_list_add ( io_export_span_list_t *this_,
+                                                   json_writer_pass_t pass,
+                                                   data_row_t row,
+                                                   size_t start,
+                                                   size_t end
+                                                 );
+
+/*!
+ *  \brief updates the byte range of an existing span
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index index of the span, 0 &lt;= index &lt; count
+ *  \param start the position of the first byte of the span
+ *  \param end the position after the last byte of the span
+ */
+static inline void io_export_span_list_set_range ( io_export_span_list_t *this_, uint32_t index, size_t start, size_t end );
+
+/*!
+ *  \brief gets the number of spans
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of spans
+ */
+static inline uint32_t io_export_span_list_get_count ( const io_export_span_list_t *this_ );
+
+/*!
+ *  \brief gets the export pass of a span
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index index of the span, 0 &lt;= index &lt; count
+ *  \return the export pass
+ */
+static inline json_writer_pass_t io_export_span_list_get_pass ( const io_export_span_list_t *this_, uint32_t index );
+
+/*!
+ *  \brief gets the row of the object of a span
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index index of the span, 0 &lt;= index &lt; count
+ *  \return the diagram row in pass views, the classifier row otherwise
+ */
+static inline data_row_t io_export_span_list_get_row ( const io_export_span_list_t *this_, uint32_t index );
+
+/*!
+ *  \brief gets the position of the first byte of a span
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index index of the span, 0 &lt;= index &lt; count
+ *  \return the start position
+ */
+static inline size_t io_export_span_list_get_start ( const io_export_span_list_t *this_, uint32_t index );
+
+/*!
+ *  \brief gets the position after the last byte of a span
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index index of the span, 0 &lt;= index &lt; count
+ *  \return the end position
+ */
+static inline size_t io_export_span_list_get_end ( const io_export_span_list_t *this_, uint32_t index );
+
+#include "io_export_span_list.inl"
+
+#endif  /* IO_EXPORT_SPAN_LIST_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
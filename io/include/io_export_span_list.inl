@@ -0,0 +1,111 @@
+/* File: io_export_span_list.inl; Copyright and License: see below */
+
+static inline void io_export_span_list_init ( io_export_span_list_t *this_ )
+{
+    (*this_).count = 0;
+    (*this_).complete = false;
+}
+
+static inline void io_export_span_list_destroy ( io_export_span_list_t *this_ )
+{
+    (*this_).count = 0;
+    (*this_).complete = false;
+}
+
+static inline void io_export_span_list_clear ( io_export_span_list_t *this_ )
+{
+    (*this_).count = 0;
+    (*this_).complete = true;
+}
+
+static inline void io_export_span_list_invalidate ( io_export_span_list_t *this_ )
+{
+    (*this_).complete = false;
+}
+
+static inline bool io_export_span_list_is_complete ( const io_export_span_list_t *this_ )
+{
+    return (*this_).complete;
+}
+
+static inline u8_error_t io_export_span_list_add ( io_export_span_list_t *this_,
+                                                   json_writer_pass_t pass,
+                                                   data_row_t row,
+                                                   size_t start,
+                                                   size_t end )
+{
+    assert( (*this_).count <= IO_EXPORT_SPAN_LIST_MAX_SPANS );
+    assert( start <= end );
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).count < IO_EXPORT_SPAN_LIST_MAX_SPANS )
+    {
+        const uint32_t index = (*this_).count;
+        (*this_).pass[index] = pass;
+        (*this_).row[index] = row;
+        (*this_).start[index] = start;
+        (*this_).end[index] = end;
+        (*this_).count ++;
+    }
+    else
+    {
+        (*this_).complete = false;
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+
+    return result;
+}
+
+static inline void io_export_span_list_set_range ( io_export_span_list_t *this_, uint32_t index, size_t start, size_t end )
+{
+    assert( index < (*this_).count );
+    assert( start <= end );
+    (*this_).start[index] = start;
+    (*this_).end[index] = end;
+}
+
+static inline uint32_t io_export_span_list_get_count ( const io_export_span_list_t *this_ )
+{
+    return (*this_).count;
+}
+
+static inline json_writer_pass_t io_export_span_list_get_pass ( const io_export_span_list_t *this_, uint32_t index )
+{
+    assert( index < (*this_).count );
+    return (*this_).pass[index];
+}
+
+static inline data_row_t io_export_span_list_get_row ( const io_export_span_list_t *this_, uint32_t index )
+{
+    assert( index < (*this_).count );
+    return (*this_).row[index];
+}
+
+static inline size_t io_export_span_list_get_start ( const io_export_span_list_t *this_, uint32_t index )
+{
+    assert( index < (*this_).count );
+    return (*this_).start[index];
+}
+
+static inline size_t io_export_span_list_get_end ( const io_export_span_list_t *this_, uint32_t index )
+{
+    assert( index < (*this_).count );
+    return (*this_).end[index];
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -17,16 +17,30 @@
 #include "document/document_element_writer.h"
 #include "xmi/xmi_element_writer.h"
 #include "json/json_element_writer.h"
+#include "io_export_span_list.h"
+#include "io_export_dirty_set.h"
+#include "io_export_image_pool.h"
+#include "io_progress.h"
 #include "storage/data_database.h"
 #include "pencil_diagram_maker.h"
 #include "set/data_visible_set.h"
 #include "set/data_profile_part.h"
 #include "set/data_stat.h"
 #include "geometry/geometry_rectangle.h"
+#include "u8stream/universal_file_input_stream.h"
+#include "u8stream/universal_file_output_stream.h"
+#include "u8stream/universal_buffer_output_stream.h"
 #include "utf8stringbuf/utf8stringbuf.h"
 #include "u8/u8_error.h"
 #include "io_gtk.h"
 
+/*!
+ *  \brief constants of io_exporter_t
+ */
+enum io_exporter_buffer_enum {
+    IO_EXPORTER_OUTPUT_BUFFER_SIZE = 65536,  /*!< size of the buffer that collects small writes to the exported files */
+};
+
 /*!
  *  \brief attributes of the file exporter
  *
@@ -35,6 +49,8 @@
  */
 struct io_exporter_struct {
     data_database_reader_t *db_reader;  /*!< pointer to external database reader */
+    io_export_image_pool_t *image_pool;  /*!< NULL or pointer to external worker pool that renders the diagram images */
+    io_progress_t *progress;  /*!< NULL or pointer to external progress of io_exporter_export_files */
 
     /* temporary member attributes, only valid during exporting */
     data_visible_set_t temp_input_data;  /*!< buffer to cache the diagram data */
@@ -48,9 +64,23 @@ struct io_exporter_struct {
     xmi_element_writer_t temp_xmi_writer;  /*!< memory for a temporary xmi writer */
     json_element_writer_t temp_json_writer;  /*!< memory for a temporary json writer */
 
+    universal_buffer_output_stream_t temp_buffered_output;  /*!< collects small writes before these are written to the file */
+    char temp_output_buf[IO_EXPORTER_OUTPUT_BUFFER_SIZE];  /*!< buffer space of temp_buffered_output */
+
     char temp_filename_buf[512];  /*!< buffer space for temporary filename construction */
     utf8stringbuf_t temp_filename;  /*!< buffer space for temporary filename construction */
     data_diagram_t temp_diagram;  /*!< buffer space for temporary diagram data */
+    data_classifier_t temp_classifier;  /*!< buffer space for temporary classifier data */
+
+    /* temporary member attributes, only valid during exporting a json file that records spans */
+    io_export_span_list_t *temp_spans;  /*!< NULL or the spans of the previous export, replaced by the spans of the current one */
+    const io_export_dirty_set_t *temp_dirty;  /*!< NULL if all objects are written, otherwise the changed objects */
+    universal_file_output_stream_t *temp_json_file;  /*!< the file to which the json export is written */
+    universal_file_input_stream_t temp_previous_file;  /*!< the file of the previous export, source of unchanged spans */
+    size_t temp_previous_pos;  /*!< the read position in temp_previous_file */
+    uint32_t temp_span_index;  /*!< index of the current span in temp_spans */
+    size_t temp_span_start;  /*!< start position of the current span in the json file */
+    char temp_copy_buf[8192];  /*!< buffer for copying unchanged spans from the previous file */
 };
 
 typedef struct io_exporter_struct io_exporter_t;
@@ -72,6 +102,28 @@ void io_exporter_init( io_exporter_t *this_,
  */
 void io_exporter_destroy( io_exporter_t *this_ );
 
+/*!
+ *  \brief sets a pool of worker threads to render the diagram images in parallel
+ *
+ *  The pool is only used if the database is a file, see data_database_is_file().
+ *  Otherwise or if the pool cannot open the database, the diagrams are rendered one after the other.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param image_pool pointer to an initialized worker pool, NULL to render all images in the calling thread
+ */
+void io_exporter_set_image_pool( io_exporter_t *this_, io_export_image_pool_t *image_pool );
+
+/*!
+ *  \brief sets an object that reports the progress of io_exporter_export_files and allows to cancel it
+ *
+ *  Each file format is a phase of the progress; each diagram, each file and each top-level classifier is a tick.
+ *  The bytes of the written document files are counted, the bytes of image files are not.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param progress pointer to an initialized progress, NULL to export without progress reports
+ */
+void io_exporter_set_progress( io_exporter_t *this_, io_progress_t *progress );
+
 /*!
  *  \brief renders diagrams and exports these to picture (or text) files
  *  \param this_ pointer to own object attributes
@@ -79,7 +131,7 @@ void io_exporter_destroy( io_exporter_t *this_ );
  *  \param target_folder path name to a folder where to store the images
  *  \param document_file_path path to the central/main document file
  *  \param io_export_stat pointer to already initialized statistics object where export statistics are collected
- *  \return U8_ERROR_NONE in case of success
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_CANCELLED if the progress was cancelled
  */
 u8_error_t io_exporter_export_files( io_exporter_t *this_,
                                      io_file_format_t export_type,
@@ -100,6 +152,37 @@ u8_error_t io_exporter_private_get_filename( io_exporter_t *this_,
                                              utf8stringbuf_t out_base_filename
                                            );
 
+/*!
+ *  \brief renders all diagrams and exports these to picture files
+ *
+ *  If an image_pool is set and can be used, the diagrams are rendered in parallel,
+ *  otherwise one after the other.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param image_formats bitset of IO_FILE_FORMAT_SVG, IO_FILE_FORMAT_PDF, IO_FILE_FORMAT_PS and IO_FILE_FORMAT_PNG
+ *  \param target_folder path name to a folder where to store the images
+ *  \param io_export_stat pointer to statistics object where export statistics are collected
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t io_exporter_private_export_all_image_files( io_exporter_t *this_,
+                                                       io_file_format_t image_formats,
+                                                       const char *target_folder,
+                                                       data_stat_t *io_export_stat
+                                                     );
+
+/*!
+ *  \brief adds diagrams to the job list of the image_pool, does recursion for child diagrams
+ *  \param this_ pointer to own object attributes
+ *  \param diagram_id id of the diagram to add; DATA_ROW_VOID to add all root diagrams
+ *  \param max_recursion if greater than 0 and children exist, this function calls itself recursively
+ *  \return U8_ERROR_NONE in case of success,
+ *           U8_ERROR_ARRAY_BUFFER_EXCEEDED if the job list is full, an other error code if the database could not be read
+ */
+u8_error_t io_exporter_private_collect_image_jobs( io_exporter_t *this_,
+                                                   data_id_t diagram_id,
+                                                   uint32_t max_recursion
+                                                 );
+
 /*!
  *  \brief renders diagrams and exports these to picture (or text) files, does recursion for child diagrams
  *  \param this_ pointer to own object attributes
@@ -166,6 +249,110 @@ u8_error_t io_exporter_export_document_file( io_exporter_t *this_,
                                              data_stat_t *io_export_stat
                                            );
 
+/*!
+ *  \brief creates a json file and records the spans of its top-level objects.
+ *
+ *  If a previous export and the changes since then are given,
+ *  the spans of unchanged objects are copied from the previous export
+ *  instead of being read from the database and serialized again.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param document_title title of the document to export
+ *  \param file_path path name to the export file
+ *  \param previous_file_path path name to the file of the previous export, NULL to write all objects.
+ *                            This must not be the same file as file_path.
+ *  \param changes the objects that changed since the previous export, NULL to write all objects
+ *  \param io_spans in case of a delta, the spans of the previous export; these are replaced by the spans of the new file.
+ *                  In case of an error, io_spans is marked incomplete.
+ *  \param io_export_stat pointer to statistics object where export statistics are collected
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_INVALID_REQUEST if the objects do not match the spans of the previous export,
+ *          another error code in case of other errors
+ */
+u8_error_t io_exporter_export_json_file( io_exporter_t *this_,
+                                         const char *document_title,
+                                         const char *file_path,
+                                         const char *previous_file_path,
+                                         const io_export_dirty_set_t *changes,
+                                         io_export_span_list_t *io_spans,
+                                         data_stat_t *io_export_stat
+                                       );
+
+/*!
+ *  \brief writes the json document to the output stream
+ *
+ *  If (*this_).temp_spans is not NULL, spans are recorded and possibly copied from a previous export.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param document_title title of the document to export
+ *  \param output stream where to write the json document to
+ *  \param io_export_stat pointer to statistics object where export statistics are collected
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t io_exporter_private_export_json( io_exporter_t *this_,
+                                            const char *document_title,
+                                            universal_output_stream_t *output,
+                                            data_stat_t *io_export_stat
+                                          );
+
+/*!
+ *  \brief writes all classifiers in the current pass, each one as a span
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param pass the current pass, JSON_WRITER_PASS_NODES or JSON_WRITER_PASS_EDGES
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t io_exporter_private_export_json_classifiers( io_exporter_t *this_, json_writer_pass_t pass );
+
+/*!
+ *  \brief starts a span of a top-level object, copies the object from the previous export if unchanged
+ *
+ *  This function does nothing if (*this_).temp_spans is NULL.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param pass the current pass
+ *  \param row the diagram row in pass views, the classifier row otherwise
+ *  \param[out] out_copied true if the object was copied and shall not be written, false otherwise
+ *  \return U8_ERROR_NONE in case of success,
+ *           U8_ERROR_INVALID_REQUEST if the object does not match the spans of the previous export
+ */
+u8_error_t io_exporter_private_begin_span( io_exporter_t *this_,
+                                           json_writer_pass_t pass,
+                                           data_row_t row,
+                                           bool *out_copied
+                                         );
+
+/*!
+ *  \brief ends the span of a top-level object and records it
+ *
+ *  This function does nothing if (*this_).temp_spans is NULL.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param pass the current pass
+ *  \param row the diagram row in pass views, the classifier row otherwise
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t io_exporter_private_end_span( io_exporter_t *this_, json_writer_pass_t pass, data_row_t row );
+
+/*!
+ *  \brief gets the current write position in the json file, including the bytes still in the output buffer
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param out_position the number of bytes written to the json file so far
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t io_exporter_private_get_json_position( io_exporter_t *this_, size_t *out_position );
+
+/*!
+ *  \brief copies a byte range of the previous export to the json writer
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param start position of the first byte to copy, must not be less than (*this_).temp_previous_pos
+ *  \param end position after the last byte to copy
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t io_exporter_private_copy_previous( io_exporter_t *this_, size_t start, size_t end );
+
 /*!
  *  \brief creates a document part
  *  \param this_ pointer to own object attributes
@@ -217,6 +404,32 @@ void io_exporter_private_append_valid_chars_to_filename( io_exporter_t *this_,
                                                          utf8stringbuf_t filename
                                                        );
 
+/*!
+ *  \brief starts a phase of the progress, if a progress is set
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param phase_name name of the phase, a static string
+ *  \return true if the export shall continue, false if the progress was cancelled
+ */
+bool io_exporter_private_begin_phase( io_exporter_t *this_, const char *phase_name );
+
+/*!
+ *  \brief ticks the progress, if a progress is set
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_CANCELLED if the progress was cancelled, U8_ERROR_NONE otherwise
+ */
+u8_error_t io_exporter_private_tick( io_exporter_t *this_ );
+
+/*!
+ *  \brief adds the size of a written file to the progress, if a progress is set
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param file the file, still open, all buffered bytes already written
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t io_exporter_private_count_file_bytes( io_exporter_t *this_, universal_file_output_stream_t *file );
+
 #endif  /* IO_EXPORTER_H */
 
 
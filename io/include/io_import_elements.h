@@ -18,6 +18,7 @@
 
 #include "io_import_mode.h"
 #include "io_import_step.h"
+#include "io_import_uuid_index.h"
 #include "entity/data_classifier.h"
 #include "entity/data_feature.h"
 #include "entity/data_relationship.h"
@@ -51,6 +52,7 @@ struct io_import_elements_struct {
                                                    /*!< that can handle preferred ids and proposed names */
     data_stat_t *stat;  /*!< pointer to import statistics */
     utf8stream_writer_t *english_report;  /*!< pointer to a writer that writes an english report */
+    io_import_uuid_index_t uuid_index;  /*!< own instance of a uuid to id index of the elements created or found during this import */
 
     data_diagram_t temp_diagram;  /*!< memory buffer to load a diagram temporarily from the database */
     data_diagramelement_t temp_diagramelement;  /*!< memory buffer to load a diagramelement temporarily from the database */
@@ -195,6 +197,59 @@ u8_error_t io_import_elements_sync_relationship( io_import_elements_t *this_,
                                                  const char *to_node_uuid
                                                );
 
+/*!
+ *  \brief determines the diagram row of a uuid
+ *
+ *  The uuid index is searched first, the database is queried only if the uuid is not in the index.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param diagram_uuid uuid of the diagram, not NULL
+ *  \param[out] out_diagram_row row of the found diagram, DATA_ROW_VOID if not found
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_NOT_FOUND if there is no such diagram
+ */
+u8_error_t io_import_elements_private_find_diagram( io_import_elements_t *this_,
+                                                    const char *diagram_uuid,
+                                                    data_row_t *out_diagram_row
+                                                  );
+
+/*!
+ *  \brief determines the classifier row and the feature row of a uuid that references a classifier or a feature
+ *
+ *  The uuid index is searched first, the database is queried only if the uuid is not in the index.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param node_uuid uuid of the classifier or feature, not NULL
+ *  \param[out] out_classifier_row row of the found classifier or of the classifier of the found feature,
+ *                                  DATA_ROW_VOID if not found
+ *  \param[out] out_feature_row row of the found feature, DATA_ROW_VOID if not found or if a classifier was found
+ *  \param[out] out_feature_type main type of the found feature, DATA_FEATURE_TYPE_VOID if no feature was found
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_NOT_FOUND if there is no such classifier or feature
+ */
+u8_error_t io_import_elements_private_find_node( io_import_elements_t *this_,
+                                                 const char *node_uuid,
+                                                 data_row_t *out_classifier_row,
+                                                 data_row_t *out_feature_row,
+                                                 data_feature_type_t *out_feature_type
+                                               );
+
+/*!
+ *  \brief adds an element that exists in the database to the uuid index
+ *
+ *  If the index is full, the element is not added; later lookups then query the database.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param uuid uuid of the element, not NULL
+ *  \param id table and row of the element
+ *  \param classifier_row row of the classifier in case of a classifier or feature, DATA_ROW_VOID otherwise
+ *  \param feature_type main type in case of a feature, DATA_FEATURE_TYPE_VOID otherwise
+ */
+void io_import_elements_private_index_uuid( io_import_elements_t *this_,
+                                            const char *uuid,
+                                            data_id_t id,
+                                            data_row_t classifier_row,
+                                            data_feature_type_t feature_type
+                                          );
+
 /*!
  *  \brief writes a note to the report that the requested id differes frmo the created id
  *
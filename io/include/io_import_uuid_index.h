@@ -0,0 +1,176 @@
+/* File: io_import_uuid_index.h; Copyright and License: see below */
+
+#ifndef IO_IMPORT_UUID_INDEX_H
+#define IO_IMPORT_UUID_INDEX_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Remembers the database ids of the elements that were created or found during an import, searchable by uuid.
+ *
+ *  When importing a model, relationships, features and diagramelements reference their classifiers
+ *  and diagrams by uuid. This index answers these lookups without querying the database.
+ *  It only knows elements that were added by the importer;
+ *  if a uuid is not found, the caller shall ask the database.
+ *
+ *  The index is an open-addressing hash table that grows with the number of imported elements.
+ *  Only if no memory is available to grow, further elements are not added - lookups then fall back to the database.
+ */
+
+#include "entity/data_id.h"
+#include "entity/data_row.h"
+#include "entity/data_uuid.h"
+#include "entity/data_feature_type.h"
+#include "u8/u8_error.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *  \brief constants for the index size
+ */
+enum io_import_uuid_index_size_enum {
+    IO_IMPORT_UUID_INDEX_MIN_SLOTS = 256,  /*!< number of hash slots when the first entry is added, must be a power of 2 */
+    IO_IMPORT_UUID_INDEX_FILL_PERCENT = 75,  /*!< maximum filling of the slots before the index grows, keeps the probe sequences short */
+};
+
+/*!
+ *  \brief one entry of the hash table
+ *
+ *  A slot is empty if its uuid is the empty string.
+ */
+struct io_import_uuid_index_slot_struct {
+    char uuid[DATA_UUID_STRING_SIZE];  /*!< the uuid, the hash key */
+    data_id_t id;  /*!< the table and row */
+    data_row_t classifier_row;  /*!< the classifier row: the own row of a classifier, */
+                                /*!< the parent row of a feature, DATA_ROW_VOID otherwise */
+    data_feature_type_t feature_type;  /*!< the type of a feature, DATA_FEATURE_TYPE_VOID otherwise */
+};
+
+typedef struct io_import_uuid_index_slot_struct io_import_uuid_index_slot_t;
+
+/*!
+ *  \brief attributes of a io_import_uuid_index_t
+ */
+struct io_import_uuid_index_struct {
+    uint32_t count;  /*!< number of used slots */
+    uint32_t slot_count;  /*!< number of allocated slots, 0 or a power of 2 */
+    io_import_uuid_index_slot_t *slots;  /*!< the hash table, NULL if slot_count is 0 */
+    bool overflow_logged;  /*!< true if a failure to grow was already logged */
+};
+
+typedef struct io_import_uuid_index_struct io_import_uuid_index_t;
+
+/*!
+ *  \brief initializes the io_import_uuid_index_t struct to an empty index
+ *
+ *  No memory is allocated before the first entry is added.
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void io_import_uuid_index_init ( io_import_uuid_index_t *this_ );
+
+/*!
+ *  \brief removes all entries from the io_import_uuid_index_t struct
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void io_import_uuid_index_reinit ( io_import_uuid_index_t *this_ );
+
+/*!
+ *  \brief destroys the io_import_uuid_index_t struct and frees its hash table
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void io_import_uuid_index_destroy ( io_import_uuid_index_t *this_ );
+
+/*!
+ *  \brief adds a uuid to the index. If the uuid is already known, its entry is overwritten.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param uuid the uuid of the element, must not be empty
+ *  \param id the table and row of the element in the database
+ *  \param classifier_row the classifier row in case of a classifier or feature, DATA_ROW_VOID otherwise
+ *  \param feature_type the feature type in case of a feature, DATA_FEATURE_TYPE_VOID otherwise
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if the index is full and no memory is available to grow,
+ *          U8_ERROR_VALUE_OUT_OF_RANGE if the uuid is empty or too long
+ */
+u8_error_t io_import_uuid_index_add ( io_import_uuid_index_t *this_,
+                                      const char *uuid,
+                                      data_id_t id,
+                                      data_row_t classifier_row,
+                                      data_feature_type_t feature_type
+                                    );
+
+/*!
+ *  \brief searches a uuid in the index
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param uuid the uuid to search
+ *  \param[out] out_id the table and row of the found element, DATA_ID_VOID if not found
+ *  \param[out] out_classifier_row the classifier row of the found element, NULL if not requested
+ *  \param[out] out_feature_type the feature type of the found element, NULL if not requested
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_NOT_FOUND if the uuid is not in the index
+ */
+u8_error_t io_import_uuid_index_get ( const io_import_uuid_index_t *this_,
+                                      const char *uuid,
+                                      data_id_t *out_id,
+                                      data_row_t *out_classifier_row,
+                                      data_feature_type_t *out_feature_type
+                                    );
+
+/*!
+ *  \brief gets the number of entries in the index
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of entries
+ */
+uint32_t io_import_uuid_index_get_count ( const io_import_uuid_index_t *this_ );
+
+/*!
+ *  \brief allocates a hash table with twice the slots and moves all entries to it
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_ARRAY_BUFFER_EXCEEDED if no memory is available
+ */
+u8_error_t io_import_uuid_index_private_grow ( io_import_uuid_index_t *this_ );
+
+/*!
+ *  \brief calculates the hash slot where the search for a uuid starts
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param uuid the uuid to hash
+ *  \return index of the first slot to probe
+ */
+uint32_t io_import_uuid_index_private_hash ( const io_import_uuid_index_t *this_, const char *uuid );
+
+/*!
+ *  \brief finds the slot that contains the uuid or the first empty slot of its probe sequence
+ *
+ *  slot_count shall be greater than 0.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param uuid the uuid to search
+ *  \param[out] out_found true if the slot contains the uuid, false if the slot is empty
+ *  \return index of the slot
+ */
+uint32_t io_import_uuid_index_private_find_slot ( const io_import_uuid_index_t *this_, const char *uuid, bool *out_found );
+
+#endif  /* IO_IMPORT_UUID_INDEX_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
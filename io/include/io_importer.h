@@ -10,6 +10,7 @@
 
 #include "json/json_importer.h"
 #include "io_import_elements.h"
+#include "io_progress.h"
 #include "io_file_format.h"
 #include "ctrl_controller.h"
 #include "storage/data_database_reader.h"
@@ -28,6 +29,7 @@
 struct io_importer_struct {
     data_database_reader_t *db_reader;  /*!< pointer to external database reader */
     ctrl_controller_t *controller;  /*!< pointer to external controller */
+    io_progress_t *progress;  /*!< NULL or pointer to external progress of file and stream imports */
 
     json_importer_t temp_json_importer;  /*!< own instance of a json stream importer */
     io_import_elements_t temp_elements_importer;  /*!< own instance of a db-element sync to database */
@@ -54,6 +56,16 @@ void io_importer_init ( io_importer_t *this_,
  */
 void io_importer_destroy ( io_importer_t *this_ );
 
+/*!
+ *  \brief sets an object that reports the progress of file and stream imports and allows to cancel these
+ *
+ *  Each pass over the input is a phase of the progress, each element written to the database is a tick.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param progress pointer to an initialized progress, NULL to import without progress reports
+ */
+void io_importer_set_progress ( io_importer_t *this_, io_progress_t *progress );
+
 /*!
  *  \brief copies the clipboard contents to the focused diagram
  *
@@ -97,6 +109,7 @@ u8_error_t io_importer_import_clipboard( io_importer_t *this_,
  *  \return U8_ERROR_NONE in case of success,
  *          U8_ERROR_INVALID_REQUEST if file cannot be opened,
  *          U8_ERROR_AT_FILE_READ in case of reading errors after open,
+ *          U8_ERROR_CANCELLED if the progress was cancelled,
  *          other error code otherwise
  */
 u8_error_t io_importer_import_file( io_importer_t *this_,
@@ -126,6 +139,7 @@ u8_error_t io_importer_import_file( io_importer_t *this_,
  *  \return U8_ERROR_NONE in case of success,
  *          U8_ERROR_INVALID_REQUEST if file cannot be opened,
  *          U8_ERROR_AT_FILE_READ in case of reading errors after open,
+ *          U8_ERROR_CANCELLED if the progress was cancelled,
  *          other error code otherwise
  */
 u8_error_t io_importer_import_stream( io_importer_t *this_,
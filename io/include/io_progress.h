@@ -0,0 +1,222 @@
+/* File: io_progress.h; Copyright and License: see below */
+
+#ifndef IO_PROGRESS_H
+#define IO_PROGRESS_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Reports the progress of a long running import or export to a listener and allows to cancel it.
+ *
+ *  The importer or exporter updates the statistics, counts the bytes, starts named phases
+ *  and calls io_progress_tick() after each processed element.
+ *  io_progress_tick() calls the listener at most once per interval
+ *  and tells the caller to stop after io_progress_cancel() was called.
+ *
+ *  All functions except io_progress_cancel() shall be called by the thread that runs the import or export;
+ *  io_progress_cancel() may be called by any thread, also from within the listener callback.
+ */
+
+#include "set/data_stat.h"
+#include "u8/u8_error.h"
+#include <glib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *  \brief constants of io_progress_t
+ */
+enum io_progress_max_enum {
+    IO_PROGRESS_MAX_PHASES = 8,  /*!< maximum number of phases that are timed separately; further phases extend the last one */
+    IO_PROGRESS_DEFAULT_INTERVAL = 250000,  /*!< default minimum time between two calls of the listener, in microseconds */
+};
+
+/*!
+ *  \brief attributes of the progress of an import or export
+ */
+struct io_progress_struct {
+    data_stat_t *stat;  /*!< pointer to external statistics object which is updated by the running import or export */
+    uint64_t byte_count;  /*!< number of bytes read or written so far */
+
+    uint32_t phase_count;  /*!< number of started phases, at most IO_PROGRESS_MAX_PHASES */
+    const char *phase_name[IO_PROGRESS_MAX_PHASES];  /*!< names of the started phases, static strings */
+    int64_t phase_time[IO_PROGRESS_MAX_PHASES];  /*!< durations of the started phases in microseconds, as of the last report */
+    bool phase_running;  /*!< true if the last phase is not yet ended */
+
+    int64_t start_time;  /*!< monotonic time when the progress was initialized, in microseconds */
+    int64_t phase_start_time;  /*!< monotonic time when the last phase was started, in microseconds */
+    int64_t report_time;  /*!< monotonic time of the last report, in microseconds */
+    int64_t interval;  /*!< minimum time between two calls of the listener, in microseconds */
+    gint cancelled;  /*!< non-zero if the import or export shall stop; accessed atomically */
+
+    void *listener_instance;  /*!< instance pointer passed to listener_callback */
+    void (*listener_callback)( void *listener_instance, const struct io_progress_struct *progress );  /*!< NULL or function to call on each report */
+};
+
+typedef struct io_progress_struct io_progress_t;
+
+/*!
+ *  \brief initializes the io_progress_t struct and starts its clock
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param stat pointer to the statistics object that the import or export updates
+ *  \param listener_instance instance pointer passed to listener_callback
+ *  \param listener_callback a callback function or NULL.
+ *                           Simply dereference the function name, omit parameters and add a typecast,
+ *                           e.g. (void (*)(void*,const io_progress_t*)) &my_callback_function
+ */
+void io_progress_init ( io_progress_t *this_,
+                        data_stat_t *stat,
+                        void *listener_instance,
+                        void (*listener_callback)( void *listener_instance, const io_progress_t *progress )
+                      );
+
+/*!
+ *  \brief destroys the io_progress_t struct
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void io_progress_destroy ( io_progress_t *this_ );
+
+/*!
+ *  \brief sets the minimum time between two calls of the listener
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param interval interval in microseconds, 0 to call the listener on every tick
+ */
+static inline void io_progress_set_interval ( io_progress_t *this_, int64_t interval );
+
+/*!
+ *  \brief ends the current phase (if any) and starts a new one, then calls the listener
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param phase_name name of the phase, a static string that outlives this object
+ */
+void io_progress_begin_phase ( io_progress_t *this_, const char *phase_name );
+
+/*!
+ *  \brief ends the current phase (if any), then calls the listener
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void io_progress_end_phase ( io_progress_t *this_ );
+
+/*!
+ *  \brief adds to the number of bytes read or written
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param bytes number of bytes to add
+ */
+static inline void io_progress_add_bytes ( io_progress_t *this_, uint64_t bytes );
+
+/*!
+ *  \brief reports the progress to the listener if the interval has elapsed since the last report
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_CANCELLED if the import or export shall stop, U8_ERROR_NONE otherwise
+ */
+u8_error_t io_progress_tick ( io_progress_t *this_ );
+
+/*!
+ *  \brief requests the running import or export to stop at its next tick
+ *
+ *  This function may be called from any thread.
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void io_progress_cancel ( io_progress_t *this_ );
+
+/*!
+ *  \brief checks if io_progress_cancel() was called
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if the import or export shall stop
+ */
+static inline bool io_progress_is_cancelled ( const io_progress_t *this_ );
+
+/*!
+ *  \brief gets the statistics of processed elements
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return pointer to the statistics object
+ */
+static inline const data_stat_t * io_progress_get_stat_const ( const io_progress_t *this_ );
+
+/*!
+ *  \brief gets the number of bytes read or written
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of bytes
+ */
+static inline uint64_t io_progress_get_byte_count ( const io_progress_t *this_ );
+
+/*!
+ *  \brief gets the time from initialization to the last report
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return elapsed time in microseconds
+ */
+static inline int64_t io_progress_get_elapsed_time ( const io_progress_t *this_ );
+
+/*!
+ *  \brief gets the number of processed elements per second, averaged from initialization to the last report
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return elements per second, 0 if no time has elapsed
+ */
+static inline uint32_t io_progress_get_rate ( const io_progress_t *this_ );
+
+/*!
+ *  \brief gets the number of started phases
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of phases
+ */
+static inline uint32_t io_progress_get_phase_count ( const io_progress_t *this_ );
+
+/*!
+ *  \brief gets the name of a phase
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index index of the phase, smaller than io_progress_get_phase_count()
+ *  \return name of the phase
+ */
+static inline const char * io_progress_get_phase_name ( const io_progress_t *this_, uint32_t index );
+
+/*!
+ *  \brief gets the duration of a phase, a running phase is measured up to the last report
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index index of the phase, smaller than io_progress_get_phase_count()
+ *  \return duration in microseconds
+ */
+static inline int64_t io_progress_get_phase_time ( const io_progress_t *this_, uint32_t index );
+
+/*!
+ *  \brief updates the duration of the running phase and calls the listener
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param now current monotonic time in microseconds
+ */
+void io_progress_private_report ( io_progress_t *this_, int64_t now );
+
+#include "io_progress.inl"
+
+#endif  /* IO_PROGRESS_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,82 @@
+/* File: io_progress.inl; Copyright and License: see below */
+
+#include <assert.h>
+
+static inline void io_progress_set_interval ( io_progress_t *this_, int64_t interval )
+{
+    assert( interval >= 0 );
+    (*this_).interval = interval;
+}
+
+static inline void io_progress_add_bytes ( io_progress_t *this_, uint64_t bytes )
+{
+    (*this_).byte_count += bytes;
+}
+
+static inline void io_progress_cancel ( io_progress_t *this_ )
+{
+    g_atomic_int_set( &((*this_).cancelled), 1 );
+}
+
+static inline bool io_progress_is_cancelled ( const io_progress_t *this_ )
+{
+    return ( 0 != g_atomic_int_get( &((*this_).cancelled) ) );
+}
+
+static inline const data_stat_t * io_progress_get_stat_const ( const io_progress_t *this_ )
+{
+    return (*this_).stat;
+}
+
+static inline uint64_t io_progress_get_byte_count ( const io_progress_t *this_ )
+{
+    return (*this_).byte_count;
+}
+
+static inline int64_t io_progress_get_elapsed_time ( const io_progress_t *this_ )
+{
+    return (*this_).report_time - (*this_).start_time;
+}
+
+static inline uint32_t io_progress_get_rate ( const io_progress_t *this_ )
+{
+    const int64_t elapsed = io_progress_get_elapsed_time( this_ );
+    /* warnings are counted twice, once more in another series */
+    const uint64_t processed
+        = data_stat_get_total_count( (*this_).stat ) - data_stat_get_series_count( (*this_).stat, DATA_STAT_SERIES_WARNING );
+    return ( elapsed > 0 ) ? (uint32_t)( ( processed * 1000000 ) / (uint64_t) elapsed ) : 0;
+}
+
+static inline uint32_t io_progress_get_phase_count ( const io_progress_t *this_ )
+{
+    return (*this_).phase_count;
+}
+
+static inline const char * io_progress_get_phase_name ( const io_progress_t *this_, uint32_t index )
+{
+    assert( index < (*this_).phase_count );
+    return (*this_).phase_name[index];
+}
+
+static inline int64_t io_progress_get_phase_time ( const io_progress_t *this_, uint32_t index )
+{
+    assert( index < (*this_).phase_count );
+    return (*this_).phase_time[index];
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
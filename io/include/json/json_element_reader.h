@@ -266,6 +266,14 @@ u8_error_t json_element_reader_skip_next_string ( json_element_reader_t *this_ )
  */
 uint32_t json_element_reader_get_read_line ( json_element_reader_t *this_ );
 
+/*!
+ *  \brief gets the number of bytes read so far
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return the byte position of the current reading position in the input stream
+ */
+size_t json_element_reader_get_read_pos ( json_element_reader_t *this_ );
+
 /*!
  *  \brief parses the next object as feature
  *
@@ -24,6 +24,7 @@
 #include "entity/data_diagramelement.h"
 #include "set/data_stat.h"
 #include "u8stream/universal_output_stream.h"
+#include "utf8stringbuf/utf8stringview.h"
 #include "u8/u8_error.h"
 
 /*!
@@ -360,6 +361,20 @@ u8_error_t json_element_writer_end_diagramelement( json_element_writer_t *this_,
                                                    const data_diagramelement_t *diagramelement_ptr
                                                  );
 
+/*!
+ *  \brief writes objects of the main section that were already serialized, e.g. by a previous export
+ *
+ *  The state of this json_element_writer_t is updated as if the objects had been written
+ *  by start_/assemble_/end_ calls in the current mode.
+ *  In mode JSON_WRITER_PASS_VIEWS, the serialized part ends with the elements of an open diagram
+ *  (diagrams are ended when the next starts), and it begins with the ending of the previous diagram.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param serialized the serialized json objects including the separators, may be empty
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t json_element_writer_write_verbatim( json_element_writer_t *this_, const utf8stringview_t *serialized );
+
 /*!
  *  \brief writes the ending of the main section
  *
@@ -0,0 +1,161 @@
+/* File: json_import_queue.h; Copyright and License: see below */
+
+#ifndef JSON_IMPORT_QUEUE_H
+#define JSON_IMPORT_QUEUE_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Passes parsed json elements from a parser thread to the thread that writes them to the database
+ *
+ *  The queue is a ring of a fixed number of records.
+ *  The parser fills a free record in place (begin_push), then publishes it (end_push).
+ *  The database thread processes the oldest published record in place (begin_pop), then frees it (end_pop).
+ *  If the ring is full, the parser waits; if it is empty, the database thread waits.
+ *
+ *  Exactly one thread may push and one thread may pop.
+ */
+
+#include "entity/data_table.h"
+#include "entity/data_classifier.h"
+#include "entity/data_feature.h"
+#include "entity/data_relationship.h"
+#include "entity/data_diagram.h"
+#include "entity/data_diagramelement.h"
+#include "entity/data_uuid.h"
+#include "u8/u8_error.h"
+#include <glib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ *  \brief constants of json_import_queue_t
+ */
+enum json_import_queue_max_enum {
+    JSON_IMPORT_QUEUE_MAX_RECORDS = 16,  /*!< number of records in the ring */
+};
+
+/*!
+ *  \brief one parsed json element and the uuids it refers to
+ */
+struct json_import_record_struct {
+    data_table_t table;  /*!< the type of element, selects the member of the union */
+    union {
+        data_diagram_t diagram;  /*!< a diagram if table is DATA_TABLE_DIAGRAM */
+        data_diagramelement_t diagramelement;  /*!< a diagramelement if table is DATA_TABLE_DIAGRAMELEMENT */
+        data_classifier_t classifier;  /*!< a classifier if table is DATA_TABLE_CLASSIFIER */
+        data_feature_t feature;  /*!< a feature if table is DATA_TABLE_FEATURE */
+        data_relationship_t relationship;  /*!< a relationship if table is DATA_TABLE_RELATIONSHIP */
+    } element;  /*!< the parsed element */
+    char owner_uuid[DATA_UUID_STRING_SIZE];  /*!< parent diagram of a diagram, diagram of a diagramelement, */
+                                             /*!< classifier of a feature, from-node of a relationship */
+    char node_uuid[DATA_UUID_STRING_SIZE];  /*!< classifier or feature of a diagramelement, to-node of a relationship */
+    uint32_t read_line;  /*!< line in the json input after parsing the element */
+    size_t read_pos;  /*!< byte position in the json input after parsing the element */
+};
+
+typedef struct json_import_record_struct json_import_record_t;
+
+/*!
+ *  \brief attributes of the json import queue
+ */
+struct json_import_queue_struct {
+    json_import_record_t record[JSON_IMPORT_QUEUE_MAX_RECORDS];  /*!< the ring of records */
+
+    /* attributes shared between threads */
+    GMutex lock;  /*!< lock to protect the following attributes */
+    GCond changed;  /*!< signalled whenever one of the following attributes changes */
+    uint32_t first;  /*!< index of the oldest published record */
+    uint32_t count;  /*!< number of published records */
+    bool closed;  /*!< true if the parser will not push any more records */
+    bool cancelled;  /*!< true if the database thread will not pop any more records */
+};
+
+typedef struct json_import_queue_struct json_import_queue_t;
+
+/*!
+ *  \brief initializes the json_import_queue_t as empty queue
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void json_import_queue_init ( json_import_queue_t *this_ );
+
+/*!
+ *  \brief empties the queue for the next import, there must be no thread using the queue
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void json_import_queue_reset ( json_import_queue_t *this_ );
+
+/*!
+ *  \brief destroys the json_import_queue_t
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void json_import_queue_destroy ( json_import_queue_t *this_ );
+
+/*!
+ *  \brief gets the next free record, waits if the queue is full
+ *
+ *  Calling this function again without end_push returns the same record.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param[out] out_record the free record to be filled by the caller
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_WRONG_STATE if the queue was cancelled
+ */
+u8_error_t json_import_queue_begin_push ( json_import_queue_t *this_, json_import_record_t **out_record );
+
+/*!
+ *  \brief publishes the record returned by json_import_queue_begin_push
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void json_import_queue_end_push ( json_import_queue_t *this_ );
+
+/*!
+ *  \brief marks that no more records will be pushed
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void json_import_queue_close ( json_import_queue_t *this_ );
+
+/*!
+ *  \brief gets the oldest published record, waits if the queue is empty and not closed
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return the oldest record, NULL if the queue is empty and closed
+ */
+json_import_record_t *json_import_queue_begin_pop ( json_import_queue_t *this_ );
+
+/*!
+ *  \brief frees the record returned by json_import_queue_begin_pop
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void json_import_queue_end_pop ( json_import_queue_t *this_ );
+
+/*!
+ *  \brief marks that no more records will be popped, a waiting json_import_queue_begin_push returns
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void json_import_queue_cancel ( json_import_queue_t *this_ );
+
+#endif  /* JSON_IMPORT_QUEUE_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -9,7 +9,9 @@
  */
 
 #include "json/json_element_reader.h"
+#include "json/json_import_queue.h"
 #include "io_import_elements.h"
+#include "io_progress.h"
 #include "data_rules.h"
 #include "set/data_stat.h"
 #include "u8stream/universal_input_stream.h"
@@ -17,24 +19,33 @@
 #include "utf8stringbuf/utf8stringbuf.h"
 #include "u8/u8_error_info.h"
 #include "u8/u8_error.h"
+#include <glib.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 /*!
  *  \brief attributes of the json import object
  *
+ *  The json input is parsed on an own thread, the parsed elements are passed via a json_import_queue_t
+ *  to the calling thread, which forwards them to the elements_importer.
+ *  So parsing and writing to the database overlap.
+ *
  *  Lifecycle: A json importer shall perform a single import operation only.
  *  It may be initialized before one import operation and be destroyed afterwards.
  */
 struct json_importer_struct {
     data_rules_t data_rules;  /*!< own instance of uml and sysml consistency rules */
 
-    json_element_reader_t temp_element_reader;  /*!< own instance of a json element deserializer */
-    io_import_elements_t *elements_importer;  /*!< pointer to external db-element sync to database */
+    json_element_reader_t temp_element_reader;  /*!< own instance of a json element deserializer, used by the parser */
+    io_import_elements_t *elements_importer;  /*!< pointer to external db-element sync to database, used by the calling thread */
+    io_progress_t *progress;  /*!< NULL or pointer to external progress, used by the calling thread */
+    size_t progress_pos;  /*!< byte position in the json input up to which the progress has been counted */
 
-    data_diagram_t temp_diagram;  /*!< memory buffer to store a diagram temporarily when reading a json object */
-    data_diagramelement_t temp_diagramelement;  /*!< memory buffer to store a diagramelement temporarily when reading a json object */
-    data_classifier_t temp_classifier;  /*!< memory buffer to store a classifier temporarily when reading a json object */
-    data_feature_t temp_feature;  /*!< memory buffer to store a feature temporarily when reading a json object */
-    data_relationship_t temp_relationship;  /*!< memory buffer to store a relationship temporarily when reading a json object */
+    json_import_queue_t queue;  /*!< parsed elements on their way from the parser to the elements_importer */
+    bool queued;  /*!< true if the parser runs on an own thread and passes the elements via the queue */
+    json_import_record_t temp_record;  /*!< memory buffer to store an element temporarily if not queued */
+    u8_error_t parse_result;  /*!< result of the parser, valid after the parser finished */
+    uint32_t parse_line;  /*!< line where the parser finished, valid after the parser finished */
 };
 
 typedef struct json_importer_struct json_importer_t;
@@ -44,8 +55,10 @@ typedef struct json_importer_struct json_importer_t;
  *
  *  \param this_ pointer to own object attributes
  *  \param elements_importer pointer to an object that synchronizes the json-object with the database
+ *  \param progress NULL or pointer to an object that is ticked after each element written to the database;
+ *                  if it is cancelled, the import stops with U8_ERROR_CANCELLED
  */
-void json_importer_init( json_importer_t *this_, io_import_elements_t *elements_importer );
+void json_importer_init( json_importer_t *this_, io_import_elements_t *elements_importer, io_progress_t *progress );
 
 /*!
  *  \brief destroys the json_importer_t struct
@@ -62,13 +75,73 @@ void json_importer_destroy( json_importer_t *this_ );
  *  \param out_err_info pointer to an error_info_t data struct that may provide an error description when returning
  *  \return U8_ERROR_NONE in case of success, U8_ERROR_DB_STRUCTURE if diagram_id does not exist,
  *          U8_ERROR_PARSER_STRUCTURE if unexpected order of tokens,
- *          U8_ERROR_VALUE_OUT_OF_RANGE if a linked uuid does not exist, other error code otherwise
+ *          U8_ERROR_VALUE_OUT_OF_RANGE if a linked uuid does not exist,
+ *          U8_ERROR_CANCELLED if the progress was cancelled, other error code otherwise
  */
 u8_error_t json_importer_import_stream( json_importer_t *this_,
                                         universal_input_stream_t *json_text,
                                         u8_error_info_t *out_err_info
                                       );
 
+/*!
+ *  \brief parses the json input; forwards the elements to the queue or directly to the elements_importer
+ *
+ *  This function is the main function of the parser thread.
+ *  It stores the result in parse_result and parse_line.
+ *
+ *  \param data pointer to own object attributes
+ *  \return NULL
+ */
+gpointer json_importer_private_parse_thread ( gpointer data );
+
+/*!
+ *  \brief parses the json input from header to footer
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_WRONG_STATE if the queue was cancelled,
+ *          an error code of the parser or - if not queued - of the elements_importer otherwise
+ */
+u8_error_t json_importer_private_parse ( json_importer_t *this_ );
+
+/*!
+ *  \brief forwards the queued elements to the elements_importer till the parser finishes or an error occurs
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param[out] out_error_line line in the json input of the element that could not be imported, 0 if none
+ *  \return U8_ERROR_NONE in case of success, the error code of the elements_importer otherwise
+ */
+u8_error_t json_importer_private_sync_queued_records ( json_importer_t *this_, uint32_t *out_error_line );
+
+/*!
+ *  \brief forwards one element to the elements_importer and destroys it, then ticks the progress
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param record the parsed element
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_CANCELLED if the progress was cancelled,
+ *          the error code of the elements_importer otherwise
+ */
+u8_error_t json_importer_private_sync_record ( json_importer_t *this_, json_import_record_t *record );
+
+/*!
+ *  \brief gets a record to parse the next element into
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param[out] out_record the record to fill
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_WRONG_STATE if the queue was cancelled
+ */
+u8_error_t json_importer_private_new_record ( json_importer_t *this_, json_import_record_t **out_record );
+
+/*!
+ *  \brief passes a filled record to the queue or - if not queued - forwards it to the elements_importer
+ *
+ *  The record must not be accessed afterwards.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param record the record returned by json_importer_private_new_record
+ *  \return U8_ERROR_NONE in case of success, the error code of the elements_importer otherwise
+ */
+u8_error_t json_importer_private_commit_record ( json_importer_t *this_, json_import_record_t *record );
+
 /*!
  *  \brief imports views to the focused diagram
  *
@@ -167,6 +167,27 @@ u8_error_t json_token_reader_get_value_type ( json_token_reader_t *this_, json_v
  */
 u8_error_t json_token_reader_read_string_value ( json_token_reader_t *this_, utf8stringbuf_t out_value );
 
+/*!
+ *  \brief determines the next value of type string without copying it if possible
+ *
+ *  If the string contains no escape sequences and the input is read in place
+ *  (see universal_buffer_input_stream_is_in_place), out_value refers to the input directly;
+ *  otherwise the string is decoded to scratch and out_value refers to scratch.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param scratch buffer to decode the string to if a zero-copy view is not possible
+ *  \param[out] out_value string-contents of the value-token, not 0-terminated.
+ *                        Valid until the input stream is closed or scratch is modified.
+ *  \return U8_ERROR_STRING_BUFFER_EXCEEDED if scratch does not provide enough space,
+ *          U8_ERROR_NONE if the lexical+parser structure of the input is valid,
+ *          U8_ERROR_PARSER_STRUCTURE if there is no string-value-token,
+ *          U8_ERROR_LEXICAL_STRUCTURE otherwise.
+ */
+u8_error_t json_token_reader_read_string_view ( json_token_reader_t *this_,
+                                                utf8stringbuf_t scratch,
+                                                utf8stringview_t *out_value
+                                              );
+
 /*!
  *  \brief determines the next value of type integer (subtype of number)
  *
@@ -220,6 +241,40 @@ u8_error_t json_token_reader_expect_null_value ( json_token_reader_t *this_ );
  */
 u8_error_t json_token_reader_expect_eof ( json_token_reader_t *this_ );
 
+/*!
+ *  \brief a 64 bit word where each byte is set to the given character
+ */
+#define JSON_TOKEN_READER_PRIVATE_BYTES(c) ( UINT64_C(0x0101010101010101) * (uint8_t)(c) )
+
+/*!
+ *  \brief loads 8 bytes from an unaligned address
+ *
+ *  \param bytes address of the first byte
+ *  \return the bytes as 64 bit word, in native byte order
+ */
+static inline uint64_t json_token_reader_private_load_word ( const char *bytes );
+
+/*!
+ *  \brief checks if any byte of a 64 bit word equals c
+ *
+ *  \param word 8 bytes to check
+ *  \param c the byte to search
+ *  \return true if at least one byte of word is c
+ */
+static inline bool json_token_reader_private_word_has_byte ( uint64_t word, char c );
+
+/*!
+ *  \brief finds the first quote, escape or zero byte
+ *
+ *  Checks 16 bytes at a time on SSE2 capable processors, then 8 bytes at a time,
+ *  then the exact position byte by byte.
+ *
+ *  \param start first byte to check
+ *  \param length number of bytes to check
+ *  \return position of the first quote, escape or zero; length if there is none
+ */
+static inline size_t json_token_reader_private_find_string_end ( const char *start, size_t length );
+
 /*!
  *  \brief skips whitespaces
  *
@@ -275,6 +330,39 @@ static inline bool json_token_reader_private_is_value_end ( json_token_reader_t
  */
 static inline u8_error_t json_token_reader_private_read_string ( json_token_reader_t *this_, universal_output_stream_t *out_stream );
 
+/*!
+ *  \brief finds a string literal that contains no escape sequences and that is completely in the input buffer
+ *
+ *  The read pointer shall have passed the delimiting quotes already; it is not moved.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param[out] out_view the string-contents up to the ending quotes, valid until the input buffer is refilled
+ *  \return true if the string was found, false if the string needs to be decoded by json_token_reader_private_decode_string
+ */
+static inline bool json_token_reader_private_find_plain_string ( json_token_reader_t *this_, utf8stringview_t *out_view );
+
+/*!
+ *  \brief reads a string literal and decodes its escape sequences to a utf8stringbuf
+ *
+ *  The read pointer shall have passed the delimiting quotes already and will not pass the ending quotes.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param out_value string-contents of the value-token
+ *  \return U8_ERROR_STRING_BUFFER_EXCEEDED if out_value does not provide enough space,
+ *          U8_ERROR_NONE if the lexical+parser structure of the input is valid,
+ *          U8_ERROR_LEXICAL_STRUCTURE otherwise.
+ */
+u8_error_t json_token_reader_private_decode_string ( json_token_reader_t *this_, utf8stringbuf_t out_value );
+
+/*!
+ *  \brief reads the ending quotes of a string literal
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE if the ending quotes are followed by a token separator,
+ *          U8_ERROR_LEXICAL_STRUCTURE otherwise.
+ */
+u8_error_t json_token_reader_private_expect_string_end ( json_token_reader_t *this_ );
+
 /*!
  *  \brief parses the integer token
  *
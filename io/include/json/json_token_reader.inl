@@ -2,30 +2,116 @@
 
 #include "json/json_constants.h"
 #include "u8/u8_trace.h"
+#include <string.h>
 #include <assert.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
-static inline void json_token_reader_private_skip_whitespace ( json_token_reader_t *this_ )
+static inline uint64_t json_token_reader_private_load_word ( const char *bytes )
 {
-    bool ws_end_reached = false;
-    char current = ' ';
-    while ( ( ! ws_end_reached ) && ( current != '\0' ) )
+    uint64_t result;
+    memcpy( &result, bytes, sizeof(result) );  /* compilers translate this to a single unaligned load */
+    return result;
+}
+
+static inline bool json_token_reader_private_word_has_byte ( uint64_t word, char c )
+{
+    /* a byte of diff is zero if the byte of word is c, see "determine if a word has a zero byte" */
+    const uint64_t diff = word ^ JSON_TOKEN_READER_PRIVATE_BYTES( c );
+    return ( 0 != ( ( diff - JSON_TOKEN_READER_PRIVATE_BYTES( 0x01 ) ) & ( ~diff ) & JSON_TOKEN_READER_PRIVATE_BYTES( 0x80 ) ) );
+}
+
+static inline size_t json_token_reader_private_find_string_end ( const char *start, size_t length )
+{
+    size_t pos = 0;
+    bool found = false;
+#if defined(__SSE2__)
+    /* skip 16 bytes at a time while there is no quote, escape or zero */
+    const __m128i quotes = _mm_set1_epi8( JSON_CONSTANTS_CHAR_END_STRING );
+    const __m128i escapes = _mm_set1_epi8( JSON_CONSTANTS_CHAR_ESC );
+    const __m128i zeros = _mm_setzero_si128();
+    while (( pos + sizeof(__m128i) <= length )&&( ! found ))
     {
-        current = universal_buffer_input_stream_peek_next( &((*this_).in_stream) );
-        if ( ( JSON_CONSTANTS_CHAR_NL != current )
-            && ( JSON_CONSTANTS_CHAR_CR != current )
-            && ( JSON_CONSTANTS_CHAR_TAB != current )
-            && ( JSON_CONSTANTS_CHAR_SPACE != current ))
+        const __m128i chunk = _mm_loadu_si128( (const __m128i*) &(start[pos]) );
+        const __m128i hits = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( chunk, quotes ),
+                                                         _mm_cmpeq_epi8( chunk, escapes )
+                                                       ),
+                                           _mm_cmpeq_epi8( chunk, zeros )
+                                         );
+        found = ( 0 != _mm_movemask_epi8( hits ) );
+        if ( ! found )
         {
-            ws_end_reached = true;
+            pos += sizeof(__m128i);
         }
-        else
+    }
+#endif  /* __SSE2__ */
+    /* skip 8 bytes at a time while there is no quote, escape or zero */
+    while (( pos + sizeof(uint64_t) <= length )&&( ! found ))
+    {
+        const uint64_t word = json_token_reader_private_load_word( &(start[pos]) );
+        found = json_token_reader_private_word_has_byte( word, JSON_CONSTANTS_CHAR_END_STRING )
+            || json_token_reader_private_word_has_byte( word, JSON_CONSTANTS_CHAR_ESC )
+            || json_token_reader_private_word_has_byte( word, '\0' );
+        if ( ! found )
         {
-            universal_buffer_input_stream_read_next( &((*this_).in_stream) );
-            if ( current == JSON_CONSTANTS_CHAR_NL )
+            pos += sizeof(uint64_t);
+        }
+    }
+    /* find the exact position */
+    while (( pos < length )
+        && ( start[pos] != JSON_CONSTANTS_CHAR_END_STRING )
+        && ( start[pos] != JSON_CONSTANTS_CHAR_ESC )
+        && ( start[pos] != '\0' ))
+    {
+        pos ++;
+    }
+    return pos;
+}
+
+static inline void json_token_reader_private_skip_whitespace ( json_token_reader_t *this_ )
+{
+    bool ws_end_reached = false;
+    while ( ! ws_end_reached )
+    {
+        size_t buffered_len;
+        const char *const buffered = universal_buffer_input_stream_peek_buffered( &((*this_).in_stream), &buffered_len );
+        size_t pos = 0;
+        while (( pos < buffered_len )&&( ! ws_end_reached ))
+        {
+            if (( pos + sizeof(uint64_t) <= buffered_len )
+                && ( json_token_reader_private_load_word( &(buffered[pos]) ) == JSON_TOKEN_READER_PRIVATE_BYTES( ' ' ) ))
+            {
+                /* a run of 8 spaces, e.g. indentation */
+                pos += sizeof(uint64_t);
+            }
+            else
             {
-                (*this_).input_line ++;
+                const char current = buffered[pos];
+                if ( JSON_CONSTANTS_CHAR_NL == current )
+                {
+                    (*this_).input_line ++;
+                    pos ++;
+                }
+                else if (( JSON_CONSTANTS_CHAR_CR == current )
+                    || ( JSON_CONSTANTS_CHAR_TAB == current )
+                    || ( JSON_CONSTANTS_CHAR_SPACE == current ))
+                {
+                    pos ++;
+                }
+                else
+                {
+                    ws_end_reached = true;
+                }
             }
         }
+        universal_buffer_input_stream_skip_buffered( &((*this_).in_stream), pos );
+
+        if ( ! ws_end_reached )
+        {
+            /* all buffered bytes are whitespace, refill the buffer */
+            ws_end_reached = ( '\0' == universal_buffer_input_stream_peek_next( &((*this_).in_stream) ) );
+        }
     }
 }
 
@@ -63,62 +149,81 @@ static inline u8_error_t json_token_reader_private_read_string ( json_token_read
     assert( out_stream != NULL );
     u8_error_t result = U8_ERROR_NONE;
     bool str_end_reached = false;
-    char esc_incomplete = false;
-    char out_buffer[64];
-    size_t ouf_buf_len = 0;
     while ( ! str_end_reached )
     {
-        char current = universal_buffer_input_stream_peek_next( &((*this_).in_stream) );
-        if ( '\0' == current )
-        {
-            str_end_reached = true;
-            result = U8_ERROR_LEXICAL_STRUCTURE;
-        }
-        else if (( JSON_CONSTANTS_CHAR_END_STRING == current )&&( ! esc_incomplete ))
-        {
-            str_end_reached = true;
-        }
-        else
+        size_t buffered_len;
+        const char *const buffered = universal_buffer_input_stream_peek_buffered( &((*this_).in_stream), &buffered_len );
+        const size_t run_len = json_token_reader_private_find_string_end( buffered, buffered_len );
+        if ( run_len != 0 )
         {
-            assert( ouf_buf_len < sizeof(out_buffer) );
-            out_buffer[ouf_buf_len] = universal_buffer_input_stream_read_next( &((*this_).in_stream) );
-            ouf_buf_len ++;
-        }
-        if (( JSON_CONSTANTS_CHAR_ESC == current ) && ( ! esc_incomplete ))
-        {
-            esc_incomplete = true;
+            /* copy all bytes up to the next quote, escape or end of buffer at once */
+            const int err = universal_output_stream_write( out_stream, buffered, run_len );
+            universal_buffer_input_stream_skip_buffered( &((*this_).in_stream), run_len );
+            if ( err != 0 )
+            {
+                U8_TRACE_INFO( "could not write all data to output stream in json_token_reader_private_read_string." );
+                result = U8_ERROR_STRING_BUFFER_EXCEEDED;
+            }
         }
         else
         {
-            esc_incomplete = false;
-            if ( ouf_buf_len >= (sizeof(out_buffer)-sizeof(char)) )
+            /* the buffer is empty or starts with a quote, escape or zero */
+            const char current = universal_buffer_input_stream_peek_next( &((*this_).in_stream) );
+            if ( '\0' == current )
+            {
+                str_end_reached = true;
+                result = U8_ERROR_LEXICAL_STRUCTURE;
+            }
+            else if ( JSON_CONSTANTS_CHAR_END_STRING == current )
+            {
+                str_end_reached = true;
+            }
+            else if ( JSON_CONSTANTS_CHAR_ESC == current )
             {
-                /* only if not in the middle of an escape character, write to out_stream */
-                const int err
-                    = universal_output_stream_write( out_stream, &out_buffer, ouf_buf_len );
-                ouf_buf_len = 0;
+                /* an escape sequence is written in one piece so that it can be decoded by out_stream */
+                char esc_seq[2];
+                size_t esc_len = 1;
+                esc_seq[0] = universal_buffer_input_stream_read_next( &((*this_).in_stream) );
+                esc_seq[1] = universal_buffer_input_stream_peek_next( &((*this_).in_stream) );
+                if ( '\0' == esc_seq[1] )
+                {
+                    str_end_reached = true;
+                    result = U8_ERROR_LEXICAL_STRUCTURE;
+                }
+                else
+                {
+                    universal_buffer_input_stream_read_next( &((*this_).in_stream) );
+                    esc_len = 2;
+                }
+                const int err = universal_output_stream_write( out_stream, &esc_seq, esc_len );
                 if ( err != 0 )
                 {
-                    U8_TRACE_INFO( "could not write all data to output stream in json_token_reader_private_read_string." );
+                    U8_TRACE_INFO( "could not write all data to output stream in json_token_reader_private_read_string" );
                     result = U8_ERROR_STRING_BUFFER_EXCEEDED;
                 }
             }
-        }
-    }
-    {
-        const int err2
-            = universal_output_stream_write( out_stream, &out_buffer, ouf_buf_len );
-        ouf_buf_len = 0;
-        if ( err2 != 0 )
-        {
-            U8_TRACE_INFO( "could not write all data to output stream in json_token_reader_private_read_string" );
-            result = U8_ERROR_STRING_BUFFER_EXCEEDED;
+            /* else: peek_next has refilled an empty buffer */
         }
     }
 
     return result;
 }
 
+static inline bool json_token_reader_private_find_plain_string ( json_token_reader_t *this_, utf8stringview_t *out_view )
+{
+    assert( out_view != NULL );
+    size_t buffered_len;
+    const char *const buffered = universal_buffer_input_stream_peek_buffered( &((*this_).in_stream), &buffered_len );
+    const size_t len = json_token_reader_private_find_string_end( buffered, buffered_len );
+    bool plain = (( len < buffered_len )&&( JSON_CONSTANTS_CHAR_END_STRING == buffered[len] ));
+    if ( plain )
+    {
+        /* a string that ends at quotes does not end in the middle of a code point, unless the input is invalid */
+        plain = ( UTF8ERROR_SUCCESS == utf8stringview_init( out_view, buffered, len ) );
+    }
+    return plain;
+}
+
 static inline u8_error_t json_token_reader_private_parse_integer ( json_token_reader_t *this_, int64_t *out_int )
 {
     assert( out_int != NULL );
@@ -154,12 +259,23 @@ static inline u8_error_t json_token_reader_private_parse_integer ( json_token_re
         bool int_end_reached = false;
         while ( ! int_end_reached )
         {
-            char current = universal_buffer_input_stream_peek_next( &((*this_).in_stream) );
-            if (( '0' <= current )&&( current <= '9'))
+            /* convert the digits that are already buffered */
+            size_t buffered_len;
+            const char *const buffered = universal_buffer_input_stream_peek_buffered( &((*this_).in_stream), &buffered_len );
+            size_t pos = 0;
+            while (( pos < buffered_len )&&( '0' <= buffered[pos] )&&( buffered[pos] <= '9' ))
+            {
+                result = (result*10)+((int) (buffered[pos]-'0'));
+                pos ++;
+            }
+            universal_buffer_input_stream_skip_buffered( &((*this_).in_stream), pos );
+            has_digits = has_digits || ( pos != 0 );
+
+            if ( pos == buffered_len )
             {
-                has_digits = true;
-                universal_buffer_input_stream_read_next( &((*this_).in_stream) );
-                result = (result*10)+((int) (current-'0'));
+                /* refill the buffer and check if the number continues */
+                const char current = universal_buffer_input_stream_peek_next( &((*this_).in_stream) );
+                int_end_reached = ! (( '0' <= current )&&( current <= '9'));
             }
             else
             {
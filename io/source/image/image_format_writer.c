@@ -14,7 +14,8 @@
 void image_format_writer_init( image_format_writer_t *this_,
                                data_database_reader_t *db_reader,
                                data_visible_set_t *input_data,
-                               data_profile_part_t *profile )
+                               data_profile_part_t *profile,
+                               layout_cache_t *layout_cache )
 {
     U8_TRACE_BEGIN();
     assert( NULL != db_reader );
@@ -26,6 +27,7 @@ void image_format_writer_init( image_format_writer_t *this_,
     (*this_).profile = profile;
     geometry_rectangle_init( &((*this_).bounds), 0.0, 0.0, 1680.0, 1260.0 );
     pencil_diagram_maker_init( &((*this_).painter), input_data, profile );
+    pencil_diagram_maker_set_layout_cache( &((*this_).painter), layout_cache );
 
     U8_TRACE_END();
 }
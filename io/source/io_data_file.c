@@ -19,6 +19,7 @@
 
 static const char *IO_DATA_FILE_TEMP_EXT = ".tmp-cfu";
 static const char *IO_DATA_FILE_JSON_EXT = ".cfuJ";
+static const char *IO_DATA_FILE_DELTA_EXT = ".tmp-cfuJ";
 
 void io_data_file_init ( io_data_file_t *this_ )
 {
@@ -38,6 +39,7 @@ void io_data_file_init ( io_data_file_t *this_ )
     (*this_).auto_writeback_to_json = false;
     (*this_).delete_db_when_finished = false;
     (*this_).sync_revision = DATA_REVISION_VOID;
+    io_export_span_list_init( &((*this_).json_spans) );
 
     U8_TRACE_END();
 }
@@ -46,6 +48,8 @@ void io_data_file_destroy ( io_data_file_t *this_ )
 {
     U8_TRACE_BEGIN();
 
+    io_export_span_list_destroy( &((*this_).json_spans) );
+
     ctrl_controller_destroy( &((*this_).controller) );
     data_database_destroy( &((*this_).database) );
 
@@ -63,6 +67,7 @@ u8_error_t io_data_file_open ( io_data_file_t *this_,
     assert( io_stat != NULL );
     assert( out_err_info != NULL );
     u8_error_info_init_void( out_err_info );
+    io_export_span_list_invalidate( &((*this_).json_spans) );  /* the positions in a previous file are not known */
     const utf8stringview_t req_file_path = UTF8STRINGVIEW_STR(requested_file_path);
     utf8stringview_t req_file_parent;
     utf8stringview_t req_file_name;
@@ -125,6 +130,8 @@ u8_error_t io_data_file_open ( io_data_file_t *this_,
             }
             else
             {
+                /* the json file is the durable copy, the temp db does not need to sync every commit */
+                data_database_set_profile( &((*this_).database), DATA_DATABASE_PROFILE_WORKING_COPY );
                 err |= data_database_open( &((*this_).database), utf8stringbuf_get_string( &((*this_).db_file_name) ) );
             }
 
@@ -150,6 +157,8 @@ u8_error_t io_data_file_open ( io_data_file_t *this_,
             U8_TRACE_INFO_STR( "json_file_name:", utf8stringbuf_get_string( &((*this_).json_file_name) ) );
             U8_TRACE_INFO_STR( "db_file_name:  ", utf8stringbuf_get_string( &((*this_).db_file_name) ) );
 
+            /* the json file is the durable copy, the temp db does not need to sync every commit */
+            data_database_set_profile( &((*this_).database), DATA_DATABASE_PROFILE_WORKING_COPY );
             err |= data_database_open( &((*this_).database), utf8stringbuf_get_string( &((*this_).db_file_name) ) );
 
             /* temp file is not in sync by definition */
@@ -204,6 +213,8 @@ u8_error_t io_data_file_open ( io_data_file_t *this_,
             }
             else
             {
+                /* the json file is the durable copy, the temp db does not need to sync every commit */
+                data_database_set_profile( &((*this_).database), DATA_DATABASE_PROFILE_WORKING_COPY );
                 err |= data_database_open( &((*this_).database), utf8stringbuf_get_string( &((*this_).db_file_name) ) );
                 if ( err != U8_ERROR_NONE )
                 {
@@ -292,6 +303,8 @@ u8_error_t io_data_file_open ( io_data_file_t *this_,
             U8_TRACE_INFO_STR( "json_file_name:", utf8stringbuf_get_string( &((*this_).json_file_name) ) );
             U8_TRACE_INFO_STR( "db_file_name:  ", utf8stringbuf_get_string( &((*this_).db_file_name) ) );
 
+            /* the sqlite file is the only copy of the data until it is converted to json */
+            data_database_set_profile( &((*this_).database), DATA_DATABASE_PROFILE_DURABLE );
             err |= data_database_open( &((*this_).database), utf8stringbuf_get_string( &((*this_).db_file_name) ) );
 
             /* old file is not in sync to force conversion to json */
@@ -325,6 +338,7 @@ u8_error_t io_data_file_close ( io_data_file_t *this_ )
 
     (*this_).auto_writeback_to_json = false;
     (*this_).delete_db_when_finished = false;
+    io_export_span_list_invalidate( &((*this_).json_spans) );
 
     U8_TRACE_END_ERR( result );
     return result;
@@ -436,6 +450,7 @@ u8_error_t io_data_file_trace_stats ( io_data_file_t *this_ )
     U8_TRACE_BEGIN();
 
     U8_TRACE_INFO_STR( "io_data_file_t:", utf8stringbuf_get_string( &((*this_).json_file_name) ) );
+    U8_TRACE_INFO_STR( "database file:", utf8stringbuf_get_string( &((*this_).db_file_name) ) );
 
     const u8_error_t result = data_database_trace_stats( &((*this_).database) );
 
@@ -538,7 +553,6 @@ u8_error_t io_data_file_private_export( io_data_file_t *this_, const char *dst_f
     u8_error_t export_err = U8_ERROR_NONE;
 
     U8_TRACE_INFO_STR( "exporting file:", dst_file );
-    const char *document_filename = io_data_file_get_filename_const( this_ );
     if ( io_data_file_is_open( this_ ) )
     {
         static data_database_reader_t db_reader;
@@ -548,7 +562,30 @@ u8_error_t io_data_file_private_export( io_data_file_t *this_, const char *dst_f
         {
             data_stat_t export_stat;
             data_stat_init ( &export_stat );
-            export_err = io_exporter_export_document_file( &exporter, IO_FILE_FORMAT_JSON, "title", document_filename, &export_stat );
+
+            /* if the previous file is known and unmodified, write only the changed objects: */
+            const bool delta_possible
+                = io_export_span_list_is_complete( &((*this_).json_spans) )
+                && ( (*this_).sync_revision != DATA_REVISION_VOID )
+                && ( ! io_data_file_is_externally_modified( this_ ) );
+            const u8_error_t delta_err
+                = delta_possible
+                ? io_data_file_private_export_delta( this_, dst_file, &db_reader, &exporter, &export_stat )
+                : U8_ERROR_INVALID_REQUEST;
+
+            if ( delta_err != U8_ERROR_NONE )
+            {
+                U8_TRACE_INFO( "exporting complete file" );
+                data_stat_reset_series( &export_stat, DATA_STAT_SERIES_EXPORTED );
+                export_err = io_exporter_export_json_file( &exporter,
+                                                           "title",
+                                                           dst_file,
+                                                           NULL,
+                                                           NULL,
+                                                           &((*this_).json_spans),
+                                                           &export_stat
+                                                         );
+            }
             data_stat_trace( &export_stat );
             data_stat_destroy ( &export_stat );
         }
@@ -565,6 +602,72 @@ u8_error_t io_data_file_private_export( io_data_file_t *this_, const char *dst_f
 }
 
 
+u8_error_t io_data_file_private_export_delta ( io_data_file_t *this_,
+                                               const char *dst_file,
+                                               data_database_reader_t *db_reader,
+                                               io_exporter_t *exporter,
+                                               data_stat_t *io_export_stat )
+{
+    U8_TRACE_BEGIN();
+    assert( dst_file != NULL );
+    assert( db_reader != NULL );
+    assert( exporter != NULL );
+    assert( io_export_stat != NULL );
+    u8_error_t export_err = U8_ERROR_NONE;
+
+    /* determine the objects that changed since the last export */
+    static io_export_dirty_set_t dirty_set;  /* static: too large for the stack */
+    io_export_dirty_set_init( &dirty_set );
+    {
+        ctrl_undo_redo_iterator_t changes;
+        ctrl_undo_redo_iterator_init_empty( &changes );
+        export_err |= ctrl_controller_get_changes_since( &((*this_).controller), (*this_).sync_revision, &changes );
+        if ( export_err == U8_ERROR_NONE )
+        {
+            export_err |= io_export_dirty_set_add_changes( &dirty_set, &changes, db_reader );
+        }
+        ctrl_undo_redo_iterator_destroy( &changes );
+    }
+
+    /* write the delta to a temporary file, then replace the previous file */
+    if ( export_err == U8_ERROR_NONE )
+    {
+        char delta_file_buffer[DATA_DATABASE_MAX_FILEPATH];
+        utf8stringbuf_t delta_file = UTF8STRINGBUF( delta_file_buffer );
+        export_err |= utf8stringbuf_copy_str( &delta_file, dst_file );
+        export_err |= utf8stringbuf_append_str( &delta_file, IO_DATA_FILE_DELTA_EXT );
+        if ( export_err == U8_ERROR_NONE )
+        {
+            export_err |= io_exporter_export_json_file( exporter,
+                                                        "title",
+                                                        utf8stringbuf_get_string( &delta_file ),
+                                                        dst_file,
+                                                        &dirty_set,
+                                                        &((*this_).json_spans),
+                                                        io_export_stat
+                                                      );
+            if ( export_err == U8_ERROR_NONE )
+            {
+                export_err |= u8dir_file_rename( utf8stringbuf_get_string( &delta_file ), dst_file );
+            }
+            if ( export_err != U8_ERROR_NONE )
+            {
+                u8dir_file_remove( utf8stringbuf_get_string( &delta_file ) );  /* ignore possible errors */
+                io_export_span_list_invalidate( &((*this_).json_spans) );
+            }
+        }
+    }
+    io_export_dirty_set_destroy( &dirty_set );
+
+    if ( export_err != U8_ERROR_NONE )
+    {
+        U8_LOG_EVENT( "delta export not possible, exporting the complete file." );
+    }
+
+    U8_TRACE_END_ERR( export_err );
+    return export_err;
+}
+
 /*
 Copyright 2022-2026 Andreas Warnke
 
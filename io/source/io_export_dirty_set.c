@@ -0,0 +1,331 @@
+/* File: io_export_dirty_set.c; Copyright and License: see below */
+
+#include "io_export_dirty_set.h"
+#include "ctrl_undo_redo_entry.h"
+#include "storage/data_diagramelement_iterator.h"
+#include "storage/data_relationship_iterator.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <assert.h>
+
+void io_export_dirty_set_init ( io_export_dirty_set_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    data_small_set_init( &((*this_).views) );
+    data_small_set_init( &((*this_).nodes) );
+    data_small_set_init( &((*this_).edges) );
+    data_small_set_init( &((*this_).temp_children) );
+
+    U8_TRACE_END();
+}
+
+void io_export_dirty_set_destroy ( io_export_dirty_set_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    data_small_set_destroy( &((*this_).views) );
+    data_small_set_destroy( &((*this_).nodes) );
+    data_small_set_destroy( &((*this_).edges) );
+    data_small_set_destroy( &((*this_).temp_children) );
+
+    U8_TRACE_END();
+}
+
+u8_error_t io_export_dirty_set_add_changes ( io_export_dirty_set_t *this_,
+                                             ctrl_undo_redo_iterator_t *changes,
+                                             data_database_reader_t *db_reader )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != changes );
+    assert( NULL != db_reader );
+    u8_error_t result = U8_ERROR_NONE;
+
+    while ( ctrl_undo_redo_iterator_has_next( changes ) && ( result == U8_ERROR_NONE ) )
+    {
+        const ctrl_undo_redo_entry_t *const entry = ctrl_undo_redo_iterator_next( changes );
+        switch ( ctrl_undo_redo_entry_get_action_type( entry ) )
+        {
+            case CTRL_UNDO_REDO_ENTRY_TYPE_BOUNDARY:
+            {
+                /* nothing to do */
+            }
+            break;
+
+            case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_DIAGRAM:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAM:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_CLASSIFIER:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_CLASSIFIER:
+            {
+                /* the sequence of top-level objects changes */
+                result = U8_ERROR_INVALID_REQUEST;
+            }
+            break;
+
+            case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_DIAGRAM:
+            {
+                result |= io_export_dirty_set_private_add_diagram( this_,
+                                                                   ctrl_undo_redo_entry_get_diagram_before_action_const( entry ),
+                                                                   ctrl_undo_redo_entry_get_diagram_after_action_const( entry ),
+                                                                   db_reader
+                                                                 );
+            }
+            break;
+
+            case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_DIAGRAMELEMENT:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_DIAGRAMELEMENT:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_DIAGRAMELEMENT:
+            {
+                const data_diagramelement_t *const before = ctrl_undo_redo_entry_get_diagramelement_before_action_const( entry );
+                const data_diagramelement_t *const after = ctrl_undo_redo_entry_get_diagramelement_after_action_const( entry );
+                if ( data_diagramelement_is_valid( before ) )
+                {
+                    result |= io_export_dirty_set_private_add_row( this_,
+                                                                   &((*this_).views),
+                                                                   DATA_TABLE_DIAGRAM,
+                                                                   data_diagramelement_get_diagram_row( before )
+                                                                 );
+                }
+                if ( data_diagramelement_is_valid( after ) )
+                {
+                    result |= io_export_dirty_set_private_add_row( this_,
+                                                                   &((*this_).views),
+                                                                   DATA_TABLE_DIAGRAM,
+                                                                   data_diagramelement_get_diagram_row( after )
+                                                                 );
+                }
+            }
+            break;
+
+            case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_CLASSIFIER:
+            {
+                const data_classifier_t *const after = ctrl_undo_redo_entry_get_classifier_after_action_const( entry );
+                result |= io_export_dirty_set_private_add_classifier( this_, data_classifier_get_row( after ), db_reader );
+            }
+            break;
+
+            case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_FEATURE:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_FEATURE:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_FEATURE:
+            {
+                /* features are written as part of their classifier, */
+                /* diagramelements and relationships reference features by uuid and key */
+                const data_feature_t *const before = ctrl_undo_redo_entry_get_feature_before_action_const( entry );
+                const data_feature_t *const after = ctrl_undo_redo_entry_get_feature_after_action_const( entry );
+                const data_feature_t *const feature = data_feature_is_valid( after ) ? after : before;
+                result |= io_export_dirty_set_private_add_classifier( this_, data_feature_get_classifier_row( feature ), db_reader );
+            }
+            break;
+
+            case CTRL_UNDO_REDO_ENTRY_TYPE_DELETE_RELATIONSHIP:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_UPDATE_RELATIONSHIP:  /* no break */
+            case CTRL_UNDO_REDO_ENTRY_TYPE_CREATE_RELATIONSHIP:
+            {
+                /* relationships are written in the group of their source classifier */
+                const data_relationship_t *const before = ctrl_undo_redo_entry_get_relationship_before_action_const( entry );
+                const data_relationship_t *const after = ctrl_undo_redo_entry_get_relationship_after_action_const( entry );
+                if ( data_relationship_is_valid( before ) )
+                {
+                    result |= io_export_dirty_set_private_add_row( this_,
+                                                                   &((*this_).edges),
+                                                                   DATA_TABLE_CLASSIFIER,
+                                                                   data_relationship_get_from_classifier_row( before )
+                                                                 );
+                }
+                if ( data_relationship_is_valid( after ) )
+                {
+                    result |= io_export_dirty_set_private_add_row( this_,
+                                                                   &((*this_).edges),
+                                                                   DATA_TABLE_CLASSIFIER,
+                                                                   data_relationship_get_from_classifier_row( after )
+                                                                 );
+                }
+            }
+            break;
+
+            default:
+            {
+                U8_LOG_ERROR( "unexpected ctrl_undo_redo_entry_type_t" );
+                result = U8_ERROR_INVALID_REQUEST;
+            }
+            break;
+        }
+    }
+
+    U8_TRACE_INFO_INT( "dirty views:", data_small_set_get_count( &((*this_).views) ) );
+    U8_TRACE_INFO_INT( "dirty nodes:", data_small_set_get_count( &((*this_).nodes) ) );
+    U8_TRACE_INFO_INT( "dirty edges:", data_small_set_get_count( &((*this_).edges) ) );
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+bool io_export_dirty_set_contains ( const io_export_dirty_set_t *this_, json_writer_pass_t pass, data_row_t row )
+{
+    bool result;
+    switch ( pass )
+    {
+        case JSON_WRITER_PASS_VIEWS:
+        {
+            result = data_small_set_contains_row( &((*this_).views), DATA_TABLE_DIAGRAM, row );
+        }
+        break;
+
+        case JSON_WRITER_PASS_NODES:
+        {
+            result = data_small_set_contains_row( &((*this_).nodes), DATA_TABLE_CLASSIFIER, row );
+        }
+        break;
+
+        case JSON_WRITER_PASS_EDGES:
+        {
+            result = data_small_set_contains_row( &((*this_).edges), DATA_TABLE_CLASSIFIER, row );
+        }
+        break;
+
+        default:
+        {
+            assert( false );
+            result = true;
+        }
+        break;
+    }
+    return result;
+}
+
+u8_error_t io_export_dirty_set_private_add_classifier ( io_export_dirty_set_t *this_,
+                                                        data_row_t classifier_row,
+                                                        data_database_reader_t *db_reader )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != db_reader );
+    u8_error_t result = U8_ERROR_NONE;
+
+    result |= io_export_dirty_set_private_add_row( this_, &((*this_).nodes), DATA_TABLE_CLASSIFIER, classifier_row );
+    result |= io_export_dirty_set_private_add_row( this_, &((*this_).edges), DATA_TABLE_CLASSIFIER, classifier_row );
+
+    /* diagramelements contain the classifier name and the uuid of the classifier or its lifeline */
+    {
+        data_diagramelement_iterator_t diagramelement_iterator;
+        data_diagramelement_iterator_init_empty( &diagramelement_iterator );
+        result |= data_database_reader_get_diagramelements_by_classifier_id( db_reader,
+                                                                             classifier_row,
+                                                                             &diagramelement_iterator
+                                                                           );
+        while (( result == U8_ERROR_NONE ) && data_diagramelement_iterator_has_next( &diagramelement_iterator ))
+        {
+            result |= data_diagramelement_iterator_next( &diagramelement_iterator, &((*this_).temp_diagramelement) );
+            result |= io_export_dirty_set_private_add_row( this_,
+                                                           &((*this_).views),
+                                                           DATA_TABLE_DIAGRAM,
+                                                           data_diagramelement_get_diagram_row( &((*this_).temp_diagramelement) )
+                                                         );
+            data_diagramelement_destroy( &((*this_).temp_diagramelement) );
+        }
+        result |= data_diagramelement_iterator_destroy( &diagramelement_iterator );
+    }
+
+    /* relationships contain the names and uuids of the classifiers and features at both ends */
+    {
+        data_relationship_iterator_t relationship_iterator;
+        data_relationship_iterator_init_empty( &relationship_iterator );
+        result |= data_database_reader_get_relationships_by_classifier_id( db_reader,
+                                                                           classifier_row,
+                                                                           &relationship_iterator
+                                                                         );
+        while (( result == U8_ERROR_NONE ) && data_relationship_iterator_has_next( &relationship_iterator ))
+        {
+            result |= data_relationship_iterator_next( &relationship_iterator, &((*this_).temp_relationship) );
+            result |= io_export_dirty_set_private_add_row( this_,
+                                                           &((*this_).edges),
+                                                           DATA_TABLE_CLASSIFIER,
+                                                           data_relationship_get_from_classifier_row( &((*this_).temp_relationship) )
+                                                         );
+            data_relationship_destroy( &((*this_).temp_relationship) );
+        }
+        result |= data_relationship_iterator_destroy( &relationship_iterator );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t io_export_dirty_set_private_add_diagram ( io_export_dirty_set_t *this_,
+                                                     const data_diagram_t *before_action,
+                                                     const data_diagram_t *after_action,
+                                                     data_database_reader_t *db_reader )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != before_action );
+    assert( NULL != after_action );
+    assert( NULL != db_reader );
+    u8_error_t result = U8_ERROR_NONE;
+
+    const bool moved
+        = ( data_diagram_get_parent_row( before_action ) != data_diagram_get_parent_row( after_action ) )
+        || ( data_diagram_get_list_order( before_action ) != data_diagram_get_list_order( after_action ) );
+    if ( moved )
+    {
+        /* the diagrams are written in tree order */
+        result = U8_ERROR_INVALID_REQUEST;
+    }
+    else
+    {
+        const data_row_t diagram_row = data_diagram_get_row( after_action );
+        result |= io_export_dirty_set_private_add_row( this_, &((*this_).views), DATA_TABLE_DIAGRAM, diagram_row );
+
+        /* child diagrams contain the name and uuid of their parent */
+        const bool renamed
+            = ( ! utf8string_equals_str( data_diagram_get_name_const( before_action ), data_diagram_get_name_const( after_action ) ) )
+            || ( ! utf8string_equals_str( data_diagram_get_uuid_const( before_action ), data_diagram_get_uuid_const( after_action ) ) );
+        if ( renamed )
+        {
+            data_small_set_clear( &((*this_).temp_children) );
+            result |= data_database_reader_get_diagram_ids_by_parent_id( db_reader, diagram_row, &((*this_).temp_children) );
+            const uint32_t child_count = data_small_set_get_count( &((*this_).temp_children) );
+            for ( uint32_t pos = 0; ( pos < child_count ) && ( result == U8_ERROR_NONE ); pos ++ )
+            {
+                const data_id_t child_id = data_small_set_get_id( &((*this_).temp_children), pos );
+                result |= io_export_dirty_set_private_add_row( this_, &((*this_).views), DATA_TABLE_DIAGRAM, data_id_get_row( &child_id ) );
+            }
+        }
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t io_export_dirty_set_private_add_row ( io_export_dirty_set_t *this_,
+                                                 data_small_set_t *the_set,
+                                                 data_table_t table,
+                                                 data_row_t row )
+{
+    assert( NULL != the_set );
+    u8_error_t result = U8_ERROR_NONE;
+
+    const u8_error_t add_err = data_small_set_add_row( the_set, table, row );
+    if ( add_err == U8_ERROR_ARRAY_BUFFER_EXCEEDED )
+    {
+        U8_TRACE_INFO( "too many changes for writing only a delta." );
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+    /* U8_ERROR_DUPLICATE_ID is fine, the row is already marked */
+
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -11,7 +11,8 @@
 void io_export_flat_traversal_init( io_export_flat_traversal_t *this_,
                                      data_database_reader_t *db_reader,
                                      data_stat_t *io_export_stat,
-                                     io_element_writer_t *out_element_writer )
+                                     io_element_writer_t *out_element_writer,
+                                     io_progress_t *progress )
 {
     U8_TRACE_BEGIN();
     assert( NULL != db_reader );
@@ -21,6 +22,7 @@ void io_export_flat_traversal_init( io_export_flat_traversal_t *this_,
     (*this_).db_reader = db_reader;
     (*this_).export_stat = io_export_stat;
     (*this_).element_writer = out_element_writer;
+    (*this_).progress = progress;
 
     U8_TRACE_END();
 }
@@ -32,6 +34,7 @@ void io_export_flat_traversal_destroy( io_export_flat_traversal_t *this_ )
     (*this_).db_reader = NULL;
     (*this_).export_stat = NULL;
     (*this_).element_writer = NULL;
+    (*this_).progress = NULL;
 
     U8_TRACE_END();
 }
@@ -63,7 +66,11 @@ u8_error_t io_export_flat_traversal_iterate_classifiers( io_export_flat_traversa
                 }
                 else
                 {
-                    write_err |= io_export_flat_traversal_private_traverse_classifier( this_, &((*this_).temp_classifier) );
+                    write_err |= io_export_flat_traversal_traverse_classifier( this_, &((*this_).temp_classifier) );
+                    if ( NULL != (*this_).progress )
+                    {
+                        write_err |= io_progress_tick( (*this_).progress );
+                    }
 
                     data_classifier_destroy( &((*this_).temp_classifier) );
                 }
@@ -80,8 +87,8 @@ u8_error_t io_export_flat_traversal_iterate_classifiers( io_export_flat_traversa
     return write_err;
 }
 
-u8_error_t io_export_flat_traversal_private_traverse_classifier( io_export_flat_traversal_t *this_,
-                                                                 const data_classifier_t *classifier )
+u8_error_t io_export_flat_traversal_traverse_classifier( io_export_flat_traversal_t *this_,
+                                                         const data_classifier_t *classifier )
 {
     U8_TRACE_BEGIN();
     assert( NULL != classifier );
@@ -0,0 +1,258 @@
+/* File: io_export_image_pool.c; Copyright and License: see below */
+
+#include "io_export_image_pool.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <stdbool.h>
+#include <assert.h>
+
+void io_export_image_pool_init ( io_export_image_pool_t *this_, uint32_t worker_count )
+{
+    U8_TRACE_BEGIN();
+
+    const uint32_t requested = ( worker_count == 0 ) ? g_get_num_processors() : worker_count;
+    (*this_).worker_count = ( requested > IO_EXPORT_IMAGE_POOL_MAX_WORKERS ) ? IO_EXPORT_IMAGE_POOL_MAX_WORKERS : requested;
+    if ( (*this_).worker_count == 0 )
+    {
+        (*this_).worker_count = 1;
+    }
+    U8_TRACE_INFO_INT( "worker_count:", (*this_).worker_count );
+
+    for ( uint32_t index = 0; index < IO_EXPORT_IMAGE_POOL_MAX_WORKERS; index ++ )
+    {
+        io_export_image_worker_t *const worker = &((*this_).worker[index]);
+        (*worker).pool = this_;
+        (*worker).thread = NULL;
+        (*worker).filename = utf8stringbuf_new( (*worker).filename_buf, sizeof((*worker).filename_buf) );
+        utf8stringbuf_clear( &((*worker).filename) );
+        (*worker).result = U8_ERROR_NONE;
+    }
+
+    g_mutex_init( &((*this_).lock) );
+    io_export_image_pool_clear_jobs( this_ );
+    (*this_).image_formats = IO_FILE_FORMAT_NONE;
+    (*this_).target_folder = NULL;
+
+    U8_TRACE_END();
+}
+
+void io_export_image_pool_destroy ( io_export_image_pool_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    g_mutex_clear( &((*this_).lock) );
+    io_export_image_pool_clear_jobs( this_ );
+    (*this_).target_folder = NULL;
+
+    U8_TRACE_END();
+}
+
+u8_error_t io_export_image_pool_run ( io_export_image_pool_t *this_,
+                                      const char *db_file_path,
+                                      io_file_format_t image_formats,
+                                      const char *target_folder,
+                                      data_stat_t *io_export_stat )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != db_file_path );
+    assert( NULL != target_folder );
+    assert( NULL != io_export_stat );
+    assert( ( image_formats & ~( IO_FILE_FORMAT_SVG | IO_FILE_FORMAT_PDF | IO_FILE_FORMAT_PS | IO_FILE_FORMAT_PNG ) ) == 0 );
+    u8_error_t result = U8_ERROR_NONE;
+
+    (*this_).next_job = 0;
+    (*this_).image_formats = image_formats;
+    (*this_).target_folder = target_folder;
+
+    /* no more workers than jobs */
+    const uint32_t worker_count
+        = ( (*this_).job_count < (*this_).worker_count ) ? (*this_).job_count : (*this_).worker_count;
+    U8_LOG_EVENT_INT( "exporting diagram images, number of threads:", worker_count );
+
+    /* open the connections in this thread: database open and close notify listeners and are not thread-safe */
+    /* pin all snapshots before any thread starts so that all workers read the same state */
+    uint32_t opened_count = 0;
+    bool open_failed = false;
+    for ( uint32_t index = 0; ( index < worker_count ) && ( ! open_failed ); index ++ )
+    {
+        io_export_image_worker_t *const worker = &((*this_).worker[index]);
+        u8_error_t open_err = data_database_snapshot_init( &((*worker).snapshot), db_file_path );
+        if ( open_err == U8_ERROR_NONE )
+        {
+            open_err |= data_database_snapshot_pin( &((*worker).snapshot) );
+        }
+        if ( open_err == U8_ERROR_NONE )
+        {
+            data_stat_init( &((*worker).stat) );
+            layout_cache_init( &((*worker).layout_cache) );
+            (*worker).result = U8_ERROR_NONE;
+            opened_count ++;
+        }
+        else
+        {
+            U8_LOG_WARNING_HEX( "worker could not open a snapshot of the database:", open_err );
+            data_database_snapshot_destroy( &((*worker).snapshot) );
+            open_failed = true;
+        }
+    }
+
+    /* start the threads, the workers with opened connections are the first opened_count ones */
+    uint32_t started_count = 0;
+    for ( uint32_t index = 0; index < opened_count; index ++ )
+    {
+        io_export_image_worker_t *const worker = &((*this_).worker[index]);
+        (*worker).thread = g_thread_try_new( "cfu_export", &io_export_image_pool_private_work, worker, NULL );
+        if ( NULL != (*worker).thread )
+        {
+            started_count ++;
+        }
+    }
+    if (( started_count == 0 )&&( opened_count > 0 ))
+    {
+        /* no thread could be started: work in this thread */
+        U8_LOG_WARNING( "no export thread could be started." );
+        io_export_image_pool_private_work( &((*this_).worker[0]) );
+    }
+
+    /* wait for the threads, collect the results, close the connections */
+    for ( uint32_t index = 0; index < opened_count; index ++ )
+    {
+        io_export_image_worker_t *const worker = &((*this_).worker[index]);
+        if ( NULL != (*worker).thread )
+        {
+            g_thread_join( (*worker).thread );
+            (*worker).thread = NULL;
+        }
+        result |= (*worker).result;
+        data_stat_add( io_export_stat, &((*worker).stat) );
+        data_stat_destroy( &((*worker).stat) );
+        layout_cache_destroy( &((*worker).layout_cache) );
+
+        result |= data_database_snapshot_destroy( &((*worker).snapshot) );
+    }
+
+    if ( opened_count == 0 )
+    {
+        result = U8_ERROR_NO_DB;
+    }
+
+    (*this_).target_folder = NULL;
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+gpointer io_export_image_pool_private_work ( gpointer data )
+{
+    U8_TRACE_BEGIN();
+    io_export_image_worker_t *const this_ = data;
+    assert( NULL != this_ );
+    io_export_image_pool_t *const pool = (*this_).pool;
+
+    for ( const io_export_image_job_t *job = io_export_image_pool_private_fetch_job( pool );
+          job != NULL;
+          job = io_export_image_pool_private_fetch_job( pool ) )
+    {
+        if ( ( (*pool).image_formats & IO_FILE_FORMAT_SVG ) != 0 )
+        {
+            (*this_).result |= io_export_image_pool_private_render( this_, job, IO_FILE_FORMAT_SVG );
+        }
+        if ( ( (*pool).image_formats & IO_FILE_FORMAT_PDF ) != 0 )
+        {
+            (*this_).result |= io_export_image_pool_private_render( this_, job, IO_FILE_FORMAT_PDF );
+        }
+        if ( ( (*pool).image_formats & IO_FILE_FORMAT_PS ) != 0 )
+        {
+            (*this_).result |= io_export_image_pool_private_render( this_, job, IO_FILE_FORMAT_PS );
+        }
+        if ( ( (*pool).image_formats & IO_FILE_FORMAT_PNG ) != 0 )
+        {
+            (*this_).result |= io_export_image_pool_private_render( this_, job, IO_FILE_FORMAT_PNG );
+        }
+    }
+
+    U8_TRACE_END();
+    return NULL;
+}
+
+const io_export_image_job_t *io_export_image_pool_private_fetch_job ( io_export_image_pool_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    const io_export_image_job_t *result = NULL;
+
+    g_mutex_lock( &((*this_).lock) );
+    if ( (*this_).next_job < (*this_).job_count )
+    {
+        result = &((*this_).job[(*this_).next_job]);
+        (*this_).next_job ++;
+    }
+    g_mutex_unlock( &((*this_).lock) );
+
+    U8_TRACE_END();
+    return result;
+}
+
+u8_error_t io_export_image_pool_private_render ( io_export_image_worker_t *this_,
+                                                 const io_export_image_job_t *job,
+                                                 io_file_format_t image_format )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != job );
+    u8_error_t result = U8_ERROR_NONE;
+
+    /* determine filename */
+    utf8stringbuf_copy_str( &((*this_).filename), (*(*this_).pool).target_folder );
+    utf8stringbuf_append_str( &((*this_).filename), "/" );
+    utf8stringbuf_append_str( &((*this_).filename), (*job).basename );
+    if ( IO_FILE_FORMAT_SVG == image_format )
+    {
+        utf8stringbuf_append_str( &((*this_).filename), ".svg" );
+    }
+    else if ( IO_FILE_FORMAT_PNG == image_format )
+    {
+        utf8stringbuf_append_str( &((*this_).filename), ".png" );
+    }
+    else if ( IO_FILE_FORMAT_PDF == image_format )
+    {
+        utf8stringbuf_append_str( &((*this_).filename), ".pdf" );
+    }
+    else /* IO_FILE_FORMAT_PS */
+    {
+        utf8stringbuf_append_str( &((*this_).filename), ".ps" );
+    }
+    U8_LOG_EVENT_STR( "exporting diagram to file:", utf8stringbuf_get_string( &((*this_).filename) ) );
+
+    image_format_writer_init( &((*this_).image_writer),
+                              data_database_snapshot_get_reader_ptr( &((*this_).snapshot) ),
+                              &((*this_).input_data),
+                              &((*this_).profile),
+                              &((*this_).layout_cache)
+                            );
+    result |= image_format_writer_render_diagram_to_file( &((*this_).image_writer),
+                                                          (*job).diagram_id,
+                                                          image_format,
+                                                          utf8stringbuf_get_string( &((*this_).filename) ),
+                                                          &((*this_).stat)
+                                                        );
+    image_format_writer_destroy( &((*this_).image_writer) );
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -12,7 +12,8 @@ void io_export_model_traversal_init( io_export_model_traversal_t *this_,
                                      data_database_reader_t *db_reader,
                                      data_visible_set_t *input_data,
                                      data_stat_t *io_export_stat,
-                                     io_element_writer_t *out_element_writer )
+                                     io_element_writer_t *out_element_writer,
+                                     io_progress_t *progress )
 {
     U8_TRACE_BEGIN();
     assert( NULL != db_reader );
@@ -22,6 +23,7 @@ void io_export_model_traversal_init( io_export_model_traversal_t *this_,
     (*this_).db_reader = db_reader;
     (*this_).export_stat = io_export_stat;
     (*this_).element_writer = out_element_writer;
+    (*this_).progress = progress;
 
     universal_array_list_init ( &((*this_).written_id_set),
                                 sizeof((*this_).written_id_set_buf)/sizeof(data_id_t),
@@ -54,6 +56,7 @@ void io_export_model_traversal_destroy( io_export_model_traversal_t *this_ )
     (*this_).db_reader = NULL;
     (*this_).export_stat = NULL;
     (*this_).element_writer = NULL;
+    (*this_).progress = NULL;
 
     U8_TRACE_END();
 }
@@ -95,6 +98,10 @@ u8_error_t io_export_model_traversal_walk_model_nodes ( io_export_model_traversa
                                                                               classifier_id,
                                                                               0 /* initial recursion_depth */
                                                                             );
+                    if ( NULL != (*this_).progress )
+                    {
+                        write_err |= io_progress_tick( (*this_).progress );
+                    }
                 }
             }
         }
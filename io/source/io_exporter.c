@@ -26,10 +26,16 @@ void io_exporter_init ( io_exporter_t *this_,
     assert( NULL != db_reader );
 
     (*this_).db_reader = db_reader;
+    (*this_).image_pool = NULL;
+    (*this_).progress = NULL;
 
     (*this_).temp_filename = utf8stringbuf_new( (*this_).temp_filename_buf, sizeof((*this_).temp_filename_buf) );
     utf8stringbuf_clear( &((*this_).temp_filename) );
 
+    (*this_).temp_spans = NULL;
+    (*this_).temp_dirty = NULL;
+    (*this_).temp_json_file = NULL;
+
     U8_TRACE_END();
 }
 
@@ -38,6 +44,26 @@ void io_exporter_destroy( io_exporter_t *this_ )
     U8_TRACE_BEGIN();
 
     (*this_).db_reader = NULL;
+    (*this_).image_pool = NULL;
+    (*this_).progress = NULL;
+
+    U8_TRACE_END();
+}
+
+void io_exporter_set_image_pool( io_exporter_t *this_, io_export_image_pool_t *image_pool )
+{
+    U8_TRACE_BEGIN();
+
+    (*this_).image_pool = image_pool;
+
+    U8_TRACE_END();
+}
+
+void io_exporter_set_progress( io_exporter_t *this_, io_progress_t *progress )
+{
+    U8_TRACE_BEGIN();
+
+    (*this_).progress = progress;
 
     U8_TRACE_END();
 }
@@ -62,37 +88,39 @@ u8_error_t io_exporter_export_files( io_exporter_t *this_,
 
     if ( NULL != target_folder )
     {
+        io_file_format_t image_formats = IO_FILE_FORMAT_NONE;
         if ( ( export_type & IO_FILE_FORMAT_SVG ) != 0 )
         {
-            export_err |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_SVG, target_folder, io_export_stat );
+            image_formats |= IO_FILE_FORMAT_SVG;
         }
-
         if ( ( export_type & ( IO_FILE_FORMAT_PDF | IO_FILE_FORMAT_DOCBOOK ) ) != 0 )
         {
-            export_err |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_PDF, target_folder, io_export_stat );
+            image_formats |= IO_FILE_FORMAT_PDF;
         }
-
         if ( ( export_type & IO_FILE_FORMAT_PS ) != 0 )
         {
-            export_err |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_PS, target_folder, io_export_stat );
+            image_formats |= IO_FILE_FORMAT_PS;
         }
-
         if ( ( export_type & ( IO_FILE_FORMAT_PNG | IO_FILE_FORMAT_DOCBOOK | IO_FILE_FORMAT_HTML ) ) != 0 )
         {
-            export_err |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_PNG, target_folder, io_export_stat );
+            image_formats |= IO_FILE_FORMAT_PNG;
+        }
+        if (( image_formats != IO_FILE_FORMAT_NONE )&&( io_exporter_private_begin_phase( this_, "images" ) ))
+        {
+            export_err |= io_exporter_private_export_all_image_files( this_, image_formats, target_folder, io_export_stat );
         }
 
-        if ( ( export_type & IO_FILE_FORMAT_TXT ) != 0 )
+        if (( ( export_type & IO_FILE_FORMAT_TXT ) != 0 )&&( io_exporter_private_begin_phase( this_, "txt" ) ))
         {
             export_err |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_TXT, target_folder, io_export_stat );
         }
 
-        if ( ( export_type & IO_FILE_FORMAT_DOCBOOK ) != 0 )
+        if (( ( export_type & IO_FILE_FORMAT_DOCBOOK ) != 0 )&&( io_exporter_private_begin_phase( this_, "docbook" ) ))
         {
             export_err |= io_exporter_private_export_document_file( this_, IO_FILE_FORMAT_DOCBOOK, target_folder, document_file_name, io_export_stat );
         }
 
-        if ( ( export_type & IO_FILE_FORMAT_HTML ) != 0 )
+        if (( ( export_type & IO_FILE_FORMAT_HTML ) != 0 )&&( io_exporter_private_begin_phase( this_, "html" ) ))
         {
             export_err |= io_exporter_private_export_document_file( this_,
                                                                     IO_FILE_FORMAT_HTML,
@@ -108,7 +136,7 @@ u8_error_t io_exporter_export_files( io_exporter_t *this_,
                                                                   );
         }
 
-        if ( ( export_type & IO_FILE_FORMAT_JSON ) != 0 )
+        if (( ( export_type & IO_FILE_FORMAT_JSON ) != 0 )&&( io_exporter_private_begin_phase( this_, "json" ) ))
         {
             export_err |= io_exporter_private_export_document_file( this_,
                                                                     IO_FILE_FORMAT_JSON,
@@ -124,10 +152,19 @@ u8_error_t io_exporter_export_files( io_exporter_t *this_,
                                                                   );
         }
 
-        if ( ( export_type & IO_FILE_FORMAT_XMI2 ) != 0 )
+        if (( ( export_type & IO_FILE_FORMAT_XMI2 ) != 0 )&&( io_exporter_private_begin_phase( this_, "xmi" ) ))
         {
             export_err |= io_exporter_private_export_document_file( this_, IO_FILE_FORMAT_XMI2, target_folder, document_file_name, io_export_stat );
         }
+
+        if ( NULL != (*this_).progress )
+        {
+            io_progress_end_phase( (*this_).progress );
+            if ( io_progress_is_cancelled( (*this_).progress ) )
+            {
+                export_err |= U8_ERROR_CANCELLED;
+            }
+        }
     }
     else /* target_folder == NULL */
     {
@@ -184,6 +221,116 @@ u8_error_t io_exporter_private_get_filename( io_exporter_t *this_,
     return err;
 }
 
+u8_error_t io_exporter_private_export_all_image_files( io_exporter_t *this_,
+                                                       io_file_format_t image_formats,
+                                                       const char *target_folder,
+                                                       data_stat_t *io_export_stat )
+{
+    U8_TRACE_BEGIN();
+    assert ( NULL != target_folder );
+    assert ( NULL != io_export_stat );
+    u8_error_t result = U8_ERROR_NONE;
+    bool rendered = false;
+
+    /* render in parallel if the workers can open own connections to the database file */
+    const char *const db_file_path = data_database_reader_get_filename_ptr( (*this_).db_reader );
+    if (( NULL != (*this_).image_pool )&&( NULL != db_file_path ))
+    {
+        io_export_image_pool_clear_jobs( (*this_).image_pool );
+        const u8_error_t collect_err
+            = io_exporter_private_collect_image_jobs( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH );
+        if ( collect_err == U8_ERROR_NONE )
+        {
+            const u8_error_t pool_err = io_export_image_pool_run( (*this_).image_pool,
+                                                                  db_file_path,
+                                                                  image_formats,
+                                                                  target_folder,
+                                                                  io_export_stat
+                                                                );
+            if ( pool_err != U8_ERROR_NO_DB )
+            {
+                result |= pool_err;
+                result |= io_exporter_private_tick( this_ );
+                rendered = true;
+            }
+        }
+        else
+        {
+            U8_LOG_ANOMALY_HEX( "diagram images cannot be rendered in parallel:", collect_err );
+        }
+        io_export_image_pool_clear_jobs( (*this_).image_pool );
+    }
+
+    /* render one after the other */
+    if ( ! rendered )
+    {
+        if ( ( image_formats & IO_FILE_FORMAT_SVG ) != 0 )
+        {
+            result |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_SVG, target_folder, io_export_stat );
+        }
+        if ( ( image_formats & IO_FILE_FORMAT_PDF ) != 0 )
+        {
+            result |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_PDF, target_folder, io_export_stat );
+        }
+        if ( ( image_formats & IO_FILE_FORMAT_PS ) != 0 )
+        {
+            result |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_PS, target_folder, io_export_stat );
+        }
+        if ( ( image_formats & IO_FILE_FORMAT_PNG ) != 0 )
+        {
+            result |= io_exporter_private_export_image_files( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, IO_FILE_FORMAT_PNG, target_folder, io_export_stat );
+        }
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t io_exporter_private_collect_image_jobs( io_exporter_t *this_,
+                                                   data_id_t diagram_id,
+                                                   uint32_t max_recursion )
+{
+    U8_TRACE_BEGIN();
+    assert ( NULL != (*this_).image_pool );
+    const data_row_t diagram_row = data_id_get_row( &diagram_id );
+    u8_error_t result = U8_ERROR_NONE;
+
+    /* add current diagram */
+    if ( DATA_ROW_VOID != diagram_row )
+    {
+        assert( data_id_get_table( &diagram_id ) == DATA_TABLE_DIAGRAM );
+        result |= io_exporter_private_get_filename_for_diagram( this_, diagram_id, (*this_).temp_filename );
+        if ( result == U8_ERROR_NONE )
+        {
+            result |= io_export_image_pool_add_job( (*this_).image_pool,
+                                                    diagram_id,
+                                                    utf8stringbuf_get_string( &((*this_).temp_filename) )
+                                                  );
+        }
+    }
+
+    /* recursion to children */
+    if (( result == 0 )&&( max_recursion > 0 ))
+    {
+        data_small_set_t the_set;
+        data_small_set_init( &the_set );
+        result |= data_database_reader_get_diagram_ids_by_parent_id ( (*this_).db_reader, diagram_row, &the_set );
+        for ( uint32_t pos = 0; ( pos < data_small_set_get_count( &the_set ) ) && ( result == U8_ERROR_NONE ); pos ++ )
+        {
+            data_id_t probe_id;
+            probe_id = data_small_set_get_id( &the_set, pos );
+
+            result |= io_exporter_private_collect_image_jobs( this_, probe_id, max_recursion-1 );
+
+            data_id_destroy( &probe_id );
+        }
+        data_small_set_destroy( &the_set );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
 u8_error_t io_exporter_private_export_image_files( io_exporter_t *this_,
                                                    data_id_t diagram_id,
                                                    uint32_t max_recursion,
@@ -236,6 +383,7 @@ u8_error_t io_exporter_private_export_image_files( io_exporter_t *this_,
                                                  utf8stringbuf_get_string( &((*this_).temp_filename) ),
                                                  io_export_stat
                                                );
+        result |= io_exporter_private_tick( this_ );
     }
 
     /* recursion to children */
@@ -252,7 +400,8 @@ u8_error_t io_exporter_private_export_image_files( io_exporter_t *this_,
         }
         else
         {
-            for ( uint32_t pos = 0; pos < data_small_set_get_count( &the_set ); pos ++ )
+            /* other errors are collected, a cancelled progress stops the export */
+            for ( uint32_t pos = 0; ( pos < data_small_set_get_count( &the_set ) )&&( ! u8_error_contains( result, U8_ERROR_CANCELLED ) ); pos ++ )
             {
                 data_id_t probe_id;
                 probe_id = data_small_set_get_id( &the_set, pos );
@@ -291,7 +440,8 @@ u8_error_t io_exporter_export_image_file( io_exporter_t *this_,
         image_format_writer_init( &((*this_).temp_image_format_exporter ),
                                   (*this_).db_reader,
                                   &((*this_).temp_input_data),
-                                  &((*this_).temp_profile)
+                                  &((*this_).temp_profile),
+                                  NULL /* no layout cache, each diagram is layouted once per file */
                                 );
         result |= image_format_writer_render_diagram_to_file( &((*this_).temp_image_format_exporter ),
                                                               diagram_id,
@@ -305,13 +455,18 @@ u8_error_t io_exporter_export_image_file( io_exporter_t *this_,
     {
         universal_file_output_stream_t text_output;
         universal_file_output_stream_init( &text_output );
-        universal_output_stream_t *output = universal_file_output_stream_get_output_stream( &text_output );
 
         /* open file */
         result |= universal_file_output_stream_open( &text_output, file_path );
         if ( result == 0 )
         {
             u8_error_t write_err = U8_ERROR_NONE;
+            universal_buffer_output_stream_init( &((*this_).temp_buffered_output),
+                                                 &((*this_).temp_output_buf),
+                                                 sizeof((*this_).temp_output_buf),
+                                                 universal_file_output_stream_get_output_stream( &text_output )
+                                               );
+            universal_output_stream_t *output = universal_buffer_output_stream_get_output_stream( &((*this_).temp_buffered_output) );
 
             /* temporarily use the temp_model_traversal */
             /* write file */
@@ -334,6 +489,9 @@ u8_error_t io_exporter_export_image_file( io_exporter_t *this_,
             io_export_diagram_traversal_destroy( &((*this_).temp_diagram_traversal) );
             document_element_writer_destroy( &((*this_).temp_format_writer ) );
 
+            write_err |= universal_buffer_output_stream_destroy( &((*this_).temp_buffered_output) );
+            write_err |= io_exporter_private_count_file_bytes( this_, &text_output );
+
             if ( 0 != write_err )
             {
                 U8_LOG_ERROR("error writing txt.");
@@ -443,11 +601,18 @@ u8_error_t io_exporter_export_document_file( io_exporter_t *this_,
     u8_error_t export_err = U8_ERROR_NONE;
     universal_file_output_stream_t file_output;
     universal_file_output_stream_init( &file_output );
-    universal_output_stream_t *output = universal_file_output_stream_get_output_stream( &file_output );
 
     export_err |= universal_file_output_stream_open( &file_output, file_path );
     if ( export_err == 0 )
     {
+        /* collect the many small writes of the format writers to large blocks */
+        universal_buffer_output_stream_init( &((*this_).temp_buffered_output),
+                                             &((*this_).temp_output_buf),
+                                             sizeof((*this_).temp_output_buf),
+                                             universal_file_output_stream_get_output_stream( &file_output )
+                                           );
+        universal_output_stream_t *output = universal_buffer_output_stream_get_output_stream( &((*this_).temp_buffered_output) );
+
         /* write file */
         if ( IO_FILE_FORMAT_CSS == export_type )
         {
@@ -471,7 +636,8 @@ u8_error_t io_exporter_export_document_file( io_exporter_t *this_,
                                             (*this_).db_reader,
                                             &((*this_).temp_input_data),
                                             io_export_stat,
-                                            xmi_element_writer_get_element_writer( &((*this_).temp_xmi_writer) )
+                                            xmi_element_writer_get_element_writer( &((*this_).temp_xmi_writer) ),
+                                            (*this_).progress
                                           );
             /* write the document */
             export_err |= xmi_element_writer_write_header( &((*this_).temp_xmi_writer), document_title );
@@ -488,49 +654,7 @@ u8_error_t io_exporter_export_document_file( io_exporter_t *this_,
         }
         else if ( IO_FILE_FORMAT_JSON == export_type )
         {
-            json_element_writer_init( &((*this_).temp_json_writer ), io_export_stat, output );
-            export_err |= json_element_writer_write_header( &((*this_).temp_json_writer), document_title );
-
-            /* init the diagram_traversal */
-            {
-                io_export_diagram_traversal_init( &((*this_).temp_diagram_traversal),
-                                                  (*this_).db_reader,
-                                                  &((*this_).temp_input_data),
-                                                  io_export_stat,
-                                                  json_element_writer_get_element_writer( &((*this_).temp_json_writer) )
-                                                );
-                /* write the document */
-                json_element_writer_set_mode( &((*this_).temp_json_writer ), JSON_WRITER_PASS_VIEWS );
-                export_err |= json_element_writer_start_main( &((*this_).temp_json_writer), document_title );
-                export_err |= io_exporter_private_export_document_part( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, io_export_stat );
-                export_err |= json_element_writer_end_main( &((*this_).temp_json_writer) );
-
-                io_export_diagram_traversal_destroy( &((*this_).temp_diagram_traversal) );
-            }
-
-            /* init the model_traversal */
-            {
-                io_export_flat_traversal_init( &((*this_).temp_flat_traversal),
-                                               (*this_).db_reader,
-                                               io_export_stat,
-                                               json_element_writer_get_element_writer( &((*this_).temp_json_writer) )
-                                             );
-                /* write the document */
-                json_element_writer_set_mode( &((*this_).temp_json_writer ), JSON_WRITER_PASS_NODES );
-                export_err |= json_element_writer_start_main( &((*this_).temp_json_writer), document_title );
-                export_err |= io_export_flat_traversal_iterate_classifiers( &((*this_).temp_flat_traversal), false );
-                export_err |= json_element_writer_end_main( &((*this_).temp_json_writer) );
-
-                json_element_writer_set_mode( &((*this_).temp_json_writer ), JSON_WRITER_PASS_EDGES );
-                export_err |= json_element_writer_start_main( &((*this_).temp_json_writer), document_title );
-                export_err |= io_export_flat_traversal_iterate_classifiers( &((*this_).temp_flat_traversal), false );
-                export_err |= json_element_writer_end_main( &((*this_).temp_json_writer) );
-
-                io_export_flat_traversal_destroy( &((*this_).temp_flat_traversal) );
-            }
-
-            export_err |= json_element_writer_write_footer( &((*this_).temp_json_writer) );
-            json_element_writer_destroy( &((*this_).temp_json_writer ) );
+            export_err |= io_exporter_private_export_json( this_, document_title, output, io_export_stat );
         }
         else
         {
@@ -568,6 +692,10 @@ u8_error_t io_exporter_export_document_file( io_exporter_t *this_,
             document_element_writer_destroy( &((*this_).temp_format_writer ) );
         }
 
+        export_err |= universal_buffer_output_stream_destroy( &((*this_).temp_buffered_output) );
+        export_err |= io_exporter_private_count_file_bytes( this_, &file_output );
+        export_err |= io_exporter_private_tick( this_ );
+
         /* close file */
         export_err |= universal_file_output_stream_close( &file_output );
     }
@@ -578,6 +706,324 @@ u8_error_t io_exporter_export_document_file( io_exporter_t *this_,
     return export_err;
 }
 
+u8_error_t io_exporter_export_json_file( io_exporter_t *this_,
+                                         const char *document_title,
+                                         const char *file_path,
+                                         const char *previous_file_path,
+                                         const io_export_dirty_set_t *changes,
+                                         io_export_span_list_t *io_spans,
+                                         data_stat_t *io_export_stat )
+{
+    U8_TRACE_BEGIN();
+    assert ( NULL != document_title );
+    assert ( NULL != file_path );
+    assert ( ( NULL == previous_file_path ) == ( NULL == changes ) );
+    assert ( NULL != io_spans );
+    assert ( NULL != io_export_stat );
+    U8_TRACE_INFO_STR("file_path:", file_path );
+    u8_error_t export_err = U8_ERROR_NONE;
+    const bool is_delta = ( NULL != changes );
+
+    if ( is_delta && ( ! io_export_span_list_is_complete( io_spans ) ) )
+    {
+        U8_TRACE_INFO( "spans of the previous export are unknown." );
+        export_err = U8_ERROR_INVALID_REQUEST;
+    }
+    else
+    {
+        universal_file_output_stream_t file_output;
+        universal_file_output_stream_init( &file_output );
+        universal_file_input_stream_init( &((*this_).temp_previous_file) );
+
+        (*this_).temp_spans = io_spans;
+        (*this_).temp_dirty = changes;
+        (*this_).temp_json_file = &file_output;
+        (*this_).temp_previous_pos = 0;
+        (*this_).temp_span_index = 0;
+        (*this_).temp_span_start = 0;
+        if ( is_delta )
+        {
+            export_err |= universal_file_input_stream_open( &((*this_).temp_previous_file), previous_file_path );
+        }
+        else
+        {
+            io_export_span_list_clear( io_spans );
+        }
+
+        if ( export_err == U8_ERROR_NONE )
+        {
+            export_err |= universal_file_output_stream_open( &file_output, file_path );
+        }
+        if ( export_err == U8_ERROR_NONE )
+        {
+            universal_buffer_output_stream_init( &((*this_).temp_buffered_output),
+                                                 &((*this_).temp_output_buf),
+                                                 sizeof((*this_).temp_output_buf),
+                                                 universal_file_output_stream_get_output_stream( &file_output )
+                                               );
+            universal_output_stream_t *output = universal_buffer_output_stream_get_output_stream( &((*this_).temp_buffered_output) );
+            export_err |= io_exporter_private_export_json( this_, document_title, output, io_export_stat );
+            export_err |= universal_buffer_output_stream_destroy( &((*this_).temp_buffered_output) );
+            export_err |= io_exporter_private_count_file_bytes( this_, &file_output );
+
+            if ( is_delta && ( (*this_).temp_span_index != io_export_span_list_get_count( io_spans ) ) )
+            {
+                U8_LOG_EVENT( "the model contains less objects than the previous export." );
+                export_err |= U8_ERROR_INVALID_REQUEST;
+            }
+
+            /* close file */
+            export_err |= universal_file_output_stream_close( &file_output );
+        }
+
+        (*this_).temp_spans = NULL;
+        (*this_).temp_dirty = NULL;
+        (*this_).temp_json_file = NULL;
+        export_err |= universal_file_input_stream_destroy( &((*this_).temp_previous_file) );
+        export_err |= universal_file_output_stream_destroy( &file_output );
+    }
+
+    if ( export_err != U8_ERROR_NONE )
+    {
+        io_export_span_list_invalidate( io_spans );
+    }
+
+    U8_TRACE_END_ERR( export_err );
+    return export_err;
+}
+
+u8_error_t io_exporter_private_export_json( io_exporter_t *this_,
+                                            const char *document_title,
+                                            universal_output_stream_t *output,
+                                            data_stat_t *io_export_stat )
+{
+    U8_TRACE_BEGIN();
+    assert ( NULL != document_title );
+    assert ( NULL != output );
+    assert ( NULL != io_export_stat );
+    u8_error_t export_err = U8_ERROR_NONE;
+
+    json_element_writer_init( &((*this_).temp_json_writer ), io_export_stat, output );
+    export_err |= json_element_writer_write_header( &((*this_).temp_json_writer), document_title );
+
+    /* init the diagram_traversal */
+    {
+        io_export_diagram_traversal_init( &((*this_).temp_diagram_traversal),
+                                          (*this_).db_reader,
+                                          &((*this_).temp_input_data),
+                                          io_export_stat,
+                                          json_element_writer_get_element_writer( &((*this_).temp_json_writer) )
+                                        );
+        /* write the document */
+        json_element_writer_set_mode( &((*this_).temp_json_writer ), JSON_WRITER_PASS_VIEWS );
+        export_err |= json_element_writer_start_main( &((*this_).temp_json_writer), document_title );
+        export_err |= io_exporter_private_export_document_part( this_, DATA_ID_VOID, IO_EXPORTER_MAX_DIAGRAM_TREE_DEPTH, io_export_stat );
+        export_err |= json_element_writer_end_main( &((*this_).temp_json_writer) );
+
+        io_export_diagram_traversal_destroy( &((*this_).temp_diagram_traversal) );
+    }
+
+    /* init the model_traversal */
+    {
+        io_export_flat_traversal_init( &((*this_).temp_flat_traversal),
+                                       (*this_).db_reader,
+                                       io_export_stat,
+                                       json_element_writer_get_element_writer( &((*this_).temp_json_writer) ),
+                                       (*this_).progress
+                                     );
+        /* write the document */
+        json_element_writer_set_mode( &((*this_).temp_json_writer ), JSON_WRITER_PASS_NODES );
+        export_err |= json_element_writer_start_main( &((*this_).temp_json_writer), document_title );
+        export_err |= io_exporter_private_export_json_classifiers( this_, JSON_WRITER_PASS_NODES );
+        export_err |= json_element_writer_end_main( &((*this_).temp_json_writer) );
+
+        json_element_writer_set_mode( &((*this_).temp_json_writer ), JSON_WRITER_PASS_EDGES );
+        export_err |= json_element_writer_start_main( &((*this_).temp_json_writer), document_title );
+        export_err |= io_exporter_private_export_json_classifiers( this_, JSON_WRITER_PASS_EDGES );
+        export_err |= json_element_writer_end_main( &((*this_).temp_json_writer) );
+
+        io_export_flat_traversal_destroy( &((*this_).temp_flat_traversal) );
+    }
+
+    export_err |= json_element_writer_write_footer( &((*this_).temp_json_writer) );
+    json_element_writer_destroy( &((*this_).temp_json_writer ) );
+
+    U8_TRACE_END_ERR( export_err );
+    return export_err;
+}
+
+u8_error_t io_exporter_private_export_json_classifiers( io_exporter_t *this_, json_writer_pass_t pass )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t export_err = U8_ERROR_NONE;
+
+    if ( NULL == (*this_).temp_spans )
+    {
+        export_err |= io_export_flat_traversal_iterate_classifiers( &((*this_).temp_flat_traversal), false );
+    }
+    else
+    {
+        data_classifier_iterator_t classifier_iterator;
+        data_classifier_iterator_init_empty( &classifier_iterator );
+        export_err |= data_database_reader_get_all_classifiers( (*this_).db_reader, false, &classifier_iterator );
+        while( ( export_err == U8_ERROR_NONE ) && data_classifier_iterator_has_next( &classifier_iterator ) )
+        {
+            export_err |= data_classifier_iterator_next( &classifier_iterator, &((*this_).temp_classifier) );
+            if ( export_err == U8_ERROR_NONE )
+            {
+                const data_row_t classifier_row = data_classifier_get_row( &((*this_).temp_classifier) );
+                bool copied;
+                export_err |= io_exporter_private_begin_span( this_, pass, classifier_row, &copied );
+                if (( export_err == U8_ERROR_NONE )&&( ! copied ))
+                {
+                    export_err |= io_export_flat_traversal_traverse_classifier( &((*this_).temp_flat_traversal),
+                                                                                &((*this_).temp_classifier)
+                                                                              );
+                }
+                export_err |= io_exporter_private_end_span( this_, pass, classifier_row );
+                export_err |= io_exporter_private_tick( this_ );
+
+                data_classifier_destroy( &((*this_).temp_classifier) );
+            }
+        }
+        export_err |= data_classifier_iterator_destroy( &classifier_iterator );
+    }
+
+    U8_TRACE_END_ERR( export_err );
+    return export_err;
+}
+
+u8_error_t io_exporter_private_begin_span( io_exporter_t *this_,
+                                           json_writer_pass_t pass,
+                                           data_row_t row,
+                                           bool *out_copied )
+{
+    U8_TRACE_BEGIN();
+    assert ( NULL != out_copied );
+    u8_error_t export_err = U8_ERROR_NONE;
+    *out_copied = false;
+
+    if ( NULL != (*this_).temp_spans )
+    {
+        export_err |= io_exporter_private_get_json_position( this_, &((*this_).temp_span_start) );
+
+        if ( NULL != (*this_).temp_dirty )
+        {
+            /* the objects are written in the same sequence as in the previous export */
+            const uint32_t index = (*this_).temp_span_index;
+            const io_export_span_list_t *const previous = (*this_).temp_spans;
+            if (( index >= io_export_span_list_get_count( previous ) )
+                || ( pass != io_export_span_list_get_pass( previous, index ) )
+                || ( row != io_export_span_list_get_row( previous, index ) ))
+            {
+                U8_LOG_EVENT( "the model structure differs from the previous export." );
+                export_err |= U8_ERROR_INVALID_REQUEST;
+            }
+            else if ( ! io_export_dirty_set_contains( (*this_).temp_dirty, pass, row ) )
+            {
+                export_err |= io_exporter_private_copy_previous( this_,
+                                                                 io_export_span_list_get_start( previous, index ),
+                                                                 io_export_span_list_get_end( previous, index )
+                                                               );
+                *out_copied = true;
+            }
+        }
+    }
+
+    U8_TRACE_END_ERR( export_err );
+    return export_err;
+}
+
+u8_error_t io_exporter_private_end_span( io_exporter_t *this_, json_writer_pass_t pass, data_row_t row )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t export_err = U8_ERROR_NONE;
+
+    if ( NULL != (*this_).temp_spans )
+    {
+        size_t span_end;
+        export_err |= io_exporter_private_get_json_position( this_, &span_end );
+
+        if ( NULL != (*this_).temp_dirty )
+        {
+            /* replace the span of the previous export, it is not needed anymore */
+            if ( (*this_).temp_span_index < io_export_span_list_get_count( (*this_).temp_spans ) )
+            {
+                io_export_span_list_set_range( (*this_).temp_spans, (*this_).temp_span_index, (*this_).temp_span_start, span_end );
+            }
+        }
+        else
+        {
+            /* if the list is full, it is marked incomplete, but the export itself continues */
+            (void) io_export_span_list_add( (*this_).temp_spans, pass, row, (*this_).temp_span_start, span_end );
+        }
+        (*this_).temp_span_index ++;
+    }
+
+    U8_TRACE_END_ERR( export_err );
+    return export_err;
+}
+
+u8_error_t io_exporter_private_get_json_position( io_exporter_t *this_, size_t *out_position )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != out_position );
+    assert( NULL != (*this_).temp_json_file );
+
+    /* the bytes in the output buffer are not yet in the file */
+    size_t file_position = 0;
+    const u8_error_t export_err = universal_file_output_stream_get_position( (*this_).temp_json_file, &file_position );
+    *out_position = file_position + universal_buffer_output_stream_get_fill( &((*this_).temp_buffered_output) );
+
+    U8_TRACE_END_ERR( export_err );
+    return export_err;
+}
+
+u8_error_t io_exporter_private_copy_previous( io_exporter_t *this_, size_t start, size_t end )
+{
+    U8_TRACE_BEGIN();
+    assert( start <= end );
+    u8_error_t export_err = U8_ERROR_NONE;
+
+    if ( start < (*this_).temp_previous_pos )
+    {
+        U8_LOG_ERROR( "spans of the previous export are not in ascending order." );
+        export_err |= U8_ERROR_INVALID_REQUEST;
+    }
+
+    /* skip the bytes of changed objects, then copy the span */
+    while (( export_err == U8_ERROR_NONE )&&( (*this_).temp_previous_pos < end ))
+    {
+        const bool skip = ( (*this_).temp_previous_pos < start );
+        const size_t remaining = ( skip ? start : end ) - (*this_).temp_previous_pos;
+        const size_t chunk = ( remaining < sizeof((*this_).temp_copy_buf) ) ? remaining : sizeof((*this_).temp_copy_buf);
+        size_t read_len = 0;
+        export_err |= universal_file_input_stream_read( &((*this_).temp_previous_file),
+                                                        &((*this_).temp_copy_buf),
+                                                        chunk,
+                                                        &read_len
+                                                      );
+        if (( export_err == U8_ERROR_NONE )&&( read_len == 0 ))
+        {
+            export_err |= U8_ERROR_END_OF_STREAM;
+        }
+        if (( export_err == U8_ERROR_NONE )&&( ! skip ))
+        {
+            const utf8stringview_t serialized = UTF8STRINGVIEW( &((*this_).temp_copy_buf[0]), read_len );
+            export_err |= json_element_writer_write_verbatim( &((*this_).temp_json_writer), &serialized );
+        }
+        (*this_).temp_previous_pos += read_len;
+    }
+
+    if ( export_err != U8_ERROR_NONE )
+    {
+        U8_LOG_ERROR( "the previous export could not be copied." );
+    }
+
+    U8_TRACE_END_ERR( export_err );
+    return export_err;
+}
+
 u8_error_t io_exporter_private_export_document_part( io_exporter_t *this_,
                                                      data_id_t diagram_id,
                                                      uint32_t max_recursion,
@@ -598,10 +1044,17 @@ u8_error_t io_exporter_private_export_document_part( io_exporter_t *this_,
 
 
         /* write doc part */
-        export_err |= io_export_diagram_traversal_begin_and_walk_diagram( &((*this_).temp_diagram_traversal),
-                                                                          diagram_id,
-                                                                          utf8stringbuf_get_string( &((*this_).temp_filename) )
-                                                                        );
+        bool copied;
+        export_err |= io_exporter_private_begin_span( this_, JSON_WRITER_PASS_VIEWS, diagram_row, &copied );
+        if ( ! copied )
+        {
+            export_err |= io_export_diagram_traversal_begin_and_walk_diagram( &((*this_).temp_diagram_traversal),
+                                                                              diagram_id,
+                                                                              utf8stringbuf_get_string( &((*this_).temp_filename) )
+                                                                            );
+        }
+        export_err |= io_exporter_private_end_span( this_, JSON_WRITER_PASS_VIEWS, diagram_row );
+        export_err |= io_exporter_private_tick( this_ );
     }
 
     /* recursion to children */
@@ -619,7 +1072,8 @@ u8_error_t io_exporter_private_export_document_part( io_exporter_t *this_,
         else
         {
             const uint32_t child_count = data_small_set_get_count( &the_set );
-            for ( uint32_t pos = 0; pos < child_count; pos ++ )
+            /* other errors are collected, a cancelled progress stops the export */
+            for ( uint32_t pos = 0; ( pos < child_count )&&( ! u8_error_contains( export_err, U8_ERROR_CANCELLED ) ); pos ++ )
             {
                 data_id_t probe_id = data_small_set_get_id( &the_set, pos );
 
@@ -794,6 +1248,43 @@ void io_exporter_private_append_valid_chars_to_filename( io_exporter_t *this_,
     U8_TRACE_END();
 }
 
+bool io_exporter_private_begin_phase( io_exporter_t *this_, const char *phase_name )
+{
+    assert( NULL != phase_name );
+    bool proceed = true;
+
+    if ( NULL != (*this_).progress )
+    {
+        proceed = ! io_progress_is_cancelled( (*this_).progress );
+        if ( proceed )
+        {
+            io_progress_begin_phase( (*this_).progress, phase_name );
+        }
+    }
+
+    return proceed;
+}
+
+u8_error_t io_exporter_private_tick( io_exporter_t *this_ )
+{
+    return ( NULL == (*this_).progress ) ? U8_ERROR_NONE : io_progress_tick( (*this_).progress );
+}
+
+u8_error_t io_exporter_private_count_file_bytes( io_exporter_t *this_, universal_file_output_stream_t *file )
+{
+    assert( NULL != file );
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( NULL != (*this_).progress )
+    {
+        size_t file_size = 0;
+        result = universal_file_output_stream_get_position( file, &file_size );
+        io_progress_add_bytes( (*this_).progress, file_size );
+    }
+
+    return result;
+}
+
 
 /*
 Copyright 2016-2026 Andreas Warnke
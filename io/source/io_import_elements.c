@@ -29,6 +29,7 @@ void io_import_elements_init( io_import_elements_t *this_,
     (*this_).paste_to_diagram = DATA_ROW_VOID;
 
     ctrl_multi_step_changer_init( &((*this_).multi_step_changer), controller, db_reader );
+    io_import_uuid_index_init( &((*this_).uuid_index) );
 
     data_rules_init ( &((*this_).data_rules) );
 
@@ -108,6 +109,7 @@ void io_import_elements_destroy( io_import_elements_t *this_ )
     assert( NULL != (*this_).english_report );
 
     data_rules_destroy ( &((*this_).data_rules) );
+    io_import_uuid_index_destroy( &((*this_).uuid_index) );
     ctrl_multi_step_changer_destroy( &((*this_).multi_step_changer) );
     /* do not change the stats here */
 
@@ -146,12 +148,9 @@ u8_error_t io_import_elements_sync_diagram( io_import_elements_t *this_,
         = (( parent_uuid != NULL )&&( ! utf8string_equals_str( parent_uuid, "" )));
     if ( parent_uuid_specified )
     {
-        data_diagram_init_empty( &((*this_).temp_diagram ) );
+        data_row_t found_parent_row;
         const u8_error_t read_error1
-            = data_database_reader_get_diagram_by_uuid( (*this_).db_reader,
-                                                        parent_uuid,
-                                                        &((*this_).temp_diagram)
-                                                      );
+            = io_import_elements_private_find_diagram( this_, parent_uuid, &found_parent_row );
         if ( read_error1 == U8_ERROR_NOT_FOUND )
         {
             U8_TRACE_INFO_STR( "no parent found, uuid:", parent_uuid );
@@ -162,9 +161,8 @@ u8_error_t io_import_elements_sync_diagram( io_import_elements_t *this_,
         }
         else
         {
-            parent_row = data_diagram_get_row( &((*this_).temp_diagram ) );
+            parent_row = found_parent_row;
         }
-        data_diagram_destroy( &((*this_).temp_diagram ) );
     }
 
     /* update default parent diagram id */
@@ -217,6 +215,12 @@ u8_error_t io_import_elements_sync_diagram( io_import_elements_t *this_,
         {
             /* insert all consecutive elements to this new diagram */
             (*this_).paste_to_diagram = data_diagram_get_row( &((*this_).temp_diagram) );
+            io_import_elements_private_index_uuid( this_,
+                                                   data_diagram_get_uuid_const( &((*this_).temp_diagram) ),
+                                                   data_diagram_get_data_id( &((*this_).temp_diagram) ),
+                                                   DATA_ROW_VOID,
+                                                   DATA_FEATURE_TYPE_VOID
+                                                 );
             /* this new diagram is root if it is the first diagram */
             if ( (*this_).root_diagram == DATA_ROW_VOID )
             {
@@ -241,6 +245,12 @@ u8_error_t io_import_elements_sync_diagram( io_import_elements_t *this_,
 
         if ( diagram_exists )
         {
+            io_import_elements_private_index_uuid( this_,
+                                                   data_diagram_get_uuid_const( &((*this_).temp_diagram) ),
+                                                   data_diagram_get_data_id( &((*this_).temp_diagram) ),
+                                                   DATA_ROW_VOID,
+                                                   DATA_FEATURE_TYPE_VOID
+                                                 );
             if ( (*this_).step == IO_IMPORT_STEP_ADD_E_DP_F_R )
             {
                 /* if (*this_).temp_diagram is the only valid root, set parent_row to DATA_ROW_VOID */
@@ -302,6 +312,13 @@ u8_error_t io_import_elements_sync_diagram( io_import_elements_t *this_,
             }
             else
             {
+                io_import_elements_private_index_uuid( this_,
+                                                       data_diagram_get_uuid_const( &((*this_).temp_diagram) ),
+                                                       data_diagram_get_data_id( &((*this_).temp_diagram) ),
+                                                       DATA_ROW_VOID,
+                                                       DATA_FEATURE_TYPE_VOID
+                                                     );
+
                 /* this new diagram is root if it is the first root diagram, further diagrams will not be root */
                 if (( (*this_).root_diagram == DATA_ROW_VOID )&&( parent_row == DATA_ROW_VOID )
                     &&( ! parent_uuid_specified ))
@@ -347,41 +364,18 @@ u8_error_t io_import_elements_sync_diagramelement( io_import_elements_t *this_,
     {
         if ( ! utf8string_equals_str( node_uuid, "" ) )
         {
-            /* search source classifier id */
-            data_classifier_init_empty( &((*this_).temp_classifier ) );
+            /* search classifier id or feature id */
             const u8_error_t read_error1
-                = data_database_reader_get_classifier_by_uuid( (*this_).db_reader,
-                                                               node_uuid,
-                                                               &((*this_).temp_classifier)
-                                                             );
-            if ( U8_ERROR_NONE == read_error1 )
-            {
-                node_classifier_id = data_classifier_get_row( &((*this_).temp_classifier) );
-                U8_TRACE_INFO_STR( "id found for classifier:", node_uuid );
-            }
-            else
+                = io_import_elements_private_find_node( this_,
+                                                        node_uuid,
+                                                        &node_classifier_id,
+                                                        &node_feature_id,
+                                                        &node_feature_type
+                                                      );
+            if ( U8_ERROR_NONE != read_error1 )
             {
-                /* search source feature id */
-                data_feature_init_empty( &((*this_).temp_feature) );
-                const u8_error_t read_error2
-                    = data_database_reader_get_feature_by_uuid( (*this_).db_reader,
-                                                                node_uuid,
-                                                                &((*this_).temp_feature)
-                                                              );
-                if ( U8_ERROR_NONE == read_error2 )
-                {
-                    node_classifier_id = data_feature_get_classifier_row( &((*this_).temp_feature) );
-                    node_feature_id = data_feature_get_row( &((*this_).temp_feature) );
-                    node_feature_type = data_feature_get_main_type( &((*this_).temp_feature) );
-                    U8_TRACE_INFO_STR( "id found for feature:", node_uuid );
-                }
-                else
-                {
-                    U8_TRACE_INFO_STR( "diagramelement node not found", node_uuid );
-                }
-                data_feature_destroy( &((*this_).temp_feature) );
+                U8_TRACE_INFO_STR( "diagramelement node not found", node_uuid );
             }
-            data_classifier_destroy( &((*this_).temp_classifier ) );
         }
     }
 
@@ -391,12 +385,8 @@ u8_error_t io_import_elements_sync_diagramelement( io_import_elements_t *this_,
     {
         if ( ! utf8string_equals_str( diagram_uuid, "" ) )
         {
-            data_diagram_init_empty( &((*this_).temp_diagram ) );
             const u8_error_t read_error3
-                = data_database_reader_get_diagram_by_uuid( (*this_).db_reader,
-                                                            diagram_uuid,
-                                                            &((*this_).temp_diagram)
-                                                          );
+                = io_import_elements_private_find_diagram( this_, diagram_uuid, &diagram_row );
             if ( read_error3 == U8_ERROR_NOT_FOUND )
             {
                 U8_TRACE_INFO_STR( "no diagram found, uuid:", diagram_uuid );
@@ -405,11 +395,6 @@ u8_error_t io_import_elements_sync_diagramelement( io_import_elements_t *this_,
             {
                 U8_TRACE_INFO_STR( "diagram not found:", diagram_uuid );
             }
-            else
-            {
-                diagram_row = data_diagram_get_row( &((*this_).temp_diagram ) );
-            }
-            data_diagram_destroy( &((*this_).temp_diagram ) );
         }
     }
 
@@ -585,6 +570,13 @@ u8_error_t io_import_elements_sync_classifier( io_import_elements_t *this_,
 
         if ( classifier_exists )
         {
+            io_import_elements_private_index_uuid( this_,
+                                                   data_classifier_get_uuid_const( &((*this_).temp_classifier) ),
+                                                   data_classifier_get_data_id( &((*this_).temp_classifier) ),
+                                                   data_classifier_get_row( &((*this_).temp_classifier) ),
+                                                   DATA_FEATURE_TYPE_VOID
+                                                 );
+
             /* do the statistics */
             data_stat_inc_count( (*this_).stat, DATA_STAT_TABLE_CLASSIFIER, DATA_STAT_SERIES_IGNORED );
             U8_TRACE_INFO_INT( "classifier did already exist:", data_classifier_get_row( &((*this_).temp_classifier) ) );
@@ -600,6 +592,12 @@ u8_error_t io_import_elements_sync_classifier( io_import_elements_t *this_,
                                                                   );
             if ( sync_error == U8_ERROR_NONE )
             {
+                io_import_elements_private_index_uuid( this_,
+                                                       data_classifier_get_uuid_const( &((*this_).temp_classifier) ),
+                                                       data_classifier_get_data_id( &((*this_).temp_classifier) ),
+                                                       data_classifier_get_row( &((*this_).temp_classifier) ),
+                                                       DATA_FEATURE_TYPE_VOID
+                                                     );
                 data_stat_inc_count( (*this_).stat, DATA_STAT_TABLE_CLASSIFIER, DATA_STAT_SERIES_CREATED );
             }
             else
@@ -664,12 +662,15 @@ u8_error_t io_import_elements_sync_feature( io_import_elements_t *this_,
     {
         if ( ! utf8string_equals_str( classifier_uuid, "" ) )
         {
-            data_classifier_init_empty( &((*this_).temp_classifier ) );
+            data_row_t found_classifier_row;
+            data_row_t found_feature_row;
             const u8_error_t read_error1
-                = data_database_reader_get_classifier_by_uuid( (*this_).db_reader,
-                                                               classifier_uuid,
-                                                               &((*this_).temp_classifier)
-                                                             );
+                = io_import_elements_private_find_node( this_,
+                                                        classifier_uuid,
+                                                        &found_classifier_row,
+                                                        &found_feature_row,
+                                                        NULL
+                                                      );
             if ( read_error1 == U8_ERROR_NOT_FOUND )
             {
                 U8_TRACE_INFO_STR( "no classifier found, uuid:", classifier_uuid );
@@ -678,11 +679,14 @@ u8_error_t io_import_elements_sync_feature( io_import_elements_t *this_,
             {
                 U8_TRACE_INFO_STR( "parent classifier not found:", classifier_uuid );
             }
+            else if ( found_feature_row != DATA_ROW_VOID )
+            {
+                U8_TRACE_INFO_STR( "parent is not a classifier:", classifier_uuid );
+            }
             else
             {
-                classifier_row = data_classifier_get_row( &((*this_).temp_classifier ) );
+                classifier_row = found_classifier_row;
             }
-            data_classifier_destroy( &((*this_).temp_classifier ) );
         }
     }
 
@@ -766,6 +770,12 @@ u8_error_t io_import_elements_sync_feature( io_import_elements_t *this_,
                 }
                 else
                 {
+                    io_import_elements_private_index_uuid( this_,
+                                                           data_feature_get_uuid_const( &((*this_).temp_feature) ),
+                                                           data_feature_get_data_id( &((*this_).temp_feature) ),
+                                                           data_feature_get_classifier_row( &((*this_).temp_feature) ),
+                                                           data_feature_get_main_type( &((*this_).temp_feature) )
+                                                         );
                     data_stat_inc_count( (*this_).stat,
                                          is_lifeline ? DATA_STAT_TABLE_LIFELINE : DATA_STAT_TABLE_FEATURE,
                                          DATA_STAT_SERIES_CREATED
@@ -819,41 +829,18 @@ u8_error_t io_import_elements_sync_relationship( io_import_elements_t *this_,
     {
         if ( ! utf8string_equals_str( from_node_uuid, "" ) )
         {
-            /* search source classifier id */
-            data_classifier_init_empty( &((*this_).temp_classifier ) );
+            /* search src classifier id or feature id */
             const u8_error_t read_error1
-                = data_database_reader_get_classifier_by_uuid( (*this_).db_reader,
-                                                               from_node_uuid,
-                                                               &((*this_).temp_classifier)
-                                                             );
-            if ( U8_ERROR_NONE == read_error1 )
-            {
-                from_classifier_id = data_classifier_get_row( &((*this_).temp_classifier) );
-                U8_TRACE_INFO_STR( "id found for src classifier:", from_node_uuid );
-            }
-            else
+                = io_import_elements_private_find_node( this_,
+                                                        from_node_uuid,
+                                                        &from_classifier_id,
+                                                        &from_feature_id,
+                                                        &from_feature_type
+                                                      );
+            if ( U8_ERROR_NONE != read_error1 )
             {
-                /* search source feature id */
-                data_feature_init_empty( &((*this_).temp_feature) );
-                const u8_error_t read_error2
-                    = data_database_reader_get_feature_by_uuid( (*this_).db_reader,
-                                                                from_node_uuid,
-                                                                &((*this_).temp_feature)
-                                                              );
-                if ( U8_ERROR_NONE == read_error2 )
-                {
-                    from_classifier_id = data_feature_get_classifier_row( &((*this_).temp_feature) );
-                    from_feature_id = data_feature_get_row( &((*this_).temp_feature) );
-                    from_feature_type = data_feature_get_main_type( &((*this_).temp_feature) );
-                    U8_TRACE_INFO_STR( "id found for src feature:", from_node_uuid );
-                }
-                else
-                {
-                    U8_TRACE_INFO_STR( "relationship source not found", from_node_uuid );
-                }
-                data_feature_destroy( &((*this_).temp_feature) );
+                U8_TRACE_INFO_STR( "relationship source not found", from_node_uuid );
             }
-            data_classifier_destroy( &((*this_).temp_classifier ) );
         }
     }
 
@@ -865,41 +852,18 @@ u8_error_t io_import_elements_sync_relationship( io_import_elements_t *this_,
     {
         if ( ! utf8string_equals_str( to_node_uuid, "" ) )
         {
-            /* search destination classifier id */
-            data_classifier_init_empty( &((*this_).temp_classifier ) );
+            /* search dst classifier id or feature id */
             const u8_error_t read_error3
-                = data_database_reader_get_classifier_by_uuid( (*this_).db_reader,
-                                                               to_node_uuid,
-                                                               &((*this_).temp_classifier)
-                                                             );
-            if ( U8_ERROR_NONE == read_error3 )
-            {
-                to_classifier_id = data_classifier_get_row( &((*this_).temp_classifier) );
-                U8_TRACE_INFO_STR( "id found for dst classifier:", to_node_uuid );
-            }
-            else
+                = io_import_elements_private_find_node( this_,
+                                                        to_node_uuid,
+                                                        &to_classifier_id,
+                                                        &to_feature_id,
+                                                        &to_feature_type
+                                                      );
+            if ( U8_ERROR_NONE != read_error3 )
             {
-                /* search dst feature id */
-                data_feature_init_empty( &((*this_).temp_feature) );
-                const u8_error_t read_error4
-                    = data_database_reader_get_feature_by_uuid( (*this_).db_reader,
-                                                                to_node_uuid,
-                                                                &((*this_).temp_feature)
-                                                              );
-                if ( U8_ERROR_NONE == read_error4 )
-                {
-                    to_classifier_id = data_feature_get_classifier_row( &((*this_).temp_feature) );
-                    to_feature_id = data_feature_get_row( &((*this_).temp_feature) );
-                    to_feature_type = data_feature_get_main_type( &((*this_).temp_feature) );
-                    U8_TRACE_INFO_STR( "id found for src feature:", to_node_uuid );
-                }
-                else
-                {
-                    U8_TRACE_INFO_STR( "relationship destination not found", to_node_uuid );
-                }
-                data_feature_destroy( &((*this_).temp_feature) );
+                U8_TRACE_INFO_STR( "relationship destination not found", to_node_uuid );
             }
-            data_classifier_destroy( &((*this_).temp_classifier ) );
         }
     }
 
@@ -1043,6 +1007,173 @@ u8_error_t io_import_elements_sync_relationship( io_import_elements_t *this_,
     return sync_error;
 }
 
+u8_error_t io_import_elements_private_find_diagram( io_import_elements_t *this_,
+                                                    const char *diagram_uuid,
+                                                    data_row_t *out_diagram_row )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != diagram_uuid );
+    assert( NULL != out_diagram_row );
+    u8_error_t result = U8_ERROR_NONE;
+
+    /* the uuid index knows all diagrams that were created or found during this import */
+    data_id_t found_id;
+    const u8_error_t index_err
+        = io_import_uuid_index_get( &((*this_).uuid_index), diagram_uuid, &found_id, NULL, NULL );
+    if (( U8_ERROR_NONE == index_err )&&( DATA_TABLE_DIAGRAM == data_id_get_table( &found_id ) ))
+    {
+        *out_diagram_row = data_id_get_row( &found_id );
+    }
+    else
+    {
+        /* fallback: the diagram may have existed before the import */
+        data_diagram_init_empty( &((*this_).temp_diagram ) );
+        result = data_database_reader_get_diagram_by_uuid( (*this_).db_reader,
+                                                           diagram_uuid,
+                                                           &((*this_).temp_diagram)
+                                                         );
+        if ( U8_ERROR_NONE == result )
+        {
+            *out_diagram_row = data_diagram_get_row( &((*this_).temp_diagram ) );
+            io_import_elements_private_index_uuid( this_,
+                                                   diagram_uuid,
+                                                   data_diagram_get_data_id( &((*this_).temp_diagram) ),
+                                                   DATA_ROW_VOID,
+                                                   DATA_FEATURE_TYPE_VOID
+                                                 );
+        }
+        else
+        {
+            *out_diagram_row = DATA_ROW_VOID;
+        }
+        data_diagram_destroy( &((*this_).temp_diagram ) );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t io_import_elements_private_find_node( io_import_elements_t *this_,
+                                                 const char *node_uuid,
+                                                 data_row_t *out_classifier_row,
+                                                 data_row_t *out_feature_row,
+                                                 data_feature_type_t *out_feature_type )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != node_uuid );
+    assert( NULL != out_classifier_row );
+    assert( NULL != out_feature_row );
+    /* out_feature_type may be NULL */
+    u8_error_t result = U8_ERROR_NONE;
+    data_row_t classifier_row = DATA_ROW_VOID;
+    data_row_t feature_row = DATA_ROW_VOID;
+    data_feature_type_t feature_type = DATA_FEATURE_TYPE_VOID;
+
+    /* the uuid index knows all classifiers and features that were created or found during this import */
+    data_id_t found_id;
+    data_row_t found_classifier_row;
+    data_feature_type_t found_feature_type;
+    const u8_error_t index_err
+        = io_import_uuid_index_get( &((*this_).uuid_index), node_uuid, &found_id, &found_classifier_row, &found_feature_type );
+    const data_table_t found_table = data_id_get_table( &found_id );
+    if (( U8_ERROR_NONE == index_err )&&( DATA_TABLE_CLASSIFIER == found_table ))
+    {
+        classifier_row = data_id_get_row( &found_id );
+        U8_TRACE_INFO_STR( "id found in index for classifier:", node_uuid );
+    }
+    else if (( U8_ERROR_NONE == index_err )&&( DATA_TABLE_FEATURE == found_table ))
+    {
+        classifier_row = found_classifier_row;
+        feature_row = data_id_get_row( &found_id );
+        feature_type = found_feature_type;
+        U8_TRACE_INFO_STR( "id found in index for feature:", node_uuid );
+    }
+    else
+    {
+        /* fallback: search classifier id in the database */
+        data_classifier_init_empty( &((*this_).temp_classifier ) );
+        const u8_error_t read_error1
+            = data_database_reader_get_classifier_by_uuid( (*this_).db_reader,
+                                                           node_uuid,
+                                                           &((*this_).temp_classifier)
+                                                         );
+        if ( U8_ERROR_NONE == read_error1 )
+        {
+            classifier_row = data_classifier_get_row( &((*this_).temp_classifier) );
+            io_import_elements_private_index_uuid( this_,
+                                                   node_uuid,
+                                                   data_classifier_get_data_id( &((*this_).temp_classifier) ),
+                                                   classifier_row,
+                                                   DATA_FEATURE_TYPE_VOID
+                                                 );
+            U8_TRACE_INFO_STR( "id found for classifier:", node_uuid );
+        }
+        else
+        {
+            /* fallback: search feature id in the database */
+            data_feature_init_empty( &((*this_).temp_feature) );
+            const u8_error_t read_error2
+                = data_database_reader_get_feature_by_uuid( (*this_).db_reader,
+                                                            node_uuid,
+                                                            &((*this_).temp_feature)
+                                                          );
+            if ( U8_ERROR_NONE == read_error2 )
+            {
+                classifier_row = data_feature_get_classifier_row( &((*this_).temp_feature) );
+                feature_row = data_feature_get_row( &((*this_).temp_feature) );
+                feature_type = data_feature_get_main_type( &((*this_).temp_feature) );
+                io_import_elements_private_index_uuid( this_,
+                                                       node_uuid,
+                                                       data_feature_get_data_id( &((*this_).temp_feature) ),
+                                                       classifier_row,
+                                                       feature_type
+                                                     );
+                U8_TRACE_INFO_STR( "id found for feature:", node_uuid );
+            }
+            else
+            {
+                result = read_error2;
+            }
+            data_feature_destroy( &((*this_).temp_feature) );
+        }
+        data_classifier_destroy( &((*this_).temp_classifier ) );
+    }
+
+    *out_classifier_row = classifier_row;
+    *out_feature_row = feature_row;
+    if ( NULL != out_feature_type )
+    {
+        *out_feature_type = feature_type;
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+void io_import_elements_private_index_uuid( io_import_elements_t *this_,
+                                            const char *uuid,
+                                            data_id_t id,
+                                            data_row_t classifier_row,
+                                            data_feature_type_t feature_type )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != uuid );
+
+    const u8_error_t index_err
+        = io_import_uuid_index_add( &((*this_).uuid_index), uuid, id, classifier_row, feature_type );
+    if ( U8_ERROR_ARRAY_BUFFER_EXCEEDED == index_err )
+    {
+        /* not an error: lookups of this uuid query the database, the index logged a warning */
+        U8_TRACE_INFO_STR( "uuid index cannot grow, not indexed:", uuid );
+    }
+    else if ( U8_ERROR_NONE != index_err )
+    {
+        U8_TRACE_INFO_STR( "uuid not indexed:", uuid );
+    }
+
+    U8_TRACE_END();
+}
+
 void io_import_elements_private_report_id_differs( io_import_elements_t *this_, data_id_t req_id, data_id_t act_id )
 {
     U8_TRACE_BEGIN();
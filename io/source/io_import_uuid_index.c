@@ -0,0 +1,251 @@
+/* File: io_import_uuid_index.c; Copyright and License: see below */
+
+#include "io_import_uuid_index.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+void io_import_uuid_index_init ( io_import_uuid_index_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    (*this_).count = 0;
+    (*this_).slot_count = 0;
+    (*this_).slots = NULL;
+    (*this_).overflow_logged = false;
+
+    U8_TRACE_END();
+}
+
+void io_import_uuid_index_reinit ( io_import_uuid_index_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    io_import_uuid_index_destroy( this_ );
+    io_import_uuid_index_init( this_ );
+
+    U8_TRACE_END();
+}
+
+void io_import_uuid_index_destroy ( io_import_uuid_index_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    U8_TRACE_INFO_INT( "uuid index entries:", (*this_).count );
+    free( (*this_).slots );
+    (*this_).slots = NULL;
+    (*this_).slot_count = 0;
+    (*this_).count = 0;
+
+    U8_TRACE_END();
+}
+
+u8_error_t io_import_uuid_index_add ( io_import_uuid_index_t *this_,
+                                      const char *uuid,
+                                      data_id_t id,
+                                      data_row_t classifier_row,
+                                      data_feature_type_t feature_type )
+{
+    assert( NULL != uuid );
+    u8_error_t result = U8_ERROR_NONE;
+
+    const size_t uuid_len = strlen( uuid );
+    if (( uuid_len == 0 )||( uuid_len >= DATA_UUID_STRING_SIZE ))
+    {
+        result = U8_ERROR_VALUE_OUT_OF_RANGE;
+    }
+    else
+    {
+        bool found = false;
+        uint32_t slot = 0;
+        if ( (*this_).slot_count != 0 )
+        {
+            slot = io_import_uuid_index_private_find_slot( this_, uuid, &found );
+        }
+        const bool is_full
+            = ( ( (uint64_t)((*this_).count) + 1 ) * 100 > (uint64_t)((*this_).slot_count) * IO_IMPORT_UUID_INDEX_FILL_PERCENT );
+        if (( ! found )&&( is_full ))
+        {
+            result = io_import_uuid_index_private_grow( this_ );
+            if ( result == U8_ERROR_NONE )
+            {
+                slot = io_import_uuid_index_private_find_slot( this_, uuid, &found );
+                assert( ! found );
+            }
+        }
+
+        if ( result == U8_ERROR_NONE )
+        {
+            io_import_uuid_index_slot_t *const entry = &((*this_).slots[slot]);
+            if ( ! found )
+            {
+                memcpy( &((*entry).uuid[0]), uuid, uuid_len + 1 );
+                (*this_).count ++;
+            }
+            (*entry).id = id;
+            (*entry).classifier_row = classifier_row;
+            (*entry).feature_type = feature_type;
+        }
+    }
+
+    return result;
+}
+
+u8_error_t io_import_uuid_index_get ( const io_import_uuid_index_t *this_,
+                                      const char *uuid,
+                                      data_id_t *out_id,
+                                      data_row_t *out_classifier_row,
+                                      data_feature_type_t *out_feature_type )
+{
+    assert( NULL != uuid );
+    assert( NULL != out_id );
+    u8_error_t result = U8_ERROR_NONE;
+
+    bool found = false;
+    uint32_t slot = 0;
+    if (( uuid[0] != '\0' )&&( (*this_).slot_count != 0 ))
+    {
+        slot = io_import_uuid_index_private_find_slot( this_, uuid, &found );
+    }
+
+    if ( found )
+    {
+        const io_import_uuid_index_slot_t *const entry = &((*this_).slots[slot]);
+        *out_id = (*entry).id;
+        if ( NULL != out_classifier_row )
+        {
+            *out_classifier_row = (*entry).classifier_row;
+        }
+        if ( NULL != out_feature_type )
+        {
+            *out_feature_type = (*entry).feature_type;
+        }
+    }
+    else
+    {
+        *out_id = DATA_ID_VOID;
+        if ( NULL != out_classifier_row )
+        {
+            *out_classifier_row = DATA_ROW_VOID;
+        }
+        if ( NULL != out_feature_type )
+        {
+            *out_feature_type = DATA_FEATURE_TYPE_VOID;
+        }
+        result = U8_ERROR_NOT_FOUND;
+    }
+
+    return result;
+}
+
+uint32_t io_import_uuid_index_get_count ( const io_import_uuid_index_t *this_ )
+{
+    return (*this_).count;
+}
+
+u8_error_t io_import_uuid_index_private_grow ( io_import_uuid_index_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result = U8_ERROR_NONE;
+
+    const uint32_t old_slot_count = (*this_).slot_count;
+    io_import_uuid_index_slot_t *const old_slots = (*this_).slots;
+    const uint32_t new_slot_count
+        = ( old_slot_count == 0 ) ? IO_IMPORT_UUID_INDEX_MIN_SLOTS : ( old_slot_count * 2 );
+    io_import_uuid_index_slot_t *const new_slots
+        = ( new_slot_count > old_slot_count )
+        ? calloc( new_slot_count, sizeof(io_import_uuid_index_slot_t) )
+        : NULL;
+
+    if ( NULL == new_slots )
+    {
+        if ( ! (*this_).overflow_logged )
+        {
+            U8_LOG_WARNING_INT( "uuid index cannot grow, further uuids are searched in the database. entries:", (*this_).count );
+            (*this_).overflow_logged = true;
+        }
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+    else
+    {
+        /* calloc initialized all uuids to the empty string */
+        (*this_).slots = new_slots;
+        (*this_).slot_count = new_slot_count;
+        for ( uint32_t old_slot = 0; old_slot < old_slot_count; old_slot ++ )
+        {
+            const io_import_uuid_index_slot_t *const entry = &(old_slots[old_slot]);
+            if ( (*entry).uuid[0] != '\0' )
+            {
+                bool found;
+                const uint32_t new_slot = io_import_uuid_index_private_find_slot( this_, &((*entry).uuid[0]), &found );
+                assert( ! found );
+                new_slots[new_slot] = *entry;
+            }
+        }
+        free( old_slots );
+        U8_TRACE_INFO_INT( "uuid index slots:", new_slot_count );
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+uint32_t io_import_uuid_index_private_hash ( const io_import_uuid_index_t *this_, const char *uuid )
+{
+    assert( NULL != uuid );
+    assert( (*this_).slot_count != 0 );
+    /* FNV-1a hash, the uuid characters are well distributed anyhow */
+    uint32_t hash = 2166136261u;
+    for ( const char *pos = uuid; (*pos) != '\0'; pos ++ )
+    {
+        hash ^= (uint8_t)(*pos);
+        hash *= 16777619u;
+    }
+    return hash & ( (*this_).slot_count - 1 );
+}
+
+uint32_t io_import_uuid_index_private_find_slot ( const io_import_uuid_index_t *this_, const char *uuid, bool *out_found )
+{
+    assert( NULL != uuid );
+    assert( NULL != out_found );
+    assert( NULL != (*this_).slots );
+    /* there is always at least one empty slot because the index grows before it is filled more than IO_IMPORT_UUID_INDEX_FILL_PERCENT */
+    assert( (*this_).count < (*this_).slot_count );
+
+    const uint32_t slot_mask = (*this_).slot_count - 1;
+    uint32_t slot = io_import_uuid_index_private_hash( this_, uuid );
+    bool found = false;
+    while (( ! found )&&( (*this_).slots[slot].uuid[0] != '\0' ))
+    {
+        if ( 0 == strncmp( &((*this_).slots[slot].uuid[0]), uuid, DATA_UUID_STRING_SIZE ) )
+        {
+            found = true;
+        }
+        else
+        {
+            /* linear probing */
+            slot = ( slot + 1 ) & slot_mask;
+        }
+    }
+
+    *out_found = found;
+    return slot;
+}
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -3,6 +3,7 @@
 #include "io_importer.h"
 #include "json/json_element_reader.h"
 #include "u8stream/universal_file_input_stream.h"
+#include "u8stream/universal_mmap_input_stream.h"
 #include "u8stream/universal_memory_input_stream.h"
 #include "u8stream/universal_null_output_stream.h"
 #include "u8/u8_error.h"
@@ -22,6 +23,7 @@ void io_importer_init ( io_importer_t *this_,
 
     (*this_).db_reader = db_reader;
     (*this_).controller = controller;
+    (*this_).progress = NULL;
 
     U8_TRACE_END();
 }
@@ -34,6 +36,16 @@ void io_importer_destroy ( io_importer_t *this_ )
 
     (*this_).db_reader = NULL;
     (*this_).controller = NULL;
+    (*this_).progress = NULL;
+
+    U8_TRACE_END();
+}
+
+void io_importer_set_progress ( io_importer_t *this_, io_progress_t *progress )
+{
+    U8_TRACE_BEGIN();
+
+    (*this_).progress = progress;
 
     U8_TRACE_END();
 }
@@ -62,7 +74,7 @@ u8_error_t io_importer_import_clipboard( io_importer_t *this_,
                                        io_stat,
                                        &out_writer
                                      );
-    json_importer_init( &((*this_).temp_json_importer), &((*this_).temp_elements_importer) );
+    json_importer_init( &((*this_).temp_json_importer), &((*this_).temp_elements_importer), NULL );
 
     universal_memory_input_stream_t in_mem_stream;
     universal_memory_input_stream_init( &in_mem_stream, json_text, strlen(json_text) );
@@ -100,21 +112,39 @@ u8_error_t io_importer_import_file( io_importer_t *this_,
     u8_error_info_init_void( out_err_info );
     u8_error_t parse_error = U8_ERROR_NONE;
 
-    /* open file */
-    universal_file_input_stream_t in_file;
-    universal_file_input_stream_init( &in_file );
-    parse_error |= universal_file_input_stream_open( &in_file, import_file_path );
-
-    /* import from stream */
-    if ( parse_error == U8_ERROR_NONE )
+    /* map file to memory, the json reader then reads it in place */
+    universal_mmap_input_stream_t in_mapped_file;
+    universal_mmap_input_stream_init( &in_mapped_file );
+    const u8_error_t map_error = universal_mmap_input_stream_open( &in_mapped_file, import_file_path );
+    if ( map_error == U8_ERROR_NONE )
     {
-        universal_input_stream_t *const in_stream = universal_file_input_stream_get_input_stream( &in_file );
+        /* import from stream */
+        universal_input_stream_t *const in_stream = universal_mmap_input_stream_get_input_stream( &in_mapped_file );
         parse_error = io_importer_import_stream( this_, import_mode, in_stream, io_stat, out_err_info, out_english_report );
-    }
 
-    /* close file */
-    parse_error |= universal_file_input_stream_close( &in_file );
-    parse_error |= universal_file_input_stream_destroy( &in_file );
+        /* unmap file */
+        parse_error |= universal_mmap_input_stream_close( &in_mapped_file );
+    }
+    else
+    {
+        /* fallback: open file */
+        U8_TRACE_INFO( "file cannot be mapped to memory, reading it instead." );
+        universal_file_input_stream_t in_file;
+        universal_file_input_stream_init( &in_file );
+        parse_error |= universal_file_input_stream_open( &in_file, import_file_path );
+
+        /* import from stream */
+        if ( parse_error == U8_ERROR_NONE )
+        {
+            universal_input_stream_t *const in_stream = universal_file_input_stream_get_input_stream( &in_file );
+            parse_error = io_importer_import_stream( this_, import_mode, in_stream, io_stat, out_err_info, out_english_report );
+        }
+
+        /* close file */
+        parse_error |= universal_file_input_stream_close( &in_file );
+        parse_error |= universal_file_input_stream_destroy( &in_file );
+    }
+    parse_error |= universal_mmap_input_stream_destroy( &in_mapped_file );
 
     /* after importing a file, reset the undo redo list */
     ctrl_controller_reset_undo_redo_list( (*this_).controller );
@@ -144,7 +174,7 @@ u8_error_t io_importer_import_stream( io_importer_t *this_,
                              io_stat,
                              out_english_report
                            );
-    json_importer_init( &((*this_).temp_json_importer), &((*this_).temp_elements_importer) );
+    json_importer_init( &((*this_).temp_json_importer), &((*this_).temp_elements_importer), (*this_).progress );
 
     /* check json structure */
     if ( parse_error == U8_ERROR_NONE )
@@ -153,6 +183,10 @@ u8_error_t io_importer_import_stream( io_importer_t *this_,
         static const char *const PASS_CHECK_TITLE
             = "PASS: Check that the file structure is valid\n      ";
         utf8stream_writer_write_str( out_english_report, PASS_CHECK_TITLE );
+        if ( NULL != (*this_).progress )
+        {
+            io_progress_begin_phase( (*this_).progress, "check" );
+        }
 
         io_import_elements_set_mode( &((*this_).temp_elements_importer), IO_IMPORT_MODE_CHECK, IO_IMPORT_STEP_CHECK );
         parse_error = json_importer_import_stream( &((*this_).temp_json_importer),
@@ -169,8 +203,9 @@ u8_error_t io_importer_import_stream( io_importer_t *this_,
         parse_error |= universal_input_stream_reset( in_stream );
     }
 
-    /* start an outer transaction to speed up the creation of objects */
-    parse_error |= ctrl_controller_transaction_begin( (*this_).controller );
+    /* start an outer transaction to speed up the creation of objects, */
+    /* reuse prepared statements to create the many new records */
+    parse_error |= ctrl_controller_bulk_transaction_begin( (*this_).controller );
 
     /* import: create elements */
     if (( import_mode == IO_IMPORT_MODE_PASTE )&&( parse_error == U8_ERROR_NONE ))
@@ -179,6 +214,10 @@ u8_error_t io_importer_import_stream( io_importer_t *this_,
         static const char *const PASS_CREATE_ALL_TITLE
             = "PASS: Create diagrams, classifiers, features and relationships\n      ";
         utf8stream_writer_write_str( out_english_report, PASS_CREATE_ALL_TITLE );
+        if ( NULL != (*this_).progress )
+        {
+            io_progress_begin_phase( (*this_).progress, "create" );
+        }
 
         io_import_elements_set_mode( &((*this_).temp_elements_importer), IO_IMPORT_MODE_PASTE, IO_IMPORT_STEP_CREATE_D_C_F_R );
         parse_error = json_importer_import_stream( &((*this_).temp_json_importer),
@@ -194,6 +233,10 @@ u8_error_t io_importer_import_stream( io_importer_t *this_,
         static const char *const PASS_CREATE_TITLE
             = "PASS: Create diagrams, classifiers and lifelines\n      ";
         utf8stream_writer_write_str( out_english_report, PASS_CREATE_TITLE );
+        if ( NULL != (*this_).progress )
+        {
+            io_progress_begin_phase( (*this_).progress, "create" );
+        }
 
         io_import_elements_set_mode( &((*this_).temp_elements_importer), IO_IMPORT_MODE_IMPORT, IO_IMPORT_STEP_CREATE_D_C_L );
         parse_error = json_importer_import_stream( &((*this_).temp_json_importer),
@@ -217,6 +260,10 @@ u8_error_t io_importer_import_stream( io_importer_t *this_,
         static const char *const PASS_LINK_TITLE
             = "PASS: Link diagrams to parents, classifiers to diagrams, create features and relationships\n      ";
         utf8stream_writer_write_str( out_english_report, PASS_LINK_TITLE );
+        if ( NULL != (*this_).progress )
+        {
+            io_progress_begin_phase( (*this_).progress, "link" );
+        }
 
         io_import_elements_set_mode( &((*this_).temp_elements_importer), IO_IMPORT_MODE_IMPORT, IO_IMPORT_STEP_ADD_E_DP_F_R );
         parse_error = json_importer_import_stream( &((*this_).temp_json_importer),
@@ -228,7 +275,11 @@ u8_error_t io_importer_import_stream( io_importer_t *this_,
     }
 
     /* commit the outer transaction */
-    parse_error |= ctrl_controller_transaction_commit( (*this_).controller );
+    parse_error |= ctrl_controller_bulk_transaction_commit( (*this_).controller );
+    if ( NULL != (*this_).progress )
+    {
+        io_progress_end_phase( (*this_).progress );
+    }
 
     json_importer_destroy( &((*this_).temp_json_importer) );
     io_import_elements_destroy( &((*this_).temp_elements_importer) );
@@ -0,0 +1,127 @@
+/* File: io_progress.c; Copyright and License: see below */
+
+#include "io_progress.h"
+#include "u8/u8_trace.h"
+#include <assert.h>
+
+void io_progress_init ( io_progress_t *this_,
+                        data_stat_t *stat,
+                        void *listener_instance,
+                        void (*listener_callback)( void *listener_instance, const io_progress_t *progress ) )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != stat );
+
+    (*this_).stat = stat;
+    (*this_).byte_count = 0;
+    (*this_).phase_count = 0;
+    (*this_).phase_running = false;
+    (*this_).start_time = g_get_monotonic_time();
+    (*this_).phase_start_time = (*this_).start_time;
+    (*this_).report_time = (*this_).start_time;
+    (*this_).interval = IO_PROGRESS_DEFAULT_INTERVAL;
+    g_atomic_int_set( &((*this_).cancelled), 0 );
+    (*this_).listener_instance = listener_instance;
+    (*this_).listener_callback = listener_callback;
+
+    U8_TRACE_END();
+}
+
+void io_progress_destroy ( io_progress_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    (*this_).stat = NULL;
+    (*this_).listener_instance = NULL;
+    (*this_).listener_callback = NULL;
+
+    U8_TRACE_END();
+}
+
+void io_progress_begin_phase ( io_progress_t *this_, const char *phase_name )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != phase_name );
+    U8_TRACE_INFO_STR( "phase:", phase_name );
+
+    const int64_t now = g_get_monotonic_time();
+    if ( (*this_).phase_running )
+    {
+        assert( (*this_).phase_count > 0 );
+        (*this_).phase_time[(*this_).phase_count-1] = now - (*this_).phase_start_time;
+    }
+
+    if ( (*this_).phase_count < IO_PROGRESS_MAX_PHASES )
+    {
+        (*this_).phase_name[(*this_).phase_count] = phase_name;
+        (*this_).phase_time[(*this_).phase_count] = 0;
+        (*this_).phase_count ++;
+        (*this_).phase_start_time = now;
+    }
+    else
+    {
+        /* no more phases can be timed separately, continue the last one */
+        (*this_).phase_start_time = now - (*this_).phase_time[(*this_).phase_count-1];
+    }
+    (*this_).phase_running = true;
+
+    io_progress_private_report( this_, now );
+
+    U8_TRACE_END();
+}
+
+void io_progress_end_phase ( io_progress_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    io_progress_private_report( this_, g_get_monotonic_time() );
+    (*this_).phase_running = false;
+
+    U8_TRACE_END();
+}
+
+u8_error_t io_progress_tick ( io_progress_t *this_ )
+{
+    if ( ! io_progress_is_cancelled( this_ ) )
+    {
+        const int64_t now = g_get_monotonic_time();
+        if ( ( now - (*this_).report_time ) >= (*this_).interval )
+        {
+            io_progress_private_report( this_, now );
+        }
+    }
+
+    /* the listener may have cancelled the operation */
+    return io_progress_is_cancelled( this_ ) ? U8_ERROR_CANCELLED : U8_ERROR_NONE;
+}
+
+void io_progress_private_report ( io_progress_t *this_, int64_t now )
+{
+    (*this_).report_time = now;
+    if ( (*this_).phase_running )
+    {
+        (*this_).phase_time[(*this_).phase_count-1] = now - (*this_).phase_start_time;
+    }
+
+    if ( NULL != (*this_).listener_callback )
+    {
+        (*(*this_).listener_callback)( (*this_).listener_instance, this_ );
+    }
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
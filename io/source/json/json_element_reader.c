@@ -953,7 +953,9 @@ u8_error_t json_element_reader_skip_next_string ( json_element_reader_t *this_ )
     char dummy_str[4];
     utf8stringbuf_t dummy_strbuf = UTF8STRINGBUF ( dummy_str );
 
-    result = json_token_reader_read_string_value ( &((*this_).tokenizer), dummy_strbuf );
+    utf8stringview_t skipped_string;
+
+    result = json_token_reader_read_string_view ( &((*this_).tokenizer), dummy_strbuf, &skipped_string );
     if ( result == U8_ERROR_STRING_BUFFER_EXCEEDED )
     {
         /* ignore this. The result string is not needed therefore dummy_str may be too small */
@@ -975,6 +977,11 @@ uint32_t json_element_reader_get_read_line ( json_element_reader_t *this_ )
     return read_line;
 }
 
+size_t json_element_reader_get_read_pos ( json_element_reader_t *this_ )
+{
+    return json_token_reader_get_input_pos( &((*this_).tokenizer) );
+}
+
 u8_error_t json_element_reader_get_next_feature ( json_element_reader_t *this_, data_feature_t *out_object )
 {
     U8_TRACE_BEGIN();
@@ -1391,6 +1391,30 @@ u8_error_t json_element_writer_end_diagramelement( json_element_writer_t *this_,
     return out_err;
 }
 
+u8_error_t json_element_writer_write_verbatim( json_element_writer_t *this_, const utf8stringview_t *serialized )
+{
+    U8_TRACE_BEGIN();
+    assert( serialized != NULL );
+    assert( (*this_).in_outer_array == true );
+    u8_error_t out_err = U8_ERROR_NONE;
+
+    if ( utf8stringview_get_length( serialized ) != 0 )
+    {
+        out_err |= json_writer_write_plain_view( &((*this_).json_writer), serialized );
+
+        (*this_).is_outer_first = false;
+        if ( (*this_).mode == JSON_WRITER_PASS_VIEWS )
+        {
+            /* the last diagram is still open, its elements array is ended when the next diagram starts */
+            (*this_).in_inner_array = true;
+            (*this_).is_inner_first = false;
+        }
+    }
+
+    U8_TRACE_END_ERR(out_err);
+    return out_err;
+}
+
 u8_error_t json_element_writer_end_main( json_element_writer_t *this_ )
 {
     U8_TRACE_BEGIN();
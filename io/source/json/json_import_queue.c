@@ -0,0 +1,149 @@
+/* File: json_import_queue.c; Copyright and License: see below */
+
+#include "json/json_import_queue.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <assert.h>
+
+void json_import_queue_init ( json_import_queue_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    g_mutex_init( &((*this_).lock) );
+    g_cond_init( &((*this_).changed) );
+    (*this_).first = 0;
+    (*this_).count = 0;
+    (*this_).closed = false;
+    (*this_).cancelled = false;
+
+    U8_TRACE_END();
+}
+
+void json_import_queue_reset ( json_import_queue_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    g_mutex_lock( &((*this_).lock) );
+    (*this_).first = 0;
+    (*this_).count = 0;
+    (*this_).closed = false;
+    (*this_).cancelled = false;
+    g_mutex_unlock( &((*this_).lock) );
+
+    U8_TRACE_END();
+}
+
+void json_import_queue_destroy ( json_import_queue_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    g_cond_clear( &((*this_).changed) );
+    g_mutex_clear( &((*this_).lock) );
+
+    U8_TRACE_END();
+}
+
+u8_error_t json_import_queue_begin_push ( json_import_queue_t *this_, json_import_record_t **out_record )
+{
+    assert( NULL != out_record );
+    u8_error_t result = U8_ERROR_NONE;
+
+    g_mutex_lock( &((*this_).lock) );
+    assert( ! (*this_).closed );
+    while (( (*this_).count >= JSON_IMPORT_QUEUE_MAX_RECORDS )&&( ! (*this_).cancelled ))
+    {
+        g_cond_wait( &((*this_).changed), &((*this_).lock) );
+    }
+    if ( (*this_).cancelled )
+    {
+        *out_record = NULL;
+        result = U8_ERROR_WRONG_STATE;
+    }
+    else
+    {
+        const uint32_t free_index = ( (*this_).first + (*this_).count ) % JSON_IMPORT_QUEUE_MAX_RECORDS;
+        *out_record = &((*this_).record[free_index]);
+    }
+    g_mutex_unlock( &((*this_).lock) );
+
+    return result;
+}
+
+void json_import_queue_end_push ( json_import_queue_t *this_ )
+{
+    g_mutex_lock( &((*this_).lock) );
+    assert( (*this_).count < JSON_IMPORT_QUEUE_MAX_RECORDS );
+    (*this_).count ++;
+    g_cond_broadcast( &((*this_).changed) );
+    g_mutex_unlock( &((*this_).lock) );
+}
+
+void json_import_queue_close ( json_import_queue_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    g_mutex_lock( &((*this_).lock) );
+    (*this_).closed = true;
+    g_cond_broadcast( &((*this_).changed) );
+    g_mutex_unlock( &((*this_).lock) );
+
+    U8_TRACE_END();
+}
+
+json_import_record_t *json_import_queue_begin_pop ( json_import_queue_t *this_ )
+{
+    json_import_record_t *result = NULL;
+
+    g_mutex_lock( &((*this_).lock) );
+    assert( ! (*this_).cancelled );
+    while (( (*this_).count == 0 )&&( ! (*this_).closed ))
+    {
+        g_cond_wait( &((*this_).changed), &((*this_).lock) );
+    }
+    if ( (*this_).count != 0 )
+    {
+        result = &((*this_).record[(*this_).first]);
+    }
+    g_mutex_unlock( &((*this_).lock) );
+
+    return result;
+}
+
+void json_import_queue_end_pop ( json_import_queue_t *this_ )
+{
+    g_mutex_lock( &((*this_).lock) );
+    assert( (*this_).count > 0 );
+    (*this_).first = ( (*this_).first + 1 ) % JSON_IMPORT_QUEUE_MAX_RECORDS;
+    (*this_).count --;
+    g_cond_broadcast( &((*this_).changed) );
+    g_mutex_unlock( &((*this_).lock) );
+}
+
+void json_import_queue_cancel ( json_import_queue_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    g_mutex_lock( &((*this_).lock) );
+    (*this_).cancelled = true;
+    g_cond_broadcast( &((*this_).changed) );
+    g_mutex_unlock( &((*this_).lock) );
+
+    U8_TRACE_END();
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
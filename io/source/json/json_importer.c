@@ -4,18 +4,25 @@
 #include "u8/u8_error.h"
 #include "utf8stringbuf/utf8string.h"
 #include "u8/u8_trace.h"
+#include "u8/u8_log.h"
 #include <assert.h>
 #include "io_gtk.h"
 #include <stdbool.h>
 
-void json_importer_init( json_importer_t *this_, io_import_elements_t *elements_importer )
+void json_importer_init( json_importer_t *this_, io_import_elements_t *elements_importer, io_progress_t *progress )
 {
     U8_TRACE_BEGIN();
     assert( NULL != elements_importer );
 
     (*this_).elements_importer = elements_importer;
+    (*this_).progress = progress;
+    (*this_).progress_pos = 0;
 
     data_rules_init ( &((*this_).data_rules) );
+    json_import_queue_init( &((*this_).queue) );
+    (*this_).queued = false;
+    (*this_).parse_result = U8_ERROR_NONE;
+    (*this_).parse_line = 0;
 
     U8_TRACE_END();
 }
@@ -25,9 +32,11 @@ void json_importer_destroy( json_importer_t *this_ )
     U8_TRACE_BEGIN();
     assert( NULL != (*this_).elements_importer );
 
+    json_import_queue_destroy( &((*this_).queue) );
     data_rules_destroy ( &((*this_).data_rules) );
 
     (*this_).elements_importer = NULL;
+    (*this_).progress = NULL;
 
     U8_TRACE_END();
 }
@@ -41,8 +50,82 @@ u8_error_t json_importer_import_stream( json_importer_t *this_,
     assert( NULL != out_err_info );
 
     u8_error_t sync_error = U8_ERROR_NONE;
+    uint32_t error_line = 0;
 
     json_element_reader_init( &((*this_).temp_element_reader), json_text );
+    json_import_queue_reset( &((*this_).queue) );
+    (*this_).parse_result = U8_ERROR_NONE;
+    (*this_).parse_line = 0;
+    (*this_).progress_pos = 0;
+
+    /* parse on an own thread while this thread writes the parsed elements to the database */
+    (*this_).queued = true;
+    GThread *const parser_thread = g_thread_try_new( "cfu_import", &json_importer_private_parse_thread, this_, NULL );
+    if ( NULL != parser_thread )
+    {
+        sync_error = json_importer_private_sync_queued_records( this_, &error_line );
+        if ( U8_ERROR_NONE != sync_error )
+        {
+            /* stop the parser */
+            json_import_queue_cancel( &((*this_).queue) );
+        }
+        g_thread_join( parser_thread );
+    }
+    else
+    {
+        /* no thread could be started: parse and write one element after the other in this thread */
+        U8_LOG_WARNING( "no import thread could be started." );
+        (*this_).queued = false;
+        json_importer_private_parse_thread( this_ );
+    }
+
+    /* an error at writing is reported first, it refers to an earlier position in the input */
+    if ( U8_ERROR_NONE == sync_error )
+    {
+        sync_error = (*this_).parse_result;
+        error_line = (*this_).parse_line;
+    }
+
+    /* count the remaining bytes, e.g. the footer */
+    if ( NULL != (*this_).progress )
+    {
+        const size_t read_pos = json_element_reader_get_read_pos( &((*this_).temp_element_reader) );
+        io_progress_add_bytes( (*this_).progress, read_pos - (*this_).progress_pos );
+        (*this_).progress_pos = read_pos;
+    }
+
+    /* report line number of current sync_error */
+    u8_error_info_init_line( out_err_info, sync_error, error_line );
+
+    json_element_reader_destroy( &((*this_).temp_element_reader) );
+
+    U8_TRACE_END_ERR( sync_error );
+    return sync_error;
+}
+
+gpointer json_importer_private_parse_thread( gpointer data )
+{
+    U8_TRACE_BEGIN();
+    json_importer_t *const this_ = data;
+    assert( NULL != this_ );
+
+    (*this_).parse_result = json_importer_private_parse( this_ );
+    (*this_).parse_line = json_element_reader_get_read_line ( &((*this_).temp_element_reader) );
+
+    if ( (*this_).queued )
+    {
+        json_import_queue_close( &((*this_).queue) );
+    }
+
+    U8_TRACE_END();
+    return NULL;
+}
+
+u8_error_t json_importer_private_parse( json_importer_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    u8_error_t sync_error = U8_ERROR_NONE;
 
     /* read header */
     if ( U8_ERROR_NONE == sync_error )
@@ -70,16 +153,156 @@ u8_error_t json_importer_import_stream( json_importer_t *this_,
         sync_error = json_element_reader_expect_footer( &((*this_).temp_element_reader) );
     }
 
-    /* report line number of current sync_error */
-    const uint32_t current_read_line = json_element_reader_get_read_line ( &((*this_).temp_element_reader) );
-    u8_error_info_init_line( out_err_info, sync_error, current_read_line );
+    U8_TRACE_END_ERR( sync_error );
+    return sync_error;
+}
 
-    json_element_reader_destroy( &((*this_).temp_element_reader) );
+u8_error_t json_importer_private_sync_queued_records( json_importer_t *this_, uint32_t *out_error_line )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != out_error_line );
+    u8_error_t sync_error = U8_ERROR_NONE;
+    *out_error_line = 0;
+
+    bool finished = false;
+    while ( ! finished )
+    {
+        json_import_record_t *const record = json_import_queue_begin_pop( &((*this_).queue) );
+        if ( NULL == record )
+        {
+            /* the parser has finished */
+            finished = true;
+        }
+        else
+        {
+            sync_error = json_importer_private_sync_record( this_, record );
+            if ( U8_ERROR_NONE != sync_error )
+            {
+                *out_error_line = (*record).read_line;
+                finished = true;
+            }
+            json_import_queue_end_pop( &((*this_).queue) );
+        }
+    }
+
+    U8_TRACE_END_ERR( sync_error );
+    return sync_error;
+}
+
+u8_error_t json_importer_private_sync_record( json_importer_t *this_, json_import_record_t *record )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != record );
+    u8_error_t sync_error = U8_ERROR_NONE;
+
+    switch ( (*record).table )
+    {
+        case DATA_TABLE_DIAGRAM:
+        {
+            sync_error = io_import_elements_sync_diagram( (*this_).elements_importer,
+                                                          &((*record).element.diagram),
+                                                          (*record).owner_uuid
+                                                        );
+            data_diagram_destroy( &((*record).element.diagram) );
+        }
+        break;
+
+        case DATA_TABLE_DIAGRAMELEMENT:
+        {
+            sync_error = io_import_elements_sync_diagramelement( (*this_).elements_importer,
+                                                                 &((*record).element.diagramelement),
+                                                                 (*record).owner_uuid,
+                                                                 (*record).node_uuid
+                                                               );
+            data_diagramelement_destroy( &((*record).element.diagramelement) );
+        }
+        break;
+
+        case DATA_TABLE_CLASSIFIER:
+        {
+            sync_error = io_import_elements_sync_classifier( (*this_).elements_importer,
+                                                             &((*record).element.classifier)
+                                                           );
+            data_classifier_destroy( &((*record).element.classifier) );
+        }
+        break;
+
+        case DATA_TABLE_FEATURE:
+        {
+            sync_error = io_import_elements_sync_feature( (*this_).elements_importer,
+                                                          &((*record).element.feature),
+                                                          (*record).owner_uuid
+                                                        );
+            data_feature_destroy( &((*record).element.feature) );
+        }
+        break;
+
+        case DATA_TABLE_RELATIONSHIP:
+        {
+            sync_error = io_import_elements_sync_relationship( (*this_).elements_importer,
+                                                               &((*record).element.relationship),
+                                                               (*record).owner_uuid,
+                                                               (*record).node_uuid
+                                                             );
+            data_relationship_destroy( &((*record).element.relationship) );
+        }
+        break;
+
+        default:
+        {
+            U8_LOG_ERROR( "unexpected record type" );
+            sync_error = U8_ERROR_PARSER_STRUCTURE;
+        }
+        break;
+    }
+
+    if (( NULL != (*this_).progress )&&( U8_ERROR_NONE == sync_error ))
+    {
+        io_progress_add_bytes( (*this_).progress, (*record).read_pos - (*this_).progress_pos );
+        (*this_).progress_pos = (*record).read_pos;
+        sync_error = io_progress_tick( (*this_).progress );
+    }
 
     U8_TRACE_END_ERR( sync_error );
     return sync_error;
 }
 
+u8_error_t json_importer_private_new_record( json_importer_t *this_, json_import_record_t **out_record )
+{
+    assert( NULL != out_record );
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).queued )
+    {
+        result = json_import_queue_begin_push( &((*this_).queue), out_record );
+    }
+    else
+    {
+        *out_record = &((*this_).temp_record);
+    }
+
+    return result;
+}
+
+u8_error_t json_importer_private_commit_record( json_importer_t *this_, json_import_record_t *record )
+{
+    assert( NULL != record );
+    u8_error_t result = U8_ERROR_NONE;
+
+    (*record).read_line = json_element_reader_get_read_line ( &((*this_).temp_element_reader) );
+    (*record).read_pos = json_element_reader_get_read_pos ( &((*this_).temp_element_reader) );
+    if ( (*this_).queued )
+    {
+        json_import_queue_end_push( &((*this_).queue) );
+    }
+    else
+    {
+        result = json_importer_private_sync_record( this_, record );
+    }
+
+    return result;
+}
+
 u8_error_t json_importer_private_import_views( json_importer_t *this_ )
 {
     U8_TRACE_BEGIN();
@@ -112,37 +335,45 @@ u8_error_t json_importer_private_import_views( json_importer_t *this_ )
 
                     case DATA_TABLE_DIAGRAM:
                     {
-                        data_diagram_init_empty( &((*this_).temp_diagram) );
-                        /* parent is the uuid of the parent diagram (if not root) */
-                        char diag_parent_buf[DATA_UUID_STRING_SIZE] = "";
-                        utf8stringbuf_t diag_parent_uuid = UTF8STRINGBUF(diag_parent_buf);
-                        bool has_diagramelements;
-                        sync_error = json_element_reader_get_next_diagram( &((*this_).temp_element_reader),
-                                                                           &((*this_).temp_diagram),
-                                                                           diag_parent_uuid,
-                                                                           &has_diagramelements
-                                                                         );
+                        json_import_record_t *record;
+                        sync_error = json_importer_private_new_record( this_, &record );
                         if ( U8_ERROR_NONE == sync_error )
                         {
-                            sync_error = io_import_elements_sync_diagram( (*this_).elements_importer,
-                                                                          &((*this_).temp_diagram),
-                                                                          utf8stringbuf_get_string( &diag_parent_uuid )
-                                                                        );
-
-                            if ( has_diagramelements )
+                            (*record).table = DATA_TABLE_DIAGRAM;
+                            data_diagram_init_empty( &((*record).element.diagram) );
+                            (*record).node_uuid[0] = '\0';
+                            /* owner is the uuid of the parent diagram (if not root) */
+                            utf8stringbuf_t diag_parent_uuid = UTF8STRINGBUF( (*record).owner_uuid );
+                            utf8stringbuf_clear( &diag_parent_uuid );
+                            bool has_diagramelements;
+                            sync_error = json_element_reader_get_next_diagram( &((*this_).temp_element_reader),
+                                                                               &((*record).element.diagram),
+                                                                               diag_parent_uuid,
+                                                                               &has_diagramelements
+                                                                             );
+                            if ( U8_ERROR_NONE == sync_error )
                             {
-                                if ( U8_ERROR_NONE == sync_error )  /* stop reading in case of error */
-                                {
-                                    const char *const diag_uuid = data_diagram_get_uuid_const( &((*this_).temp_diagram) );
-                                    sync_error = json_importer_private_import_diagramelement_array( this_, diag_uuid );
-                                }
-                                if ( U8_ERROR_NONE == sync_error )  /* stop reading in case of error */
+                                /* the record is reused after commit, keep the uuid for the diagramelements */
+                                char diag_uuid_buf[DATA_UUID_STRING_SIZE];
+                                utf8stringbuf_t diag_uuid = UTF8STRINGBUF( diag_uuid_buf );
+                                utf8stringbuf_copy_str( &diag_uuid, data_diagram_get_uuid_const( &((*record).element.diagram) ) );
+
+                                sync_error = json_importer_private_commit_record( this_, record );
+
+                                if ( has_diagramelements )
                                 {
-                                    sync_error = json_element_reader_end_unfinished_object( &((*this_).temp_element_reader) );
+                                    if ( U8_ERROR_NONE == sync_error )  /* stop reading in case of error */
+                                    {
+                                        sync_error = json_importer_private_import_diagramelement_array( this_,
+                                                                                                        utf8stringbuf_get_string( &diag_uuid )
+                                                                                                      );
+                                    }
+                                    if ( U8_ERROR_NONE == sync_error )  /* stop reading in case of error */
+                                    {
+                                        sync_error = json_element_reader_end_unfinished_object( &((*this_).temp_element_reader) );
+                                    }
                                 }
                             }
-
-                            data_diagram_destroy( &((*this_).temp_diagram) );
                         }
                     }
                     break;
@@ -202,31 +433,42 @@ u8_error_t json_importer_private_import_nodes( json_importer_t *this_ )
 
                     case DATA_TABLE_CLASSIFIER:
                     {
-                        data_classifier_init_empty( &((*this_).temp_classifier) );
-                        bool has_features;
-                        sync_error = json_element_reader_get_next_classifier( &((*this_).temp_element_reader),
-                                                                              &((*this_).temp_classifier),
-                                                                              &has_features
-                                                                            );
+                        json_import_record_t *record;
+                        sync_error = json_importer_private_new_record( this_, &record );
                         if ( U8_ERROR_NONE == sync_error )
                         {
-                            sync_error = io_import_elements_sync_classifier( (*this_).elements_importer,
-                                                                             &((*this_).temp_classifier) );
-
-                            if ( has_features )
+                            (*record).table = DATA_TABLE_CLASSIFIER;
+                            data_classifier_init_empty( &((*record).element.classifier) );
+                            (*record).owner_uuid[0] = '\0';
+                            (*record).node_uuid[0] = '\0';
+                            bool has_features;
+                            sync_error = json_element_reader_get_next_classifier( &((*this_).temp_element_reader),
+                                                                                  &((*record).element.classifier),
+                                                                                  &has_features
+                                                                                );
+                            if ( U8_ERROR_NONE == sync_error )
                             {
-                                if ( U8_ERROR_NONE == sync_error )  /* stop reading in case of error */
-                                {
-                                    const char *const class_uuid = data_classifier_get_uuid_const( &((*this_).temp_classifier) );
-                                    sync_error = json_importer_private_import_feature_array( this_, class_uuid );
-                                }
-                                if ( U8_ERROR_NONE == sync_error )  /* stop reading in case of error */
+                                /* the record is reused after commit, keep the uuid for the features */
+                                char class_uuid_buf[DATA_UUID_STRING_SIZE];
+                                utf8stringbuf_t class_uuid = UTF8STRINGBUF( class_uuid_buf );
+                                utf8stringbuf_copy_str( &class_uuid, data_classifier_get_uuid_const( &((*record).element.classifier) ) );
+
+                                sync_error = json_importer_private_commit_record( this_, record );
+
+                                if ( has_features )
                                 {
-                                    sync_error = json_element_reader_end_unfinished_object( &((*this_).temp_element_reader) );
+                                    if ( U8_ERROR_NONE == sync_error )  /* stop reading in case of error */
+                                    {
+                                        sync_error = json_importer_private_import_feature_array( this_,
+                                                                                                 utf8stringbuf_get_string( &class_uuid )
+                                                                                               );
+                                    }
+                                    if ( U8_ERROR_NONE == sync_error )  /* stop reading in case of error */
+                                    {
+                                        sync_error = json_element_reader_end_unfinished_object( &((*this_).temp_element_reader) );
+                                    }
                                 }
                             }
-
-                            data_classifier_destroy( &((*this_).temp_classifier) );
                         }
                     }
                     break;
@@ -286,29 +528,28 @@ u8_error_t json_importer_private_import_edges( json_importer_t *this_ )
 
                     case DATA_TABLE_RELATIONSHIP:
                     {
-                        data_relationship_init_empty( &((*this_).temp_relationship) );
-                        /* from_node is the uuid of either the from_classifier or (if defined) the from_feature */
-                        char rel_from_node_buf[DATA_UUID_STRING_SIZE] = "";
-                        utf8stringbuf_t rel_from_node_uuid = UTF8STRINGBUF(rel_from_node_buf);
-                        /* to_node is the uuid of either the to_classifier or (if defined) the to_feature */
-                        char rel_to_node_buf[DATA_UUID_STRING_SIZE] = "";
-                        utf8stringbuf_t rel_to_node_uuid = UTF8STRINGBUF(rel_to_node_buf);
-                        sync_error = json_element_reader_get_next_relationship( &((*this_).temp_element_reader),
-                                                                                &((*this_).temp_relationship),
-                                                                                rel_from_node_uuid,
-                                                                                rel_to_node_uuid
-                                                                              );
-
+                        json_import_record_t *record;
+                        sync_error = json_importer_private_new_record( this_, &record );
                         if ( U8_ERROR_NONE == sync_error )
                         {
-                            sync_error = io_import_elements_sync_relationship( (*this_).elements_importer,
-                                                                               &((*this_).temp_relationship),
-                                                                               utf8stringbuf_get_string( &rel_from_node_uuid ),
-                                                                               utf8stringbuf_get_string( &rel_to_node_uuid )
-                                                                             );
-
-                            /* cleanup */
-                            data_relationship_destroy( &((*this_).temp_relationship) );
+                            (*record).table = DATA_TABLE_RELATIONSHIP;
+                            data_relationship_init_empty( &((*record).element.relationship) );
+                            /* owner is the from_node: uuid of either the from_classifier or (if defined) the from_feature */
+                            utf8stringbuf_t rel_from_node_uuid = UTF8STRINGBUF( (*record).owner_uuid );
+                            utf8stringbuf_clear( &rel_from_node_uuid );
+                            /* node is the to_node: uuid of either the to_classifier or (if defined) the to_feature */
+                            utf8stringbuf_t rel_to_node_uuid = UTF8STRINGBUF( (*record).node_uuid );
+                            utf8stringbuf_clear( &rel_to_node_uuid );
+                            sync_error = json_element_reader_get_next_relationship( &((*this_).temp_element_reader),
+                                                                                    &((*record).element.relationship),
+                                                                                    rel_from_node_uuid,
+                                                                                    rel_to_node_uuid
+                                                                                  );
+
+                            if ( U8_ERROR_NONE == sync_error )
+                            {
+                                sync_error = json_importer_private_commit_record( this_, record );
+                            }
                         }
                     }
                     break;
@@ -352,22 +593,26 @@ u8_error_t json_importer_private_import_diagramelement_array( json_importer_t *t
         {
             if ( ! end_array )
             {
-                data_diagramelement_init_empty( &((*this_).temp_diagramelement) );
-                /* node is the uuid of either the classifier or (if defined) the focused_feature */
-                char node_uuid_buf[DATA_UUID_STRING_SIZE] = "";
-                utf8stringbuf_t node_uuid = UTF8STRINGBUF(node_uuid_buf);
-                sync_error |= json_element_reader_get_next_diagramelement( &((*this_).temp_element_reader),
-                                                                           &((*this_).temp_diagramelement),
-                                                                           node_uuid
-                                                                         );
+                json_import_record_t *record;
+                sync_error |= json_importer_private_new_record( this_, &record );
+                if ( U8_ERROR_NONE == sync_error )
+                {
+                    (*record).table = DATA_TABLE_DIAGRAMELEMENT;
+                    data_diagramelement_init_empty( &((*record).element.diagramelement) );
+                    /* owner is the diagram */
+                    utf8stringbuf_t owner_uuid = UTF8STRINGBUF( (*record).owner_uuid );
+                    utf8stringbuf_copy_str( &owner_uuid, diagram_uuid );
+                    /* node is the uuid of either the classifier or (if defined) the focused_feature */
+                    utf8stringbuf_t node_uuid = UTF8STRINGBUF( (*record).node_uuid );
+                    utf8stringbuf_clear( &node_uuid );
+                    sync_error |= json_element_reader_get_next_diagramelement( &((*this_).temp_element_reader),
+                                                                               &((*record).element.diagramelement),
+                                                                               node_uuid
+                                                                             );
+                }
                 if ( U8_ERROR_NONE == sync_error )
                 {
-                    sync_error |= io_import_elements_sync_diagramelement( (*this_).elements_importer,
-                                                                          &((*this_).temp_diagramelement),
-                                                                          diagram_uuid,
-                                                                          utf8stringbuf_get_string( &node_uuid )
-                                                                        );
-                    data_diagramelement_destroy( &((*this_).temp_diagramelement) );
+                    sync_error |= json_importer_private_commit_record( this_, record );
                 }
                 else
                 {
@@ -404,15 +649,23 @@ u8_error_t json_importer_private_import_feature_array( json_importer_t *this_, c
         {
             if ( ! end_array )
             {
-                data_feature_init_empty( &((*this_).temp_feature) );
-                sync_error |= json_element_reader_get_next_feature( &((*this_).temp_element_reader), &((*this_).temp_feature) );
+                json_import_record_t *record;
+                sync_error |= json_importer_private_new_record( this_, &record );
+                if ( U8_ERROR_NONE == sync_error )
+                {
+                    (*record).table = DATA_TABLE_FEATURE;
+                    data_feature_init_empty( &((*record).element.feature) );
+                    /* owner is the classifier */
+                    utf8stringbuf_t owner_uuid = UTF8STRINGBUF( (*record).owner_uuid );
+                    utf8stringbuf_copy_str( &owner_uuid, classifier_uuid );
+                    (*record).node_uuid[0] = '\0';
+                    sync_error |= json_element_reader_get_next_feature( &((*this_).temp_element_reader),
+                                                                        &((*record).element.feature)
+                                                                      );
+                }
                 if ( U8_ERROR_NONE == sync_error )
                 {
-                    sync_error |= io_import_elements_sync_feature( (*this_).elements_importer,
-                                                                   &((*this_).temp_feature),
-                                                                   classifier_uuid
-                                                                 );
-                    data_feature_destroy( &((*this_).temp_feature) );
+                    sync_error |= json_importer_private_commit_record( this_, record );
                 }
                 else
                 {
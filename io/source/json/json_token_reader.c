@@ -280,52 +280,152 @@ u8_error_t json_token_reader_read_string_value ( json_token_reader_t *this_, utf
         /* expected token found */
         universal_buffer_input_stream_read_next( &((*this_).in_stream) );
 
-        universal_memory_output_stream_t mem_out;
-        universal_memory_output_stream_init( &mem_out,
-                                             utf8stringbuf_get_string( &out_value ),
-                                             utf8stringbuf_get_size( &out_value ),
-                                             UNIVERSAL_MEMORY_OUTPUT_STREAM_0TERM_UTF8
-                                           );
-
-        universal_escaping_output_stream_t esc_out;
-        universal_escaping_output_stream_init( &esc_out,
-                                               &JSON_TOKENIZER_PRIVATE_DECODE_JSON_STRINGS,
-                                               universal_memory_output_stream_get_output_stream( &mem_out )
-                                             );
-
-        result_err = json_token_reader_private_read_string( this_,
-                                                            universal_escaping_output_stream_get_output_stream( &esc_out )
-                                                          );
-
-        const u8_error_t out_err = universal_escaping_output_stream_flush( &esc_out );  /* enforces 0-termination on mem_out */
-        universal_escaping_output_stream_destroy( &esc_out );
-        if ( 0 != out_err )
+        utf8stringview_t plain_string;
+        if ( json_token_reader_private_find_plain_string( this_, &plain_string ) )
         {
-            result_err = U8_ERROR_STRING_BUFFER_EXCEEDED;
+            /* fast path: no escape sequences, the string is copied directly from the input buffer */
+            const utf8error_t copy_err = utf8stringbuf_copy_view( &out_value, &plain_string );
+            if ( copy_err != UTF8ERROR_SUCCESS )
+            {
+                result_err = U8_ERROR_STRING_BUFFER_EXCEEDED;
+            }
+            universal_buffer_input_stream_skip_buffered( &((*this_).in_stream), utf8stringview_get_length( &plain_string ) );
         }
-        universal_memory_output_stream_destroy( &mem_out );
-
-        /* expect string end */
-        const bool in_err
-            = ( JSON_CONSTANTS_CHAR_END_STRING != universal_buffer_input_stream_peek_next( &((*this_).in_stream) ) );
-        if ( in_err )
+        else
         {
-            result_err = U8_ERROR_LEXICAL_STRUCTURE;
+            result_err = json_token_reader_private_decode_string( this_, out_value );
         }
-        else
+
+        const u8_error_t end_err = json_token_reader_private_expect_string_end( this_ );
+        if ( end_err != U8_ERROR_NONE )
         {
-            universal_buffer_input_stream_read_next( &((*this_).in_stream) );
+            result_err = end_err;
+        }
+    }
+    else
+    {
+        /* expected start token missing */
+        result_err = U8_ERROR_PARSER_STRUCTURE;
+    }
+
+    U8_TRACE_END_ERR( result_err );
+    return result_err;
+}
 
-            if ( ! json_token_reader_private_is_value_end( this_ ) )
+u8_error_t json_token_reader_read_string_view ( json_token_reader_t *this_,
+                                                utf8stringbuf_t scratch,
+                                                utf8stringview_t *out_value )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != out_value );
+    u8_error_t result_err = U8_ERROR_NONE;
+
+    /* skip whitespace */
+    json_token_reader_private_skip_whitespace( this_ );
+
+    /* expect string begin */
+    if ( JSON_CONSTANTS_CHAR_BEGIN_STRING == universal_buffer_input_stream_peek_next( &((*this_).in_stream) ) )
+    {
+        /* expected token found */
+        universal_buffer_input_stream_read_next( &((*this_).in_stream) );
+
+        utf8stringview_t plain_string;
+        if ( json_token_reader_private_find_plain_string( this_, &plain_string ) )
+        {
+            universal_buffer_input_stream_skip_buffered( &((*this_).in_stream), utf8stringview_get_length( &plain_string ) );
+            if ( universal_buffer_input_stream_is_in_place( &((*this_).in_stream) ) )
             {
-                result_err = U8_ERROR_LEXICAL_STRUCTURE;
+                /* zero-copy: the input region stays valid while further tokens are read */
+                *out_value = plain_string;
             }
+            else
+            {
+                /* the own input buffer may be overwritten when reading the next bytes */
+                const utf8error_t copy_err = utf8stringbuf_copy_view( &scratch, &plain_string );
+                if ( copy_err != UTF8ERROR_SUCCESS )
+                {
+                    result_err = U8_ERROR_STRING_BUFFER_EXCEEDED;
+                }
+                *out_value = utf8stringbuf_get_view( &scratch );
+            }
+        }
+        else
+        {
+            result_err = json_token_reader_private_decode_string( this_, scratch );
+            *out_value = utf8stringbuf_get_view( &scratch );
+        }
+
+        const u8_error_t end_err = json_token_reader_private_expect_string_end( this_ );
+        if ( end_err != U8_ERROR_NONE )
+        {
+            result_err = end_err;
         }
     }
     else
     {
         /* expected start token missing */
         result_err = U8_ERROR_PARSER_STRUCTURE;
+        *out_value = UTF8STRINGVIEW_EMPTY;
+    }
+
+    U8_TRACE_END_ERR( result_err );
+    return result_err;
+}
+
+u8_error_t json_token_reader_private_decode_string ( json_token_reader_t *this_, utf8stringbuf_t out_value )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result_err = U8_ERROR_NONE;
+
+    universal_memory_output_stream_t mem_out;
+    universal_memory_output_stream_init( &mem_out,
+                                         utf8stringbuf_get_string( &out_value ),
+                                         utf8stringbuf_get_size( &out_value ),
+                                         UNIVERSAL_MEMORY_OUTPUT_STREAM_0TERM_UTF8
+                                       );
+
+    universal_escaping_output_stream_t esc_out;
+    universal_escaping_output_stream_init( &esc_out,
+                                           &JSON_TOKENIZER_PRIVATE_DECODE_JSON_STRINGS,
+                                           universal_memory_output_stream_get_output_stream( &mem_out )
+                                         );
+
+    result_err = json_token_reader_private_read_string( this_,
+                                                        universal_escaping_output_stream_get_output_stream( &esc_out )
+                                                      );
+
+    const u8_error_t out_err = universal_escaping_output_stream_flush( &esc_out );  /* enforces 0-termination on mem_out */
+    universal_escaping_output_stream_destroy( &esc_out );
+    if ( 0 != out_err )
+    {
+        result_err = U8_ERROR_STRING_BUFFER_EXCEEDED;
+    }
+    universal_memory_output_stream_destroy( &mem_out );
+
+    U8_TRACE_END_ERR( result_err );
+    return result_err;
+}
+
+u8_error_t json_token_reader_private_expect_string_end ( json_token_reader_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t result_err = U8_ERROR_NONE;
+
+    /* expect string end */
+    const bool in_err
+        = ( JSON_CONSTANTS_CHAR_END_STRING != universal_buffer_input_stream_peek_next( &((*this_).in_stream) ) );
+    if ( in_err )
+    {
+        result_err = U8_ERROR_LEXICAL_STRUCTURE;
+    }
+    else
+    {
+        universal_buffer_input_stream_read_next( &((*this_).in_stream) );
+
+        if ( ! json_token_reader_private_is_value_end( this_ ) )
+        {
+            result_err = U8_ERROR_LEXICAL_STRUCTURE;
+        }
     }
 
     U8_TRACE_END_ERR( result_err );
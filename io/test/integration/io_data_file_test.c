@@ -2,23 +2,37 @@
 
 #include "io_data_file_test.h"
 #include "io_data_file.h"
+#include "io_exporter.h"
+#include "io_progress.h"
 #include "test_fixture.h"
 #include "test_expect.h"
 #include "test_environment_assert.h"
 #include "test_case_result.h"
 #include <stdio.h>
+#include <string.h>
 
 static test_fixture_t * set_up();
 static void tear_down( test_fixture_t *fix );
 static test_case_result_t create_new_db( test_fixture_t *fix );
 static test_case_result_t open_existing_db( test_fixture_t *fix );
 static test_case_result_t open_invalid_file( test_fixture_t *fix );
+static test_case_result_t write_back_changes( test_fixture_t *fix );
+static test_case_result_t span_export_reports_progress( test_fixture_t *fix );
+static test_case_result_t write_back_middle_diagram( test_fixture_t *fix );
+static size_t read_file( const char *filename, char *out_buf, size_t buf_size );
+static data_row_t create_diagram_with_classifier( test_fixture_t *fix,
+                                                  data_row_t parent_diagram_id,
+                                                  const char *diagram_name,
+                                                  const char *classifier_name,
+                                                  data_row_t *out_classifier_id
+                                                );
 
 /*!
  *  \brief database filename on which the tests are performed and which is automatically deleted when finished
  */
 static const char DATABASE_FILENAME[] = "unittest_crystal_facet_uml_default.cfuJ";
 static const char DATABASE_TEMPNAME[] = "unittest_crystal_facet_uml_default.tmp-cfu";
+static const char EXPORT_FILENAME[] = "unittest_crystal_facet_uml_export.json";
 
 test_suite_t io_data_file_test_get_suite(void)
 {
@@ -32,11 +46,19 @@ test_suite_t io_data_file_test_get_suite(void)
     test_suite_add_test_case( &result, "create_new_db", &create_new_db );
     test_suite_add_test_case( &result, "open_existing_db", &open_existing_db );
     test_suite_add_test_case( &result, "open_invalid_file", &open_invalid_file );
+    test_suite_add_test_case( &result, "write_back_changes", &write_back_changes );
+    test_suite_add_test_case( &result, "span_export_reports_progress", &span_export_reports_progress );
+    test_suite_add_test_case( &result, "write_back_middle_diagram", &write_back_middle_diagram );
     return result;
 }
 
 struct test_fixture_struct {
     io_data_file_t data_file;  /*!< data_file instance on which the tests are performed */
+    char delta_content[16384];  /*!< content of a json file written as delta */
+    char full_content[16384];  /*!< content of a json file written completely */
+    io_export_span_list_t spans;  /*!< span list recorded by an export */
+    char previous_content[16384];  /*!< content of a json file before writing back a delta */
+    uint32_t report_count;  /*!< number of progress listener calls */
 };
 typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
 static test_fixture_t test_fixture;
@@ -83,6 +105,24 @@ static test_case_result_t create_new_db( test_fixture_t *fix )
     isopen = io_data_file_is_open( &((*fix).data_file) );
     TEST_EXPECT_EQUAL_INT( true, isopen );
 
+    /* the json file is the durable copy, the temporary database uses the write-ahead log */
+    data_database_t *const database = io_data_file_get_database_ptr( &((*fix).data_file) );
+    TEST_EXPECT_EQUAL_INT( DATA_DATABASE_PROFILE_WORKING_COPY, data_database_get_profile( database ) );
+    sqlite3_stmt *journal_statement = NULL;
+    const int prepare_err = sqlite3_prepare_v2( data_database_get_database_ptr( database ),
+                                                "PRAGMA journal_mode;",
+                                                -1,
+                                                &journal_statement,
+                                                NULL
+                                              );
+    TEST_EXPECT_EQUAL_INT( SQLITE_OK, prepare_err );
+    TEST_EXPECT_EQUAL_INT( SQLITE_ROW, sqlite3_step( journal_statement ) );
+    TEST_EXPECT_EQUAL_STRING( "wal", (const char*) sqlite3_column_text( journal_statement, 0 ) );
+    sqlite3_finalize( journal_statement );
+
+    ctrl_err = io_data_file_trace_stats( &((*fix).data_file) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, ctrl_err, u8_error_get_name );
+
     ctrl_err = io_data_file_close ( &((*fix).data_file) );
     TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, ctrl_err, u8_error_get_name );
 
@@ -169,6 +209,394 @@ static test_case_result_t open_invalid_file( test_fixture_t *fix )
 }
 
 
+static test_case_result_t write_back_changes( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_data_file_t *data_file = &((*fix).data_file);
+    u8_error_t data_err;
+
+    u8_error_info_t err_info;
+    data_stat_t stat;
+    data_stat_init( &stat );
+    data_err = io_data_file_open_writeable( data_file, DATABASE_FILENAME, &stat, &err_info );
+    data_stat_destroy( &stat );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    ctrl_controller_t *controller = io_data_file_get_controller_ptr( data_file );
+    ctrl_diagram_controller_t *diag_ctrl = ctrl_controller_get_diagram_control_ptr( controller );
+    ctrl_classifier_controller_t *classifier_ctrl = ctrl_controller_get_classifier_control_ptr( controller );
+
+    /* create a diagram showing two related classifiers */
+    data_row_t diagram_id;
+    data_err = ctrl_diagram_controller_create_root_diagram_if_not_exists( diag_ctrl,
+                                                                          DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM,
+                                                                          "the_root",
+                                                                          &diagram_id
+                                                                        );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_row_t classifier_id[2];
+    for ( uint_fast32_t index = 0; index < 2; index ++ )
+    {
+        data_classifier_t classifier;
+        data_err = data_classifier_init_new( &classifier,
+                                             DATA_CLASSIFIER_TYPE_CLASS,
+                                             "",
+                                             ( index == 0 ) ? "first_class" : "second_class",
+                                             "",
+                                             0,
+                                             0,
+                                             0
+                                           );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_err = ctrl_classifier_controller_create_classifier( classifier_ctrl,
+                                                                 &classifier,
+                                                                 CTRL_UNDO_REDO_ACTION_BOUNDARY_START_NEW,
+                                                                 &(classifier_id[index])
+                                                               );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_classifier_destroy( &classifier );
+
+        data_diagramelement_t diagramelement;
+        data_id_t lifeline_id;
+        data_diagramelement_init_new( &diagramelement,
+                                      diagram_id,
+                                      classifier_id[index],
+                                      DATA_DIAGRAMELEMENT_FLAG_NONE,
+                                      DATA_ROW_VOID
+                                    );
+        data_err = ctrl_diagram_controller_create_diagramelement( diag_ctrl,
+                                                                  &diagramelement,
+                                                                  CTRL_UNDO_REDO_ACTION_BOUNDARY_APPEND,
+                                                                  NULL,
+                                                                  &lifeline_id
+                                                                );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_diagramelement_destroy( &diagramelement );
+    }
+    data_relationship_t relationship;
+    data_err = data_relationship_init_new( &relationship,
+                                           classifier_id[1],
+                                           DATA_ROW_VOID,
+                                           classifier_id[0],
+                                           DATA_ROW_VOID,
+                                           DATA_RELATIONSHIP_TYPE_UML_DEPENDENCY,
+                                           "",
+                                           "uses",
+                                           "",
+                                           0
+                                         );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_err = ctrl_classifier_controller_create_relationship( classifier_ctrl,
+                                                               &relationship,
+                                                               CTRL_UNDO_REDO_ACTION_BOUNDARY_START_NEW,
+                                                               NULL
+                                                             );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_relationship_destroy( &relationship );
+
+    /* the first sync writes the complete file */
+    data_err = io_data_file_sync_to_disk( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( true, io_export_span_list_is_complete( &((*data_file).json_spans) ) );
+
+    /* rename the relationship target, this affects the classifier, the diagram and the relationship */
+    data_err = ctrl_classifier_controller_update_classifier_name( classifier_ctrl, classifier_id[0], "renamed_class" );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* the second sync writes a delta */
+    data_err = io_data_file_sync_to_disk( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( true, io_export_span_list_is_complete( &((*data_file).json_spans) ) );
+    const size_t delta_len = read_file( DATABASE_FILENAME, &((*fix).delta_content[0]), sizeof((*fix).delta_content) );
+    TEST_EXPECT( delta_len > 0 );
+    TEST_EXPECT( NULL == strstr( &((*fix).delta_content[0]), "first_class" ) );
+    TEST_EXPECT( NULL != strstr( &((*fix).delta_content[0]), "second_class" ) );
+
+    /* a complete export shall produce the same file */
+    io_export_span_list_invalidate( &((*data_file).json_spans) );
+    data_err = io_data_file_sync_to_disk( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    const size_t full_len = read_file( DATABASE_FILENAME, &((*fix).full_content[0]), sizeof((*fix).full_content) );
+    TEST_EXPECT_EQUAL_INT( full_len, delta_len );
+    TEST_EXPECT_EQUAL_INT( 0, memcmp( &((*fix).delta_content[0]), &((*fix).full_content[0]), full_len ) );
+
+    data_err = io_data_file_close( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    return TEST_CASE_RESULT_OK;
+}
+
+static void count_progress_reports( test_fixture_t *fix, const io_progress_t *progress )
+{
+    assert( fix != NULL );
+    assert( progress != NULL );
+    (*fix).report_count ++;
+}
+
+static uint32_t export_with_progress( test_fixture_t *fix, io_export_span_list_t *io_spans )
+{
+    assert( fix != NULL );
+    data_database_reader_t db_reader;
+    data_database_reader_init( &db_reader, io_data_file_get_database_ptr( &((*fix).data_file) ) );
+    static io_exporter_t exporter;
+    io_exporter_init( &exporter, &db_reader );
+    data_stat_t stat;
+    data_stat_init( &stat );
+    io_progress_t progress;
+    io_progress_init( &progress, &stat, fix, (void (*)(void*,const io_progress_t*)) &count_progress_reports );
+    io_progress_set_interval( &progress, 0 );  /* report on every tick */
+    io_exporter_set_progress( &exporter, &progress );
+
+    (*fix).report_count = 0;
+    const u8_error_t export_err
+        = io_exporter_export_json_file( &exporter, "title", EXPORT_FILENAME, NULL, NULL, io_spans, &stat );
+    assert( export_err == U8_ERROR_NONE );
+    (void) export_err;
+
+    io_exporter_set_progress( &exporter, NULL );
+    io_progress_destroy( &progress );
+    data_stat_destroy( &stat );
+    io_exporter_destroy( &exporter );
+    data_database_reader_destroy( &db_reader );
+    return (*fix).report_count;
+}
+
+static test_case_result_t span_export_reports_progress( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_data_file_t *data_file = &((*fix).data_file);
+    u8_error_t data_err;
+
+    u8_error_info_t err_info;
+    data_stat_t stat;
+    data_stat_init( &stat );
+    data_err = io_data_file_open_writeable( data_file, DATABASE_FILENAME, &stat, &err_info );
+    data_stat_destroy( &stat );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    ctrl_controller_t *controller = io_data_file_get_controller_ptr( data_file );
+    ctrl_classifier_controller_t *classifier_ctrl = ctrl_controller_get_classifier_control_ptr( controller );
+    static const char *const NAMES[5] = { "alpha", "beta", "gamma", "delta", "epsilon" };
+    uint32_t reports_before = 0;
+    for ( uint_fast32_t index = 0; index < 5; index ++ )
+    {
+        if ( index == 2 )
+        {
+            io_export_span_list_init( &((*fix).spans) );
+            reports_before = export_with_progress( fix, &((*fix).spans) );
+            io_export_span_list_destroy( &((*fix).spans) );
+        }
+        data_classifier_t classifier;
+        data_err = data_classifier_init_new( &classifier, DATA_CLASSIFIER_TYPE_CLASS, "", NAMES[index], "", 0, 0, 0 );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_row_t classifier_id;
+        data_err = ctrl_classifier_controller_create_classifier( classifier_ctrl,
+                                                                 &classifier,
+                                                                 CTRL_UNDO_REDO_ACTION_BOUNDARY_START_NEW,
+                                                                 &classifier_id
+                                                               );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        data_classifier_destroy( &classifier );
+    }
+
+    /* the span-recording export ticks once per classifier in the nodes pass and once in the edges pass */
+    io_export_span_list_init( &((*fix).spans) );
+    const uint32_t reports_after = export_with_progress( fix, &((*fix).spans) );
+    TEST_EXPECT_EQUAL_INT( true, io_export_span_list_is_complete( &((*fix).spans) ) );
+    io_export_span_list_destroy( &((*fix).spans) );
+    TEST_EXPECT_EQUAL_INT( reports_before + ( 2 * 3 ), reports_after );
+
+    const int stdio_err = remove( EXPORT_FILENAME );
+    TEST_ENVIRONMENT_ASSERT ( 0 == stdio_err );
+    data_err = io_data_file_close( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    return TEST_CASE_RESULT_OK;
+}
+
+static data_row_t create_diagram_with_classifier( test_fixture_t *fix,
+                                                  data_row_t parent_diagram_id,
+                                                  const char *diagram_name,
+                                                  const char *classifier_name,
+                                                  data_row_t *out_classifier_id )
+{
+    assert( fix != NULL );
+    assert( out_classifier_id != NULL );
+    ctrl_controller_t *controller = io_data_file_get_controller_ptr( &((*fix).data_file) );
+    ctrl_diagram_controller_t *diag_ctrl = ctrl_controller_get_diagram_control_ptr( controller );
+    ctrl_classifier_controller_t *classifier_ctrl = ctrl_controller_get_classifier_control_ptr( controller );
+    u8_error_t data_err;
+
+    data_diagram_t diagram;
+    data_err = data_diagram_init_new( &diagram,
+                                      parent_diagram_id,
+                                      DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM,
+                                      "",
+                                      diagram_name,
+                                      "",
+                                      0,
+                                      DATA_DIAGRAM_FLAG_NONE
+                                    );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_row_t diagram_id;
+    data_err = ctrl_diagram_controller_create_diagram( diag_ctrl, &diagram, CTRL_UNDO_REDO_ACTION_BOUNDARY_START_NEW, &diagram_id );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_diagram_destroy( &diagram );
+
+    data_classifier_t classifier;
+    data_err = data_classifier_init_new( &classifier, DATA_CLASSIFIER_TYPE_CLASS, "", classifier_name, "", 0, 0, 0 );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_err = ctrl_classifier_controller_create_classifier( classifier_ctrl,
+                                                             &classifier,
+                                                             CTRL_UNDO_REDO_ACTION_BOUNDARY_APPEND,
+                                                             out_classifier_id
+                                                           );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_classifier_destroy( &classifier );
+
+    data_diagramelement_t diagramelement;
+    data_id_t lifeline_id;
+    data_diagramelement_init_new( &diagramelement, diagram_id, *out_classifier_id, DATA_DIAGRAMELEMENT_FLAG_NONE, DATA_ROW_VOID );
+    data_err = ctrl_diagram_controller_create_diagramelement( diag_ctrl,
+                                                              &diagramelement,
+                                                              CTRL_UNDO_REDO_ACTION_BOUNDARY_APPEND,
+                                                              NULL,
+                                                              &lifeline_id
+                                                            );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == data_err );
+    data_diagramelement_destroy( &diagramelement );
+
+    return diagram_id;
+}
+
+static test_case_result_t write_back_middle_diagram( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_data_file_t *data_file = &((*fix).data_file);
+    u8_error_t data_err;
+
+    u8_error_info_t err_info;
+    data_stat_t stat;
+    data_stat_init( &stat );
+    data_err = io_data_file_open_writeable( data_file, DATABASE_FILENAME, &stat, &err_info );
+    data_stat_destroy( &stat );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* three diagrams, each showing an own classifier, are written one after the other */
+    static const char *const DIAGRAM_NAMES[3] = { "first_diagram", "middle_diagram", "last_diagram" };
+    static const char *const CLASSIFIER_NAMES[3] = { "first_class", "middle_class", "last_class" };
+    data_row_t diagram_id[3];
+    data_row_t classifier_id[3];
+    diagram_id[0] = create_diagram_with_classifier( fix, DATA_ROW_VOID, DIAGRAM_NAMES[0], CLASSIFIER_NAMES[0], &(classifier_id[0]) );
+    for ( uint_fast32_t index = 1; index < 3; index ++ )
+    {
+        diagram_id[index]
+            = create_diagram_with_classifier( fix, diagram_id[0], DIAGRAM_NAMES[index], CLASSIFIER_NAMES[index], &(classifier_id[index]) );
+    }
+
+    /* the first sync writes the complete file */
+    data_err = io_data_file_sync_to_disk( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( true, io_export_span_list_is_complete( &((*data_file).json_spans) ) );
+    const size_t previous_len
+        = read_file( DATABASE_FILENAME, &((*fix).previous_content[0]), sizeof((*fix).previous_content) );
+    TEST_EXPECT( previous_len > 0 );
+    (*fix).spans = (*data_file).json_spans;
+
+    /* rename the classifier of the middle diagram, this changes the middle diagram and the classifier only */
+    ctrl_controller_t *controller = io_data_file_get_controller_ptr( data_file );
+    ctrl_classifier_controller_t *classifier_ctrl = ctrl_controller_get_classifier_control_ptr( controller );
+    data_err = ctrl_classifier_controller_update_classifier_name( classifier_ctrl, classifier_id[1], "renamed_class" );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* the second sync writes a delta, copying the spans of the first and the last diagram verbatim */
+    data_err = io_data_file_sync_to_disk( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    const io_export_span_list_t *const delta_spans = &((*data_file).json_spans);
+    TEST_EXPECT_EQUAL_INT( true, io_export_span_list_is_complete( delta_spans ) );
+    const size_t delta_len = read_file( DATABASE_FILENAME, &((*fix).delta_content[0]), sizeof((*fix).delta_content) );
+    TEST_EXPECT( NULL == strstr( &((*fix).delta_content[0]), "middle_class" ) );
+    TEST_EXPECT( NULL != strstr( &((*fix).delta_content[0]), "renamed_class" ) );
+
+    /* each span of an unchanged object is byte-identical to its previous span */
+    const uint32_t span_count = io_export_span_list_get_count( delta_spans );
+    TEST_EXPECT_EQUAL_INT( io_export_span_list_get_count( &((*fix).spans) ), span_count );
+    uint32_t identical_count = 0;
+    for ( uint32_t index = 0; index < span_count; index ++ )
+    {
+        const json_writer_pass_t pass = io_export_span_list_get_pass( delta_spans, index );
+        const data_row_t row = io_export_span_list_get_row( delta_spans, index );
+        TEST_EXPECT_EQUAL_INT( pass, io_export_span_list_get_pass( &((*fix).spans), index ) );
+        TEST_EXPECT_EQUAL_INT( row, io_export_span_list_get_row( &((*fix).spans), index ) );
+        const size_t start = io_export_span_list_get_start( delta_spans, index );
+        const size_t len = io_export_span_list_get_end( delta_spans, index ) - start;
+        const size_t previous_start = io_export_span_list_get_start( &((*fix).spans), index );
+        const size_t previous_len_of_span = io_export_span_list_get_end( &((*fix).spans), index ) - previous_start;
+        /* the middle classifier has no relationships, its span in the edges pass is unchanged */
+        const bool changed
+            = (( pass == JSON_WRITER_PASS_VIEWS )&&( row == diagram_id[1] ))
+            || (( pass == JSON_WRITER_PASS_NODES )&&( row == classifier_id[1] ));
+        const bool identical
+            = ( len == previous_len_of_span )
+            && ( 0 == memcmp( &((*fix).delta_content[start]), &((*fix).previous_content[previous_start]), len ) );
+        TEST_EXPECT_EQUAL_INT( ! changed, identical );
+        identical_count += ( identical ? 1 : 0 );
+    }
+    TEST_EXPECT( identical_count >= 2 );  /* at least the first and the last diagram */
+
+    /* a complete export produces the same file */
+    io_export_span_list_invalidate( &((*data_file).json_spans) );
+    data_err = io_data_file_sync_to_disk( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    const size_t full_len = read_file( DATABASE_FILENAME, &((*fix).full_content[0]), sizeof((*fix).full_content) );
+    TEST_EXPECT_EQUAL_INT( full_len, delta_len );
+    TEST_EXPECT_EQUAL_INT( 0, memcmp( &((*fix).delta_content[0]), &((*fix).full_content[0]), full_len ) );
+    data_err = io_data_file_close( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+
+    /* importing the written file reproduces the model */
+    data_stat_init( &stat );
+    data_err = io_data_file_open_writeable( data_file, DATABASE_FILENAME, &stat, &err_info );
+    data_stat_destroy( &stat );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    data_database_reader_t db_reader;
+    data_database_reader_init( &db_reader, io_data_file_get_database_ptr( data_file ) );
+    for ( uint_fast32_t index = 0; index < 3; index ++ )
+    {
+        static data_diagram_t diagram;
+        data_err = data_database_reader_get_diagram_by_id( &db_reader, diagram_id[index], &diagram );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        TEST_EXPECT_EQUAL_STRING( DIAGRAM_NAMES[index], data_diagram_get_name_const( &diagram ) );
+        TEST_EXPECT_EQUAL_INT( ( index == 0 ) ? DATA_ROW_VOID : diagram_id[0], data_diagram_get_parent_row( &diagram ) );
+
+        static data_classifier_t classifier;
+        data_err = data_database_reader_get_classifier_by_id( &db_reader, classifier_id[index], &classifier );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+        TEST_EXPECT_EQUAL_STRING( ( index == 1 ) ? "renamed_class" : CLASSIFIER_NAMES[index],
+                                  data_classifier_get_name_const( &classifier )
+                                );
+    }
+    data_database_reader_destroy( &db_reader );
+
+    data_err = io_data_file_close( data_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    return TEST_CASE_RESULT_OK;
+}
+
+static size_t read_file( const char *filename, char *out_buf, size_t buf_size )
+{
+    assert( filename != NULL );
+    assert( out_buf != NULL );
+    assert( buf_size > 0 );
+    size_t result = 0;
+    FILE *file = fopen( filename, "r" );
+    if ( file != NULL )
+    {
+        result = fread( out_buf, 1, buf_size - 1, file );
+        fclose( file );
+    }
+    out_buf[result] = '\0';
+    return result;
+}
+
 /*
  * Copyright 2018-2026 Andreas Warnke
  *
@@ -0,0 +1,223 @@
+/* File: io_export_image_pool_test.c; Copyright and License: see below */
+
+#include "io_export_image_pool_test.h"
+#include "io_export_image_pool.h"
+#include "io_exporter.h"
+#include "tvec/tvec_setup.h"
+#include "set/data_stat.h"
+#include "ctrl_controller.h"
+#include "storage/data_database.h"
+#include "storage/data_database_reader.h"
+#include "u8/u8_trace.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <stdio.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t export_in_parallel( test_fixture_t *fix );
+static test_case_result_t fallback_in_memory( test_fixture_t *fix );
+static test_case_result_t job_list_limits( test_fixture_t *fix );
+static bool remove_file_if_exists( const char *filename );
+
+/*!
+ *  \brief database filename on which the tests are performed and which is automatically deleted when finished
+ */
+static const char DATABASE_FILENAME[] = "unittest_crystal_facet_uml_image_pool.cfu1";
+
+test_suite_t io_export_image_pool_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "io_export_image_pool_test",
+                     TEST_CATEGORY_INTEGRATION | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "export_in_parallel", &export_in_parallel );
+    test_suite_add_test_case( &result, "fallback_in_memory", &fallback_in_memory );
+    test_suite_add_test_case( &result, "job_list_limits", &job_list_limits );
+    return result;
+}
+
+struct test_fixture_struct {
+    data_database_t database;  /*!< database instance on which the tests are performed */
+    data_database_reader_t db_reader;  /*!< database reader to access the database */
+    ctrl_controller_t controller;  /*!< controller instance on which the tests are performed */
+    io_exporter_t exporter;  /*!< exporter that uses the image_pool */
+    io_export_image_pool_t image_pool;  /*!< worker pool on which the tests are performed */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    const int stdio_err = remove( DATABASE_FILENAME );
+    (void) stdio_err;  /* do not care for errors */
+
+    test_fixture_t *fix = &test_fixture;
+    data_database_init( &((*fix).database) );
+    data_database_open( &((*fix).database), DATABASE_FILENAME );
+    data_database_reader_init( &((*fix).db_reader), &((*fix).database) );
+    ctrl_controller_init( &((*fix).controller), &((*fix).database) );
+    io_exporter_init( &((*fix).exporter), &((*fix).db_reader) );
+    io_export_image_pool_init( &((*fix).image_pool), 3 );
+    io_exporter_set_image_pool( &((*fix).exporter), &((*fix).image_pool) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_export_image_pool_destroy( &((*fix).image_pool) );
+    io_exporter_destroy( &((*fix).exporter) );
+    ctrl_controller_destroy( &((*fix).controller) );
+    data_database_reader_destroy( &((*fix).db_reader) );
+    data_database_close( &((*fix).database) );
+    data_database_destroy( &((*fix).database) );
+    const int stdio_err = remove( DATABASE_FILENAME );
+    TEST_ENVIRONMENT_ASSERT ( 0 == stdio_err );
+}
+
+static test_case_result_t export_in_parallel( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    TEST_EXPECT( data_database_is_file( &((*fix).database) ) );
+
+    /* create a tree of 5 diagrams */
+    tvec_setup_t test_env;
+    tvec_setup_init( &test_env, &((*fix).controller) );
+    const data_row_t root = tvec_setup_diagram( &test_env, DATA_ROW_VOID, "root", DATA_DIAGRAM_TYPE_UML_PACKAGE_DIAGRAM );
+    const data_row_t left = tvec_setup_diagram( &test_env, root, "left", DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM );
+    const data_row_t right = tvec_setup_diagram( &test_env, root, "right", DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM );
+    const data_row_t leaf = tvec_setup_diagram( &test_env, left, "leaf", DATA_DIAGRAM_TYPE_UML_COMPONENT_DIAGRAM );
+    const data_row_t other = tvec_setup_diagram( &test_env, DATA_ROW_VOID, "other", DATA_DIAGRAM_TYPE_UML_PACKAGE_DIAGRAM );
+    TEST_EXPECT_EQUAL_INT( 1, root );
+    TEST_EXPECT_EQUAL_INT( 5, other );
+    (void) right;
+    const data_row_t classifier = tvec_setup_classifier( &test_env, "shown" );
+    tvec_setup_diagramelement( &test_env, root, classifier );
+    tvec_setup_diagramelement( &test_env, leaf, classifier );
+    tvec_setup_destroy( &test_env );
+
+    /* export */
+    data_stat_t stat;
+    data_stat_init( &stat );
+    const u8_error_t export_err
+        = io_exporter_export_files( &((*fix).exporter), IO_FILE_FORMAT_SVG | IO_FILE_FORMAT_PNG, ".", "doc", &stat );
+    data_stat_destroy( &stat );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, export_err, u8_error_get_name );
+
+    /* the job list is cleared when finished */
+    TEST_EXPECT_EQUAL_INT( 0, io_export_image_pool_get_job_count( &((*fix).image_pool) ) );
+
+    /* check that all files exist */
+    TEST_EXPECT( remove_file_if_exists( "./D0001_root.svg" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0001_root.png" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0002_left.svg" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0002_left.png" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0003_right.svg" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0003_right.png" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0004_leaf.svg" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0004_leaf.png" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0005_other.svg" ) );
+    TEST_EXPECT( remove_file_if_exists( "./D0005_other.png" ) );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t fallback_in_memory( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+
+    /* workers cannot open an in-memory database */
+    static data_database_t mem_database;
+    data_database_init( &mem_database );
+    data_database_open_in_memory( &mem_database );
+    TEST_EXPECT( ! data_database_is_file( &mem_database ) );
+    static data_database_reader_t mem_reader;
+    data_database_reader_init( &mem_reader, &mem_database );
+    TEST_EXPECT( NULL == data_database_reader_get_filename_ptr( &mem_reader ) );
+    static ctrl_controller_t mem_controller;
+    ctrl_controller_init( &mem_controller, &mem_database );
+
+    tvec_setup_t test_env;
+    tvec_setup_init( &test_env, &mem_controller );
+    const data_row_t root = tvec_setup_diagram( &test_env, DATA_ROW_VOID, "mem", DATA_DIAGRAM_TYPE_UML_PACKAGE_DIAGRAM );
+    TEST_EXPECT_EQUAL_INT( 1, root );
+    tvec_setup_destroy( &test_env );
+
+    /* export one after the other */
+    static io_exporter_t mem_exporter;
+    io_exporter_init( &mem_exporter, &mem_reader );
+    io_exporter_set_image_pool( &mem_exporter, &((*fix).image_pool) );
+    data_stat_t stat;
+    data_stat_init( &stat );
+    const u8_error_t export_err = io_exporter_export_files( &mem_exporter, IO_FILE_FORMAT_PDF, ".", "doc", &stat );
+    data_stat_destroy( &stat );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, export_err, u8_error_get_name );
+    io_exporter_destroy( &mem_exporter );
+
+    TEST_EXPECT( remove_file_if_exists( "./D0001_mem.pdf" ) );
+
+    ctrl_controller_destroy( &mem_controller );
+    data_database_reader_destroy( &mem_reader );
+    data_database_close( &mem_database );
+    data_database_destroy( &mem_database );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t job_list_limits( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_export_image_pool_t *const pool = &((*fix).image_pool);
+    const data_id_t diagram_id = DATA_ID( DATA_TABLE_DIAGRAM, 7 );
+
+    /* a basename that does not fit */
+    char long_name[IO_EXPORT_IMAGE_POOL_MAX_BASENAME + 1];
+    memset( &long_name, 'x', sizeof(long_name) - 1 );
+    long_name[sizeof(long_name) - 1] = '\0';
+    u8_error_t add_err = io_export_image_pool_add_job( pool, diagram_id, long_name );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_STRING_BUFFER_EXCEEDED, add_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 0, io_export_image_pool_get_job_count( pool ) );
+
+    /* fill the job list */
+    for ( uint32_t index = 0; index < IO_EXPORT_IMAGE_POOL_MAX_JOBS; index ++ )
+    {
+        add_err = io_export_image_pool_add_job( pool, diagram_id, "D0007_name" );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, add_err, u8_error_get_name );
+    }
+    add_err = io_export_image_pool_add_job( pool, diagram_id, "D0007_name" );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_ARRAY_BUFFER_EXCEEDED, add_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( IO_EXPORT_IMAGE_POOL_MAX_JOBS, io_export_image_pool_get_job_count( pool ) );
+
+    io_export_image_pool_clear_jobs( pool );
+    TEST_EXPECT_EQUAL_INT( 0, io_export_image_pool_get_job_count( pool ) );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static bool remove_file_if_exists( const char *filename )
+{
+    const int stdio_err = remove( filename );
+    return ( 0 == stdio_err );
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
@@ -0,0 +1,33 @@
+/* File: io_export_image_pool_test.h; Copyright and License: see below */
+
+#ifndef IO_EXPORT_IMAGE_POOL_TEST_H
+#define IO_EXPORT_IMAGE_POOL_TEST_H
+
+/*!
+ *  \file
+ *  \brief MODULE TEST for io_export_image_pool and io_exporter,
+ *  focussing on rendering diagram images on worker threads
+ */
+
+#include "test_suite.h"
+
+test_suite_t io_export_image_pool_test_get_suite(void);
+
+#endif  /* IO_EXPORT_IMAGE_POOL_TEST_H */
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
@@ -401,7 +401,8 @@ static test_case_result_t iterate_types_on_mini_model( test_fixture_t *fix )
                                                             &((*fix).db_reader),
                                                             &temp_input_data,
                                                             &stat,
-                                                            xmi_element_writer_get_element_writer( &temp_xmi_writer )
+                                                            xmi_element_writer_get_element_writer( &temp_xmi_writer ),
+                                                            NULL /* no progress */
                                                           );
                             /* write the document */
                             u8_error_t export_err = 0;
@@ -2,6 +2,7 @@
 
 #include "io_importer_test.h"
 #include "io_importer.h"
+#include "io_progress.h"
 #include "set/data_stat.h"
 #include "ctrl_controller.h"
 #include "storage/data_database.h"
@@ -11,6 +12,7 @@
 #include "u8stream/universal_memory_input_stream.h"
 #include "u8stream/universal_memory_output_stream.h"
 #include "u8/u8_trace.h"
+#include <stdio.h>
 #include "test_fixture.h"
 #include "test_expect.h"
 #include "test_environment_assert.h"
@@ -28,9 +30,23 @@ static test_case_result_t insert_existing_classifier_to_new_diagram( test_fixtur
 static test_case_result_t insert_unconditional_relationships( test_fixture_t *fix );
 static test_case_result_t insert_relationships_to_non_scenario( test_fixture_t *fix );
 static test_case_result_t insert_scenario_relationships_to_scenario( test_fixture_t *fix );
+static test_case_result_t import_with_progress( test_fixture_t *fix );
+static test_case_result_t import_cancelled_by_listener( test_fixture_t *fix );
+static test_case_result_t import_many_relationships( test_fixture_t *fix );
 
 static data_row_t create_root_diag( ctrl_controller_t *controller );  /* helper function */
 
+/*!
+ *  \brief listener of an io_progress_t that counts the reports and cancels at a given report
+ */
+struct progress_listener_struct {
+    io_progress_t *progress;  /*!< the observed progress */
+    uint32_t report_count;  /*!< number of reports */
+    uint32_t cancel_at;  /*!< number of the report that cancels the progress, 0 for never */
+};
+typedef struct progress_listener_struct progress_listener_t;
+static void progress_listener_report( progress_listener_t *this_, const io_progress_t *progress );  /* helper function */
+
 test_suite_t io_importer_test_get_suite(void)
 {
     test_suite_t result;
@@ -50,6 +66,9 @@ test_suite_t io_importer_test_get_suite(void)
     test_suite_add_test_case( &result, "insert_unconditional_relationships", &insert_unconditional_relationships );
     test_suite_add_test_case( &result, "insert_relationships_to_non_scenario", &insert_relationships_to_non_scenario );
     test_suite_add_test_case( &result, "insert_scenario_relationships_to_scenario", &insert_scenario_relationships_to_scenario );
+    test_suite_add_test_case( &result, "import_with_progress", &import_with_progress );
+    test_suite_add_test_case( &result, "import_cancelled_by_listener", &import_cancelled_by_listener );
+    test_suite_add_test_case( &result, "import_many_relationships", &import_many_relationships );
     return result;
 }
 
@@ -933,6 +952,254 @@ static test_case_result_t insert_scenario_relationships_to_scenario( test_fixtur
     return TEST_CASE_RESULT_OK;
 }
 
+static void progress_listener_report( progress_listener_t *this_, const io_progress_t *progress )
+{
+    assert( progress == (*this_).progress );
+    (*this_).report_count ++;
+    if ( (*this_).report_count == (*this_).cancel_at )
+    {
+        io_progress_cancel( (*this_).progress );
+    }
+}
+
+static test_case_result_t import_with_progress( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_importer_t importer;
+    io_importer_init ( &importer, &((*fix).db_reader), &((*fix).controller) );
+
+    data_stat_t stat;
+    data_stat_init(&stat);
+    io_progress_t progress;
+    progress_listener_t listener = { .progress = &progress, .report_count = 0, .cancel_at = 0 };
+    io_progress_init( &progress, &stat, &listener, (void (*)(void*,const io_progress_t*)) &progress_listener_report );
+    io_progress_set_interval( &progress, 0 );
+    io_importer_set_progress( &importer, &progress );
+
+    char report_buffer[32];
+    universal_memory_output_stream_t report_stream;
+    universal_memory_output_stream_init( &report_stream, &report_buffer, sizeof(report_buffer), UNIVERSAL_MEMORY_OUTPUT_STREAM_0TERM_UTF8 );
+    utf8stream_writer_t report;
+    utf8stream_writer_init( &report, universal_memory_output_stream_get_output_stream( &report_stream ) );
+
+    const size_t json_len = utf8string_get_length( test_json_own_diagram );
+    universal_memory_input_stream_t mem_json;
+    universal_memory_input_stream_init( &mem_json, test_json_own_diagram, json_len );
+
+    u8_error_info_t read_pos;
+    const u8_error_t data_err
+        = io_importer_import_stream( &importer,
+                                     IO_IMPORT_MODE_IMPORT,
+                                     universal_memory_input_stream_get_input_stream( &mem_json ),
+                                     &stat,
+                                     &read_pos,
+                                     &report
+                                   );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 8, data_stat_get_total_count( &stat ) );
+
+    /* the file is read once per pass */
+    TEST_EXPECT_EQUAL_INT( 3, io_progress_get_phase_count( &progress ) );
+    TEST_EXPECT_EQUAL_STRING( "check", io_progress_get_phase_name( &progress, 0 ) );
+    TEST_EXPECT_EQUAL_STRING( "create", io_progress_get_phase_name( &progress, 1 ) );
+    TEST_EXPECT_EQUAL_STRING( "link", io_progress_get_phase_name( &progress, 2 ) );
+    TEST_EXPECT_EQUAL_INT( 3 * json_len, io_progress_get_byte_count( &progress ) );
+    /* 3 phase starts, 1 phase end and at least one tick per pass */
+    TEST_EXPECT( listener.report_count >= 7 );
+    TEST_EXPECT_EQUAL_INT( false, io_progress_is_cancelled( &progress ) );
+
+    universal_memory_input_stream_destroy( &mem_json );
+    utf8stream_writer_destroy( &report );
+    universal_memory_output_stream_destroy( &report_stream );
+    io_importer_set_progress( &importer, NULL );
+    io_progress_destroy( &progress );
+    data_stat_destroy(&stat);
+    io_importer_destroy ( &importer );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t import_cancelled_by_listener( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_importer_t importer;
+    io_importer_init ( &importer, &((*fix).db_reader), &((*fix).controller) );
+
+    data_stat_t stat;
+    data_stat_init(&stat);
+    io_progress_t progress;
+    progress_listener_t listener = { .progress = &progress, .report_count = 0, .cancel_at = 2 };
+    io_progress_init( &progress, &stat, &listener, (void (*)(void*,const io_progress_t*)) &progress_listener_report );
+    io_progress_set_interval( &progress, 0 );
+    io_importer_set_progress( &importer, &progress );
+
+    char report_buffer[32];
+    universal_memory_output_stream_t report_stream;
+    universal_memory_output_stream_init( &report_stream, &report_buffer, sizeof(report_buffer), UNIVERSAL_MEMORY_OUTPUT_STREAM_0TERM_UTF8 );
+    utf8stream_writer_t report;
+    utf8stream_writer_init( &report, universal_memory_output_stream_get_output_stream( &report_stream ) );
+
+    universal_memory_input_stream_t mem_json;
+    universal_memory_input_stream_init( &mem_json, test_json_own_diagram, utf8string_get_length( test_json_own_diagram ) );
+
+    /* the first tick of the check pass cancels the import, nothing is created */
+    u8_error_info_t read_pos;
+    const u8_error_t data_err
+        = io_importer_import_stream( &importer,
+                                     IO_IMPORT_MODE_IMPORT,
+                                     universal_memory_input_stream_get_input_stream( &mem_json ),
+                                     &stat,
+                                     &read_pos,
+                                     &report
+                                   );
+    TEST_EXPECT( u8_error_contains( data_err, U8_ERROR_CANCELLED ) );
+    TEST_EXPECT_EQUAL_INT( true, io_progress_is_cancelled( &progress ) );
+    TEST_EXPECT_EQUAL_INT( 1, io_progress_get_phase_count( &progress ) );
+    TEST_EXPECT_EQUAL_INT( 0, data_stat_get_series_count( &stat, DATA_STAT_SERIES_CREATED ) );
+
+    universal_memory_input_stream_destroy( &mem_json );
+    utf8stream_writer_destroy( &report );
+    universal_memory_output_stream_destroy( &report_stream );
+    io_importer_set_progress( &importer, NULL );
+    io_progress_destroy( &progress );
+    data_stat_destroy(&stat);
+    io_importer_destroy ( &importer );
+    return TEST_CASE_RESULT_OK;
+}
+
+/*!
+ *  \brief number of classifiers in import_many_relationships, each with one feature and one outgoing relationship
+ *
+ *  Together, these are more elements than the first sizes of the uuid index of the importer.
+ */
+enum test_many_enum { TEST_MANY_CLASSIFIERS = 1600 };
+
+static char test_many_json[TEST_MANY_CLASSIFIERS * 1024];  /* static to preserve stack space */
+
+static test_case_result_t import_many_relationships( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+
+    /* one diagram shows all classifiers, otherwise features and relationships are invisible and dropped */
+    size_t json_len = 0;
+    json_len += snprintf( &(test_many_json[json_len]), sizeof(test_many_json) - json_len,
+                          "{\"head\":{},\"views\":[{\"diagram\":{\"id\":1,\"diagram_type\":34,\"name\":\"Many\","
+                          "\"uuid\":\"00000000-0000-4000-b000-000000000000\",\"diagramelements\":[\n" );
+    for ( uint32_t index = 0; index < TEST_MANY_CLASSIFIERS; index ++ )
+    {
+        json_len += snprintf( &(test_many_json[json_len]), sizeof(test_many_json) - json_len,
+                              "%s{\"id\":%" PRIu32 ",\"node\":\"00000000-0000-4000-8000-%012" PRIx32 "\","
+                              "\"uuid\":\"00000000-0000-4000-c000-%012" PRIx32 "\"}\n",
+                              ( index == 0 ) ? "" : ",",
+                              index + 1,
+                              index,
+                              index
+                            );
+    }
+
+    /* a classifier with a feature per node, an edge from each classifier to the feature of the next */
+    json_len += snprintf( &(test_many_json[json_len]), sizeof(test_many_json) - json_len, "]}}],\"nodes\":[\n" );
+    for ( uint32_t index = 0; index < TEST_MANY_CLASSIFIERS; index ++ )
+    {
+        json_len += snprintf( &(test_many_json[json_len]), sizeof(test_many_json) - json_len,
+                              "%s{\"classifier\":{\"id\":%" PRIu32 ",\"main_type\":125,\"name\":\"C%" PRIu32 "\","
+                              "\"uuid\":\"00000000-0000-4000-8000-%012" PRIx32 "\",\"features\":["
+                              "{\"id\":%" PRIu32 ",\"main_type\":0,\"key\":\"f\","
+                              "\"uuid\":\"00000000-0000-4000-9000-%012" PRIx32 "\"}]}}\n",
+                              ( index == 0 ) ? "" : ",",
+                              index + 1,
+                              index,
+                              index,
+                              index + 1,
+                              index
+                            );
+    }
+    json_len += snprintf( &(test_many_json[json_len]), sizeof(test_many_json) - json_len, "],\"edges\":[\n" );
+    for ( uint32_t index = 0; index < TEST_MANY_CLASSIFIERS; index ++ )
+    {
+        const uint32_t next = ( index + 1 ) % TEST_MANY_CLASSIFIERS;
+        json_len += snprintf( &(test_many_json[json_len]), sizeof(test_many_json) - json_len,
+                              "%s{\"relationship\":{\"id\":%" PRIu32 ",\"main_type\":0,\"name\":\"R%" PRIu32 "\","
+                              "\"from_node\":\"00000000-0000-4000-8000-%012" PRIx32 "\","
+                              "\"to_node\":\"00000000-0000-4000-9000-%012" PRIx32 "\","
+                              "\"uuid\":\"00000000-0000-4000-a000-%012" PRIx32 "\"}}\n",
+                              ( index == 0 ) ? "" : ",",
+                              index + 1,
+                              index,
+                              index,
+                              next,
+                              index
+                            );
+    }
+    json_len += snprintf( &(test_many_json[json_len]), sizeof(test_many_json) - json_len, "]}\n" );
+    TEST_ENVIRONMENT_ASSERT( json_len < sizeof(test_many_json) );
+
+    io_importer_t importer;
+    io_importer_init ( &importer, &((*fix).db_reader), &((*fix).controller) );
+    data_stat_t stat;
+    data_stat_init(&stat);
+    char report_buffer[32];
+    universal_memory_output_stream_t report_stream;
+    universal_memory_output_stream_init( &report_stream, &report_buffer, sizeof(report_buffer), UNIVERSAL_MEMORY_OUTPUT_STREAM_0TERM_UTF8 );
+    utf8stream_writer_t report;
+    utf8stream_writer_init( &report, universal_memory_output_stream_get_output_stream( &report_stream ) );
+    universal_memory_input_stream_t mem_json;
+    universal_memory_input_stream_init( &mem_json, test_many_json, json_len );
+
+    u8_error_info_t read_pos;
+    const u8_error_t data_err
+        = io_importer_import_stream( &importer,
+                                     IO_IMPORT_MODE_IMPORT,
+                                     universal_memory_input_stream_get_input_stream( &mem_json ),
+                                     &stat,
+                                     &read_pos,
+                                     &report
+                                   );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, data_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( TEST_MANY_CLASSIFIERS, data_stat_get_count( &stat, DATA_STAT_TABLE_DIAGRAMELEMENT, DATA_STAT_SERIES_CREATED ) );
+    TEST_EXPECT_EQUAL_INT( TEST_MANY_CLASSIFIERS, data_stat_get_count( &stat, DATA_STAT_TABLE_CLASSIFIER, DATA_STAT_SERIES_CREATED ) );
+    TEST_EXPECT_EQUAL_INT( TEST_MANY_CLASSIFIERS, data_stat_get_count( &stat, DATA_STAT_TABLE_FEATURE, DATA_STAT_SERIES_CREATED ) );
+    TEST_EXPECT_EQUAL_INT( TEST_MANY_CLASSIFIERS, data_stat_get_count( &stat, DATA_STAT_TABLE_RELATIONSHIP, DATA_STAT_SERIES_CREATED ) );
+    TEST_EXPECT_EQUAL_INT( 0, data_stat_get_series_count( &stat, DATA_STAT_SERIES_WARNING ) );
+    TEST_EXPECT_EQUAL_INT( 0, data_stat_get_series_count( &stat, DATA_STAT_SERIES_ERROR ) );
+
+    /* every relationship links the right classifier and feature */
+    for ( uint32_t index = 0; index < TEST_MANY_CLASSIFIERS; index ++ )
+    {
+        const uint32_t next = ( index + 1 ) % TEST_MANY_CLASSIFIERS;
+        char uuid[DATA_UUID_STRING_SIZE];
+        static data_classifier_t from_classifier;
+        static data_feature_t to_feature;
+        static data_relationship_t relationship;
+        u8_error_t read_err;
+
+        snprintf( uuid, sizeof(uuid), "00000000-0000-4000-8000-%012" PRIx32, index );
+        read_err = data_database_reader_get_classifier_by_uuid( &((*fix).db_reader), uuid, &from_classifier );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, read_err, u8_error_get_name );
+        snprintf( uuid, sizeof(uuid), "00000000-0000-4000-9000-%012" PRIx32, next );
+        read_err = data_database_reader_get_feature_by_uuid( &((*fix).db_reader), uuid, &to_feature );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, read_err, u8_error_get_name );
+        snprintf( uuid, sizeof(uuid), "00000000-0000-4000-a000-%012" PRIx32, index );
+        read_err = data_database_reader_get_relationship_by_uuid( &((*fix).db_reader), uuid, &relationship );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, read_err, u8_error_get_name );
+
+        TEST_EXPECT_EQUAL_INT( data_classifier_get_row( &from_classifier ),
+                               data_relationship_get_from_classifier_row( &relationship )
+                             );
+        TEST_EXPECT_EQUAL_INT( DATA_ROW_VOID, data_relationship_get_from_feature_row( &relationship ) );
+        TEST_EXPECT_EQUAL_INT( data_feature_get_classifier_row( &to_feature ),
+                               data_relationship_get_to_classifier_row( &relationship )
+                             );
+        TEST_EXPECT_EQUAL_INT( data_feature_get_row( &to_feature ), data_relationship_get_to_feature_row( &relationship ) );
+    }
+
+    universal_memory_input_stream_destroy( &mem_json );
+    utf8stream_writer_destroy( &report );
+    universal_memory_output_stream_destroy( &report_stream );
+    data_stat_destroy(&stat);
+    io_importer_destroy ( &importer );
+    return TEST_CASE_RESULT_OK;
+}
+
 
 /*
  * Copyright 2019-2026 Andreas Warnke
@@ -0,0 +1,200 @@
+/* File: io_import_uuid_index_test.c; Copyright and License: see below */
+
+#include "io_import_uuid_index_test.h"
+#include "io_import_uuid_index.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t test_add_and_get( test_fixture_t *fix );
+static test_case_result_t test_invalid_uuid( test_fixture_t *fix );
+static test_case_result_t test_index_grows( test_fixture_t *fix );
+
+test_suite_t io_import_uuid_index_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "io_import_uuid_index_test_get_suite",
+                     TEST_CATEGORY_UNIT | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_add_and_get", &test_add_and_get );
+    test_suite_add_test_case( &result, "test_invalid_uuid", &test_invalid_uuid );
+    test_suite_add_test_case( &result, "test_index_grows", &test_index_grows );
+    return result;
+}
+
+struct test_fixture_struct {
+    io_import_uuid_index_t uuid_index;  /*!< index to be tested */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    io_import_uuid_index_init( &((*fix).uuid_index) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_import_uuid_index_destroy( &((*fix).uuid_index) );
+}
+
+static test_case_result_t test_add_and_get( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_import_uuid_index_t *index = &((*fix).uuid_index);
+    u8_error_t err;
+    data_id_t found_id;
+    data_row_t found_classifier;
+    data_feature_type_t found_type;
+
+    err = io_import_uuid_index_add( index,
+                                    "d2b5a8f1-3c4e-4f6a-9b7c-8d9e0f1a2b3c",
+                                    DATA_ID( DATA_TABLE_CLASSIFIER, 34 ),
+                                    34,
+                                    DATA_FEATURE_TYPE_VOID
+                                  );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    err = io_import_uuid_index_add( index,
+                                    "0f1e2d3c-4b5a-4978-8695-a4b3c2d1e0f9",
+                                    DATA_ID( DATA_TABLE_FEATURE, 35 ),
+                                    34,
+                                    DATA_FEATURE_TYPE_LIFELINE
+                                  );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 2, io_import_uuid_index_get_count( index ) );
+
+    /* search the feature */
+    err = io_import_uuid_index_get( index, "0f1e2d3c-4b5a-4978-8695-a4b3c2d1e0f9", &found_id, &found_classifier, &found_type );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( DATA_TABLE_FEATURE, data_id_get_table( &found_id ) );
+    TEST_EXPECT_EQUAL_INT( 35, data_id_get_row( &found_id ) );
+    TEST_EXPECT_EQUAL_INT( 34, found_classifier );
+    TEST_EXPECT_EQUAL_INT( DATA_FEATURE_TYPE_LIFELINE, found_type );
+
+    /* search the classifier, optional outputs not requested */
+    err = io_import_uuid_index_get( index, "d2b5a8f1-3c4e-4f6a-9b7c-8d9e0f1a2b3c", &found_id, NULL, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( DATA_TABLE_CLASSIFIER, data_id_get_table( &found_id ) );
+    TEST_EXPECT_EQUAL_INT( 34, data_id_get_row( &found_id ) );
+
+    /* search an unknown uuid */
+    err = io_import_uuid_index_get( index, "d2b5a8f1-3c4e-4f6a-9b7c-8d9e0f1a2b3d", &found_id, &found_classifier, &found_type );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NOT_FOUND, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( false, data_id_is_valid( &found_id ) );
+    TEST_EXPECT_EQUAL_INT( DATA_ROW_VOID, found_classifier );
+    TEST_EXPECT_EQUAL_INT( DATA_FEATURE_TYPE_VOID, found_type );
+
+    /* overwrite an entry */
+    err = io_import_uuid_index_add( index,
+                                    "d2b5a8f1-3c4e-4f6a-9b7c-8d9e0f1a2b3c",
+                                    DATA_ID( DATA_TABLE_CLASSIFIER, 36 ),
+                                    36,
+                                    DATA_FEATURE_TYPE_VOID
+                                  );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 2, io_import_uuid_index_get_count( index ) );
+    err = io_import_uuid_index_get( index, "d2b5a8f1-3c4e-4f6a-9b7c-8d9e0f1a2b3c", &found_id, &found_classifier, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 36, data_id_get_row( &found_id ) );
+    TEST_EXPECT_EQUAL_INT( 36, found_classifier );
+
+    /* clear the index */
+    io_import_uuid_index_reinit( index );
+    TEST_EXPECT_EQUAL_INT( 0, io_import_uuid_index_get_count( index ) );
+    err = io_import_uuid_index_get( index, "d2b5a8f1-3c4e-4f6a-9b7c-8d9e0f1a2b3c", &found_id, NULL, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NOT_FOUND, err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_invalid_uuid( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_import_uuid_index_t *index = &((*fix).uuid_index);
+    u8_error_t err;
+    data_id_t found_id;
+
+    err = io_import_uuid_index_add( index, "", DATA_ID( DATA_TABLE_DIAGRAM, 1 ), DATA_ROW_VOID, DATA_FEATURE_TYPE_VOID );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_VALUE_OUT_OF_RANGE, err, u8_error_get_name );
+
+    err = io_import_uuid_index_add( index,
+                                    "d2b5a8f1-3c4e-4f6a-9b7c-8d9e0f1a2b3c-too-long",
+                                    DATA_ID( DATA_TABLE_DIAGRAM, 1 ),
+                                    DATA_ROW_VOID,
+                                    DATA_FEATURE_TYPE_VOID
+                                  );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_VALUE_OUT_OF_RANGE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 0, io_import_uuid_index_get_count( index ) );
+
+    err = io_import_uuid_index_get( index, "", &found_id, NULL, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NOT_FOUND, err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_index_grows( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_import_uuid_index_t *index = &((*fix).uuid_index);
+    u8_error_t err;
+    data_id_t found_id;
+    char uuid[DATA_UUID_STRING_SIZE];
+    static const uint32_t ENTRIES = 20 * IO_IMPORT_UUID_INDEX_MIN_SLOTS;  /* the index grows several times */
+
+    for ( uint32_t row = 0; row < ENTRIES; row ++ )
+    {
+        snprintf( uuid, sizeof(uuid), "00000000-0000-4000-8000-%012" PRIx32, row );
+        err = io_import_uuid_index_add( index, uuid, DATA_ID( DATA_TABLE_DIAGRAMELEMENT, row ), DATA_ROW_VOID, DATA_FEATURE_TYPE_VOID );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    }
+    TEST_EXPECT_EQUAL_INT( ENTRIES, io_import_uuid_index_get_count( index ) );
+
+    /* all uuids are found after moving to larger tables */
+    for ( uint32_t row = 0; row < ENTRIES; row ++ )
+    {
+        snprintf( uuid, sizeof(uuid), "00000000-0000-4000-8000-%012" PRIx32, row );
+        err = io_import_uuid_index_get( index, uuid, &found_id, NULL, NULL );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+        TEST_EXPECT_EQUAL_INT( row, data_id_get_row( &found_id ) );
+    }
+    err = io_import_uuid_index_get( index, "ffffffff-0000-4000-8000-000000000000", &found_id, NULL, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NOT_FOUND, err, u8_error_get_name );
+
+    /* updating a known uuid does not add an entry */
+    snprintf( uuid, sizeof(uuid), "00000000-0000-4000-8000-%012" PRIx32, 7 );
+    err = io_import_uuid_index_add( index, uuid, DATA_ID( DATA_TABLE_DIAGRAMELEMENT, 1007 ), DATA_ROW_VOID, DATA_FEATURE_TYPE_VOID );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( ENTRIES, io_import_uuid_index_get_count( index ) );
+    err = io_import_uuid_index_get( index, uuid, &found_id, NULL, NULL );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 1007, data_id_get_row( &found_id ) );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
@@ -0,0 +1,196 @@
+/* File: io_progress_test.c; Copyright and License: see below */
+
+#include "io_progress_test.h"
+#include "io_progress.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <string.h>
+#include <assert.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t test_phases( test_fixture_t *fix );
+static test_case_result_t test_tick_interval( test_fixture_t *fix );
+static test_case_result_t test_cancel_in_listener( test_fixture_t *fix );
+
+test_suite_t io_progress_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "io_progress_test_get_suite",
+                     TEST_CATEGORY_UNIT | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_phases", &test_phases );
+    test_suite_add_test_case( &result, "test_tick_interval", &test_tick_interval );
+    test_suite_add_test_case( &result, "test_cancel_in_listener", &test_cancel_in_listener );
+    return result;
+}
+
+struct test_fixture_struct {
+    data_stat_t stat;  /*!< statistics updated by the test as if it was an import */
+    io_progress_t progress;  /*!< progress to be tested */
+    uint32_t report_count;  /*!< number of listener calls */
+    uint32_t cancel_at;  /*!< number of the listener call that cancels the progress, 0 for never */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static void listener_callback( test_fixture_t *fix, const io_progress_t *progress )
+{
+    assert( fix != NULL );
+    assert( progress == &((*fix).progress) );
+    (*fix).report_count ++;
+    if ( (*fix).report_count == (*fix).cancel_at )
+    {
+        io_progress_cancel( &((*fix).progress) );
+    }
+}
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    data_stat_init( &((*fix).stat) );
+    io_progress_init( &((*fix).progress),
+                      &((*fix).stat),
+                      fix,
+                      (void (*)(void*,const io_progress_t*)) &listener_callback
+                    );
+    (*fix).report_count = 0;
+    (*fix).cancel_at = 0;
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_progress_destroy( &((*fix).progress) );
+    data_stat_destroy( &((*fix).stat) );
+}
+
+static test_case_result_t test_phases( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_progress_t *progress = &((*fix).progress);
+    static const char *const NAMES[IO_PROGRESS_MAX_PHASES + 2]
+        = { "p0", "p1", "p2", "p3", "p4", "p5", "p6", "p7", "p8", "p9" };
+
+    TEST_EXPECT_EQUAL_INT( 0, io_progress_get_phase_count( progress ) );
+
+    /* each phase change is reported */
+    io_progress_begin_phase( progress, NAMES[0] );
+    TEST_EXPECT_EQUAL_INT( 1, (*fix).report_count );
+    TEST_EXPECT_EQUAL_INT( 1, io_progress_get_phase_count( progress ) );
+    io_progress_end_phase( progress );
+    TEST_EXPECT_EQUAL_INT( 2, (*fix).report_count );
+    const int64_t phase_0_time = io_progress_get_phase_time( progress, 0 );
+    TEST_EXPECT( phase_0_time >= 0 );
+
+    /* an ended phase keeps its duration */
+    g_usleep( 2000 );
+    io_progress_begin_phase( progress, NAMES[1] );
+    TEST_EXPECT_EQUAL_INT( phase_0_time, io_progress_get_phase_time( progress, 0 ) );
+
+    /* further phases extend the last one */
+    for ( uint32_t index = 2; index < IO_PROGRESS_MAX_PHASES + 2; index ++ )
+    {
+        io_progress_begin_phase( progress, NAMES[index] );
+    }
+    io_progress_end_phase( progress );
+    TEST_EXPECT_EQUAL_INT( IO_PROGRESS_MAX_PHASES, io_progress_get_phase_count( progress ) );
+    for ( uint32_t index = 0; index < IO_PROGRESS_MAX_PHASES; index ++ )
+    {
+        TEST_EXPECT_EQUAL_STRING( NAMES[index], io_progress_get_phase_name( progress, index ) );
+        TEST_EXPECT( io_progress_get_phase_time( progress, index ) <= io_progress_get_elapsed_time( progress ) );
+    }
+    TEST_EXPECT( io_progress_get_elapsed_time( progress ) >= 2000 );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_tick_interval( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_progress_t *progress = &((*fix).progress);
+    u8_error_t err;
+
+    /* a long interval suppresses the reports */
+    io_progress_set_interval( progress, 3600000000 );
+    for ( uint32_t index = 0; index < 100; index ++ )
+    {
+        data_stat_inc_count( &((*fix).stat), DATA_STAT_TABLE_CLASSIFIER, DATA_STAT_SERIES_CREATED );
+        io_progress_add_bytes( progress, 10 );
+        err = io_progress_tick( progress );
+        TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, err );
+    }
+    TEST_EXPECT_EQUAL_INT( 0, (*fix).report_count );
+    TEST_EXPECT_EQUAL_INT( 1000, io_progress_get_byte_count( progress ) );
+
+    /* interval 0 reports every tick */
+    io_progress_set_interval( progress, 0 );
+    g_usleep( 1000 );
+    data_stat_inc_count( &((*fix).stat), DATA_STAT_TABLE_FEATURE, DATA_STAT_SERIES_WARNING );  /* not counted by the rate */
+    for ( uint32_t index = 0; index < 10; index ++ )
+    {
+        err = io_progress_tick( progress );
+        TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, err );
+    }
+    TEST_EXPECT_EQUAL_INT( 10, (*fix).report_count );
+    TEST_EXPECT_EQUAL_INT( 101, data_stat_get_total_count( io_progress_get_stat_const( progress ) ) );
+
+    /* 100 elements in at least 1 ms: at most 100000 per second */
+    const int64_t elapsed = io_progress_get_elapsed_time( progress );
+    TEST_EXPECT( elapsed >= 1000 );
+    TEST_EXPECT_EQUAL_INT( (100 * 1000000) / elapsed, io_progress_get_rate( progress ) );
+    TEST_EXPECT( io_progress_get_rate( progress ) <= 100000 );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_cancel_in_listener( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    io_progress_t *progress = &((*fix).progress);
+    u8_error_t err;
+
+    io_progress_set_interval( progress, 0 );
+    (*fix).cancel_at = 3;
+
+    err = io_progress_tick( progress );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, err );
+    err = io_progress_tick( progress );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, err );
+    TEST_EXPECT_EQUAL_INT( false, io_progress_is_cancelled( progress ) );
+
+    /* the listener cancels at the third report, this tick already returns the cancellation */
+    err = io_progress_tick( progress );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_CANCELLED, err );
+    TEST_EXPECT_EQUAL_INT( true, io_progress_is_cancelled( progress ) );
+
+    /* a cancelled progress does not report anymore */
+    err = io_progress_tick( progress );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_CANCELLED, err );
+    TEST_EXPECT_EQUAL_INT( 3, (*fix).report_count );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
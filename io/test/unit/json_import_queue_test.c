@@ -0,0 +1,181 @@
+/* File: json_import_queue_test.c; Copyright and License: see below */
+
+#include "json_import_queue_test.h"
+#include "json/json_import_queue.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <glib.h>
+#include <assert.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t test_push_pop_ring( test_fixture_t *fix );
+static test_case_result_t test_cancel( test_fixture_t *fix );
+static test_case_result_t test_producer_thread( test_fixture_t *fix );
+
+test_suite_t json_import_queue_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "json_import_queue_test_get_suite",
+                     TEST_CATEGORY_UNIT | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_push_pop_ring", &test_push_pop_ring );
+    test_suite_add_test_case( &result, "test_cancel", &test_cancel );
+    test_suite_add_test_case( &result, "test_producer_thread", &test_producer_thread );
+    return result;
+}
+
+struct test_fixture_struct {
+    json_import_queue_t queue;  /*!< queue to be tested, too large for the stack */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    json_import_queue_init( &((*fix).queue) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    json_import_queue_destroy( &((*fix).queue) );
+}
+
+static test_case_result_t test_push_pop_ring( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    json_import_queue_t *queue = &((*fix).queue);
+    u8_error_t err;
+    json_import_record_t *record;
+
+    /* fill and drain the ring several times, the records are passed in order */
+    for ( uint32_t round = 0; round < 3; round ++ )
+    {
+        for ( uint32_t index = 0; index < JSON_IMPORT_QUEUE_MAX_RECORDS; index ++ )
+        {
+            err = json_import_queue_begin_push( queue, &record );
+            TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, err );
+            TEST_EXPECT( NULL != record );
+            /* begin_push without end_push returns the same record */
+            json_import_record_t *same_record;
+            err = json_import_queue_begin_push( queue, &same_record );
+            TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, err );
+            TEST_EXPECT_EQUAL_PTR( record, same_record );
+            (*record).table = DATA_TABLE_FEATURE;
+            (*record).read_line = round * 100 + index;
+            json_import_queue_end_push( queue );
+        }
+        for ( uint32_t index = 0; index < JSON_IMPORT_QUEUE_MAX_RECORDS; index ++ )
+        {
+            record = json_import_queue_begin_pop( queue );
+            TEST_EXPECT( NULL != record );
+            TEST_EXPECT_EQUAL_INT( round * 100 + index, (*record).read_line );
+            json_import_queue_end_pop( queue );
+        }
+    }
+
+    /* closed and empty */
+    json_import_queue_close( queue );
+    record = json_import_queue_begin_pop( queue );
+    TEST_EXPECT( NULL == record );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_cancel( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    json_import_queue_t *queue = &((*fix).queue);
+    u8_error_t err;
+    json_import_record_t *record;
+
+    /* a full queue does not block after cancel */
+    for ( uint32_t index = 0; index < JSON_IMPORT_QUEUE_MAX_RECORDS; index ++ )
+    {
+        err = json_import_queue_begin_push( queue, &record );
+        TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, err );
+        json_import_queue_end_push( queue );
+    }
+    json_import_queue_cancel( queue );
+    err = json_import_queue_begin_push( queue, &record );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_WRONG_STATE, err );
+    TEST_EXPECT( NULL == record );
+
+    /* reset allows to use the queue again */
+    json_import_queue_reset( queue );
+    err = json_import_queue_begin_push( queue, &record );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, err );
+    TEST_EXPECT_EQUAL_PTR( &((*queue).record[0]), record );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+enum test_producer_enum {
+    TEST_PRODUCER_RECORDS = 1000,  /*!< more records than fit in the queue */
+};
+
+static gpointer test_produce( gpointer data )
+{
+    json_import_queue_t *queue = data;
+    u8_error_t err = U8_ERROR_NONE;
+    for ( uint32_t index = 0; ( index < TEST_PRODUCER_RECORDS )&&( err == U8_ERROR_NONE ); index ++ )
+    {
+        json_import_record_t *record;
+        err = json_import_queue_begin_push( queue, &record );
+        if ( err == U8_ERROR_NONE )
+        {
+            (*record).read_line = index;
+            json_import_queue_end_push( queue );
+        }
+    }
+    json_import_queue_close( queue );
+    return NULL;
+}
+
+static test_case_result_t test_producer_thread( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    json_import_queue_t *queue = &((*fix).queue);
+
+    GThread *const producer = g_thread_try_new( "test_produce", &test_produce, queue, NULL );
+    TEST_ENVIRONMENT_ASSERT( NULL != producer );
+
+    uint32_t expected_line = 0;
+    for ( json_import_record_t *record = json_import_queue_begin_pop( queue );
+          record != NULL;
+          record = json_import_queue_begin_pop( queue ) )
+    {
+        TEST_EXPECT_EQUAL_INT( expected_line, (*record).read_line );
+        expected_line ++;
+        json_import_queue_end_pop( queue );
+    }
+    g_thread_join( producer );
+    TEST_EXPECT_EQUAL_INT( TEST_PRODUCER_RECORDS, expected_line );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
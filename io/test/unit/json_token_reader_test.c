@@ -7,6 +7,7 @@
 #include "test_expect.h"
 #include "test_environment_assert.h"
 #include "test_case_result.h"
+#include <string.h>
 
 static test_fixture_t * set_up();
 static void tear_down( test_fixture_t *fix );
@@ -14,6 +15,8 @@ static test_case_result_t test_skip_whitespace( test_fixture_t *fix );
 static test_case_result_t test_is_value_end( test_fixture_t *fix );
 static test_case_result_t test_get_value_type( test_fixture_t *fix );
 static test_case_result_t test_parse_string( test_fixture_t *fix );
+static test_case_result_t test_parse_string_view( test_fixture_t *fix );
+static test_case_result_t test_scan_words( test_fixture_t *fix );
 static test_case_result_t test_parse_integer( test_fixture_t *fix );
 static test_case_result_t test_skip_number( test_fixture_t *fix );
 static test_case_result_t test_parse( test_fixture_t *fix );
@@ -32,6 +35,8 @@ test_suite_t json_token_reader_test_get_suite(void)
     test_suite_add_test_case( &result, "test_is_value_end", &test_is_value_end );
     test_suite_add_test_case( &result, "test_get_value_type", &test_get_value_type );
     test_suite_add_test_case( &result, "test_parse_string", &test_parse_string );
+    test_suite_add_test_case( &result, "test_parse_string_view", &test_parse_string_view );
+    test_suite_add_test_case( &result, "test_scan_words", &test_scan_words );
     test_suite_add_test_case( &result, "test_parse_integer", &test_parse_integer );
     test_suite_add_test_case( &result, "test_skip_number", &test_skip_number );
     test_suite_add_test_case( &result, "test_parse", &test_parse );
@@ -250,6 +255,83 @@ static test_case_result_t test_parse_string( test_fixture_t *fix )
     return TEST_CASE_RESULT_OK;
 }
 
+static test_case_result_t test_parse_string_view( test_fixture_t *fix )
+{
+    u8_error_t test_err;
+    const char test_str[] = "\"plain\", \"esc\\n\", \"too long \\t\"";
+    char scratch_buf[8];
+    utf8stringbuf_t scratch = UTF8STRINGBUF( scratch_buf );
+    utf8stringview_t parsed;
+    universal_memory_input_stream_t test_input;
+    universal_memory_input_stream_init( &test_input, &test_str, sizeof(test_str) );
+    json_token_reader_init( &tok, universal_memory_input_stream_get_input_stream( &test_input ) );
+
+    /* a string without escape sequences is not copied */
+    test_err = json_token_reader_read_string_view( &tok, scratch, &parsed );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, test_err );
+    TEST_EXPECT( utf8stringview_equals_str( &parsed, "plain" ) );
+    TEST_EXPECT( utf8stringview_get_start( &parsed ) == &(test_str[1]) );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, json_token_reader_expect_value_separator( &tok ) );
+
+    /* a string with escape sequences is decoded to scratch */
+    test_err = json_token_reader_read_string_view( &tok, scratch, &parsed );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, test_err );
+    TEST_EXPECT( utf8stringview_equals_str( &parsed, "esc\n" ) );
+    TEST_EXPECT( utf8stringview_get_start( &parsed ) == &(scratch_buf[0]) );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, json_token_reader_expect_value_separator( &tok ) );
+
+    /* scratch is too small */
+    test_err = json_token_reader_read_string_view( &tok, scratch, &parsed );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_STRING_BUFFER_EXCEEDED, test_err );
+    TEST_EXPECT_EQUAL_INT( sizeof(test_str)-1, json_token_reader_get_input_pos( &tok ) );
+
+    json_token_reader_destroy( &tok );
+    universal_memory_input_stream_destroy( &test_input );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_scan_words( test_fixture_t *fix )
+{
+    /* find the string end at every position within and after a word */
+    const char plain[48] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTU";
+    TEST_EXPECT_EQUAL_INT( 47, json_token_reader_private_find_string_end( plain, sizeof(plain) ) );
+    TEST_EXPECT_EQUAL_INT( 5, json_token_reader_private_find_string_end( plain, 5 ) );
+    TEST_EXPECT_EQUAL_INT( 21, json_token_reader_private_find_string_end( plain, 21 ) );
+    for ( int index = 0; index < 44; index ++ )
+    {
+        char test_str[48];
+        memcpy( &test_str, &plain, sizeof(test_str) );
+        test_str[index] = ( index % 2 == 0 ) ? '"' : '\\';
+        TEST_EXPECT_EQUAL_INT( index, json_token_reader_private_find_string_end( test_str, sizeof(test_str) ) );
+    }
+
+    /* whitespace runs longer than a word, lines are counted */
+    u8_error_t test_err;
+    const char test_str[] = "                \n      \n\t\r\n                   \"0123456789abcdef\\n\\\\x\"  1234567890123 ";
+    char parsed_buf[24];
+    utf8stringbuf_t parsed_str = UTF8STRINGBUF( parsed_buf );
+    int64_t parsed_int;
+    universal_memory_input_stream_t test_input;
+    universal_memory_input_stream_init( &test_input, &test_str, sizeof(test_str) );
+    json_token_reader_init( &tok, universal_memory_input_stream_get_input_stream( &test_input ) );
+
+    json_token_reader_private_skip_whitespace( &tok );
+    TEST_EXPECT_EQUAL_INT( 46, json_token_reader_get_input_pos( &tok ) );
+    TEST_EXPECT_EQUAL_INT( 4, json_token_reader_get_input_line( &tok ) );
+
+    test_err = json_token_reader_read_string_value( &tok, parsed_str );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, test_err );
+    TEST_EXPECT_EQUAL_INT( 1, utf8stringbuf_equals_str( &parsed_str, "0123456789abcdef\n\\x" ) );
+
+    test_err = json_token_reader_read_int_value( &tok, &parsed_int );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, test_err );
+    TEST_EXPECT_EQUAL_INT( 1234567890123, parsed_int );
+
+    json_token_reader_destroy( &tok );
+    universal_memory_input_stream_destroy( &test_input );
+    return TEST_CASE_RESULT_OK;
+}
+
 static test_case_result_t test_parse_integer( test_fixture_t *fix )
 {
     u8_error_t test_err;
@@ -12,6 +12,11 @@
 #include <stdbool.h>
 #include <assert.h>
 
+/*!
+ *  \brief minimum time between two progress lines of the command line interface, in microseconds
+ */
+static const int64_t MAIN_COMMANDS_PROGRESS_INTERVAL = 1000000;
+
 static io_data_file_t single_big_data_file;  /*!< a data_file struct, placed in the data segment due to its >5MB size */
 
 u8_error_t main_commands_init ( main_commands_t *this_, bool start_gui, int argc, char **argv )
@@ -168,15 +173,30 @@ u8_error_t main_commands_export ( main_commands_t *this_,
         data_database_reader_init( &db_reader, io_data_file_get_database_ptr( (*this_).data_file ) );
         static io_exporter_t exporter;
         io_exporter_init( &exporter, &db_reader );
+        static io_export_image_pool_t image_pool;  /* one thread per processor renders the diagram images */
+        io_export_image_pool_init( &image_pool, 0 );
+        io_exporter_set_image_pool( &exporter, &image_pool );
         {
             data_stat_t export_stat;
             data_stat_init ( &export_stat );
+            io_progress_t progress;
+            io_progress_init( &progress,
+                              &export_stat,
+                              out_english_report,
+                              (void (*)(void*,const io_progress_t*)) &main_commands_private_report_progress
+                            );
+            io_progress_set_interval( &progress, MAIN_COMMANDS_PROGRESS_INTERVAL );
+            io_exporter_set_progress( &exporter, &progress );
             export_err = io_exporter_export_files( &exporter, export_format, export_directory, document_filename, &export_stat );
+            io_exporter_set_progress( &exporter, NULL );
             export_err |= main_commands_private_report_stat( this_, &export_stat, "exported", out_english_report );
+            export_err |= main_commands_private_report_phases( this_, &progress, out_english_report );
+            io_progress_destroy( &progress );
             data_stat_trace( &export_stat );
             data_stat_destroy ( &export_stat );
         }
         io_exporter_destroy( &exporter );
+        io_export_image_pool_destroy( &image_pool );
         data_database_reader_destroy( &db_reader );
     }
     else
@@ -226,9 +246,20 @@ u8_error_t main_commands_import ( main_commands_t *this_,
         {
             data_stat_t import_stat;
             data_stat_init ( &import_stat );
+            io_progress_t progress;
+            io_progress_init( &progress,
+                              &import_stat,
+                              out_english_report,
+                              (void (*)(void*,const io_progress_t*)) &main_commands_private_report_progress
+                            );
+            io_progress_set_interval( &progress, MAIN_COMMANDS_PROGRESS_INTERVAL );
+            io_importer_set_progress( &importer, &progress );
             u8_error_info_t err_info;
             import_err = io_importer_import_file( &importer, import_mode, import_file_path, &import_stat, &err_info, out_english_report );
+            io_importer_set_progress( &importer, NULL );
             import_err |= main_commands_private_report_stat( this_, &import_stat, "imported", out_english_report );
+            import_err |= main_commands_private_report_phases( this_, &progress, out_english_report );
+            io_progress_destroy( &progress );
             import_err |= main_commands_private_report_error_info( this_, &err_info, out_english_report );
             data_stat_trace( &import_stat );
             data_stat_destroy ( &import_stat );
@@ -411,6 +442,63 @@ u8_error_t main_commands_private_report_error_info ( main_commands_t *this_,
     return write_err;
 }
 
+void main_commands_private_report_progress ( utf8stream_writer_t *out_english_report, const io_progress_t *progress )
+{
+    U8_TRACE_BEGIN();
+    assert( out_english_report != NULL );
+    assert( progress != NULL );
+    u8_error_t write_err = U8_ERROR_NONE;
+
+    const data_stat_t *const stat = io_progress_get_stat_const( progress );
+    write_err |= utf8stream_writer_write_str( out_english_report, "progress: " );
+    write_err |= utf8stream_writer_write_int( out_english_report, data_stat_get_total_count( stat ) );
+    write_err |= utf8stream_writer_write_str( out_english_report, " elements, " );
+    write_err |= utf8stream_writer_write_int( out_english_report, io_progress_get_byte_count( progress ) );
+    write_err |= utf8stream_writer_write_str( out_english_report, " bytes, " );
+    write_err |= utf8stream_writer_write_int( out_english_report, io_progress_get_rate( progress ) );
+    write_err |= utf8stream_writer_write_str( out_english_report, " elements/s after " );
+    write_err |= utf8stream_writer_write_int( out_english_report, io_progress_get_elapsed_time( progress ) / 1000 );
+    write_err |= utf8stream_writer_write_str( out_english_report, " ms\n      " );
+    write_err |= utf8stream_writer_flush( out_english_report );
+
+    if ( write_err != U8_ERROR_NONE )
+    {
+        U8_LOG_WARNING( "progress could not be reported." );
+    }
+
+    U8_TRACE_END();
+}
+
+u8_error_t main_commands_private_report_phases ( main_commands_t *this_,
+                                                 const io_progress_t *progress,
+                                                 utf8stream_writer_t *out_english_report )
+{
+    U8_TRACE_BEGIN();
+    assert( progress != NULL );
+    assert( out_english_report != NULL );
+    u8_error_t write_err = U8_ERROR_NONE;
+
+    const uint32_t phase_count = io_progress_get_phase_count( progress );
+    for ( uint32_t phase_idx = 0; phase_idx < phase_count; phase_idx ++ )
+    {
+        write_err |= utf8stream_writer_write_str( out_english_report, "   phase: " );
+        write_err |= utf8stream_writer_write_str( out_english_report, io_progress_get_phase_name( progress, phase_idx ) );
+        write_err |= utf8stream_writer_write_str( out_english_report, "\t" );
+        write_err |= utf8stream_writer_write_int( out_english_report, io_progress_get_phase_time( progress, phase_idx ) / 1000 );
+        write_err |= utf8stream_writer_write_str( out_english_report, " ms\n" );
+    }
+    write_err |= utf8stream_writer_write_str( out_english_report, "   total: " );
+    write_err |= utf8stream_writer_write_int( out_english_report, io_progress_get_elapsed_time( progress ) / 1000 );
+    write_err |= utf8stream_writer_write_str( out_english_report, " ms, " );
+    write_err |= utf8stream_writer_write_int( out_english_report, io_progress_get_byte_count( progress ) );
+    write_err |= utf8stream_writer_write_str( out_english_report, " bytes, " );
+    write_err |= utf8stream_writer_write_int( out_english_report, io_progress_get_rate( progress ) );
+    write_err |= utf8stream_writer_write_str( out_english_report, " elements/s\n" );
+
+    U8_TRACE_END_ERR( write_err );
+    return write_err;
+}
+
 
 /*
 Copyright 2016-2026 Andreas Warnke
@@ -12,6 +12,7 @@
 #include "io_file_format.h"
 #include "io_import_mode.h"
 #include "io_data_file.h"
+#include "io_progress.h"
 #include "utf8stream/utf8stream_writer.h"
 #include "u8/u8_error_info.h"
 #include "u8/u8_error.h"
@@ -151,6 +152,29 @@ u8_error_t main_commands_private_report_error_info ( main_commands_t *this_,
                                                      utf8stream_writer_t *out_english_report
                                                    );
 
+/*!
+ *  \brief prints one line on the progress of a running import or export to an utf8 writer
+ *
+ *  This function is the listener callback of an io_progress_t.
+ *
+ *  \param out_english_report utf8stream_writer_t where to write a non-translated report to
+ *  \param progress the progress to print
+ */
+void main_commands_private_report_progress ( utf8stream_writer_t *out_english_report, const io_progress_t *progress );
+
+/*!
+ *  \brief prints the durations of the phases, the number of bytes and the rate of a finished import or export to an utf8 writer
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param progress the progress to print
+ *  \param out_english_report utf8stream_writer_t where to write a non-translated report to
+ *  \return U8_ERROR_NONE in case of success
+ */
+u8_error_t main_commands_private_report_phases ( main_commands_t *this_,
+                                                 const io_progress_t *progress,
+                                                 utf8stream_writer_t *out_english_report
+                                               );
+
 #endif  /* MAIN_COMMANDS_H */
 
 
@@ -14,6 +14,7 @@
 #include "unit/set_data_full_id_test.h"
 #include "unit/set_data_search_result_list_test.h"
 #include "unit/set_data_search_result_test.h"
+#include "unit/set_data_row_index_test.h"
 #include "unit/set_data_small_set_test.h"
 #include "unit/set_data_stat_test.h"
 #include "unit/set_data_visible_classifier_test.h"
@@ -22,8 +23,11 @@
 #include "unit/data_guidelines_test.h"
 #include "unit/data_database_listener_test.h"
 #include "unit/data_database_head_test.h"
+#include "integration/data_database_profile_test.h"
 #include "integration/data_database_reader_test.h"
+#include "integration/data_database_snapshot_test.h"
 #include "integration/data_database_text_search_test.h"
+#include "integration/data_database_writer_test.h"
 #include "integration/data_profile_part_test.h"
 #include "integration/data_visible_set_test.h"
 /* ctrl */
@@ -36,6 +40,7 @@
 #include "integration/consistency_lifeline_test.h"
 #include "integration/consistency_relationship_test.h"
 #include "unit/ctrl_undo_redo_iterator_test.h"
+#include "unit/ctrl_undo_redo_record_test.h"
 #include "unit/consistency_stat_test.h"
 /* pencil */
 #include "unit/geometry__test.h"
@@ -44,11 +49,15 @@
 #include "unit/geometry_connector_test.h"
 #include "unit/geometry_non_linear_scale_test.h"
 #include "unit/layout_visible_set_test.h"
+#include "unit/layout_spatial_index_test.h"
+#include "unit/layout_connector_index_test.h"
+#include "unit/layout_quality_test.h"
 #include "unit/draw_classifier_contour_test.h"
 #include "unit/draw_stereotype_icon_test.h"
 #include "unit/pencil_classifier_composer_test.h"
 #include "integration/pencil_layouter_test.h"
 #include "integration/pencil_diagram_maker_test.h"
+#include "integration/layout_cache_test.h"
 /* gui */
 #include "unit/gui_sketch_nav_tree_test.h"
 /* io */
@@ -56,9 +65,13 @@
 #include "unit/json_token_reader_test.h"
 #include "unit/io_md_writer_test.h"
 #include "unit/io_import_elements_test.h"
+#include "unit/io_import_uuid_index_test.h"
+#include "unit/json_import_queue_test.h"
+#include "unit/io_progress_test.h"
 #include "integration/io_data_file_test.h"
 #include "integration/io_importer_test.h"
 #include "integration/io_export_model_traversal_test.h"
+#include "integration/io_export_image_pool_test.h"
 /* u8stream */
 #include "unit/u8__test.h"
 #include "unit/universal_array_index_iterator_test.h"
@@ -83,6 +96,7 @@
 #include "unit/utf8stream_writer_test.h"
 #include "integration/u8dir_file_test.h"
 #include "integration/universal_file_input_stream_test.h"
+#include "integration/universal_mmap_input_stream_test.h"
 #include "integration/universal_file_output_stream_test.h"
 #include "integration/universal_stream_output_stream_test.h"
 /* TEST_ENVIRONMENT */
@@ -208,6 +222,7 @@ int main (int argc, char *argv[]) {
         test_runner_run_suite( &runner, universal_memory_arena_test_get_suite() );
         test_runner_run_suite( &runner, universal_arena_list_test_get_suite() );
         test_runner_run_suite( &runner, universal_file_input_stream_test_get_suite() );
+        test_runner_run_suite( &runner, universal_mmap_input_stream_test_get_suite() );
         test_runner_run_suite( &runner, universal_file_output_stream_test_get_suite() );
         test_runner_run_suite( &runner, universal_stream_output_stream_test_get_suite() );
         /* u8/utf8stringbuf */
@@ -238,6 +253,7 @@ int main (int argc, char *argv[]) {
         test_runner_run_suite( &runner, set_data_full_id_test_get_suite() );
         test_runner_run_suite( &runner, set_data_search_result_list_test_get_suite() );
         test_runner_run_suite( &runner, set_data_search_result_test_get_suite() );
+        test_runner_run_suite( &runner, set_data_row_index_test_get_suite() );
         test_runner_run_suite( &runner, set_data_small_set_test_get_suite() );
         test_runner_run_suite( &runner, set_data_stat_test_get_suite() );
         test_runner_run_suite( &runner, set_data_visible_classifier_test_get_suite() );
@@ -247,13 +263,17 @@ int main (int argc, char *argv[]) {
         test_runner_run_suite( &runner, data_database_listener_test_get_suite() );
         test_runner_run_suite( &runner, data_database_head_test_get_suite() );
 
+        test_runner_run_suite( &runner, data_database_profile_test_get_suite() );
         test_runner_run_suite( &runner, data_database_reader_test_get_suite() );
+        test_runner_run_suite( &runner, data_database_snapshot_test_get_suite() );
         test_runner_run_suite( &runner, data_database_text_search_test_get_suite() );
+        test_runner_run_suite( &runner, data_database_writer_test_get_suite() );
         test_runner_run_suite( &runner, data_profile_part_test_get_suite() );
         test_runner_run_suite( &runner, data_visible_set_test_get_suite() );
 
         /* ctrl */
         test_runner_run_suite( &runner, ctrl_undo_redo_iterator_test_get_suite() );
+        test_runner_run_suite( &runner, ctrl_undo_redo_record_test_get_suite() );
         test_runner_run_suite( &runner, consistency_stat_test_get_suite() );
 
         test_runner_run_suite( &runner, ctrl_multi_step_changer_test_get_suite() );
@@ -272,22 +292,30 @@ int main (int argc, char *argv[]) {
         test_runner_run_suite( &runner, geometry_connector_test_get_suite() );
         test_runner_run_suite( &runner, geometry_non_linear_scale_test_get_suite() );
         test_runner_run_suite( &runner, layout_visible_set_test_get_suite() );
+        test_runner_run_suite( &runner, layout_spatial_index_test_get_suite() );
+        test_runner_run_suite( &runner, layout_connector_index_test_get_suite() );
+        test_runner_run_suite( &runner, layout_quality_test_get_suite() );
         test_runner_run_suite( &runner, draw_classifier_contour_test_get_suite() );
         test_runner_run_suite( &runner, draw_stereotype_icon_test_get_suite() );
         test_runner_run_suite( &runner, pencil_classifier_composer_test_get_suite() );
 
         test_runner_run_suite( &runner, pencil_layouter_test_get_suite() );
         test_runner_run_suite( &runner, pencil_diagram_maker_test_get_suite() );
+        test_runner_run_suite( &runner, layout_cache_test_get_suite() );
 
         /* io */
         test_runner_run_suite( &runner, io_txt_writer_test_get_suite() );
         test_runner_run_suite( &runner, json_token_reader_test_get_suite() );
         test_runner_run_suite( &runner, io_md_writer_test_get_suite() );
         test_runner_run_suite( &runner, io_import_elements_test_get_suite() );
+        test_runner_run_suite( &runner, io_import_uuid_index_test_get_suite() );
+        test_runner_run_suite( &runner, json_import_queue_test_get_suite() );
+        test_runner_run_suite( &runner, io_progress_test_get_suite() );
 
         test_runner_run_suite( &runner, io_data_file_test_get_suite() );
         test_runner_run_suite( &runner, io_importer_test_get_suite() );
         test_runner_run_suite( &runner, io_export_model_traversal_test_get_suite() );
+        test_runner_run_suite( &runner, io_export_image_pool_test_get_suite() );
 
         /* gui */
         test_runner_run_suite( &runner, gui_sketch_nav_tree_test_get_suite() );
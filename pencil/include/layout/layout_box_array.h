@@ -0,0 +1,107 @@
+/* File: layout_box_array.h; Copyright and License: see below */
+
+#ifndef LAYOUT_BOX_ARRAY_H
+#define LAYOUT_BOX_ARRAY_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Stores copies of many rectangles as one array per coordinate
+ *
+ *  The packed arrays allow to check one connector against many rectangles
+ *  without following pointers to the layouted elements, see layout_quality_debts_conn_sym_batch.
+ */
+
+#include "geometry/geometry_rectangle.h"
+#include "u8/u8_error.h"
+#include <stdint.h>
+
+/*!
+ *  \brief constants of layout_box_array_t
+ */
+enum layout_box_array_max_enum {
+    LAYOUT_BOX_ARRAY_MAX_BOXES = 4096,  /*!< maximum number of rectangles, see LAYOUT_VISIBLE_SET_MAX_FEATURES */
+};
+
+/*!
+ *  \brief attributes of the box array
+ *
+ *  Box i is the rectangle left[i], top[i], width[i], height[i].
+ */
+struct layout_box_array_struct {
+    uint32_t count;  /*!< number of stored rectangles */
+    double left[LAYOUT_BOX_ARRAY_MAX_BOXES];  /*!< left coordinates */
+    double top[LAYOUT_BOX_ARRAY_MAX_BOXES];  /*!< top coordinates */
+    double width[LAYOUT_BOX_ARRAY_MAX_BOXES];  /*!< widths */
+    double height[LAYOUT_BOX_ARRAY_MAX_BOXES];  /*!< heights */
+};
+
+typedef struct layout_box_array_struct layout_box_array_t;
+
+/*!
+ *  \brief initializes the layout_box_array_t without rectangles
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void layout_box_array_init ( layout_box_array_t *this_ );
+
+/*!
+ *  \brief re-initializes the layout_box_array_t without rectangles
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void layout_box_array_reinit ( layout_box_array_t *this_ );
+
+/*!
+ *  \brief destroys the layout_box_array_t
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void layout_box_array_destroy ( layout_box_array_t *this_ );
+
+/*!
+ *  \brief appends a copy of a rectangle
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param box the rectangle to copy
+ *  \return U8_ERROR_ARRAY_BUFFER_EXCEEDED if LAYOUT_BOX_ARRAY_MAX_BOXES rectangles are already stored, U8_ERROR_NONE otherwise
+ */
+static inline u8_error_t layout_box_array_append ( layout_box_array_t *this_, const geometry_rectangle_t *box );
+
+/*!
+ *  \brief gets the number of stored rectangles
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of rectangles
+ */
+static inline uint32_t layout_box_array_get_count ( const layout_box_array_t *this_ );
+
+/*!
+ *  \brief gets a copy of a stored rectangle
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index index of the rectangle, 0 &lt;= index &lt; layout_box_array_get_count()
+ *  \return the rectangle
+ */
+static inline geometry_rectangle_t layout_box_array_get_box ( const layout_box_array_t *this_, uint32_t index );
+
+#include "layout_box_array.inl"
+
+#endif  /* LAYOUT_BOX_ARRAY_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,71 @@
+/* File: layout_box_array.inl; Copyright and License: see below */
+
+#include <assert.h>
+
+static inline void layout_box_array_init ( layout_box_array_t *this_ )
+{
+    (*this_).count = 0;
+}
+
+static inline void layout_box_array_reinit ( layout_box_array_t *this_ )
+{
+    layout_box_array_destroy( this_ );
+    layout_box_array_init( this_ );
+}
+
+static inline void layout_box_array_destroy ( layout_box_array_t *this_ )
+{
+    (*this_).count = 0;
+}
+
+static inline u8_error_t layout_box_array_append ( layout_box_array_t *this_, const geometry_rectangle_t *box )
+{
+    assert( NULL != box );
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( (*this_).count < LAYOUT_BOX_ARRAY_MAX_BOXES )
+    {
+        const uint32_t index = (*this_).count;
+        (*this_).left[index] = geometry_rectangle_get_left( box );
+        (*this_).top[index] = geometry_rectangle_get_top( box );
+        (*this_).width[index] = geometry_rectangle_get_width( box );
+        (*this_).height[index] = geometry_rectangle_get_height( box );
+        (*this_).count ++;
+    }
+    else
+    {
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+
+    return result;
+}
+
+static inline uint32_t layout_box_array_get_count ( const layout_box_array_t *this_ )
+{
+    return (*this_).count;
+}
+
+static inline geometry_rectangle_t layout_box_array_get_box ( const layout_box_array_t *this_, uint32_t index )
+{
+    assert( index < (*this_).count );
+    geometry_rectangle_t result;
+    geometry_rectangle_init( &result, (*this_).left[index], (*this_).top[index], (*this_).width[index], (*this_).height[index] );
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
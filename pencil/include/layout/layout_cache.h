@@ -0,0 +1,202 @@
+/* File: layout_cache.h; Copyright and License: see below */
+
+#ifndef LAYOUT_CACHE_H
+#define LAYOUT_CACHE_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Keeps the geometry of recently layouted diagrams to skip layouting unchanged diagrams
+ *
+ *  The result of layouting is determined by the input data, the profile, the diagram bounds and the font metrics.
+ *  A 64-bit key is computed from these; the geometry of classifiers, features and relationships is stored per key.
+ *
+ *  The geometry records of all entries share one memory region which is reused in ring order.
+ *  If all entry slots are in use, the least recently used entry is replaced.
+ */
+
+#include "layout/layout_visible_set.h"
+#include "set/data_profile_part.h"
+#include "u8/u8_error.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *  \brief constants of layout_cache_t
+ */
+enum layout_cache_max_enum {
+    LAYOUT_CACHE_MAX_ENTRIES = 64,  /*!< maximum number of cached diagram layouts */
+    LAYOUT_CACHE_MEMORY_SIZE = 2*1024*1024,  /*!< size of the memory region for the geometry records of all entries */
+};
+
+/*!
+ *  \brief one cached diagram layout
+ */
+struct layout_cache_entry_struct {
+    uint64_t key;  /*!< key of the input data, see layout_cache_compute_key() */
+    uint64_t last_use;  /*!< value of the use_counter when the entry was stored or restored, 0 if the slot is unused */
+    uint32_t start;  /*!< byte offset of the geometry records in the memory region */
+    uint32_t size;  /*!< number of bytes of the geometry records */
+    uint32_t classifier_count;  /*!< number of stored layout_visible_classifier_t records */
+    uint32_t feature_count;  /*!< number of stored layout_feature_t records */
+    uint32_t relationship_count;  /*!< number of stored layout_relationship_t records */
+};
+
+typedef struct layout_cache_entry_struct layout_cache_entry_t;
+
+/*!
+ *  \brief attributes of the layout cache
+ *
+ *  The stored records are copies of the layout_visible_set_t arrays;
+ *  their pointers to data objects are not restored, only the geometry.
+ */
+struct layout_cache_struct {
+    layout_cache_entry_t entry[LAYOUT_CACHE_MAX_ENTRIES];  /*!< the entry slots */
+    uint64_t use_counter;  /*!< counts store and restore operations to determine the least recently used entry */
+    uint32_t write_pos;  /*!< byte offset in the memory region where the next records are stored */
+    uint64_t private_memory_buffer[LAYOUT_CACHE_MEMORY_SIZE/sizeof(uint64_t)];  /*!< 8-byte aligned memory region of all records */
+};
+
+typedef struct layout_cache_struct layout_cache_t;
+
+/*!
+ *  \brief initializes the layout_cache_t as empty cache
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void layout_cache_init ( layout_cache_t *this_ );
+
+/*!
+ *  \brief destroys the layout_cache_t
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void layout_cache_destroy ( layout_cache_t *this_ );
+
+/*!
+ *  \brief removes all entries
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void layout_cache_clear ( layout_cache_t *this_ );
+
+/*!
+ *  \brief computes the key of a layout_visible_set_t before layouting
+ *
+ *  The key covers the diagram bounds, all data objects referenced by layout_data,
+ *  the stereotypes in profile and a signature of the font metrics.
+ *
+ *  \param layout_data the layout data after the diagram bounds are defined
+ *  \param profile the stereotypes referenced from the diagram
+ *  \param font_signature a value that changes when the font metrics change
+ *  \return the 64-bit key
+ */
+uint64_t layout_cache_compute_key ( const layout_visible_set_t *layout_data,
+                                    const data_profile_part_t *profile,
+                                    uint64_t font_signature
+                                  );
+
+/*!
+ *  \brief stores the geometry of classifiers, features and relationships
+ *
+ *  An existing entry of the same key is replaced.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param key key of the input data that was layouted
+ *  \param layout_data the layouted elements
+ *  \return U8_ERROR_NONE if stored, U8_ERROR_ARRAY_BUFFER_EXCEEDED if the records do not fit into the memory region
+ */
+u8_error_t layout_cache_store ( layout_cache_t *this_, uint64_t key, const layout_visible_set_t *layout_data );
+
+/*!
+ *  \brief restores the geometry of classifiers, features and relationships
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param key key of the input data to be layouted
+ *  \param io_layout_data the elements to be layouted; the geometry is overwritten only if an entry is found
+ *  \return U8_ERROR_NONE if restored, U8_ERROR_NOT_FOUND if there is no matching entry
+ */
+u8_error_t layout_cache_restore ( layout_cache_t *this_, uint64_t key, layout_visible_set_t *io_layout_data );
+
+/*!
+ *  \brief adds a 64-bit integer to a hash value (FNV-1a)
+ *
+ *  \param hash the hash value so far
+ *  \param value the value to add
+ *  \return the new hash value
+ */
+static inline uint64_t layout_cache_hash_int ( uint64_t hash, int64_t value );
+
+/*!
+ *  \brief adds a floating point number to a hash value (FNV-1a)
+ *
+ *  \param hash the hash value so far
+ *  \param value the value to add
+ *  \return the new hash value
+ */
+static inline uint64_t layout_cache_hash_double ( uint64_t hash, double value );
+
+/*!
+ *  \brief adds a string including its terminating zero to a hash value (FNV-1a)
+ *
+ *  \param hash the hash value so far
+ *  \param value the string to add, NULL is treated like an empty string
+ *  \return the new hash value
+ */
+static inline uint64_t layout_cache_hash_str ( uint64_t hash, const char *value );
+
+/*!
+ *  \brief adds a rectangle to a hash value
+ *
+ *  \param hash the hash value so far
+ *  \param rect the rectangle to add
+ *  \return the new hash value
+ */
+static inline uint64_t layout_cache_hash_rect ( uint64_t hash, const geometry_rectangle_t *rect );
+
+/*!
+ *  \brief searches the entry of a key
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param key key to search
+ *  \return index of the entry or LAYOUT_CACHE_MAX_ENTRIES if not found
+ */
+static inline uint32_t layout_cache_private_find ( const layout_cache_t *this_, uint64_t key );
+
+/*!
+ *  \brief removes all entries whose records overlap a range of the memory region
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param start byte offset of the range
+ *  \param size number of bytes of the range
+ */
+void layout_cache_private_evict_range ( layout_cache_t *this_, uint32_t start, uint32_t size );
+
+/*!
+ *  \brief determines the slot for a new entry: an unused slot or the least recently used one
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return index of the slot
+ */
+uint32_t layout_cache_private_select_slot ( const layout_cache_t *this_ );
+
+#include "layout_cache.inl"
+
+#endif  /* LAYOUT_CACHE_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,83 @@
+/* File: layout_cache.inl; Copyright and License: see below */
+
+#include <string.h>
+#include <assert.h>
+
+/*! \brief prime of the 64-bit FNV-1a hash */
+#define LAYOUT_CACHE_FNV_PRIME (0x00000100000001b3ull)
+
+static inline uint64_t layout_cache_hash_int ( uint64_t hash, int64_t value )
+{
+    uint64_t result = hash;
+    uint64_t bits = (uint64_t) value;
+    for ( uint_fast8_t byte_idx = 0; byte_idx < sizeof(uint64_t); byte_idx ++ )
+    {
+        result = ( result ^ ( bits & 0xff ) ) * LAYOUT_CACHE_FNV_PRIME;
+        bits = bits >> 8;
+    }
+    return result;
+}
+
+static inline uint64_t layout_cache_hash_double ( uint64_t hash, double value )
+{
+    int64_t bits;
+    memcpy( &bits, &value, sizeof(bits) );
+    return layout_cache_hash_int( hash, bits );
+}
+
+static inline uint64_t layout_cache_hash_str ( uint64_t hash, const char *value )
+{
+    uint64_t result = hash;
+    if ( value != NULL )
+    {
+        for ( const unsigned char *pos = (const unsigned char*) value; (*pos) != '\0'; pos ++ )
+        {
+            result = ( result ^ (*pos) ) * LAYOUT_CACHE_FNV_PRIME;
+        }
+    }
+    /* the terminating zero separates adjacent strings */
+    result = result * LAYOUT_CACHE_FNV_PRIME;
+    return result;
+}
+
+static inline uint64_t layout_cache_hash_rect ( uint64_t hash, const geometry_rectangle_t *rect )
+{
+    assert( rect != NULL );
+    uint64_t result = hash;
+    result = layout_cache_hash_double( result, geometry_rectangle_get_left( rect ) );
+    result = layout_cache_hash_double( result, geometry_rectangle_get_top( rect ) );
+    result = layout_cache_hash_double( result, geometry_rectangle_get_width( rect ) );
+    result = layout_cache_hash_double( result, geometry_rectangle_get_height( rect ) );
+    return result;
+}
+
+static inline uint32_t layout_cache_private_find ( const layout_cache_t *this_, uint64_t key )
+{
+    uint32_t result = LAYOUT_CACHE_MAX_ENTRIES;
+    for ( uint32_t idx = 0; ( idx < LAYOUT_CACHE_MAX_ENTRIES ) && ( result == LAYOUT_CACHE_MAX_ENTRIES ); idx ++ )
+    {
+        const layout_cache_entry_t *const probe = &((*this_).entry[idx]);
+        if ( ( (*probe).last_use != 0 ) && ( (*probe).key == key ) )
+        {
+            result = idx;
+        }
+    }
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,146 @@
+/* File: layout_connector_index.h; Copyright and License: see below */
+
+#ifndef LAYOUT_CONNECTOR_INDEX_H
+#define LAYOUT_CONNECTOR_INDEX_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Finds the already routed connectors near an area while relationships are layouted one after the other
+ *
+ *  A uniform grid of cells spans the diagram bounds.
+ *  Each cell lists the connectors whose segments touch the cell; connectors are added when their shape is fixed.
+ *  Connectors are numbered in the order in which they are added.
+ *  Connectors that touch too many cells are stored in a separate list which is returned by every query.
+ *
+ *  Queries return candidates only; callers still check the exact geometry.
+ */
+
+#include "layout/layout_spatial_iter.h"
+#include "geometry/geometry_rectangle.h"
+#include "geometry/geometry_connector.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *  \brief constants of layout_connector_index_t
+ */
+enum layout_connector_index_max_enum {
+    LAYOUT_CONNECTOR_INDEX_COLUMNS = 32,  /*!< number of cell columns */
+    LAYOUT_CONNECTOR_INDEX_ROWS = 32,  /*!< number of cell rows */
+    LAYOUT_CONNECTOR_INDEX_CELLS = LAYOUT_CONNECTOR_INDEX_COLUMNS * LAYOUT_CONNECTOR_INDEX_ROWS,  /*!< number of cells */
+    LAYOUT_CONNECTOR_INDEX_MAX_ENTRIES = 16384,  /*!< maximum number of cell entries */
+    LAYOUT_CONNECTOR_INDEX_MAX_CELLS_PER_ITEM = 64,  /*!< connectors touching more cells are stored in the list of large connectors */
+    LAYOUT_CONNECTOR_INDEX_VOID = 0xffff,  /*!< marks the end of the list of entries of a cell */
+};
+
+/*!
+ *  \brief attributes of the connector index
+ *
+ *  The entries of a cell form a singly linked list, the most recently added connector first.
+ */
+struct layout_connector_index_struct {
+    double left;  /*!< left coordinate of the indexed area */
+    double top;  /*!< top coordinate of the indexed area */
+    double column_factor;  /*!< number of columns per unit of x */
+    double row_factor;  /*!< number of rows per unit of y */
+    uint32_t item_count;  /*!< number of added connectors */
+    uint32_t entry_count;  /*!< number of used entries */
+    uint16_t cell_head[LAYOUT_CONNECTOR_INDEX_CELLS];  /*!< first entry of each cell, LAYOUT_CONNECTOR_INDEX_VOID if empty */
+    uint16_t entry_item[LAYOUT_CONNECTOR_INDEX_MAX_ENTRIES];  /*!< number of the connector of each entry */
+    uint16_t entry_next[LAYOUT_CONNECTOR_INDEX_MAX_ENTRIES];  /*!< next entry in the same cell, LAYOUT_CONNECTOR_INDEX_VOID if none */
+    layout_spatial_iter_t large_items;  /*!< connectors that are not stored in cells */
+};
+
+typedef struct layout_connector_index_struct layout_connector_index_t;
+
+/*!
+ *  \brief initializes the layout_connector_index_t without connectors
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param bounds the area spanned by the cells
+ */
+void layout_connector_index_init ( layout_connector_index_t *this_, const geometry_rectangle_t *bounds );
+
+/*!
+ *  \brief re-initializes the layout_connector_index_t without connectors
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param bounds the area spanned by the cells
+ */
+static inline void layout_connector_index_reinit ( layout_connector_index_t *this_, const geometry_rectangle_t *bounds );
+
+/*!
+ *  \brief destroys the layout_connector_index_t
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void layout_connector_index_destroy ( layout_connector_index_t *this_ );
+
+/*!
+ *  \brief gets the number of added connectors
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of connectors
+ */
+static inline uint32_t layout_connector_index_get_count ( const layout_connector_index_t *this_ );
+
+/*!
+ *  \brief adds a connector, which gets the number layout_connector_index_get_count()
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param shape the connector; the index refers to the cells only, not to the shape
+ *  \return number of the added connector
+ */
+uint32_t layout_connector_index_add ( layout_connector_index_t *this_, const geometry_connector_t *shape );
+
+/*!
+ *  \brief determines the connectors that may intersect an area
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param area the area to search
+ *  \param out_candidates iterator over the numbers of the candidate connectors, in the order in which they were added
+ */
+void layout_connector_index_query_area ( const layout_connector_index_t *this_,
+                                         const geometry_rectangle_t *area,
+                                         layout_spatial_iter_t *out_candidates
+                                       );
+
+/*!
+ *  \brief gets the column of an x coordinate, limited to the range of columns
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param x x-position
+ *  \return column index
+ */
+static inline uint32_t layout_connector_index_private_get_column ( const layout_connector_index_t *this_, double x );
+
+/*!
+ *  \brief gets the row of a y coordinate, limited to the range of rows
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param y y-position
+ *  \return row index
+ */
+static inline uint32_t layout_connector_index_private_get_row ( const layout_connector_index_t *this_, double y );
+
+#include "layout_connector_index.inl"
+
+#endif  /* LAYOUT_CONNECTOR_INDEX_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
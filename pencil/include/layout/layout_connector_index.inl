@@ -0,0 +1,49 @@
+/* File: layout_connector_index.inl; Copyright and License: see below */
+
+#include <assert.h>
+
+static inline void layout_connector_index_reinit ( layout_connector_index_t *this_, const geometry_rectangle_t *bounds )
+{
+    layout_connector_index_destroy( this_ );
+    layout_connector_index_init( this_, bounds );
+}
+
+static inline uint32_t layout_connector_index_get_count ( const layout_connector_index_t *this_ )
+{
+    return (*this_).item_count;
+}
+
+static inline uint32_t layout_connector_index_private_get_column ( const layout_connector_index_t *this_, double x )
+{
+    const double column = ( x - (*this_).left ) * (*this_).column_factor;
+    /* note: a NaN column is mapped to 0 */
+    return ( column >= ( LAYOUT_CONNECTOR_INDEX_COLUMNS - 1 ) )
+        ? ( LAYOUT_CONNECTOR_INDEX_COLUMNS - 1 )
+        : ( ( column > 0.0 ) ? (uint32_t) column : 0 );
+}
+
+static inline uint32_t layout_connector_index_private_get_row ( const layout_connector_index_t *this_, double y )
+{
+    const double row = ( y - (*this_).top ) * (*this_).row_factor;
+    /* note: a NaN row is mapped to 0 */
+    return ( row >= ( LAYOUT_CONNECTOR_INDEX_ROWS - 1 ) )
+        ? ( LAYOUT_CONNECTOR_INDEX_ROWS - 1 )
+        : ( ( row > 0.0 ) ? (uint32_t) row : 0 );
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -13,6 +13,8 @@
  */
 
 #include "pencil_size.h"
+#include "layout/layout_visible_set.h"
+#include "layout/layout_box_array.h"
 #include "geometry/geometry_offset.h"
 #include <stdint.h>
 
@@ -140,6 +142,40 @@ static inline double layout_quality_debts_conn_sym ( const layout_quality_t *thi
                                                      const geometry_rectangle_t *other
                                                    );
 
+/*!
+ *  \brief determines the quality debts for drawing the connector of a relationship and each of many feature symbol boxes
+ *
+ *  The results equal layout_quality_debts_conn_sym() bit by bit for all finite coordinates.
+ *  On SSE2 capable processors, two boxes are checked at once.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param probe a partly layouted relationship
+ *  \param others the symbol boxes of partly layouted features
+ *  \param index indices of the boxes in others to check
+ *  \param index_count number of indices
+ *  \param out_debts the debts per checked box, out_debts[n] belongs to others[index[n]]; array size: index_count
+ */
+void layout_quality_debts_conn_sym_batch ( const layout_quality_t *this_,
+                                           const geometry_connector_t *probe,
+                                           const layout_box_array_t *others,
+                                           const uint32_t index[],
+                                           uint32_t index_count,
+                                           double out_debts[]
+                                         );
+
+/*!
+ *  \brief combines the overlap lengths of a connector and a feature symbol box to quality debts
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param transit_length length of the connector within the symbol box
+ *  \param same_path_length length of the connector along the border of the symbol box
+ *  \return 0.0 if there are no overlaps, a positive value otherwise
+ */
+static inline double layout_quality_private_debts_conn_sym_lengths ( const layout_quality_t *this_,
+                                                                     double transit_length,
+                                                                     double same_path_length
+                                                                   );
+
 /*!
  *  \brief determines the quality debts for drawing both connectors of relationships
  *
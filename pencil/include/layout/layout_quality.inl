@@ -383,17 +383,26 @@ static inline double layout_quality_debts_conn_sym( const layout_quality_t *this
                                                     const geometry_connector_t *probe,
                                                     const geometry_rectangle_t *other )
 {
-    double debts = 0.0;
-
-    const double line_corridor = pencil_size_get_preferred_object_distance( (*this_).pencil_size );
     const double line_width = pencil_size_get_standard_line_width( (*this_).pencil_size );
 
-    debts += LAYOUT_QUALITY_WEIGHT_CROSS_LINE_AREA
-        * geometry_connector_get_transit_length( probe, other ) * line_corridor;
+    const double transit = geometry_connector_get_transit_length( probe, other );
     const double same_path
         = geometry_connector_get_same_path_length_rect( probe, other, 5.0 * line_width );
     /* ^ max_distance is 5x line width because the contour line of a classifier is 3x linewidth within the bounds */
-    debts += LAYOUT_QUALITY_WEIGHT_SHARED_LINES * same_path * line_corridor;
+
+    return layout_quality_private_debts_conn_sym_lengths( this_, transit, same_path );
+}
+
+static inline double layout_quality_private_debts_conn_sym_lengths ( const layout_quality_t *this_,
+                                                                     double transit_length,
+                                                                     double same_path_length )
+{
+    double debts = 0.0;
+
+    const double line_corridor = pencil_size_get_preferred_object_distance( (*this_).pencil_size );
+
+    debts += LAYOUT_QUALITY_WEIGHT_CROSS_LINE_AREA * transit_length * line_corridor;
+    debts += LAYOUT_QUALITY_WEIGHT_SHARED_LINES * same_path_length * line_corridor;
 
     return debts;
 }
@@ -0,0 +1,240 @@
+/* File: layout_spatial_index.h; Copyright and License: see below */
+
+#ifndef LAYOUT_SPATIAL_INDEX_H
+#define LAYOUT_SPATIAL_INDEX_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Finds the layouted elements near a position or within an area
+ *
+ *  A uniform grid of cells spans the diagram bounds.
+ *  Each cell lists the classifiers, features and relationships whose boxes or connector segments touch the cell.
+ *  Besides hit-testing, the relationship layouter uses the index to find the obstacles near a proposed connector.
+ *  Elements that touch too many cells are stored in a separate list which is returned by every query.
+ *  Positions outside the diagram bounds are mapped to the nearest border cell.
+ *
+ *  Queries return candidates only; callers still check the exact geometry.
+ */
+
+#include "layout/layout_spatial_iter.h"
+#include "layout/layout_visible_set.h"
+#include "geometry/geometry_rectangle.h"
+#include "geometry/geometry_connector.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *  \brief constants of layout_spatial_index_t
+ */
+enum layout_spatial_index_max_enum {
+    LAYOUT_SPATIAL_INDEX_COLUMNS = 32,  /*!< number of cell columns */
+    LAYOUT_SPATIAL_INDEX_ROWS = 32,  /*!< number of cell rows */
+    LAYOUT_SPATIAL_INDEX_CELLS = LAYOUT_SPATIAL_INDEX_COLUMNS * LAYOUT_SPATIAL_INDEX_ROWS,  /*!< number of cells */
+    LAYOUT_SPATIAL_INDEX_MAX_ENTRIES = 16384,  /*!< maximum number of cell entries per element kind */
+    LAYOUT_SPATIAL_INDEX_MAX_CELLS_PER_ITEM = 64,  /*!< elements touching more cells are stored in the list of large elements */
+};
+
+/*!
+ *  \brief kinds of elements in the layout_spatial_index_t
+ */
+enum layout_spatial_index_kind_enum {
+    LAYOUT_SPATIAL_INDEX_KIND_CLASSIFIER = 0,  /*!< layout_visible_classifier_t: symbol box, label box and icon box */
+    LAYOUT_SPATIAL_INDEX_KIND_FEATURE = 1,  /*!< layout_feature_t: symbol box and label box */
+    LAYOUT_SPATIAL_INDEX_KIND_RELATIONSHIP = 2,  /*!< layout_relationship_t: three connector segments and label box */
+    LAYOUT_SPATIAL_INDEX_KIND_MAX = 3,  /*!< number of element kinds */
+};
+
+typedef enum layout_spatial_index_kind_enum layout_spatial_index_kind_t;
+
+/*!
+ *  \brief the cells of one element kind, stored as one array of entries sorted by cell
+ */
+struct layout_spatial_index_cells_struct {
+    uint32_t cell_start[LAYOUT_SPATIAL_INDEX_CELLS+1];  /*!< the entries of cell c are entry[cell_start[c]] to entry[cell_start[c+1]-1] */
+    uint16_t entry[LAYOUT_SPATIAL_INDEX_MAX_ENTRIES];  /*!< array indices of the elements, ascending within each cell */
+    uint16_t large_item[LAYOUT_SPATIAL_ITER_MAX_ITEMS];  /*!< ascending array indices of elements that are not stored in cells */
+    uint32_t large_count;  /*!< number of large_item entries */
+};
+
+typedef struct layout_spatial_index_cells_struct layout_spatial_index_cells_t;
+
+/*!
+ *  \brief attributes of the spatial index
+ *
+ *  Lifecycle: The index is built after layouting; it is invalidated when the layout_visible_set_t changes.
+ *  While invalid, queries return all elements of the requested kind.
+ */
+struct layout_spatial_index_struct {
+    const layout_visible_set_t *layout_data;  /*!< pointer to the external layout data that is indexed */
+    bool valid;  /*!< true if the cells reflect the current layout_data */
+    double left;  /*!< left coordinate of the indexed area */
+    double top;  /*!< top coordinate of the indexed area */
+    double column_factor;  /*!< number of columns per unit of x */
+    double row_factor;  /*!< number of rows per unit of y */
+    layout_spatial_index_cells_t cells[LAYOUT_SPATIAL_INDEX_KIND_MAX];  /*!< the cells per element kind */
+};
+
+typedef struct layout_spatial_index_struct layout_spatial_index_t;
+
+/*!
+ *  \brief initializes the layout_spatial_index_t as invalid index
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param layout_data pointer to the layout data to be indexed
+ */
+void layout_spatial_index_init ( layout_spatial_index_t *this_, const layout_visible_set_t *layout_data );
+
+/*!
+ *  \brief destroys the layout_spatial_index_t
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void layout_spatial_index_destroy ( layout_spatial_index_t *this_ );
+
+/*!
+ *  \brief marks the index as invalid, e.g. because the layout_data has changed
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void layout_spatial_index_invalidate ( layout_spatial_index_t *this_ );
+
+/*!
+ *  \brief checks if the index reflects the current layout data
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if valid
+ */
+static inline bool layout_spatial_index_is_valid ( const layout_spatial_index_t *this_ );
+
+/*!
+ *  \brief rebuilds the index from the current layout data
+ *
+ *  resync shall be called when layouting has finished.
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void layout_spatial_index_resync ( layout_spatial_index_t *this_ );
+
+/*!
+ *  \brief determines the candidates of one element kind that may be close to a position
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param kind kind of elements to search
+ *  \param x x-position
+ *  \param y y-position
+ *  \param distance maximum distance of elements to x/y, 0.0 to search elements containing x/y
+ *  \param out_candidates iterator over the array indices of the candidates
+ */
+void layout_spatial_index_query_pos ( const layout_spatial_index_t *this_,
+                                      layout_spatial_index_kind_t kind,
+                                      double x,
+                                      double y,
+                                      double distance,
+                                      layout_spatial_iter_t *out_candidates
+                                    );
+
+/*!
+ *  \brief determines the candidates of one element kind that may intersect an area
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param kind kind of elements to search
+ *  \param area the area to search
+ *  \param out_candidates iterator over the array indices of the candidates
+ */
+void layout_spatial_index_query_area ( const layout_spatial_index_t *this_,
+                                       layout_spatial_index_kind_t kind,
+                                       const geometry_rectangle_t *area,
+                                       layout_spatial_iter_t *out_candidates
+                                     );
+
+/*!
+ *  \brief gets the number of elements of a kind in layout_data
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param kind kind of elements to count
+ *  \return number of elements
+ */
+static inline uint32_t layout_spatial_index_private_get_item_count ( const layout_spatial_index_t *this_,
+                                                                     layout_spatial_index_kind_t kind
+                                                                   );
+
+/*!
+ *  \brief gets the column of an x coordinate, limited to the range of columns
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param x x-position
+ *  \return column index
+ */
+static inline uint32_t layout_spatial_index_private_get_column ( const layout_spatial_index_t *this_, double x );
+
+/*!
+ *  \brief gets the row of a y coordinate, limited to the range of rows
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param y y-position
+ *  \return row index
+ */
+static inline uint32_t layout_spatial_index_private_get_row ( const layout_spatial_index_t *this_, double y );
+
+/*!
+ *  \brief determines the cells that an element touches
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param kind kind of the element
+ *  \param index array index of the element
+ *  \param out_cells array of LAYOUT_SPATIAL_INDEX_MAX_CELLS_PER_ITEM cell indices, each cell at most once
+ *  \param out_cell_count number of cells in out_cells
+ *  \return true if all cells fit into out_cells, false if the element is large
+ */
+bool layout_spatial_index_private_get_cells ( const layout_spatial_index_t *this_,
+                                              layout_spatial_index_kind_t kind,
+                                              uint32_t index,
+                                              uint32_t out_cells[],
+                                              uint32_t *out_cell_count
+                                            );
+
+/*!
+ *  \brief adds the cells that a rectangle touches to a list of cells
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param rect the rectangle
+ *  \param io_cells array of LAYOUT_SPATIAL_INDEX_MAX_CELLS_PER_ITEM cell indices, each cell at most once
+ *  \param io_cell_count number of cells in io_cells
+ *  \return true if all cells fit into io_cells
+ */
+bool layout_spatial_index_private_add_rect_cells ( const layout_spatial_index_t *this_,
+                                                   const geometry_rectangle_t *rect,
+                                                   uint32_t io_cells[],
+                                                   uint32_t *io_cell_count
+                                                 );
+
+/*!
+ *  \brief builds the cells of one element kind
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param kind kind of elements to index
+ *  \return true if the index could be built, false if there are too many elements
+ */
+bool layout_spatial_index_private_build_cells ( layout_spatial_index_t *this_, layout_spatial_index_kind_t kind );
+
+#include "layout_spatial_index.inl"
+
+#endif  /* LAYOUT_SPATIAL_INDEX_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,76 @@
+/* File: layout_spatial_index.inl; Copyright and License: see below */
+
+#include <assert.h>
+
+static inline void layout_spatial_index_invalidate ( layout_spatial_index_t *this_ )
+{
+    (*this_).valid = false;
+}
+
+static inline bool layout_spatial_index_is_valid ( const layout_spatial_index_t *this_ )
+{
+    return (*this_).valid;
+}
+
+static inline uint32_t layout_spatial_index_private_get_item_count ( const layout_spatial_index_t *this_,
+                                                                     layout_spatial_index_kind_t kind )
+{
+    uint32_t result;
+    switch ( kind )
+    {
+        case LAYOUT_SPATIAL_INDEX_KIND_CLASSIFIER:
+        {
+            result = layout_visible_set_get_visible_classifier_count( (*this_).layout_data );
+        }
+        break;
+
+        case LAYOUT_SPATIAL_INDEX_KIND_FEATURE:
+        {
+            result = layout_visible_set_get_feature_count( (*this_).layout_data );
+        }
+        break;
+
+        case LAYOUT_SPATIAL_INDEX_KIND_RELATIONSHIP:
+        default:
+        {
+            result = layout_visible_set_get_relationship_count( (*this_).layout_data );
+        }
+        break;
+    }
+    return result;
+}
+
+static inline uint32_t layout_spatial_index_private_get_column ( const layout_spatial_index_t *this_, double x )
+{
+    const double column = ( x - (*this_).left ) * (*this_).column_factor;
+    /* note: a NaN column is mapped to 0 */
+    return ( column >= ( LAYOUT_SPATIAL_INDEX_COLUMNS - 1 ) )
+        ? ( LAYOUT_SPATIAL_INDEX_COLUMNS - 1 )
+        : ( ( column > 0.0 ) ? (uint32_t) column : 0 );
+}
+
+static inline uint32_t layout_spatial_index_private_get_row ( const layout_spatial_index_t *this_, double y )
+{
+    const double row = ( y - (*this_).top ) * (*this_).row_factor;
+    /* note: a NaN row is mapped to 0 */
+    return ( row >= ( LAYOUT_SPATIAL_INDEX_ROWS - 1 ) )
+        ? ( LAYOUT_SPATIAL_INDEX_ROWS - 1 )
+        : ( ( row > 0.0 ) ? (uint32_t) row : 0 );
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,124 @@
+/* File: layout_spatial_iter.h; Copyright and License: see below */
+
+#ifndef LAYOUT_SPATIAL_ITER_H
+#define LAYOUT_SPATIAL_ITER_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief Iterator over the candidates of a layout_spatial_index_t query.
+ *
+ *  The candidates are returned in ascending array-index order, each one once,
+ *  so that callers visit them in the same order as a linear scan over the layout_visible_set_t would.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *  \brief constants of layout_spatial_iter_t
+ */
+enum layout_spatial_iter_max_enum {
+    LAYOUT_SPATIAL_ITER_MAX_ITEMS = 4096,  /*!< maximum number of items of one kind, see LAYOUT_VISIBLE_SET_MAX_FEATURES */
+    LAYOUT_SPATIAL_ITER_WORD_BITS = 64,  /*!< number of bits per word of the member bitset */
+};
+
+/*!
+ *  \brief attributes of the iterator
+ */
+struct layout_spatial_iter_struct {
+    uint32_t next_idx;  /*!< next candidate index; equals end_idx if there is no further candidate */
+    uint32_t end_idx;  /*!< index after the last possible candidate */
+    uint64_t member[LAYOUT_SPATIAL_ITER_MAX_ITEMS/LAYOUT_SPATIAL_ITER_WORD_BITS];  /*!< bitset of candidate indices */
+};
+
+typedef struct layout_spatial_iter_struct layout_spatial_iter_t;
+
+/*!
+ *  \brief initializes the layout_spatial_iter_t without candidates
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param end_idx index after the last possible candidate, typically the number of items; max: LAYOUT_SPATIAL_ITER_MAX_ITEMS
+ */
+static inline void layout_spatial_iter_init_empty( layout_spatial_iter_t *this_, uint32_t end_idx );
+
+/*!
+ *  \brief initializes the layout_spatial_iter_t with all indices from 0 to end_idx-1 as candidates
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param end_idx index after the last candidate, typically the number of items; max: LAYOUT_SPATIAL_ITER_MAX_ITEMS
+ */
+static inline void layout_spatial_iter_init_all( layout_spatial_iter_t *this_, uint32_t end_idx );
+
+/*!
+ *  \brief destroys the layout_spatial_iter_t
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void layout_spatial_iter_destroy( layout_spatial_iter_t *this_ );
+
+/*!
+ *  \brief adds a candidate
+ *
+ *  Adding is only allowed before the first call to layout_spatial_iter_next().
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param index candidate index to add, duplicates are ignored; 0 &lt;= index &lt; end_idx
+ */
+static inline void layout_spatial_iter_add( layout_spatial_iter_t *this_, uint32_t index );
+
+/*!
+ *  \brief adds all candidates of another iterator
+ *
+ *  Adding is only allowed before the first call to layout_spatial_iter_next().
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param that iterator whose candidates are added; all its candidates shall be lower than end_idx of this_
+ */
+static inline void layout_spatial_iter_add_all( layout_spatial_iter_t *this_, const layout_spatial_iter_t *that );
+
+/*!
+ *  \brief checks if there are more candidates
+ *
+ *  has_next() does not modify the iterator; multiple calls to has_next() do not skip elements.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if there is at least one more candidate.
+ */
+static inline bool layout_spatial_iter_has_next( const layout_spatial_iter_t *this_ );
+
+/*!
+ *  \brief gets the next candidate index if there are more, end_idx otherwise.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return the next candidate index
+ */
+static inline uint32_t layout_spatial_iter_next( layout_spatial_iter_t *this_ );
+
+/*!
+ *  \brief moves next_idx forward to the next candidate or to end_idx
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void layout_spatial_iter_private_skip_non_members( layout_spatial_iter_t *this_ );
+
+#include "layout_spatial_iter.inl"
+
+#endif  /* LAYOUT_SPATIAL_ITER_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,117 @@
+/* File: layout_spatial_iter.inl; Copyright and License: see below */
+
+#include <string.h>
+#include <assert.h>
+
+static inline void layout_spatial_iter_init_empty( layout_spatial_iter_t *this_, uint32_t end_idx )
+{
+    assert( end_idx <= LAYOUT_SPATIAL_ITER_MAX_ITEMS );
+    (*this_).next_idx = 0;
+    (*this_).end_idx = end_idx;
+    memset( &((*this_).member), 0, sizeof((*this_).member) );
+}
+
+static inline void layout_spatial_iter_init_all( layout_spatial_iter_t *this_, uint32_t end_idx )
+{
+    assert( end_idx <= LAYOUT_SPATIAL_ITER_MAX_ITEMS );
+    (*this_).next_idx = 0;
+    (*this_).end_idx = end_idx;
+    memset( &((*this_).member), 0xff, sizeof((*this_).member) );
+}
+
+static inline void layout_spatial_iter_destroy( layout_spatial_iter_t *this_ )
+{
+    (*this_).next_idx = 0;
+    (*this_).end_idx = 0;
+}
+
+static inline void layout_spatial_iter_add( layout_spatial_iter_t *this_, uint32_t index )
+{
+    assert( index < (*this_).end_idx );
+    assert( (*this_).next_idx == 0 );
+    (*this_).member[index/LAYOUT_SPATIAL_ITER_WORD_BITS] |= ( ((uint64_t)1) << ( index % LAYOUT_SPATIAL_ITER_WORD_BITS ) );
+}
+
+static inline void layout_spatial_iter_add_all( layout_spatial_iter_t *this_, const layout_spatial_iter_t *that )
+{
+    assert( (*this_).next_idx == 0 );
+    const uint32_t words = ( (*that).end_idx + LAYOUT_SPATIAL_ITER_WORD_BITS - 1 ) / LAYOUT_SPATIAL_ITER_WORD_BITS;
+    for ( uint32_t word = 0; word < words; word ++ )
+    {
+        (*this_).member[word] |= (*that).member[word];
+    }
+}
+
+static inline bool layout_spatial_iter_has_next( const layout_spatial_iter_t *this_ )
+{
+    bool result = false;
+    for ( uint32_t idx = (*this_).next_idx; ( idx < (*this_).end_idx ) && ( ! result ); idx ++ )
+    {
+        const uint64_t bits = (*this_).member[idx/LAYOUT_SPATIAL_ITER_WORD_BITS] >> ( idx % LAYOUT_SPATIAL_ITER_WORD_BITS );
+        if ( bits == 0 )
+        {
+            /* skip the rest of this word */
+            idx = ( idx / LAYOUT_SPATIAL_ITER_WORD_BITS + 1 ) * LAYOUT_SPATIAL_ITER_WORD_BITS - 1;
+        }
+        else
+        {
+            result = ( ( bits & 1 ) != 0 );
+        }
+    }
+    return result;
+}
+
+static inline uint32_t layout_spatial_iter_next( layout_spatial_iter_t *this_ )
+{
+    layout_spatial_iter_private_skip_non_members( this_ );
+    const uint32_t result = (*this_).next_idx;
+    if ( (*this_).next_idx < (*this_).end_idx )
+    {
+        (*this_).next_idx ++;
+    }
+    return result;
+}
+
+static inline void layout_spatial_iter_private_skip_non_members( layout_spatial_iter_t *this_ )
+{
+    bool found = false;
+    while ( ( (*this_).next_idx < (*this_).end_idx ) && ( ! found ) )
+    {
+        const uint32_t idx = (*this_).next_idx;
+        const uint64_t bits = (*this_).member[idx/LAYOUT_SPATIAL_ITER_WORD_BITS] >> ( idx % LAYOUT_SPATIAL_ITER_WORD_BITS );
+        if ( bits == 0 )
+        {
+            /* skip the rest of this word */
+            (*this_).next_idx = ( idx / LAYOUT_SPATIAL_ITER_WORD_BITS + 1 ) * LAYOUT_SPATIAL_ITER_WORD_BITS;
+        }
+        else if ( ( bits & 1 ) != 0 )
+        {
+            found = true;
+        }
+        else
+        {
+            (*this_).next_idx ++;
+        }
+    }
+    if ( (*this_).next_idx > (*this_).end_idx )
+    {
+        (*this_).next_idx = (*this_).end_idx;
+    }
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
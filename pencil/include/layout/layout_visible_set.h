@@ -28,11 +28,15 @@
  *
  *  While the data_visible_set_t contains features and relationships just once,
  *  layout_visible_set_t contains these once per instance of every visible_classifier_t.
+ *
+ *  The arrays of layout_visible_set_t are allocated on the heap and grow on demand.
+ *  The maximum numbers of features and relationships are limited by LAYOUT_SPATIAL_ITER_MAX_ITEMS,
+ *  the number of elements of one kind that the spatial indices of the layouters can address.
  */
 enum layout_visible_set_max_enum {
     LAYOUT_VISIBLE_SET_MAX_CLASSIFIERS = DATA_VISIBLE_SET_MAX_CLASSIFIERS,  /*!< maximum number of classifiers to be shown in one single diagram */
-    LAYOUT_VISIBLE_SET_MAX_FEATURES = DATA_VISIBLE_SET_MAX_FEATURES + 32,  /*!< maximum number of features to be shown in one single diagram */
-    LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS = DATA_VISIBLE_SET_MAX_RELATIONSHIPS * 2,  /*!< maximum number of relationships to be shown in one single diagram */
+    LAYOUT_VISIBLE_SET_MAX_FEATURES = 4096,  /*!< maximum number of features to be shown in one single diagram */
+    LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS = 4096,  /*!< maximum number of relationships to be shown in one single diagram */
 };
 
 /*!
@@ -51,16 +55,19 @@ struct layout_visible_set_struct {
     bool diagram_valid;  /*!< true if diagram_layout is initialized */
 
     /* classifier layout*/
-    layout_visible_classifier_t visible_classifier_layout[LAYOUT_VISIBLE_SET_MAX_CLASSIFIERS];  /*!< layout data of visible classifiers */
+    layout_visible_classifier_t *visible_classifier_layout;  /*!< layout data of visible classifiers, heap allocated */
+                                                             /*!< once per init because features refer to these */
     uint32_t visible_classifier_count;  /*!< number of all layouted visible classifier records */
 
     /* feature layout */
-    layout_feature_t feature_layout[LAYOUT_VISIBLE_SET_MAX_FEATURES];  /*!< layout data of features */
+    layout_feature_t *feature_layout;  /*!< layout data of features, heap allocated */
     uint32_t feature_count;  /*!< number of all layouted feature records */
+    uint32_t feature_capacity;  /*!< number of feature records that fit into the current array */
 
     /* relationship layout */
-    layout_relationship_t relationship_layout[LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS];  /*!< layout data of relationships */
+    layout_relationship_t *relationship_layout;  /*!< layout data of relationships, heap allocated */
     uint32_t relationship_count;  /*!< number of all layouted relationship records */
+    uint32_t relationship_capacity;  /*!< number of relationship records that fit into the current array */
 
     /* input data */
     const data_visible_set_t *input_data;  /*!< the input data which is base for the layout data */
@@ -330,6 +337,46 @@ uint32_t layout_visible_set_private_init_relationship( layout_visible_set_t *thi
                                                        uint32_t *io_dropped_relationships
                                                      );
 
+/*!
+ *  \brief ensures that the feature_layout array can hold one more element
+ *
+ *  Note that the feature_layout array may move, this is allowed only till relationships refer to features.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE if there is space for one more element, U8_ERROR_ARRAY_BUFFER_EXCEEDED otherwise
+ */
+u8_error_t layout_visible_set_private_reserve_feature ( layout_visible_set_t *this_ );
+
+/*!
+ *  \brief ensures that the relationship_layout array can hold one more element
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE if there is space for one more element, U8_ERROR_ARRAY_BUFFER_EXCEEDED otherwise
+ */
+u8_error_t layout_visible_set_private_reserve_relationship ( layout_visible_set_t *this_ );
+
+/*!
+ *  \brief ensures that a heap allocated layout array can hold one more element
+ *
+ *  The array doubles its capacity when it is full, this may move the array.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param io_array pointer to the array pointer, the array pointer is updated if the array is moved
+ *  \param io_capacity pointer to the number of elements that fit into the array, updated if the array grows
+ *  \param element_size size of one array element
+ *  \param count number of elements in the array
+ *  \param max_count maximum number of elements of the array
+ *  \return U8_ERROR_NONE if there is space for one more element,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if max_count is reached or no memory is available
+ */
+u8_error_t layout_visible_set_private_reserve ( layout_visible_set_t *this_,
+                                                void **io_array,
+                                                uint32_t *io_capacity,
+                                                size_t element_size,
+                                                uint32_t count,
+                                                uint32_t max_count
+                                              );
+
 #include "layout_visible_set.inl"
 
 #endif  /* LAYOUT_VISIBLE_SET_H */
@@ -18,6 +18,7 @@
 #include "pencil_error.h"
 #include "layout/layout_order.h"
 #include "layout/layout_visible_set.h"
+#include "layout/layout_spatial_index.h"
 #include "geometry/geometry_rectangle.h"
 #include "geometry/geometry_non_linear_scale.h"
 #include "geometry/geometry_grid.h"
@@ -81,6 +82,14 @@ static inline void pencil_diagram_maker_reinit ( pencil_diagram_maker_t *this_,
  */
 static inline void pencil_diagram_maker_destroy ( pencil_diagram_maker_t *this_ );
 
+/*!
+ *  \brief sets the cache of layout results
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param layout_cache pointer to an external layout cache, NULL to layout without cache
+ */
+static inline void pencil_diagram_maker_set_layout_cache ( pencil_diagram_maker_t *this_, layout_cache_t *layout_cache );
+
 /*!
  *  \brief defines coordinates
  *
@@ -125,6 +134,16 @@ static inline void pencil_diagram_maker_layout_elements ( pencil_diagram_maker_t
  */
 static inline const layout_visible_set_t *pencil_diagram_maker_get_layout_data_const ( const pencil_diagram_maker_t *this_ );
 
+/*!
+ *  \brief returns the spatial index on the layout_visible_set_t object
+ *
+ *  The index is valid after a call to pencil_diagram_maker_layout_elements().
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return pointer to layout_spatial_index_t, queries return all elements if not valid.
+ */
+static inline const layout_spatial_index_t *pencil_diagram_maker_get_spatial_index_const ( const pencil_diagram_maker_t *this_ );
+
 /*!
  *  \brief draws the chosen diagram contents into the diagram_bounds area of the cairo drawing context
  *
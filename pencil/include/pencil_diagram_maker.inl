@@ -54,6 +54,11 @@ static inline void pencil_diagram_maker_destroy( pencil_diagram_maker_t *this_ )
     U8_TRACE_END();
 }
 
+static inline void pencil_diagram_maker_set_layout_cache( pencil_diagram_maker_t *this_, layout_cache_t *layout_cache )
+{
+    pencil_layouter_set_layout_cache( &((*this_).layouter), layout_cache );
+}
+
 static inline void pencil_diagram_maker_define_grid( pencil_diagram_maker_t *this_,
                                                      geometry_rectangle_t diagram_bounds,
                                                      cairo_t *cr )
@@ -107,6 +112,11 @@ static inline const layout_visible_set_t *pencil_diagram_maker_get_layout_data_c
     return pencil_layouter_get_layout_data_const( &((*this_).layouter) );
 }
 
+static inline const layout_spatial_index_t *pencil_diagram_maker_get_spatial_index_const( const pencil_diagram_maker_t *this_ )
+{
+    return pencil_layouter_get_spatial_index_const( &((*this_).layouter) );
+}
+
 
 /*
 Copyright 2016-2026 Andreas Warnke
@@ -13,6 +13,8 @@
 #include "pencil_classifier_composer.h"
 #include "pencil_size.h"
 #include "layout/layout_visible_set.h"
+#include "layout/layout_spatial_index.h"
+#include "layout/layout_cache.h"
 #include "pencil_diagram_painter.h"
 #include "pencil_feature_painter.h"
 #include "pencil_feature_layouter.h"
@@ -44,7 +46,9 @@
  */
 struct pencil_layouter_struct {
     layout_visible_set_t layout_data;  /* own instance of layout data */
+    layout_spatial_index_t spatial_index;  /*!< own instance of a spatial index on layout_data, valid after layouting */
     const data_profile_part_t *profile;  /*!< pointer to an external stereotype-image cache */
+    layout_cache_t *layout_cache;  /*!< pointer to an external cache of layout results, NULL if layouts are not cached */
 
     pencil_size_t pencil_size;  /*!< own instance of a pencil_size_t object, defining pen sizes, gap sizes, font sizes and colors */
     geometry_grid_t grid;  /*!< own instance of a pair of scale objects to calculate positions from order numbers */
@@ -95,6 +99,16 @@ void pencil_layouter_reinit( pencil_layouter_t *this_,
  */
 void pencil_layouter_destroy( pencil_layouter_t *this_ );
 
+/*!
+ *  \brief sets the cache of layout results
+ *
+ *  If a cache is set, pencil_layouter_layout_elements restores the layout of unchanged input data from the cache.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param layout_cache pointer to an external layout cache, NULL to layout without cache
+ */
+static inline void pencil_layouter_set_layout_cache ( pencil_layouter_t *this_, layout_cache_t *layout_cache );
+
 /*!
  *  \brief resets previous layout data, synchronizes the internal layout data with the *input_data
  *
@@ -124,6 +138,9 @@ static inline const geometry_grid_t *pencil_layouter_get_grid_const ( const penc
 /*!
  *  \brief layouts the chosen diagram contents into the diagram_bounds area
  *
+ *  If a layout cache is set and contains the layout of the current input data, bounds and fonts,
+ *  the layout is restored from the cache; otherwise the layout is calculated and stored to the cache.
+ *
  *  \param this_ pointer to own object attributes
  *  \param font_layout pango layout object to determine the font metrics in the current cairo drawing context
  */
@@ -143,6 +160,13 @@ static inline layout_visible_set_t *pencil_layouter_get_layout_data_ptr ( pencil
  */
 static inline const layout_visible_set_t *pencil_layouter_get_layout_data_const ( const pencil_layouter_t *this_ );
 
+/*!
+ *  \brief returns the spatial index on the layout_visible_set_t object
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline const layout_spatial_index_t *pencil_layouter_get_spatial_index_const ( const pencil_layouter_t *this_ );
+
 /*!
  *  \brief returns the pencil size object
  *
@@ -211,6 +235,15 @@ pencil_error_t pencil_layouter_get_relationship_order_at_pos ( const pencil_layo
  */
 void pencil_layouter_private_propose_default_classifier_size ( pencil_layouter_t *this_ );
 
+/*!
+ *  \brief measures a probe text in all fonts to detect changes of the font metrics
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param font_layout pango layout object to determine the font metrics in the current cairo drawing context
+ *  \return a value that changes when the font metrics change
+ */
+uint64_t pencil_layouter_private_get_font_signature ( const pencil_layouter_t *this_, PangoLayout *font_layout );
+
 #include "pencil_layouter.inl"
 
 #endif  /* PENCIL_LAYOUTER_H */
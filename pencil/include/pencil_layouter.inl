@@ -4,9 +4,15 @@
 #include "geometry/geometry_non_linear_scale.h"
 #include <assert.h>
 
+static inline void pencil_layouter_set_layout_cache ( pencil_layouter_t *this_, layout_cache_t *layout_cache )
+{
+    (*this_).layout_cache = layout_cache;
+}
+
 static inline void pencil_layouter_prepare ( pencil_layouter_t *this_ )
 {
     layout_visible_set_resync( &((*this_).layout_data) );
+    layout_spatial_index_invalidate( &((*this_).spatial_index) );
     pencil_feature_layouter_reset( &((*this_).feature_layouter) );
 }
 
@@ -25,6 +31,11 @@ static inline const layout_visible_set_t *pencil_layouter_get_layout_data_const
     return &((*this_).layout_data);
 }
 
+static inline const layout_spatial_index_t *pencil_layouter_get_spatial_index_const ( const pencil_layouter_t *this_ )
+{
+    return &((*this_).spatial_index);
+}
+
 static inline const pencil_size_t *pencil_layouter_get_pencil_size_const ( pencil_layouter_t *this_ )
 {
     return &((*this_).pencil_size);
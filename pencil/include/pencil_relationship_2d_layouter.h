@@ -12,6 +12,9 @@
 #include "pencil_size.h"
 #include "layout/layout_visible_set.h"
 #include "layout/layout_relationship_iter.h"
+#include "layout/layout_spatial_index.h"
+#include "layout/layout_connector_index.h"
+#include "layout/layout_box_array.h"
 #include "pencil_relationship_painter.h"
 #include "geometry/geometry_rectangle.h"
 #include "geometry/geometry_non_linear_scale.h"
@@ -37,6 +40,11 @@ struct pencil_relationship_2d_layouter_struct {
     universal_array_index_sorter_t sorted_relationships;  /*!< a sorted list of relationships, ordered by processing order, */
                                                           /*!< empty if layouting algorithm finished */
     layout_relationship_iter_t already_processed;  /*!< already processed relationships of the sorted list of relationships */
+    layout_spatial_index_t *spatial_index;  /*!< pointer to an external index of classifiers and features, */
+                                            /*!< resynced before relationships are shaped */
+    layout_connector_index_t shaped_connectors;  /*!< index of the connectors of the already processed relationships, */
+                                                 /*!< numbered by their position in sorted_relationships */
+    layout_box_array_t feature_symbol_boxes;  /*!< copies of the feature symbol boxes, packed for layout_quality_debts_conn_sym_batch */
 
     const pencil_size_t *pencil_size;  /*!< pointer to an instance of a pencil_size_t object, defining pen sizes, gap sizes, */
                                        /*!< font sizes and colors */
@@ -52,11 +60,13 @@ typedef struct pencil_relationship_2d_layouter_struct pencil_relationship_2d_lay
  *  \param layout_data pointer to the layout information to be used and modified
  *  \param profile pointer to the profile-part that provides the stereotypes of the elements to be layouted
  *  \param pencil_size pointer to the pencil_size_t object
+ *  \param spatial_index pointer to the spatial index of layout_data, used to find obstacles near a connector
  */
 void pencil_relationship_2d_layouter_init( pencil_relationship_2d_layouter_t *this_,
                                            layout_visible_set_t *layout_data,
                                            const data_profile_part_t *profile,
-                                           const pencil_size_t *pencil_size
+                                           const pencil_size_t *pencil_size,
+                                           layout_spatial_index_t *spatial_index
                                          );
 
 /*!
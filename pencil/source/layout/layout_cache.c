@@ -0,0 +1,340 @@
+/* File: layout_cache.c; Copyright and License: see below */
+
+#include "layout/layout_cache.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <string.h>
+#include <assert.h>
+
+/*! \brief offset basis of the 64-bit FNV-1a hash */
+#define LAYOUT_CACHE_FNV_OFFSET_BASIS (0xcbf29ce484222325ull)
+
+void layout_cache_init ( layout_cache_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    U8_TRACE_INFO_INT( "sizeof(layout_cache_t):", sizeof(layout_cache_t) );
+
+    layout_cache_clear( this_ );
+
+    U8_TRACE_END();
+}
+
+void layout_cache_destroy ( layout_cache_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    layout_cache_clear( this_ );
+
+    U8_TRACE_END();
+}
+
+void layout_cache_clear ( layout_cache_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    memset( &((*this_).entry), 0, sizeof((*this_).entry) );
+    (*this_).use_counter = 0;
+    (*this_).write_pos = 0;
+
+    U8_TRACE_END();
+}
+
+uint64_t layout_cache_compute_key ( const layout_visible_set_t *layout_data,
+                                    const data_profile_part_t *profile,
+                                    uint64_t font_signature )
+{
+    U8_TRACE_BEGIN();
+    assert( layout_data != NULL );
+    assert( profile != NULL );
+    uint64_t result = LAYOUT_CACHE_FNV_OFFSET_BASIS;
+
+    result = layout_cache_hash_int( result, font_signature );
+
+    /* diagram */
+    const layout_diagram_t *const diag_layout = layout_visible_set_get_diagram_const( layout_data );
+    result = layout_cache_hash_rect( result, layout_diagram_get_bounds_const( diag_layout ) );
+    result = layout_cache_hash_rect( result, layout_diagram_get_draw_area_const( diag_layout ) );
+    result = layout_cache_hash_rect( result, layout_diagram_get_label_box_const( diag_layout ) );
+    const data_diagram_t *const diag = layout_diagram_get_data_const( diag_layout );
+    result = layout_cache_hash_int( result, data_diagram_get_row( diag ) );
+    result = layout_cache_hash_int( result, data_diagram_get_diagram_type( diag ) );
+    result = layout_cache_hash_str( result, data_diagram_get_stereotype_const( diag ) );
+    result = layout_cache_hash_str( result, data_diagram_get_name_const( diag ) );
+    result = layout_cache_hash_str( result, data_diagram_get_description_const( diag ) );
+    result = layout_cache_hash_int( result, data_diagram_get_list_order( diag ) );
+    result = layout_cache_hash_int( result, data_diagram_get_display_flags( diag ) );
+
+    /* classifiers */
+    const uint32_t classifier_count = layout_visible_set_get_visible_classifier_count( layout_data );
+    result = layout_cache_hash_int( result, classifier_count );
+    for ( uint32_t index = 0; index < classifier_count; index ++ )
+    {
+        const layout_visible_classifier_t *const visible_classifier
+            = layout_visible_set_get_visible_classifier_const( layout_data, index );
+        const data_classifier_t *const classifier = layout_visible_classifier_get_classifier_const( visible_classifier );
+        const data_diagramelement_t *const diagele = layout_visible_classifier_get_diagramelement_const( visible_classifier );
+        result = layout_cache_hash_int( result, data_classifier_get_row( classifier ) );
+        result = layout_cache_hash_int( result, data_classifier_get_main_type( classifier ) );
+        result = layout_cache_hash_str( result, data_classifier_get_stereotype_const( classifier ) );
+        result = layout_cache_hash_str( result, data_classifier_get_name_const( classifier ) );
+        result = layout_cache_hash_str( result, data_classifier_get_description_const( classifier ) );
+        result = layout_cache_hash_int( result, data_classifier_get_x_order( classifier ) );
+        result = layout_cache_hash_int( result, data_classifier_get_y_order( classifier ) );
+        result = layout_cache_hash_int( result, data_classifier_get_list_order( classifier ) );
+        result = layout_cache_hash_int( result, data_diagramelement_get_row( diagele ) );
+        result = layout_cache_hash_int( result, data_diagramelement_get_focused_feature_row( diagele ) );
+        result = layout_cache_hash_int( result, data_diagramelement_get_display_flags( diagele ) );
+    }
+
+    /* features */
+    const uint32_t feature_count = layout_visible_set_get_feature_count( layout_data );
+    result = layout_cache_hash_int( result, feature_count );
+    for ( uint32_t index = 0; index < feature_count; index ++ )
+    {
+        const layout_feature_t *const feature_layout = layout_visible_set_get_feature_const( layout_data, index );
+        const data_feature_t *const feature = layout_feature_get_data_const( feature_layout );
+        const data_diagramelement_t *const diagele
+            = layout_visible_classifier_get_diagramelement_const( layout_feature_get_classifier_const( feature_layout ) );
+        result = layout_cache_hash_int( result, data_feature_get_row( feature ) );
+        result = layout_cache_hash_int( result, data_diagramelement_get_row( diagele ) );
+        result = layout_cache_hash_int( result, data_feature_get_main_type( feature ) );
+        result = layout_cache_hash_str( result, data_feature_get_key_const( feature ) );
+        result = layout_cache_hash_str( result, data_feature_get_value_const( feature ) );
+        result = layout_cache_hash_str( result, data_feature_get_description_const( feature ) );
+        result = layout_cache_hash_int( result, data_feature_get_list_order( feature ) );
+    }
+
+    /* relationships */
+    const uint32_t relationship_count = layout_visible_set_get_relationship_count( layout_data );
+    result = layout_cache_hash_int( result, relationship_count );
+    for ( uint32_t index = 0; index < relationship_count; index ++ )
+    {
+        const layout_relationship_t *const relationship_layout = layout_visible_set_get_relationship_const( layout_data, index );
+        const data_relationship_t *const relationship = layout_relationship_get_data_const( relationship_layout );
+        const data_diagramelement_t *const from_diagele
+            = layout_visible_classifier_get_diagramelement_const( layout_relationship_get_from_classifier_ptr( relationship_layout ) );
+        const data_diagramelement_t *const to_diagele
+            = layout_visible_classifier_get_diagramelement_const( layout_relationship_get_to_classifier_ptr( relationship_layout ) );
+        result = layout_cache_hash_int( result, data_relationship_get_row( relationship ) );
+        result = layout_cache_hash_int( result, data_diagramelement_get_row( from_diagele ) );
+        result = layout_cache_hash_int( result, data_diagramelement_get_row( to_diagele ) );
+        result = layout_cache_hash_int( result, data_relationship_get_from_feature_row( relationship ) );
+        result = layout_cache_hash_int( result, data_relationship_get_to_feature_row( relationship ) );
+        result = layout_cache_hash_int( result, data_relationship_get_main_type( relationship ) );
+        result = layout_cache_hash_str( result, data_relationship_get_stereotype_const( relationship ) );
+        result = layout_cache_hash_str( result, data_relationship_get_name_const( relationship ) );
+        result = layout_cache_hash_str( result, data_relationship_get_description_const( relationship ) );
+        result = layout_cache_hash_int( result, data_relationship_get_list_order( relationship ) );
+    }
+
+    /* stereotypes may define icons which influence the sizes of elements */
+    const uint32_t stereotype_count = data_profile_part_get_stereotype_count( profile );
+    result = layout_cache_hash_int( result, stereotype_count );
+    for ( uint32_t index = 0; index < stereotype_count; index ++ )
+    {
+        const data_classifier_t *const stereotype = data_profile_part_get_stereotype_const( profile, index );
+        result = layout_cache_hash_str( result, data_classifier_get_name_const( stereotype ) );
+        result = layout_cache_hash_str( result, data_classifier_get_description_const( stereotype ) );
+    }
+
+    U8_TRACE_END();
+    return result;
+}
+
+u8_error_t layout_cache_store ( layout_cache_t *this_, uint64_t key, const layout_visible_set_t *layout_data )
+{
+    U8_TRACE_BEGIN();
+    assert( layout_data != NULL );
+    u8_error_t result = U8_ERROR_NONE;
+
+    const uint32_t classifier_count = layout_visible_set_get_visible_classifier_count( layout_data );
+    const uint32_t feature_count = layout_visible_set_get_feature_count( layout_data );
+    const uint32_t relationship_count = layout_visible_set_get_relationship_count( layout_data );
+    const size_t classifier_size = classifier_count * sizeof(layout_visible_classifier_t);
+    const size_t feature_size = feature_count * sizeof(layout_feature_t);
+    const size_t relationship_size = relationship_count * sizeof(layout_relationship_t);
+    /* round up to 8-byte alignment */
+    const size_t size = ( ( classifier_size + feature_size + relationship_size + 7 ) / 8 ) * 8;
+
+    /* an outdated entry of the same key is replaced */
+    const uint32_t old_idx = layout_cache_private_find( this_, key );
+    if ( old_idx < LAYOUT_CACHE_MAX_ENTRIES )
+    {
+        (*this_).entry[old_idx].last_use = 0;
+    }
+
+    if ( size > LAYOUT_CACHE_MEMORY_SIZE )
+    {
+        U8_LOG_WARNING_INT( "layout too big for the layout_cache_t:", size );
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+    else
+    {
+        /* the memory region is reused in ring order */
+        if ( (*this_).write_pos + size > LAYOUT_CACHE_MEMORY_SIZE )
+        {
+            (*this_).write_pos = 0;
+        }
+        const uint32_t start = (*this_).write_pos;
+        layout_cache_private_evict_range( this_, start, size );
+        const uint32_t slot = layout_cache_private_select_slot( this_ );
+
+        char *const records = ((char*)(*this_).private_memory_buffer) + start;
+        if ( classifier_count > 0 )
+        {
+            memcpy( records,
+                    layout_visible_set_get_visible_classifier_const( layout_data, 0 ),
+                    classifier_size
+                  );
+        }
+        if ( feature_count > 0 )
+        {
+            memcpy( records + classifier_size,
+                    layout_visible_set_get_feature_const( layout_data, 0 ),
+                    feature_size
+                  );
+        }
+        if ( relationship_count > 0 )
+        {
+            memcpy( records + classifier_size + feature_size,
+                    layout_visible_set_get_relationship_const( layout_data, 0 ),
+                    relationship_size
+                  );
+        }
+
+        (*this_).use_counter ++;
+        (*this_).entry[slot] = (layout_cache_entry_t) {
+            .key = key,
+            .last_use = (*this_).use_counter,
+            .start = start,
+            .size = size,
+            .classifier_count = classifier_count,
+            .feature_count = feature_count,
+            .relationship_count = relationship_count,
+        };
+        (*this_).write_pos = start + size;
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+u8_error_t layout_cache_restore ( layout_cache_t *this_, uint64_t key, layout_visible_set_t *io_layout_data )
+{
+    U8_TRACE_BEGIN();
+    assert( io_layout_data != NULL );
+    u8_error_t result = U8_ERROR_NONE;
+
+    const uint32_t classifier_count = layout_visible_set_get_visible_classifier_count( io_layout_data );
+    const uint32_t feature_count = layout_visible_set_get_feature_count( io_layout_data );
+    const uint32_t relationship_count = layout_visible_set_get_relationship_count( io_layout_data );
+
+    const uint32_t idx = layout_cache_private_find( this_, key );
+    if ( idx >= LAYOUT_CACHE_MAX_ENTRIES )
+    {
+        result = U8_ERROR_NOT_FOUND;
+    }
+    else if (( (*this_).entry[idx].classifier_count != classifier_count )
+        || ( (*this_).entry[idx].feature_count != feature_count )
+        || ( (*this_).entry[idx].relationship_count != relationship_count ))
+    {
+        /* this is a hash collision */
+        U8_LOG_ANOMALY( "layout_cache_t key matches but element counts differ." );
+        result = U8_ERROR_NOT_FOUND;
+    }
+    else
+    {
+        layout_cache_entry_t *const found = &((*this_).entry[idx]);
+        const char *const records = ((const char*)(*this_).private_memory_buffer) + (*found).start;
+        const layout_visible_classifier_t *const classifier_records = (const layout_visible_classifier_t*) records;
+        const layout_feature_t *const feature_records
+            = (const layout_feature_t*) ( records + classifier_count * sizeof(layout_visible_classifier_t) );
+        const layout_relationship_t *const relationship_records
+            = (const layout_relationship_t*) ( records + classifier_count * sizeof(layout_visible_classifier_t)
+            + feature_count * sizeof(layout_feature_t) );
+
+        /* copy the geometry, keep the pointers to data objects and to other layout objects */
+        for ( uint32_t index = 0; index < classifier_count; index ++ )
+        {
+            layout_visible_classifier_t *const target = layout_visible_set_get_visible_classifier_ptr( io_layout_data, index );
+            const data_visible_classifier_t *const data = (*target).data;
+            (*target) = classifier_records[index];
+            (*target).data = data;
+        }
+        for ( uint32_t index = 0; index < feature_count; index ++ )
+        {
+            layout_feature_t *const target = layout_visible_set_get_feature_ptr( io_layout_data, index );
+            const data_feature_t *const data = (*target).data;
+            layout_visible_classifier_t *const classifier = (*target).classifier;
+            (*target) = feature_records[index];
+            (*target).data = data;
+            (*target).classifier = classifier;
+        }
+        for ( uint32_t index = 0; index < relationship_count; index ++ )
+        {
+            layout_relationship_t *const target = layout_visible_set_get_relationship_ptr( io_layout_data, index );
+            const data_relationship_t *const data = (*target).data;
+            layout_visible_classifier_t *const from_classifier = (*target).from_classifier;
+            layout_visible_classifier_t *const to_classifier = (*target).to_classifier;
+            layout_feature_t *const from_feature = (*target).from_feature;
+            layout_feature_t *const to_feature = (*target).to_feature;
+            (*target) = relationship_records[index];
+            (*target).data = data;
+            (*target).from_classifier = from_classifier;
+            (*target).to_classifier = to_classifier;
+            (*target).from_feature = from_feature;
+            (*target).to_feature = to_feature;
+        }
+
+        (*this_).use_counter ++;
+        (*found).last_use = (*this_).use_counter;
+    }
+
+    U8_TRACE_END_ERR( result );
+    return result;
+}
+
+void layout_cache_private_evict_range ( layout_cache_t *this_, uint32_t start, uint32_t size )
+{
+    const uint32_t end = start + size;
+    for ( uint32_t idx = 0; idx < LAYOUT_CACHE_MAX_ENTRIES; idx ++ )
+    {
+        layout_cache_entry_t *const probe = &((*this_).entry[idx]);
+        const uint32_t probe_end = (*probe).start + (*probe).size;
+        const bool overlaps = ( (*probe).start < end ) && ( start < probe_end );
+        if ( ( (*probe).last_use != 0 ) && overlaps )
+        {
+            (*probe).last_use = 0;
+        }
+    }
+}
+
+uint32_t layout_cache_private_select_slot ( const layout_cache_t *this_ )
+{
+    uint32_t result = 0;
+    for ( uint32_t idx = 1; ( idx < LAYOUT_CACHE_MAX_ENTRIES ) && ( (*this_).entry[result].last_use != 0 ); idx ++ )
+    {
+        if ( (*this_).entry[idx].last_use < (*this_).entry[result].last_use )
+        {
+            result = idx;
+        }
+    }
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
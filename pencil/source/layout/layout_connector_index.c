@@ -0,0 +1,140 @@
+/* File: layout_connector_index.c; Copyright and License: see below */
+
+#include "layout/layout_connector_index.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <string.h>
+#include <assert.h>
+
+void layout_connector_index_init ( layout_connector_index_t *this_, const geometry_rectangle_t *bounds )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != bounds );
+
+    const double width = geometry_rectangle_get_width( bounds );
+    const double height = geometry_rectangle_get_height( bounds );
+    (*this_).left = geometry_rectangle_get_left( bounds );
+    (*this_).top = geometry_rectangle_get_top( bounds );
+    (*this_).column_factor = ( width > 0.0 ) ? ( LAYOUT_CONNECTOR_INDEX_COLUMNS / width ) : 0.0;
+    (*this_).row_factor = ( height > 0.0 ) ? ( LAYOUT_CONNECTOR_INDEX_ROWS / height ) : 0.0;
+    (*this_).item_count = 0;
+    (*this_).entry_count = 0;
+    memset( &((*this_).cell_head), 0xff, sizeof((*this_).cell_head) );
+    layout_spatial_iter_init_empty( &((*this_).large_items), LAYOUT_SPATIAL_ITER_MAX_ITEMS );
+
+    U8_TRACE_END();
+}
+
+void layout_connector_index_destroy ( layout_connector_index_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    layout_spatial_iter_destroy( &((*this_).large_items) );
+    (*this_).item_count = 0;
+    (*this_).entry_count = 0;
+
+    U8_TRACE_END();
+}
+
+uint32_t layout_connector_index_add ( layout_connector_index_t *this_, const geometry_connector_t *shape )
+{
+    assert( NULL != shape );
+    assert( (*this_).item_count < LAYOUT_SPATIAL_ITER_MAX_ITEMS );
+    const uint32_t item = (*this_).item_count;
+    (*this_).item_count ++;
+
+    const geometry_connector_segment_t segments[3]
+        = { GEOMETRY_CONNECTOR_SEGMENT_SOURCE, GEOMETRY_CONNECTOR_SEGMENT_MAIN, GEOMETRY_CONNECTOR_SEGMENT_DESTINATION };
+    uint32_t col_min[3];
+    uint32_t col_max[3];
+    uint32_t row_min[3];
+    uint32_t row_max[3];
+
+    /* determine the cell ranges, count the cells (cells shared by segments are counted twice) */
+    uint32_t cell_count = 0;
+    for ( uint_fast32_t seg_idx = 0; seg_idx < 3; seg_idx ++ )
+    {
+        const geometry_rectangle_t segment_bounds = geometry_connector_get_segment_bounds( shape, segments[seg_idx] );
+        col_min[seg_idx] = layout_connector_index_private_get_column( this_, geometry_rectangle_get_left( &segment_bounds ) );
+        col_max[seg_idx] = layout_connector_index_private_get_column( this_, geometry_rectangle_get_right( &segment_bounds ) );
+        row_min[seg_idx] = layout_connector_index_private_get_row( this_, geometry_rectangle_get_top( &segment_bounds ) );
+        row_max[seg_idx] = layout_connector_index_private_get_row( this_, geometry_rectangle_get_bottom( &segment_bounds ) );
+        cell_count += ( col_max[seg_idx] - col_min[seg_idx] + 1 ) * ( row_max[seg_idx] - row_min[seg_idx] + 1 );
+    }
+
+    if (( cell_count > LAYOUT_CONNECTOR_INDEX_MAX_CELLS_PER_ITEM )
+        || ( (*this_).entry_count + cell_count > LAYOUT_CONNECTOR_INDEX_MAX_ENTRIES ))
+    {
+        layout_spatial_iter_add( &((*this_).large_items), item );
+    }
+    else
+    {
+        for ( uint_fast32_t seg_idx = 0; seg_idx < 3; seg_idx ++ )
+        {
+            for ( uint32_t row = row_min[seg_idx]; row <= row_max[seg_idx]; row ++ )
+            {
+                for ( uint32_t col = col_min[seg_idx]; col <= col_max[seg_idx]; col ++ )
+                {
+                    const uint32_t cell = row * LAYOUT_CONNECTOR_INDEX_COLUMNS + col;
+                    const uint16_t head = (*this_).cell_head[cell];
+                    /* a previous segment of this connector is always at the head of the list */
+                    const bool listed = ( head != LAYOUT_CONNECTOR_INDEX_VOID ) && ( (*this_).entry_item[head] == item );
+                    if ( ! listed )
+                    {
+                        const uint32_t entry = (*this_).entry_count;
+                        (*this_).entry_item[entry] = item;
+                        (*this_).entry_next[entry] = head;
+                        (*this_).cell_head[cell] = entry;
+                        (*this_).entry_count ++;
+                    }
+                }
+            }
+        }
+    }
+
+    return item;
+}
+
+void layout_connector_index_query_area ( const layout_connector_index_t *this_,
+                                         const geometry_rectangle_t *area,
+                                         layout_spatial_iter_t *out_candidates )
+{
+    assert( NULL != area );
+    assert( NULL != out_candidates );
+
+    layout_spatial_iter_init_empty( out_candidates, (*this_).item_count );
+    layout_spatial_iter_add_all( out_candidates, &((*this_).large_items) );
+
+    const uint32_t col_min = layout_connector_index_private_get_column( this_, geometry_rectangle_get_left( area ) );
+    const uint32_t col_max = layout_connector_index_private_get_column( this_, geometry_rectangle_get_right( area ) );
+    const uint32_t row_min = layout_connector_index_private_get_row( this_, geometry_rectangle_get_top( area ) );
+    const uint32_t row_max = layout_connector_index_private_get_row( this_, geometry_rectangle_get_bottom( area ) );
+    for ( uint32_t row = row_min; row <= row_max; row ++ )
+    {
+        for ( uint32_t col = col_min; col <= col_max; col ++ )
+        {
+            const uint32_t cell = row * LAYOUT_CONNECTOR_INDEX_COLUMNS + col;
+            for ( uint16_t entry = (*this_).cell_head[cell]; entry != LAYOUT_CONNECTOR_INDEX_VOID; entry = (*this_).entry_next[entry] )
+            {
+                layout_spatial_iter_add( out_candidates, (*this_).entry_item[entry] );
+            }
+        }
+    }
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
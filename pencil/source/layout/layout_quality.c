@@ -0,0 +1,221 @@
+/* File: layout_quality.c; Copyright and License: see below */
+
+#include "layout/layout_quality.h"
+#include "u8/u8_trace.h"
+#include <assert.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSE2__)
+
+/*!
+ *  \brief a horizontal or vertical section of the probe, prepared for checking two boxes at once
+ */
+struct layout_quality_private_section_struct {
+    __m128d left;  /*!< left of the bounding rectangle of the section, same value in both lanes */
+    __m128d top;  /*!< top of the bounding rectangle of the section, same value in both lanes */
+    __m128d right;  /*!< right of the bounding rectangle of the section, same value in both lanes */
+    __m128d bottom;  /*!< bottom of the bounding rectangle of the section, same value in both lanes */
+};
+
+typedef struct layout_quality_private_section_struct layout_quality_private_section_t;
+
+/*!
+ *  \brief prepares a section between two points like geometry_rectangle_init_by_corners
+ */
+static inline layout_quality_private_section_t layout_quality_private_section_new ( double x1, double y1, double x2, double y2 )
+{
+    geometry_rectangle_t bounds;
+    geometry_rectangle_init_by_corners( &bounds, x1, y1, x2, y2 );
+    const layout_quality_private_section_t result = {
+        .left = _mm_set1_pd( geometry_rectangle_get_left( &bounds ) ),
+        .top = _mm_set1_pd( geometry_rectangle_get_top( &bounds ) ),
+        .right = _mm_set1_pd( geometry_rectangle_get_right( &bounds ) ),
+        .bottom = _mm_set1_pd( geometry_rectangle_get_bottom( &bounds ) ),
+    };
+    geometry_rectangle_destroy( &bounds );
+    return result;
+}
+
+/*!
+ *  \brief determines the length of a section within two boxes like geometry_connector_get_transit_length does per section
+ */
+static inline __m128d layout_quality_private_transit_2 ( const layout_quality_private_section_t *section,
+                                                         __m128d left,
+                                                         __m128d top,
+                                                         __m128d right,
+                                                         __m128d bottom )
+{
+    /* see geometry_rectangle_init_by_intersect */
+    const __m128d i_left = _mm_max_pd( (*section).left, left );
+    const __m128d i_top = _mm_max_pd( (*section).top, top );
+    const __m128d i_width = _mm_sub_pd( _mm_min_pd( (*section).right, right ), i_left );
+    const __m128d i_height = _mm_sub_pd( _mm_min_pd( (*section).bottom, bottom ), i_top );
+    const __m128d zero = _mm_setzero_pd();
+    /* empty intersections and rounding errors count 0.0 */
+    const __m128d negative = _mm_or_pd( _mm_cmplt_pd( i_width, zero ), _mm_cmplt_pd( i_height, zero ) );
+    return _mm_andnot_pd( negative, _mm_add_pd( i_width, i_height ) );
+}
+
+/*!
+ *  \brief determines the size of the intersection of two intervals like u8_interval_new_intersect and u8_interval_get_size
+ *
+ *  \param in_band mask of lanes where the section is near the border of the box, other lanes return 0.0
+ */
+static inline __m128d layout_quality_private_overlap_2 ( __m128d in_band,
+                                                         __m128d border_low,
+                                                         __m128d border_high,
+                                                         double section_a,
+                                                         double section_b )
+{
+    const double low = ( section_a < section_b ) ? section_a : section_b;
+    const double high = ( section_a < section_b ) ? section_b : section_a;
+    const __m128d section_low = _mm_set1_pd( low );
+    const __m128d section_high = _mm_set1_pd( high );
+    const __m128d disjoint = _mm_or_pd( _mm_cmplt_pd( border_high, section_low ), _mm_cmpgt_pd( border_low, section_high ) );
+    const __m128d size = _mm_sub_pd( _mm_min_pd( border_high, section_high ), _mm_max_pd( border_low, section_low ) );
+    return _mm_and_pd( _mm_andnot_pd( disjoint, in_band ), size );
+}
+
+/*!
+ *  \brief determines a mask of lanes where a coordinate is strictly between lo and hi
+ */
+static inline __m128d layout_quality_private_between_2 ( __m128d lo, __m128d hi, double value )
+{
+    const __m128d v = _mm_set1_pd( value );
+    return _mm_and_pd( _mm_cmplt_pd( lo, v ), _mm_cmplt_pd( v, hi ) );
+}
+
+#endif  /* __SSE2__ */
+
+void layout_quality_debts_conn_sym_batch ( const layout_quality_t *this_,
+                                           const geometry_connector_t *probe,
+                                           const layout_box_array_t *others,
+                                           const uint32_t index[],
+                                           uint32_t index_count,
+                                           double out_debts[] )
+{
+    assert( NULL != probe );
+    assert( NULL != others );
+    assert( NULL != index );
+    assert( NULL != out_debts );
+
+    uint32_t done = 0;
+
+#if defined(__SSE2__)
+    const double max_distance = 5.0 * pencil_size_get_standard_line_width( (*this_).pencil_size );
+    const __m128d max_dist = _mm_set1_pd( max_distance );
+
+    /* the four corner points of the probe */
+    const double src_x = geometry_connector_get_source_end_x( probe );
+    const double src_y = geometry_connector_get_source_end_y( probe );
+    const double main_src_x = geometry_connector_get_main_line_source_x( probe );
+    const double main_src_y = geometry_connector_get_main_line_source_y( probe );
+    const double main_dst_x = geometry_connector_get_main_line_destination_x( probe );
+    const double main_dst_y = geometry_connector_get_main_line_destination_y( probe );
+    const double dst_x = geometry_connector_get_destination_end_x( probe );
+    const double dst_y = geometry_connector_get_destination_end_y( probe );
+
+    /* the three sections, see geometry_connector_get_transit_length */
+    const layout_quality_private_section_t source = layout_quality_private_section_new( src_x, src_y, main_src_x, main_src_y );
+    const layout_quality_private_section_t main_line = layout_quality_private_section_new( main_src_x, main_src_y, main_dst_x, main_dst_y );
+    const layout_quality_private_section_t destination = layout_quality_private_section_new( main_dst_x, main_dst_y, dst_x, dst_y );
+
+    for ( ; done + 2 <= index_count; done += 2 )
+    {
+        const uint32_t idx_0 = index[done];
+        const uint32_t idx_1 = index[done+1];
+        assert( idx_0 < layout_box_array_get_count( others ) );
+        assert( idx_1 < layout_box_array_get_count( others ) );
+        const __m128d left = _mm_set_pd( (*others).left[idx_1], (*others).left[idx_0] );
+        const __m128d top = _mm_set_pd( (*others).top[idx_1], (*others).top[idx_0] );
+        const __m128d right = _mm_add_pd( left, _mm_set_pd( (*others).width[idx_1], (*others).width[idx_0] ) );
+        const __m128d bottom = _mm_add_pd( top, _mm_set_pd( (*others).height[idx_1], (*others).height[idx_0] ) );
+
+        /* transit length, summed in the order of geometry_connector_get_transit_length */
+        __m128d transit = _mm_setzero_pd();
+        transit = _mm_add_pd( transit, layout_quality_private_transit_2( &source, left, top, right, bottom ) );
+        transit = _mm_add_pd( transit, layout_quality_private_transit_2( &main_line, left, top, right, bottom ) );
+        transit = _mm_add_pd( transit, layout_quality_private_transit_2( &destination, left, top, right, bottom ) );
+
+        /* same path length, summed in the order of geometry_connector_get_same_path_length_rect: left, top, right, bottom */
+        __m128d same_path = _mm_setzero_pd();
+        {
+            const __m128d lo = _mm_sub_pd( left, max_dist );
+            const __m128d hi = _mm_add_pd( left, max_dist );
+            const __m128d on_src = layout_quality_private_between_2( lo, hi, src_x );
+            const __m128d on_main_src = layout_quality_private_between_2( lo, hi, main_src_x );
+            const __m128d on_main_dst = layout_quality_private_between_2( lo, hi, main_dst_x );
+            const __m128d on_dst = layout_quality_private_between_2( lo, hi, dst_x );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_src, on_main_src ), top, bottom, src_y, main_src_y ) );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_main_src, on_main_dst ), top, bottom, main_src_y, main_dst_y ) );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_main_dst, on_dst ), top, bottom, main_dst_y, dst_y ) );
+        }
+        {
+            const __m128d lo = _mm_sub_pd( top, max_dist );
+            const __m128d hi = _mm_add_pd( top, max_dist );
+            const __m128d on_src = layout_quality_private_between_2( lo, hi, src_y );
+            const __m128d on_main_src = layout_quality_private_between_2( lo, hi, main_src_y );
+            const __m128d on_main_dst = layout_quality_private_between_2( lo, hi, main_dst_y );
+            const __m128d on_dst = layout_quality_private_between_2( lo, hi, dst_y );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_src, on_main_src ), left, right, src_x, main_src_x ) );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_main_src, on_main_dst ), left, right, main_src_x, main_dst_x ) );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_main_dst, on_dst ), left, right, main_dst_x, dst_x ) );
+        }
+        {
+            const __m128d lo = _mm_sub_pd( right, max_dist );
+            const __m128d hi = _mm_add_pd( right, max_dist );
+            const __m128d on_src = layout_quality_private_between_2( lo, hi, src_x );
+            const __m128d on_main_src = layout_quality_private_between_2( lo, hi, main_src_x );
+            const __m128d on_main_dst = layout_quality_private_between_2( lo, hi, main_dst_x );
+            const __m128d on_dst = layout_quality_private_between_2( lo, hi, dst_x );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_src, on_main_src ), top, bottom, src_y, main_src_y ) );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_main_src, on_main_dst ), top, bottom, main_src_y, main_dst_y ) );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_main_dst, on_dst ), top, bottom, main_dst_y, dst_y ) );
+        }
+        {
+            const __m128d lo = _mm_sub_pd( bottom, max_dist );
+            const __m128d hi = _mm_add_pd( bottom, max_dist );
+            const __m128d on_src = layout_quality_private_between_2( lo, hi, src_y );
+            const __m128d on_main_src = layout_quality_private_between_2( lo, hi, main_src_y );
+            const __m128d on_main_dst = layout_quality_private_between_2( lo, hi, main_dst_y );
+            const __m128d on_dst = layout_quality_private_between_2( lo, hi, dst_y );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_src, on_main_src ), left, right, src_x, main_src_x ) );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_main_src, on_main_dst ), left, right, main_src_x, main_dst_x ) );
+            same_path = _mm_add_pd( same_path, layout_quality_private_overlap_2( _mm_and_pd( on_main_dst, on_dst ), left, right, main_dst_x, dst_x ) );
+        }
+
+        double transit_lanes[2];
+        double same_path_lanes[2];
+        _mm_storeu_pd( transit_lanes, transit );
+        _mm_storeu_pd( same_path_lanes, same_path );
+        out_debts[done] = layout_quality_private_debts_conn_sym_lengths( this_, transit_lanes[0], same_path_lanes[0] );
+        out_debts[done+1] = layout_quality_private_debts_conn_sym_lengths( this_, transit_lanes[1], same_path_lanes[1] );
+    }
+#endif  /* __SSE2__ */
+
+    /* scalar path for the remaining boxes */
+    for ( ; done < index_count; done ++ )
+    {
+        const geometry_rectangle_t box = layout_box_array_get_box( others, index[done] );
+        out_debts[done] = layout_quality_debts_conn_sym( this_, probe, &box );
+    }
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -0,0 +1,336 @@
+/* File: layout_spatial_index.c; Copyright and License: see below */
+
+#include "layout/layout_spatial_index.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#include <string.h>
+#include <assert.h>
+
+void layout_spatial_index_init ( layout_spatial_index_t *this_, const layout_visible_set_t *layout_data )
+{
+    U8_TRACE_BEGIN();
+    assert( NULL != layout_data );
+    U8_TRACE_INFO_INT( "sizeof(layout_spatial_index_t):", sizeof(layout_spatial_index_t) );
+
+    (*this_).layout_data = layout_data;
+    (*this_).valid = false;
+    (*this_).left = 0.0;
+    (*this_).top = 0.0;
+    (*this_).column_factor = 0.0;
+    (*this_).row_factor = 0.0;
+
+    U8_TRACE_END();
+}
+
+void layout_spatial_index_destroy ( layout_spatial_index_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    (*this_).layout_data = NULL;
+    (*this_).valid = false;
+
+    U8_TRACE_END();
+}
+
+void layout_spatial_index_resync ( layout_spatial_index_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    /* the grid spans the diagram bounds */
+    const layout_diagram_t *const the_diagram = layout_visible_set_get_diagram_const( (*this_).layout_data );
+    const geometry_rectangle_t *const diagram_bounds = layout_diagram_get_bounds_const( the_diagram );
+    const double width = geometry_rectangle_get_width( diagram_bounds );
+    const double height = geometry_rectangle_get_height( diagram_bounds );
+    (*this_).left = geometry_rectangle_get_left( diagram_bounds );
+    (*this_).top = geometry_rectangle_get_top( diagram_bounds );
+    (*this_).column_factor = ( width > 0.0 ) ? ( LAYOUT_SPATIAL_INDEX_COLUMNS / width ) : 0.0;
+    (*this_).row_factor = ( height > 0.0 ) ? ( LAYOUT_SPATIAL_INDEX_ROWS / height ) : 0.0;
+
+    bool success = true;
+    success &= layout_spatial_index_private_build_cells( this_, LAYOUT_SPATIAL_INDEX_KIND_CLASSIFIER );
+    success &= layout_spatial_index_private_build_cells( this_, LAYOUT_SPATIAL_INDEX_KIND_FEATURE );
+    success &= layout_spatial_index_private_build_cells( this_, LAYOUT_SPATIAL_INDEX_KIND_RELATIONSHIP );
+    (*this_).valid = success;
+    if ( ! success )
+    {
+        U8_LOG_WARNING( "layout_spatial_index_t could not index all elements, queries return all elements." );
+    }
+
+    U8_TRACE_END();
+}
+
+void layout_spatial_index_query_pos ( const layout_spatial_index_t *this_,
+                                      layout_spatial_index_kind_t kind,
+                                      double x,
+                                      double y,
+                                      double distance,
+                                      layout_spatial_iter_t *out_candidates )
+{
+    assert( NULL != out_candidates );
+    geometry_rectangle_t area;
+    geometry_rectangle_init( &area, x - distance, y - distance, 2.0 * distance, 2.0 * distance );
+    layout_spatial_index_query_area( this_, kind, &area, out_candidates );
+    geometry_rectangle_destroy( &area );
+}
+
+void layout_spatial_index_query_area ( const layout_spatial_index_t *this_,
+                                       layout_spatial_index_kind_t kind,
+                                       const geometry_rectangle_t *area,
+                                       layout_spatial_iter_t *out_candidates )
+{
+    assert( kind < LAYOUT_SPATIAL_INDEX_KIND_MAX );
+    assert( NULL != area );
+    assert( NULL != out_candidates );
+    const uint32_t item_count = layout_spatial_index_private_get_item_count( this_, kind );
+
+    if ( (*this_).valid )
+    {
+        const layout_spatial_index_cells_t *const cells = &((*this_).cells[kind]);
+        layout_spatial_iter_init_empty( out_candidates, item_count );
+
+        const uint32_t first_column = layout_spatial_index_private_get_column( this_, geometry_rectangle_get_left( area ) );
+        const uint32_t last_column = layout_spatial_index_private_get_column( this_, geometry_rectangle_get_right( area ) );
+        const uint32_t first_row = layout_spatial_index_private_get_row( this_, geometry_rectangle_get_top( area ) );
+        const uint32_t last_row = layout_spatial_index_private_get_row( this_, geometry_rectangle_get_bottom( area ) );
+        for ( uint32_t row = first_row; row <= last_row; row ++ )
+        {
+            for ( uint32_t column = first_column; column <= last_column; column ++ )
+            {
+                const uint32_t cell = row * LAYOUT_SPATIAL_INDEX_COLUMNS + column;
+                for ( uint32_t pos = (*cells).cell_start[cell]; pos < (*cells).cell_start[cell+1]; pos ++ )
+                {
+                    layout_spatial_iter_add( out_candidates, (*cells).entry[pos] );
+                }
+            }
+        }
+
+        for ( uint32_t pos = 0; pos < (*cells).large_count; pos ++ )
+        {
+            layout_spatial_iter_add( out_candidates, (*cells).large_item[pos] );
+        }
+    }
+    else
+    {
+        layout_spatial_iter_init_all( out_candidates, item_count );
+    }
+}
+
+bool layout_spatial_index_private_get_cells ( const layout_spatial_index_t *this_,
+                                              layout_spatial_index_kind_t kind,
+                                              uint32_t index,
+                                              uint32_t out_cells[],
+                                              uint32_t *out_cell_count )
+{
+    assert( NULL != out_cells );
+    assert( NULL != out_cell_count );
+    bool result = true;
+    *out_cell_count = 0;
+
+    switch ( kind )
+    {
+        case LAYOUT_SPATIAL_INDEX_KIND_CLASSIFIER:
+        {
+            const layout_visible_classifier_t *const visible_classifier
+                = layout_visible_set_get_visible_classifier_const( (*this_).layout_data, index );
+            result = result && layout_spatial_index_private_add_rect_cells( this_,
+                                                                            layout_visible_classifier_get_symbol_box_const( visible_classifier ),
+                                                                            out_cells,
+                                                                            out_cell_count
+                                                                          );
+            result = result && layout_spatial_index_private_add_rect_cells( this_,
+                                                                            layout_visible_classifier_get_label_box_const( visible_classifier ),
+                                                                            out_cells,
+                                                                            out_cell_count
+                                                                          );
+            result = result && layout_spatial_index_private_add_rect_cells( this_,
+                                                                            layout_visible_classifier_get_icon_box_const( visible_classifier ),
+                                                                            out_cells,
+                                                                            out_cell_count
+                                                                          );
+        }
+        break;
+
+        case LAYOUT_SPATIAL_INDEX_KIND_FEATURE:
+        {
+            const layout_feature_t *const the_feature
+                = layout_visible_set_get_feature_const( (*this_).layout_data, index );
+            result = result && layout_spatial_index_private_add_rect_cells( this_,
+                                                                            layout_feature_get_symbol_box_const( the_feature ),
+                                                                            out_cells,
+                                                                            out_cell_count
+                                                                          );
+            result = result && layout_spatial_index_private_add_rect_cells( this_,
+                                                                            layout_feature_get_label_box_const( the_feature ),
+                                                                            out_cells,
+                                                                            out_cell_count
+                                                                          );
+        }
+        break;
+
+        case LAYOUT_SPATIAL_INDEX_KIND_RELATIONSHIP:
+        default:
+        {
+            const layout_relationship_t *const the_relationship
+                = layout_visible_set_get_relationship_const( (*this_).layout_data, index );
+            const geometry_connector_t *const shape = layout_relationship_get_shape_const( the_relationship );
+            const geometry_connector_segment_t segments[3]
+                = { GEOMETRY_CONNECTOR_SEGMENT_SOURCE, GEOMETRY_CONNECTOR_SEGMENT_MAIN, GEOMETRY_CONNECTOR_SEGMENT_DESTINATION };
+            for ( uint_fast32_t seg_idx = 0; ( seg_idx < 3 ) && result; seg_idx ++ )
+            {
+                const geometry_rectangle_t segment_bounds = geometry_connector_get_segment_bounds( shape, segments[seg_idx] );
+                result = layout_spatial_index_private_add_rect_cells( this_, &segment_bounds, out_cells, out_cell_count );
+            }
+            result = result && layout_spatial_index_private_add_rect_cells( this_,
+                                                                            layout_relationship_get_label_box_const( the_relationship ),
+                                                                            out_cells,
+                                                                            out_cell_count
+                                                                          );
+        }
+        break;
+    }
+
+    return result;
+}
+
+bool layout_spatial_index_private_add_rect_cells ( const layout_spatial_index_t *this_,
+                                                   const geometry_rectangle_t *rect,
+                                                   uint32_t io_cells[],
+                                                   uint32_t *io_cell_count )
+{
+    assert( NULL != rect );
+    assert( NULL != io_cells );
+    assert( NULL != io_cell_count );
+    bool result = true;
+
+    const uint32_t first_column = layout_spatial_index_private_get_column( this_, geometry_rectangle_get_left( rect ) );
+    const uint32_t last_column = layout_spatial_index_private_get_column( this_, geometry_rectangle_get_right( rect ) );
+    const uint32_t first_row = layout_spatial_index_private_get_row( this_, geometry_rectangle_get_top( rect ) );
+    const uint32_t last_row = layout_spatial_index_private_get_row( this_, geometry_rectangle_get_bottom( rect ) );
+    if ( ( last_column - first_column + 1 ) * ( last_row - first_row + 1 ) > LAYOUT_SPATIAL_INDEX_MAX_CELLS_PER_ITEM )
+    {
+        result = false;
+    }
+
+    for ( uint32_t row = first_row; ( row <= last_row ) && result; row ++ )
+    {
+        for ( uint32_t column = first_column; ( column <= last_column ) && result; column ++ )
+        {
+            const uint32_t cell = row * LAYOUT_SPATIAL_INDEX_COLUMNS + column;
+            bool known = false;
+            for ( uint32_t known_idx = 0; ( known_idx < *io_cell_count ) && ( ! known ); known_idx ++ )
+            {
+                known = ( io_cells[known_idx] == cell );
+            }
+            if ( ! known )
+            {
+                if ( *io_cell_count < LAYOUT_SPATIAL_INDEX_MAX_CELLS_PER_ITEM )
+                {
+                    io_cells[*io_cell_count] = cell;
+                    (*io_cell_count) ++;
+                }
+                else
+                {
+                    result = false;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+bool layout_spatial_index_private_build_cells ( layout_spatial_index_t *this_, layout_spatial_index_kind_t kind )
+{
+    U8_TRACE_BEGIN();
+    assert( kind < LAYOUT_SPATIAL_INDEX_KIND_MAX );
+    layout_spatial_index_cells_t *const cells = &((*this_).cells[kind]);
+    const uint32_t item_count = layout_spatial_index_private_get_item_count( this_, kind );
+    const bool result = ( item_count <= LAYOUT_SPATIAL_ITER_MAX_ITEMS );
+
+    memset( &((*cells).cell_start), 0, sizeof((*cells).cell_start) );
+    (*cells).large_count = 0;
+
+    if ( result )
+    {
+        uint32_t item_cells[LAYOUT_SPATIAL_INDEX_MAX_CELLS_PER_ITEM];
+        uint32_t item_cell_count;
+
+        /* count the entries per cell in cell_start[cell+1], collect the large items */
+        uint32_t entry_count = 0;
+        for ( uint32_t index = 0; index < item_count; index ++ )
+        {
+            const bool fits = layout_spatial_index_private_get_cells( this_, kind, index, item_cells, &item_cell_count );
+            if ( fits && ( entry_count + item_cell_count <= LAYOUT_SPATIAL_INDEX_MAX_ENTRIES ) )
+            {
+                for ( uint32_t c_idx = 0; c_idx < item_cell_count; c_idx ++ )
+                {
+                    (*cells).cell_start[item_cells[c_idx]+1] ++;
+                }
+                entry_count += item_cell_count;
+            }
+            else
+            {
+                (*cells).large_item[(*cells).large_count] = index;
+                (*cells).large_count ++;
+            }
+        }
+
+        /* accumulate: cell_start[cell] is the position of the first entry of cell */
+        for ( uint32_t cell = 0; cell < LAYOUT_SPATIAL_INDEX_CELLS; cell ++ )
+        {
+            (*cells).cell_start[cell+1] += (*cells).cell_start[cell];
+        }
+
+        /* fill the entries; cell_start[cell] serves as write position and ends at the start of the next cell */
+        uint32_t large_idx = 0;
+        for ( uint32_t index = 0; index < item_count; index ++ )
+        {
+            if ( ( large_idx < (*cells).large_count ) && ( (*cells).large_item[large_idx] == index ) )
+            {
+                large_idx ++;
+            }
+            else
+            {
+                layout_spatial_index_private_get_cells( this_, kind, index, item_cells, &item_cell_count );
+                for ( uint32_t c_idx = 0; c_idx < item_cell_count; c_idx ++ )
+                {
+                    const uint32_t cell = item_cells[c_idx];
+                    (*cells).entry[(*cells).cell_start[cell]] = index;
+                    (*cells).cell_start[cell] ++;
+                }
+            }
+        }
+
+        /* shift back: cell_start[cell] is the position of the first entry of cell */
+        for ( uint32_t cell = LAYOUT_SPATIAL_INDEX_CELLS; cell > 0; cell -- )
+        {
+            (*cells).cell_start[cell] = (*cells).cell_start[cell-1];
+        }
+        (*cells).cell_start[0] = 0;
+        assert( (*cells).cell_start[LAYOUT_SPATIAL_INDEX_CELLS] == entry_count );
+
+        U8_TRACE_INFO_INT( "indexed items:", item_count );
+        U8_TRACE_INFO_INT( "cell entries:", entry_count );
+        U8_TRACE_INFO_INT( "large items:", (*cells).large_count );
+    }
+
+    U8_TRACE_END();
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -4,6 +4,7 @@
 #include "filter/pencil_rules.h"
 #include "u8/u8_trace.h"
 #include "u8/u8_log.h"
+#include <stdlib.h>
 #include <assert.h>
 
 void layout_visible_set_init( layout_visible_set_t *this_, const data_visible_set_t *input_data )
@@ -56,7 +57,17 @@ void layout_visible_set_private_init_classifiers( layout_visible_set_t *this_ )
     (*this_).visible_classifier_count = 0;
     assert ( data_classifier_count <= LAYOUT_VISIBLE_SET_MAX_CLASSIFIERS );
 
-    for ( uint_fast32_t c_idx = 0; c_idx < data_classifier_count; c_idx ++ )
+    /* the classifier array is allocated once, it must not move because features and relationships refer to it */
+    (*this_).visible_classifier_layout = ( data_classifier_count == 0 )
+        ? NULL
+        : malloc( data_classifier_count * sizeof(layout_visible_classifier_t) );
+    const bool mem_ok = ( data_classifier_count == 0 ) || ( NULL != (*this_).visible_classifier_layout );
+    if ( ! mem_ok )
+    {
+        U8_LOG_ERROR( "out of memory, no layout_visible_classifiers available." );
+    }
+
+    for ( uint_fast32_t c_idx = 0; ( c_idx < data_classifier_count ) && mem_ok; c_idx ++ )
     {
         const data_visible_classifier_t *const classifier_data
             = data_visible_set_get_visible_classifier_const( (*this_).input_data, c_idx );
@@ -93,6 +104,8 @@ void layout_visible_set_private_init_features( layout_visible_set_t *this_ )
     uint_fast32_t warn_dropped_features;
     warn_dropped_features = 0;
     (*this_).feature_count = 0;
+    (*this_).feature_capacity = 0;
+    (*this_).feature_layout = NULL;
 
     for ( uint_fast32_t f_idx = 0; f_idx < data_feature_count; f_idx ++ )
     {
@@ -120,7 +133,7 @@ void layout_visible_set_private_init_features( layout_visible_set_t *this_ )
                                                                                           feature_data );
                     if ( one_parent_found )
                     {
-                        if ( (*this_).feature_count < LAYOUT_VISIBLE_SET_MAX_FEATURES )
+                        if ( U8_ERROR_NONE == layout_visible_set_private_reserve_feature( this_ ) )
                         {
                             layout_feature_init( &((*this_).feature_layout[(*this_).feature_count]),
                                                  feature_data,
@@ -155,7 +168,7 @@ void layout_visible_set_private_init_features( layout_visible_set_t *this_ )
     U8_TRACE_INFO_INT ( "layout_feature       objects:", (*this_).feature_count );
     if ( 0 != warn_dropped_features )
     {
-        U8_LOG_WARNING_INT( "LAYOUT_VISIBLE_SET_MAX_FEATURES exceeded, layout_features not visible:", warn_dropped_features );
+        U8_LOG_WARNING_INT( "LAYOUT_VISIBLE_SET_MAX_FEATURES or memory exceeded, layout_features not visible:", warn_dropped_features );
     }
 
     U8_TRACE_END();
@@ -172,6 +185,8 @@ void layout_visible_set_private_init_relationships( layout_visible_set_t *this_
     uint32_t warn_dropped_relationships;
     warn_dropped_relationships = 0;
     (*this_).relationship_count = 0;
+    (*this_).relationship_capacity = 0;
+    (*this_).relationship_layout = NULL;
 
     for ( uint32_t r_idx = 0; r_idx < data_relationship_count; r_idx ++ )
     {
@@ -212,7 +227,7 @@ void layout_visible_set_private_init_relationships( layout_visible_set_t *this_
     U8_TRACE_INFO_INT ( "layout_relationship  objects:", (*this_).relationship_count );
     if ( 0 != warn_dropped_relationships )
     {
-        U8_LOG_WARNING_INT( "LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS exceeded, layout_relationships not visible:", warn_dropped_relationships );
+        U8_LOG_WARNING_INT( "LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS or memory exceeded, layout_relationships not visible:", warn_dropped_relationships );
     }
 
     U8_TRACE_END();
@@ -253,7 +268,7 @@ uint32_t layout_visible_set_private_init_relationship( layout_visible_set_t *thi
                         const bool one_to_classifier_found = ( to_classifier_id == layout_visible_classifier_get_classifier_id( probe4_classifier ) );
                         if ( one_to_classifier_found )
                         {
-                            if ( (*this_).relationship_count < LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS )
+                            if ( U8_ERROR_NONE == layout_visible_set_private_reserve_relationship( this_ ) )
                             {
                                 layout_relationship_init( &((*this_).relationship_layout[(*this_).relationship_count]),
                                                           relationship_data,
@@ -285,7 +300,7 @@ uint32_t layout_visible_set_private_init_relationship( layout_visible_set_t *thi
                                 = ( to_classifier_id == data_feature_get_classifier_row(layout_feature_get_data_const( probe4_feature )) );
                             if ( to_feature_ok )
                             {
-                                if ( (*this_).relationship_count < LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS )
+                                if ( U8_ERROR_NONE == layout_visible_set_private_reserve_relationship( this_ ) )
                                 {
                                     layout_relationship_init( &((*this_).relationship_layout[(*this_).relationship_count]),
                                                               relationship_data,
@@ -336,7 +351,7 @@ uint32_t layout_visible_set_private_init_relationship( layout_visible_set_t *thi
                                 = ( to_classifier_id == layout_visible_classifier_get_classifier_id( probe5_classifier ) );
                             if ( one_to_classifier_found )
                             {
-                                if ( (*this_).relationship_count < LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS )
+                                if ( U8_ERROR_NONE == layout_visible_set_private_reserve_relationship( this_ ) )
                                 {
                                     layout_relationship_init( &((*this_).relationship_layout[(*this_).relationship_count]),
                                                               relationship_data,
@@ -368,7 +383,7 @@ uint32_t layout_visible_set_private_init_relationship( layout_visible_set_t *thi
                                 const bool to_feature_ok = ( to_classifier_id == data_feature_get_classifier_row(layout_feature_get_data_const( probe5_feature )) );
                                 if ( to_feature_ok )
                                 {
-                                    if ( (*this_).relationship_count < LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS )
+                                    if ( U8_ERROR_NONE == layout_visible_set_private_reserve_relationship( this_ ) )
                                     {
                                         layout_relationship_init( &((*this_).relationship_layout[(*this_).relationship_count]),
                                                                   relationship_data,
@@ -434,6 +449,13 @@ void layout_visible_set_destroy( layout_visible_set_t *this_ )
         layout_relationship_destroy( &((*this_).relationship_layout[r_idx]) );
     }
 
+    free( (*this_).visible_classifier_layout );
+    (*this_).visible_classifier_layout = NULL;
+    free( (*this_).feature_layout );
+    (*this_).feature_layout = NULL;
+    free( (*this_).relationship_layout );
+    (*this_).relationship_layout = NULL;
+
     U8_TRACE_END();
 }
 
@@ -656,6 +678,65 @@ void layout_visible_set_get_statistics ( const layout_visible_set_t *this_, data
     U8_TRACE_END();
 }
 
+u8_error_t layout_visible_set_private_reserve_feature ( layout_visible_set_t *this_ )
+{
+    return layout_visible_set_private_reserve( this_,
+                                               (void**) &((*this_).feature_layout),
+                                               &((*this_).feature_capacity),
+                                               sizeof(layout_feature_t),
+                                               (*this_).feature_count,
+                                               LAYOUT_VISIBLE_SET_MAX_FEATURES
+                                             );
+}
+
+u8_error_t layout_visible_set_private_reserve_relationship ( layout_visible_set_t *this_ )
+{
+    return layout_visible_set_private_reserve( this_,
+                                               (void**) &((*this_).relationship_layout),
+                                               &((*this_).relationship_capacity),
+                                               sizeof(layout_relationship_t),
+                                               (*this_).relationship_count,
+                                               LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS
+                                             );
+}
+
+u8_error_t layout_visible_set_private_reserve ( layout_visible_set_t *this_,
+                                                void **io_array,
+                                                uint32_t *io_capacity,
+                                                size_t element_size,
+                                                uint32_t count,
+                                                uint32_t max_count )
+{
+    assert( NULL != io_array );
+    assert( NULL != io_capacity );
+    assert( count <= *io_capacity );
+    u8_error_t result = U8_ERROR_NONE;
+
+    if ( count >= max_count )
+    {
+        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+    }
+    else if ( count == *io_capacity )
+    {
+        /* double the capacity, realloc keeps the contained elements */
+        const uint32_t old_capacity = *io_capacity;
+        uint32_t new_capacity = ( old_capacity == 0 ) ? 8 : ( 2 * old_capacity );
+        new_capacity = ( new_capacity > max_count ) ? max_count : new_capacity;
+        void *const new_array = realloc( *io_array, new_capacity * element_size );
+        if ( NULL == new_array )
+        {
+            result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+        }
+        else
+        {
+            *io_array = new_array;
+            *io_capacity = new_capacity;
+        }
+    }
+
+    return result;
+}
+
 
 /*
 Copyright 2017-2026 Andreas Warnke
@@ -175,7 +175,6 @@ void pencil_classifier_2d_layouter_estimate_bounds( pencil_classifier_2d_layoute
 void pencil_classifier_2d_layouter_move_to_avoid_overlaps ( pencil_classifier_2d_layouter_t *this_ )
 {
     U8_TRACE_BEGIN();
-    assert ( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) LAYOUT_VISIBLE_SET_MAX_CLASSIFIERS );
 
     universal_array_index_sorter_t sorted_classifiers;
     universal_array_index_sorter_init( &sorted_classifiers );
@@ -263,7 +262,6 @@ void pencil_classifier_2d_layouter_private_propose_move_processing_order ( penci
 {
     U8_TRACE_BEGIN();
     assert ( NULL != out_sorted );
-    assert ( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) DATA_VISIBLE_SET_MAX_CLASSIFIERS );
 
     /* sort the classifiers by their movement-needs */
     uint32_t count_clasfy;
@@ -334,13 +332,15 @@ void pencil_classifier_2d_layouter_private_propose_move_processing_order ( penci
             }
         }
 
-        const u8_error_t insert_error = universal_array_index_sorter_insert( out_sorted, index, simpleness );
+        const u8_error_t insert_error = universal_array_index_sorter_append( out_sorted, index, simpleness );
         if ( U8_ERROR_NONE != insert_error )
         {
             U8_LOG_WARNING( "not all rectangles are moved" );
         }
     }
 
+    universal_array_index_sorter_sort( out_sorted );
+
     U8_TRACE_END();
 }
 
@@ -689,7 +689,6 @@ void pencil_classifier_2d_layouter_private_select_move_solution( pencil_classifi
 void pencil_classifier_2d_layouter_embrace_children( pencil_classifier_2d_layouter_t *this_, PangoLayout *font_layout )
 {
     U8_TRACE_BEGIN();
-    assert( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS );
 
     universal_array_index_sorter_t sorted_relationships;
     universal_array_index_sorter_init( &sorted_relationships );
@@ -753,13 +752,15 @@ void pencil_classifier_2d_layouter_private_propose_embracing_order ( pencil_clas
 
         /* sort it into the array by the number of decendants: */
         /* the less descendants the earlier it shall be processed. */
-        const u8_error_t err = universal_array_index_sorter_insert( out_sorted, rel_idx, (double)from_descendant_count );
+        const u8_error_t err = universal_array_index_sorter_append( out_sorted, rel_idx, (double)from_descendant_count );
         if ( U8_ERROR_NONE != err )
         {
             U8_LOG_ERROR ( "universal_array_index_sorter_t list is full." );
         }
     }
 
+    universal_array_index_sorter_sort( out_sorted );
+
     U8_TRACE_END();
 }
 
@@ -927,7 +928,6 @@ void pencil_classifier_2d_layouter_hide_relations_of_embraced_children( pencil_c
 void pencil_classifier_2d_layouter_move_and_embrace_children( pencil_classifier_2d_layouter_t *this_, PangoLayout *font_layout )
 {
     U8_TRACE_BEGIN();
-    assert( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) LAYOUT_VISIBLE_SET_MAX_CLASSIFIERS );
 
     const double TAKE_RATIO = (1.0/3.0);
     const double LEAVE_RATIO = (1.0-TAKE_RATIO);
@@ -1033,7 +1033,6 @@ void pencil_classifier_2d_layouter_private_propose_move_embrace_order ( pencil_c
 {
     U8_TRACE_BEGIN();
     assert ( NULL != out_sorted );
-    assert ( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) DATA_VISIBLE_SET_MAX_CLASSIFIERS );
 
     /* sort the classifiers by their movement-needs */
     const uint32_t count_classifiers = layout_visible_set_get_visible_classifier_count ( (*this_).layout_data );
@@ -1047,13 +1046,15 @@ void pencil_classifier_2d_layouter_private_propose_move_embrace_order ( pencil_c
         const uint32_t child_count = layout_visible_set_count_descendants ( (*this_).layout_data, the_classifier );
         lazy_move = child_count;
 
-        const u8_error_t insert_error = universal_array_index_sorter_insert( out_sorted, index, lazy_move );
+        const u8_error_t insert_error = universal_array_index_sorter_append( out_sorted, index, lazy_move );
         if ( U8_ERROR_NONE != insert_error )
         {
             U8_LOG_WARNING( "not all rectangles are grown" );
         }
     }
 
+    universal_array_index_sorter_sort( out_sorted );
+
     U8_TRACE_END();
 }
 
@@ -131,7 +131,7 @@ void pencil_diagram_maker_private_draw_features ( pencil_diagram_maker_t *this_,
     layout_visible_set_t *const layout_data_mod = pencil_layouter_get_layout_data_ptr( &((*this_).layouter) );
 
     /* create an iterator over a backwards-sorted list of layout_relationship_t */
-    /* Assuming that there is a chance that layout_data is already ordered, traverse it reverse to speed up sorting */
+    /* traverse layout_data reverse so that relationships of equal list_order are drawn in reverse order */
     universal_array_index_sorter_init( &((*this_).temp_order) );
     const uint32_t rel_count = layout_visible_set_get_relationship_count ( layout_data );
     for ( uint32_t rel_index_top = rel_count; rel_index_top > 0; rel_index_top -- )
@@ -141,12 +141,13 @@ void pencil_diagram_maker_private_draw_features ( pencil_diagram_maker_t *this_,
         const data_relationship_t *const the_relationship = layout_relationship_get_data_const( relationship_layout );
         const int32_t order = data_relationship_get_list_order( the_relationship );
         const int64_t backwards = ( -order );
-        const u8_error_t full = universal_array_index_sorter_insert( &((*this_).temp_order), rel_index, backwards );
+        const u8_error_t full = universal_array_index_sorter_append( &((*this_).temp_order), rel_index, backwards );
         if ( full != U8_ERROR_NONE )
         {
             U8_LOG_ERROR("There are more relationships than can be sorted");
         }
     }
+    universal_array_index_sorter_sort( &((*this_).temp_order) );
     layout_relationship_iter_t relationships;
     layout_relationship_iter_init( &relationships, layout_data_mod, &((*this_).temp_order) );
 
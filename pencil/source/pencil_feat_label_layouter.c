@@ -55,7 +55,6 @@ void pencil_feat_label_layouter_destroy( pencil_feat_label_layouter_t *this_ )
 void pencil_feat_label_layouter_do_layout ( pencil_feat_label_layouter_t *this_, PangoLayout *font_layout )
 {
     U8_TRACE_BEGIN();
-    assert ( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) LAYOUT_VISIBLE_SET_MAX_FEATURES );
     assert( NULL != font_layout );
 
     pencil_floating_label_layouter_reinit( &((*this_).label_floater),
@@ -154,7 +153,7 @@ void pencil_feat_label_layouter_private_propose_processing_order ( pencil_feat_l
         if ( DATA_FEATURE_TYPE_LIFELINE != current_type )
         {
             const int insert_error
-                = universal_array_index_sorter_insert( out_sorted, index, simpleness );
+                = universal_array_index_sorter_append( out_sorted, index, simpleness );
             if ( 0 != insert_error )
             {
                 U8_LOG_WARNING( "not all relationship label-boxes are layouted" );
@@ -162,6 +161,8 @@ void pencil_feat_label_layouter_private_propose_processing_order ( pencil_feat_l
         }
     }
 
+    universal_array_index_sorter_sort( out_sorted );
+
     U8_TRACE_END();
 }
 
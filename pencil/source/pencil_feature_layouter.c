@@ -51,7 +51,6 @@ void pencil_feature_layouter_destroy( pencil_feature_layouter_t *this_ )
 void pencil_feature_layouter_do_layout ( pencil_feature_layouter_t *this_, PangoLayout *font_layout )
 {
     U8_TRACE_BEGIN();
-    assert( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) LAYOUT_VISIBLE_SET_MAX_FEATURES );
 
     /* establish precondition: precalculate the dimensions of labels */
     if ( ! (*this_).label_dimensions_initialized )
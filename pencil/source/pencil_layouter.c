@@ -23,7 +23,9 @@ void pencil_layouter_init( pencil_layouter_t *this_,
 
     /* initialize the layout data objects */
     layout_visible_set_init( &((*this_).layout_data), input_data );
+    layout_spatial_index_init( &((*this_).spatial_index), &((*this_).layout_data) );
     (*this_).profile = profile;
+    (*this_).layout_cache = NULL;
 
     pencil_diagram_painter_init( &((*this_).diagram_painter) );
 
@@ -53,7 +55,8 @@ void pencil_layouter_init( pencil_layouter_t *this_,
     pencil_relationship_2d_layouter_init( &((*this_).pencil_relationship_2d_layouter),
                                           &((*this_).layout_data),
                                           profile,
-                                          &((*this_).pencil_size)
+                                          &((*this_).pencil_size),
+                                          &((*this_).spatial_index)
                                         );
     pencil_relationship_1d_layouter_init( &((*this_).pencil_relationship_1d_layouter),
                                           &((*this_).layout_data),
@@ -75,8 +78,10 @@ void pencil_layouter_reinit( pencil_layouter_t *this_,
     U8_TRACE_BEGIN();
     assert( NULL != input_data );
     assert( NULL != profile );
+    layout_cache_t *const layout_cache = (*this_).layout_cache;
     pencil_layouter_destroy( this_ );
     pencil_layouter_init( this_, input_data, profile );
+    (*this_).layout_cache = layout_cache;
     U8_TRACE_END();
 }
 
@@ -99,6 +104,7 @@ void pencil_layouter_destroy( pencil_layouter_t *this_ )
     geometry_dimensions_destroy( &((*this_).default_classifier_size) );
     data_guidelines_destroy( &((*this_).guidelines) );
 
+    layout_spatial_index_destroy( &((*this_).spatial_index) );
     layout_visible_set_destroy( &((*this_).layout_data) );
 
     U8_TRACE_END();
@@ -181,8 +187,23 @@ void pencil_layouter_layout_elements ( pencil_layouter_t *this_, PangoLayout *fo
     /* adjust the default classifier rectangle */
     pencil_layouter_private_propose_default_classifier_size( this_ );
 
+    /* restore the layout from the cache if input data, bounds and fonts are unchanged */
+    uint64_t cache_key = 0;
+    bool cache_hit = false;
+    if ( (*this_).layout_cache != NULL )
+    {
+        const uint64_t font_signature = pencil_layouter_private_get_font_signature( this_, font_layout );
+        cache_key = layout_cache_compute_key( &((*this_).layout_data), (*this_).profile, font_signature );
+        cache_hit = ( U8_ERROR_NONE == layout_cache_restore( (*this_).layout_cache, cache_key, &((*this_).layout_data) ) );
+        U8_TRACE_INFO_STR( "layout_cache:", cache_hit ? "hit" : "miss" );
+    }
+
     /* store the classifier bounds into input_data_layouter_t */
-    if ( DATA_DIAGRAM_TYPE_LIST == diag_type )
+    if ( cache_hit )
+    {
+        /* the layout is already restored */
+    }
+    else if ( DATA_DIAGRAM_TYPE_LIST == diag_type )
     {
         /* calculate the classifier shapes */
         pencil_classifier_1d_layouter_layout_for_list( &((*this_).pencil_classifier_1d_layouter), font_layout );
@@ -265,6 +286,14 @@ void pencil_layouter_layout_elements ( pencil_layouter_t *this_, PangoLayout *fo
         pencil_rel_label_layouter_do_layout( &((*this_).relationship_label_layouter), font_layout );
     }
 
+    if (( (*this_).layout_cache != NULL )&&( ! cache_hit ))
+    {
+        layout_cache_store( (*this_).layout_cache, cache_key, &((*this_).layout_data) );
+    }
+
+    /* index the layouted elements for position queries */
+    layout_spatial_index_resync( &((*this_).spatial_index) );
+
     U8_TRACE_END();
 }
 
@@ -344,6 +373,34 @@ void pencil_layouter_private_propose_default_classifier_size ( pencil_layouter_t
     U8_TRACE_END();
 }
 
+uint64_t pencil_layouter_private_get_font_signature ( const pencil_layouter_t *this_, PangoLayout *font_layout )
+{
+    U8_TRACE_BEGIN();
+    assert( font_layout != NULL );
+    static const char *const PROBE_TEXT = "Hamburgefonstiv |Wg ~ 0123456789 \xc3\x84\xc3\xb6\xc3\x9f";
+
+    const PangoFontDescription *const fonts[3] = {
+        pencil_size_get_footnote_font_description( &((*this_).pencil_size) ),
+        pencil_size_get_standard_font_description( &((*this_).pencil_size) ),
+        pencil_size_get_title_font_description( &((*this_).pencil_size) ),
+    };
+    uint64_t result = 0;
+    pango_layout_set_width( font_layout, -1 );  /* no line wrapping */
+    for ( uint_fast8_t idx = 0; idx < 3; idx ++ )
+    {
+        int text_width;
+        int text_height;
+        pango_layout_set_font_description( font_layout, fonts[idx] );
+        pango_layout_set_text( font_layout, PROBE_TEXT, -1 );
+        pango_layout_get_pixel_size( font_layout, &text_width, &text_height );
+        result = layout_cache_hash_int( result, text_width );
+        result = layout_cache_hash_int( result, text_height );
+    }
+
+    U8_TRACE_END();
+    return result;
+}
+
 pencil_error_t pencil_layouter_get_classifier_order_at_pos ( const pencil_layouter_t *this_,
                                                              data_classifier_type_t c_type,
                                                              double x,
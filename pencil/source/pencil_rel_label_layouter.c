@@ -57,7 +57,6 @@ void pencil_rel_label_layouter_destroy( pencil_rel_label_layouter_t *this_ )
 void pencil_rel_label_layouter_do_layout( pencil_rel_label_layouter_t *this_, PangoLayout *font_layout )
 {
     U8_TRACE_BEGIN();
-    assert ( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS );
     assert( NULL != font_layout );
 
     pencil_floating_label_layouter_reinit( &((*this_).label_floater),
@@ -150,7 +149,7 @@ void pencil_rel_label_layouter_private_propose_processing_order( pencil_rel_labe
         if ( PENCIL_VISIBILITY_HIDE != layout_relationship_get_visibility ( current_relation ) )
         {
             int insert_error;
-            insert_error = universal_array_index_sorter_insert( out_sorted, index, simpleness );
+            insert_error = universal_array_index_sorter_append( out_sorted, index, simpleness );
             if ( 0 != insert_error )
             {
                 U8_LOG_WARNING( "not all relationship label-boxes are layouted" );
@@ -158,6 +157,8 @@ void pencil_rel_label_layouter_private_propose_processing_order( pencil_rel_labe
         }
     }
 
+    universal_array_index_sorter_sort( out_sorted );
+
     U8_TRACE_END();
 }
 
@@ -13,18 +13,26 @@
 void pencil_relationship_2d_layouter_init( pencil_relationship_2d_layouter_t *this_,
                                            layout_visible_set_t *layout_data,
                                            const data_profile_part_t *profile,
-                                           const pencil_size_t *pencil_size )
+                                           const pencil_size_t *pencil_size,
+                                           layout_spatial_index_t *spatial_index )
 {
     U8_TRACE_BEGIN();
     assert( NULL != layout_data );
     assert( NULL != profile );
     assert( NULL != pencil_size );
+    assert( NULL != spatial_index );
 
     (*this_).layout_data = layout_data;
     (*this_).profile = profile;
 
     universal_array_index_sorter_init( &((*this_).sorted_relationships) );
     layout_relationship_iter_init( &((*this_).already_processed), layout_data, &((*this_).sorted_relationships) );
+    (*this_).spatial_index = spatial_index;
+    layout_box_array_init( &((*this_).feature_symbol_boxes) );
+    {
+        const layout_diagram_t *const diagram_layout = layout_visible_set_get_diagram_const( layout_data );
+        layout_connector_index_init( &((*this_).shaped_connectors), layout_diagram_get_bounds_const( diagram_layout ) );
+    }
 
     (*this_).pencil_size = pencil_size;
     pencil_relationship_painter_init( &((*this_).relationship_painter) );
@@ -36,6 +44,9 @@ void pencil_relationship_2d_layouter_destroy( pencil_relationship_2d_layouter_t
 {
     U8_TRACE_BEGIN();
 
+    layout_connector_index_destroy( &((*this_).shaped_connectors) );
+    layout_box_array_destroy( &((*this_).feature_symbol_boxes) );
+    (*this_).spatial_index = NULL;
     layout_relationship_iter_destroy( &((*this_).already_processed) );
     universal_array_index_sorter_destroy( &((*this_).sorted_relationships) );
 
@@ -47,13 +58,31 @@ void pencil_relationship_2d_layouter_destroy( pencil_relationship_2d_layouter_t
 void pencil_relationship_2d_layouter_private_do_layout ( pencil_relationship_2d_layouter_t *this_ )
 {
     U8_TRACE_BEGIN();
-    assert ( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) LAYOUT_VISIBLE_SET_MAX_RELATIONSHIPS );
 
     universal_array_index_sorter_reinit( &((*this_).sorted_relationships) );
 
     /* sort the relationships by their movement-needs, drop invisible relations */
     pencil_relationship_2d_layouter_private_propose_processing_order ( this_ );
 
+    /* index the classifiers and features as obstacles, start with no shaped connectors */
+    layout_spatial_index_resync( (*this_).spatial_index );
+    layout_box_array_reinit( &((*this_).feature_symbol_boxes) );
+    const uint32_t count_features = layout_visible_set_get_feature_count( (*this_).layout_data );
+    for ( uint32_t f_idx = 0; f_idx < count_features; f_idx ++ )
+    {
+        const layout_feature_t *const feature_layout = layout_visible_set_get_feature_ptr( (*this_).layout_data, f_idx );
+        const u8_error_t append_err
+            = layout_box_array_append( &((*this_).feature_symbol_boxes), layout_feature_get_symbol_box_const( feature_layout ) );
+        if ( append_err != U8_ERROR_NONE )
+        {
+            U8_LOG_ANOMALY( "more features than LAYOUT_BOX_ARRAY_MAX_BOXES" );
+        }
+    }
+    {
+        const layout_diagram_t *const diagram_layout = layout_visible_set_get_diagram_ptr( (*this_).layout_data );
+        layout_connector_index_reinit( &((*this_).shaped_connectors), layout_diagram_get_bounds_const( diagram_layout ) );
+    }
+
     /* shape the relationships */
     layout_relationship_iter_t relationship_iterator;
     layout_relationship_iter_init( &relationship_iterator, (*this_).layout_data, &((*this_).sorted_relationships) );
@@ -97,6 +126,7 @@ void pencil_relationship_2d_layouter_private_do_layout ( pencil_relationship_2d_
 
         /* store best option to (*this_).layout_data */
         layout_relationship_set_shape( current_relationship, &(solution[index_of_best]) );
+        layout_connector_index_add( &((*this_).shaped_connectors), &(solution[index_of_best]) );
 
         /* initialize also the label (to empty), this is updated later */
         {
@@ -120,7 +150,6 @@ void pencil_relationship_2d_layouter_private_do_layout ( pencil_relationship_2d_
 void pencil_relationship_2d_layouter_private_propose_processing_order ( pencil_relationship_2d_layouter_t *this_ )
 {
     U8_TRACE_BEGIN();
-    assert ( (unsigned int) UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE >= (unsigned int) DATA_VISIBLE_SET_MAX_RELATIONSHIPS );
 
     /* get draw area */
     const layout_diagram_t *const diagram_layout
@@ -173,7 +202,7 @@ void pencil_relationship_2d_layouter_private_propose_processing_order ( pencil_r
         /* insert relation to sorted array, the simpler the more to the back */
         {
             int insert_error;
-            insert_error = universal_array_index_sorter_insert( &((*this_).sorted_relationships), index, simpleness );
+            insert_error = universal_array_index_sorter_append( &((*this_).sorted_relationships), index, simpleness );
             if ( 0 != insert_error )
             {
                 U8_LOG_WARNING( "not all relationships are shaped" );
@@ -181,6 +210,8 @@ void pencil_relationship_2d_layouter_private_propose_processing_order ( pencil_r
         }
     }
 
+    universal_array_index_sorter_sort( &((*this_).sorted_relationships) );
+
     U8_TRACE_END();
 }
 
@@ -272,6 +303,41 @@ void pencil_relationship_2d_layouter_private_select_solution ( pencil_relationsh
     const layout_diagram_t *const diagram_layout
         = layout_visible_set_get_diagram_ptr( (*this_).layout_data );
 
+    /* get current relationship ends */
+    const layout_visible_classifier_t *const from = layout_relationship_get_from_classifier_ptr( current_relation );
+    const layout_visible_classifier_t *const to = layout_relationship_get_to_classifier_ptr( current_relation );
+    const data_relationship_t *const current_relation_data = layout_relationship_get_data_const ( current_relation );
+
+    /* obstacles further away than this from a solution cause no debts, see layout_quality_t */
+    const double obstacle_distance = 5.0 * pencil_size_get_standard_line_width( (*this_).pencil_size );
+
+    /* classifiers that embrace both ends cause debts for detours at any distance */
+    const uint32_t count_clasfy
+        = layout_visible_set_get_visible_classifier_count ( (*this_).layout_data );
+    layout_spatial_iter_t embracing_classifiers;
+    layout_spatial_iter_init_empty( &embracing_classifiers, count_clasfy );
+    for ( uint32_t clasfy_index = 0; clasfy_index < count_clasfy; clasfy_index ++ )
+    {
+        const layout_visible_classifier_t *const probe_classifier
+            = layout_visible_set_get_visible_classifier_ptr( (*this_).layout_data, clasfy_index );
+        const bool is_from_side
+            = layout_visible_classifier_is_equal_diagramelement_id( probe_classifier, from )
+            || layout_visible_set_is_ancestor( (*this_).layout_data, probe_classifier, from );
+        const bool is_to_side
+            = layout_visible_classifier_is_equal_diagramelement_id( probe_classifier, to )
+            || layout_visible_set_is_ancestor( (*this_).layout_data, probe_classifier, to );
+        if ( is_from_side && is_to_side )
+        {
+            layout_spatial_iter_add( &embracing_classifiers, clasfy_index );
+        }
+    }
+
+    /* buffers to check one solution against the symbol boxes of many features at once */
+    uint32_t feature_index[LAYOUT_BOX_ARRAY_MAX_BOXES];
+    double feature_debts[LAYOUT_BOX_ARRAY_MAX_BOXES];
+    assert( layout_box_array_get_count( &((*this_).feature_symbol_boxes) )
+            == layout_visible_set_get_feature_count( (*this_).layout_data ) );
+
     /* define potential solution and rating */
     uint32_t index_of_best = 0;
     double debts_of_best = DBL_MAX;
@@ -289,15 +355,23 @@ void pencil_relationship_2d_layouter_private_select_solution ( pencil_relationsh
         const layout_quality_t quality = layout_quality_new( (*this_).pencil_size );
         debts_of_current += layout_quality_debts_conn_diag( &quality, current_solution, source_rect, dest_rect, diagram_layout );
 
-        /* iterate over all classifiers */
-        const uint32_t count_clasfy
-            = layout_visible_set_get_visible_classifier_count ( (*this_).layout_data );
-        for ( uint32_t clasfy_index = 0; clasfy_index < count_clasfy; clasfy_index ++ )
+        /* obstacles outside this area add exactly 0.0 debts; skipping them does not change the sum */
+        geometry_rectangle_t obstacle_area = geometry_connector_get_bounding_rectangle( current_solution );
+        geometry_rectangle_expand_4dir( &obstacle_area, obstacle_distance, obstacle_distance );
+
+        /* iterate over nearby and embracing classifiers, in ascending index order */
+        layout_spatial_iter_t clasfy_iterator;
+        layout_spatial_index_query_area( (*this_).spatial_index,
+                                         LAYOUT_SPATIAL_INDEX_KIND_CLASSIFIER,
+                                         &obstacle_area,
+                                         &clasfy_iterator
+                                       );
+        layout_spatial_iter_add_all( &clasfy_iterator, &embracing_classifiers );
+        while ( layout_spatial_iter_has_next( &clasfy_iterator ) )
         {
+            const uint32_t clasfy_index = layout_spatial_iter_next( &clasfy_iterator );
             const layout_visible_classifier_t *const probe_classifier
                 = layout_visible_set_get_visible_classifier_ptr( (*this_).layout_data, clasfy_index );
-            const layout_visible_classifier_t *const from = layout_relationship_get_from_classifier_ptr( current_relation );
-            const layout_visible_classifier_t *const to = layout_relationship_get_to_classifier_ptr( current_relation );
             const bool is_from = layout_visible_classifier_is_equal_diagramelement_id( probe_classifier, from );
             const bool is_ancestor_of_from = layout_visible_set_is_ancestor( (*this_).layout_data, probe_classifier, from );
             const bool is_to = layout_visible_classifier_is_equal_diagramelement_id( probe_classifier, to );
@@ -311,35 +385,50 @@ void pencil_relationship_2d_layouter_private_select_solution ( pencil_relationsh
                                                                  is_ancestor_of_to
                                                                );
         }
-
-        /* iterate over all features, check symbol boxes only, label boxes are not yet initialized */
-        const uint32_t count_features
-            = layout_visible_set_get_feature_count ( (*this_).layout_data );
-        for ( uint32_t f_idx = 0; f_idx < count_features; f_idx ++ )
+        layout_spatial_iter_destroy( &clasfy_iterator );
+
+        /* iterate over nearby features, check symbol boxes only, label boxes are not yet initialized */
+        uint32_t feature_count = 0;
+        layout_spatial_iter_t feature_iterator;
+        layout_spatial_index_query_area( (*this_).spatial_index,
+                                         LAYOUT_SPATIAL_INDEX_KIND_FEATURE,
+                                         &obstacle_area,
+                                         &feature_iterator
+                                       );
+        while ( layout_spatial_iter_has_next( &feature_iterator ) )
         {
-            const layout_feature_t *const feature_layout
-                = layout_visible_set_get_feature_ptr ( (*this_).layout_data, f_idx );
-
-            const geometry_rectangle_t *const feature_symbol_box
-                = layout_feature_get_symbol_box_const( feature_layout );
-
-            debts_of_current += layout_quality_debts_conn_sym( &quality, current_solution, feature_symbol_box );
+            feature_index[feature_count] = layout_spatial_iter_next( &feature_iterator );
+            feature_count ++;
+        }
+        layout_spatial_iter_destroy( &feature_iterator );
+        layout_quality_debts_conn_sym_batch( &quality,
+                                             current_solution,
+                                             &((*this_).feature_symbol_boxes),
+                                             feature_index,
+                                             feature_count,
+                                             feature_debts
+                                           );
+        for ( uint32_t f_pos = 0; f_pos < feature_count; f_pos ++ )
+        {
+            debts_of_current += feature_debts[f_pos];
         }
 
-        /* iterate over the already created connectors */
-        layout_relationship_iter_t relationship_iterator;
-        layout_relationship_iter_copy( &relationship_iterator, &((*this_).already_processed) );
-        while ( layout_relationship_iter_has_next( &relationship_iterator ) )
+        /* iterate over the nearby already created connectors, in processing order */
+        assert( layout_connector_index_get_count( &((*this_).shaped_connectors) ) == (*this_).already_processed.length );
+        layout_spatial_iter_t connector_iterator;
+        layout_connector_index_query_area( &((*this_).shaped_connectors), &obstacle_area, &connector_iterator );
+        while ( layout_spatial_iter_has_next( &connector_iterator ) )
         {
             /* get pointer to relationships */
+            const uint32_t processed_idx = layout_spatial_iter_next( &connector_iterator );
+            const uint32_t array_index
+                = universal_array_index_sorter_get_array_index( &((*this_).sorted_relationships), processed_idx );
             const layout_relationship_t *const probe_relationship
-                = layout_relationship_iter_next_ptr( &relationship_iterator );
+                = layout_visible_set_get_relationship_ptr( (*this_).layout_data, array_index );
             const data_relationship_t *const probe_relation_data
                 = layout_relationship_get_data_const ( probe_relationship );
             const geometry_connector_t *const probe_shape
                 = layout_relationship_get_shape_const( probe_relationship );
-            const data_relationship_t *const current_relation_data
-                = layout_relationship_get_data_const ( current_relation );
 
             /* add debts if intersects */
             const bool same_type
@@ -359,7 +448,8 @@ void pencil_relationship_2d_layouter_private_select_solution ( pencil_relationsh
                                                                 same_to
                                                               );
         }
-        layout_relationship_iter_destroy( &relationship_iterator );
+        layout_spatial_iter_destroy( &connector_iterator );
+        geometry_rectangle_destroy( &obstacle_area );
 
         /* update best solution */
         if ( debts_of_current < debts_of_best )
@@ -368,6 +458,7 @@ void pencil_relationship_2d_layouter_private_select_solution ( pencil_relationsh
             debts_of_best = debts_of_current;
         }
     }
+    layout_spatial_iter_destroy( &embracing_classifiers );
 
 #if 0
     static unsigned int counter = 0;
@@ -0,0 +1,261 @@
+/* File: layout_cache_test.c; Copyright and License: see below */
+
+#include "layout_cache_test.h"
+#include "layout/layout_cache.h"
+#include "pencil_layouter.h"
+#include "test_data/test_data_setup.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <string.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t restore_equals_layout( test_fixture_t *fix );
+static test_case_result_t changed_bounds_miss( test_fixture_t *fix );
+static test_case_result_t least_recently_used_evicted( test_fixture_t *fix );
+static uint64_t get_key( test_fixture_t *fix, pencil_layouter_t *layouter );
+static bool equal_geometry( const layout_visible_set_t *expected, const layout_visible_set_t *actual );
+
+test_suite_t layout_cache_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "layout_cache_test",
+                     TEST_CATEGORY_INTEGRATION | TEST_CATEGORY_CONTINUOUS,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "restore_equals_layout", &restore_equals_layout );
+    test_suite_add_test_case( &result, "changed_bounds_miss", &changed_bounds_miss );
+    test_suite_add_test_case( &result, "least_recently_used_evicted", &least_recently_used_evicted );
+    return result;
+}
+
+struct test_fixture_struct {
+    data_visible_set_t data_set;
+    data_profile_part_t profile;
+    layout_cache_t cache;  /*!< the cache under test */
+    pencil_layouter_t plain_layouter;  /*!< layouter without cache */
+    pencil_layouter_t cached_layouter;  /*!< layouter using the cache */
+    cairo_surface_t *surface;
+    cairo_t *cr;
+    geometry_rectangle_t diagram_bounds;
+    PangoLayout *font_layout;
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    data_visible_set_init( &((*fix).data_set) );
+    data_profile_part_init( &((*fix).profile) );
+    layout_cache_init( &((*fix).cache) );
+    pencil_layouter_init( &((*fix).plain_layouter), &((*fix).data_set), &((*fix).profile) );
+    pencil_layouter_init( &((*fix).cached_layouter), &((*fix).data_set), &((*fix).profile) );
+    pencil_layouter_set_layout_cache( &((*fix).cached_layouter), &((*fix).cache) );
+    geometry_rectangle_init( &((*fix).diagram_bounds), 0.0, 0.0, 640.0, 480.0 );
+    (*fix).surface = cairo_image_surface_create( CAIRO_FORMAT_ARGB32, 640, 480 );
+    TEST_ENVIRONMENT_ASSERT( CAIRO_STATUS_SUCCESS == cairo_surface_status( (*fix).surface ) );
+    (*fix).cr = cairo_create( (*fix).surface );
+    TEST_ENVIRONMENT_ASSERT( CAIRO_STATUS_SUCCESS == cairo_status( (*fix).cr ) );
+    (*fix).font_layout = pango_cairo_create_layout( (*fix).cr );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    g_object_unref( (*fix).font_layout );
+    cairo_destroy( (*fix).cr );
+    cairo_surface_finish( (*fix).surface );
+    cairo_surface_destroy( (*fix).surface );
+    geometry_rectangle_destroy( &((*fix).diagram_bounds) );
+    pencil_layouter_destroy( &((*fix).cached_layouter) );
+    pencil_layouter_destroy( &((*fix).plain_layouter) );
+    layout_cache_destroy( &((*fix).cache) );
+    data_profile_part_destroy( &((*fix).profile) );
+    data_visible_set_destroy( &((*fix).data_set) );
+}
+
+static test_case_result_t restore_equals_layout( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    pencil_layouter_t *const plain = &((*fix).plain_layouter);
+    pencil_layouter_t *const cached = &((*fix).cached_layouter);
+
+    test_data_setup_t ts_setup;
+    test_data_setup_init( &ts_setup, TEST_DATA_SETUP_MODE_GOOD_CASES );
+    for ( ; test_data_setup_is_valid_variant( &ts_setup ); test_data_setup_next_variant( &ts_setup ) )
+    {
+        test_data_setup_get_variant_data( &ts_setup, &((*fix).data_set) );
+
+        /* layout without cache */
+        pencil_layouter_prepare( plain );
+        pencil_layouter_define_grid( plain, (*fix).diagram_bounds, (*fix).font_layout );
+        pencil_layouter_layout_elements( plain, (*fix).font_layout );
+
+        /* first layout with cache stores the result */
+        pencil_layouter_prepare( cached );
+        pencil_layouter_define_grid( cached, (*fix).diagram_bounds, (*fix).font_layout );
+        pencil_layouter_layout_elements( cached, (*fix).font_layout );
+        TEST_EXPECT( equal_geometry( pencil_layouter_get_layout_data_const( plain ),
+                                     pencil_layouter_get_layout_data_const( cached ) ) );
+
+        /* second layout with cache is restored */
+        pencil_layouter_prepare( cached );
+        pencil_layouter_define_grid( cached, (*fix).diagram_bounds, (*fix).font_layout );
+        const uint64_t key = get_key( fix, cached );
+        TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE,
+                               layout_cache_restore( &((*fix).cache), key, pencil_layouter_get_layout_data_ptr( cached ) )
+                             );
+        pencil_layouter_layout_elements( cached, (*fix).font_layout );
+        TEST_EXPECT( equal_geometry( pencil_layouter_get_layout_data_const( plain ),
+                                     pencil_layouter_get_layout_data_const( cached ) ) );
+        TEST_EXPECT( layout_spatial_index_is_valid( pencil_layouter_get_spatial_index_const( cached ) ) );
+    }
+    test_data_setup_destroy( &ts_setup );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t changed_bounds_miss( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    pencil_layouter_t *const cached = &((*fix).cached_layouter);
+
+    test_data_setup_t ts_setup;
+    test_data_setup_init( &ts_setup, TEST_DATA_SETUP_MODE_GOOD_CASES );
+    test_data_setup_get_variant_data( &ts_setup, &((*fix).data_set) );
+
+    pencil_layouter_prepare( cached );
+    pencil_layouter_define_grid( cached, (*fix).diagram_bounds, (*fix).font_layout );
+    const uint64_t small_key = get_key( fix, cached );
+    pencil_layouter_layout_elements( cached, (*fix).font_layout );
+
+    geometry_rectangle_t big_bounds;
+    geometry_rectangle_init( &big_bounds, 0.0, 0.0, 800.0, 600.0 );
+    pencil_layouter_prepare( cached );
+    pencil_layouter_define_grid( cached, big_bounds, (*fix).font_layout );
+    const uint64_t big_key = get_key( fix, cached );
+    TEST_EXPECT( small_key != big_key );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NOT_FOUND,
+                           layout_cache_restore( &((*fix).cache), big_key, pencil_layouter_get_layout_data_ptr( cached ) )
+                         );
+    pencil_layouter_layout_elements( cached, (*fix).font_layout );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE,
+                           layout_cache_restore( &((*fix).cache), big_key, pencil_layouter_get_layout_data_ptr( cached ) )
+                         );
+    geometry_rectangle_destroy( &big_bounds );
+
+    test_data_setup_destroy( &ts_setup );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t least_recently_used_evicted( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    pencil_layouter_t *const plain = &((*fix).plain_layouter);
+    const uint32_t STORED = LAYOUT_CACHE_MAX_ENTRIES + 36;
+
+    test_data_setup_t ts_setup;
+    test_data_setup_init( &ts_setup, TEST_DATA_SETUP_MODE_GOOD_CASES );
+    test_data_setup_get_variant_data( &ts_setup, &((*fix).data_set) );
+    pencil_layouter_prepare( plain );
+    pencil_layouter_define_grid( plain, (*fix).diagram_bounds, (*fix).font_layout );
+    pencil_layouter_layout_elements( plain, (*fix).font_layout );
+    layout_visible_set_t *const layout_data = pencil_layouter_get_layout_data_ptr( plain );
+
+    for ( uint32_t key = 1; key <= STORED; key ++ )
+    {
+        TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, layout_cache_store( &((*fix).cache), key, layout_data ) );
+        if ( key == LAYOUT_CACHE_MAX_ENTRIES )
+        {
+            /* all slots are in use; key 1 is used again, key 2 becomes the least recently used */
+            TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, layout_cache_restore( &((*fix).cache), 1, layout_data ) );
+        }
+    }
+
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, layout_cache_restore( &((*fix).cache), 1, layout_data ) );
+    for ( uint32_t key = 2; key <= STORED; key ++ )
+    {
+        const bool expect_found = ( key > STORED - LAYOUT_CACHE_MAX_ENTRIES + 1 );
+        const u8_error_t restored = layout_cache_restore( &((*fix).cache), key, layout_data );
+        TEST_EXPECT_EQUAL_INT( expect_found ? U8_ERROR_NONE : U8_ERROR_NOT_FOUND, restored );
+    }
+
+    layout_cache_clear( &((*fix).cache) );
+    TEST_EXPECT_EQUAL_INT( U8_ERROR_NOT_FOUND, layout_cache_restore( &((*fix).cache), STORED, layout_data ) );
+
+    test_data_setup_destroy( &ts_setup );
+    return TEST_CASE_RESULT_OK;
+}
+
+static uint64_t get_key( test_fixture_t *fix, pencil_layouter_t *layouter )
+{
+    const uint64_t font_signature = pencil_layouter_private_get_font_signature( layouter, (*fix).font_layout );
+    return layout_cache_compute_key( pencil_layouter_get_layout_data_const( layouter ), &((*fix).profile), font_signature );
+}
+
+static bool equal_geometry( const layout_visible_set_t *expected, const layout_visible_set_t *actual )
+{
+    bool result = true;
+
+    const uint32_t classifier_count = layout_visible_set_get_visible_classifier_count( expected );
+    result &= ( classifier_count == layout_visible_set_get_visible_classifier_count( actual ) );
+    for ( uint32_t index = 0; result && ( index < classifier_count ); index ++ )
+    {
+        const layout_visible_classifier_t *const exp = layout_visible_set_get_visible_classifier_const( expected, index );
+        const layout_visible_classifier_t *const act = layout_visible_set_get_visible_classifier_const( actual, index );
+        result &= ( 0 == memcmp( &((*exp).symbol_box), &((*act).symbol_box), sizeof(geometry_rectangle_t) ) );
+        result &= ( 0 == memcmp( &((*exp).space), &((*act).space), sizeof(geometry_rectangle_t) ) );
+        result &= ( 0 == memcmp( &((*exp).features), &((*act).features), sizeof(geometry_compartments_t) ) );
+        result &= ( 0 == memcmp( &((*exp).label_box), &((*act).label_box), sizeof(geometry_rectangle_t) ) );
+        result &= ( 0 == memcmp( &((*exp).icon_box), &((*act).icon_box), sizeof(geometry_rectangle_t) ) );
+        result &= ( (*exp).label_h_anchor == (*act).label_h_anchor );
+        result &= ( (*exp).label_v_anchor == (*act).label_v_anchor );
+    }
+
+    const uint32_t feature_count = layout_visible_set_get_feature_count( expected );
+    result &= ( feature_count == layout_visible_set_get_feature_count( actual ) );
+    for ( uint32_t index = 0; result && ( index < feature_count ); index ++ )
+    {
+        const layout_feature_t *const exp = layout_visible_set_get_feature_const( expected, index );
+        const layout_feature_t *const act = layout_visible_set_get_feature_const( actual, index );
+        result &= ( 0 == memcmp( &((*exp).symbol_box), &((*act).symbol_box), sizeof(geometry_rectangle_t) ) );
+        result &= ( 0 == memcmp( &((*exp).label_box), &((*act).label_box), sizeof(geometry_rectangle_t) ) );
+        result &= ( (*exp).icon_direction == (*act).icon_direction );
+    }
+
+    const uint32_t relationship_count = layout_visible_set_get_relationship_count( expected );
+    result &= ( relationship_count == layout_visible_set_get_relationship_count( actual ) );
+    for ( uint32_t index = 0; result && ( index < relationship_count ); index ++ )
+    {
+        const layout_relationship_t *const exp = layout_visible_set_get_relationship_const( expected, index );
+        const layout_relationship_t *const act = layout_visible_set_get_relationship_const( actual, index );
+        result &= ( (*exp).visible == (*act).visible );
+        result &= ( 0 == memcmp( &((*exp).shape), &((*act).shape), sizeof(geometry_connector_t) ) );
+        result &= ( 0 == memcmp( &((*exp).label_box), &((*act).label_box), sizeof(geometry_rectangle_t) ) );
+    }
+
+    return result;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
@@ -0,0 +1,230 @@
+/* File: layout_connector_index_test.c; Copyright and License: see below */
+
+#include "layout_connector_index_test.h"
+#include "layout/layout_connector_index.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <string.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t test_empty_index( test_fixture_t *fix );
+static test_case_result_t test_candidates_contain_hits( test_fixture_t *fix );
+static test_case_result_t test_large_connectors( test_fixture_t *fix );
+static void add_fake_connectors( test_fixture_t *fix, uint32_t count, double max_size );
+static double next_random( double min, double max );
+static test_case_result_t check_area( const test_fixture_t *fix, const geometry_rectangle_t *area );
+
+test_suite_t layout_connector_index_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "layout_connector_index_test",
+                     TEST_CATEGORY_UNIT | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_empty_index", &test_empty_index );
+    test_suite_add_test_case( &result, "test_candidates_contain_hits", &test_candidates_contain_hits );
+    test_suite_add_test_case( &result, "test_large_connectors", &test_large_connectors );
+    return result;
+}
+
+struct test_fixture_struct {
+    layout_connector_index_t testee;  /*!< the connector index under test */
+    geometry_connector_t shape[LAYOUT_SPATIAL_ITER_MAX_ITEMS];  /*!< the added connectors, by number */
+    uint32_t shape_count;  /*!< number of added connectors */
+    uint32_t random_state;  /*!< state of the pseudo random number generator */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    (*fix).random_state = 0x7654321;
+    (*fix).shape_count = 0;
+    geometry_rectangle_t bounds;
+    geometry_rectangle_init( &bounds, 0.0, 0.0, 800.0, 600.0 );
+    layout_connector_index_init( &((*fix).testee), &bounds );
+    geometry_rectangle_destroy( &bounds );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    layout_connector_index_destroy( &((*fix).testee) );
+}
+
+static test_case_result_t test_empty_index( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    geometry_rectangle_t area;
+    geometry_rectangle_init( &area, -100.0, -100.0, 1000.0, 800.0 );
+    layout_spatial_iter_t candidates;
+
+    /* an empty index returns no candidates */
+    TEST_EXPECT_EQUAL_INT( 0, layout_connector_index_get_count( &((*fix).testee) ) );
+    layout_connector_index_query_area( &((*fix).testee), &area, &candidates );
+    TEST_EXPECT( ! layout_spatial_iter_has_next( &candidates ) );
+    layout_spatial_iter_destroy( &candidates );
+
+    /* connectors are numbered in the order they are added */
+    add_fake_connectors( fix, 50, 60.0 );
+    TEST_EXPECT_EQUAL_INT( 50, layout_connector_index_get_count( &((*fix).testee) ) );
+    layout_connector_index_query_area( &((*fix).testee), &area, &candidates );
+    uint32_t count = 0;
+    while ( layout_spatial_iter_has_next( &candidates ) )
+    {
+        TEST_EXPECT_EQUAL_INT( count, layout_spatial_iter_next( &candidates ) );
+        count ++;
+    }
+    TEST_EXPECT_EQUAL_INT( 50, count );
+    layout_spatial_iter_destroy( &candidates );
+
+    /* reinit removes all connectors */
+    layout_connector_index_reinit( &((*fix).testee), &area );
+    (*fix).shape_count = 0;
+    layout_connector_index_query_area( &((*fix).testee), &area, &candidates );
+    TEST_EXPECT( ! layout_spatial_iter_has_next( &candidates ) );
+    layout_spatial_iter_destroy( &candidates );
+
+    geometry_rectangle_destroy( &area );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_candidates_contain_hits( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+
+    /* query while connectors are added one after the other */
+    for ( uint32_t round = 0; round < 20; round ++ )
+    {
+        add_fake_connectors( fix, 40, 120.0 );
+        for ( uint32_t probe = 0; probe < 100; probe ++ )
+        {
+            geometry_rectangle_t area;
+            geometry_rectangle_init( &area, next_random( -100.0, 900.0 ), next_random( -100.0, 700.0 ), next_random( 0.0, 80.0 ), next_random( 0.0, 80.0 ) );
+            const test_case_result_t probe_result = check_area( fix, &area );
+            TEST_EXPECT_EQUAL_INT( TEST_CASE_RESULT_OK, probe_result );
+            geometry_rectangle_destroy( &area );
+        }
+    }
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_large_connectors( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    /* connectors spanning the whole diagram do not fit into LAYOUT_CONNECTOR_INDEX_MAX_CELLS_PER_ITEM cells, */
+    /* many of them exceed LAYOUT_CONNECTOR_INDEX_MAX_ENTRIES */
+    add_fake_connectors( fix, 300, 2000.0 );
+    add_fake_connectors( fix, 1500, 250.0 );
+
+    for ( uint32_t probe = 0; probe < 300; probe ++ )
+    {
+        geometry_rectangle_t area;
+        geometry_rectangle_init( &area, next_random( -100.0, 900.0 ), next_random( -100.0, 700.0 ), next_random( 0.0, 20.0 ), next_random( 0.0, 20.0 ) );
+        const test_case_result_t probe_result = check_area( fix, &area );
+        TEST_EXPECT_EQUAL_INT( TEST_CASE_RESULT_OK, probe_result );
+        geometry_rectangle_destroy( &area );
+    }
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t check_area( const test_fixture_t *fix, const geometry_rectangle_t *area )
+{
+    static bool is_candidate[LAYOUT_SPATIAL_ITER_MAX_ITEMS];
+    layout_spatial_iter_t candidates;
+
+    memset( &is_candidate, 0, sizeof(is_candidate) );
+    layout_connector_index_query_area( &((*fix).testee), area, &candidates );
+    uint32_t min_next = 0;
+    while ( layout_spatial_iter_has_next( &candidates ) )
+    {
+        /* candidates are ascending and refer to added connectors */
+        const uint32_t item = layout_spatial_iter_next( &candidates );
+        TEST_EXPECT( item >= min_next );
+        TEST_EXPECT( item < (*fix).shape_count );
+        is_candidate[item] = true;
+        min_next = item + 1;
+    }
+    layout_spatial_iter_destroy( &candidates );
+
+    const geometry_connector_segment_t segments[3]
+        = { GEOMETRY_CONNECTOR_SEGMENT_SOURCE, GEOMETRY_CONNECTOR_SEGMENT_MAIN, GEOMETRY_CONNECTOR_SEGMENT_DESTINATION };
+    for ( uint32_t item = 0; item < (*fix).shape_count; item ++ )
+    {
+        bool hit = false;
+        for ( uint_fast32_t seg_idx = 0; seg_idx < 3; seg_idx ++ )
+        {
+            const geometry_rectangle_t segment_bounds
+                = geometry_connector_get_segment_bounds( &((*fix).shape[item]), segments[seg_idx] );
+            hit = hit || geometry_rectangle_is_contiguous( &segment_bounds, area );
+        }
+        TEST_EXPECT( is_candidate[item] || ( ! hit ) );
+    }
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static void add_fake_connectors( test_fixture_t *fix, uint32_t count, double max_size )
+{
+    for ( uint32_t index = 0; index < count; index ++ )
+    {
+        geometry_connector_t *const shape = &((*fix).shape[(*fix).shape_count]);
+        const double source_x = next_random( -50.0, 850.0 );
+        const double source_y = next_random( -50.0, 650.0 );
+        if ( 0 == ( index % 2 ) )
+        {
+            geometry_connector_init_vertical( shape,
+                                              source_x,
+                                              source_y,
+                                              source_x + next_random( -max_size, max_size ),
+                                              source_y + next_random( -max_size, max_size ),
+                                              source_x + next_random( -max_size, max_size )
+                                            );
+        }
+        else
+        {
+            geometry_connector_init_horizontal( shape,
+                                                source_x,
+                                                source_y,
+                                                source_x + next_random( -max_size, max_size ),
+                                                source_y + next_random( -max_size, max_size ),
+                                                source_y + next_random( -max_size, max_size )
+                                              );
+        }
+        const uint32_t item = layout_connector_index_add( &((*fix).testee), shape );
+        assert( item == (*fix).shape_count );
+        (*fix).shape_count ++;
+    }
+}
+
+static double next_random( double min, double max )
+{
+    /* linear congruential generator, reproducible on all platforms */
+    test_fixture.random_state = test_fixture.random_state * 1103515245 + 12345;
+    const double unit = ( ( test_fixture.random_state >> 8 ) & 0xffff ) / 65536.0;
+    return min + unit * ( max - min );
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
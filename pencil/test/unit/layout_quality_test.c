@@ -0,0 +1,219 @@
+/* File: layout_quality_test.c; Copyright and License: see below */
+
+#include "layout_quality_test.h"
+#include "layout/layout_quality.h"
+#include "layout/layout_box_array.h"
+#include "geometry/geometry_connector.h"
+#include "pencil_size.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <string.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t test_batch_equals_single( test_fixture_t *fix );
+static test_case_result_t test_batch_on_borders( test_fixture_t *fix );
+static test_case_result_t check_batch( test_fixture_t *fix, const geometry_connector_t *probe, uint32_t index_count );
+static void init_random_connector( geometry_connector_t *connector, double max_size );
+static double next_random( double min, double max );
+
+test_suite_t layout_quality_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "layout_quality_test",
+                     TEST_CATEGORY_UNIT | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_batch_equals_single", &test_batch_equals_single );
+    test_suite_add_test_case( &result, "test_batch_on_borders", &test_batch_on_borders );
+    return result;
+}
+
+struct test_fixture_struct {
+    pencil_size_t pencil_size;  /*!< defines the line width and object distance */
+    layout_quality_t testee;  /*!< the quality checker under test */
+    layout_box_array_t boxes;  /*!< the boxes to check against */
+    uint32_t index[LAYOUT_BOX_ARRAY_MAX_BOXES];  /*!< the indices of boxes to check */
+    double batch_debts[LAYOUT_BOX_ARRAY_MAX_BOXES];  /*!< the results of the batch function */
+    uint32_t random_state;  /*!< state of the pseudo random number generator */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    (*fix).random_state = 0x2468ace;
+    pencil_size_init( &((*fix).pencil_size), 640.0, 480.0 );
+    layout_quality_init( &((*fix).testee), &((*fix).pencil_size) );
+    layout_box_array_init( &((*fix).boxes) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    layout_box_array_destroy( &((*fix).boxes) );
+    layout_quality_destroy( &((*fix).testee) );
+    pencil_size_destroy( &((*fix).pencil_size) );
+}
+
+static test_case_result_t test_batch_equals_single( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+
+    /* random boxes */
+    for ( uint32_t b_idx = 0; b_idx < 500; b_idx ++ )
+    {
+        geometry_rectangle_t box;
+        geometry_rectangle_init( &box, next_random( 0.0, 600.0 ), next_random( 0.0, 440.0 ), next_random( 1.0, 80.0 ), next_random( 1.0, 40.0 ) );
+        const u8_error_t append_err = layout_box_array_append( &((*fix).boxes), &box );
+        TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, append_err );
+        geometry_rectangle_destroy( &box );
+    }
+    TEST_EXPECT_EQUAL_INT( 500, layout_box_array_get_count( &((*fix).boxes) ) );
+
+    /* random connectors against an odd number of boxes in random order */
+    for ( uint32_t probe_idx = 0; probe_idx < 200; probe_idx ++ )
+    {
+        for ( uint32_t pos = 0; pos < 499; pos ++ )
+        {
+            (*fix).index[pos] = (uint32_t) next_random( 0.0, 499.99 );
+        }
+        geometry_connector_t probe;
+        init_random_connector( &probe, 300.0 );
+        const test_case_result_t probe_result = check_batch( fix, &probe, 499 );
+        TEST_EXPECT_EQUAL_INT( TEST_CASE_RESULT_OK, probe_result );
+        geometry_connector_destroy( &probe );
+    }
+
+    /* no boxes */
+    geometry_connector_t empty;
+    geometry_connector_init_empty( &empty );
+    const test_case_result_t empty_result = check_batch( fix, &empty, 0 );
+    TEST_EXPECT_EQUAL_INT( TEST_CASE_RESULT_OK, empty_result );
+    geometry_connector_destroy( &empty );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_batch_on_borders( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    const double line_width = pencil_size_get_standard_line_width( &((*fix).pencil_size) );
+
+    /* boxes on a coarse grid so that connector points often lie on or near the borders */
+    for ( uint32_t b_idx = 0; b_idx < 64; b_idx ++ )
+    {
+        geometry_rectangle_t box;
+        geometry_rectangle_init( &box, 40.0 * ( b_idx % 8 ), 40.0 * ( b_idx / 8 ), 40.0, 20.0 );
+        const u8_error_t append_err = layout_box_array_append( &((*fix).boxes), &box );
+        TEST_EXPECT_EQUAL_INT( U8_ERROR_NONE, append_err );
+        geometry_rectangle_destroy( &box );
+        (*fix).index[b_idx] = b_idx;
+    }
+
+    for ( uint32_t probe_idx = 0; probe_idx < 1000; probe_idx ++ )
+    {
+        /* points are on the grid, exactly 5x line width away from it, or slightly off */
+        double coord[5];
+        for ( uint32_t c_idx = 0; c_idx < 5; c_idx ++ )
+        {
+            const double grid = 20.0 * (uint32_t) next_random( 0.0, 16.99 );
+            const uint32_t variant = (uint32_t) next_random( 0.0, 4.99 );
+            coord[c_idx] = ( variant == 0 ) ? grid
+                : ( variant == 1 ) ? ( grid + 5.0 * line_width )
+                : ( variant == 2 ) ? ( grid - 5.0 * line_width )
+                : ( variant == 3 ) ? ( grid + next_random( -0.001, 0.001 ) )
+                : next_random( 0.0, 340.0 );
+        }
+        geometry_connector_t probe;
+        if ( 0 == ( probe_idx % 2 ) )
+        {
+            geometry_connector_init_vertical( &probe, coord[0], coord[1], coord[2], coord[3], coord[4] );
+        }
+        else
+        {
+            geometry_connector_init_horizontal( &probe, coord[0], coord[1], coord[2], coord[3], coord[4] );
+        }
+        const test_case_result_t probe_result = check_batch( fix, &probe, 64 );
+        TEST_EXPECT_EQUAL_INT( TEST_CASE_RESULT_OK, probe_result );
+        geometry_connector_destroy( &probe );
+    }
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t check_batch( test_fixture_t *fix, const geometry_connector_t *probe, uint32_t index_count )
+{
+    layout_quality_debts_conn_sym_batch( &((*fix).testee ),
+                                         probe,
+                                         &((*fix).boxes),
+                                         (*fix).index,
+                                         index_count,
+                                         (*fix).batch_debts
+                                       );
+    for ( uint32_t pos = 0; pos < index_count; pos ++ )
+    {
+        const geometry_rectangle_t box = layout_box_array_get_box( &((*fix).boxes), (*fix).index[pos] );
+        const double single_debts = layout_quality_debts_conn_sym( &((*fix).testee ), probe, &box );
+        /* the results shall be equal bit by bit */
+        TEST_EXPECT_EQUAL_INT( 0, memcmp( &single_debts, &((*fix).batch_debts[pos]), sizeof(double) ) );
+    }
+    return TEST_CASE_RESULT_OK;
+}
+
+static void init_random_connector( geometry_connector_t *connector, double max_size )
+{
+    const double source_x = next_random( 0.0, 640.0 );
+    const double source_y = next_random( 0.0, 480.0 );
+    if ( next_random( 0.0, 1.0 ) < 0.5 )
+    {
+        geometry_connector_init_vertical( connector,
+                                          source_x,
+                                          source_y,
+                                          source_x + next_random( -max_size, max_size ),
+                                          source_y + next_random( -max_size, max_size ),
+                                          source_x + next_random( -max_size, max_size )
+                                        );
+    }
+    else
+    {
+        geometry_connector_init_horizontal( connector,
+                                            source_x,
+                                            source_y,
+                                            source_x + next_random( -max_size, max_size ),
+                                            source_y + next_random( -max_size, max_size ),
+                                            source_y + next_random( -max_size, max_size )
+                                          );
+    }
+}
+
+static double next_random( double min, double max )
+{
+    /* linear congruential generator, reproducible on all platforms */
+    test_fixture.random_state = test_fixture.random_state * 1103515245 + 12345;
+    const double unit = ( ( test_fixture.random_state >> 8 ) & 0xffff ) / 65536.0;
+    return min + unit * ( max - min );
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
@@ -0,0 +1,378 @@
+/* File: layout_spatial_index_test.c; Copyright and License: see below */
+
+#include "layout_spatial_index_test.h"
+#include "layout/layout_spatial_index.h"
+#include "layout/layout_visible_set.h"
+#include "set/data_visible_set.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <string.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t test_invalid_index( test_fixture_t *fix );
+static test_case_result_t test_candidates_contain_hits( test_fixture_t *fix );
+static test_case_result_t test_large_elements( test_fixture_t *fix );
+static data_visible_set_t* init_fake_input_data( uint_fast32_t classifiers, uint_fast32_t features, uint_fast32_t relationships );
+static void init_fake_geometry( layout_visible_set_t *layout_data, double max_size );
+static double next_random( double min, double max );
+static test_case_result_t check_pos( const layout_spatial_index_t *index, double x, double y, double snap_distance );
+
+test_suite_t layout_spatial_index_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "layout_spatial_index_test",
+                     TEST_CATEGORY_UNIT | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_invalid_index", &test_invalid_index );
+    test_suite_add_test_case( &result, "test_candidates_contain_hits", &test_candidates_contain_hits );
+    test_suite_add_test_case( &result, "test_large_elements", &test_large_elements );
+    return result;
+}
+
+struct test_fixture_struct {
+    data_visible_set_t *input_data;  /*!< input data of the layout */
+    layout_visible_set_t layout_data;  /*!< layout data to be indexed */
+    layout_spatial_index_t testee;  /*!< the spatial index under test */
+    uint32_t random_state;  /*!< state of the pseudo random number generator */
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture_t *fix = &test_fixture;
+    (*fix).random_state = 0x1234567;
+    (*fix).input_data = init_fake_input_data( 120, 300, 400 );
+    layout_visible_set_init( &((*fix).layout_data), (*fix).input_data );
+    layout_spatial_index_init( &((*fix).testee), &((*fix).layout_data) );
+    return fix;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    layout_spatial_index_destroy( &((*fix).testee) );
+    layout_visible_set_destroy( &((*fix).layout_data) );
+    data_visible_set_destroy( (*fix).input_data );
+}
+
+static test_case_result_t test_invalid_index( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    const uint32_t rel_count = layout_visible_set_get_relationship_count( &((*fix).layout_data) );
+    TEST_ENVIRONMENT_ASSERT( rel_count > 0 );
+    TEST_EXPECT( ! layout_spatial_index_is_valid( &((*fix).testee) ) );
+
+    /* an invalid index returns all elements */
+    layout_spatial_iter_t candidates;
+    layout_spatial_index_query_pos( &((*fix).testee), LAYOUT_SPATIAL_INDEX_KIND_RELATIONSHIP, 10.0, 10.0, 0.0, &candidates );
+    uint32_t count = 0;
+    while ( layout_spatial_iter_has_next( &candidates ) )
+    {
+        const uint32_t index = layout_spatial_iter_next( &candidates );
+        TEST_EXPECT_EQUAL_INT( count, index );
+        count ++;
+    }
+    TEST_EXPECT_EQUAL_INT( rel_count, count );
+    TEST_EXPECT_EQUAL_INT( rel_count, layout_spatial_iter_next( &candidates ) );
+    layout_spatial_iter_destroy( &candidates );
+
+    /* after resync, a small area returns only few candidates */
+    init_fake_geometry( &((*fix).layout_data), 40.0 );
+    layout_spatial_index_resync( &((*fix).testee) );
+    TEST_EXPECT( layout_spatial_index_is_valid( &((*fix).testee) ) );
+    geometry_rectangle_t small_area;
+    geometry_rectangle_init( &small_area, 400.0, 300.0, 10.0, 10.0 );
+    layout_spatial_index_query_area( &((*fix).testee), LAYOUT_SPATIAL_INDEX_KIND_RELATIONSHIP, &small_area, &candidates );
+    count = 0;
+    while ( layout_spatial_iter_has_next( &candidates ) )
+    {
+        layout_spatial_iter_next( &candidates );
+        count ++;
+    }
+    TEST_EXPECT( count < ( rel_count / 4 ) );
+    layout_spatial_iter_destroy( &candidates );
+    geometry_rectangle_destroy( &small_area );
+
+    layout_spatial_index_invalidate( &((*fix).testee) );
+    TEST_EXPECT( ! layout_spatial_index_is_valid( &((*fix).testee) ) );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_candidates_contain_hits( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    init_fake_geometry( &((*fix).layout_data), 120.0 );
+    layout_spatial_index_resync( &((*fix).testee) );
+    TEST_EXPECT( layout_spatial_index_is_valid( &((*fix).testee) ) );
+
+    /* check positions inside and outside of the diagram bounds */
+    for ( uint32_t probe = 0; probe < 2000; probe ++ )
+    {
+        const double x = next_random( -100.0, 900.0 );
+        const double y = next_random( -100.0, 700.0 );
+        const test_case_result_t probe_result = check_pos( &((*fix).testee), x, y, 5.0 );
+        TEST_EXPECT_EQUAL_INT( TEST_CASE_RESULT_OK, probe_result );
+    }
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_large_elements( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    /* elements spanning the whole diagram do not fit into LAYOUT_SPATIAL_INDEX_MAX_CELLS_PER_ITEM cells */
+    init_fake_geometry( &((*fix).layout_data), 2000.0 );
+    layout_spatial_index_resync( &((*fix).testee) );
+    TEST_EXPECT( layout_spatial_index_is_valid( &((*fix).testee) ) );
+
+    for ( uint32_t probe = 0; probe < 500; probe ++ )
+    {
+        const double x = next_random( -100.0, 900.0 );
+        const double y = next_random( -100.0, 700.0 );
+        const test_case_result_t probe_result = check_pos( &((*fix).testee), x, y, 0.0 );
+        TEST_EXPECT_EQUAL_INT( TEST_CASE_RESULT_OK, probe_result );
+    }
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t check_pos( const layout_spatial_index_t *index, double x, double y, double snap_distance )
+{
+    const layout_visible_set_t *const layout_data = &(test_fixture.layout_data);
+    static bool is_candidate[LAYOUT_SPATIAL_ITER_MAX_ITEMS];
+    layout_spatial_iter_t candidates;
+
+    /* classifiers */
+    memset( &is_candidate, 0, sizeof(is_candidate) );
+    layout_spatial_index_query_pos( index, LAYOUT_SPATIAL_INDEX_KIND_CLASSIFIER, x, y, 0.0, &candidates );
+    uint32_t min_next = 0;
+    while ( layout_spatial_iter_has_next( &candidates ) )
+    {
+        /* candidates are ascending */
+        const uint32_t c_idx = layout_spatial_iter_next( &candidates );
+        TEST_EXPECT( c_idx >= min_next );
+        is_candidate[c_idx] = true;
+        min_next = c_idx + 1;
+    }
+    layout_spatial_iter_destroy( &candidates );
+    const uint32_t c_count = layout_visible_set_get_visible_classifier_count( layout_data );
+    for ( uint32_t c_idx = 0; c_idx < c_count; c_idx ++ )
+    {
+        const layout_visible_classifier_t *const classifier = layout_visible_set_get_visible_classifier_const( layout_data, c_idx );
+        const bool hit = geometry_rectangle_contains( layout_visible_classifier_get_symbol_box_const( classifier ), x, y )
+            || geometry_rectangle_contains( layout_visible_classifier_get_label_box_const( classifier ), x, y );
+        TEST_EXPECT( is_candidate[c_idx] || ( ! hit ) );
+    }
+
+    /* features */
+    memset( &is_candidate, 0, sizeof(is_candidate) );
+    layout_spatial_index_query_pos( index, LAYOUT_SPATIAL_INDEX_KIND_FEATURE, x, y, 0.0, &candidates );
+    while ( layout_spatial_iter_has_next( &candidates ) )
+    {
+        is_candidate[layout_spatial_iter_next( &candidates )] = true;
+    }
+    layout_spatial_iter_destroy( &candidates );
+    const uint32_t f_count = layout_visible_set_get_feature_count( layout_data );
+    for ( uint32_t f_idx = 0; f_idx < f_count; f_idx ++ )
+    {
+        const layout_feature_t *const feature = layout_visible_set_get_feature_const( layout_data, f_idx );
+        const bool hit = geometry_rectangle_contains( layout_feature_get_symbol_box_const( feature ), x, y )
+            || geometry_rectangle_contains( layout_feature_get_label_box_const( feature ), x, y );
+        TEST_EXPECT( is_candidate[f_idx] || ( ! hit ) );
+    }
+
+    /* relationships */
+    memset( &is_candidate, 0, sizeof(is_candidate) );
+    layout_spatial_index_query_pos( index, LAYOUT_SPATIAL_INDEX_KIND_RELATIONSHIP, x, y, snap_distance, &candidates );
+    while ( layout_spatial_iter_has_next( &candidates ) )
+    {
+        is_candidate[layout_spatial_iter_next( &candidates )] = true;
+    }
+    layout_spatial_iter_destroy( &candidates );
+    const uint32_t r_count = layout_visible_set_get_relationship_count( layout_data );
+    for ( uint32_t r_idx = 0; r_idx < r_count; r_idx ++ )
+    {
+        const layout_relationship_t *const relationship = layout_visible_set_get_relationship_const( layout_data, r_idx );
+        const bool hit = geometry_connector_is_close( layout_relationship_get_shape_const( relationship ), x, y, snap_distance )
+            || geometry_rectangle_contains( layout_relationship_get_label_box_const( relationship ), x, y );
+        TEST_EXPECT( is_candidate[r_idx] || ( ! hit ) );
+    }
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static void init_fake_geometry( layout_visible_set_t *layout_data, double max_size )
+{
+    geometry_rectangle_t bounds;
+    geometry_rectangle_init( &bounds, 0.0, 0.0, 800.0, 600.0 );
+    layout_diagram_set_bounds( layout_visible_set_get_diagram_ptr( layout_data ), &bounds );
+
+    geometry_rectangle_t box;
+    const uint32_t c_count = layout_visible_set_get_visible_classifier_count( layout_data );
+    for ( uint32_t c_idx = 0; c_idx < c_count; c_idx ++ )
+    {
+        layout_visible_classifier_t *const classifier = layout_visible_set_get_visible_classifier_ptr( layout_data, c_idx );
+        geometry_rectangle_init( &box, next_random( -50.0, 800.0 ), next_random( -50.0, 600.0 ), next_random( 0.0, max_size ), next_random( 0.0, max_size ) );
+        layout_visible_classifier_set_symbol_box( classifier, &box );
+        geometry_rectangle_init( &box, next_random( -50.0, 800.0 ), next_random( -50.0, 600.0 ), next_random( 0.0, 50.0 ), 12.0 );
+        layout_visible_classifier_set_label_box( classifier, &box );
+    }
+
+    const uint32_t f_count = layout_visible_set_get_feature_count( layout_data );
+    for ( uint32_t f_idx = 0; f_idx < f_count; f_idx ++ )
+    {
+        layout_feature_t *const feature = layout_visible_set_get_feature_ptr( layout_data, f_idx );
+        geometry_rectangle_init( &box, next_random( -50.0, 800.0 ), next_random( -50.0, 600.0 ), next_random( 0.0, max_size ), 12.0 );
+        layout_feature_set_symbol_box( feature, &box );
+        geometry_rectangle_init( &box, next_random( -50.0, 800.0 ), next_random( -50.0, 600.0 ), 30.0, 12.0 );
+        layout_feature_set_label_box( feature, &box );
+    }
+
+    const uint32_t r_count = layout_visible_set_get_relationship_count( layout_data );
+    for ( uint32_t r_idx = 0; r_idx < r_count; r_idx ++ )
+    {
+        layout_relationship_t *const relationship = layout_visible_set_get_relationship_ptr( layout_data, r_idx );
+        geometry_connector_t shape;
+        const double source_x = next_random( -50.0, 850.0 );
+        const double source_y = next_random( -50.0, 650.0 );
+        geometry_connector_init_vertical( &shape,
+                                          source_x,
+                                          source_y,
+                                          source_x + next_random( -max_size, max_size ),
+                                          source_y + next_random( -max_size, max_size ),
+                                          source_x + next_random( -max_size, max_size )
+                                        );
+        layout_relationship_set_shape( relationship, &shape );
+        geometry_connector_destroy( &shape );
+        geometry_rectangle_init( &box, next_random( -50.0, 800.0 ), next_random( -50.0, 600.0 ), 40.0, 12.0 );
+        layout_relationship_set_label_box( relationship, &box );
+    }
+
+    geometry_rectangle_destroy( &box );
+    geometry_rectangle_destroy( &bounds );
+}
+
+static double next_random( double min, double max )
+{
+    /* linear congruential generator, reproducible on all platforms */
+    test_fixture.random_state = test_fixture.random_state * 1103515245 + 12345;
+    const double unit = ( ( test_fixture.random_state >> 8 ) & 0xffff ) / 65536.0;
+    return min + unit * ( max - min );
+}
+
+static data_visible_set_t* init_fake_input_data( uint_fast32_t classifiers, uint_fast32_t features, uint_fast32_t relationships )
+{
+    u8_error_t data_err;
+    static data_visible_set_t fake_input_data;
+    data_visible_set_init( &fake_input_data );
+
+    data_err = data_diagram_init( &(fake_input_data.diagram),
+                                  3,  /* diagram_id */
+                                  DATA_ROW_VOID,  /* parent_diagram_id */
+                                  DATA_DIAGRAM_TYPE_UML_CLASS_DIAGRAM,  /* diagram_type */
+                                  "",  /* stereotype */
+                                  "diagram_name",
+                                  "diagram_description",
+                                  32000,  /* list_order */
+                                  DATA_DIAGRAM_FLAG_NONE,
+                                  "2b4a2f94-1b49-4ab6-a0a1-8e2e1b5a1d71"
+                                );
+    TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+
+    for ( uint_fast32_t c_idx = 0; c_idx < classifiers; c_idx ++ )
+    {
+        data_visible_classifier_t current;
+        data_visible_classifier_init_empty ( &current );
+        data_err = data_classifier_init( data_visible_classifier_get_classifier_ptr ( &current ),
+                                         c_idx,  /* id */
+                                         DATA_CLASSIFIER_TYPE_CLASS,  /* main_type */
+                                         "",  /* stereotype */
+                                         "name",
+                                         "description",
+                                         1000*c_idx,  /* x_order */
+                                         -300*c_idx,  /* y_order */
+                                         4000*c_idx,  /* list_order */
+                                         "6b1b9a0c-7f2f-4b4e-9c1e-f30c02b8a3c5"
+                                       );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_err = data_diagramelement_init( data_visible_classifier_get_diagramelement_ptr ( &current ),
+                                             c_idx,  /* id */
+                                             3,  /* diagram_id */
+                                             c_idx,  /* classifier_id */
+                                             DATA_DIAGRAMELEMENT_FLAG_NONE,  /* display_flags */
+                                             DATA_ROW_VOID,  /* focused_feature_id */
+                                             "7c0d54f6-34a4-4b9e-9f4f-7e7b7c3f0d11"
+                                           );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_err = data_visible_set_append_classifier( &fake_input_data, &current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_visible_classifier_destroy( &current );
+    }
+
+    for ( uint_fast32_t f_idx = 0; f_idx < features; f_idx ++ )
+    {
+        data_feature_t current;
+        data_err = data_feature_init( &current,
+                                      f_idx,  /* feature_id */
+                                      DATA_FEATURE_TYPE_OPERATION,  /* feature_main_type */
+                                      f_idx % classifiers,  /* classifier_id */
+                                      "feature_key",
+                                      "feature_value",
+                                      "feature_description",
+                                      6000*f_idx,  /* list_order */
+                                      "5d0f1c4e-2a3b-4c5d-8e9f-0a1b2c3d4e5f"
+                                    );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_err = data_visible_set_append_feature( &fake_input_data, &current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_feature_destroy( &current );
+    }
+
+    for ( uint_fast32_t r_idx = 0; r_idx < relationships; r_idx ++ )
+    {
+        data_relationship_t current;
+        data_err = data_relationship_init( &current,
+                                           r_idx,  /* relationship_id */
+                                           r_idx % classifiers,  /* from_classifier_id */
+                                           DATA_ROW_VOID,  /* from_feature_id */
+                                           (r_idx*r_idx) % classifiers,  /* to_classifier_id */
+                                           DATA_ROW_VOID,  /* to_feature_id */
+                                           DATA_RELATIONSHIP_TYPE_UML_ASSOCIATION,  /* relationship_main_type */
+                                           "",  /* stereotype */
+                                           "relationship_name",
+                                           "relationship_description",
+                                           1500*r_idx,  /* list_order */
+                                           "8a9b0c1d-2e3f-4a5b-8c7d-9e0f1a2b3c4d"
+                                         );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_err = data_visible_set_append_relationship( &fake_input_data, &current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_relationship_destroy( &current );
+    }
+
+    data_visible_set_update_containment_cache ( &fake_input_data );
+    TEST_ENVIRONMENT_ASSERT ( data_visible_set_is_valid ( &fake_input_data ) );
+    return &fake_input_data;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
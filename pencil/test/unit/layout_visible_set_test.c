@@ -77,10 +77,10 @@ static data_visible_set_t* init_fake_input_data( uint_fast32_t classifiers, uint
     }
 
     /* initialize the fake_input_data.visible_classifiers */
-    fake_input_data.visible_classifier_count = classifiers;
     for ( uint_fast32_t c_idx = 0; c_idx < classifiers; c_idx ++ )
     {
-        data_visible_classifier_t *current = &(fake_input_data.visible_classifiers[c_idx]);
+        data_visible_classifier_t current_buf;
+        data_visible_classifier_t *current = &current_buf;
 
         data_visible_classifier_init_empty ( current );
 
@@ -111,15 +111,18 @@ static data_visible_set_t* init_fake_input_data( uint_fast32_t classifiers, uint
         TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
 
         TEST_ENVIRONMENT_ASSERT( data_visible_classifier_is_valid( current ) );
+        data_err = data_visible_set_append_classifier( &fake_input_data, current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_visible_classifier_destroy( current );
     }
 
     const uint_fast32_t classifier_mod = ((classifiers/2)==0) ? 1 : (classifiers/2);
 
     /* initialize the fake_input_data.features */
-    fake_input_data.feature_count = features;
     for ( uint_fast32_t f_idx = 0; f_idx < features; f_idx ++ )
     {
-        data_feature_t *current = &(fake_input_data.features[f_idx]);
+        data_feature_t current_buf;
+        data_feature_t *current = &current_buf;
 
         data_err = data_feature_init( current,
                                       f_idx,  /* feature_id */
@@ -134,13 +137,16 @@ static data_visible_set_t* init_fake_input_data( uint_fast32_t classifiers, uint
         TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
 
         TEST_ENVIRONMENT_ASSERT( data_feature_is_valid( current ) );
+        data_err = data_visible_set_append_feature( &fake_input_data, current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_feature_destroy( current );
     }
 
     /* initialize the fake_input_data.relationships */
-    fake_input_data.relationship_count = relationships;
     for ( uint_fast32_t r_idx = 0; r_idx < relationships; r_idx ++ )
     {
-        data_relationship_t *current = &(fake_input_data.relationships[r_idx]);
+        data_relationship_t current_buf;
+        data_relationship_t *current = &current_buf;
 
         data_err = data_relationship_init( current,
                                            r_idx,  /* relationship_id */
@@ -158,6 +164,9 @@ static data_visible_set_t* init_fake_input_data( uint_fast32_t classifiers, uint
         TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
 
         TEST_ENVIRONMENT_ASSERT( data_relationship_is_valid( current ) );
+        data_err = data_visible_set_append_relationship( &fake_input_data, current );
+        TEST_ENVIRONMENT_ASSERT( data_err == U8_ERROR_NONE );
+        data_relationship_destroy( current );
     }
 
     data_visible_set_update_containment_cache ( &fake_input_data );
@@ -195,6 +204,8 @@ static test_case_result_t test_empty_model( test_fixture_t *fix )
     TEST_EXPECT ( layout_visible_set_is_consistent( &testee ) );
 
     layout_visible_set_destroy( &testee );
+    data_visible_set_destroy( fake_input_data );
+    data_visible_set_destroy( empty_input_data );
     return TEST_CASE_RESULT_OK;
 }
 
@@ -216,6 +227,7 @@ static test_case_result_t test_normal_model( test_fixture_t *fix )
     TEST_EXPECT ( layout_visible_set_is_consistent( &testee ) );
 
     layout_visible_set_destroy( &testee );
+    data_visible_set_destroy( fake_input_data );
     return TEST_CASE_RESULT_OK;
 }
 
@@ -236,6 +248,7 @@ static test_case_result_t test_too_big_model( test_fixture_t *fix )
     TEST_EXPECT ( layout_visible_set_is_consistent( &testee ) );
 
     layout_visible_set_destroy( &testee );
+    data_visible_set_destroy( fake_input_data );
     return TEST_CASE_RESULT_OK;
 }
 
@@ -263,6 +276,7 @@ static test_case_result_t test_inconsistent_model( test_fixture_t *fix )
     TEST_EXPECT ( layout_visible_set_is_consistent( &testee ) );
 
     layout_visible_set_destroy( &testee );
+    data_visible_set_destroy( fake_input_data );
     return TEST_CASE_RESULT_OK;
 }
 
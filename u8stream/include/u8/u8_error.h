@@ -84,6 +84,8 @@ enum u8_error_enum {
     /* section U8_ERROR_CAT_USE_MODE */
     U8_ERROR_NO_DB                  = U8_ERROR_CAT_USE_MODE      + U8_ERROR_ORIG_SYNC + 0x01,
                                       /*!< database not open/loaded */
+    U8_ERROR_CANCELLED              = U8_ERROR_CAT_USE_MODE      + U8_ERROR_ORIG_SYNC + 0x02,
+                                      /*!< the operation was cancelled on request */
     U8_ERROR_OBJECT_STILL_REFERENCED = U8_ERROR_CAT_USE_MODE     + U8_ERROR_ORIG_DATA + 0x01,
                                       /*!< object cannot be deleted, it is still referenced */
     U8_ERROR_DIAGRAM_HIDES_RELATIONSHIPS = U8_ERROR_CAT_USE_MODE + U8_ERROR_ORIG_DATA + 0x02,
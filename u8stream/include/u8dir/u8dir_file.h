@@ -32,6 +32,16 @@ typedef const char * u8dir_file_t;
  */
 u8_error_t u8dir_file_remove( u8dir_file_t this_ );
 
+/*!
+ *  \brief renames (moves) the file, replacing a file at the new path if there is one
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param new_path the new path of the file, in the same file system
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_AT_FILE_WRITE otherwise
+ */
+u8_error_t u8dir_file_rename( u8dir_file_t this_, u8dir_file_t new_path );
+
 /*!
  *  \brief checks if the path denotes a regular file
  *
@@ -7,6 +7,9 @@
 /*!
  *  \file
  *  \brief Sorts array indexes by a sorting criteria (weight) ascending
+ *
+ *  Entries can either be inserted one by one into the sorted list
+ *  or be appended unsorted and then sorted once.
  */
 
 #include "u8/u8_error.h"
@@ -14,10 +17,10 @@
 #include <stdbool.h>
 
 /*!
- *  \brief constants for maximum values of universal_array_index_sorter_t
+ *  \brief constants of universal_array_index_sorter_t
  */
-enum universal_array_index_sorter_max_enum {
-    UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE = 2048,  /*!< maximum number of indices to sort */
+enum universal_array_index_sorter_const_enum {
+    UNIVERSAL_ARRAY_INDEX_SORTER_INITIAL_CAPACITY = 64,  /*!< number of entries allocated on the first insert or append */
 };
 
 /*!
@@ -28,13 +31,19 @@ enum universal_array_index_sorter_max_enum {
  *  Instead, the universal_array_index_sorter_t keeps a list of indices into that array of data elements.
  *  The list of indices is sorted accorting to a weight criteria.
  *
+ *  The entries, weights and the merge buffer of universal_array_index_sorter_sort() are allocated from the heap
+ *  and grow on demand; call universal_array_index_sorter_destroy() to free them.
+ *
  *  To facilitate the usage of this class, consider to implement a type-specific wrapper
  *  around this class, \see layout_feature_iter_t .
  */
 struct universal_array_index_sorter_struct {
     uint32_t entries_count;  /*!< number of all contained array indices */
-    uint32_t entries[UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE];  /*!< all contained array indices */
-    int64_t weights[UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE];  /*!< weights of entries */
+    uint32_t entries_capacity;  /*!< number of allocated elements in entries and weights */
+    uint32_t *entries;  /*!< all contained array indices, heap allocated, NULL if entries_capacity is 0 */
+    int64_t *weights;  /*!< weights of entries, heap allocated, NULL if entries_capacity is 0 */
+    uint32_t order_capacity;  /*!< number of allocated elements in each half of order_buf */
+    uint32_t *order_buf;  /*!< merge buffer of universal_array_index_sorter_sort: two halves of order_capacity positions */
 };
 
 typedef struct universal_array_index_sorter_struct universal_array_index_sorter_t;
@@ -49,12 +58,14 @@ static inline void universal_array_index_sorter_init( universal_array_index_sort
 /*!
  *  \brief re-initializes the universal_array_index_sorter_t
  *
+ *  The list is emptied, the allocated memory is kept for re-use.
+ *
  *  \param this_ pointer to own object attributes
  */
 static inline void universal_array_index_sorter_reinit( universal_array_index_sorter_t *this_ );
 
 /*!
- *  \brief destroys the universal_array_index_sorter_t
+ *  \brief destroys the universal_array_index_sorter_t and frees the allocated memory
  *
  *  \param this_ pointer to own object attributes
  */
@@ -66,13 +77,41 @@ static inline void universal_array_index_sorter_destroy( universal_array_index_s
  *  \param this_ pointer to own object attributes
  *  \param array_index index of data within an external, unknown array
  *  \param weight weight of the array-entry by which to sort
- *  \return U8_ERROR_ARRAY_BUFFER_EXCEEDED in case the list is full, U8_ERROR_NONE in case of success
+ *  \return U8_ERROR_ARRAY_BUFFER_EXCEEDED in case the list cannot grow (out of memory), U8_ERROR_NONE in case of success
  */
 static inline u8_error_t universal_array_index_sorter_insert( universal_array_index_sorter_t *this_,
                                                               uint32_t array_index,
                                                               int64_t weight
                                                             );
 
+/*!
+ *  \brief appends an entry to the end of the index-list without sorting
+ *
+ *  Call universal_array_index_sorter_sort() after the last append
+ *  and before universal_array_index_sorter_get_array_index() or universal_array_index_sorter_insert().
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param array_index index of data within an external, unknown array
+ *  \param weight weight of the array-entry by which to sort
+ *  \return U8_ERROR_ARRAY_BUFFER_EXCEEDED in case the list cannot grow (out of memory), U8_ERROR_NONE in case of success
+ */
+static inline u8_error_t universal_array_index_sorter_append( universal_array_index_sorter_t *this_,
+                                                              uint32_t array_index,
+                                                              int64_t weight
+                                                            );
+
+/*!
+ *  \brief sorts the index-list by weight ascending
+ *
+ *  The sort is stable (a bottom-up merge sort): entries of equal weight keep their order.
+ *  Therefore appending all entries and sorting once results in the same list
+ *  as inserting the entries one by one, but needs O(n*log(n)) instead of O(n*n) steps.
+ *  If the merge buffer cannot be allocated, the list is sorted in place by a stable insertion sort instead.
+ *
+ *  \param this_ pointer to own object attributes
+ */
+static inline void universal_array_index_sorter_sort( universal_array_index_sorter_t *this_ );
+
 /*!
  *  \brief gets the current list length
  *
@@ -86,12 +125,20 @@ static inline uint32_t universal_array_index_sorter_get_count( const universal_a
  *
  *  \param this_ pointer to own object attributes
  *  \param sort_index index in the sorted internal array of external array-indexes
- *  \return array index in the external, unsorted data array
+ *  \return array index in the external, unsorted data array, UINT32_MAX if sort_index is out of range
  */
 static inline uint32_t universal_array_index_sorter_get_array_index( const universal_array_index_sorter_t *this_,
                                                                      uint32_t sort_index
                                                                    );
 
+/*!
+ *  \brief ensures that there is space for one more entry, grows entries and weights if needed
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_ARRAY_BUFFER_EXCEEDED if no memory is available, U8_ERROR_NONE in case of success
+ */
+static inline u8_error_t universal_array_index_sorter_private_reserve( universal_array_index_sorter_t *this_ );
+
 #include "u8list/universal_array_index_sorter.inl"
 
 #endif  /* UNIVERSAL_ARRAY_INDEX_SORTER_H */
@@ -2,10 +2,16 @@
 
 #include "u8/u8_log.h"
 #include <assert.h>
+#include <stdlib.h>
 
 static inline void universal_array_index_sorter_init( universal_array_index_sorter_t *this_ )
 {
     (*this_).entries_count = 0;
+    (*this_).entries_capacity = 0;
+    (*this_).entries = NULL;
+    (*this_).weights = NULL;
+    (*this_).order_capacity = 0;
+    (*this_).order_buf = NULL;
 }
 
 static inline void universal_array_index_sorter_reinit( universal_array_index_sorter_t *this_ )
@@ -15,15 +21,65 @@ static inline void universal_array_index_sorter_reinit( universal_array_index_so
 
 static inline void universal_array_index_sorter_destroy( universal_array_index_sorter_t *this_ )
 {
+    free( (*this_).entries );
+    free( (*this_).weights );
+    free( (*this_).order_buf );
+    (*this_).entries_count = 0;
+    (*this_).entries_capacity = 0;
+    (*this_).entries = NULL;
+    (*this_).weights = NULL;
+    (*this_).order_capacity = 0;
+    (*this_).order_buf = NULL;
+}
+
+static inline u8_error_t universal_array_index_sorter_private_reserve( universal_array_index_sorter_t *this_ )
+{
+    assert( (*this_).entries_count <= (*this_).entries_capacity );
+    u8_error_t result = U8_ERROR_NONE;
+    if ( (*this_).entries_count == (*this_).entries_capacity )
+    {
+        const uint32_t old_capacity = (*this_).entries_capacity;
+        const uint32_t new_capacity
+            = ( old_capacity == 0 )
+            ? UNIVERSAL_ARRAY_INDEX_SORTER_INITIAL_CAPACITY
+            : ( old_capacity <= ( UINT32_MAX / 2 ) ) ? ( old_capacity * 2 ) : UINT32_MAX;
+        if (( new_capacity == old_capacity )||( new_capacity > ( SIZE_MAX / sizeof(int64_t) ) ))
+        {
+            result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+        }
+        else
+        {
+            /* entries and weights are plain integers, realloc may move them */
+            uint32_t *const new_entries = realloc( (*this_).entries, new_capacity * sizeof(uint32_t) );
+            if ( new_entries != NULL )
+            {
+                (*this_).entries = new_entries;
+            }
+            int64_t *const new_weights = realloc( (*this_).weights, new_capacity * sizeof(int64_t) );
+            if ( new_weights != NULL )
+            {
+                (*this_).weights = new_weights;
+            }
+            if (( new_entries != NULL )&&( new_weights != NULL ))
+            {
+                (*this_).entries_capacity = new_capacity;
+            }
+            else
+            {
+                U8_LOG_ERROR_INT( "universal_array_index_sorter_t cannot grow to", new_capacity );
+                result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+            }
+        }
+    }
+    return result;
 }
 
 static inline u8_error_t universal_array_index_sorter_insert( universal_array_index_sorter_t *this_,
                                                               uint32_t array_index,
                                                               int64_t weight )
 {
-    assert( (*this_).entries_count <= UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE );
-    u8_error_t result;
-    if ( (*this_).entries_count < UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE )
+    u8_error_t result = universal_array_index_sorter_private_reserve( this_ );
+    if ( result == U8_ERROR_NONE )
     {
         bool already_inserted = false;
         for ( uint32_t sorted_index = (*this_).entries_count; (sorted_index > 0) && ( ! already_inserted ); sorted_index -- )
@@ -48,15 +104,123 @@ static inline u8_error_t universal_array_index_sorter_insert( universal_array_in
             (*this_).weights[0] = weight;
         }
         (*this_).entries_count ++;
-        result = U8_ERROR_NONE;
     }
-    else
+    return result;
+}
+
+static inline u8_error_t universal_array_index_sorter_append( universal_array_index_sorter_t *this_,
+                                                              uint32_t array_index,
+                                                              int64_t weight )
+{
+    u8_error_t result = universal_array_index_sorter_private_reserve( this_ );
+    if ( result == U8_ERROR_NONE )
     {
-        result = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+        (*this_).entries[(*this_).entries_count] = array_index;
+        (*this_).weights[(*this_).entries_count] = weight;
+        (*this_).entries_count ++;
     }
     return result;
 }
 
+static inline void universal_array_index_sorter_sort( universal_array_index_sorter_t *this_ )
+{
+    assert( (*this_).entries_count <= (*this_).entries_capacity );
+    const uint32_t count = (*this_).entries_count;
+
+    /* nothing to do if already sorted, e.g. if filled by universal_array_index_sorter_insert */
+    bool sorted = true;
+    for ( uint32_t index = 1; ( index < count ) && sorted; index ++ )
+    {
+        sorted = ( (*this_).weights[index-1] <= (*this_).weights[index] );
+    }
+
+    /* the merge buffer holds two permutations of count positions, it is kept for the next sort */
+    if (( ! sorted )&&( (*this_).order_capacity < count ))
+    {
+        uint32_t *const new_order_buf = ( count <= ( SIZE_MAX / ( 2 * sizeof(uint32_t) ) ) )
+            ? realloc( (*this_).order_buf, 2 * (size_t) count * sizeof(uint32_t) )
+            : NULL;
+        if ( new_order_buf != NULL )
+        {
+            (*this_).order_buf = new_order_buf;
+            (*this_).order_capacity = count;
+        }
+    }
+
+    if (( ! sorted )&&( (*this_).order_capacity < count ))
+    {
+        /* no merge buffer available: stable insertion sort in place */
+        U8_LOG_WARNING_INT( "universal_array_index_sorter_t falls back to insertion sort, count:", count );
+        for ( uint32_t index = 1; index < count; index ++ )
+        {
+            const uint32_t entry = (*this_).entries[index];
+            const int64_t weight = (*this_).weights[index];
+            uint32_t pos = index;
+            while (( pos > 0 )&&( weight < (*this_).weights[pos-1] ))
+            {
+                (*this_).entries[pos] = (*this_).entries[pos-1];
+                (*this_).weights[pos] = (*this_).weights[pos-1];
+                pos --;
+            }
+            (*this_).entries[pos] = entry;
+            (*this_).weights[pos] = weight;
+        }
+    }
+    else if ( ! sorted )
+    {
+        /* merge-sort a permutation of positions, the entries and weights are moved only once afterwards */
+        uint32_t *src = &((*this_).order_buf[0]);
+        uint32_t *dst = &((*this_).order_buf[(*this_).order_capacity]);
+        for ( uint32_t index = 0; index < count; index ++ )
+        {
+            src[index] = index;
+        }
+        for ( uint32_t width = 1; width < count; width *= 2 )
+        {
+            for ( uint32_t left = 0; left < count; left += 2 * width )
+            {
+                const uint32_t mid = ( left + width < count ) ? ( left + width ) : count;
+                const uint32_t right = ( left + 2 * width < count ) ? ( left + 2 * width ) : count;
+                uint32_t l_pos = left;
+                uint32_t r_pos = mid;
+                for ( uint32_t d_pos = left; d_pos < right; d_pos ++ )
+                {
+                    /* take from the left run on equal weights to keep the sort stable */
+                    const bool take_left
+                        = ( l_pos < mid )
+                        && (( r_pos >= right ) || ( (*this_).weights[src[l_pos]] <= (*this_).weights[src[r_pos]] ));
+                    dst[d_pos] = take_left ? src[l_pos++] : src[r_pos++];
+                }
+            }
+            uint32_t *const swap = src;
+            src = dst;
+            dst = swap;
+        }
+
+        /* apply the permutation in place: src[pos] is the old position of the entry that belongs to pos */
+        for ( uint32_t start = 0; start < count; start ++ )
+        {
+            if ( src[start] != start )
+            {
+                const uint32_t start_entry = (*this_).entries[start];
+                const int64_t start_weight = (*this_).weights[start];
+                uint32_t pos = start;
+                while ( src[pos] != start )
+                {
+                    const uint32_t from = src[pos];
+                    (*this_).entries[pos] = (*this_).entries[from];
+                    (*this_).weights[pos] = (*this_).weights[from];
+                    src[pos] = pos;
+                    pos = from;
+                }
+                (*this_).entries[pos] = start_entry;
+                (*this_).weights[pos] = start_weight;
+                src[pos] = pos;
+            }
+        }
+    }
+}
+
 static inline uint32_t universal_array_index_sorter_get_count( const universal_array_index_sorter_t *this_ )
 {
     return (*this_).entries_count;
@@ -64,9 +228,10 @@ static inline uint32_t universal_array_index_sorter_get_count( const universal_a
 
 static inline uint32_t universal_array_index_sorter_get_array_index( const universal_array_index_sorter_t *this_, uint32_t sort_index )
 {
-    assert( (*this_).entries_count <= UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE );
+    assert( (*this_).entries_count <= (*this_).entries_capacity );
     assert( sort_index <= (*this_).entries_count );
-    return (*this_).entries[sort_index];
+    /* the entry after the last one is not allocated if the list is empty or has reached its capacity */
+    return ( sort_index < (*this_).entries_count ) ? (*this_).entries[sort_index] : UINT32_MAX;
 }
 
 
@@ -7,16 +7,22 @@
 /*!
  *  \file
  *  \brief implements an universal_input_stream and buffers data in a fixed-sized memory buffer
+ *
+ *  If the source provides its bytes as one memory region (see universal_input_stream_take_region),
+ *  the region is read in place and the own buffer is not used.
  */
 
 #include "u8stream/universal_input_stream.h"
+#include <stdbool.h>
 
 /*!
  *  \brief attributes of the universal_buffer_input_stream
  */
 struct universal_buffer_input_stream_struct {
     universal_input_stream_t input_stream;  /*!< instance of implemented interface \c universal_input_stream_t */
-    void* mem_buf_start;  /*!< input memory buffer start */
+    void* own_buf_start;  /*!< own memory buffer start, filled from the source */
+    size_t own_buf_size;  /*!< own memory buffer size */
+    const void* mem_buf_start;  /*!< input memory buffer start, either the own buffer or the region of the source */
     size_t mem_buf_size;  /*!< input memory buffer size */
     size_t mem_buf_fill;  /*!< input memory buffer: amount of valid, read bytes */
     size_t mem_buf_pos;  /*!< read position in the input memory buffer */
@@ -85,6 +91,36 @@ static inline char universal_buffer_input_stream_peek_next ( universal_buffer_in
  */
 static inline char universal_buffer_input_stream_read_next ( universal_buffer_input_stream_t *this_ );
 
+/*!
+ *  \brief gets the bytes that are already buffered, starting at the read position, without reading from the source
+ *
+ *  The returned pointer is valid until the next read or peek operation.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param out_length number of buffered bytes, 0 if the buffer is empty
+ *  \return pointer to the next byte in the buffer
+ */
+static inline const char* universal_buffer_input_stream_peek_buffered ( universal_buffer_input_stream_t *this_, size_t *out_length );
+
+/*!
+ *  \brief moves the read position forward within the already buffered bytes
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param count number of bytes to skip, must not exceed the length returned by universal_buffer_input_stream_peek_buffered
+ */
+static inline void universal_buffer_input_stream_skip_buffered ( universal_buffer_input_stream_t *this_, size_t count );
+
+/*!
+ *  \brief checks if the buffered bytes are a region of the source
+ *
+ *  In this case, pointers returned by universal_buffer_input_stream_peek_buffered stay valid
+ *  as long as the source is not closed.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return true if the buffered bytes are read in place, false if they are a copy in the own buffer
+ */
+static inline bool universal_buffer_input_stream_is_in_place ( const universal_buffer_input_stream_t *this_ );
+
 /*!
  *  \brief returns the current read position
  *
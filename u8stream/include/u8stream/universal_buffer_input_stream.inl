@@ -14,18 +14,20 @@ static inline char universal_buffer_input_stream_peek_next( universal_buffer_inp
     {
         /* try to fill buffer */
         (*this_).stream_pos_of_buf += (*this_).mem_buf_fill;
+        (*this_).mem_buf_start = (*this_).own_buf_start;
+        (*this_).mem_buf_size = (*this_).own_buf_size;
         (*this_).mem_buf_pos = 0;
         (*this_).mem_buf_fill = 0;
         const int err
-            = universal_input_stream_read( (*this_).source, (*this_).mem_buf_start, (*this_).mem_buf_size, &((*this_).mem_buf_fill) );
+            = universal_input_stream_read( (*this_).source, (*this_).own_buf_start, (*this_).own_buf_size, &((*this_).mem_buf_fill) );
         if (( 0 == err )&&( (*this_).mem_buf_fill > 0 ))
         {
-            result = (*(  (char(*)[]) (*this_).mem_buf_start  ))[0];
+            result = (*(  (const char(*)[]) (*this_).mem_buf_start  ))[0];
         }
     }
     else
     {
-        result = (*(  (char(*)[]) (*this_).mem_buf_start  ))[(*this_).mem_buf_pos];
+        result = (*(  (const char(*)[]) (*this_).mem_buf_start  ))[(*this_).mem_buf_pos];
     }
 
     return result;
@@ -43,25 +45,47 @@ static inline char universal_buffer_input_stream_read_next( universal_buffer_inp
     {
         /* try to fill buffer */
         (*this_).stream_pos_of_buf += (*this_).mem_buf_fill;
+        (*this_).mem_buf_start = (*this_).own_buf_start;
+        (*this_).mem_buf_size = (*this_).own_buf_size;
         (*this_).mem_buf_pos = 0;
         (*this_).mem_buf_fill = 0;
         const int err
-            = universal_input_stream_read( (*this_).source, (*this_).mem_buf_start, (*this_).mem_buf_size, &((*this_).mem_buf_fill) );
+            = universal_input_stream_read( (*this_).source, (*this_).own_buf_start, (*this_).own_buf_size, &((*this_).mem_buf_fill) );
         if (( 0 == err )&&( (*this_).mem_buf_fill > 0 ))
         {
-            result = (*(  (char(*)[]) (*this_).mem_buf_start  ))[0];
+            result = (*(  (const char(*)[]) (*this_).mem_buf_start  ))[0];
             (*this_).mem_buf_pos = 1;
         }
     }
     else
     {
-        result = (*(  (char(*)[]) (*this_).mem_buf_start  ))[(*this_).mem_buf_pos];
+        result = (*(  (const char(*)[]) (*this_).mem_buf_start  ))[(*this_).mem_buf_pos];
         (*this_).mem_buf_pos ++;
     }
 
     return result;
 }
 
+static inline const char* universal_buffer_input_stream_peek_buffered ( universal_buffer_input_stream_t *this_, size_t *out_length )
+{
+    assert( (*this_).mem_buf_start != NULL );
+    assert( (*this_).mem_buf_fill >= (*this_).mem_buf_pos );
+    assert( out_length != NULL );
+    *out_length = (*this_).mem_buf_fill - (*this_).mem_buf_pos;
+    return &(  (*(  (const char(*)[]) (*this_).mem_buf_start  ))[(*this_).mem_buf_pos]  );
+}
+
+static inline void universal_buffer_input_stream_skip_buffered ( universal_buffer_input_stream_t *this_, size_t count )
+{
+    assert( (*this_).mem_buf_fill >= (*this_).mem_buf_pos + count );
+    (*this_).mem_buf_pos += count;
+}
+
+static inline bool universal_buffer_input_stream_is_in_place ( const universal_buffer_input_stream_t *this_ )
+{
+    return ( (*this_).mem_buf_start != (*this_).own_buf_start );
+}
+
 static inline size_t universal_buffer_input_stream_read_pos ( universal_buffer_input_stream_t *this_ )
 {
     return (*this_).stream_pos_of_buf + (*this_).mem_buf_pos;
@@ -1,15 +1,20 @@
 /* File: universal_buffer_output_stream.h; Copyright and License: see below */
 
-#ifndef UNIVERSAL_BUFFER_INPUT_STREAM_H
-#define UNIVERSAL_BUFFER_INPUT_STREAM_H
+#ifndef UNIVERSAL_BUFFER_OUTPUT_STREAM_H
+#define UNIVERSAL_BUFFER_OUTPUT_STREAM_H
 
 /* public file for the doxygen documentation: */
 /*!
  *  \file
  *  \brief implements an universal_output_stream and buffers data in a fixed-sized memory buffer
+ *
+ *  Many small writes are collected and forwarded to the sink as one large block,
+ *  writes larger than the buffer are forwarded directly.
+ *  The buffer is provided by the caller, typical sizes for file output are 64 KiB to 1 MiB.
  */
 
 #include "u8stream/universal_output_stream.h"
+#include <stdint.h>
 
 /*!
  *  \brief attributes of the universal_buffer_output_stream
@@ -20,6 +25,10 @@ struct universal_buffer_output_stream_struct {
     size_t mem_buf_size;  /*!< output memory buffer size */
     size_t mem_buf_filled;  /*!< number of bytes written to the output memory buffer */
     universal_output_stream_t *sink;  /*!< pointer to stream sink, an external \c universal_output_stream_t */
+    uint64_t byte_count;  /*!< statistics: number of bytes written to this stream */
+    uint32_t write_count;  /*!< statistics: number of write calls to this stream */
+    uint32_t sink_write_count;  /*!< statistics: number of write calls to the sink */
+    uint32_t flush_count;  /*!< statistics: number of flushes */
 };
 
 typedef struct universal_buffer_output_stream_struct universal_buffer_output_stream_t;
@@ -72,7 +81,49 @@ u8_error_t universal_buffer_output_stream_flush( universal_buffer_output_stream_
   */
 universal_output_stream_t* universal_buffer_output_stream_get_output_stream( universal_buffer_output_stream_t *this_ );
 
-#endif  /* UNIVERSAL_BUFFER_INPUT_STREAM_H */
+/*!
+ *  \brief gets the number of bytes that are buffered and not yet forwarded to the sink
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of buffered bytes
+ */
+static inline size_t universal_buffer_output_stream_get_fill( const universal_buffer_output_stream_t *this_ );
+
+/*!
+ *  \brief gets the number of bytes written to this stream since init
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of bytes
+ */
+static inline uint64_t universal_buffer_output_stream_get_byte_count( const universal_buffer_output_stream_t *this_ );
+
+/*!
+ *  \brief gets the number of write calls to this stream since init
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of write calls
+ */
+static inline uint32_t universal_buffer_output_stream_get_write_count( const universal_buffer_output_stream_t *this_ );
+
+/*!
+ *  \brief gets the number of write calls to the sink since init
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of write calls forwarded to the sink
+ */
+static inline uint32_t universal_buffer_output_stream_get_sink_write_count( const universal_buffer_output_stream_t *this_ );
+
+/*!
+ *  \brief gets the number of flushes since init
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return number of flushes, including the ones caused by a full buffer
+ */
+static inline uint32_t universal_buffer_output_stream_get_flush_count( const universal_buffer_output_stream_t *this_ );
+
+#include "u8stream/universal_buffer_output_stream.inl"
+
+#endif  /* UNIVERSAL_BUFFER_OUTPUT_STREAM_H */
 
 
 /*
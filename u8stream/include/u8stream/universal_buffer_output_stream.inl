@@ -0,0 +1,46 @@
+/* File: universal_buffer_output_stream.inl; Copyright and License: see below */
+
+#include <assert.h>
+
+static inline size_t universal_buffer_output_stream_get_fill( const universal_buffer_output_stream_t *this_ )
+{
+    assert( (*this_).mem_buf_filled <= (*this_).mem_buf_size );
+    return (*this_).mem_buf_filled;
+}
+
+static inline uint64_t universal_buffer_output_stream_get_byte_count( const universal_buffer_output_stream_t *this_ )
+{
+    return (*this_).byte_count;
+}
+
+static inline uint32_t universal_buffer_output_stream_get_write_count( const universal_buffer_output_stream_t *this_ )
+{
+    return (*this_).write_count;
+}
+
+static inline uint32_t universal_buffer_output_stream_get_sink_write_count( const universal_buffer_output_stream_t *this_ )
+{
+    return (*this_).sink_write_count;
+}
+
+static inline uint32_t universal_buffer_output_stream_get_flush_count( const universal_buffer_output_stream_t *this_ )
+{
+    return (*this_).flush_count;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
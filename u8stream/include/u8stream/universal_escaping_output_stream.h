@@ -13,6 +13,8 @@
  *  This class can be used to e.g escape a couple of characters by escape sequences
  *  or to indent lines after every newline character.
  *  This class does not search for sequences that are split between multiple write calls.
+ *  The rules are compiled to a lookup table by first byte when set, so that write only compares
+ *  patterns at positions where one can start.
  *
  *  Examples for patterns_and_replacements:
  *  \code
@@ -45,6 +47,16 @@
  */
 
 #include "u8stream/universal_output_stream.h"
+#include <stdint.h>
+
+/*!
+ *  \brief constants of universal_escaping_output_stream_t
+ */
+enum universal_escaping_output_stream_max_enum {
+    UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS = 32,  /*!< maximum number of patterns in patterns_and_replacements */
+    UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN = 0xff,  /*!< marks the end of a list of patterns */
+    UNIVERSAL_ESCAPING_OUTPUT_STREAM_STAGE_SIZE = 256,  /*!< size of the buffer collecting small fragments before forwarding to the sink */
+};
 
 /*!
  *  \brief attributes of the universal_escaping_output_stream
@@ -53,6 +65,10 @@ struct universal_escaping_output_stream_struct {
     universal_output_stream_t output_stream;  /*!< instance of implemented interface \c universal_output_stream_t */
     const char *const ((*patterns_and_replacements)[][2]);  /*!< array of 0-terminated pattern and replacement strings, NULL terminated. */
     universal_output_stream_t *sink;  /*!< pointer to data stream sink */
+    uint8_t first_pattern[256];  /*!< per first byte: index of the first pattern starting with this byte, or UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN */
+    uint8_t next_pattern[UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS];  /*!< per pattern: index of the next pattern with the same first byte, or UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN */
+    uint32_t pattern_len[UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS];  /*!< per pattern: length of the pattern */
+    uint32_t replace_len[UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS];  /*!< per pattern: length of the replacement */
 };
 
 typedef struct universal_escaping_output_stream_struct universal_escaping_output_stream_t;
@@ -63,6 +79,8 @@ typedef struct universal_escaping_output_stream_struct universal_escaping_output
  *  \param this_ pointer to own object attributes
  *  \param patterns_and_replacements pointer to 2-dim array, NULL-terminated,
  *         each arrray-entry is a pointer to a 0-terminated string.
+ *         At most UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS patterns are used, further ones are ignored;
+ *         call universal_escaping_output_stream_change_rules() to check a table of unknown size.
  *  \param sink pointer to data stream sink
  */
 void universal_escaping_output_stream_init( universal_escaping_output_stream_t *this_,
@@ -84,10 +102,13 @@ u8_error_t universal_escaping_output_stream_destroy( universal_escaping_output_s
  *  \param this_ pointer to own object attributes
  *  \param patterns_and_replacements pointer to 2-dim array, NULL-terminated,
  *         each arrray-entry is a pointer to a 0-terminated string.
+ *         At most UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS patterns are used, further ones are ignored.
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if there are more than UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS patterns
  */
-void universal_escaping_output_stream_change_rules( universal_escaping_output_stream_t *this_,
-                                                    const char *const ((*patterns_and_replacements)[][2])
-                                                  );
+u8_error_t universal_escaping_output_stream_change_rules( universal_escaping_output_stream_t *this_,
+                                                          const char *const ((*patterns_and_replacements)[][2])
+                                                        );
 
 /*!
  *  \brief writes a buffer (e.g. a stringview) to the data sink, replacing patterns by replacements
@@ -117,6 +138,17 @@ u8_error_t universal_escaping_output_stream_flush( universal_escaping_output_str
  */
 universal_output_stream_t* universal_escaping_output_stream_get_output_stream( universal_escaping_output_stream_t *this_ );
 
+/*!
+ *  \brief builds the lookup tables from the patterns_and_replacements attribute
+ *
+ *  Patterns are compared in the order of the table, empty patterns never match.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success,
+ *          U8_ERROR_ARRAY_BUFFER_EXCEEDED if patterns beyond UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS were ignored
+ */
+u8_error_t universal_escaping_output_stream_private_compile_rules( universal_escaping_output_stream_t *this_ );
+
 #endif  /* UNIVERSAL_ESCAPING_OUTPUT_STREAM_H */
 
 
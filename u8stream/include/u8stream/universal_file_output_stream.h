@@ -72,6 +72,17 @@ u8_error_t universal_file_output_stream_write ( universal_file_output_stream_t *
  */
 u8_error_t universal_file_output_stream_flush ( universal_file_output_stream_t *this_ );
 
+/*!
+ *  \brief gets the current write position, which is the number of bytes written since opening the file
+ *
+ *  Do not query the position if open was not successful (otherwise an error message is logged).
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param[out] out_position the current write position
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_WRONG_STATE if file is not open, U8_ERROR_AT_FILE_WRITE otherwise
+ */
+u8_error_t universal_file_output_stream_get_position ( universal_file_output_stream_t *this_, size_t *out_position );
+
 /*!
  *  \brief closes the universal_file_output_stream_t
  *
@@ -81,6 +81,22 @@ static inline u8_error_t universal_input_stream_read ( universal_input_stream_t
  */
 static inline u8_error_t universal_input_stream_reset ( universal_input_stream_t *this_ );
 
+/*!
+ *  \brief takes all remaining bytes as one contiguous memory region and moves the read position to the end
+ *
+ *  This allows readers to process the bytes in place instead of copying them to an own buffer.
+ *  The region stays valid until the input stream is destroyed or closed.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param out_start start of the region
+ *  \param out_length number of bytes in the region
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_NOT_YET_IMPLEMENTED if the stream is not backed by memory
+ */
+static inline u8_error_t universal_input_stream_take_region ( universal_input_stream_t *this_,
+                                                              const void **out_start,
+                                                              size_t *out_length
+                                                            );
+
 #include "universal_input_stream.inl"
 
 #endif  /* UNIVERSAL_INPUT_STREAM_H */
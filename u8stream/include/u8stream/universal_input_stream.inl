@@ -52,6 +52,28 @@ static inline u8_error_t universal_input_stream_reset( universal_input_stream_t
     return (*(  (*((*this_).interface)).reset  )) ( (*this_).objectdata );
 }
 
+static inline u8_error_t universal_input_stream_take_region( universal_input_stream_t *this_,
+                                                             const void **out_start,
+                                                             size_t *out_length )
+{
+    assert( (*this_).interface != NULL );
+    assert( (*this_).objectdata != NULL );
+    assert( out_start != NULL );
+    assert( out_length != NULL );
+    u8_error_t result;
+    if ( (*((*this_).interface)).take_region != NULL )
+    {
+        result = (*(  (*((*this_).interface)).take_region  )) ( (*this_).objectdata, out_start, out_length );
+    }
+    else
+    {
+        *out_start = NULL;
+        *out_length = 0;
+        result = U8_ERROR_NOT_YET_IMPLEMENTED;
+    }
+    return result;
+}
+
 /*
 Copyright 2021-2026 Andreas Warnke
 
@@ -35,6 +35,8 @@ struct universal_input_stream_if_struct {
     u8_error_t (*read)(universal_input_stream_impl_t *this_, void *out_buffer, size_t max_size, size_t *out_length);
     /*! a function to reset the read position to a starting point */
     u8_error_t (*reset)(universal_input_stream_impl_t *this_ );
+    /*! optional, NULL if not available: a function to take all remaining bytes as one contiguous, read-only memory region */
+    u8_error_t (*take_region)(universal_input_stream_impl_t *this_, const void **out_start, size_t *out_length );
 };
 
 typedef struct universal_input_stream_if_struct universal_input_stream_if_t;
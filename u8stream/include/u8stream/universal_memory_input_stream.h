@@ -77,6 +77,19 @@ u8_error_t universal_memory_input_stream_read ( universal_memory_input_stream_t
                                                 size_t *out_length
                                               );
 
+/*!
+ *  \brief takes all remaining bytes as one memory region and moves the read position to the end
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param out_start start of the remaining bytes
+ *  \param out_length number of remaining bytes
+ *  \return U8_ERROR_NONE
+ */
+u8_error_t universal_memory_input_stream_take_region ( universal_memory_input_stream_t *this_,
+                                                       const void **out_start,
+                                                       size_t *out_length
+                                                     );
+
 /*!
  *  \brief gets the input stream interface of this universal_memory_input_stream_t
  *
@@ -0,0 +1,127 @@
+/* File: universal_mmap_input_stream.h; Copyright and License: see below */
+
+#ifndef UNIVERSAL_MMAP_INPUT_STREAM_H
+#define UNIVERSAL_MMAP_INPUT_STREAM_H
+
+/* public file for the doxygen documentation: */
+/*!
+ *  \file
+ *  \brief implements an universal_input_stream_if and reads data from a file that is mapped to memory
+ *
+ *  In contrast to universal_file_input_stream_t, readers can process the mapped bytes in place,
+ *  see universal_input_stream_take_region().
+ *  Mapping is not available on all platforms; if open fails, use a universal_file_input_stream_t instead.
+ */
+
+#include "u8stream/universal_input_stream.h"
+#include <stddef.h>
+
+/*!
+ *  \brief attributes of the universal_mmap_input_stream
+ */
+struct universal_mmap_input_stream_struct {
+    universal_input_stream_t input_stream;  /*!< instance of implemented interface \c universal_input_stream_t */
+    const void* map_start;  /*!< start of the mapped file, NULL if no file is open */
+    size_t map_size;  /*!< size of the mapped file */
+    size_t map_pos;  /*!< read position in the mapped file */
+};
+
+typedef struct universal_mmap_input_stream_struct universal_mmap_input_stream_t;
+
+/*!
+ *  \brief initializes the universal_mmap_input_stream_t
+ *
+ *  \param this_ pointer to own object attributes
+ */
+void universal_mmap_input_stream_init( universal_mmap_input_stream_t *this_ );
+
+/*!
+ *  \brief destroys the universal_mmap_input_stream_t, closes the file if open
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_AT_FILE_READ otherwise
+ */
+u8_error_t universal_mmap_input_stream_destroy( universal_mmap_input_stream_t *this_ );
+
+/*!
+ *  \brief opens a file and maps it to memory
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param path file path identifying the file to open for reading
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_WRONG_STATE if a file is already open,
+ *          U8_ERROR_NOT_YET_IMPLEMENTED if the platform does not support mapping, U8_ERROR_AT_FILE_READ otherwise
+ */
+u8_error_t universal_mmap_input_stream_open ( universal_mmap_input_stream_t *this_, const char *path );
+
+/*!
+ *  \brief copies bytes from the mapped file to a buffer
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param out_buffer buffer to write read bytes
+ *  \param max_size length of the buffer to write
+ *  \param out_length number of bytes read
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_END_OF_STREAM at the end, U8_ERROR_WRONG_STATE if not open
+ */
+u8_error_t universal_mmap_input_stream_read ( universal_mmap_input_stream_t *this_,
+                                              void *out_buffer,
+                                              size_t max_size,
+                                              size_t *out_length
+                                            );
+
+/*!
+ *  \brief resets the read position to the start of the file
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_WRONG_STATE if not open
+ */
+u8_error_t universal_mmap_input_stream_reset ( universal_mmap_input_stream_t *this_ );
+
+/*!
+ *  \brief takes all remaining bytes of the mapped file as one region and moves the read position to the end
+ *
+ *  The region is valid until the file is closed.
+ *
+ *  \param this_ pointer to own object attributes
+ *  \param out_start start of the remaining bytes
+ *  \param out_length number of remaining bytes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_WRONG_STATE if not open
+ */
+u8_error_t universal_mmap_input_stream_take_region ( universal_mmap_input_stream_t *this_,
+                                                     const void **out_start,
+                                                     size_t *out_length
+                                                   );
+
+/*!
+ *  \brief unmaps and closes the file
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return U8_ERROR_NONE in case of success, U8_ERROR_AT_FILE_READ otherwise
+ */
+u8_error_t universal_mmap_input_stream_close( universal_mmap_input_stream_t *this_ );
+
+/*!
+ *  \brief gets the input stream interface of this universal_mmap_input_stream_t
+ *
+ *  \param this_ pointer to own object attributes
+ *  \return the abstract base class of this_
+ */
+universal_input_stream_t* universal_mmap_input_stream_get_input_stream( universal_mmap_input_stream_t *this_ );
+
+#endif  /* UNIVERSAL_MMAP_INPUT_STREAM_H */
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -27,6 +27,7 @@ const char * u8_error_get_name( u8_error_t this_ )
         case U8_ERROR_LIB_NO_MEMORY: { result = "U8_ERROR_LIB_NO_MEMORY"; }; break;
         case U8_ERROR_LIB_FILE_WRITE: { result = "U8_ERROR_LIB_FILE_WRITE"; }; break;
         case U8_ERROR_NO_DB: { result = "U8_ERROR_NO_DB"; }; break;
+        case U8_ERROR_CANCELLED: { result = "U8_ERROR_CANCELLED"; }; break;
         case U8_ERROR_OBJECT_STILL_REFERENCED: { result = "U8_ERROR_OBJECT_STILL_REFERENCED"; }; break;
         case U8_ERROR_DIAGRAM_HIDES_RELATIONSHIPS: { result = "U8_ERROR_DIAGRAM_HIDES_RELATIONSHIPS"; }; break;
         case U8_ERROR_DIAGRAM_HIDES_FEATURES: { result = "U8_ERROR_DIAGRAM_HIDES_FEATURES"; }; break;
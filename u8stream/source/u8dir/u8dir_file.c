@@ -4,6 +4,7 @@
 #include "u8/u8_trace.h"
 #include "u8/u8_log.h"
 #include <stdio.h>
+#include <errno.h>
 #include <sys/stat.h>
 #include <stdbool.h>
 #include <assert.h>
@@ -41,6 +42,35 @@ u8_error_t u8dir_file_remove( u8dir_file_t this_ )
     return err;
 }
 
+u8_error_t u8dir_file_rename( u8dir_file_t this_, u8dir_file_t new_path )
+{
+    U8_TRACE_BEGIN();
+    assert( this_ != NULL );
+    assert( new_path != NULL );
+    u8_error_t err = U8_ERROR_NONE;
+
+    int rename_err = rename( this_, new_path );
+    if (( 0 != rename_err )&&( errno == EEXIST || errno == EACCES ))
+    {
+        /* windows does not replace existing files */
+        (void) remove( new_path );
+        rename_err = rename( this_, new_path );
+    }
+    if ( 0 != rename_err )
+    {
+        U8_TRACE_INFO_STR( "error at renaming file:", this_ );
+        U8_LOG_EVENT("rename() failed to rename a file.");
+        err |= U8_ERROR_AT_FILE_WRITE;
+    }
+    else
+    {
+        U8_TRACE_INFO_STR( "renamed file to:", new_path );
+    }
+
+    U8_TRACE_END_ERR(err);
+    return err;
+}
+
 bool u8dir_file_is_regular_file( u8dir_file_t this_ )
 {
     U8_TRACE_BEGIN();
@@ -25,6 +25,8 @@ void universal_buffer_input_stream_init( universal_buffer_input_stream_t *this_,
 
     (*this_).source = source;
 
+    (*this_).own_buf_start = mem_buf_start;
+    (*this_).own_buf_size = mem_buf_size;
     (*this_).mem_buf_start = mem_buf_start;
     (*this_).mem_buf_size = mem_buf_size;
     (*this_).mem_buf_fill = 0;
@@ -32,6 +34,17 @@ void universal_buffer_input_stream_init( universal_buffer_input_stream_t *this_,
     universal_input_stream_private_init( &((*this_).input_stream), &universal_buffer_input_stream_private_if, this_ );
     (*this_).stream_pos_of_buf = 0;
 
+    /* if the source is a memory region, read it in place */
+    const void *region_start;
+    size_t region_length;
+    const u8_error_t region_err = universal_input_stream_take_region( source, &region_start, &region_length );
+    if (( region_err == U8_ERROR_NONE )&&( region_length != 0 ))
+    {
+        (*this_).mem_buf_start = region_start;
+        (*this_).mem_buf_size = region_length;
+        (*this_).mem_buf_fill = region_length;
+    }
+
     U8_TRACE_END();
 }
 
@@ -41,6 +54,8 @@ void universal_buffer_input_stream_destroy( universal_buffer_input_stream_t *thi
     assert( (*this_).mem_buf_start != NULL );
     assert( (*this_).source != NULL );
 
+    (*this_).own_buf_start = NULL;
+    (*this_).own_buf_size = 0;
     (*this_).mem_buf_start = NULL;
     (*this_).mem_buf_size = 0;
     (*this_).mem_buf_fill = 0;
@@ -59,6 +74,8 @@ void universal_buffer_input_stream_reset ( universal_buffer_input_stream_t *this
     assert( (*this_).mem_buf_start != NULL );
     assert( (*this_).source != NULL );
 
+    (*this_).mem_buf_start = (*this_).own_buf_start;
+    (*this_).mem_buf_size = (*this_).own_buf_size;
     (*this_).mem_buf_pos = 0;
     (*this_).mem_buf_fill = 0;
     (*this_).stream_pos_of_buf = 0;
@@ -77,7 +94,7 @@ u8_error_t universal_buffer_input_stream_read ( universal_buffer_input_stream_t
     u8_error_t err = U8_ERROR_NONE;
 
     const size_t buf_available1 = (*this_).mem_buf_fill - (*this_).mem_buf_pos;
-    char *const buf_first_read = &(  (*(  (char(*)[])(*this_).mem_buf_start  ))[(*this_).mem_buf_pos]  );
+    const char *const buf_first_read = &(  (*(  (const char(*)[])(*this_).mem_buf_start  ))[(*this_).mem_buf_pos]  );
     if ( max_size <= buf_available1 )
     {
         /* read all from buffer */
@@ -90,6 +107,8 @@ u8_error_t universal_buffer_input_stream_read ( universal_buffer_input_stream_t
         /* read from buffer till buffer is empty */
         memcpy( out_buffer, buf_first_read, buf_available1 );
         (*this_).stream_pos_of_buf += (*this_).mem_buf_fill;
+        (*this_).mem_buf_start = (*this_).own_buf_start;
+        (*this_).mem_buf_size = (*this_).own_buf_size;
         (*this_).mem_buf_pos = 0;
         (*this_).mem_buf_fill = 0;
         const size_t remaining_len = max_size - buf_available1;
@@ -97,7 +116,7 @@ u8_error_t universal_buffer_input_stream_read ( universal_buffer_input_stream_t
 
         if ( remaining_len < (*this_).mem_buf_size )
         {
-            err |= universal_input_stream_read( (*this_).source, (*this_).mem_buf_start, (*this_).mem_buf_size, &((*this_).mem_buf_fill) );
+            err |= universal_input_stream_read( (*this_).source, (*this_).own_buf_start, (*this_).own_buf_size, &((*this_).mem_buf_fill) );
 
             const size_t buf_available2 = ( (*this_).mem_buf_fill < remaining_len )?( (*this_).mem_buf_fill ):( remaining_len );
 
@@ -112,6 +131,12 @@ u8_error_t universal_buffer_input_stream_read ( universal_buffer_input_stream_t
             *out_length = buf_available1 + remaining_actual;
             (*this_).stream_pos_of_buf += remaining_actual;
         }
+
+        /* the end of the stream is reported only if no more bytes are available */
+        if (( err == U8_ERROR_END_OF_STREAM )&&( (*out_length) != 0 ))
+        {
+            err = U8_ERROR_NONE;
+        }
     }
 
     /*U8_TRACE_END_ERR(err);*/
@@ -28,6 +28,10 @@ void universal_buffer_output_stream_init( universal_buffer_output_stream_t *this
     (*this_).mem_buf_start = mem_buf_start;
     (*this_).mem_buf_size = mem_buf_size;
     (*this_).mem_buf_filled = 0;
+    (*this_).byte_count = 0;
+    (*this_).write_count = 0;
+    (*this_).sink_write_count = 0;
+    (*this_).flush_count = 0;
     universal_output_stream_private_init( &((*this_).output_stream), &universal_buffer_output_stream_private_if, this_ );
 
     U8_TRACE_END();
@@ -41,6 +45,10 @@ u8_error_t universal_buffer_output_stream_destroy( universal_buffer_output_strea
     u8_error_t err = U8_ERROR_NONE;
 
     err = universal_buffer_output_stream_flush( this_ );
+    U8_TRACE_INFO_INT( "bytes written:", (*this_).byte_count );
+    U8_TRACE_INFO_INT( "write calls:", (*this_).write_count );
+    U8_TRACE_INFO_INT( "write calls to sink:", (*this_).sink_write_count );
+    U8_TRACE_INFO_INT( "flushes:", (*this_).flush_count );
 
     (*this_).mem_buf_start = NULL;
     (*this_).mem_buf_size = 0;
@@ -60,6 +68,8 @@ u8_error_t universal_buffer_output_stream_write ( universal_buffer_output_stream
     assert( (*this_).mem_buf_start != NULL );
     assert( (*this_).sink != NULL );
     u8_error_t err = U8_ERROR_NONE;
+    (*this_).byte_count += length;
+    (*this_).write_count ++;
 
     const size_t space_left = (*this_).mem_buf_size - (*this_).mem_buf_filled;
     char *const buf_first_free = &(  (*(  (char(*)[])(*this_).mem_buf_start  ))[(*this_).mem_buf_filled]  );
@@ -87,6 +97,7 @@ u8_error_t universal_buffer_output_stream_write ( universal_buffer_output_stream
         else
         {
             err |= universal_output_stream_write( (*this_).sink, remaining_start, remaining_len );
+            (*this_).sink_write_count ++;
         }
     }
 
@@ -104,8 +115,10 @@ u8_error_t universal_buffer_output_stream_flush( universal_buffer_output_stream_
     if ( (*this_).mem_buf_filled > 0 )
     {
         err |= universal_output_stream_write( (*this_).sink, (*this_).mem_buf_start, (*this_).mem_buf_filled );
+        (*this_).sink_write_count ++;
     }
     (*this_).mem_buf_filled = 0;
+    (*this_).flush_count ++;
 
     U8_TRACE_END_ERR(err);
     return err;
@@ -24,6 +24,7 @@ void universal_escaping_output_stream_init ( universal_escaping_output_stream_t
 
     (*this_).patterns_and_replacements = patterns_and_replacements;
     (*this_).sink = sink;
+    universal_escaping_output_stream_private_compile_rules( this_ );  /* too many patterns are logged and ignored */
     universal_output_stream_private_init( &((*this_).output_stream), &universal_escaping_output_stream_private_if, this_ );
 
     U8_TRACE_END();
@@ -42,15 +43,17 @@ u8_error_t universal_escaping_output_stream_destroy( universal_escaping_output_s
     return err;
 }
 
-void universal_escaping_output_stream_change_rules( universal_escaping_output_stream_t *this_,
-                                                    const char *const ((*patterns_and_replacements)[][2]) )
+u8_error_t universal_escaping_output_stream_change_rules( universal_escaping_output_stream_t *this_,
+                                                          const char *const ((*patterns_and_replacements)[][2]) )
 {
     U8_TRACE_BEGIN();
     assert( patterns_and_replacements != NULL );
 
     (*this_).patterns_and_replacements = patterns_and_replacements;
+    const u8_error_t err = universal_escaping_output_stream_private_compile_rules( this_ );
 
-    U8_TRACE_END();
+    U8_TRACE_END_ERR(err);
+    return err;
 }
 
 u8_error_t universal_escaping_output_stream_write ( universal_escaping_output_stream_t *this_, const void *start, size_t length )
@@ -62,77 +65,94 @@ u8_error_t universal_escaping_output_stream_write ( universal_escaping_output_st
     u8_error_t err = U8_ERROR_NONE;
     const char (*char_buf)[] = (void*)start;
 
-    /* count and analyze input patterns */
-    unsigned int pattern_count = 0;
-    char head_common_bits = '\x00';  /* optimization, improves xml export by 5% */
-    char head_common_pattern = '\x00';  /* optimization, improves xml export by 5% */
-    for ( unsigned int pattern_idx = 0; (*((*this_).patterns_and_replacements))[pattern_idx][0] != NULL; pattern_idx++ )
-    {
-        pattern_count++;
-        if ( pattern_idx == 0 )
-        {
-            head_common_bits = '\xff';
-            head_common_pattern = *((*((*this_).patterns_and_replacements))[pattern_idx][0]);
-        }
-        else
-        {
-            const char unequal_bits = head_common_pattern ^ *((*((*this_).patterns_and_replacements))[pattern_idx][0]);
-            head_common_bits = head_common_bits & ( ~ unequal_bits );
-        }
-    };
-    head_common_pattern &= head_common_bits;
+    /* small fragments (short runs of unchanged bytes and replacements) are collected before forwarding to the sink */
+    char stage[UNIVERSAL_ESCAPING_OUTPUT_STREAM_STAGE_SIZE];
+    size_t stage_len = 0;
 
     /* search and replace patterns */
     size_t bytes_already_written = 0;
-    for ( size_t index = 0; index < length; index ++ )
+    size_t index = 0;
+    while ( index < length )
     {
+        /* skip bytes where no pattern starts */
+        while (( index < length )
+            && ( (*this_).first_pattern[(unsigned char)(*char_buf)[index]] == UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN ))
+        {
+            index ++;
+        }
+
         /* check if a pattern matches */
-        int matching_pattern_idx = -1;
-        const char chr_at_idx = (*char_buf)[index];
-        if (( chr_at_idx & head_common_bits ) == head_common_pattern )
+        uint_fast8_t matching_pattern_idx = UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN;
+        if ( index < length )
         {
-            for ( unsigned int pattern_idx = 0; ( pattern_idx < pattern_count )&&( matching_pattern_idx == -1 ); pattern_idx++ )
+            for ( uint_fast8_t pattern_idx = (*this_).first_pattern[(unsigned char)(*char_buf)[index]];
+                  ( pattern_idx != UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN )&&( matching_pattern_idx == UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN );
+                  pattern_idx = (*this_).next_pattern[pattern_idx] )
             {
-                const char * pattern = (*((*this_).patterns_and_replacements))[pattern_idx][0];
-                const unsigned int pattern_len = strlen( pattern );
-                if (( index + pattern_len <= length )&&( pattern_len > 0 ))
+                const char *const pattern = (*((*this_).patterns_and_replacements))[pattern_idx][0];
+                const size_t pattern_len = (*this_).pattern_len[pattern_idx];
+                if (( index + pattern_len <= length )&&( 0 == memcmp( &((*char_buf)[index]), pattern, pattern_len ) ))
                 {
-                    if ( 0 == memcmp( &((*char_buf)[index]), pattern, pattern_len ) )
-                    {
-                        matching_pattern_idx = pattern_idx;
-                        /*fprintf(stderr,"found pattern %d at pos %zd\n",matching_pattern_idx,index);*/
-                    }
+                    matching_pattern_idx = pattern_idx;
                 }
             }
         }
 
         /* replace pattern */
-        if ( matching_pattern_idx != -1 )
+        if ( matching_pattern_idx != UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN )
         {
-            /* write previously processed bytes */
-            err |= universal_output_stream_write( (*this_).sink, &((*char_buf)[bytes_already_written]), index-bytes_already_written );
-            bytes_already_written = index;
-            /* write pattern */
-            const char * pattern = (*((*this_).patterns_and_replacements))[matching_pattern_idx][0];
-            const unsigned int pattern_len = strlen( pattern );
-            const char * replacement = (*((*this_).patterns_and_replacements))[matching_pattern_idx][1];
-            unsigned int replace_len = 0;
-            if ( replacement != NULL )
+            const char *const unchanged = &((*char_buf)[bytes_already_written]);
+            const size_t unchanged_len = index - bytes_already_written;
+            const char *const replacement = (*((*this_).patterns_and_replacements))[matching_pattern_idx][1];
+            const size_t replace_len = (*this_).replace_len[matching_pattern_idx];
+            if ( stage_len + unchanged_len + replace_len > sizeof(stage) )
+            {
+                err |= universal_output_stream_write( (*this_).sink, &stage, stage_len );
+                stage_len = 0;
+            }
+            if ( unchanged_len + replace_len > sizeof(stage) )
             {
-                replace_len = strlen(replacement);
+                err |= universal_output_stream_write( (*this_).sink, unchanged, unchanged_len );
+                err |= universal_output_stream_write( (*this_).sink, replacement, replace_len );
+            }
+            else
+            {
+                memcpy( &(stage[stage_len]), unchanged, unchanged_len );
+                stage_len += unchanged_len;
+                if ( replace_len != 0 )
+                {
+                    memcpy( &(stage[stage_len]), replacement, replace_len );
+                    stage_len += replace_len;
+                }
             }
-            err |= universal_output_stream_write( (*this_).sink, replacement, replace_len );
-            bytes_already_written += pattern_len;
-            /* forward index */
-            index = index + pattern_len - 1;
+            index += (*this_).pattern_len[matching_pattern_idx];
+            bytes_already_written = index;
+        }
+        else if ( index < length )
+        {
+            index ++;
         }
+    }
 
-        if ( (index+1)==length ) /* is last? */
+    /* write the remaining bytes */
+    const size_t rest_len = length - bytes_already_written;
+    if ( stage_len + rest_len <= sizeof(stage) )
+    {
+        memcpy( &(stage[stage_len]), &((*char_buf)[bytes_already_written]), rest_len );
+        stage_len += rest_len;
+        if ( stage_len != 0 )
         {
-            err |= universal_output_stream_write( (*this_).sink, &((*char_buf)[bytes_already_written]), length-bytes_already_written );
-            bytes_already_written = length;
+            err |= universal_output_stream_write( (*this_).sink, &stage, stage_len );
         }
     }
+    else
+    {
+        if ( stage_len != 0 )
+        {
+            err |= universal_output_stream_write( (*this_).sink, &stage, stage_len );
+        }
+        err |= universal_output_stream_write( (*this_).sink, &((*char_buf)[bytes_already_written]), rest_len );
+    }
 
     /*U8_TRACE_END_ERR(err);*/
     return err;
@@ -159,6 +179,49 @@ universal_output_stream_t* universal_escaping_output_stream_get_output_stream( u
     return result;
 }
 
+u8_error_t universal_escaping_output_stream_private_compile_rules( universal_escaping_output_stream_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    assert( (*this_).patterns_and_replacements != NULL );
+    u8_error_t err = U8_ERROR_NONE;
+
+    memset( &((*this_).first_pattern), UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN, sizeof((*this_).first_pattern) );
+    uint8_t last_pattern[256] = { 0 };  /* per first byte: the last pattern in the list, valid if first_pattern is valid */
+
+    for ( unsigned int pattern_idx = 0; (*((*this_).patterns_and_replacements))[pattern_idx][0] != NULL; pattern_idx++ )
+    {
+        if ( pattern_idx >= UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS )
+        {
+            U8_LOG_ERROR_INT( "too many patterns, ignored from index", pattern_idx );
+            err = U8_ERROR_ARRAY_BUFFER_EXCEEDED;
+            break;
+        }
+        const char *const pattern = (*((*this_).patterns_and_replacements))[pattern_idx][0];
+        const char *const replacement = (*((*this_).patterns_and_replacements))[pattern_idx][1];
+        (*this_).pattern_len[pattern_idx] = strlen( pattern );
+        (*this_).replace_len[pattern_idx] = ( replacement == NULL ) ? 0 : strlen( replacement );
+        (*this_).next_pattern[pattern_idx] = UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN;
+
+        /* append the pattern to the list of its first byte; empty patterns are not listed */
+        if ( (*this_).pattern_len[pattern_idx] > 0 )
+        {
+            const unsigned char first_byte = (unsigned char) pattern[0];
+            if ( (*this_).first_pattern[first_byte] == UNIVERSAL_ESCAPING_OUTPUT_STREAM_NO_PATTERN )
+            {
+                (*this_).first_pattern[first_byte] = pattern_idx;
+            }
+            else
+            {
+                (*this_).next_pattern[last_pattern[first_byte]] = pattern_idx;
+            }
+            last_pattern[first_byte] = pattern_idx;
+        }
+    }
+
+    U8_TRACE_END_ERR(err);
+    return err;
+}
+
 
 /*
 Copyright 2020-2026 Andreas Warnke
@@ -130,6 +130,38 @@ u8_error_t universal_file_output_stream_flush( universal_file_output_stream_t *t
     return err;
 }
 
+u8_error_t universal_file_output_stream_get_position( universal_file_output_stream_t *this_, size_t *out_position )
+{
+    U8_TRACE_BEGIN();
+    assert( out_position != NULL );
+    u8_error_t err = U8_ERROR_NONE;
+
+    if ( (*this_).output != NULL )
+    {
+        /* ftell includes the bytes that are still in the buffer of the FILE */
+        const long position = ftell( (*this_).output );
+        if ( position < 0 )
+        {
+            U8_LOG_ERROR_INT( "error at determining the write position:", errno );
+            err = U8_ERROR_AT_FILE_WRITE;
+            *out_position = 0;
+        }
+        else
+        {
+            *out_position = (size_t) position;
+        }
+    }
+    else
+    {
+        U8_LOG_ERROR("cannot get the position of a file that is not open.");
+        err = U8_ERROR_WRONG_STATE;
+        *out_position = 0;
+    }
+
+    U8_TRACE_END_ERR(err);
+    return err;
+}
+
 u8_error_t universal_file_output_stream_close( universal_file_output_stream_t *this_ )
 {
     U8_TRACE_BEGIN();
@@ -11,7 +11,8 @@
 static const universal_input_stream_if_t universal_memory_input_stream_private_if
     = {
         .read = (u8_error_t (*)(universal_input_stream_impl_t*, void*, size_t, size_t*)) &universal_memory_input_stream_read,
-        .reset = (u8_error_t (*)(universal_input_stream_impl_t*)) &universal_memory_input_stream_reset
+        .reset = (u8_error_t (*)(universal_input_stream_impl_t*)) &universal_memory_input_stream_reset,
+        .take_region = (u8_error_t (*)(universal_input_stream_impl_t*, const void**, size_t*)) &universal_memory_input_stream_take_region
     };
 
 void universal_memory_input_stream_init ( universal_memory_input_stream_t *this_,
@@ -94,6 +95,23 @@ u8_error_t universal_memory_input_stream_read ( universal_memory_input_stream_t
     return err;
 }
 
+u8_error_t universal_memory_input_stream_take_region ( universal_memory_input_stream_t *this_, const void **out_start, size_t *out_length )
+{
+    /*U8_TRACE_BEGIN();*/
+    assert( out_start != NULL );
+    assert( out_length != NULL );
+    assert( (*this_).mem_buf_start != NULL );
+    assert( (*this_).mem_buf_pos <= (*this_).mem_buf_size );
+    const u8_error_t err = U8_ERROR_NONE;
+
+    *out_start = &(  (*(  (const char(*)[])(*this_).mem_buf_start  ))[(*this_).mem_buf_pos]  );
+    *out_length = (*this_).mem_buf_size - (*this_).mem_buf_pos;
+    (*this_).mem_buf_pos = (*this_).mem_buf_size;
+
+    /*U8_TRACE_END_ERR(err);*/
+    return err;
+}
+
 universal_input_stream_t* universal_memory_input_stream_get_input_stream( universal_memory_input_stream_t *this_ )
 {
     U8_TRACE_BEGIN();
@@ -0,0 +1,258 @@
+/* File: universal_mmap_input_stream.c; Copyright and License: see below */
+
+#include "u8stream/universal_mmap_input_stream.h"
+#include "u8stream/universal_input_stream_if.h"
+#include "u8/u8_trace.h"
+#include "u8/u8_log.h"
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <errno.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* the vmt implementing the interface */
+static const universal_input_stream_if_t universal_mmap_input_stream_private_if
+    = {
+        .read = (u8_error_t (*)(universal_input_stream_impl_t*, void*, size_t, size_t*)) &universal_mmap_input_stream_read,
+        .reset = (u8_error_t (*)(universal_input_stream_impl_t*)) &universal_mmap_input_stream_reset,
+        .take_region = (u8_error_t (*)(universal_input_stream_impl_t*, const void**, size_t*)) &universal_mmap_input_stream_take_region
+    };
+
+/*! an empty file cannot be mapped, it is represented by this empty region */
+static const char universal_mmap_input_stream_private_empty[1] = "";
+
+void universal_mmap_input_stream_init ( universal_mmap_input_stream_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    (*this_).map_start = NULL;
+    (*this_).map_size = 0;
+    (*this_).map_pos = 0;
+    universal_input_stream_private_init( &((*this_).input_stream), &universal_mmap_input_stream_private_if, this_ );
+
+    U8_TRACE_END();
+}
+
+u8_error_t universal_mmap_input_stream_destroy( universal_mmap_input_stream_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t err = U8_ERROR_NONE;
+
+    if ( (*this_).map_start != NULL )
+    {
+        err = universal_mmap_input_stream_close( this_ );
+    }
+    universal_input_stream_private_destroy( &((*this_).input_stream) );
+
+    U8_TRACE_END_ERR(err);
+    return err;
+}
+
+u8_error_t universal_mmap_input_stream_open ( universal_mmap_input_stream_t *this_, const char *path )
+{
+    U8_TRACE_BEGIN();
+    assert( path != NULL );
+    u8_error_t err = U8_ERROR_NONE;
+
+    if ( (*this_).map_start != NULL )
+    {
+        U8_LOG_ERROR("cannot open a file that is already open.");
+        err = U8_ERROR_WRONG_STATE;
+        err |= universal_mmap_input_stream_close( this_ );
+    }
+
+#ifdef _WIN32
+    U8_TRACE_INFO("mapping files is not supported on this platform.");
+    err |= U8_ERROR_NOT_YET_IMPLEMENTED;
+#else
+    const int fd = open( path, O_RDONLY );
+    if ( fd < 0 )
+    {
+        /* Note: This need not be an error, could be intentionally to avoid TOCTOU issues. */
+        U8_LOG_EVENT_STR("could not open file for reading:", strerror(errno) );
+        err |= U8_ERROR_AT_FILE_READ;
+    }
+    else
+    {
+        struct stat file_stat;
+        if (( 0 != fstat( fd, &file_stat ) )||( ! S_ISREG( file_stat.st_mode ) ))
+        {
+            U8_LOG_EVENT("file cannot be mapped, it is not a regular file.");
+            err |= U8_ERROR_AT_FILE_READ;
+        }
+        else if ( file_stat.st_size == 0 )
+        {
+            (*this_).map_start = &universal_mmap_input_stream_private_empty;
+            (*this_).map_size = 0;
+            (*this_).map_pos = 0;
+        }
+        else
+        {
+            void *const mapped = mmap( NULL, (size_t) file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if ( mapped == MAP_FAILED )
+            {
+                U8_LOG_EVENT_STR("could not map file:", strerror(errno) );
+                err |= U8_ERROR_AT_FILE_READ;
+            }
+            else
+            {
+                (*this_).map_start = mapped;
+                (*this_).map_size = (size_t) file_stat.st_size;
+                (*this_).map_pos = 0;
+            }
+        }
+        /* the mapping stays valid after closing the file descriptor */
+        close( fd );
+    }
+#endif
+
+    U8_TRACE_END_ERR(err);
+    return err;
+}
+
+u8_error_t universal_mmap_input_stream_read ( universal_mmap_input_stream_t *this_,
+                                              void *out_buffer,
+                                              size_t max_size,
+                                              size_t *out_length )
+{
+    /*U8_TRACE_BEGIN();*/
+    assert( out_buffer != NULL );
+    assert( out_length != NULL );
+    u8_error_t err = U8_ERROR_NONE;
+
+    if ( (*this_).map_start != NULL )
+    {
+        const size_t bytes_left = (*this_).map_size - (*this_).map_pos;
+        if ( bytes_left != 0 )
+        {
+            const size_t bytes_to_copy = ( max_size <= bytes_left ) ? max_size : bytes_left;
+            memcpy( out_buffer, &(  (*(  (const char(*)[])(*this_).map_start  ))[(*this_).map_pos]  ), bytes_to_copy );
+            (*this_).map_pos += bytes_to_copy;
+            *out_length = bytes_to_copy;
+        }
+        else
+        {
+            err = U8_ERROR_END_OF_STREAM;  /* finished, no more bytes to read */
+            *out_length = 0;
+        }
+    }
+    else
+    {
+        U8_LOG_ERROR("cannot read from a file that is not open.");
+        err = U8_ERROR_WRONG_STATE;
+        *out_length = 0;
+    }
+
+    /*U8_TRACE_END_ERR(err);*/
+    return err;
+}
+
+u8_error_t universal_mmap_input_stream_reset ( universal_mmap_input_stream_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t err = U8_ERROR_NONE;
+
+    if ( (*this_).map_start != NULL )
+    {
+        (*this_).map_pos = 0;
+    }
+    else
+    {
+        U8_LOG_ERROR("cannot reset a file that is not open.");
+        err = U8_ERROR_WRONG_STATE;
+    }
+
+    U8_TRACE_END_ERR(err);
+    return err;
+}
+
+u8_error_t universal_mmap_input_stream_take_region ( universal_mmap_input_stream_t *this_,
+                                                     const void **out_start,
+                                                     size_t *out_length )
+{
+    U8_TRACE_BEGIN();
+    assert( out_start != NULL );
+    assert( out_length != NULL );
+    u8_error_t err = U8_ERROR_NONE;
+
+    if ( (*this_).map_start != NULL )
+    {
+        *out_start = &(  (*(  (const char(*)[])(*this_).map_start  ))[(*this_).map_pos]  );
+        *out_length = (*this_).map_size - (*this_).map_pos;
+        (*this_).map_pos = (*this_).map_size;
+    }
+    else
+    {
+        U8_LOG_ERROR("cannot map a file that is not open.");
+        err = U8_ERROR_WRONG_STATE;
+        *out_start = NULL;
+        *out_length = 0;
+    }
+
+    U8_TRACE_END_ERR(err);
+    return err;
+}
+
+u8_error_t universal_mmap_input_stream_close( universal_mmap_input_stream_t *this_ )
+{
+    U8_TRACE_BEGIN();
+    u8_error_t err = U8_ERROR_NONE;
+
+    if ( (*this_).map_start != NULL )
+    {
+#ifndef _WIN32
+        if ( (*this_).map_size != 0 )
+        {
+            const int unmap_err = munmap( (void*)(*this_).map_start, (*this_).map_size );
+            if ( 0 != unmap_err )
+            {
+                U8_LOG_ERROR_INT("error at unmapping a file:", errno );
+                err = U8_ERROR_AT_FILE_READ;
+            }
+        }
+#endif
+        (*this_).map_start = NULL;
+        (*this_).map_size = 0;
+        (*this_).map_pos = 0;
+    }
+    else
+    {
+        U8_LOG_ERROR("cannot close a file that is not open.");
+        err = U8_ERROR_WRONG_STATE;
+    }
+
+    U8_TRACE_END_ERR(err);
+    return err;
+}
+
+universal_input_stream_t* universal_mmap_input_stream_get_input_stream( universal_mmap_input_stream_t *this_ )
+{
+    U8_TRACE_BEGIN();
+
+    universal_input_stream_t* result = &((*this_).input_stream);
+
+    U8_TRACE_END();
+    return result;
+}
+
+
+/*
+Copyright 2026-2026 Andreas Warnke
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
@@ -15,6 +15,7 @@ static test_fixture_t * set_up();
 static void tear_down( test_fixture_t *fix );
 static test_case_result_t test_file_remove( test_fixture_t *fix );
 static test_case_result_t test_file_stat( test_fixture_t *fix );
+static test_case_result_t test_file_rename( test_fixture_t *fix );
 
 static uint64_t create_a_file( u8dir_file_t path );
 
@@ -29,6 +30,7 @@ test_suite_t u8dir_file_test_get_suite(void)
                    );
     test_suite_add_test_case( &result, "test_file_remove", &test_file_remove );
     test_suite_add_test_case( &result, "test_file_stat", &test_file_stat );
+    test_suite_add_test_case( &result, "test_file_rename", &test_file_rename );
     return result;
 }
 
@@ -148,6 +150,41 @@ static test_case_result_t test_file_stat( test_fixture_t *fix )
     return TEST_CASE_RESULT_OK;
 }
 
+static test_case_result_t test_file_rename( test_fixture_t *fix )
+{
+    u8_error_t err;
+    uint64_t out_size = 17;
+
+    /* case: non_existant */
+    const u8dir_file_t non_existant = "non_existant.file";
+    const u8dir_file_t renamed = "renamed.file";
+    err = u8dir_file_rename( non_existant, renamed );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_AT_FILE_WRITE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( false, u8dir_file_is_regular_file( renamed ) );
+
+    /* case: existant, new path is free */
+    const u8dir_file_t existant = "existant.file";
+    const uint64_t f_size = create_a_file( existant );
+    err = u8dir_file_rename( existant, renamed );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( false, u8dir_file_is_regular_file( existant ) );
+    err = u8dir_file_get_size( renamed, &out_size );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( f_size, out_size );
+
+    /* case: existant, new path is occupied */
+    (void) create_a_file( existant );
+    err = u8dir_file_rename( renamed, existant );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( false, u8dir_file_is_regular_file( renamed ) );
+    TEST_EXPECT_EQUAL_INT( true, u8dir_file_is_regular_file( existant ) );
+
+    err = u8dir_file_remove( existant );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == err );
+
+    return TEST_CASE_RESULT_OK;
+}
+
 
 /*
  * Copyright 2023-2026 Andreas Warnke
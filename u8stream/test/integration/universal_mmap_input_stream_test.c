@@ -0,0 +1,273 @@
+/* File: universal_mmap_input_stream_test.c; Copyright and License: see below */
+
+#include "universal_mmap_input_stream_test.h"
+#include "u8/u8_error.h"
+#include "u8stream/universal_mmap_input_stream.h"
+#include "u8stream/universal_buffer_input_stream.h"
+#include "u8stream/universal_file_output_stream.h"
+#include "u8dir/u8dir_file.h"
+#include "test_fixture.h"
+#include "test_expect.h"
+#include "test_environment_assert.h"
+#include "test_case_result.h"
+#include <string.h>
+#include <assert.h>
+
+static test_fixture_t * set_up();
+static void tear_down( test_fixture_t *fix );
+static test_case_result_t test_file_read( test_fixture_t *fix );
+static test_case_result_t test_buffered_in_place( test_fixture_t *fix );
+static test_case_result_t test_empty_file( test_fixture_t *fix );
+static test_case_result_t test_wrong_mode( test_fixture_t *fix );
+
+test_suite_t universal_mmap_input_stream_test_get_suite(void)
+{
+    test_suite_t result;
+    test_suite_init( &result,
+                     "universal_mmap_input_stream_test_get_suite",
+                     TEST_CATEGORY_INTEGRATION | TEST_CATEGORY_CONTINUOUS | TEST_CATEGORY_COVERAGE,
+                     &set_up,
+                     &tear_down
+                   );
+    test_suite_add_test_case( &result, "test_file_read", &test_file_read );
+    test_suite_add_test_case( &result, "test_buffered_in_place", &test_buffered_in_place );
+    test_suite_add_test_case( &result, "test_empty_file", &test_empty_file );
+    test_suite_add_test_case( &result, "test_wrong_mode", &test_wrong_mode );
+    return result;
+}
+
+struct test_fixture_struct {
+    const char * test_file_name;
+    const char * empty_file_name;
+    char test_contents[4];
+};
+typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
+static test_fixture_t test_fixture;
+
+static test_fixture_t * set_up()
+{
+    test_fixture.test_file_name = "universal_mmap_input_stream_test.txt";
+    test_fixture.empty_file_name = "universal_mmap_input_stream_test_empty.txt";
+    memcpy( test_fixture.test_contents, "123", sizeof(test_fixture.test_contents) );
+    /* write a file and an empty file */
+    {
+        test_fixture_t *fix = &test_fixture;
+        universal_file_output_stream_t create_file;
+        u8_error_t file_err = U8_ERROR_NONE;
+        universal_file_output_stream_init( &create_file );
+        file_err |= universal_file_output_stream_open( &create_file, (*fix).test_file_name );
+        file_err |= universal_file_output_stream_write( &create_file, &((*fix).test_contents), sizeof((*fix).test_contents) );
+        file_err |= universal_file_output_stream_close( &create_file );
+        file_err |= universal_file_output_stream_open( &create_file, (*fix).empty_file_name );
+        file_err |= universal_file_output_stream_close( &create_file );
+        file_err |= universal_file_output_stream_destroy( &create_file );
+        TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == file_err );
+    }
+    return &test_fixture;
+}
+
+static void tear_down( test_fixture_t *fix )
+{
+    /* cleanup */
+    u8_error_t file_err = U8_ERROR_NONE;
+    file_err |= u8dir_file_remove( (*fix).test_file_name );
+    file_err |= u8dir_file_remove( (*fix).empty_file_name );
+    TEST_ENVIRONMENT_ASSERT( U8_ERROR_NONE == file_err );
+}
+
+static test_case_result_t test_file_read( test_fixture_t *fix )
+{
+    universal_mmap_input_stream_t in_file;
+    u8_error_t file_err = U8_ERROR_NONE;
+
+    /* open an existing and readable file */
+    {
+        universal_mmap_input_stream_init( &in_file );
+        file_err = universal_mmap_input_stream_open( &in_file, (*fix).test_file_name );
+#ifdef _WIN32
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NOT_YET_IMPLEMENTED, file_err, u8_error_get_name );
+        universal_mmap_input_stream_destroy( &in_file );
+        return TEST_CASE_RESULT_OK;
+#else
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+#endif
+    }
+    /* read via the interface */
+    {
+        universal_input_stream_t *base_class = universal_mmap_input_stream_get_input_stream( &in_file );
+        char content[2];
+        size_t read_bytes;
+        file_err = universal_input_stream_read( base_class, &content, sizeof(content), &read_bytes );
+        TEST_EXPECT_EQUAL_INT( sizeof(content), read_bytes );
+        TEST_EXPECT_EQUAL_INT( 0, memcmp( &content, "12", sizeof(content) ) );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+
+        /* take the remaining bytes in place */
+        const void *region_start;
+        size_t region_length;
+        file_err = universal_input_stream_take_region( base_class, &region_start, &region_length );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+        TEST_EXPECT_EQUAL_INT( 2, region_length );
+        TEST_EXPECT_EQUAL_INT( 0, memcmp( region_start, "3", region_length ) );
+
+        file_err = universal_input_stream_read( base_class, &content, sizeof(content), &read_bytes );
+        TEST_EXPECT_EQUAL_INT( 0, read_bytes );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_END_OF_STREAM, file_err, u8_error_get_name );
+
+        /* re-read */
+        file_err = universal_input_stream_reset( base_class );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+        file_err = universal_input_stream_read( base_class, &content, sizeof(content), &read_bytes );
+        TEST_EXPECT_EQUAL_INT( sizeof(content), read_bytes );
+        TEST_EXPECT_EQUAL_INT( 0, memcmp( &content, "12", sizeof(content) ) );
+    }
+    /* close a file */
+    {
+        file_err = universal_mmap_input_stream_close( &in_file );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+        file_err = universal_mmap_input_stream_destroy( &in_file );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+    }
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_buffered_in_place( test_fixture_t *fix )
+{
+    universal_mmap_input_stream_t in_file;
+    u8_error_t file_err = U8_ERROR_NONE;
+
+    universal_mmap_input_stream_init( &in_file );
+    file_err = universal_mmap_input_stream_open( &in_file, (*fix).test_file_name );
+#ifdef _WIN32
+    universal_mmap_input_stream_destroy( &in_file );
+    return TEST_CASE_RESULT_OK;
+#endif
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+
+    /* a buffer input stream reads the mapped file without copying it to its own buffer */
+    {
+        char own_buffer[2];
+        universal_buffer_input_stream_t buf_in;
+        universal_buffer_input_stream_init( &buf_in,
+                                            &own_buffer,
+                                            sizeof(own_buffer),
+                                            universal_mmap_input_stream_get_input_stream( &in_file )
+                                          );
+        TEST_EXPECT( universal_buffer_input_stream_is_in_place( &buf_in ) );
+
+        size_t buffered_len;
+        const char *const buffered = universal_buffer_input_stream_peek_buffered( &buf_in, &buffered_len );
+        TEST_EXPECT_EQUAL_INT( sizeof((*fix).test_contents), buffered_len );
+        TEST_EXPECT_EQUAL_INT( 0, memcmp( buffered, "123", buffered_len ) );
+
+        universal_buffer_input_stream_skip_buffered( &buf_in, 2 );
+        TEST_EXPECT_EQUAL_INT( '3', universal_buffer_input_stream_read_next( &buf_in ) );
+        TEST_EXPECT_EQUAL_INT( 3, universal_buffer_input_stream_read_pos( &buf_in ) );
+        TEST_EXPECT_EQUAL_INT( '\0', universal_buffer_input_stream_read_next( &buf_in ) );
+        TEST_EXPECT_EQUAL_INT( '\0', universal_buffer_input_stream_read_next( &buf_in ) );
+
+        /* at the end of the region, the own buffer is used again */
+        TEST_EXPECT( ! universal_buffer_input_stream_is_in_place( &buf_in ) );
+
+        universal_buffer_input_stream_destroy( &buf_in );
+    }
+
+    file_err = universal_mmap_input_stream_destroy( &in_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_empty_file( test_fixture_t *fix )
+{
+    universal_mmap_input_stream_t in_file;
+    u8_error_t file_err = U8_ERROR_NONE;
+
+    universal_mmap_input_stream_init( &in_file );
+    file_err = universal_mmap_input_stream_open( &in_file, (*fix).empty_file_name );
+#ifdef _WIN32
+    universal_mmap_input_stream_destroy( &in_file );
+    return TEST_CASE_RESULT_OK;
+#endif
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+
+    char content[2];
+    size_t read_bytes;
+    file_err = universal_mmap_input_stream_read( &in_file, &content, sizeof(content), &read_bytes );
+    TEST_EXPECT_EQUAL_INT( 0, read_bytes );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_END_OF_STREAM, file_err, u8_error_get_name );
+
+    const void *region_start;
+    size_t region_length;
+    file_err = universal_mmap_input_stream_take_region( &in_file, &region_start, &region_length );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 0, region_length );
+
+    file_err = universal_mmap_input_stream_close( &in_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+    file_err = universal_mmap_input_stream_destroy( &in_file );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_wrong_mode( test_fixture_t *fix )
+{
+    universal_mmap_input_stream_t in_file;
+    u8_error_t file_err = U8_ERROR_NONE;
+
+    universal_mmap_input_stream_init( &in_file );
+
+    /* read, reset and close before open */
+    {
+        char content[2];
+        size_t read_bytes;
+        file_err = universal_mmap_input_stream_read( &in_file, &content, sizeof(content), &read_bytes );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_WRONG_STATE, file_err, u8_error_get_name );
+        file_err = universal_mmap_input_stream_reset( &in_file );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_WRONG_STATE, file_err, u8_error_get_name );
+        file_err = universal_mmap_input_stream_close( &in_file );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_WRONG_STATE, file_err, u8_error_get_name );
+    }
+#ifndef _WIN32
+    /* open a non existing file and a directory */
+    {
+        file_err = universal_mmap_input_stream_open( &in_file, "non_existant.file" );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_AT_FILE_READ, file_err, u8_error_get_name );
+        file_err = universal_mmap_input_stream_open( &in_file, "." );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_AT_FILE_READ, file_err, u8_error_get_name );
+    }
+    /* open twice */
+    {
+        file_err = universal_mmap_input_stream_open( &in_file, (*fix).test_file_name );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+        file_err = universal_mmap_input_stream_open( &in_file, (*fix).test_file_name );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_WRONG_STATE, file_err, u8_error_get_name );
+    }
+#endif
+    /* destroy without close */
+    {
+        file_err = universal_mmap_input_stream_destroy( &in_file );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, file_err, u8_error_get_name );
+    }
+
+    return TEST_CASE_RESULT_OK;
+}
+
+
+/*
+ * Copyright 2026-2026 Andreas Warnke
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
@@ -86,6 +86,7 @@ static test_case_result_t test_error( test_fixture_t *fix )
     TEST_EXPECT_EQUAL_STRING( "U8_ERROR_LIB_NO_MEMORY", u8_error_get_name( U8_ERROR_LIB_NO_MEMORY ) );
     TEST_EXPECT_EQUAL_STRING( "U8_ERROR_LIB_FILE_WRITE", u8_error_get_name( U8_ERROR_LIB_FILE_WRITE ) );
     TEST_EXPECT_EQUAL_STRING( "U8_ERROR_NO_DB", u8_error_get_name( U8_ERROR_NO_DB ) );
+    TEST_EXPECT_EQUAL_STRING( "U8_ERROR_CANCELLED", u8_error_get_name( U8_ERROR_CANCELLED ) );
     TEST_EXPECT_EQUAL_STRING( "U8_ERROR_OBJECT_STILL_REFERENCED", u8_error_get_name( U8_ERROR_OBJECT_STILL_REFERENCED ) );
     TEST_EXPECT_EQUAL_STRING( "U8_ERROR_DIAGRAM_HIDES_RELATIONSHIPS", u8_error_get_name( U8_ERROR_DIAGRAM_HIDES_RELATIONSHIPS ) );
     TEST_EXPECT_EQUAL_STRING( "U8_ERROR_DIAGRAM_HIDES_FEATURES", u8_error_get_name( U8_ERROR_DIAGRAM_HIDES_FEATURES ) );
@@ -12,7 +12,9 @@
 static test_fixture_t * set_up();
 static void tear_down( test_fixture_t *fix );
 static test_case_result_t test_insert_and_retrieve( test_fixture_t *fix );
-static test_case_result_t test_insert_too_many( test_fixture_t *fix );
+static test_case_result_t test_insert_and_grow( test_fixture_t *fix );
+static test_case_result_t test_append_and_sort( test_fixture_t *fix );
+static test_case_result_t test_append_and_grow( test_fixture_t *fix );
 
 test_suite_t universal_array_index_sorter_test_get_suite(void)
 {
@@ -24,16 +26,23 @@ test_suite_t universal_array_index_sorter_test_get_suite(void)
                      &tear_down
                    );
     test_suite_add_test_case( &result, "test_insert_and_retrieve", &test_insert_and_retrieve );
-    test_suite_add_test_case( &result, "test_insert_too_many", &test_insert_too_many );
+    test_suite_add_test_case( &result, "test_insert_and_grow", &test_insert_and_grow );
+    test_suite_add_test_case( &result, "test_append_and_sort", &test_append_and_sort );
+    test_suite_add_test_case( &result, "test_append_and_grow", &test_append_and_grow );
     return result;
 }
 
 struct test_fixture_struct {
     universal_array_index_sorter_t testee;  /* the array index sorter to be tested */
+    universal_array_index_sorter_t reference;  /* a reference sorter filled by insert */
 };
 typedef struct test_fixture_struct test_fixture_t;  /* double declaration as reminder */
 static test_fixture_t test_fixture;
 
+enum universal_array_index_sorter_test_enum {
+    TEST_MANY_ENTRIES = 5000,  /* grows the sorter several times, not a power of two */
+};
+
 static test_fixture_t * set_up()
 {
     universal_array_index_sorter_init( &(test_fixture.testee) );
@@ -98,16 +107,16 @@ static test_case_result_t test_insert_and_retrieve( test_fixture_t *fix )
     return TEST_CASE_RESULT_OK;
 }
 
-static test_case_result_t test_insert_too_many( test_fixture_t *fix )
+static test_case_result_t test_insert_and_grow( test_fixture_t *fix )
 {
     u8_error_t err;
     uint32_t count;
     uint32_t unsorted_index;
 
-    /* insert exact the max size */
-    for ( uint_fast32_t idx = 0; idx < UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE; idx ++ )
+    /* insert many, each in front */
+    for ( uint_fast32_t idx = 0; idx < TEST_MANY_ENTRIES; idx ++ )
     {
-        err = universal_array_index_sorter_insert( &((*fix).testee), idx*10, UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE-idx );
+        err = universal_array_index_sorter_insert( &((*fix).testee), idx*10, TEST_MANY_ENTRIES-idx );
         TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
         count = universal_array_index_sorter_get_count( &((*fix).testee) );
         TEST_EXPECT_EQUAL_INT( 1+idx, count );
@@ -115,11 +124,116 @@ static test_case_result_t test_insert_too_many( test_fixture_t *fix )
         TEST_EXPECT_EQUAL_INT( idx*10, unsorted_index );
     }
 
-    /* insert one too many */
-    err = universal_array_index_sorter_insert( &((*fix).testee), 99900, -18 );
-    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_ARRAY_BUFFER_EXCEEDED, err, u8_error_get_name );
+    /* insert one more in the middle */
+    err = universal_array_index_sorter_insert( &((*fix).testee), 99900, TEST_MANY_ENTRIES/2 );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
     count = universal_array_index_sorter_get_count( &((*fix).testee) );
-    TEST_EXPECT_EQUAL_INT( UNIVERSAL_ARRAY_INDEX_SORTER_MAX_ARRAY_SIZE, count );
+    TEST_EXPECT_EQUAL_INT( TEST_MANY_ENTRIES+1, count );
+    unsorted_index = universal_array_index_sorter_get_array_index( &((*fix).testee), TEST_MANY_ENTRIES/2 /* = sort_index */ );
+    TEST_EXPECT_EQUAL_INT( 99900, unsorted_index );
+    unsorted_index = universal_array_index_sorter_get_array_index( &((*fix).testee), TEST_MANY_ENTRIES /* = sort_index */ );
+    TEST_EXPECT_EQUAL_INT( 0, unsorted_index );
+
+    /* done */
+    return TEST_CASE_RESULT_OK;
+}
+
+
+static test_case_result_t test_append_and_sort( test_fixture_t *fix )
+{
+    u8_error_t err;
+    uint32_t count;
+
+    /* sort an empty list */
+    universal_array_index_sorter_sort( &((*fix).testee) );
+    count = universal_array_index_sorter_get_count( &((*fix).testee) );
+    TEST_EXPECT_EQUAL_INT( 0, count );
+
+    /* append and sort a few entries, equal weights keep the order of appending */
+    err = universal_array_index_sorter_append( &((*fix).testee), 17001, -17 );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    err = universal_array_index_sorter_append( &((*fix).testee), 23000, 5 );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    err = universal_array_index_sorter_append( &((*fix).testee), 45022, -17 );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    err = universal_array_index_sorter_append( &((*fix).testee), 99900, INT64_MIN );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    universal_array_index_sorter_sort( &((*fix).testee) );
+    count = universal_array_index_sorter_get_count( &((*fix).testee) );
+    TEST_EXPECT_EQUAL_INT( 4, count );
+    TEST_EXPECT_EQUAL_INT( 99900, universal_array_index_sorter_get_array_index( &((*fix).testee), 0 ) );
+    TEST_EXPECT_EQUAL_INT( 17001, universal_array_index_sorter_get_array_index( &((*fix).testee), 1 ) );
+    TEST_EXPECT_EQUAL_INT( 45022, universal_array_index_sorter_get_array_index( &((*fix).testee), 2 ) );
+    TEST_EXPECT_EQUAL_INT( 23000, universal_array_index_sorter_get_array_index( &((*fix).testee), 3 ) );
+
+    /* a long list with many equal weights results in the same order as inserting one by one */
+    universal_array_index_sorter_reinit( &((*fix).testee) );
+    universal_array_index_sorter_init( &((*fix).reference) );
+    uint32_t pseudo_random = 4711;
+    for ( uint_fast32_t idx = 0; idx < TEST_MANY_ENTRIES; idx ++ )
+    {
+        pseudo_random = pseudo_random * 1103515245 + 12345;
+        const int64_t weight = (int64_t)( ( pseudo_random >> 16 ) % 97 ) - 48;
+        err = universal_array_index_sorter_append( &((*fix).testee), idx, weight );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+        err = universal_array_index_sorter_insert( &((*fix).reference), idx, weight );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    }
+    universal_array_index_sorter_sort( &((*fix).testee) );
+    count = universal_array_index_sorter_get_count( &((*fix).testee) );
+    TEST_EXPECT_EQUAL_INT( TEST_MANY_ENTRIES, count );
+    for ( uint_fast32_t sort_idx = 0; sort_idx < TEST_MANY_ENTRIES; sort_idx ++ )
+    {
+        TEST_EXPECT_EQUAL_INT( universal_array_index_sorter_get_array_index( &((*fix).reference), sort_idx ),
+                               universal_array_index_sorter_get_array_index( &((*fix).testee), sort_idx )
+                             );
+    }
+
+    /* sorting again does not change the order */
+    universal_array_index_sorter_sort( &((*fix).testee) );
+    for ( uint_fast32_t sort_idx = 0; sort_idx < TEST_MANY_ENTRIES; sort_idx ++ )
+    {
+        TEST_EXPECT_EQUAL_INT( universal_array_index_sorter_get_array_index( &((*fix).reference), sort_idx ),
+                               universal_array_index_sorter_get_array_index( &((*fix).testee), sort_idx )
+                             );
+    }
+    universal_array_index_sorter_destroy( &((*fix).reference) );
+
+    /* done */
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_append_and_grow( test_fixture_t *fix )
+{
+    u8_error_t err;
+    uint32_t count;
+
+    /* append a few and sort, this allocates a small merge buffer */
+    for ( uint_fast32_t idx = 0; idx < 10; idx ++ )
+    {
+        err = universal_array_index_sorter_append( &((*fix).testee), idx*10, 10-idx );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    }
+    universal_array_index_sorter_sort( &((*fix).testee) );
+    TEST_EXPECT_EQUAL_INT( 90, universal_array_index_sorter_get_array_index( &((*fix).testee), 0 ) );
+
+    /* re-use the allocated memory and grow entries, weights and merge buffer */
+    universal_array_index_sorter_reinit( &((*fix).testee) );
+    for ( uint_fast32_t idx = 0; idx < TEST_MANY_ENTRIES; idx ++ )
+    {
+        err = universal_array_index_sorter_append( &((*fix).testee), idx*10, TEST_MANY_ENTRIES-idx );
+        TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    }
+    count = universal_array_index_sorter_get_count( &((*fix).testee) );
+    TEST_EXPECT_EQUAL_INT( TEST_MANY_ENTRIES, count );
+
+    /* sort the reverse order */
+    universal_array_index_sorter_sort( &((*fix).testee) );
+    for ( uint_fast32_t sort_idx = 0; sort_idx < TEST_MANY_ENTRIES; sort_idx ++ )
+    {
+        const uint32_t unsorted_index = universal_array_index_sorter_get_array_index( &((*fix).testee), sort_idx );
+        TEST_EXPECT_EQUAL_INT( (TEST_MANY_ENTRIES-1-sort_idx)*10, unsorted_index );
+    }
 
     /* done */
     return TEST_CASE_RESULT_OK;
@@ -120,12 +120,22 @@ static test_case_result_t test_append_border_cases( test_fixture_t *fix )
     err = universal_output_stream_write ( my_out_stream, test_1, strlen(test_1) );
     TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
     TEST_EXPECT_EQUAL_INT( 0, memcmp( &((*fix).out_buffer[0]), &test_1, sizeof((*fix).buffer) /*=6*/ ) );
+    TEST_EXPECT_EQUAL_INT( 1, universal_buffer_output_stream_get_fill( &((*fix).buf_out_stream) ) );
+    TEST_EXPECT_EQUAL_INT( 7, universal_buffer_output_stream_get_byte_count( &((*fix).buf_out_stream) ) );
+    TEST_EXPECT_EQUAL_INT( 1, universal_buffer_output_stream_get_write_count( &((*fix).buf_out_stream) ) );
+    TEST_EXPECT_EQUAL_INT( 1, universal_buffer_output_stream_get_sink_write_count( &((*fix).buf_out_stream) ) );
+    TEST_EXPECT_EQUAL_INT( 1, universal_buffer_output_stream_get_flush_count( &((*fix).buf_out_stream) ) );
 
     /* write more than current-buf remainder (5) plus buf-size (6) --> 12 */
     const char test_2[] = "890abcdefghi";
     err = universal_output_stream_write ( my_out_stream, test_2, strlen(test_2) );
     TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
     TEST_EXPECT_EQUAL_INT( 0, memcmp( &((*fix).out_buffer[0]), "1234567890abcdefghi", 19 ) );
+    TEST_EXPECT_EQUAL_INT( 0, universal_buffer_output_stream_get_fill( &((*fix).buf_out_stream) ) );
+    TEST_EXPECT_EQUAL_INT( 19, universal_buffer_output_stream_get_byte_count( &((*fix).buf_out_stream) ) );
+    TEST_EXPECT_EQUAL_INT( 2, universal_buffer_output_stream_get_write_count( &((*fix).buf_out_stream) ) );
+    TEST_EXPECT_EQUAL_INT( 3, universal_buffer_output_stream_get_sink_write_count( &((*fix).buf_out_stream) ) );
+    TEST_EXPECT_EQUAL_INT( 2, universal_buffer_output_stream_get_flush_count( &((*fix).buf_out_stream) ) );
 
     /* write more than target memory location can hold*/
     const char test_3[] = "!!!4567";
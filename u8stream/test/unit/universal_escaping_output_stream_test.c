@@ -14,6 +14,9 @@ static test_fixture_t * set_up();
 static void tear_down( test_fixture_t *fix );
 static test_case_result_t test_write_regular( test_fixture_t *fix );
 static test_case_result_t test_write_border_cases( test_fixture_t *fix );
+static test_case_result_t test_write_shared_first_bytes( test_fixture_t *fix );
+static test_case_result_t test_write_long_buffer( test_fixture_t *fix );
+static test_case_result_t test_too_many_patterns( test_fixture_t *fix );
 
 test_suite_t universal_escaping_output_stream_test_get_suite(void)
 {
@@ -26,13 +29,26 @@ test_suite_t universal_escaping_output_stream_test_get_suite(void)
                    );
     test_suite_add_test_case( &result, "test_write_regular", &test_write_regular );
     test_suite_add_test_case( &result, "test_write_border_cases", &test_write_border_cases );
+    test_suite_add_test_case( &result, "test_write_shared_first_bytes", &test_write_shared_first_bytes );
+    test_suite_add_test_case( &result, "test_write_long_buffer", &test_write_long_buffer );
+    test_suite_add_test_case( &result, "test_too_many_patterns", &test_too_many_patterns );
     return result;
 }
 
 const char *const ((my_patterns_and_replacements)[][2]) = {{"&","&amp;"},{"--","- - "},{"\n","  \n"},{NULL,NULL}};
 
+const char *const ((my_too_many_patterns)[][2])
+    = {{"a","0"},{"b","1"},{"c","2"},{"d","3"},{"e","4"},{"f","5"},{"g","6"},{"h","7"},
+       {"i","8"},{"j","9"},{"k","10"},{"l","11"},{"m","12"},{"n","13"},{"o","14"},{"p","15"},
+       {"q","16"},{"r","17"},{"s","18"},{"t","19"},{"u","20"},{"v","21"},{"w","22"},{"x","23"},
+       {"y","24"},{"z","25"},{"A","26"},{"B","27"},{"C","28"},{"D","29"},{"E","30"},{"F","31"},
+       {"G","32"},{NULL,NULL}};
+
+const char *const ((my_shared_first_bytes)[][2]) = {{"",""},{"<!--","[c]"},{"<","&lt;"},{"<!","[x]"},{"\xc3\xa4","ae"},{"z",NULL},{NULL,NULL}};
+
 struct test_fixture_struct {
     char out_buffer[16];
+    char long_buffer[4096];
     universal_memory_output_stream_t mem_out_stream;
     universal_escaping_output_stream_t esc_out_stream;
 };
@@ -132,6 +148,123 @@ static test_case_result_t test_write_border_cases( test_fixture_t *fix )
     return TEST_CASE_RESULT_OK;
 }
 
+static test_case_result_t test_write_shared_first_bytes( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t err;
+
+    universal_memory_output_stream_t mem_out;
+    universal_memory_output_stream_init( &mem_out,
+                                         &((*fix).long_buffer),
+                                         sizeof((*fix).long_buffer),
+                                         UNIVERSAL_MEMORY_OUTPUT_STREAM_0TERM_UTF8
+                                       );
+    universal_escaping_output_stream_t esc_out;
+    universal_escaping_output_stream_init( &esc_out,
+                                           &my_shared_first_bytes,
+                                           universal_memory_output_stream_get_output_stream( &mem_out )
+                                         );
+
+    /* the first matching pattern in table order wins, empty patterns never match, NULL replacements delete */
+    const char test_1[] = "a<!--b<!c<\xc3\xa4z<!-";
+    err = universal_escaping_output_stream_write( &esc_out, test_1, strlen(test_1) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    err = universal_escaping_output_stream_flush( &esc_out );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 0, strcmp( &((*fix).long_buffer[0]), "a[c]b&lt;!c&lt;ae&lt;!-" ) );
+
+    /* switch rules */
+    err = universal_memory_output_stream_reset( &mem_out );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    universal_escaping_output_stream_change_rules( &esc_out, &my_patterns_and_replacements );
+    err = universal_escaping_output_stream_write( &esc_out, test_1, strlen(test_1) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    err = universal_escaping_output_stream_flush( &esc_out );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 0, strcmp( &((*fix).long_buffer[0]), "a<!- - b<!c<\xc3\xa4z<!-" ) );
+
+    err = universal_escaping_output_stream_destroy( &esc_out );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    universal_memory_output_stream_destroy( &mem_out );
+    return TEST_CASE_RESULT_OK;
+}
+
+static test_case_result_t test_write_long_buffer( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t err;
+
+    universal_memory_output_stream_t mem_out;
+    universal_memory_output_stream_init( &mem_out,
+                                         &((*fix).long_buffer),
+                                         sizeof((*fix).long_buffer),
+                                         UNIVERSAL_MEMORY_OUTPUT_STREAM_0TERM_BYTE
+                                       );
+    universal_escaping_output_stream_t esc_out;
+    universal_escaping_output_stream_init( &esc_out,
+                                           &my_patterns_and_replacements,
+                                           universal_memory_output_stream_get_output_stream( &mem_out )
+                                         );
+
+    /* mix long unchanged runs and many replacements, exceeding the internal staging buffer */
+    char input[1200];
+    char expected[2400];
+    size_t expected_len = 0;
+    for ( size_t idx = 0; idx < sizeof(input); idx ++ )
+    {
+        const bool in_long_run = (( idx / 300 ) % 2 == 1 );
+        if (( ! in_long_run )&&( idx % 3 == 0 ))
+        {
+            input[idx] = '&';
+            memcpy( &(expected[expected_len]), "&amp;", 5 );
+            expected_len += 5;
+        }
+        else
+        {
+            input[idx] = 'A' + ( idx % 26 );
+            expected[expected_len] = input[idx];
+            expected_len ++;
+        }
+    }
+    err = universal_escaping_output_stream_write( &esc_out, &input, sizeof(input) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    err = universal_escaping_output_stream_flush( &esc_out );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( expected_len, strlen( &((*fix).long_buffer[0]) ) );
+    TEST_EXPECT_EQUAL_INT( 0, memcmp( &((*fix).long_buffer[0]), &expected, expected_len ) );
+
+    err = universal_escaping_output_stream_destroy( &esc_out );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    universal_memory_output_stream_destroy( &mem_out );
+    return TEST_CASE_RESULT_OK;
+}
+
+
+static test_case_result_t test_too_many_patterns( test_fixture_t *fix )
+{
+    assert( fix != NULL );
+    u8_error_t err;
+
+    /* a table with more than UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS patterns is reported */
+    TEST_ENVIRONMENT_ASSERT( UNIVERSAL_ESCAPING_OUTPUT_STREAM_MAX_PATTERNS == 32 );
+    err = universal_escaping_output_stream_change_rules( &((*fix).esc_out_stream), &my_too_many_patterns );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_ARRAY_BUFFER_EXCEEDED, err, u8_error_get_name );
+
+    /* the patterns within the limit are used, further ones are ignored */
+    const char test_1[] = "aFG";
+    err = universal_escaping_output_stream_write( &((*fix).esc_out_stream), test_1, strlen(test_1) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    err = universal_escaping_output_stream_flush( &((*fix).esc_out_stream) );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+    TEST_EXPECT_EQUAL_INT( 0, strcmp( &((*fix).out_buffer[0]), "031G" ) );
+
+    /* a table within the limit is accepted */
+    err = universal_escaping_output_stream_change_rules( &((*fix).esc_out_stream), &my_patterns_and_replacements );
+    TEST_EXPECT_EQUAL_ENUM( U8_ERROR_NONE, err, u8_error_get_name );
+
+    return TEST_CASE_RESULT_OK;
+}
+
 
 /*
  * Copyright 2020-2026 Andreas Warnke